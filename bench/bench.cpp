@@ -0,0 +1,2352 @@
+/**
+ * AiLight Benchmark
+ *
+ * Microbenchmarks of the AiLight libraries, built for the host with the
+ * PlatformIO 'native' environment (pio run -e native, then run
+ * .pioenvs/native/program). The LED driver is replaced by a recording mock, so
+ * besides the time per operation the number of driver writes per operation is
+ * reported. Run with 'trace' as argument to dump the driver calls of a
+ * transition (as CSV) instead, with 'trace <effect> [duration]' to dump the
+ * frames of an effect (a built-in effect or an effect program in hexadecimal,
+ * run as the custom effect), with 'group' to simulate a group of lights
+ * starting group commands (reporting the spread of the start instants),
+ * with 'replay <log> [refresh rate]' to replay a log of the command recorder
+ * (reporting the frames rendered and the latency of the commands), with
+ * 'color' to compare the colour conversions with floating point references
+ * (reporting their accuracy), or with 'realtime [rate] [loss %] [reorder %]'
+ * to stream DDP frames over UDP to a light (reporting the latency and jitter
+ * of the frames displayed). The modes 'state', 'config', 'malformed', 'merge',
+ * 'publish' and 'push' check the StateStore on emulated flash memory, the
+ * stored configuration (and its migration), the command decoder with malformed
+ * input, the merging of queued commands, the publish queue of the MQTT
+ * messages and the pushes of the light state to the WebSocket clients.
+ * The modes with checks exit with 1 if a check fails.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "AiLight.hpp"
+#include "ColorSpace.hpp"
+#include "Command.hpp"
+#include "CommandQueue.hpp"
+#include "ConfigStore.hpp"
+#include "Controller.hpp"
+#include "GroupSync.hpp"
+#include "Histogram.hpp"
+#include "PublishQueue.hpp"
+#include "RAMFlashStorage.hpp"
+#include "Realtime.hpp"
+#include "Recorder.hpp"
+#include "Sequencer.hpp"
+#include "StateStore.hpp"
+#include "Transition.hpp"
+#include "configuration.h"
+#include "statepush.h"
+#include <Arduino.h>
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <cmath>
+#include <netinet/in.h>
+#include <poll.h>
+#include <random>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+// Prevents the compiler from optimising away a result
+static volatile uint32_t sink;
+
+// Number of failed checks
+static uint32_t failures = 0;
+
+/**
+ * @brief Prints the outcome of a check
+ *
+ * @param name the description of the check
+ * @param passed whether the check passed
+ *
+ * @return whether the check passed
+ */
+bool check(const char *name, bool passed) {
+  printf("%-60s %s\n", name, passed ? "ok" : "FAILED");
+  if (!passed) {
+    failures++;
+  }
+
+  return passed;
+}
+
+/**
+ * @brief Runs a benchmark and prints the time and driver writes per operation
+ *
+ * @param name the name of the benchmark
+ * @param iterations the number of operations
+ * @param operation the operation, called with the iteration number
+ *
+ * @return void
+ */
+template <typename Operation>
+void benchmark(const char *name, uint32_t iterations, Operation operation) {
+  // Warm up (caches, branch predictors)
+  for (uint32_t i = 0; i < iterations / 10; i++) {
+    operation(i);
+  }
+
+  my92xx::reset();
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < iterations; i++) {
+    operation(i);
+  }
+  std::chrono::steady_clock::duration elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+
+  printf("%-28s %12.1f %12.2f %12.2f\n", name, ns / iterations,
+         (double)my92xx::channel_writes / iterations,
+         (double)my92xx::updates / iterations);
+}
+
+/**
+ * @brief Renders a transition of 1000 steps (one per millisecond)
+ *
+ * @param light the light to render the transition on
+ * @param from the levels to start from
+ * @param to the levels to end with
+ *
+ * @return void
+ */
+void renderTransition(AiLightClass &light, const Frame &from, const Frame &to) {
+  TransitionClass transition;
+  Frame frame;
+
+  transition.begin(from, to, 0, 1000, EASING_PERCEPTUAL);
+  for (uint32_t now = 0; transition.isRunning(); now++) {
+    if (transition.update(now, frame)) {
+      light.apply(frame, true);
+    }
+  }
+}
+
+/**
+ * @brief Runs an effect and prints the frames sent (as CSV)
+ *
+ * The effect is started the way the firmware does (decoding an effect or
+ * program command and processing it with the light controller), on a light
+ * that has been switched on with a warm colour first.
+ *
+ * @param effect the name of a built-in effect, or an effect program (in
+ * hexadecimal) to be uploaded and run as the custom effect
+ * @param duration the time (in milliseconds) to render endless effects for
+ *
+ * @return 0 if the effect has been run, otherwise 1
+ */
+int traceEffect(const char *effect, uint32_t duration) {
+  static const char on[] =
+      "{\"state\":\"ON\",\"brightness\":255,\"color\":{\"r\":255,\"g\":128,"
+      "\"b\":32},\"white_value\":200}";
+
+  AiLightClass light(MY92XX_MODEL, MY92XX_CHIPS);
+  SequencerClass sequencer;
+  TransitionClass transition;
+  RealtimeClass realtime;
+  LightControllerClass controller(sequencer, transition, realtime,
+                                  EASING_LINEAR);
+  CommandDecoderClass decoder("ON", NULL);
+  light_command_t command;
+  uint8_t id;
+
+  char json[2 * SEQUENCER_PROGRAM_MAX + 32];
+  snprintf(json, sizeof(json),
+           SequencerClass::findEffect(effect, strlen(effect), id)
+               ? "{\"effect\":\"%s\"}"
+               : "{\"program\":\"%s\"}",
+           effect);
+
+  if (decoder.decode(json, strlen(json), command) != COMMAND_OK) {
+    fprintf(stderr, "%s is no effect or valid effect program\n", effect);
+    return 1;
+  }
+
+  // An uploaded program is handed over like the network side does
+  if (command.fields & COMMAND_PROGRAM) {
+    size_t length;
+    const uint8_t *program = decoder.getProgram(length);
+    sequencer.post(program, length);
+  }
+
+  sequencer.seed(1);
+  controller.begin(&light);
+
+  light_command_t switchOn;
+  decoder.decode(on, sizeof(on) - 1, switchOn);
+  controller.process(switchOn, 0);
+
+  my92xx::reset();
+  controller.process(command, 0);
+
+  printf("time_ms,state,red,green,blue,white,brightness,running\n");
+  uint32_t updates = 0;
+  for (uint32_t now = 0; now <= duration; now++) {
+    controller.update(now);
+
+    if (my92xx::updates != updates) {
+      updates = my92xx::updates;
+
+      Color color = light.getColor();
+      printf("%u,%u,%u,%u,%u,%u,%u,%u\n", now, light.getState(), color.red,
+             color.green, color.blue, color.white, light.getBrightness(),
+             sequencer.isRunning());
+    }
+
+    // Finite effects end (restoring the light if the program says so)
+    if (!sequencer.isRunning() && !transition.isRunning()) {
+      break;
+    }
+  }
+
+  return 0;
+}
+
+// A light of the group simulation
+struct SimulatedLight {
+  GroupSyncClass group;
+  uint32_t boot;     // Local clock at the start of the simulation
+  double drift;      // Local clock rate deviation (e.g. 40 ppm is 40e-6)
+  uint64_t loop;     // Next main loop iteration (simulation time)
+  uint64_t received; // Time the command has been received (0 if none)
+  uint64_t start;    // Time the command has been started
+
+  // Local clock (in microseconds) at a simulation time
+  uint32_t local(uint64_t time) {
+    return boot + (uint32_t)(time * (1 + drift));
+  }
+};
+
+// A packet on its way (multicast to all other lights)
+struct SimulatedPacket {
+  uint64_t arrival;
+  uint8_t light;
+  uint8_t data[GROUP_PACKET_SIZE];
+};
+
+/**
+ * @brief Simulates a group of lights starting group commands
+ *
+ * Each light has its own clock (random offset and drift) and main loop. The
+ * MQTT broker is replaced by a stand-in delivering each group command to the
+ * lights with a random delay, multicast packets arrive with a random delay and
+ * are lost at random. The spread of the instants the lights start each
+ * command is compared to starting on reception.
+ *
+ * @return void
+ */
+void simulateGroup() {
+  static const uint8_t LIGHTS = 12;
+  static const uint32_t COMMANDS = 50;
+  static const uint32_t START_DELAY = 150; // Milliseconds
+  static const uint64_t STEP = 100;        // Microseconds
+
+  std::mt19937 random(1);
+  std::uniform_int_distribution<uint32_t> any;
+  std::uniform_int_distribution<uint32_t> loopTime(200, 3000);
+  std::uniform_int_distribution<uint32_t> udpDelay(1000, 8000);
+  std::uniform_int_distribution<uint32_t> mqttDelay(5000, 90000);
+  std::uniform_real_distribution<double> drift(-40e-6, 40e-6);
+  std::bernoulli_distribution lost(0.03);
+
+  std::vector<SimulatedLight> lights(LIGHTS);
+  for (uint8_t i = 0; i < LIGHTS; i++) {
+    lights[i].boot = any(random);
+    lights[i].drift = drift(random);
+    lights[i].loop = loopTime(random);
+    lights[i].group.begin(any(random) | 1, START_DELAY,
+                          lights[i].local(lights[i].loop));
+  }
+
+  std::vector<SimulatedPacket> packets;
+  uint8_t data[GROUP_PACKET_SIZE];
+  uint64_t publish = 30000000; // After the group clock has settled
+  bool publishing = false;      // Whether the command is being started
+  uint32_t commands = 0;
+  uint32_t hash = 0;
+
+  double skewSum = 0, skewMax = 0, receivedSum = 0, receivedMax = 0;
+  uint32_t fallbacks = 0;
+
+  printf("command,skew_us,received_spread_us\n");
+
+  for (uint64_t time = 0;; time += STEP) {
+    // The broker stand-in delivers a group command to all lights
+    if (!publishing && time >= publish) {
+      hash = GroupSyncClass::hash(&commands, sizeof(commands));
+      for (uint8_t i = 0; i < LIGHTS; i++) {
+        lights[i].received = time + mqttDelay(random);
+        lights[i].start = 0;
+      }
+      commands++;
+      publishing = true;
+    }
+
+    for (uint8_t i = 0; i < LIGHTS; i++) {
+      SimulatedLight &light = lights[i];
+      if (time < light.loop) {
+        continue;
+      }
+      light.loop = time + loopTime(random);
+      uint32_t now = light.local(time);
+
+      // Received packets
+      for (size_t j = 0; j < packets.size();) {
+        if (packets[j].light == i && packets[j].arrival <= time) {
+          light.group.receive(packets[j].data, GROUP_PACKET_SIZE, now);
+          packets.erase(packets.begin() + j);
+        } else {
+          j++;
+        }
+      }
+
+      size_t length = light.group.poll(now, data);
+      if (light.received > 0 && light.received <= time && light.start == 0 &&
+          !light.group.isHeld()) {
+        length = std::max(length, light.group.hold(hash, now, data));
+        light.start = 1; // Held
+      }
+
+      // Multicast (to all other lights)
+      for (uint8_t j = 0; length > 0 && j < LIGHTS; j++) {
+        if (j != i && !lost(random)) {
+          SimulatedPacket packet = {time + udpDelay(random), j, {0}};
+          memcpy(packet.data, data, GROUP_PACKET_SIZE);
+          packets.push_back(packet);
+        }
+      }
+
+      if (light.group.due(now)) {
+        light.start = time;
+      }
+    }
+
+    // All lights have started the command
+    bool started = publishing;
+    for (uint8_t i = 0; started && i < LIGHTS; i++) {
+      started = lights[i].start > 1;
+    }
+
+    if (started) {
+      uint64_t first = UINT64_MAX, last = 0, firstReceived = UINT64_MAX,
+               lastReceived = 0;
+      for (uint8_t i = 0; i < LIGHTS; i++) {
+        first = std::min(first, lights[i].start);
+        last = std::max(last, lights[i].start);
+        firstReceived = std::min(firstReceived, lights[i].received);
+        lastReceived = std::max(lastReceived, lights[i].received);
+        lights[i].received = 0;
+      }
+
+      double skew = last - first;
+      double spread = lastReceived - firstReceived;
+      skewSum += skew;
+      skewMax = std::max(skewMax, skew);
+      receivedSum += spread;
+      receivedMax = std::max(receivedMax, spread);
+      printf("%u,%.0f,%.0f\n", commands, skew, spread);
+
+      publishing = false;
+      publish = time + 5000000;
+      if (commands == COMMANDS) {
+        break;
+      }
+    }
+  }
+
+  for (uint8_t i = 0; i < LIGHTS; i++) {
+    fallbacks += lights[i].group.getFallbacks();
+  }
+
+  printf("# start skew: mean %.0f us, max %.0f us (received: mean %.0f us, max "
+         "%.0f us), unsynchronised starts: %u of %u\n",
+         skewSum / COMMANDS, skewMax, receivedSum / COMMANDS, receivedMax,
+         fallbacks, COMMANDS * LIGHTS);
+}
+
+/**
+ * @brief Replays a log of the command recorder
+ *
+ * The commands are fed to the command decoder, queue and light controller at
+ * the time they have been received, on a simulated clock with a main loop
+ * iteration every millisecond, so a replay is deterministic. The light starts
+ * from its defaults. Each frame sent to the LED driver is printed (as CSV),
+ * followed by the latency of the commands: from their reception until they
+ * have been processed by the main loop, and until the frame showing them has
+ * been sent (commands not changing the output have no such frame).
+ *
+ * @param path the path of the log
+ * @param rate the refresh rate of the output (frames per second)
+ *
+ * @return 0 if the log has been replayed, otherwise 1
+ */
+int replay(const char *path, uint16_t rate) {
+  static const uint32_t TAIL = 10000; // Time rendered after the last command
+  static const uint8_t BUDGET = 8;    // Commands merged per iteration
+
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) {
+    fprintf(stderr, "Unable to open %s\n", path);
+    return 1;
+  }
+
+  std::vector<uint8_t> log;
+  uint8_t chunk[4096];
+  for (size_t length; (length = fread(chunk, 1, sizeof(chunk), file)) > 0;) {
+    log.insert(log.end(), chunk, chunk + length);
+  }
+  fclose(file);
+
+  std::vector<record_t> records;
+  record_t record;
+  size_t offset = 0;
+  while (RecorderClass::parse(log.data(), log.size(), offset, record)) {
+    records.push_back(record);
+  }
+  if (offset != log.size()) {
+    fprintf(stderr, "%s is not a valid log\n", path);
+    return 1;
+  }
+  if (records.empty()) {
+    return 0;
+  }
+
+  AiLightClass light(MY92XX_MODEL, MY92XX_CHIPS);
+  SequencerClass sequencer;
+  TransitionClass transition;
+  RealtimeClass realtime;
+  LightControllerClass controller(sequencer, transition, realtime,
+                                  EASING_LINEAR);
+  CommandDecoderClass decoder("ON", NULL);
+  CommandQueueClass queue;
+
+  sequencer.seed(1);
+  light.setRefreshRate(rate);
+  controller.begin(&light);
+
+  uint32_t start = records.front().time;
+  uint32_t end = records.back().time + TAIL;
+
+  simulateTime(start * 1000);
+  my92xx::reset();
+  my92xx::record(true);
+
+  // Commands waiting to be processed and to be shown (reception times)
+  std::vector<uint32_t> queued, processed;
+  std::vector<uint32_t> queueLatency, frameLatency;
+  uint32_t rejected = 0, dropped = 0, unchanged = 0, timeline = 0;
+  uint32_t sources[RECORD_SOURCES] = {0};
+  uint32_t interval = (rate > 0) ? 1000 / rate : 0;
+  size_t next = 0;
+
+  std::chrono::steady_clock::time_point began =
+      std::chrono::steady_clock::now();
+
+  uint32_t now;
+  for (now = start; now <= end; now++) {
+    uint32_t updates = my92xx::updates;
+    simulateTime(now * 1000);
+
+    // Commands received since the previous iteration
+    for (; next < records.size() && records[next].time <= now; next++) {
+      const record_t &received = records[next];
+      light_command_t command;
+
+      sources[received.source % RECORD_SOURCES]++;
+
+      if (decoder.decode(received.payload, received.length, command) !=
+              COMMAND_OK ||
+          !(command.fields & ~COMMAND_OTHER)) {
+        rejected++;
+        continue;
+      }
+
+      if (command.fields & COMMAND_PROGRAM) {
+        size_t length;
+        const uint8_t *program = decoder.getProgram(length);
+
+        if (!sequencer.post(program, length)) {
+          dropped++;
+          continue;
+        }
+      }
+
+      if (!queue.push(command, now * 1000)) {
+        if (command.fields & COMMAND_PROGRAM) {
+          sequencer.discard();
+        }
+        dropped++;
+        continue;
+      }
+
+      queued.push_back(received.time);
+    }
+
+    // The main loop
+    light_command_t command;
+    if (queue.pop(command, now * 1000, BUDGET)) {
+      controller.process(command, now);
+
+      for (size_t i = 0; i < queued.size(); i++) {
+        queueLatency.push_back(now - queued[i]);
+        processed.push_back(queued[i]);
+      }
+      queued.clear();
+    }
+
+    controller.update(now);
+    light.output(now * 1000);
+
+    // Frames are sent by the output, or right away without a refresh rate
+    if (my92xx::updates != updates) {
+      for (size_t i = 0; i < processed.size(); i++) {
+        frameLatency.push_back(now - processed[i]);
+      }
+      processed.clear();
+    } else if (!processed.empty() && queued.empty() && !queue.getDepth() &&
+               now - records[next - 1].time > interval + 1) {
+      // Processed without changing the output
+      unchanged += processed.size();
+      processed.clear();
+    }
+
+    // Nothing left to render
+    if (next == records.size() && queued.empty() && processed.empty() &&
+        !sequencer.isRunning() && !transition.isRunning()) {
+      break;
+    }
+  }
+
+  double elapsed = std::chrono::duration<double, std::nano>(
+                       std::chrono::steady_clock::now() - began)
+                       .count();
+
+  // Timeline of the frames sent (channel levels after each update)
+  std::vector<uint32_t> levels(MY92XX_CHANNELS_MAX, 0);
+  uint8_t channels = 0;
+  for (size_t i = 0; i < my92xx::events.size(); i++) {
+    channels = std::max<uint8_t>(channels, my92xx::events[i].channel + 1);
+  }
+
+  printf("time_ms,state");
+  for (uint8_t i = 0; i < channels; i++) {
+    printf(",ch%u", i);
+  }
+  printf("\n");
+
+  for (size_t i = 0; i < my92xx::events.size(); i++) {
+    const my92xx_event_t &event = my92xx::events[i];
+
+    if (event.call == MY92XX_CALL_CHANNEL) {
+      levels[event.channel] = event.value;
+      continue;
+    }
+
+    printf("%.3f,%u", (event.time - start * 1000) / 1000.0, event.value);
+    for (uint8_t j = 0; j < channels; j++) {
+      printf(",%u", levels[j]);
+    }
+    printf("\n");
+    timeline++;
+  }
+
+  printf("# commands: %zu (mqtt %u, websocket %u, api %u, group %u), "
+         "rejected: %u, dropped: %u, lost before recording: %u\n",
+         records.size(), sources[RECORD_SOURCE_MQTT],
+         sources[RECORD_SOURCE_WEBSOCKET], sources[RECORD_SOURCE_API],
+         sources[RECORD_SOURCE_GROUP], rejected, dropped,
+         RecorderClass::getLost(log.data(), log.size()));
+  printf("# frames: %u, commands without a frame: %u\n", timeline,
+         unchanged);
+
+  static const char *const latencies[] = {"processed", "shown"};
+  std::vector<uint32_t> *samples[] = {&queueLatency, &frameLatency};
+  for (uint8_t i = 0; i < 2; i++) {
+    std::vector<uint32_t> &sample = *samples[i];
+    if (sample.empty()) {
+      continue;
+    }
+
+    std::sort(sample.begin(), sample.end());
+    double sum = 0;
+    for (size_t j = 0; j < sample.size(); j++) {
+      sum += sample[j];
+    }
+
+    printf("# latency until %s: mean %.1f ms, p50 %u ms, p95 %u ms, max %u "
+           "ms\n",
+           latencies[i], sum / sample.size(), sample[sample.size() / 2],
+           sample[sample.size() * 95 / 100], sample.back());
+  }
+
+  printf("# replay: %.1f ns per simulated millisecond\n",
+         elapsed / (now - start + 1));
+
+  return 0;
+}
+
+// Floating point references of the colour conversions (as commonly done, e.g.
+// by Home Assistant), including the extraction of the white level
+
+uint8_t referenceLevel(double value) {
+  return value <= 0 ? 0 : value >= 255 ? 255 : (uint8_t)std::lround(value);
+}
+
+Color referenceRGBW(double red, double green, double blue) {
+  return ColorSpaceClass::rgb2RGBW(referenceLevel(red * 255),
+                                   referenceLevel(green * 255),
+                                   referenceLevel(blue * 255));
+}
+
+Color referenceHS(double hue, double saturation) {
+  double h = std::fmod(hue, 360) / 60;
+  double s = saturation / 100;
+  double f = h - std::floor(h);
+  double p = 1 - s;
+  double q = 1 - s * f;
+  double t = 1 - s * (1 - f);
+
+  switch ((int)h) {
+  case 0:
+    return referenceRGBW(1, t, p);
+  case 1:
+    return referenceRGBW(q, 1, p);
+  case 2:
+    return referenceRGBW(p, 1, t);
+  case 3:
+    return referenceRGBW(p, q, 1);
+  case 4:
+    return referenceRGBW(t, p, 1);
+  default:
+    return referenceRGBW(1, p, q);
+  }
+}
+
+Color referenceXY(double x, double y) {
+  double gamut[3][2];
+  for (uint8_t i = 0; i < 3; i++) {
+    gamut[i][0] = csPrimaryX(i);
+    gamut[i][1] = csPrimaryY(i);
+  }
+
+  // Clamp to the closest point on the edges of the gamut, if outside
+  bool inside = true;
+  for (uint8_t i = 0; i < 3; i++) {
+    const double *a = gamut[i];
+    const double *b = gamut[(i + 1) % 3];
+    if ((b[0] - a[0]) * (y - a[1]) - (b[1] - a[1]) * (x - a[0]) < 0) {
+      inside = false;
+    }
+  }
+
+  if (!inside) {
+    double closest = INFINITY;
+    double cx = x;
+    double cy = y;
+    for (uint8_t i = 0; i < 3; i++) {
+      const double *a = gamut[i];
+      const double *b = gamut[(i + 1) % 3];
+      double dx = b[0] - a[0];
+      double dy = b[1] - a[1];
+      double t = ((x - a[0]) * dx + (y - a[1]) * dy) / (dx * dx + dy * dy);
+      t = std::min(1.0, std::max(0.0, t));
+
+      double px = a[0] + t * dx;
+      double py = a[1] + t * dy;
+      double distance = (x - px) * (x - px) + (y - py) * (y - py);
+      if (distance < closest) {
+        closest = distance;
+        cx = px;
+        cy = py;
+      }
+    }
+    x = cx;
+    y = cy;
+  }
+
+  double xyz[3] = {x / y, 1, (1 - x - y) / y};
+  double levels[3];
+  double highest = 0;
+  for (uint8_t r = 0; r < 3; r++) {
+    levels[r] = 0;
+    for (uint8_t c = 0; c < 3; c++) {
+      levels[r] += csInverse(r, c) * xyz[c];
+    }
+    levels[r] = std::max(0.0, levels[r] / csWhite(r));
+    highest = std::max(highest, levels[r]);
+  }
+
+  for (uint8_t i = 0; i < 3; i++) {
+    double level = levels[i] / highest;
+    levels[i] = level <= 0.0031308 ? 12.92 * level
+                                   : 1.055 * std::pow(level, 1 / 2.4) - 0.055;
+  }
+
+  return referenceRGBW(levels[0], levels[1], levels[2]);
+}
+
+Color referenceMired(uint16_t mired) {
+  mired = std::max(mired, (uint16_t)COLOR_TEMPERATURE_MIN);
+  mired = std::min(mired, (uint16_t)COLOR_TEMPERATURE_MAX);
+
+  double t = 10000.0 / mired;
+  double red = t <= 66 ? 255 : 329.698727446 * std::pow(t - 60, -0.1332047592);
+  double green = t <= 66
+                     ? 99.4708025861 * std::log(t) - 161.1195681661
+                     : 288.1221695283 * std::pow(t - 60, -0.0755148492);
+  double blue = t >= 66   ? 255
+                : t <= 19 ? 0
+                          : 138.5177312231 * std::log(t - 10) - 305.0447927307;
+
+  return referenceRGBW(red / 255, green / 255, blue / 255);
+}
+
+/**
+ * @brief Compares a colour conversion with its floating point reference
+ *
+ * @param name the name of the conversion
+ * @param samples the number of samples
+ * @param convert the conversion, called with the sample number
+ * @param reference the reference, called with the sample number
+ *
+ * @return void
+ */
+template <typename Convert, typename Reference>
+void compareColors(const char *name, uint32_t samples, Convert convert,
+                   Reference reference) {
+  uint32_t exact = 0;
+  uint32_t worst = 0;
+  double sum = 0;
+
+  for (uint32_t i = 0; i < samples; i++) {
+    Color a = convert(i);
+    Color b = reference(i);
+    const uint8_t *la = &a.red;
+    const uint8_t *lb = &b.red;
+
+    uint32_t error = 0;
+    for (uint8_t j = 0; j < 4; j++) {
+      uint32_t difference = abs(la[j] - lb[j]);
+      error = std::max(error, difference);
+      sum += difference;
+    }
+
+    worst = std::max(worst, error);
+    if (error == 0) {
+      exact++;
+    }
+  }
+
+  printf("%-28s %12u %12.1f %12.3f %12u\n", name, samples,
+         100.0 * exact / samples, sum / (samples * 4.0), worst);
+}
+
+/**
+ * @brief Compares the colour conversions with floating point references
+ *
+ * Reports the share of conversions giving exactly the same RGBW levels, and
+ * the mean and largest difference of the levels.
+ *
+ * @return void
+ */
+void compareColorSpaces() {
+  printf("%-28s %12s %12s %12s %12s\n", "conversion", "samples", "exact %",
+         "mean error", "max error");
+
+  // Hue in tenths of degrees, saturation in percents
+  compareColors(
+      "hs2RGBW", 3600 * 101,
+      [](uint32_t i) {
+        return ColorSpaceClass::hs2RGBW(i % 3600 * 100, i / 3600 * 1000);
+      },
+      [](uint32_t i) { return referenceHS(i % 3600 / 10.0, i / 3600); });
+
+  // All chromaticities (in thousandths) with x + y <= 1 and y > 0
+  std::vector<std::pair<uint16_t, uint16_t>> chromaticities;
+  for (uint16_t x = 0; x <= 1000; x++) {
+    for (uint16_t y = 1; x + y <= 1000; y++) {
+      chromaticities.push_back(std::make_pair(x, y));
+    }
+  }
+  compareColors(
+      "xy2RGBW", chromaticities.size(),
+      [&](uint32_t i) {
+        return ColorSpaceClass::xy2RGBW(chromaticities[i].first,
+                                        chromaticities[i].second);
+      },
+      [&](uint32_t i) {
+        return referenceXY(chromaticities[i].first / 1000.0,
+                           chromaticities[i].second / 1000.0);
+      });
+
+  compareColors(
+      "colorTemperature2RGB",
+      COLOR_TEMPERATURE_MAX - COLOR_TEMPERATURE_MIN + 1,
+      [](uint32_t i) {
+        return AiLightClass::colorTemperature2RGB(COLOR_TEMPERATURE_MIN + i);
+      },
+      [](uint32_t i) { return referenceMired(COLOR_TEMPERATURE_MIN + i); });
+}
+
+// Microseconds elapsed since a moment
+uint32_t elapsedMicros(std::chrono::steady_clock::time_point since) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - since)
+      .count();
+}
+
+/**
+ * @brief Streams DDP frames over UDP to a light and measures the latency
+ *
+ * Acts as a sender of realtime colour streams (like LedFx or xLights on
+ * Linux), streaming to a light of three in the stream over the loopback
+ * interface, with the given share of the frames lost or reordered. The light
+ * receives the packets like the main loop of the firmware does (reading only
+ * the part of a packet up to its channels, and displaying only the latest frame
+ * of an iteration), and returns to its previous state once the stream has
+ * timed out. The time each frame has been sent is carried in the timecode of
+ * the packet, giving the latency of the frames displayed, and the jitter of
+ * the intervals between successive frames displayed.
+ *
+ * @param rate the frame rate of the stream (frames per second)
+ * @param loss the share of the frames lost (in percents)
+ * @param reorder the share of the frames arriving out of order (in percents)
+ *
+ * @return 0 if all checks passed, otherwise 1
+ */
+int streamRealtime(uint16_t rate, uint8_t loss, uint8_t reorder) {
+  static const uint32_t DURATION = 5000; // Stream length (in milliseconds)
+  static const uint32_t TIMEOUT = 500;   // Realtime timeout (in milliseconds)
+  static const uint8_t LIGHTS = 3;       // Lights in the stream
+  static const uint8_t LIGHT = 1;        // Stream slot of the simulated light
+  static const uint8_t BUDGET = 8;       // Packets read per iteration
+  static const size_t PACKET_SIZE =
+      DDP_HEADER_SIZE + DDP_TIMECODE_SIZE + LIGHTS * REALTIME_CHANNELS_RGB;
+  static const char on[] = "{\"state\":\"ON\",\"brightness\":120,\"color\":"
+                           "{\"r\":10,\"g\":20,\"b\":30}}";
+
+  // The light listens on an ephemeral port of the loopback interface
+  sockaddr_in address;
+  socklen_t size = sizeof(address);
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  int receiver = socket(AF_INET, SOCK_DGRAM, 0);
+  int sender = socket(AF_INET, SOCK_DGRAM, 0);
+  if (receiver < 0 || sender < 0 ||
+      bind(receiver, (sockaddr *)&address, size) != 0 ||
+      getsockname(receiver, (sockaddr *)&address, &size) != 0 ||
+      connect(sender, (sockaddr *)&address, size) != 0) {
+    fprintf(stderr, "Unable to open the UDP sockets\n");
+    return 1;
+  }
+
+  AiLightClass light(MY92XX_MODEL, MY92XX_CHIPS);
+  SequencerClass sequencer;
+  TransitionClass transition;
+  RealtimeClass realtime;
+  LightControllerClass controller(sequencer, transition, realtime,
+                                  EASING_LINEAR);
+  CommandDecoderClass decoder("ON", NULL);
+  light_command_t command;
+
+  realtime.begin(LIGHT * REALTIME_CHANNELS_RGB, REALTIME_CHANNELS_RGB,
+                 TIMEOUT);
+  controller.begin(&light);
+  decoder.decode(on, sizeof(on) - 1, command);
+  controller.process(command, 0);
+
+  Color color = light.getColor();
+  uint8_t brightness = light.getBrightness();
+
+  // Packets to be ignored: a query, another protocol version and a truncated
+  // header
+  static const uint8_t invalid[][DDP_HEADER_SIZE] = {
+      {DDP_FLAGS_VERSION_1 | DDP_FLAGS_QUERY, 1, 0, DDP_ID_DISPLAY},
+      {0x80 | DDP_FLAGS_PUSH, 1, 0, DDP_ID_DISPLAY},
+      {DDP_FLAGS_VERSION_1 | DDP_FLAGS_PUSH, 1, 0, DDP_ID_DISPLAY}};
+  send(sender, invalid[0], DDP_HEADER_SIZE, 0);
+  send(sender, invalid[1], DDP_HEADER_SIZE, 0);
+  send(sender, invalid[2], DDP_HEADER_SIZE / 2, 0);
+
+  std::mt19937 random(1);
+  uint32_t frames = DURATION * rate / 1000;
+  uint32_t interval = 1000000 / rate;
+  uint32_t next = 0, lost = 0, reordered = 0;
+  uint8_t held[PACKET_SIZE];
+  bool holding = false;
+
+  std::vector<uint32_t> latency;
+  std::vector<uint32_t> jitter;
+  uint32_t displayed = 0;   // Time the last frame has been displayed
+  int32_t number = -1;      // Number of the last frame displayed
+  uint32_t fallback = 0;    // Time the light has returned to its state
+  bool ordered = true;
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+
+  while (fallback == 0) {
+    uint32_t now = elapsedMicros(start);
+
+    // Sender: frame n carries its number in the channels of the light
+    if (next < frames && now >= next * interval) {
+      uint8_t packet[PACKET_SIZE] = {
+          DDP_FLAGS_VERSION_1 | DDP_FLAGS_TIMECODE | DDP_FLAGS_PUSH,
+          (uint8_t)(next % 15 + 1), 0x0B, DDP_ID_DISPLAY, 0, 0, 0, 0, 0,
+          LIGHTS * REALTIME_CHANNELS_RGB, (uint8_t)(now >> 24),
+          (uint8_t)(now >> 16), (uint8_t)(now >> 8), (uint8_t)now};
+      uint8_t *data = packet + DDP_HEADER_SIZE + DDP_TIMECODE_SIZE;
+      for (uint8_t i = 0; i < LIGHTS; i++) {
+        data[i * 3] = next & 0xFF;
+        data[i * 3 + 1] = next >> 8;
+        data[i * 3 + 2] = 40 * i;
+      }
+
+      // The first frame always arrives (it starts the sequence)
+      if (next > 0 && random() % 100 < loss) {
+        lost++;
+      } else if (next > 0 && !holding && random() % 100 < reorder) {
+        memcpy(held, packet, sizeof(packet));
+        holding = true;
+      } else {
+        send(sender, packet, sizeof(packet), 0);
+        if (holding) {
+          send(sender, held, sizeof(held), 0);
+          holding = false;
+          reordered++;
+        }
+      }
+
+      if (++next == frames && holding) {
+        send(sender, held, sizeof(held), 0);
+        holding = false;
+        reordered++;
+      }
+    }
+
+    // Light: only the part of a packet up to its channels is read
+    uint8_t packet[DDP_HEADER_SIZE + DDP_TIMECODE_SIZE +
+                   (LIGHT + 1) * REALTIME_CHANNELS_RGB];
+    Frame frame;
+    uint32_t sent = 0;
+    bool display = false;
+    bool active = realtime.isActive();
+
+    for (uint8_t i = 0; i < BUDGET; i++) {
+      ssize_t length = recv(receiver, packet, sizeof(packet), MSG_DONTWAIT);
+      if (length < 0) {
+        break;
+      }
+
+      if (realtime.receive(packet, length, elapsedMicros(start) / 1000,
+                           frame)) {
+        sent = ((uint32_t)packet[10] << 24) | ((uint32_t)packet[11] << 16) |
+               ((uint32_t)packet[12] << 8) | packet[13];
+        display = true;
+      }
+    }
+
+    if (display) {
+      if (!active) {
+        controller.suspend();
+      }
+      light.apply(frame, true);
+
+      now = elapsedMicros(start);
+      latency.push_back(now - sent);
+      // Jitter between successive frames (not spanning lost frames)
+      int32_t displayedNumber = frame.color.red | (frame.color.green << 8);
+      if (number >= 0 && displayedNumber == number + 1) {
+        jitter.push_back(abs((int32_t)(now - displayed - interval)));
+      }
+      displayed = now;
+
+      if (displayedNumber <= number || frame.color.blue != 40 * LIGHT) {
+        ordered = false;
+      }
+      number = displayedNumber;
+    }
+
+    if (realtime.expired(elapsedMicros(start) / 1000)) {
+      controller.resume();
+      fallback = elapsedMicros(start);
+    }
+
+    // Wait for a packet, or the next frame to be sent
+    pollfd descriptor = {receiver, POLLIN, 0};
+    poll(&descriptor, 1, 1);
+  }
+
+  close(sender);
+  close(receiver);
+
+  std::sort(latency.begin(), latency.end());
+  std::sort(jitter.begin(), jitter.end());
+  if (latency.empty() || jitter.empty()) {
+    fprintf(stderr, "No frames have been displayed\n");
+    return 1;
+  }
+
+  printf("%-28s %12s %12s %12s %12s\n", "frames", "sent", "lost",
+         "reordered", "displayed");
+  printf("%-28s %12u %12u %12u %12u\n", "", frames, lost, reordered,
+         realtime.getFrames());
+  printf("%-28s %12s %12s %12s %12s\n", "stream", "dropped", "late",
+         "invalid", "sessions");
+  printf("%-28s %12u %12u %12u %12u\n", "", realtime.getDropped(),
+         realtime.getLate(), realtime.getInvalid(), realtime.getSessions());
+  printf("%-28s %12s %12s %12s %12s\n", "microseconds", "p50", "p99", "max",
+         "samples");
+  printf("%-28s %12u %12u %12u %12u\n", "latency", latency[latency.size() / 2],
+         latency[latency.size() * 99 / 100], latency.back(),
+         (uint32_t)latency.size());
+  printf("%-28s %12u %12u %12u %12u\n", "jitter (display interval)",
+         jitter[jitter.size() / 2], jitter[jitter.size() * 99 / 100],
+         jitter.back(), (uint32_t)jitter.size());
+  printf("\n");
+
+  Color restored = light.getColor();
+  check("frames displayed: all but the lost and late frames",
+        realtime.getFrames() == frames - lost - reordered);
+  check("frames displayed: in order, from the slot of the light", ordered);
+  check("sequence: gaps counted as dropped",
+        realtime.getDropped() == lost + reordered);
+  check("sequence: reordered frames discarded as late",
+        realtime.getLate() == reordered);
+  check("invalid packets ignored", realtime.getInvalid() == 3);
+  // (the realtime timeout has a resolution of a millisecond)
+  check("timeout: stream ended after the timeout",
+        fallback - displayed >= (TIMEOUT - 1) * 1000 &&
+            fallback - displayed < (TIMEOUT + 50) * 1000 &&
+            realtime.getSessions() == 1 && !realtime.isActive());
+  check("timeout: light returned to its previous state",
+        light.getState() && light.getBrightness() == brightness &&
+            restored.red == color.red && restored.green == color.green &&
+            restored.blue == color.blue && restored.white == color.white);
+
+  return failures ? 1 : 0;
+}
+
+// Flash sectors emulated for the StateStore checks
+static const uint16_t STATE_SECTOR = 256;
+static const uint8_t STATE_SECTORS = 2;
+static const uint16_t STATE_RECORDS =
+    FLASH_STORAGE_SECTOR_SIZE / sizeof(state_record_t);
+
+// Flash address of a state record slot
+uint32_t stateAddress(uint16_t slot) {
+  return (uint32_t)STATE_SECTOR * FLASH_STORAGE_SECTOR_SIZE +
+         slot * sizeof(state_record_t);
+}
+
+// A state of the light for the StateStore checks (different for each number)
+light_state_t testState(uint32_t i) {
+  return {(i & 1) != 0,       (i & 2) != 0,       (uint8_t)(i >> 2),
+          (uint16_t)(153 + i % 348), (uint8_t)i, (uint8_t)(i >> 8),
+          (uint8_t)(i >> 16), (uint8_t)(i * 7)};
+}
+
+bool equals(const light_state_t &a, const light_state_t &b) {
+  return a.is_on == b.is_on && a.gamma == b.gamma &&
+         a.brightness == b.brightness && a.color_temp == b.color_temp &&
+         a.red == b.red && a.green == b.green && a.blue == b.blue &&
+         a.white == b.white;
+}
+
+// Whether a StateStore started on the flash memory recovers a state
+bool recovers(RAMFlashStorage &flash, const light_state_t &expected) {
+  StateStoreClass store;
+  light_state_t state;
+
+  store.begin(&flash, STATE_SECTOR, STATE_SECTORS, 0);
+
+  return store.load(state) && equals(state, expected);
+}
+
+// CRC-16/CCITT-FALSE, to forge state records
+uint16_t referenceCRC16(const uint8_t *data, size_t length) {
+  uint16_t crc = 0xFFFF;
+
+  while (length--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (uint8_t i = 0; i < 8; i++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+
+  return crc;
+}
+
+/**
+ * @brief Checks the StateStore on emulated flash memory
+ *
+ * Covers the scheduling of writes, failing writes, the rotation of the records
+ * over the sectors, torn and corrupted records and the wrap of the sequence
+ * numbers, recovering the state after each like at boot.
+ *
+ * @return 0 if all checks passed, otherwise 1
+ */
+int checkStateStore() {
+  static const uint32_t DELAY = 5000;
+  static const uint16_t SLOTS = STATE_SECTORS * STATE_RECORDS;
+  static const uint32_t WRITES = 8 * SLOTS + 100;
+
+  RAMFlashStorage flash(STATE_SECTOR, STATE_SECTORS);
+  StateStoreClass store;
+  light_state_t state;
+
+  store.begin(&flash, STATE_SECTOR, STATE_SECTORS, DELAY);
+  check("empty flash: no state recovered", !store.load(state));
+
+  // A change every second keeps the state changing, but it is written once
+  // the delay has passed since the first change
+  uint32_t written = 0;
+  for (uint32_t now = 0; now <= DELAY && written == 0; now += 1000) {
+    store.save(testState(now), now);
+    if (store.loop(now)) {
+      written = now;
+    }
+  }
+  check("steady changes: written after the delay", written == DELAY);
+  check("steady changes: latest state recovered",
+        recovers(flash, testState(DELAY)));
+
+  store.save(testState(DELAY), DELAY + 1000);
+  check("unchanged state: not written",
+        !store.loop(3 * DELAY) && store.getCommitCount() == 1);
+
+  // A failed write keeps the state scheduled, and is retried after the delay
+  store.save(testState(1), 0);
+  flash.failWrites(1);
+  bool failed = !store.loop(DELAY);
+  bool waits = !store.loop(2 * DELAY - 1);
+  bool retried = store.loop(2 * DELAY);
+  check("failed write: retried after another delay",
+        failed && waits && retried);
+  check("failed write: state recovered", recovers(flash, testState(1)));
+
+  store.save(testState(2), 0);
+  flash.failWrites(1);
+  failed = !store.flush();
+  check("failed flush: state kept for the next flush",
+        failed && store.flush() && recovers(flash, testState(2)));
+
+  // Records rotate over all sectors, erasing each equally often
+  store.clear();
+  uint32_t erased[STATE_SECTORS];
+  for (uint8_t i = 0; i < STATE_SECTORS; i++) {
+    erased[i] = flash.getEraseCount(STATE_SECTOR + i);
+  }
+
+  bool recovered = true;
+  for (uint32_t i = 0; i < WRITES; i++) {
+    store.save(testState(i + 10), 0);
+    store.flush();
+    if (!recovers(flash, testState(i + 10))) {
+      recovered = false;
+    }
+  }
+  uint32_t least = UINT32_MAX;
+  uint32_t most = 0;
+  for (uint8_t i = 0; i < STATE_SECTORS; i++) {
+    uint32_t erases = flash.getEraseCount(STATE_SECTOR + i) - erased[i];
+    least = std::min(least, erases);
+    most = std::max(most, erases);
+  }
+  check("rotation: newest state recovered after each write", recovered);
+  check("rotation: sectors erased equally", most - least <= 1);
+  check("rotation: one erase per sector of records written",
+        most <= WRITES / STATE_RECORDS / STATE_SECTORS + 1);
+
+  // A torn record (interrupted write) is skipped, and its slot isn't reused
+  StateStoreClass restarted;
+  restarted.begin(&flash, STATE_SECTOR, STATE_SECTORS, 0);
+
+  state_record_t record;
+  uint16_t slot = WRITES % SLOTS;
+  flash.read(stateAddress(slot - 1), &record, sizeof(record));
+  record.sequence++;
+  flash.write(stateAddress(slot), &record, sizeof(record) / 2);
+  check("torn record: previous state recovered",
+        recovers(flash, testState(WRITES + 9)));
+
+  restarted.save(testState(1000), 0);
+  check("torn record: next state written and recovered",
+        restarted.flush() && recovers(flash, testState(1000)));
+
+  // A corrupted record is skipped, recovering the previous one
+  restarted.save(testState(1001), 0);
+  restarted.flush();
+  // (the torn slot has been skipped, so both went to the next sector)
+  slot = (slot / STATE_RECORDS + 1) * STATE_RECORDS % SLOTS + 1;
+  flash.getData(stateAddress(slot) + offsetof(state_record_t, color))[0] ^= 1;
+  check("corrupted record: previous state recovered",
+        recovers(flash, testState(1000)));
+
+  // The sequence numbers wrap around
+  store.clear();
+  record = {0xFFFFFFFDUL, 0x01, 255, 153, {1, 2, 3, 4}, STATE_RECORD_MAGIC, 0};
+  record.crc =
+      referenceCRC16((const uint8_t *)&record, offsetof(state_record_t, crc));
+  flash.write(stateAddress(0), &record, sizeof(record));
+  check("sequence wrap: forged record recovered",
+        recovers(flash, {true, false, 255, 153, 1, 2, 3, 4}));
+
+  restarted.begin(&flash, STATE_SECTOR, STATE_SECTORS, 0);
+  for (uint32_t i = 0; i < 4; i++) {
+    restarted.save(testState(2000 + i), 0);
+    restarted.flush();
+  }
+  check("sequence wrap: newest state recovered",
+        recovers(flash, testState(2003)));
+
+  // Wrapped records in the first sector, older ones in the second sector
+  store.clear();
+  restarted.begin(&flash, STATE_SECTOR, STATE_SECTORS, 0);
+  for (uint16_t i = 0; i < STATE_RECORDS; i++) {
+    record.sequence = 0xFFFFFFFFUL - STATE_RECORDS + i;
+    record.brightness = i;
+    record.crc = referenceCRC16((const uint8_t *)&record,
+                                offsetof(state_record_t, crc));
+    flash.write(stateAddress(STATE_RECORDS + i), &record, sizeof(record));
+  }
+  restarted.begin(&flash, STATE_SECTOR, STATE_SECTORS, 0);
+  for (uint32_t i = 0; i < 10; i++) {
+    restarted.save(testState(3000 + i), 0);
+    restarted.flush();
+  }
+  check("sequence wrap: newest state recovered across sectors",
+        recovers(flash, testState(3009)));
+
+  return failures ? 1 : 0;
+}
+
+// Result of decoding a payload from a buffer of exactly its length (without a
+// NUL terminator, so reading past the end is caught by the address sanitizer)
+command_result_t decodeExactly(CommandDecoderClass &decoder,
+                               const std::string &payload,
+                               light_command_t &command) {
+  std::vector<char> buffer(payload.begin(), payload.end());
+
+  return decoder.decode(buffer.data(), buffer.size(), command);
+}
+
+command_result_t splitExactly(CommandDecoderClass &decoder,
+                              const std::string &payload, uint8_t &count) {
+  std::vector<char> buffer(payload.begin(), payload.end());
+  const char *commands[4];
+  size_t lengths[4];
+
+  return decoder.split(buffer.data(), buffer.size(), commands, lengths, 4,
+                       count);
+}
+
+/**
+ * @brief Checks the command decoder with malformed input
+ *
+ * Feeds truncated, over-nested, unterminated and out of range payloads to
+ * decode() and split() and checks the results, then decodes randomly mutated
+ * commands (best run with -fsanitize=address added to the build flags, so any
+ * read outside of a payload is reported).
+ *
+ * @return 0 if all checks passed, otherwise 1
+ */
+int checkMalformed() {
+  static const std::string COMMAND =
+      "{\"state\":\"ON\",\"brightness\":\"180\",\"color\":{\"r\":255,"
+      "\"g\":120,\"b\":10,\"w\":4},\"color_temp\":300,\"transition\":1.5,"
+      "\"gamma\":true,\"effect\":\"candle\",\"other\":[{\"a\":null}]}";
+  static const std::string BATCH =
+      "[{\"state\":\"ON\"},{\"brightness\":10},{\"other\":\"]\"}]";
+
+  static const char SYMBOLS[] = "{}[]\",:\\ 0-.e";
+
+  CommandDecoderClass decoder("ON", NULL);
+  light_command_t command;
+  uint8_t count;
+  char name[64];
+
+  // Well-formed input is decoded
+  check("valid command: decoded",
+        decodeExactly(decoder, COMMAND, command) == COMMAND_OK &&
+            command.state && command.brightness == 180 &&
+            command.color.red == 255 && command.color.white == 4 &&
+            command.color_temp == 300 && command.transition == 1500 &&
+            command.gamma && command.effect == EFFECT_CANDLE &&
+            (command.fields & COMMAND_OTHER));
+  check("valid batch: split",
+        splitExactly(decoder, BATCH, count) == COMMAND_OK && count == 3);
+
+  // Truncated input (every proper prefix)
+  bool rejected = true;
+  for (size_t i = 0; i < COMMAND.size(); i++) {
+    if (decodeExactly(decoder, COMMAND.substr(0, i), command) !=
+        COMMAND_ERROR_SYNTAX) {
+      rejected = false;
+    }
+  }
+  check("truncated command: syntax error", rejected);
+
+  rejected = true;
+  for (size_t i = 0; i < BATCH.size(); i++) {
+    if (splitExactly(decoder, BATCH.substr(0, i), count) !=
+        COMMAND_ERROR_SYNTAX) {
+      rejected = false;
+    }
+  }
+  check("truncated batch: syntax error", rejected);
+
+  // Nesting up to the maximum depth is skipped, deeper nesting is rejected
+  // (without recursing any further), alone and in a batch alike
+  for (uint32_t depth : {COMMAND_MAX_DEPTH - 1, COMMAND_MAX_DEPTH, 100000}) {
+    std::string nested = "{\"other\":" + std::string(depth - 1, '[') + "1" +
+                         std::string(depth - 1, ']') + "}";
+    command_result_t expected =
+        depth < COMMAND_MAX_DEPTH ? COMMAND_OK : COMMAND_ERROR_SYNTAX;
+
+    snprintf(name, sizeof(name), "nested %u levels deep: %s", depth,
+             expected == COMMAND_OK ? "skipped" : "syntax error");
+    check(name, decodeExactly(decoder, nested, command) == expected);
+
+    snprintf(name, sizeof(name), "nested %u levels deep in a batch: %s", depth,
+             expected == COMMAND_OK ? "split" : "syntax error");
+    check(name, splitExactly(decoder, "[" + nested + "]", count) == expected);
+  }
+
+  // Malformed and out of range payloads
+  static const struct {
+    const char *payload;
+    command_result_t expected;
+  } cases[] = {
+      {"", COMMAND_ERROR_SYNTAX},
+      {"{\"state\":\"ON", COMMAND_ERROR_SYNTAX},
+      {"{\"state\":\"ON\\", COMMAND_ERROR_SYNTAX},
+      {"{\"effect\":\"candle}", COMMAND_ERROR_SYNTAX},
+      {"{\"other\":\"\\\"}", COMMAND_ERROR_SYNTAX},
+      {"{\"color\":{\"r\":1", COMMAND_ERROR_SYNTAX},
+      {"{\"state\":\"ON\"}}", COMMAND_ERROR_SYNTAX},
+      {"{\"state\":\"ON\",}", COMMAND_ERROR_SYNTAX},
+      {"{\"brightness\":1e2}", COMMAND_ERROR_SYNTAX},
+      {"{\"brightness\":true}", COMMAND_ERROR_SYNTAX},
+      {"{\"brightness\":\"12}", COMMAND_ERROR_SYNTAX},
+      {"{\"brightness\":256}", COMMAND_ERROR_RANGE},
+      {"{\"brightness\":-1}", COMMAND_ERROR_RANGE},
+      {"{\"brightness\":\"256\"}", COMMAND_ERROR_RANGE},
+      {"{\"brightness\":99999999999999999999}", COMMAND_ERROR_RANGE},
+      {"{\"color_temp\":1001}", COMMAND_ERROR_RANGE},
+      {"{\"transition\":3600.001}", COMMAND_ERROR_RANGE},
+      {"{\"flash\":3601}", COMMAND_ERROR_RANGE},
+      {"{\"color\":{\"r\":256}}", COMMAND_ERROR_RANGE},
+      {"{\"color\":{\"h\":361,\"s\":50}}", COMMAND_ERROR_RANGE},
+      {"{\"color\":{\"h\":10,\"s\":101}}", COMMAND_ERROR_RANGE},
+      {"{\"color\":{\"x\":1.001,\"y\":0.3}}", COMMAND_ERROR_RANGE},
+      {"{\"effect\":\"disco\"}", COMMAND_ERROR_RANGE},
+      {"{\"program\":\"123\"}", COMMAND_ERROR_RANGE},
+      {"{\"program\":\"zz\"}", COMMAND_ERROR_SYNTAX},
+      {"{\"program\":\"ffffffff\"}", COMMAND_ERROR_RANGE},
+      {"{\"brightness\":255,\"transition\":3600}", COMMAND_OK},
+      {" { \"state\" : \"OFF\" } ", COMMAND_OK},
+  };
+
+  for (const auto &c : cases) {
+    snprintf(name, sizeof(name), "decode %.40s", c.payload);
+    check(name, decodeExactly(decoder, c.payload, command) == c.expected);
+  }
+
+  static const struct {
+    const char *payload;
+    command_result_t expected;
+    uint8_t count;
+  } batches[] = {
+      {"", COMMAND_ERROR_SYNTAX, 0},
+      {"[]", COMMAND_OK, 0},
+      {" [ {} , {} ] ", COMMAND_OK, 2},
+      {"[{}", COMMAND_ERROR_SYNTAX, 1},
+      {"[{},]", COMMAND_ERROR_SYNTAX, 1},
+      {"[1]", COMMAND_ERROR_SYNTAX, 0},
+      {"[\"{}\"]", COMMAND_ERROR_SYNTAX, 0},
+      {"[{\"a\":\"}\"]", COMMAND_ERROR_SYNTAX, 0},
+      {"[{}] {}", COMMAND_ERROR_SYNTAX, 1},
+      {"[{},{},{},{}]", COMMAND_OK, 4},
+      {"[{},{},{},{},{}]", COMMAND_ERROR_RANGE, 4},
+  };
+
+  for (const auto &b : batches) {
+    snprintf(name, sizeof(name), "split %.40s", b.payload);
+    check(name, splitExactly(decoder, b.payload, count) == b.expected &&
+                    count == b.count);
+  }
+
+  // Randomly mutated commands and batches are rejected or decoded, but never
+  // read outside of the payload
+  std::mt19937 random(1);
+  uint32_t decoded = 0;
+  uint32_t split = 0;
+  for (uint32_t i = 0; i < 100000; i++) {
+    std::string payload = (i % 2) ? BATCH : COMMAND;
+    for (uint32_t j = 0, n = 1 + random() % 4; j < n; j++) {
+      size_t position = random() % payload.size();
+      switch (random() % 3) {
+      case 0:
+        payload[position] = SYMBOLS[random() % (sizeof(SYMBOLS) - 1)];
+        break;
+      case 1:
+        payload.erase(position, 1 + random() % 8);
+        break;
+      default:
+        payload.insert(position, 1, (char)random());
+        break;
+      }
+      if (payload.empty()) {
+        payload = "{";
+      }
+    }
+
+    if (decodeExactly(decoder, payload, command) == COMMAND_OK) {
+      decoded++;
+    }
+    if (splitExactly(decoder, payload, count) == COMMAND_OK) {
+      split++;
+    }
+  }
+  printf("%-60s %u/%u\n", "mutated payloads decoded/split", decoded, split);
+
+  return failures ? 1 : 0;
+}
+
+// Renders commands processed at once on a light that has been switched on
+// (one sample of the state, colour and brightness per millisecond)
+std::vector<uint64_t> renderCommands(const light_command_t *commands,
+                                     uint8_t count) {
+  static const uint32_t DURATION = 4000;
+  static const char on[] =
+      "{\"state\":\"ON\",\"brightness\":180,\"color\":{\"r\":20,\"g\":200,"
+      "\"b\":60},\"white_value\":40}";
+
+  AiLightClass light(MY92XX_MODEL, MY92XX_CHIPS);
+  SequencerClass sequencer;
+  TransitionClass transition;
+  RealtimeClass realtime;
+  LightControllerClass controller(sequencer, transition, realtime,
+                                  EASING_LINEAR);
+  CommandDecoderClass decoder("ON", NULL);
+  light_command_t switchOn;
+
+  sequencer.seed(1);
+  controller.begin(&light);
+  decoder.decode(on, sizeof(on) - 1, switchOn);
+  controller.process(switchOn, 0);
+
+  for (uint8_t i = 0; i < count; i++) {
+    controller.process(commands[i], 1);
+  }
+
+  std::vector<uint64_t> samples;
+  for (uint32_t now = 1; now <= DURATION; now++) {
+    controller.update(now);
+
+    Color color = light.getColor();
+    samples.push_back((uint64_t)light.getState() << 40 |
+                      (uint64_t)light.getBrightness() << 32 |
+                      (uint32_t)color.red << 24 | color.green << 16 |
+                      color.blue << 8 | color.white);
+  }
+
+  return samples;
+}
+
+/**
+ * @brief Checks the merging of queued commands
+ *
+ * Every pair of a set of commands is merged like the command queue does, and
+ * the merged command is rendered next to the pair processed in order. Merged
+ * commands are to render the same frames, and commands of which the result
+ * would differ (e.g. a transition that would also fade the colour of the
+ * preceding command) are not to be merged.
+ *
+ * @return 0 if all checks passed, otherwise 1
+ */
+int checkMerge() {
+  static const char *const COMMANDS[] = {
+      "{\"state\":\"ON\"}",
+      "{\"state\":\"OFF\"}",
+      "{\"state\":\"OFF\",\"transition\":1}",
+      "{\"brightness\":50}",
+      "{\"brightness\":220,\"transition\":2}",
+      "{\"color\":{\"r\":255,\"g\":0,\"b\":0}}",
+      "{\"color\":{\"r\":0,\"g\":0,\"b\":255},\"transition\":1.5}",
+      "{\"white_value\":200}",
+      "{\"color_temp\":300}",
+      "{\"color_temp\":450,\"transition\":1}",
+      "{\"gamma\":true}",
+      "{\"flash\":1}",
+      "{\"brightness\":90,\"flash\":2}",
+      "{\"effect\":\"breathe\"}",
+      "{\"state\":\"ON\",\"brightness\":120,\"color\":{\"r\":10,\"g\":20,"
+      "\"b\":30},\"white_value\":5,\"transition\":1}"};
+  static const uint8_t COUNT = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+
+  CommandDecoderClass decoder("ON", NULL);
+  light_command_t commands[COUNT];
+  for (uint8_t i = 0; i < COUNT; i++) {
+    if (decoder.decode(COMMANDS[i], strlen(COMMANDS[i]), commands[i]) !=
+        COMMAND_OK) {
+      fprintf(stderr, "Unable to decode %s\n", COMMANDS[i]);
+      return 1;
+    }
+  }
+
+  uint32_t merged = 0, refused = 0;
+  bool same = true;
+  for (uint8_t i = 0; i < COUNT; i++) {
+    for (uint8_t j = 0; j < COUNT; j++) {
+      light_command_t pair[2] = {commands[i], commands[j]};
+      light_command_t into = commands[i];
+
+      if (!CommandQueueClass::merge(into, commands[j])) {
+        refused++;
+        continue;
+      }
+      merged++;
+
+      if (renderCommands(&into, 1) != renderCommands(pair, 2)) {
+        fprintf(stderr, "Merged differently: %s %s\n", COMMANDS[i],
+                COMMANDS[j]);
+        same = false;
+      }
+    }
+  }
+  printf("%u of %u pairs merged\n\n", merged, merged + refused);
+
+  check("merged pairs: same frames as processed in order", same);
+
+  // A transition of the next command starts from the levels of the preceding
+  // command, and one of the preceding command is stopped where it started
+  light_command_t into = commands[5];
+  check("colour, then brightness transition: not merged",
+        !CommandQueueClass::merge(into, commands[4]));
+  into = commands[3];
+  check("brightness, then brightness transition: not merged",
+        !CommandQueueClass::merge(into, commands[4]));
+  into = commands[4];
+  check("brightness transition, then colour: not merged",
+        !CommandQueueClass::merge(into, commands[5]));
+  into = commands[4];
+  check("transition, then transition of all its levels: merged",
+        CommandQueueClass::merge(into, commands[14]) &&
+            into.brightness == 120 && into.transition == 1000);
+  into = commands[5];
+  check("colour, then brightness: merged",
+        CommandQueueClass::merge(into, commands[3]) &&
+            (into.fields & (COMMAND_COLOR | COMMAND_BRIGHTNESS)) ==
+                (COMMAND_COLOR | COMMAND_BRIGHTNESS));
+
+  return failures ? 1 : 0;
+}
+
+/**
+ * @brief Checks the publish queue of the MQTT messages
+ *
+ * Covers coalescing, the interval of each topic, the order of the topics,
+ * failed publishes, dropping and replaying messages on a reconnect and the
+ * publish options, with the topics configured like the firmware does.
+ *
+ * @return 0 if all checks passed, otherwise 1
+ */
+int checkPublishQueue() {
+  static const uint8_t AVAILABILITY = 0;
+  static const uint8_t STATE = 1;
+  static const uint8_t DISCOVERY = 2;
+  static const uint8_t METRICS = 3;
+  static const uint16_t INTERVAL = 250;
+
+  PublishQueueClass queue;
+  uint8_t topic;
+
+  queue.configure(AVAILABILITY, 1 | PUBLISH_RETAIN, 0, true);
+  queue.configure(STATE, 0, INTERVAL, true);
+  queue.configure(DISCOVERY, 1 | PUBLISH_RETAIN, 0, false);
+  queue.configure(METRICS, 0, 0, false);
+  check("empty queue: nothing to publish", !queue.next(0, topic));
+
+  // A topic queued several times is published once
+  for (uint8_t i = 0; i < 5; i++) {
+    queue.queue(STATE);
+  }
+  bool taken = queue.next(0, topic) && topic == STATE;
+  queue.published(STATE, 0);
+  check("coalescing: published once",
+        taken && !queue.next(0, topic) && queue.getQueued() == 5 &&
+            queue.getCoalesced() == 4 && queue.getPublished() == 1);
+
+  // At most once per interval, with the newest message published after it
+  queue.queue(STATE);
+  bool waits = !queue.next(INTERVAL - 1, topic);
+  taken = queue.next(INTERVAL, topic) && topic == STATE;
+  queue.published(STATE, INTERVAL);
+  check("interval: held until the interval has passed", waits && taken);
+
+  // Other topics are not held by the interval of the state
+  queue.queue(STATE);
+  queue.queue(METRICS);
+  taken = queue.next(INTERVAL + 1, topic) && topic == METRICS;
+  queue.published(METRICS, INTERVAL + 1);
+  check("interval: per topic", taken && !queue.next(INTERVAL + 1, topic));
+
+  // A failed publish (not marked as published) is taken again
+  queue.queue(DISCOVERY);
+  taken = queue.next(INTERVAL + 2, topic) && topic == DISCOVERY;
+  check("failed publish: taken again",
+        taken && queue.next(INTERVAL + 3, topic) && topic == DISCOVERY);
+  queue.published(DISCOVERY, INTERVAL + 3);
+
+  // Topics are taken in order (the availability preceding the state)
+  queue.queue(STATE);
+  queue.queue(AVAILABILITY);
+  taken = queue.next(2 * INTERVAL, topic) && topic == AVAILABILITY;
+  queue.published(AVAILABILITY, 2 * INTERVAL);
+  check("order: availability before the state",
+        taken && queue.next(2 * INTERVAL, topic) && topic == STATE);
+  queue.published(STATE, 2 * INTERVAL);
+
+  // Pending messages are dropped on a disconnect, but for the replayed
+  // topics, which are queued again on the reconnect
+  queue.queue(DISCOVERY);
+  queue.queue(METRICS);
+  queue.queue(STATE);
+  uint32_t dropped = queue.getDropped();
+  queue.disconnect();
+  check("disconnect: pending messages dropped but replayed ones",
+        queue.getDropped() == dropped + 2 && queue.getPending() == 1);
+
+  queue.connect();
+  uint8_t replayed = 0;
+  for (uint32_t now = 3 * INTERVAL; queue.next(now, topic); now++) {
+    replayed |= 1 << topic;
+    queue.published(topic, now);
+  }
+  check("connect: availability and state replayed",
+        replayed == ((1 << AVAILABILITY) | (1 << STATE)) &&
+            queue.getPending() == 0);
+
+  // Options at runtime, QoS levels above 2 clamped
+  queue.setOptions(STATE, 3 | PUBLISH_RETAIN | 0xF0);
+  check("options: QoS level clamped, unknown flags ignored",
+        queue.getQoS(STATE) == 2 && queue.getRetain(STATE) &&
+            queue.getOptions(STATE) == (2 | PUBLISH_RETAIN));
+  queue.setOptions(STATE, 1);
+  check("options: changed at runtime",
+        queue.getQoS(STATE) == 1 && !queue.getRetain(STATE));
+
+  // Topics not configured are ignored
+  queue.queue(PUBLISH_TOPICS_MAX - 1);
+  check("unconfigured topic: ignored",
+        !queue.next(4 * INTERVAL, topic) && queue.getPending() == 0);
+
+  return failures ? 1 : 0;
+}
+
+// Applies the attributes of a WebSocket state message onto a light state
+bool applyStateDelta(const char *message, size_t length, light_state_t &state,
+                     uint8_t &effect) {
+  CommandDecoderClass decoder("ON", NULL);
+  light_command_t command;
+  if (decoder.decode(message, length, command) != COMMAND_OK) {
+    return false;
+  }
+
+  if (command.fields & COMMAND_STATE) {
+    state.is_on = command.state;
+  }
+  if (command.fields & COMMAND_BRIGHTNESS) {
+    state.brightness = command.brightness;
+  }
+  if (command.fields & COMMAND_WHITE) {
+    state.white = command.color.white;
+  }
+  if (command.fields & COMMAND_COLOR_TEMP) {
+    state.color_temp = command.color_temp;
+  }
+  if (command.fields & COMMAND_COLOR) {
+    state.red = command.color.red;
+    state.green = command.color.green;
+    state.blue = command.color.blue;
+  }
+  if (command.fields & COMMAND_GAMMA) {
+    state.gamma = command.gamma;
+  }
+  if (command.fields & COMMAND_EFFECT) {
+    effect = command.effect;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Checks the pushes of the light state to the WebSocket clients
+ *
+ * The messages built for a client are applied onto the state it has last
+ * been sent, which is to result in the current state. Clients that can't
+ * keep up are to be sent the accumulated changes once they have caught up.
+ *
+ * @return 0 if all checks passed, otherwise 1
+ */
+int checkStatePush() {
+  static const uint16_t PAIRS = 2000;
+
+  state_payload_t payload = {};
+  ws_client_t client = {};
+  char buffer[STATE_PAYLOAD_SIZE];
+  size_t length;
+
+  payload.state = {true, false, 200, 300, 255, 128, 0, 40};
+  payload.effect = EFFECT_NONE;
+  client.id = 1;
+  client.state = payload.state;
+  client.effect = payload.effect;
+  check("up to date: nothing sent",
+        wsStateDelta(payload, client, buffer, sizeof(buffer)) == 0);
+
+  payload.state.brightness = 42;
+  length = wsStateDelta(payload, client, buffer, sizeof(buffer));
+  check("brightness changed: only the brightness sent",
+        length == strlen(buffer) &&
+            strcmp(buffer, "{\"brightness\":42}") == 0);
+
+  payload.state = client.state;
+  payload.state.green = 0;
+  wsStateDelta(payload, client, buffer, sizeof(buffer));
+  check("colour channel changed: the colour sent as a whole",
+        strcmp(buffer, "{\"color\":{\"r\":255,\"g\":0,\"b\":0}}") == 0);
+
+  payload.state = client.state;
+  payload.effect = EFFECT_FLASH;
+  wsStateDelta(payload, client, buffer, sizeof(buffer));
+  check("flash: sent as no effect",
+        strcmp(buffer, "{\"effect\":\"none\"}") == 0);
+  payload.effect = EFFECT_NONE;
+
+  // The messages applied onto the state last sent result in the current state
+  std::mt19937 random(1);
+  bool same = true;
+  for (uint16_t i = 0; i < PAIRS; i++) {
+    light_state_t *states[2] = {&client.state, &payload.state};
+    uint8_t *effects[2] = {&client.effect, &payload.effect};
+    for (uint8_t j = 0; j < 2; j++) {
+      // Each attribute changes with a chance of one in three
+      light_state_t &state = *states[j];
+      if (j == 0 || random() % 3 == 0) {
+        state.is_on = random() % 2;
+      }
+      if (j == 0 || random() % 3 == 0) {
+        state.gamma = random() % 2;
+      }
+      if (j == 0 || random() % 3 == 0) {
+        state.brightness = random() % 256;
+      }
+      if (j == 0 || random() % 3 == 0) {
+        state.color_temp = 153 + random() % 348;
+      }
+      if (j == 0 || random() % 3 == 0) {
+        state.red = random() % 256;
+      }
+      if (j == 0 || random() % 3 == 0) {
+        state.green = random() % 256;
+      }
+      if (j == 0 || random() % 3 == 0) {
+        state.blue = random() % 256;
+      }
+      if (j == 0 || random() % 3 == 0) {
+        state.white = random() % 256;
+      }
+      if (j == 0 || random() % 3 == 0) {
+        *effects[j] = random() % EFFECT_NAMED;
+      }
+    }
+
+    light_state_t state = client.state;
+    uint8_t effect = client.effect;
+    length = wsStateDelta(payload, client, buffer, sizeof(buffer));
+    if (length > 0 && !applyStateDelta(buffer, length, state, effect)) {
+      fprintf(stderr, "Unable to decode %s\n", buffer);
+      same = false;
+    }
+
+    if (memcmp(&state, &payload.state, sizeof(state)) != 0 ||
+        effect != payload.effect) {
+      fprintf(stderr, "Pushed differently: %s\n", length ? buffer : "");
+      same = false;
+    }
+  }
+  check("messages: result in the current state", same);
+
+  // Falls back to the whole state if the changes don't fit
+  strcpy(payload.json, "{\"state\":\"ON\"}");
+  payload.length = strlen(payload.json);
+  client.state = payload.state;
+  client.state.is_on = !payload.state.is_on;
+  client.state.brightness = payload.state.brightness + 1;
+  length = wsStateDelta(payload, client, buffer, 24);
+  check("too long: the whole state sent",
+        length == payload.length && strcmp(buffer, payload.json) == 0);
+
+  // Clients that are behind keep the state last sent, gone ones are removed
+  ws_client_t clients[4] = {};
+  for (uint8_t i = 0; i < 3; i++) {
+    clients[i].id = i + 1;
+    clients[i].state = payload.state;
+    clients[i].effect = payload.effect;
+  }
+  light_state_t before = payload.state;
+  payload.state.brightness = 7;
+  payload.state.white = 9;
+
+  uint8_t results[4] = {WS_PUSH_SENT, WS_PUSH_BEHIND, WS_PUSH_GONE, 0};
+  uint32_t sent = 0;
+  auto send = [&](uint32_t id, const char *, size_t) {
+    if (results[id - 1] == WS_PUSH_SENT) {
+      sent |= 1 << id;
+    }
+
+    return results[id - 1];
+  };
+  bool behind = wsPushState(payload, clients, 4, send);
+  check("push: behind client to be pushed again", behind && sent == 1 << 1);
+  check("push: sent client updated",
+        memcmp(&clients[0].state, &payload.state, sizeof(before)) == 0);
+  check("push: behind client keeps the state last sent",
+        memcmp(&clients[1].state, &before, sizeof(before)) == 0);
+  check("push: gone client removed", clients[2].id == 0);
+
+  // Once caught up, the behind client is sent the accumulated changes
+  payload.state.white = 11;
+  results[1] = WS_PUSH_SENT;
+  sent = 0;
+  light_state_t state = clients[1].state;
+  uint8_t effect = clients[1].effect;
+  wsStateDelta(payload, clients[1], buffer, sizeof(buffer));
+  bool applied = applyStateDelta(buffer, strlen(buffer), state, effect);
+  behind = wsPushState(payload, clients, 4, send);
+  check("push: caught up client sent the accumulated changes",
+        !behind && sent == ((1 << 1) | (1 << 2)) && applied &&
+            memcmp(&state, &payload.state, sizeof(state)) == 0 &&
+            memcmp(&clients[1].state, &payload.state, sizeof(state)) == 0);
+
+  return failures ? 1 : 0;
+}
+
+// Size of the EEPROM sector holding the configuration
+static const size_t CONFIG_SECTOR_SIZE = 4096;
+
+// A configuration for the ConfigStore checks, of which every field differs
+// from those of another fill (strings at their maximum length)
+void fillConfig(config_t &config, uint8_t fill) {
+  uint8_t *base = (uint8_t *)&config;
+
+  for (uint8_t i = 0; i < CONFIG_FIELDS_COUNT; i++) {
+    const config_field_t &field = CONFIG_FIELDS[i];
+    for (uint16_t j = 0; j < field.size; j++) {
+      base[field.offset + j] = (field.type == CONFIG_FIELD_STRING)
+                                   ? 'A' + (field.tag + fill + j) % 26
+                                   : field.tag * 31 + fill + j;
+    }
+    if (field.type == CONFIG_FIELD_STRING) {
+      base[field.offset + field.size - 1] = '\0';
+    }
+  }
+}
+
+// Whether a field holds the same value (or string) in two configurations
+bool sameField(const config_t &a, const config_t &b,
+               const config_field_t &field) {
+  const char *valueA = (const char *)&a + field.offset;
+  const char *valueB = (const char *)&b + field.offset;
+
+  return (field.type == CONFIG_FIELD_STRING)
+             ? strncmp(valueA, valueB, field.size) == 0
+             : memcmp(valueA, valueB, field.size) == 0;
+}
+
+// Whether all fields hold the same values in two configurations
+bool sameFields(const config_t &a, const config_t &b) {
+  for (uint8_t i = 0; i < CONFIG_FIELDS_COUNT; i++) {
+    if (!sameField(a, b, CONFIG_FIELDS[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Whether decoding a blob fails (with the given result) without touching the
+// configuration
+bool rejects(const uint8_t *blob, size_t size, uint8_t expected) {
+  config_t config;
+  config_t untouched;
+  memset(&config, 0x5A, sizeof(config));
+  memset(&untouched, 0x5A, sizeof(untouched));
+
+  uint8_t version = 0;
+  return ConfigStoreClass::decode(blob, size, CONFIG_FIELDS,
+                                  CONFIG_FIELDS_COUNT, &config,
+                                  version) == expected &&
+         memcmp(&config, &untouched, sizeof(config)) == 0 && version == 0;
+}
+
+/**
+ * @brief Checks the ConfigStore with the fields of the configuration
+ *
+ * Covers the round trip of every field, corrupted and truncated blobs, records
+ * of unknown or changed fields (as stored by another firmware), and the
+ * migration of configurations stored as raw config_legacy_t.
+ *
+ * @return 0 if all checks passed, otherwise 1
+ */
+int checkConfigStore() {
+  static uint8_t blob[CONFIG_SECTOR_SIZE];
+  config_t source;
+  config_t config;
+  uint8_t version;
+
+  // Every field survives a round trip
+  fillConfig(source, 0);
+  memset(blob, 0xFF, sizeof(blob));
+  size_t length =
+      ConfigStoreClass::encode(&source, CONFIG_FIELDS, CONFIG_FIELDS_COUNT,
+                               CONFIG_VERSION, blob, sizeof(blob));
+  size_t longest =
+      ConfigStoreClass::getMaxLength(CONFIG_FIELDS, CONFIG_FIELDS_COUNT);
+  for (uint8_t i = 0; i < CONFIG_FIELDS_COUNT; i++) {
+    if (CONFIG_FIELDS[i].type == CONFIG_FIELD_STRING) {
+      longest--; // Stored without the NUL
+    }
+  }
+  check("encode: longest configuration fits in the EEPROM sector",
+        length > 0 && length == longest);
+
+  uint8_t tags[256] = {0};
+  size_t records = 0;
+  for (size_t i = CONFIG_STORE_HEADER_SIZE; i < length;
+       i += CONFIG_STORE_RECORD_SIZE + blob[i + 1]) {
+    tags[blob[i]]++;
+    records++;
+  }
+  bool unique = records == CONFIG_FIELDS_COUNT;
+  for (uint8_t i = 0; i < CONFIG_FIELDS_COUNT; i++) {
+    unique = unique && tags[CONFIG_FIELDS[i].tag] == 1;
+  }
+  check("encode: a record for each tag", unique);
+
+  fillConfig(config, 1);
+  version = 0;
+  uint8_t result = ConfigStoreClass::decode(
+      blob, sizeof(blob), CONFIG_FIELDS, CONFIG_FIELDS_COUNT, &config, version);
+  bool decoded = result == CONFIG_STORE_OK && version == CONFIG_VERSION;
+  for (uint8_t i = 0; i < CONFIG_FIELDS_COUNT; i++) {
+    if (!sameField(config, source, CONFIG_FIELDS[i])) {
+      fprintf(stderr, "Field of tag %u differs\n", CONFIG_FIELDS[i].tag);
+      decoded = false;
+    }
+  }
+  check("round trip: every tag decoded", decoded);
+
+  config_t empty;
+  memset(&empty, 0, sizeof(empty));
+  fillConfig(config, 1);
+  length = ConfigStoreClass::encode(&empty, CONFIG_FIELDS, CONFIG_FIELDS_COUNT,
+                                    CONFIG_VERSION, blob, sizeof(blob));
+  check("round trip: empty strings decoded",
+        length > 0 &&
+            ConfigStoreClass::decode(blob, length, CONFIG_FIELDS,
+                                     CONFIG_FIELDS_COUNT, &config,
+                                     version) == CONFIG_STORE_OK &&
+            sameFields(config, empty));
+
+  length = ConfigStoreClass::encode(&source, CONFIG_FIELDS,
+                                    CONFIG_FIELDS_COUNT, CONFIG_VERSION, blob,
+                                    sizeof(blob));
+  check("encode: not written beyond the buffer",
+        ConfigStoreClass::encode(&source, CONFIG_FIELDS, CONFIG_FIELDS_COUNT,
+                                 CONFIG_VERSION, blob, length - 1) == 0);
+
+  // Any flipped bit is detected (the magic marking another format)
+  bool flipped = true;
+  for (size_t i = 0; i < length; i++) {
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      blob[i] ^= 1 << bit;
+      if (!rejects(blob, length, (i < 2) ? CONFIG_STORE_EMPTY
+                                         : CONFIG_STORE_CORRUPT)) {
+        flipped = false;
+      }
+      blob[i] ^= 1 << bit;
+    }
+  }
+  check("corrupted blob: every flipped bit rejected, nothing decoded",
+        flipped);
+
+  // Blobs cut short, either by the buffer or by their length (with a valid
+  // checksum over the records left): cut within a record they are corrupt
+  bool cut = rejects(blob, CONFIG_STORE_HEADER_SIZE - 1, CONFIG_STORE_EMPTY);
+  for (size_t size = CONFIG_STORE_HEADER_SIZE; size < length; size++) {
+    cut = cut && rejects(blob, size, CONFIG_STORE_CORRUPT);
+  }
+  check("truncated buffer: rejected, nothing decoded", cut);
+
+  std::vector<bool> boundary(length + 1, false);
+  for (size_t i = CONFIG_STORE_HEADER_SIZE; i <= length;
+       i += CONFIG_STORE_RECORD_SIZE + blob[i + 1]) {
+    boundary[i] = true;
+    if (i == length) {
+      break;
+    }
+  }
+
+  bool truncated = true;
+  static uint8_t forged[CONFIG_SECTOR_SIZE];
+  for (size_t end = CONFIG_STORE_HEADER_SIZE + 1; end < length; end++) {
+    size_t stored = end - CONFIG_STORE_HEADER_SIZE;
+    memcpy(forged, blob, length);
+    forged[4] = stored & 0xFF;
+    forged[5] = stored >> 8;
+
+    std::vector<uint8_t> covered(forged + 2, forged + 6);
+    covered.insert(covered.end(), forged + CONFIG_STORE_HEADER_SIZE,
+                   forged + end);
+    uint16_t crc = referenceCRC16(covered.data(), covered.size());
+    forged[6] = crc & 0xFF;
+    forged[7] = crc >> 8;
+
+    if (boundary[end]) {
+      memset(&config, 0, sizeof(config));
+      if (ConfigStoreClass::decode(forged, length, CONFIG_FIELDS,
+                                   CONFIG_FIELDS_COUNT, &config,
+                                   version) != CONFIG_STORE_OK) {
+        truncated = false;
+      }
+    } else if (!rejects(forged, length, CONFIG_STORE_CORRUPT)) {
+      truncated = false;
+    }
+  }
+  check("truncated records: rejected within a record, nothing decoded",
+        truncated);
+
+  // A newer firmware with another field, a field of which the size changed
+  // and a field of which the maximum length increased
+  config_field_t fields[CONFIG_FIELDS_COUNT + 1];
+  memcpy(fields, CONFIG_FIELDS, sizeof(CONFIG_FIELDS));
+  fields[1] = {2, CONFIG_FIELD_BINARY, offsetof(config_t, color_temp),
+               sizeof(config_t::color_temp)};
+  fields[6] = {7, CONFIG_FIELD_STRING, offsetof(config_t, hostname),
+               sizeof(config_t::hostname)};
+  fields[CONFIG_FIELDS_COUNT] = {200, CONFIG_FIELD_STRING,
+                                 offsetof(config_t, mqtt_server),
+                                 sizeof(config_t::mqtt_server)};
+  length = ConfigStoreClass::encode(&source, fields, CONFIG_FIELDS_COUNT + 1,
+                                    CONFIG_VERSION, blob, sizeof(blob));
+
+  fillConfig(config, 1);
+  config_t defaults = config;
+  result = ConfigStoreClass::decode(blob, length, CONFIG_FIELDS,
+                                    CONFIG_FIELDS_COUNT, &config, version);
+  bool others = result == CONFIG_STORE_OK;
+  for (uint8_t i = 0; i < CONFIG_FIELDS_COUNT; i++) {
+    if (i != 1 && i != 6) {
+      others = others && sameField(config, source, CONFIG_FIELDS[i]);
+    }
+  }
+  check("unknown tags: skipped, other fields decoded", others);
+  check("changed binary size: field left at its default",
+        config.brightness == defaults.brightness);
+  check("longer string: truncated to the field",
+        strlen(config.wifi_ssid) == sizeof(config.wifi_ssid) - 1 &&
+            strncmp(config.wifi_ssid, source.hostname,
+                    sizeof(config.wifi_ssid) - 1) == 0);
+
+  // A configuration stored before the fixtures and the fields appended after
+  // them (so erased), with strings filling their fields (without a NUL)
+  static config_legacy_t legacy;
+  memset(&legacy, 0xFF, sizeof(legacy));
+  legacy.ic = INIT_HASH;
+  legacy.is_on = true;
+  legacy.brightness = 200;
+  legacy.color_temp = 250;
+  legacy.color = {1, 2, 3, 4};
+  legacy.mqtt_port = 1883;
+  legacy.gamma = false;
+  legacy.mqtt_ha_use_discovery = true;
+  legacy.mqtt_ha_is_discovered = false;
+  legacy.api = true;
+  legacy.powerup_mode = 2;
+  legacy.chip_type = MY92XX_MODEL_MY9231;
+  legacy.chip_count = 2;
+  snprintf(legacy.hostname, sizeof(legacy.hostname), "legacy-light");
+  memset(legacy.wifi_ssid, 'S', sizeof(legacy.wifi_ssid));
+  memset(legacy.wifi_psk, 'P', sizeof(legacy.wifi_psk));
+  snprintf(legacy.mqtt_server, sizeof(legacy.mqtt_server), "broker");
+  snprintf(legacy.mqtt_user, sizeof(legacy.mqtt_user), "user");
+  snprintf(legacy.mqtt_password, sizeof(legacy.mqtt_password), "password");
+  snprintf(legacy.mqtt_state_topic, sizeof(legacy.mqtt_state_topic), "state");
+  snprintf(legacy.mqtt_command_topic, sizeof(legacy.mqtt_command_topic),
+           "command");
+  snprintf(legacy.mqtt_lwt_topic, sizeof(legacy.mqtt_lwt_topic), "lwt");
+  snprintf(legacy.mqtt_ha_disc_prefix, sizeof(legacy.mqtt_ha_disc_prefix),
+           "homeassistant");
+  memset(legacy.api_key, 'K', sizeof(legacy.api_key));
+
+  memset(&defaults, 0, sizeof(defaults));
+  snprintf(defaults.mqtt_group_topic, sizeof(defaults.mqtt_group_topic),
+           "default/group");
+  defaults.mqtt_state_publish = 1;
+  defaults.mqtt_lwt_publish = 2;
+
+  config = defaults;
+  migrateConfig(legacy, config);
+  fixture_t fixture = FixtureClass::defaults(MY92XX_MODEL_MY9231, 2);
+  check("legacy: light state and settings migrated",
+        config.is_on && config.brightness == 200 && config.color_temp == 250 &&
+            config.color.white == 4 && config.mqtt_port == 1883 &&
+            !config.gamma && config.mqtt_ha_use_discovery && config.api &&
+            config.powerup_mode == 2 &&
+            config.chip_type == MY92XX_MODEL_MY9231 &&
+            config.chip_count == 2 &&
+            strcmp(config.hostname, "legacy-light") == 0 &&
+            strcmp(config.mqtt_command_topic, "command") == 0 &&
+            strcmp(config.mqtt_ha_disc_prefix, "homeassistant") == 0);
+  check("legacy: strings filling their field migrated in full",
+        strlen(config.wifi_ssid) == sizeof(legacy.wifi_ssid) &&
+            strlen(config.wifi_psk) == sizeof(legacy.wifi_psk) &&
+            strlen(config.api_key) == sizeof(config.api_key) - 1);
+  check("legacy: fixture derived from the chip type and count",
+        memcmp(&config.fixture, &fixture, sizeof(fixture)) == 0);
+  check("legacy: fields not stored yet left at their defaults",
+        strcmp(config.mqtt_group_topic, "default/group") == 0 &&
+            config.mqtt_state_publish == 1 && config.mqtt_lwt_publish == 2 &&
+            memcmp(&config.wifi_cache, &defaults.wifi_cache,
+                   sizeof(config.wifi_cache)) == 0);
+
+  length = ConfigStoreClass::encode(&config, CONFIG_FIELDS,
+                                    CONFIG_FIELDS_COUNT, CONFIG_VERSION, blob,
+                                    sizeof(blob));
+  source = config;
+  memset(&config, 0, sizeof(config));
+  check("legacy: migrated configuration stored",
+        length > 0 &&
+            ConfigStoreClass::decode(blob, length, CONFIG_FIELDS,
+                                     CONFIG_FIELDS_COUNT, &config,
+                                     version) == CONFIG_STORE_OK &&
+            sameFields(config, source));
+
+  // A configuration stored after the fields were appended
+  legacy.fixture = FixtureClass::defaults(MY92XX_MODEL_MY9291, 1);
+  snprintf(legacy.mqtt_group_topic, sizeof(legacy.mqtt_group_topic),
+           "legacy/group");
+  legacy.mqtt_state_publish = 3;
+  legacy.mqtt_lwt_publish = 0;
+  legacy.wifi_cache.magic = WIFI_CACHE_MAGIC;
+  legacy.wifi_cache.channel = 11;
+
+  config = defaults;
+  migrateConfig(legacy, config);
+  fixture = FixtureClass::defaults(MY92XX_MODEL_MY9291, 1);
+  check("legacy: appended fields migrated",
+        memcmp(&config.fixture, &fixture, sizeof(fixture)) == 0 &&
+            strcmp(config.mqtt_group_topic, "legacy/group") == 0 &&
+            config.mqtt_state_publish == 3 && config.mqtt_lwt_publish == 0 &&
+            memcmp(&config.wifi_cache, &legacy.wifi_cache,
+                   sizeof(config.wifi_cache)) == 0);
+
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+  AiLightClass light(MY92XX_MODEL, MY92XX_CHIPS);
+
+  Frame dark = {{0, 0, 0, 0}, 0};
+  Frame bright = {{255, 128, 32, 200}, 255};
+
+  if (argc > 2 && strcmp(argv[1], "trace") == 0) {
+    return traceEffect(argv[2], (argc > 3) ? atoi(argv[3]) : 10000);
+  }
+
+  if (argc > 1 && strcmp(argv[1], "trace") == 0) {
+    light.apply(dark, true);
+    my92xx::reset();
+    my92xx::record(true);
+
+    renderTransition(light, dark, bright);
+
+    printf("time,call,channel,value\n");
+    for (size_t i = 0; i < my92xx::events.size(); i++) {
+      const my92xx_event_t &event = my92xx::events[i];
+      printf("%u,%s,%u,%u\n", event.time,
+             (event.call == MY92XX_CALL_UPDATE) ? "update" : "channel",
+             event.channel, event.value);
+    }
+
+    return 0;
+  }
+
+  if (argc > 1 && strcmp(argv[1], "group") == 0) {
+    simulateGroup();
+
+    return 0;
+  }
+
+  if (argc > 2 && strcmp(argv[1], "replay") == 0) {
+    return replay(argv[2], (argc > 3) ? atoi(argv[3]) : 100);
+  }
+
+  if (argc > 1 && strcmp(argv[1], "color") == 0) {
+    compareColorSpaces();
+
+    return 0;
+  }
+
+  if (argc > 1 && strcmp(argv[1], "state") == 0) {
+    return checkStateStore();
+  }
+
+  if (argc > 1 && strcmp(argv[1], "merge") == 0) {
+    return checkMerge();
+  }
+
+  if (argc > 1 && strcmp(argv[1], "publish") == 0) {
+    return checkPublishQueue();
+  }
+
+  if (argc > 1 && strcmp(argv[1], "push") == 0) {
+    return checkStatePush();
+  }
+
+  if (argc > 1 && strcmp(argv[1], "config") == 0) {
+    return checkConfigStore();
+  }
+
+  if (argc > 1 && strcmp(argv[1], "malformed") == 0) {
+    return checkMalformed();
+  }
+
+  if (argc > 1 && strcmp(argv[1], "realtime") == 0) {
+    return streamRealtime((argc > 2) ? atoi(argv[2]) : 60,
+                          (argc > 3) ? atoi(argv[3]) : 5,
+                          (argc > 4) ? atoi(argv[4]) : 5);
+  }
+
+  printf("%-28s %12s %12s %12s\n", "benchmark", "ns/op", "writes/op",
+         "updates/op");
+
+  benchmark("setColor", 1000000, [&](uint32_t i) {
+    light.setColor(i & 0xFF, (i >> 1) & 0xFF, (i >> 2) & 0xFF);
+  });
+
+  benchmark("setColor (unchanged)", 1000000,
+            [&](uint32_t) { light.setColor(10, 20, 30); });
+
+  benchmark("apply", 1000000, [&](uint32_t i) {
+    light.apply({{(uint8_t)i, 64, 128, 0}, (uint8_t)(i >> 8)}, true);
+  });
+
+  // Commands at 1 kHz (one per millisecond), sent at a refresh rate of 100 Hz
+  light.setRefreshRate(100);
+  benchmark("setColor (100 Hz output)", 1000000, [&](uint32_t i) {
+    light.setColor(i & 0xFF, (i >> 1) & 0xFF, (i >> 2) & 0xFF);
+    light.output(i * 1000);
+  });
+  light.setRefreshRate(0);
+
+  benchmark("colorTemperature2RGB", 1000000, [&](uint32_t i) {
+    Color color = AiLightClass::colorTemperature2RGB(
+        COLOR_TEMPERATURE_MIN +
+        i % (COLOR_TEMPERATURE_MAX - COLOR_TEMPERATURE_MIN + 1));
+    sink = color.red + color.white;
+  });
+
+  benchmark("colorTemperature2RGB (float)", 1000000, [&](uint32_t i) {
+    Color color = referenceMired(
+        COLOR_TEMPERATURE_MIN +
+        i % (COLOR_TEMPERATURE_MAX - COLOR_TEMPERATURE_MIN + 1));
+    sink = color.red + color.white;
+  });
+
+  benchmark("hs2RGBW", 1000000, [&](uint32_t i) {
+    Color color = ColorSpaceClass::hs2RGBW(i % 3600 * 100, i % 101 * 1000);
+    sink = color.red + color.white;
+  });
+
+  benchmark("hs2RGBW (float)", 1000000, [&](uint32_t i) {
+    Color color = referenceHS(i % 3600 / 10.0, i % 101);
+    sink = color.red + color.white;
+  });
+
+  benchmark("xy2RGBW", 1000000, [&](uint32_t i) {
+    Color color = ColorSpaceClass::xy2RGBW(i % 800, 1 + i % 199);
+    sink = color.red + color.white;
+  });
+
+  benchmark("xy2RGBW (float)", 1000000, [&](uint32_t i) {
+    Color color = referenceXY(i % 800 / 1000.0, (1 + i % 199) / 1000.0);
+    sink = color.red + color.white;
+  });
+
+  CommandDecoderClass decoder("ON", NULL);
+  static const char json[] =
+      "{\"state\":\"ON\",\"brightness\":180,\"color\":{\"r\":255,\"g\":120,"
+      "\"b\":10},\"white_value\":40,\"transition\":1.5}";
+  benchmark("decode (processJson)", 1000000, [&](uint32_t) {
+    light_command_t command;
+    sink = decoder.decode(json, sizeof(json) - 1, command);
+  });
+
+  HistogramClass histogram;
+  benchmark("histogram record (metrics)", 1000000,
+            [&](uint32_t i) { histogram.record(i * 2654435761UL >> 12); });
+
+  CommandQueueClass queue;
+  benchmark("queue push/pop", 1000000, [&](uint32_t i) {
+    light_command_t command;
+    command.fields = COMMAND_BRIGHTNESS;
+    command.brightness = i;
+    queue.push(command, i);
+    queue.pop(command, i, 8);
+    sink = command.brightness;
+  });
+
+  benchmark("transition (1000 steps)", 1000, [&](uint32_t i) {
+    if (i & 1) {
+      renderTransition(light, bright, dark);
+    } else {
+      renderTransition(light, dark, bright);
+    }
+  });
+
+  SequencerClass sequencer;
+  sequencer.seed(1);
+  sequencer.begin(EFFECT_CANDLE, bright, bright, 0);
+  uint32_t now = 0; // One millisecond per update
+  benchmark("sequencer update (candle)", 1000000, [&](uint32_t) {
+    Frame frame;
+    if (sequencer.update(now++, frame)) {
+      light.apply(frame, true);
+    }
+  });
+
+  return 0;
+}
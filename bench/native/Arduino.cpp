@@ -0,0 +1,55 @@
+/**
+ * AiLight Benchmark - Arduino Shim
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "Arduino.h"
+#include <chrono>
+#include <thread>
+
+static const std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+
+static bool simulated = false;
+static uint32_t simulatedTime = 0;
+
+uint32_t millis(void) {
+  if (simulated) {
+    return simulatedTime / 1000;
+  }
+
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+uint32_t micros(void) {
+  if (simulated) {
+    return simulatedTime;
+  }
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+void delay(uint32_t ms) {
+  if (simulated) {
+    simulatedTime += ms * 1000;
+    return;
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void simulateTime(uint32_t us) {
+  simulated = true;
+  simulatedTime = us;
+}
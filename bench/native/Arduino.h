@@ -0,0 +1,56 @@
+/**
+ * AiLight Benchmark - Arduino Shim
+ *
+ * A thin stand-in for the parts of the Arduino/ESP8266 core used by the
+ * AiLight libraries, so they can be built and run on the host (the PlatformIO
+ * 'native' environment). Program memory is ordinary memory on the host.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Program memory
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strncmp_P strncmp
+#define snprintf_P snprintf
+#define vsnprintf_P vsnprintf
+
+// Math
+#define constrain(amt, low, high)                                              \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// Time (monotonic, since the start of the program)
+uint32_t millis(void);
+uint32_t micros(void);
+void delay(uint32_t ms);
+
+// Sets the time (in microseconds), after which the time only changes by
+// calling this again (e.g. to replay recorded commands on a simulated clock)
+void simulateTime(uint32_t us);
+
+#endif
@@ -0,0 +1,70 @@
+/**
+ * AiLight Benchmark - MY92XX Mock
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "my92xx.h"
+
+std::vector<my92xx_event_t> my92xx::events;
+uint32_t my92xx::channel_writes = 0;
+uint32_t my92xx::updates = 0;
+bool my92xx::_record = false;
+
+my92xx::my92xx(my92xx_model_t model, unsigned char chips, unsigned char di,
+               unsigned char dcki, my92xx_cmd_t command)
+    : _model(model), _command(command) {
+  (void)di;
+  (void)dcki;
+
+  // The MY9291 has 4 channels, the MY9231 has 3
+  _channels = chips * ((model == MY92XX_MODEL_MY9291) ? 4 : 3);
+  if (_channels > MY92XX_CHANNELS_MAX) {
+    _channels = MY92XX_CHANNELS_MAX;
+  }
+}
+
+unsigned char my92xx::getChannels(void) { return _channels; }
+
+void my92xx::setChannel(unsigned char channel, unsigned int value) {
+  if (channel >= _channels) {
+    return;
+  }
+
+  _value[channel] = value;
+  channel_writes++;
+
+  if (_record) {
+    events.push_back({micros(), MY92XX_CALL_CHANNEL, channel, value});
+  }
+}
+
+unsigned int my92xx::getChannel(unsigned char channel) {
+  return (channel < _channels) ? _value[channel] : 0;
+}
+
+void my92xx::setState(bool state) { _state = state; }
+
+bool my92xx::getState(void) { return _state; }
+
+void my92xx::update(void) {
+  updates++;
+
+  if (_record) {
+    events.push_back({micros(), MY92XX_CALL_UPDATE, 0, _state});
+  }
+}
+
+void my92xx::record(bool enabled) { _record = enabled; }
+
+void my92xx::reset(void) {
+  events.clear();
+  channel_writes = 0;
+  updates = 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * AiLight Benchmark - MY92XX Mock
+ *
+ * A recording stand-in for the MY92XX LED driver library. Instead of driving
+ * the LED driver, every setChannel() and update() call is counted and
+ * (optionally) recorded with a timestamp, so the output of the AiLight library
+ * can be inspected and the number of driver writes can be measured.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef _my92xx_h
+#define _my92xx_h
+
+#include <Arduino.h>
+#include <vector>
+
+#define MY92XX_CHANNELS_MAX 12
+
+typedef enum {
+  MY92XX_MODEL_MY9291 = 0x00,
+  MY92XX_MODEL_MY9231 = 0x01
+} my92xx_model_t;
+
+typedef enum {
+  MY92XX_CMD_BIT_WIDTH_16 = 0x00,
+  MY92XX_CMD_BIT_WIDTH_14 = 0x01,
+  MY92XX_CMD_BIT_WIDTH_12 = 0x02,
+  MY92XX_CMD_BIT_WIDTH_8 = 0x03
+} my92xx_cmd_bit_width_t;
+
+typedef struct {
+  uint8_t scatter;
+  uint8_t frequency;
+  my92xx_cmd_bit_width_t bit_width;
+  uint8_t reaction;
+  uint8_t one_shot;
+  uint8_t resv;
+} my92xx_cmd_t;
+
+#define MY92XX_COMMAND_DEFAULT {0, 0, MY92XX_CMD_BIT_WIDTH_8, 0, 0, 0}
+
+// Types of recorded calls
+enum my92xx_call_t : uint8_t { MY92XX_CALL_CHANNEL, MY92XX_CALL_UPDATE };
+
+// A recorded call
+struct my92xx_event_t {
+  uint32_t time;      // Time of the call (in microseconds)
+  my92xx_call_t call; // The call
+  uint8_t channel;    // The channel set (MY92XX_CALL_CHANNEL only)
+  uint32_t value;     // The value set, or the state (MY92XX_CALL_UPDATE)
+};
+
+class my92xx {
+public:
+  my92xx(my92xx_model_t model, unsigned char chips, unsigned char di,
+         unsigned char dcki, my92xx_cmd_t command);
+
+  unsigned char getChannels(void);
+  void setChannel(unsigned char channel, unsigned int value);
+  unsigned int getChannel(unsigned char channel);
+  void setState(bool state);
+  bool getState(void);
+  void update(void);
+
+  /**
+   * @brief Enables or disables recording the calls (of all instances)
+   *
+   * @param enabled true to record the calls, false to only count them
+   *
+   * @return void
+   */
+  static void record(bool enabled);
+
+  /**
+   * @brief Clears the recorded calls and the counters
+   *
+   * @return void
+   */
+  static void reset(void);
+
+  // Recorded calls and counters (of all instances)
+  static std::vector<my92xx_event_t> events;
+  static uint32_t channel_writes;
+  static uint32_t updates;
+
+private:
+  static bool _record;
+
+  my92xx_model_t _model;
+  unsigned char _channels;
+  my92xx_cmd_t _command;
+  bool _state = false;
+  unsigned int _value[MY92XX_CHANNELS_MAX] = {0};
+};
+
+#endif
@@ -10,17 +10,17 @@
  * Copyright (c) 2016 - 2021 Sacha Telgenhof
  */
 
-const { gulp, src, dest, series } = require('gulp')
+const { gulp, src, dest, series, parallel } = require('gulp')
 const fs = require('fs')
+const path = require('path')
+const crypto = require('crypto')
+const zlib = require('zlib')
 const del = require('del')
 const plumber = require('gulp-plumber')
 const sass = require('gulp-sass')(require('sass'))
 const cssBase64 = require('gulp-css-base64')
-const favicon = require('gulp-base64-favicon')
-const inline = require('gulp-inline')
 const clean_css = require('gulp-clean-css')
 const html_min = require('gulp-htmlmin')
-const gzip = require('gulp-gzip')
 const uglify_js = require('uglify-es')
 const composer = require('gulp-uglify/composer')
 const minify = composer(uglify_js, console)
@@ -28,6 +28,16 @@ const minify = composer(uglify_js, console)
 // Configuration
 const sourceFolder = 'src/'
 const targetFolder = 'html/'
+const buildFolder = 'html/build/'
+
+// The resources referenced by index.html. Their names get a hash of their
+// content, so browsers can cache them indefinitely. Text is pre-compressed.
+const resources = [
+    { file: 'style.css', mime: 'text/css', gzip: true },
+    { file: 'app.js', mime: 'application/javascript', gzip: true },
+    { file: 'favicon.png', mime: 'image/png', gzip: false },
+    { file: 'logo.png', mime: 'image/png', gzip: false },
+]
 
 // Convert the SCSS to CSS
 function scss(done) {
@@ -46,81 +56,90 @@ function base64CSS(done) {
 
 // Clean the generated output files
 function clean(done) {
-    del([sourceFolder + 'html.*'])
-    del([sourceFolder + '*.html'])
+    del([sourceFolder + 'assets.h'])
+    del([buildFolder])
     del([targetFolder + '*.css'])
 
     done()
 }
 
-// Process HTML files
-function html(done) {
-    return src(targetFolder + '*.html')
-        .pipe(favicon())
+// Minify the stylesheet
+function css(done) {
+    return src(targetFolder + 'style.css')
+        .pipe(clean_css())
+        .pipe(dest(buildFolder))
+}
+
+// Minify the script
+function js(done) {
+    return src(targetFolder + 'app.js')
         .pipe(
-            inline({
-                js: function () {
-                    return minify({
-                        mangle: true,
-                    })
-                },
-                css: [clean_css],
-                disabledTypes: ['svg'],
+            minify({
+                mangle: true,
             })
         )
+        .pipe(dest(buildFolder))
+}
+
+// Minify the HTML
+function html(done) {
+    return src(targetFolder + '*.html')
         .pipe(
             html_min({
                 collapseWhitespace: true,
                 removeComments: true,
                 removeEmptyAttributes: true,
                 includeAutoGeneratedTags: false,
-                minifyCSS: true,
-                minifyJS: true,
             })
         )
-        .pipe(gzip())
-        .pipe(dest(sourceFolder))
+        .pipe(dest(buildFolder))
 }
 
-// Build the C++ include header file
-function header(done) {
-    const source = sourceFolder + 'index.html.gz'
-    const destination = sourceFolder + 'html.gz.h'
-
-    const ws = fs.createWriteStream(destination)
-
-    ws.on('error', function (err) {
-        console.log(err)
-    })
-
-    const data = fs.readFileSync(source)
+// Copy the images
+function images(done) {
+    return src([targetFolder + 'favicon.png', targetFolder + 'logo.png']).pipe(dest(buildFolder))
+}
 
-    ws.write('#define html_gz_len ' + data.length + '\n')
-    ws.write('const uint8_t html_gz[] PROGMEM = {')
+// Returns the hash of the content of an asset (as used in names and ETags)
+function contentHash(data) {
+    return crypto.createHash('sha1').update(data).digest('hex').slice(0, 8)
+}
 
-    for (let i = 0; i < data.length; i++) {
-        if (i % 1000 === 0) ws.write('\n')
-        ws.write('0x' + ('00' + data[i].toString(16)).slice(-2))
-        if (i < data.length - 1) ws.write(',')
+// Build the C++ include header file holding the table of all assets
+function header(done) {
+    const destination = sourceFolder + 'assets.h'
+    const assets = []
+
+    let index = fs.readFileSync(buildFolder + 'index.html', 'utf8')
+
+    for (const resource of resources) {
+        const data = fs.readFileSync(buildFolder + resource.file)
+        const hash = contentHash(data)
+        const extension = path.extname(resource.file)
+        const name = path.basename(resource.file, extension) + '.' + hash + extension
+
+        // Reference the content-addressed name
+        index = index.split('"' + resource.file + '"').join('"' + name + '"')
+
+        assets.push({
+            route: '/' + name,
+            mime: resource.mime,
+            hash: hash,
+            gzip: resource.gzip,
+            immutable: true,
+            data: resource.gzip ? zlib.gzipSync(data, { level: 9 }) : data,
+        })
     }
 
-    ws.write('\n};')
-    ws.end()
-
-    // Remove intermediate files
-    fs.unlinkSync(source)
-    fs.unlinkSync(targetFolder + 'style.css')
-
-    done()
-}
-
-// Creates a gamma correction table
-// Copy the contents of this file in the lib/AiLight/AiLight.hpp file
-function gamma(done) {
-    const gamma = 2.8 // Correction factor
-    const MAX_IN = 255 // End of INPUT range
-    const MAX_OUT = 255 // End of OUTPUT range
-    const destination = 'gamma.h'
+    // The HTML shell is revalidated (its route is fixed)
+    assets.unshift({
+        route: '/index.html',
+        mime: 'text/html',
+        hash: contentHash(index),
+        gzip: true,
+        immutable: false,
+        data: zlib.gzipSync(index, { level: 9 }),
+    })
 
     const ws = fs.createWriteStream(destination)
 
@@ -128,28 +147,35 @@ function gamma(done) {
         console.log(err)
     })
 
-    ws.write('// This table remaps linear input values to nonlinear gamma-corrected output\n')
-    ws.write('// values. The output values are specified for 8-bit colours with a gamma\n')
-    ws.write('// correction factor of 2.8\n')
-    ws.write('const static uint8_t PROGMEM gamma8[256] = {')
-    for (let i = 0; i <= MAX_IN; i++) {
-        if (i > 0) {
-            ws.write(',')
-        }
+    ws.write('// Web UI assets (generated by gulp, do not edit)\n')
+    ws.write('#define WEB_ASSETS ' + assets.length + '\n')
+
+    assets.forEach(function (asset, n) {
+        ws.write('\nconst uint8_t web_asset_' + n + '[] PROGMEM = {')
 
-        if ((i & 15) === 0) {
-            ws.write('\n')
+        for (let i = 0; i < asset.data.length; i++) {
+            if (i % 1000 === 0) ws.write('\n')
+            ws.write('0x' + ('00' + asset.data[i].toString(16)).slice(-2))
+            if (i < asset.data.length - 1) ws.write(',')
         }
 
-        const level = Math.floor(Math.pow(i / MAX_IN, gamma) * MAX_OUT + 0.5)
-        ws.write(('    ' + level).slice(-4))
-    }
+        ws.write('\n};\n')
+    })
 
-    ws.write(' };\n')
+    ws.write('\nconst web_asset_t web_assets[WEB_ASSETS] = {\n')
+    assets.forEach(function (asset, n) {
+        const etag = `"\\"${asset.hash}\\""`
+        const flags = `${asset.gzip}, ${asset.immutable}`
+        ws.write(`    {"${asset.route}", "${asset.mime}", ${etag}, web_asset_${n}, ${asset.data.length}, ${flags}},\n`)
+    })
+    ws.write('};\n')
     ws.end()
 
+    // Remove intermediate files
+    del.sync([buildFolder])
+    fs.unlinkSync(targetFolder + 'style.css')
+
     done()
 }
 
-exports.default = series(clean, scss, base64CSS, html, header)
-exports.gamma = gamma
+exports.default = series(clean, scss, base64CSS, parallel(css, js, html, images), header)
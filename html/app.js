@@ -87,7 +87,7 @@ function Switch(id, du = true) {
         state[this.id] = value
 
         if (this.du) {
-            websock.send(JSON.stringify(state))
+            queueState(state)
         }
     }
 
@@ -118,6 +118,12 @@ function Slider(id) {
     }
 
     this.setValue = function (val) {
+        // Don't move the slider while it is being dragged (pushed states may
+        // lag behind)
+        if (this._active) {
+            return
+        }
+
         this.el.value = val
         this._sethigh()
     }
@@ -138,7 +144,18 @@ function Slider(id) {
         }
         msg[this.id] = this.el.value
 
-        websock.send(JSON.stringify(msg))
+        queueState(msg)
+    }
+
+    this._input = function () {
+        this._active = true
+        this._sethigh()
+        this._onchange()
+    }
+
+    this._change = function () {
+        this._active = false
+        this._onchange()
     }
 
     this._init = function () {
@@ -159,21 +176,23 @@ function Slider(id) {
             passive: true,
         })
 
+        // Changes are sent while dragging (coalesced per animation frame)
         let rgb = [K_R, K_G, K_B]
-        if (rgb.includes(this.id)) {
-            this.el.addEventListener('change', sendRGB.bind(this), {
-                passive: true,
-            })
-        } else {
-            this.el.addEventListener('change', this._send.bind(this), {
-                passive: true,
-            })
-        }
+        this._onchange = rgb.includes(this.id) ? sendRGB : this._send.bind(this)
+
+        this.el.addEventListener('input', this._input.bind(this), {
+            passive: true,
+        })
+        this.el.addEventListener('change', this._change.bind(this), {
+            passive: true,
+        })
     }
 }.call(Slider.prototype))
 
 // Globals
 let websock
+let evsource = null
+let pendingState = null
 let stSwitch = new Switch(K_S)
 let brSlider = new Slider(K_BR)
 let ctSlider = new Slider(K_CT)
@@ -201,7 +220,38 @@ function sendRGB() {
     msg[K_C][gSlider.id] = gSlider.getValue()
     msg[K_C][bSlider.id] = bSlider.getValue()
 
-    websock.send(JSON.stringify(msg))
+    queueState(msg)
+}
+
+/**
+ * Queues a light state change to be sent with the next animation frame. Changes
+ * queued in the meantime are merged, so at most one message is sent per frame
+ * however fast a slider is dragged.
+ *
+ * @param msg the attributes of the light state to change
+ *
+ * @return void
+ */
+function queueState(msg) {
+    if (pendingState === null) {
+        pendingState = {}
+        window.requestAnimationFrame(sendState)
+    }
+
+    Object.assign(pendingState, msg)
+}
+
+/**
+ * Sends the queued light state changes over the WebSocket connection
+ *
+ * @return void
+ */
+function sendState() {
+    if (websock && websock.readyState === WebSocket.OPEN) {
+        websock.send(JSON.stringify(pendingState))
+    }
+
+    pendingState = null
 }
 
 /**
@@ -292,6 +342,23 @@ function processData(data) {
                     }
                 }
             }
+
+            // Events require the API Key while the REST API is enabled
+            esConnect(data[key].switch_rest_api ? data[key].api_key : '')
+        }
+
+        // Process the report of the settings saved (applied right away, or after
+        // a restart)
+        if (key === 'r') {
+            let sr = document.getElementById('sr')
+            sr.innerHTML = 'Applied: ' + (data[key].applied.join(', ') || 'nothing')
+
+            if (data[key].restart.length > 0) {
+                sr.innerHTML += '. Restarting for: ' + data[key].restart.join(', ')
+
+                // Wait for the device to have restarted before reloading the page
+                reload(true)
+            }
         }
 
         // Set state
@@ -363,11 +430,18 @@ function wsConnect() {
 /**
  * EventSource client initialization and event processing
  *
+ * @param key The API Key (required while the REST API is enabled)
+ *
  * @return void
  */
-function esConnect() {
+function esConnect(key) {
     if (!!window.EventSource) {
-        let source = new EventSource('/events')
+        if (evsource !== null) {
+            evsource.close()
+        }
+
+        let source = new EventSource('/events' + (key ? '?api_key=' + encodeURIComponent(key) : ''))
+        evsource = source
 
         source.addEventListener(
             'open',
@@ -527,6 +601,7 @@ function save() {
     let msg = {}
     let isValid = true
 
+    let FixtureRegex = /^MY92(91|31)x\d+@\d+,\d+:[RGBWcw-]+(;MY92(91|31)x\d+@\d+,\d+:[RGBWcw-]+)?$/
     let Valid952HostnameRegex =
         /^(([a-zA-Z]|[a-zA-Z][a-zA-Z0-9\-]*[a-zA-Z0-9])\.)*([A-Za-z]|[A-Za-z][A-Za-z0-9\-]*[A-Za-z0-9])$/i
 
@@ -572,6 +647,13 @@ function save() {
             }
         }
 
+        // Validate fixture (chains of '<model>x<chips>@<di pin>,<dcki pin>:<map>')
+        if (id === 'fixture' && !FixtureRegex.test(inputs[i].value)) {
+            addValidationMessage(inputs[i], 'This fixture is invalid.')
+            isValid = false
+            continue
+        }
+
         // Validate API Key
         if (id === 'api_key') {
             if (
@@ -725,5 +807,4 @@ document.addEventListener('DOMContentLoaded', function () {
 
     initTabs()
     wsConnect()
-    esConnect()
 })
@@ -15,38 +15,95 @@
 
 #include "AiLight.hpp"
 
+// Output curves (generated at compile time) mapping the 8-bit colour levels
+// onto the output levels of the MY92XX LED driver, with and without gamma
+// correction. Declared constexpr, so the compiler can't fall back to filling
+// these in at runtime (which fails for tables placed in flash).
+static constexpr Curve PROGMEM linearCurve =
+    generateCurve<10, AILIGHT_OUTPUT_BITS>();
+static constexpr Curve PROGMEM gammaCurve =
+    generateCurve<AILIGHT_GAMMA, AILIGHT_OUTPUT_BITS>();
+
+static_assert(linearCurve.levels[CURVE_SIZE - 1] ==
+                  (1UL << AILIGHT_OUTPUT_BITS) - 1,
+              "Output curve not generated at compile time");
+
+// RGBW colour levels for the supported colour temperatures (generated at
+// compile time)
+static constexpr ColorTemperatureTable PROGMEM colorTemperatureTable =
+    generateColorTemperatureTable();
+
 AiLightClass::AiLightClass(my92xx_model_t model, uint8_t count) {
-  _my92xx = new my92xx(model, count, MY92XX_DI_PIN, MY92XX_DCKI_PIN,
-                       MY92XX_COMMAND_DEFAULT);
+  setupFixture(FixtureClass::defaults(model, count));
 
   setRGBW(); // Initialise colour channels
 }
 
 AiLightClass::AiLightClass(my92xx_model_t model, uint8_t count,
                            const AiLightClass &obj) {
+  setupFixture(FixtureClass::defaults(model, count));
 
-  _my92xx = new my92xx(model, count, MY92XX_DI_PIN, MY92XX_DCKI_PIN,
-                       MY92XX_COMMAND_DEFAULT);
-  *_my92xx = *obj._my92xx;
+  for (uint8_t i = 0; i < _chains && i < obj._chains; i++) {
+    *_drivers[i] = *obj._drivers[i];
+  }
 
   setRGBW(); // Initialise colour channels
 }
 
-AiLightClass::~AiLightClass(void) { delete _my92xx; }
+AiLightClass::AiLightClass(const fixture_t &fixture) {
+  setupFixture(FixtureClass::validate(fixture)
+                   ? fixture
+                   : FixtureClass::defaults(MY92XX_MODEL, MY92XX_CHIPS));
+
+  _dirty = true; // Colour channels are initialised by the first change
+}
+
+AiLightClass::~AiLightClass(void) {
+  for (uint8_t i = 0; i < _chains; i++) {
+    delete _drivers[i];
+  }
+}
+
+void AiLightClass::setupFixture(const fixture_t &fixture) {
+  my92xx_cmd_t command = MY92XX_COMMAND_DEFAULT;
+  command.bit_width = MY92XX_BIT_WIDTH;
+
+  _chains = fixture.chains;
+  _channels = 0;
+
+  for (uint8_t i = 0; i < _chains; i++) {
+    const fixture_chain_t &chain = fixture.chain[i];
+
+    _drivers[i] = new my92xx((my92xx_model_t)chain.model, chain.chips,
+                             chain.di_pin, chain.dcki_pin, command);
+
+    for (uint8_t j = 0; j < FixtureClass::getChannels(chain); j++) {
+      _source[_channels] = fixture.map[_channels];
+      _chain[_channels] = i;
+      _index[_channels] = j;
+      _channels++;
+    }
+  }
+}
 
 uint8_t AiLightClass::getBrightness(void) { return _brightness; }
 
 void AiLightClass::setBrightness(uint16_t level) {
   _brightness = constrain(level, 0, MY92XX_LEVEL_MAX); // Force boundaries
+  _brightness_scale = curveScale(_brightness);
 
   setRGBW();
 }
 
-bool AiLightClass::getState(void) { return _my92xx->getState(); }
+bool AiLightClass::getState(void) { return _state; }
 
 void AiLightClass::setState(bool state) {
-  _my92xx->setState(state);
-  _my92xx->update();
+  _state = state;
+  _dirty = true;
+
+  if (_batch == 0) {
+    flush();
+  }
 }
 
 Color AiLightClass::getColor(void) { return _color; }
@@ -68,82 +125,195 @@ void AiLightClass::setWhite(uint8_t white) {
 uint16_t AiLightClass::getColorTemperature(void) { return _color_temp; }
 
 void AiLightClass::setColorTemperature(uint16_t temperature) {
-  Color ctColor = colorTemperature2RGB(temperature);
+  _color_temp = temperature; // Save colour temperature setting
+  _color = colorTemperature2RGB(temperature);
 
-  _color.red = ctColor.red;
-  _color.green = ctColor.green;
-  _color.blue = ctColor.blue;
+  // Split of the white level over the cold and warm white channels
+  uint16_t cct = constrain(temperature, AILIGHT_CCT_COLD, AILIGHT_CCT_WARM);
+  _warm_share = ((uint32_t)(cct - AILIGHT_CCT_COLD) << 8) /
+                (AILIGHT_CCT_WARM - AILIGHT_CCT_COLD);
 
   setRGBW();
 }
 
 Color AiLightClass::colorTemperature2RGB(uint16_t temperature) {
-  _color_temp = temperature; // Save colour temperature setting
-  Color ctColor;
+  temperature = constrain(temperature, COLOR_TEMPERATURE_MIN,
+                          COLOR_TEMPERATURE_MAX); // Force boundaries
+
+  uint16_t offset = temperature - COLOR_TEMPERATURE_MIN;
+  uint8_t index = offset >> COLOR_TEMPERATURE_STEP_BITS;
+  uint8_t fraction = offset & (COLOR_TEMPERATURE_STEP - 1);
+
+  const uint8_t *from = &colorTemperatureTable.levels[index].red;
+  if (fraction == 0) {
+    return {pgm_read_byte(&from[0]), pgm_read_byte(&from[1]),
+            pgm_read_byte(&from[2]), pgm_read_byte(&from[3])};
+  }
+
+  // Interpolate between two neighbouring table entries
+  const uint8_t *to = &colorTemperatureTable.levels[index + 1].red;
+  uint8_t levels[4];
+  for (uint8_t i = 0; i < 4; i++) {
+    int16_t a = pgm_read_byte(&from[i]);
+    int16_t b = pgm_read_byte(&to[i]);
+
+    levels[i] = a + (((b - a) * fraction + (COLOR_TEMPERATURE_STEP >> 1)) >>
+                     COLOR_TEMPERATURE_STEP_BITS);
+  }
+
+  return {levels[0], levels[1], levels[2], levels[3]};
+}
 
-  temperature = temperature == 0 ? 1 : temperature; // Avoid division by zero
+bool AiLightClass::hasGammaCorrection(void) { return _gamma_correction; }
 
-  // Convert from mired value to relative Kelvin temperature. The temperature
-  // must fall between 1000 and 40000 degrees. All calculations require
-  // tmpKelvin \ 100, so only do the conversion once
-  uint16_t tmpKelvin = constrain(1000000UL / temperature, 1000, 40000) / 100;
+void AiLightClass::useGammaCorrection(bool gamma) {
+  _gamma_correction = gamma;
+  setRGBW();
+}
 
-  // Perform conversions from colour temperature to RGB values
+void AiLightClass::begin(void) { _batch++; }
 
-  // Red
-  float red = tmpKelvin <= 66
-              ? MY92XX_LEVEL_MAX
-              : 329.698727446 * pow((tmpKelvin - 60), -0.1332047592);
+void AiLightClass::commit(void) {
+  if (_batch > 0) {
+    _batch--;
+  }
 
-  ctColor.red = constrain(red, 0, MY92XX_LEVEL_MAX); // Force boundaries
+  if (_batch == 0) {
+    flush();
+  }
+}
 
-  // Green
-  float green = tmpKelvin <= 66
-                ? 99.4708025861 * log(tmpKelvin) - 161.1195681661
-                : 288.1221695283 * pow(tmpKelvin, -0.0755148492);
+void AiLightClass::apply(const Frame &frame, bool state) {
+  _color = frame.color;
+  _brightness = frame.brightness;
+  _brightness_scale = curveScale(_brightness);
+  _state = state;
+  _dirty = true;
 
-  ctColor.green = constrain(green, 0, MY92XX_LEVEL_MAX); // Force boundaries
+  if (_batch == 0) {
+    flush();
+  }
+}
 
-  // Blue
-  float blue = tmpKelvin >= 66
-               ? MY92XX_LEVEL_MAX
-               : tmpKelvin <= 19 ? 0
-                                 : 138.5177312231 * log(tmpKelvin - 10) -
-                                   305.0447927307;
+void AiLightClass::setRGBW() {
+  _state = true; // Changing a level switches on the AiLight
+  _dirty = true;
 
-  ctColor.blue = constrain(blue, 0, MY92XX_LEVEL_MAX); // Force boundaries
+  if (_batch == 0) {
+    flush();
+  }
+}
 
-  return ctColor;
+void AiLightClass::flush() {
+  if (!_dirty) {
+    return;
+  }
+  _dirty = false;
+
+  // Table lookup and brightness scaling (no divisions). Gamma correction only
+  // applies to the colour channels (RGB)
+  const uint16_t *rgb = (_gamma_correction) ? gammaCurve.levels
+                                            : linearCurve.levels;
+  uint32_t white =
+      (pgm_read_word(&linearCurve.levels[_color.white]) * _brightness_scale) >>
+      16;
+
+  uint32_t warm = (white * _warm_share) >> 8;
+
+  // Output levels of the logical channels (in fixture_channel_t order)
+  _back[FIXTURE_RED] =
+      (pgm_read_word(&rgb[_color.red]) * _brightness_scale) >> 16;
+  _back[FIXTURE_GREEN] =
+      (pgm_read_word(&rgb[_color.green]) * _brightness_scale) >> 16;
+  _back[FIXTURE_BLUE] =
+      (pgm_read_word(&rgb[_color.blue]) * _brightness_scale) >> 16;
+  _back[FIXTURE_WHITE] = white;
+  _back[FIXTURE_COLD_WHITE] = white - warm;
+  _back[FIXTURE_WARM_WHITE] = warm;
+  _back[FIXTURE_OFF] = 0;
+  _back_state = _state;
+
+  // The logical channels that differ from the last frame sent (a bit per
+  // channel)
+  uint8_t changed = _frame_sent ? 0 : (1 << FIXTURE_LOGICAL) - 1;
+  for (uint8_t i = 0; i < FIXTURE_LOGICAL; i++) {
+    if (_back[i] != _frame[i]) {
+      changed |= 1 << i;
+    }
+  }
+
+  // A pending frame that has not been sent yet is replaced by this one
+  if (_pending) {
+    _frames_skipped++;
+  }
+
+  // Nothing to send if nothing differs from the last frame sent
+  _back_changed = changed;
+  _pending = changed || !_frame_sent || (_back_state != _frame_state);
+
+  if (_refresh_interval == 0) {
+    transmit();
+  }
 }
 
-bool AiLightClass::hasGammaCorrection(void) { return _gamma_correction; }
+uint16_t AiLightClass::getRefreshRate(void) {
+  return (_refresh_interval == 0) ? 0 : 1000000UL / _refresh_interval;
+}
 
-void AiLightClass::useGammaCorrection(bool gamma) {
-  _gamma_correction = gamma;
-  setRGBW();
+void AiLightClass::setRefreshRate(uint16_t rate) {
+  _refresh_interval = (rate == 0) ? 0 : 1000000UL / rate;
+
+  // Without a refresh rate, nothing is left pending
+  if (_refresh_interval == 0) {
+    transmit();
+  }
 }
 
-void AiLightClass::setRGBW() {
-  uint8_t red =
-      (_gamma_correction) ? pgm_read_byte(&gamma8[_color.red]) : _color.red;
-  uint8_t green =
-      (_gamma_correction) ? pgm_read_byte(&gamma8[_color.green]) : _color.green;
-  uint8_t blue =
-      (_gamma_correction) ? pgm_read_byte(&gamma8[_color.blue]) : _color.blue;
-
-  _my92xx->setChannel(MY92XX_RED,
-                      (uint32_t)map(red, 0, MY92XX_LEVEL_MAX, 0, _brightness));
-  _my92xx->setChannel(
-      MY92XX_GREEN, (uint32_t)map(green, 0, MY92XX_LEVEL_MAX, 0, _brightness));
-  _my92xx->setChannel(MY92XX_BLUE,
-                      (uint32_t)map(blue, 0, MY92XX_LEVEL_MAX, 0, _brightness));
-  _my92xx->setChannel(
-      MY92XX_WHITE,
-      (uint32_t)map(_color.white, 0, MY92XX_LEVEL_MAX, 0, _brightness));
-  _my92xx->setChannel(
-      MY92XX_WHITE + 1,
-      (uint32_t)map(_color.white, 0, MY92XX_LEVEL_MAX, 0, _brightness));
-
-  _my92xx->setState(true);
-  _my92xx->update();
+bool AiLightClass::output(uint32_t now) {
+  if (!_pending || now - _output_last < _refresh_interval) {
+    return false;
+  }
+
+  _output_last = now;
+
+  return transmit();
 }
+
+bool AiLightClass::transmit(void) {
+  if (!_pending) {
+    return false;
+  }
+  _pending = false;
+
+  // Map onto the physical channels, only updating the chains with changed
+  // channels (a bit per chain)
+  bool state_changed = !_frame_sent || (_back_state != _frame_state);
+  uint8_t chains = state_changed ? (1 << _chains) - 1 : 0;
+  for (uint8_t i = 0; i < _channels; i++) {
+    if (_back_changed & (1 << _source[i])) {
+      _drivers[_chain[i]]->setChannel(_index[i], _back[_source[i]]);
+      chains |= 1 << _chain[i];
+    }
+  }
+
+  for (uint8_t i = 0; i < _chains; i++) {
+    if (chains & (1 << i)) {
+      _drivers[i]->setState(_back_state);
+      _drivers[i]->update();
+    }
+  }
+
+  // The back buffer becomes the front buffer
+  for (uint8_t i = 0; i < FIXTURE_LOGICAL; i++) {
+    _frame[i] = _back[i];
+  }
+  _frame_state = _back_state;
+  _frame_sent = true;
+  _frames_sent++;
+
+  return true;
+}
+
+uint32_t AiLightClass::getFramesSent(void) { return _frames_sent; }
+
+uint32_t AiLightClass::getFramesSkipped(void) { return _frames_skipped; }
@@ -16,58 +16,76 @@
 #ifndef AiLight_h
 #define AiLight_h
 
+#include "Color.hpp"
+#include "ColorTemperature.hpp"
+#include "Curve.hpp"
+#include "Fixture.hpp"
 #include <my92xx.h>
 
-// MY92XX settings
+// MY92XX settings (of the AiLight)
 #define MY92XX_MODEL MY92XX_MODEL_MY9231
 #define MY92XX_CHIPS 2
 #define MY92XX_DI_PIN 13
 #define MY92XX_DCKI_PIN 15
-#define MY92XX_RED 0
-#define MY92XX_GREEN 1
-#define MY92XX_BLUE 2
-#define MY92XX_WHITE 3
 
 // The maximum level used for colour channels and brightness
 #define MY92XX_LEVEL_MAX 255
 
-// Structure for holding the levels of all the colour channels
+// The bit depth of the levels sent to the MY92XX LED driver (8, 12, 14 or 16).
+// A higher bit depth gives smoother fades at low brightness levels. Set with
+// the build flag -DAILIGHT_OUTPUT_BITS=<bits>
+#ifndef AILIGHT_OUTPUT_BITS
+#define AILIGHT_OUTPUT_BITS 8
+#endif
 
-struct Color {
-  uint8_t red;
-  uint8_t green;
-  uint8_t blue;
-  uint8_t white;
-};
+#if AILIGHT_OUTPUT_BITS == 16
+#define MY92XX_BIT_WIDTH MY92XX_CMD_BIT_WIDTH_16
+#elif AILIGHT_OUTPUT_BITS == 14
+#define MY92XX_BIT_WIDTH MY92XX_CMD_BIT_WIDTH_14
+#elif AILIGHT_OUTPUT_BITS == 12
+#define MY92XX_BIT_WIDTH MY92XX_CMD_BIT_WIDTH_12
+#elif AILIGHT_OUTPUT_BITS == 8
+#define MY92XX_BIT_WIDTH MY92XX_CMD_BIT_WIDTH_8
+#else
+#error "AILIGHT_OUTPUT_BITS must be 8, 12, 14 or 16"
+#endif
 
-// This table remaps linear input values to nonlinear gamma-corrected output
-// values. The output values are specified for 8-bit colours with a gamma
-// correction factor of 2.8
-const static uint8_t PROGMEM gamma8[256] = {
-    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
-    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   1,
-    1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,
-    2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3,   4,   4,   4,   4,
-    4,   5,   5,   5,   5,   6,   6,   6,   6,   7,   7,   7,   7,   8,   8,
-    8,   9,   9,   9,   10,  10,  10,  11,  11,  11,  12,  12,  13,  13,  13,
-    14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  20,  20,  21,
-    21,  22,  22,  23,  24,  24,  25,  25,  26,  27,  27,  28,  29,  29,  30,
-    31,  32,  32,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,  42,
-    43,  44,  45,  46,  47,  48,  49,  50,  50,  51,  52,  54,  55,  56,  57,
-    58,  59,  60,  61,  62,  63,  64,  66,  67,  68,  69,  70,  72,  73,  74,
-    75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,  90,  92,  93,  95,
-    96,  98,  99,  101, 102, 104, 105, 107, 109, 110, 112, 114, 115, 117, 119,
-    120, 122, 124, 126, 127, 129, 131, 133, 135, 137, 138, 140, 142, 144, 146,
-    148, 150, 152, 154, 156, 158, 160, 162, 164, 167, 169, 171, 173, 175, 177,
-    180, 182, 184, 186, 189, 191, 193, 196, 198, 200, 203, 205, 208, 210, 213,
-    215, 218, 220, 223, 225, 228, 231, 233, 236, 239, 241, 244, 247, 249, 252,
-    255};
+// The gamma correction factor multiplied by 10 (i.e. 28 equals 2.8). Set with
+// the build flag -DAILIGHT_GAMMA=<factor>
+#ifndef AILIGHT_GAMMA
+#define AILIGHT_GAMMA 28
+#endif
+
+// The colour temperatures (in mired) of the cold and warm white channels of
+// CCT fixtures. Set with the build flags -DAILIGHT_CCT_COLD=<mired> and
+// -DAILIGHT_CCT_WARM=<mired>
+#ifndef AILIGHT_CCT_COLD
+#define AILIGHT_CCT_COLD 153
+#endif
+
+#ifndef AILIGHT_CCT_WARM
+#define AILIGHT_CCT_WARM 370
+#endif
 
 class AiLightClass {
 public:
-  AiLightClass();
   AiLightClass(my92xx_model_t model, uint8_t count);
   AiLightClass(my92xx_model_t model, uint8_t count, const AiLightClass &obj);
+
+  /**
+   * @brief Creates the AiLight for a fixture
+   *
+   * The channel mapping of the fixture is resolved once, so rendering a frame
+   * is a single pass over the physical channels. An invalid fixture is
+   * replaced by the AiLight defaults.
+   *
+   * Nothing is sent to the LED drivers until the first change (or batch) is
+   * made, so the power-up state can be restored without showing the defaults
+   * first.
+   *
+   * @param fixture the fixture (LED driver chains and channel mapping)
+   */
+  AiLightClass(const fixture_t &fixture);
   ~AiLightClass(void);
 
   /**
@@ -151,7 +169,7 @@ public:
   /**
    * @brief Sets the colour of the AiLight based on the given colour temperature
    *
-   * This method sets the colour of the AiLight based on the given colour
+   * This method sets the colour (RGBW) of the AiLight based on the given colour
    * temperature and switches on the AiLight.
    *
    * @param temperature the desired colour temperature (in mired)
@@ -159,22 +177,19 @@ public:
   void setColorTemperature(uint16_t temperature);
 
   /**
-   * @brief Converts a colour temperature to the equivalent RGB colours
+   * @brief Converts a colour temperature to the equivalent RGBW colours
    *
-   * This method converts a given colour temperature to RGB colour values.
+   * This method converts a given colour temperature to RGBW colour values.
    * The colour temperature is defined in mired (micro reciprocal degree, the
    * mired is a unit of measurement used to express colour temperature).
-   * (Conversion is based on the algorithm by Tanner Helland.)
+   * The levels are interpolated from a table that is generated at compile
+   * time (see ColorTemperature.hpp). This method has no side effects.
    *
    * @param temperature the desired colour temperature (in mired)
    * @return Color a color object (RGBW) representing the given colour
    * temperature
-   *
-   * Sources:
-   * http://www.tannerhelland.com/4435/convert-temperature-rgb-algorithm-code/
-   * https://en.wikipedia.org/wiki/Mired
    */
-  Color colorTemperature2RGB(uint16_t temperature);
+  static Color colorTemperature2RGB(uint16_t temperature);
 
   /**
    * @brief Returns whether Gamma Correction is enabled or disabled
@@ -202,8 +217,105 @@ public:
    */
   void useGammaCorrection(bool gamma);
 
+  /**
+   * @brief Starts a batch of changes
+   *
+   * All changes made after calling this method (colour, brightness, state,
+   * etc.) are collected and only sent to the MY92XX LED driver once commit()
+   * is called. Batches can be nested; the frame is sent when the outermost
+   * batch is committed.
+   *
+   * @return void
+   */
+  void begin(void);
+
+  /**
+   * @brief Ends a batch of changes and sends the resulting frame
+   *
+   * The frame is only sent to the MY92XX LED driver if the resulting channel
+   * levels or state differ from the last frame sent. With a refresh rate set,
+   * the frame is sent by the next output() instead.
+   *
+   * @return void
+   */
+  void commit(void);
+
+  /**
+   * @brief Applies a complete light frame and state in a single update
+   *
+   * @param frame the desired colour channel levels (RGBW) and brightness
+   * @param state the desired state (true/false)
+   *
+   * @return void
+   */
+  void apply(const Frame &frame, bool state);
+
+  /**
+   * @brief Returns the refresh rate of the output
+   *
+   * @return the refresh rate (in Hz, 0 if frames are sent on commit)
+   */
+  uint16_t getRefreshRate(void);
+
+  /**
+   * @brief Sets the refresh rate of the output
+   *
+   * Changes are rendered into a back buffer. With a refresh rate of 0, the
+   * frame is sent to the MY92XX LED drivers as soon as it is committed.
+   * Otherwise frames are only sent by output(), at most at the given rate:
+   * frames rendered in between replace the pending frame (and are counted as
+   * skipped), so the time spent on the LED drivers is capped however fast
+   * changes are made.
+   *
+   * @param rate the refresh rate (in Hz, 0 to send frames on commit)
+   *
+   * @return void
+   */
+  void setRefreshRate(uint16_t rate);
+
+  /**
+   * @brief Sends the pending frame if the refresh interval has elapsed
+   *
+   * To be called from the main loop when a refresh rate is set.
+   *
+   * @param now the current time (in microseconds)
+   *
+   * @return true if a frame has been sent, otherwise false
+   */
+  bool output(uint32_t now);
+
+  /**
+   * @brief Sends the pending frame right away (regardless of the refresh rate)
+   *
+   * @return true if a frame has been sent, otherwise false
+   */
+  bool transmit(void);
+
+  /**
+   * @brief Returns the number of frames sent to the MY92XX LED drivers
+   *
+   * @return the number of frames sent
+   */
+  uint32_t getFramesSent(void);
+
+  /**
+   * @brief Returns the number of rendered frames that were replaced by a newer
+   * frame before being sent
+   *
+   * @return the number of frames skipped
+   */
+  uint32_t getFramesSkipped(void);
+
 private:
-  my92xx *_my92xx; // MY92XX driver handle
+  my92xx *_drivers[FIXTURE_CHAINS_MAX]; // MY92XX driver handles (per chain)
+  uint8_t _chains = 0;                  // Number of chains
+  uint8_t _channels = 0;                // Number of physical channels
+
+  // The resolved channel mapping: for each physical channel the logical
+  // channel it outputs, its chain and its index in the chain
+  uint8_t _source[FIXTURE_CHANNELS_MAX];
+  uint8_t _chain[FIXTURE_CHANNELS_MAX];
+  uint8_t _index[FIXTURE_CHANNELS_MAX];
 
   // Current colour levels (RGBW). Initial values are 1/4th of maximum
   Color _color = {MY92XX_LEVEL_MAX >> 2, MY92XX_LEVEL_MAX >> 2,
@@ -212,21 +324,75 @@ private:
   // Current brightness level. Initial value is 1/4th of maximum
   uint8_t _brightness = MY92XX_LEVEL_MAX >> 2;
 
+  // Factor (Q0.16) the output levels are scaled with for the brightness level
+  uint32_t _brightness_scale = curveScale(MY92XX_LEVEL_MAX >> 2);
+
   // Current colour temperature setting. Initial value is equivalent of 2700K
   uint16_t _color_temp = 370;
 
+  // Share (Q0.8) of the white level output by the warm white channel
+  uint16_t _warm_share = 256;
+
+  // Current state (i.e on or off)
+  bool _state = false;
+
+  // Nesting level of begin()/commit() batches
+  uint8_t _batch = 0;
+
+  // Whether changes have been made that have not been sent yet
+  bool _dirty = false;
+
+  // Levels of the logical channels and state of the last frame sent to the
+  // MY92XX LED drivers (front buffer)
+  uint32_t _frame[FIXTURE_LOGICAL];
+  bool _frame_state = false;
+  bool _frame_sent = false;
+
+  // Levels of the logical channels and state of the last frame rendered (back
+  // buffer), the logical channels differing from the front buffer (a bit per
+  // channel) and whether it is to be sent
+  uint32_t _back[FIXTURE_LOGICAL];
+  bool _back_state = false;
+  uint8_t _back_changed = 0;
+  bool _pending = false;
+
+  // Minimum interval between frames sent (in microseconds, 0 to send frames
+  // on commit) and the time the last frame was sent by output()
+  uint32_t _refresh_interval = 0;
+  uint32_t _output_last = 0;
+
+  // Number of frames sent and skipped
+  uint32_t _frames_sent = 0;
+  uint32_t _frames_skipped = 0;
+
   /**
-   * @brief Sets the levels of all colour levels (RGBW) to the MY92XX LED
-   * driver.
-   *
-   * This internal method sets the levels of all colour levels (RGBW) to the
-   * MY9291 LED driver including the brightness level. To switch on the AiLight,
-   * the setState() method needs to be used subsequently.
+   * @brief Marks the frame as changed and sends it unless in a batch
    *
    * @return void
    */
   void setRGBW();
 
+  /**
+   * @brief Creates the MY92XX LED driver handles and resolves the channel
+   * mapping of a fixture
+   *
+   * @param fixture the fixture (LED driver chains and channel mapping)
+   *
+   * @return void
+   */
+  void setupFixture(const fixture_t &fixture);
+
+  /**
+   * @brief Renders the levels of all colour levels (RGBW) into the back buffer
+   *
+   * This internal method composes the levels of all logical channels
+   * including the brightness level. The frame is pending if it differs from
+   * the last frame sent, and is sent right away if no refresh rate is set.
+   *
+   * @return void
+   */
+  void flush();
+
   // Gamma correction is enabled or disabled
   bool _gamma_correction = false;
 };
@@ -0,0 +1,33 @@
+/**
+ * AiLight Library - Colour definitions
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Color_h
+#define AiLight_Color_h
+
+#include <stdint.h>
+
+// Structure for holding the levels of all the colour channels
+struct Color {
+  uint8_t red;
+  uint8_t green;
+  uint8_t blue;
+  uint8_t white;
+};
+
+// Structure for holding a complete light frame: the colour channels (RGBW)
+// and the brightness level they are scaled with
+struct Frame {
+  Color color;
+  uint8_t brightness;
+};
+
+#endif
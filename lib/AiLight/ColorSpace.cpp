@@ -0,0 +1,184 @@
+/**
+ * AiLight Library - Colour Spaces
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "ColorSpace.hpp"
+#include <Arduino.h>
+
+// sRGB encoded levels of the linear levels (generated at compile time, see
+// AiLight.cpp)
+static constexpr ColorEncodingTable PROGMEM colorEncodingTable =
+    generateColorEncodingTable();
+
+// Corners of the gamut of the RGB LEDs (counter-clockwise, with COLOR_XY_BITS
+// fractional bits)
+static const int32_t gamut[3][2] = {
+    {COLOR_GAMUT_RED_X << COLOR_XY_BITS, COLOR_GAMUT_RED_Y << COLOR_XY_BITS},
+    {COLOR_GAMUT_GREEN_X << COLOR_XY_BITS,
+     COLOR_GAMUT_GREEN_Y << COLOR_XY_BITS},
+    {COLOR_GAMUT_BLUE_X << COLOR_XY_BITS, COLOR_GAMUT_BLUE_Y << COLOR_XY_BITS}};
+
+// Scales a Q15 fraction to a level (range 0 - 255)
+static inline uint8_t level(uint32_t fraction) {
+  return (255 * fraction + (1 << 14)) >> 15;
+}
+
+// Encodes a 12-bit linear level (range 0 - 4096) with the sRGB transfer
+// function
+static uint8_t encode(uint32_t linear) {
+  uint32_t index = linear >> 4;
+  uint32_t fraction = linear & 0x0F;
+
+  uint8_t from = pgm_read_byte(&colorEncodingTable.levels[index]);
+  if (fraction == 0) {
+    return from;
+  }
+
+  // Interpolate between two neighbouring table entries
+  uint8_t to = pgm_read_byte(&colorEncodingTable.levels[index + 1]);
+
+  return from + (((to - from) * fraction + 8) >> 4);
+}
+
+Color ColorSpaceClass::hs2RGBW(uint32_t hue, uint32_t saturation) {
+  hue %= 360000;
+  if (saturation > 100000) {
+    saturation = 100000;
+  }
+
+  // The saturation and the position within the sector of the colour wheel as
+  // Q15 fractions (i.e. 32768 / 100000 == 1024 / 3125)
+  uint32_t s = (saturation * 1024 + 1562) / 3125;
+  uint32_t f = ((hue % 60000) * 1024 + 937) / 1875;
+
+  uint8_t v = 255;
+  uint8_t p = level(32768 - s);
+  uint8_t q = level(32768 - ((s * f) >> 15));
+  uint8_t t = level(32768 - ((s * (32768 - f)) >> 15));
+
+  switch (hue / 60000) {
+  case 0:
+    return rgb2RGBW(v, t, p);
+  case 1:
+    return rgb2RGBW(q, v, p);
+  case 2:
+    return rgb2RGBW(p, v, t);
+  case 3:
+    return rgb2RGBW(p, q, v);
+  case 4:
+    return rgb2RGBW(t, p, v);
+  default:
+    return rgb2RGBW(v, p, q);
+  }
+}
+
+Color ColorSpaceClass::xy2RGBW(uint16_t x, uint16_t y) {
+  int32_t cx = (int32_t)x << COLOR_XY_BITS;
+  int32_t cy = (int32_t)y << COLOR_XY_BITS;
+  clampToGamut(cx, cy);
+
+  // Linear levels of the LEDs (relative, so not divided by y)
+  int32_t cz = (1000 << COLOR_XY_BITS) - cx - cy;
+  int32_t levels[3] = {
+      csCoefficient(0, 0) * cx + csCoefficient(0, 1) * cy +
+          csCoefficient(0, 2) * cz,
+      csCoefficient(1, 0) * cx + csCoefficient(1, 1) * cy +
+          csCoefficient(1, 2) * cz,
+      csCoefficient(2, 0) * cx + csCoefficient(2, 1) * cy +
+          csCoefficient(2, 2) * cz};
+
+  // Inside the gamut the levels are positive (but for rounding). Most of the
+  // fractional bits are dropped, so the normalisation below can't overflow.
+  uint32_t highest = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    levels[i] = (levels[i] < 0)
+                    ? 0
+                    : levels[i] >> (COLOR_MATRIX_BITS + COLOR_XY_BITS - 4);
+    if ((uint32_t)levels[i] > highest) {
+      highest = levels[i];
+    }
+  }
+
+  if (highest == 0) {
+    return rgb2RGBW(255, 255, 255);
+  }
+
+  // Normalised to the highest level (the brightness is applied separately),
+  // as 12-bit linear levels
+  uint32_t scale = (1UL << 30) / highest;
+  uint8_t encoded[3];
+  for (uint8_t i = 0; i < 3; i++) {
+    encoded[i] = encode((levels[i] * scale + (1UL << 17)) >> 18);
+  }
+
+  return rgb2RGBW(encoded[0], encoded[1], encoded[2]);
+}
+
+Color ColorSpaceClass::rgb2RGBW(uint8_t red, uint8_t green, uint8_t blue) {
+  uint8_t white = red < green ? (red < blue ? red : blue)
+                              : (green < blue ? green : blue);
+
+  return {(uint8_t)(red - white), (uint8_t)(green - white),
+          (uint8_t)(blue - white), white};
+}
+
+bool ColorSpaceClass::clampToGamut(int32_t &x, int32_t &y) {
+  // Inside if on the left of (or on) all edges
+  bool inside = true;
+  for (uint8_t i = 0; i < 3; i++) {
+    const int32_t *a = gamut[i];
+    const int32_t *b = gamut[(i + 1) % 3];
+
+    if ((b[0] - a[0]) * (y - a[1]) - (b[1] - a[1]) * (x - a[0]) < 0) {
+      inside = false;
+    }
+  }
+
+  if (inside) {
+    return false;
+  }
+
+  // The closest point on any of the edges
+  int32_t closest = INT32_MAX;
+  int32_t cx = x;
+  int32_t cy = y;
+
+  for (uint8_t i = 0; i < 3; i++) {
+    const int32_t *a = gamut[i];
+    const int32_t *b = gamut[(i + 1) % 3];
+    int32_t dx = b[0] - a[0];
+    int32_t dy = b[1] - a[1];
+    int32_t length = dx * dx + dy * dy;
+
+    // Projection onto the edge (as a Q15 fraction), limited to its ends
+    int32_t t = ((x - a[0]) * dx + (y - a[1]) * dy) / (length >> 15);
+    if (t < 0) {
+      t = 0;
+    } else if (t > (1 << 15)) {
+      t = 1 << 15;
+    }
+
+    int32_t px = a[0] + ((dx * t + (1 << 14)) >> 15);
+    int32_t py = a[1] + ((dy * t + (1 << 14)) >> 15);
+    int32_t distance = (x - px) * (x - px) + (y - py) * (y - py);
+
+    if (distance < closest) {
+      closest = distance;
+      cx = px;
+      cy = py;
+    }
+  }
+
+  x = cx;
+  y = cy;
+
+  return true;
+}
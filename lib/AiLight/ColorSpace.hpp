@@ -0,0 +1,216 @@
+/**
+ * AiLight Library - Colour Spaces
+ *
+ * Converts the colour modes of Home Assistant (hue/saturation and CIE xy
+ * chromaticity) into the RGBW colour levels of the light, using integer
+ * arithmetic only. The colour is converted at full level (the brightness is
+ * applied separately), after which the common part of the RGB levels is moved
+ * to the white colour channel, like the colour temperature table does (see
+ * ColorTemperature.hpp), so pale colours are produced by the white LEDs.
+ *
+ * CIE xy colours outside the gamut of the RGB LEDs are clamped to the closest
+ * colour inside it. The matrix converting chromaticities into the linear
+ * levels of the LEDs is derived from the primaries of the LEDs at compile
+ * time, and the levels are encoded with the sRGB transfer function by a table
+ * (as the levels of the light are perceptual, see Curve.hpp).
+ *
+ * Sources:
+ * https://en.wikipedia.org/wiki/HSL_and_HSV#HSV_to_RGB
+ * http://www.brucelindbloom.com/index.html?Eqn_RGB_XYZ_Matrix.html
+ * https://en.wikipedia.org/wiki/SRGB#Transfer_function_(%22gamma%22)
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_ColorSpace_h
+#define AiLight_ColorSpace_h
+
+#include "Color.hpp"
+#include "Curve.hpp"
+
+// Chromaticities (CIE xy, in thousandths) of the primaries of the RGB LEDs.
+// The AiLight uses common high-power RGB LEDs, of which the primaries are
+// approximated by those below.
+#define COLOR_GAMUT_RED_X 692
+#define COLOR_GAMUT_RED_Y 308
+#define COLOR_GAMUT_GREEN_X 170
+#define COLOR_GAMUT_GREEN_Y 700
+#define COLOR_GAMUT_BLUE_X 153
+#define COLOR_GAMUT_BLUE_Y 48
+
+// Chromaticity (CIE xy, in thousandths) of the white point (D65), the colour
+// produced by equal RGB levels
+#define COLOR_WHITE_POINT_X 313
+#define COLOR_WHITE_POINT_Y 329
+
+// Fractional bits of the coefficients of the chromaticity matrix
+#define COLOR_MATRIX_BITS 12
+
+// Fractional bits of the chromaticity coordinates (in thousandths) while
+// clamping to the gamut, so colours clamped onto an edge don't snap to the
+// nearest thousandth (which shows in the weakest colour channel)
+#define COLOR_XY_BITS 4
+
+// Number of entries of the sRGB encoding table (indexed by the 12-bit linear
+// level divided by 16, plus one to interpolate the last entry)
+#define COLOR_ENCODING_ENTRIES 257
+
+// Structure holding the sRGB encoded levels of the linear levels
+struct ColorEncodingTable {
+  uint8_t levels[COLOR_ENCODING_ENTRIES];
+};
+
+// The functions below are evaluated by the compiler (see Curve.hpp)
+
+// Chromaticity (x or y, as a fraction) of a primary (0: red, 1: green, 2: blue)
+constexpr double csPrimaryX(uint8_t c) {
+  return (c == 0 ? COLOR_GAMUT_RED_X
+                 : c == 1 ? COLOR_GAMUT_GREEN_X : COLOR_GAMUT_BLUE_X) /
+         1000.0;
+}
+
+constexpr double csPrimaryY(uint8_t c) {
+  return (c == 0 ? COLOR_GAMUT_RED_Y
+                 : c == 1 ? COLOR_GAMUT_GREEN_Y : COLOR_GAMUT_BLUE_Y) /
+         1000.0;
+}
+
+// XYZ of a chromaticity at Y = 1 (row 0: X, 1: Y, 2: Z)
+constexpr double csXYZ(uint8_t r, double x, double y) {
+  return r == 0 ? x / y : r == 1 ? 1 : (1 - x - y) / y;
+}
+
+// Element of the matrix holding the XYZ of the primaries in its columns
+constexpr double csPrimaries(uint8_t r, uint8_t c) {
+  return csXYZ(r, csPrimaryX(c), csPrimaryY(c));
+}
+
+// Cofactor of an element of the primaries matrix
+constexpr double csCofactor(uint8_t r, uint8_t c) {
+  return ((r + c) % 2 ? -1 : 1) *
+         (csPrimaries(r == 0 ? 1 : 0, c == 0 ? 1 : 0) *
+              csPrimaries(r == 2 ? 1 : 2, c == 2 ? 1 : 2) -
+          csPrimaries(r == 0 ? 1 : 0, c == 2 ? 1 : 2) *
+              csPrimaries(r == 2 ? 1 : 2, c == 0 ? 1 : 0));
+}
+
+constexpr double csDeterminant() {
+  return csPrimaries(0, 0) * csCofactor(0, 0) +
+         csPrimaries(0, 1) * csCofactor(0, 1) +
+         csPrimaries(0, 2) * csCofactor(0, 2);
+}
+
+// Element of the inverse of the primaries matrix
+constexpr double csInverse(uint8_t r, uint8_t c) {
+  return csCofactor(c, r) / csDeterminant();
+}
+
+// Level of a primary making up the white point
+constexpr double csWhite(uint8_t r) {
+  return csInverse(r, 0) * csXYZ(0, COLOR_WHITE_POINT_X / 1000.0,
+                                 COLOR_WHITE_POINT_Y / 1000.0) +
+         csInverse(r, 1) +
+         csInverse(r, 2) * csXYZ(2, COLOR_WHITE_POINT_X / 1000.0,
+                                 COLOR_WHITE_POINT_Y / 1000.0);
+}
+
+/**
+ * @brief Calculates a coefficient of the matrix converting a chromaticity
+ * (x, y, 1 - x - y) into the linear levels of the LEDs
+ *
+ * The levels are relative to those of the white point, so equal levels give
+ * white. As the levels are normalised afterwards, the chromaticity doesn't
+ * need to be divided by y.
+ *
+ * @param r the row (0: red, 1: green, 2: blue)
+ * @param c the column (0: x, 1: y, 2: 1 - x - y)
+ *
+ * @return the (rounded) coefficient with COLOR_MATRIX_BITS fractional bits
+ */
+constexpr int32_t csCoefficient(uint8_t r, uint8_t c) {
+  return (int32_t)(csInverse(r, c) / csWhite(r) * (1 << COLOR_MATRIX_BITS) +
+                   (csInverse(r, c) < 0 ? -0.5 : 0.5));
+}
+
+// The sRGB transfer function (encoding a linear level, as a fraction)
+constexpr double csEncode(double level) {
+  return level <= 0.0031308
+             ? 12.92 * level
+             : 1.055 * curveExp(curveLog(level) / 2.4) - 0.055;
+}
+
+template <uint16_t... I>
+constexpr ColorEncodingTable generateColorEncodingTable(CurveIndices<I...>) {
+  return ColorEncodingTable{
+      {(uint8_t)(csEncode(I / 256.0) * 255 + 0.5)...}};
+}
+
+/**
+ * @brief Generates the sRGB encoding table at compile time
+ *
+ * @return the generated sRGB encoding table
+ */
+constexpr ColorEncodingTable generateColorEncodingTable() {
+  return generateColorEncodingTable(
+      CurveIndexSequence<COLOR_ENCODING_ENTRIES>::type());
+}
+
+class ColorSpaceClass {
+public:
+  /**
+   * @brief Converts a hue and saturation into RGBW colour levels
+   *
+   * @param hue the hue (in thousandths of degrees, range 0 - 360000)
+   * @param saturation the saturation (in thousandths of percents, range 0 -
+   * 100000)
+   *
+   * @return the RGBW colour levels (at full level)
+   */
+  static Color hs2RGBW(uint32_t hue, uint32_t saturation);
+
+  /**
+   * @brief Converts a CIE xy chromaticity into RGBW colour levels
+   *
+   * Chromaticities outside the gamut of the RGB LEDs are clamped to the
+   * closest one inside it.
+   *
+   * @param x the x coordinate (in thousandths, range 0 - 1000)
+   * @param y the y coordinate (in thousandths, range 0 - 1000)
+   *
+   * @return the RGBW colour levels (at full level)
+   */
+  static Color xy2RGBW(uint16_t x, uint16_t y);
+
+  /**
+   * @brief Moves the common part of the RGB levels to the white colour
+   * channel
+   *
+   * @param red the level of the red colour channel
+   * @param green the level of the green colour channel
+   * @param blue the level of the blue colour channel
+   *
+   * @return the RGBW colour levels
+   */
+  static Color rgb2RGBW(uint8_t red, uint8_t green, uint8_t blue);
+
+  /**
+   * @brief Clamps a CIE xy chromaticity to the gamut of the RGB LEDs
+   *
+   * The coordinates are in thousandths, with COLOR_XY_BITS fractional bits.
+   *
+   * @param x the x coordinate, set to the clamped coordinate
+   * @param y the y coordinate, set to the clamped coordinate
+   *
+   * @return true if the chromaticity has been clamped, false if it is inside
+   * the gamut
+   */
+  static bool clampToGamut(int32_t &x, int32_t &y);
+};
+
+#endif
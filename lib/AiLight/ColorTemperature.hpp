@@ -0,0 +1,112 @@
+/**
+ * AiLight Library - Colour Temperature Table
+ *
+ * Generates the table converting colour temperatures (in mired) into RGBW
+ * colour levels at compile time. The conversion is based on the algorithm by
+ * Tanner Helland, after which the common part of the RGB levels is moved to the
+ * white colour channel so (warm and cool) whites are produced by the white
+ * LEDs.
+ *
+ * Sources:
+ * http://www.tannerhelland.com/4435/convert-temperature-rgb-algorithm-code/
+ * https://en.wikipedia.org/wiki/Mired
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_ColorTemperature_h
+#define AiLight_ColorTemperature_h
+
+#include "Color.hpp"
+#include "Curve.hpp"
+
+// Supported range of colour temperatures (in mired). Values outside this range
+// are clamped. (56 mired ~ 17850K, 504 mired ~ 1980K)
+#define COLOR_TEMPERATURE_MIN 56
+#define COLOR_TEMPERATURE_MAX 504
+
+// Distance (in mired) between two table entries, as a power of 2. Levels in
+// between entries are interpolated linearly.
+#define COLOR_TEMPERATURE_STEP_BITS 4
+#define COLOR_TEMPERATURE_STEP (1 << COLOR_TEMPERATURE_STEP_BITS)
+
+#define COLOR_TEMPERATURE_ENTRIES                                              \
+  (((COLOR_TEMPERATURE_MAX - COLOR_TEMPERATURE_MIN) >>                         \
+    COLOR_TEMPERATURE_STEP_BITS) +                                             \
+   1)
+
+// Structure holding the RGBW colour levels for the supported range of colour
+// temperatures
+struct ColorTemperatureTable {
+  Color levels[COLOR_TEMPERATURE_ENTRIES];
+};
+
+// The functions below are evaluated by the compiler (see Curve.hpp)
+
+// Natural logarithm for x >= 1
+constexpr double ctLog(double x) { return -curveLog(1 / x); }
+
+// x^e for x >= 1 and e <= 0
+constexpr double ctPow(double x, double e) { return curveExp(e * ctLog(x)); }
+
+constexpr uint8_t ctLevel(double value) {
+  return value <= 0 ? 0 : value >= 255 ? 255 : (uint8_t)(value + 0.5);
+}
+
+// The colour channels for a temperature (in Kelvin / 100)
+constexpr uint8_t ctRed(double t) {
+  return ctLevel(t <= 66 ? 255 : 329.698727446 * ctPow(t - 60, -0.1332047592));
+}
+
+constexpr uint8_t ctGreen(double t) {
+  return ctLevel(t <= 66 ? 99.4708025861 * ctLog(t) - 161.1195681661
+                         : 288.1221695283 * ctPow(t - 60, -0.0755148492));
+}
+
+constexpr uint8_t ctBlue(double t) {
+  return ctLevel(t >= 66   ? 255
+                 : t <= 19 ? 0
+                           : 138.5177312231 * ctLog(t - 10) - 305.0447927307);
+}
+
+constexpr uint8_t ctMin(uint8_t a, uint8_t b, uint8_t c) {
+  return a < b ? (a < c ? a : c) : (b < c ? b : c);
+}
+
+// Moves the common part of the RGB levels to the white colour channel
+constexpr Color ctBlend(uint8_t red, uint8_t green, uint8_t blue,
+                        uint8_t white) {
+  return Color{(uint8_t)(red - white), (uint8_t)(green - white),
+               (uint8_t)(blue - white), white};
+}
+
+constexpr Color ctColor(double t) {
+  return ctBlend(ctRed(t), ctGreen(t), ctBlue(t),
+                 ctMin(ctRed(t), ctGreen(t), ctBlue(t)));
+}
+
+template <uint16_t... I>
+constexpr ColorTemperatureTable
+generateColorTemperatureTable(CurveIndices<I...>) {
+  return ColorTemperatureTable{{ctColor(
+      10000.0 /
+      (COLOR_TEMPERATURE_MIN + (I << COLOR_TEMPERATURE_STEP_BITS)))...}};
+}
+
+/**
+ * @brief Generates the colour temperature table at compile time
+ *
+ * @return the generated colour temperature table
+ */
+constexpr ColorTemperatureTable generateColorTemperatureTable() {
+  return generateColorTemperatureTable(
+      CurveIndexSequence<COLOR_TEMPERATURE_ENTRIES>::type());
+}
+
+#endif
@@ -0,0 +1,527 @@
+/**
+ * AiLight Library - Command Decoder
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "Command.hpp"
+#include <string.h>
+
+CommandDecoderClass::CommandDecoderClass(const char *payload_on,
+                                         const char *color_array_key)
+    : _payload_on(payload_on), _color_array_key(color_array_key) {}
+
+command_result_t CommandDecoderClass::decode(const char *data, size_t length,
+                                             light_command_t &command) {
+  command_result_t result = COMMAND_OK;
+  uint32_t value;
+
+  _pos = data;
+  _end = data + length;
+  memset(&command, 0, sizeof(command));
+
+  if (!consume('{')) {
+    return COMMAND_ERROR_SYNTAX;
+  }
+
+  if (consume('}')) {
+    skipWhitespace();
+    return (_pos == _end) ? COMMAND_OK : COMMAND_ERROR_SYNTAX;
+  }
+
+  do {
+    const char *key;
+    size_t key_length;
+
+    if (!parseString(key, key_length) || !consume(':')) {
+      return COMMAND_ERROR_SYNTAX;
+    }
+
+    bool ok;
+    if (equals(key, key_length, COMMAND_KEY_STATE)) {
+      const char *state;
+      size_t state_length;
+
+      ok = parseString(state, state_length);
+      command.state = ok && equals(state, state_length, _payload_on);
+      command.fields |= COMMAND_STATE;
+    } else if (equals(key, key_length, COMMAND_KEY_BRIGHTNESS)) {
+      ok = parseValue(COMMAND_LEVEL_MAX, value, result);
+      command.brightness = value / 1000;
+      command.fields |= COMMAND_BRIGHTNESS;
+    } else if (equals(key, key_length, COMMAND_KEY_COLOR)) {
+      ok = parseColor(command, result);
+      command.fields |= COMMAND_COLOR;
+    } else if (_color_array_key != NULL &&
+               equals(key, key_length, _color_array_key)) {
+      ok = parseColorArray(command.color, result);
+      command.fields |= COMMAND_COLOR;
+    } else if (equals(key, key_length, COMMAND_KEY_WHITE)) {
+      ok = parseValue(COMMAND_LEVEL_MAX, value, result);
+      command.color.white = value / 1000;
+      command.fields |= COMMAND_WHITE;
+    } else if (equals(key, key_length, COMMAND_KEY_COLORTEMP)) {
+      ok = parseValue(COMMAND_COLOR_TEMP_MAX, value, result);
+      command.color_temp = value / 1000;
+      command.fields |= COMMAND_COLOR_TEMP;
+    } else if (equals(key, key_length, COMMAND_KEY_FLASH)) {
+      ok = parseValue(COMMAND_FLASH_MAX, value, result);
+      command.flash = value / 1000;
+      command.fields |= COMMAND_FLASH;
+    } else if (equals(key, key_length, COMMAND_KEY_TRANSITION)) {
+      ok = parseValue(COMMAND_TRANSITION_MAX, value, result);
+      command.transition = value; // Thousandths of seconds are milliseconds
+      command.fields |= COMMAND_TRANSITION;
+    } else if (equals(key, key_length, COMMAND_KEY_GAMMA)) {
+      ok = parseBool(command.gamma);
+      command.fields |= COMMAND_GAMMA;
+    } else if (equals(key, key_length, COMMAND_KEY_EFFECT)) {
+      ok = parseEffect(command.effect, result);
+      command.fields |= COMMAND_EFFECT;
+    } else if (equals(key, key_length, COMMAND_KEY_PROGRAM)) {
+      ok = parseProgram(result);
+      command.fields |= COMMAND_PROGRAM;
+    } else {
+      ok = skipValue(1);
+      command.fields |= COMMAND_OTHER;
+    }
+
+    if (!ok) {
+      return (result != COMMAND_OK) ? result : COMMAND_ERROR_SYNTAX;
+    }
+  } while (consume(','));
+
+  if (!consume('}')) {
+    return COMMAND_ERROR_SYNTAX;
+  }
+
+  // Nothing but whitespace is allowed after the command
+  skipWhitespace();
+  if (_pos != _end) {
+    return COMMAND_ERROR_SYNTAX;
+  }
+
+  // An uploaded program is run, unless another effect is selected
+  if ((command.fields & (COMMAND_PROGRAM | COMMAND_EFFECT)) ==
+      COMMAND_PROGRAM) {
+    command.effect = EFFECT_CUSTOM;
+    command.fields |= COMMAND_EFFECT;
+  }
+
+  return COMMAND_OK;
+}
+
+command_result_t CommandDecoderClass::split(const char *data, size_t length,
+                                            const char **commands,
+                                            size_t *lengths, uint8_t max,
+                                            uint8_t &count) {
+  _pos = data;
+  _end = data + length;
+  count = 0;
+
+  if (!consume('[')) {
+    return COMMAND_ERROR_SYNTAX;
+  }
+
+  if (!consume(']')) {
+    do {
+      // Only objects are commands
+      skipWhitespace();
+      const char *start = _pos;
+      if (_pos >= _end || *_pos != '{' || !skipValue(0)) {
+        return COMMAND_ERROR_SYNTAX;
+      }
+
+      if (count == max) {
+        return COMMAND_ERROR_RANGE;
+      }
+
+      commands[count] = start;
+      lengths[count] = _pos - start;
+      count++;
+    } while (consume(','));
+
+    if (!consume(']')) {
+      return COMMAND_ERROR_SYNTAX;
+    }
+  }
+
+  // Nothing but whitespace is allowed after the array
+  skipWhitespace();
+
+  return (_pos == _end) ? COMMAND_OK : COMMAND_ERROR_SYNTAX;
+}
+
+const uint8_t *CommandDecoderClass::getProgram(size_t &length) {
+  length = _program_length;
+
+  return _program;
+}
+
+void CommandDecoderClass::skipWhitespace(void) {
+  while (_pos < _end &&
+         (*_pos == ' ' || *_pos == '\t' || *_pos == '\r' || *_pos == '\n')) {
+    _pos++;
+  }
+}
+
+bool CommandDecoderClass::consume(char c) {
+  skipWhitespace();
+
+  if (_pos < _end && *_pos == c) {
+    _pos++;
+    return true;
+  }
+
+  return false;
+}
+
+bool CommandDecoderClass::parseString(const char *&start, size_t &length) {
+  if (!consume('"')) {
+    return false;
+  }
+
+  start = _pos;
+  while (_pos < _end && *_pos != '"') {
+    if (*_pos == '\\' && _pos + 1 < _end) {
+      _pos++; // Skip the escaped character
+    }
+    _pos++;
+  }
+
+  if (_pos >= _end) {
+    return false;
+  }
+
+  length = _pos - start;
+  _pos++; // Closing quote
+
+  return true;
+}
+
+bool CommandDecoderClass::parseNumber(uint32_t &milli, bool &negative) {
+  uint32_t integer = 0;
+  uint32_t fraction = 0;
+  uint32_t scale = 100;
+  bool digits = false;
+
+  skipWhitespace();
+
+  negative = (_pos < _end && *_pos == '-');
+  if (negative) {
+    _pos++;
+  }
+
+  while (_pos < _end && *_pos >= '0' && *_pos <= '9') {
+    integer = integer * 10 + (*_pos - '0');
+
+    // Saturate rather than overflow (such values are out of range anyway)
+    if (integer > 1000000UL) {
+      integer = 1000000UL;
+    }
+    digits = true;
+    _pos++;
+  }
+
+  if (_pos < _end && *_pos == '.') {
+    _pos++;
+    while (_pos < _end && *_pos >= '0' && *_pos <= '9') {
+      fraction += (*_pos - '0') * scale;
+      scale /= 10;
+      digits = true;
+      _pos++;
+    }
+  }
+
+  // Exponents are not used by any client, so are not supported
+  if (!digits || (_pos < _end && (*_pos == 'e' || *_pos == 'E'))) {
+    return false;
+  }
+
+  milli = integer * 1000 + fraction;
+
+  return true;
+}
+
+bool CommandDecoderClass::parseValue(uint32_t max, uint32_t &milli,
+                                     command_result_t &result) {
+  bool negative;
+
+  // Numbers may be quoted, as sent by the sliders of the web interface
+  bool quoted = consume('"');
+
+  if (!parseNumber(milli, negative) || (quoted && !consume('"'))) {
+    return false;
+  }
+
+  if (negative || milli > max * 1000) {
+    result = COMMAND_ERROR_RANGE;
+    return false;
+  }
+
+  return true;
+}
+
+bool CommandDecoderClass::parseBool(bool &value) {
+  skipWhitespace();
+
+  size_t available = _end - _pos;
+  if (available >= 4 && memcmp(_pos, "true", 4) == 0) {
+    _pos += 4;
+    value = true;
+    return true;
+  }
+
+  if (available >= 5 && memcmp(_pos, "false", 5) == 0) {
+    _pos += 5;
+    value = false;
+    return true;
+  }
+
+  // Numbers are accepted as well (zero being false)
+  uint32_t milli;
+  bool negative;
+  if (parseNumber(milli, negative)) {
+    value = (milli != 0);
+    return true;
+  }
+
+  return false;
+}
+
+bool CommandDecoderClass::parseColor(light_command_t &command,
+                                     command_result_t &result) {
+  Color &color = command.color;
+  uint32_t value;
+
+  // Hue/saturation and CIE xy (in thousandths), converted once complete
+  uint32_t hs[2] = {0, 0};
+  uint32_t xy[2] = {0, 0};
+  bool has_hs = false;
+  bool has_xy = false;
+
+  color.red = color.green = color.blue = 0;
+
+  if (!consume('{')) {
+    return false;
+  }
+
+  if (consume('}')) {
+    return true;
+  }
+
+  do {
+    const char *key;
+    size_t key_length;
+
+    if (!parseString(key, key_length) || !consume(':')) {
+      return false;
+    }
+
+    if (equals(key, key_length, COMMAND_KEY_COLOR_R)) {
+      if (!parseValue(COMMAND_LEVEL_MAX, value, result)) {
+        return false;
+      }
+      color.red = value / 1000;
+    } else if (equals(key, key_length, COMMAND_KEY_COLOR_G)) {
+      if (!parseValue(COMMAND_LEVEL_MAX, value, result)) {
+        return false;
+      }
+      color.green = value / 1000;
+    } else if (equals(key, key_length, COMMAND_KEY_COLOR_B)) {
+      if (!parseValue(COMMAND_LEVEL_MAX, value, result)) {
+        return false;
+      }
+      color.blue = value / 1000;
+    } else if (equals(key, key_length, COMMAND_KEY_COLOR_W)) {
+      if (!parseValue(COMMAND_LEVEL_MAX, value, result)) {
+        return false;
+      }
+      color.white = value / 1000;
+      command.fields |= COMMAND_WHITE;
+    } else if (equals(key, key_length, COMMAND_KEY_COLOR_H)) {
+      if (!parseValue(COMMAND_HUE_MAX, hs[0], result)) {
+        return false;
+      }
+      has_hs = true;
+    } else if (equals(key, key_length, COMMAND_KEY_COLOR_S)) {
+      if (!parseValue(COMMAND_SATURATION_MAX, hs[1], result)) {
+        return false;
+      }
+      has_hs = true;
+    } else if (equals(key, key_length, COMMAND_KEY_COLOR_X)) {
+      if (!parseValue(COMMAND_XY_MAX, xy[0], result)) {
+        return false;
+      }
+      has_xy = true;
+    } else if (equals(key, key_length, COMMAND_KEY_COLOR_Y)) {
+      if (!parseValue(COMMAND_XY_MAX, xy[1], result)) {
+        return false;
+      }
+      has_xy = true;
+    } else if (!skipValue(2)) {
+      return false;
+    }
+  } while (consume(','));
+
+  // Hue/saturation and CIE xy colours include the white level
+  if (has_hs) {
+    command.color = ColorSpaceClass::hs2RGBW(hs[0], hs[1]);
+    command.fields |= COMMAND_WHITE;
+  } else if (has_xy) {
+    command.color = ColorSpaceClass::xy2RGBW(xy[0], xy[1]);
+    command.fields |= COMMAND_WHITE;
+  }
+
+  return consume('}');
+}
+
+bool CommandDecoderClass::parseColorArray(Color &color,
+                                          command_result_t &result) {
+  uint8_t *levels[3] = {&color.red, &color.green, &color.blue};
+  uint32_t value;
+
+  if (!consume('[')) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if ((i > 0 && !consume(',')) ||
+        !parseValue(COMMAND_LEVEL_MAX, value, result)) {
+      return false;
+    }
+    *levels[i] = value / 1000;
+  }
+
+  return consume(']');
+}
+
+bool CommandDecoderClass::parseEffect(uint8_t &effect,
+                                      command_result_t &result) {
+  const char *name;
+  size_t length;
+
+  if (!parseString(name, length)) {
+    return false;
+  }
+
+  if (!SequencerClass::findEffect(name, length, effect)) {
+    result = COMMAND_ERROR_RANGE;
+    return false;
+  }
+
+  return true;
+}
+
+bool CommandDecoderClass::parseProgram(command_result_t &result) {
+  const char *hex;
+  size_t length;
+
+  if (!parseString(hex, length)) {
+    return false;
+  }
+
+  if (length % 2 != 0 || length / 2 > sizeof(_program)) {
+    result = COMMAND_ERROR_RANGE;
+    return false;
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    char c = hex[i];
+    uint8_t nibble;
+
+    if (c >= '0' && c <= '9') {
+      nibble = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      nibble = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      nibble = c - 'A' + 10;
+    } else {
+      return false;
+    }
+
+    if (i % 2 == 0) {
+      _program[i / 2] = nibble << 4;
+    } else {
+      _program[i / 2] |= nibble;
+    }
+  }
+
+  _program_length = length / 2;
+
+  if (!SequencerClass::validate(_program, _program_length)) {
+    result = COMMAND_ERROR_RANGE;
+    return false;
+  }
+
+  return true;
+}
+
+bool CommandDecoderClass::skipValue(uint8_t depth) {
+  if (depth >= COMMAND_MAX_DEPTH) {
+    return false;
+  }
+
+  skipWhitespace();
+  if (_pos >= _end) {
+    return false;
+  }
+
+  const char *start;
+  size_t length;
+
+  switch (*_pos) {
+  case '"':
+    return parseString(start, length);
+
+  case '{':
+    _pos++;
+    if (consume('}')) {
+      return true;
+    }
+
+    do {
+      if (!parseString(start, length) || !consume(':') ||
+          !skipValue(depth + 1)) {
+        return false;
+      }
+    } while (consume(','));
+
+    return consume('}');
+
+  case '[':
+    _pos++;
+    if (consume(']')) {
+      return true;
+    }
+
+    do {
+      if (!skipValue(depth + 1)) {
+        return false;
+      }
+    } while (consume(','));
+
+    return consume(']');
+
+  default:
+    // Numbers and literals (true, false, null)
+    start = _pos;
+    while (_pos < _end && *_pos != ',' && *_pos != '}' && *_pos != ']' &&
+           *_pos != ' ' && *_pos != '\t' && *_pos != '\r' && *_pos != '\n') {
+      _pos++;
+    }
+
+    return _pos > start;
+  }
+}
+
+bool CommandDecoderClass::equals(const char *start, size_t length,
+                                 const char *key) {
+  return strlen(key) == length && memcmp(start, key, length) == 0;
+}
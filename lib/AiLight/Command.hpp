@@ -0,0 +1,186 @@
+/**
+ * AiLight Library - Command Decoder
+ *
+ * The command decoder parses the JSON commands for the light (as received via
+ * MQTT, the REST API and WebSocket) into a typed command structure. It only
+ * knows the fixed set of light attributes, decodes in place from the buffer of
+ * the transport (which does not need to be NUL terminated) and does not
+ * allocate any memory. Colours given as hue and saturation or as CIE xy
+ * chromaticity (the colour modes of Home Assistant) are converted into RGBW
+ * levels (see ColorSpace.hpp).
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Command_h
+#define AiLight_Command_h
+
+#include "Color.hpp"
+#include "ColorSpace.hpp"
+#include "Sequencer.hpp"
+#include <stddef.h>
+
+// Key names of the light attributes
+#define COMMAND_KEY_STATE "state"
+#define COMMAND_KEY_BRIGHTNESS "brightness"
+#define COMMAND_KEY_COLOR "color"
+#define COMMAND_KEY_COLOR_R "r"
+#define COMMAND_KEY_COLOR_G "g"
+#define COMMAND_KEY_COLOR_B "b"
+#define COMMAND_KEY_COLOR_W "w"
+#define COMMAND_KEY_COLOR_H "h"
+#define COMMAND_KEY_COLOR_S "s"
+#define COMMAND_KEY_COLOR_X "x"
+#define COMMAND_KEY_COLOR_Y "y"
+#define COMMAND_KEY_WHITE "white_value"
+#define COMMAND_KEY_COLORTEMP "color_temp"
+#define COMMAND_KEY_FLASH "flash"
+#define COMMAND_KEY_TRANSITION "transition"
+#define COMMAND_KEY_GAMMA "gamma"
+#define COMMAND_KEY_EFFECT "effect"
+#define COMMAND_KEY_PROGRAM "program"
+
+// Flags indicating the attributes present in a command
+#define COMMAND_STATE 0x0001
+#define COMMAND_BRIGHTNESS 0x0002
+#define COMMAND_COLOR 0x0004
+#define COMMAND_WHITE 0x0008
+#define COMMAND_COLOR_TEMP 0x0010
+#define COMMAND_FLASH 0x0020
+#define COMMAND_TRANSITION 0x0040
+#define COMMAND_GAMMA 0x0080
+#define COMMAND_EFFECT 0x0100
+#define COMMAND_PROGRAM 0x0200 // Uploaded effect program (see getProgram())
+#define COMMAND_OTHER 0x8000 // Any other key (e.g. settings)
+
+// Valid ranges of the light attributes
+#define COMMAND_LEVEL_MAX 255         // Brightness and colour channels
+#define COMMAND_COLOR_TEMP_MAX 1000   // Colour temperature (in mired)
+#define COMMAND_HUE_MAX 360           // Hue (in degrees)
+#define COMMAND_SATURATION_MAX 100    // Saturation (in percents)
+#define COMMAND_XY_MAX 1              // CIE xy chromaticity coordinates
+#define COMMAND_FLASH_MAX 3600        // Flash length (in seconds)
+#define COMMAND_TRANSITION_MAX 3600UL // Transition time (in seconds)
+
+// Maximum nesting depth of a command (the command itself being at depth 0),
+// deeper values are not skipped but rejected
+#define COMMAND_MAX_DEPTH 8
+
+// Result of decoding a command
+enum command_result_t : uint8_t {
+  COMMAND_OK = 0,           // Command decoded successfully
+  COMMAND_ERROR_SYNTAX = 1, // Malformed JSON (or unexpected value type)
+  COMMAND_ERROR_RANGE = 2   // Value out of the valid range
+};
+
+// A decoded light command
+struct light_command_t {
+  uint16_t fields;     // Attributes present (COMMAND_* flags)
+  bool state;          // Operational state (true == on)
+  uint8_t brightness;  // Brightness level
+  Color color;         // RGB (COMMAND_COLOR) and white (COMMAND_WHITE) levels
+  uint16_t color_temp; // Colour temperature (in mired)
+  uint16_t flash;      // Flash length (in seconds)
+  uint32_t transition; // Transition time (in milliseconds)
+  bool gamma;          // Gamma Correction enabled or not
+  uint8_t effect;      // Effect to run (effect_t)
+};
+
+class CommandDecoderClass {
+public:
+  /**
+   * @brief Creates a command decoder
+   *
+   * @param payload_on the value of the state attribute for switching on
+   * @param color_array_key the key name of the colour array attribute (as
+   * used by openHAB), or NULL to not support colour arrays
+   */
+  CommandDecoderClass(const char *payload_on, const char *color_array_key);
+
+  /**
+   * @brief Decodes a JSON command
+   *
+   * @param data the JSON command (does not need to be NUL terminated)
+   * @param length the length of the JSON command
+   * @param command the structure to hold the decoded command
+   *
+   * @return COMMAND_OK if successful, otherwise the reason of failure
+   */
+  command_result_t decode(const char *data, size_t length,
+                          light_command_t &command);
+
+  /**
+   * @brief Splits a JSON array of commands (e.g. a batch of the REST API) into
+   * the commands, without decoding them
+   *
+   * @param data the JSON array (does not need to be NUL terminated)
+   * @param length the length of the JSON array
+   * @param commands the array to hold the start of each command
+   * @param lengths the array to hold the length of each command
+   * @param max the maximum number of commands
+   * @param count the variable to hold the number of commands
+   *
+   * @return COMMAND_OK if successful, COMMAND_ERROR_RANGE if there are more
+   * than the maximum number of commands, otherwise COMMAND_ERROR_SYNTAX
+   */
+  command_result_t split(const char *data, size_t length,
+                         const char **commands, size_t *lengths, uint8_t max,
+                         uint8_t &count);
+
+  /**
+   * @brief Returns the effect program of the last decoded command
+   *
+   * Only valid if the command has the COMMAND_PROGRAM flag set, and until the
+   * next command is decoded.
+   *
+   * @param length the length of the program
+   *
+   * @return the (validated) effect program
+   */
+  const uint8_t *getProgram(size_t &length);
+
+private:
+  const char *_payload_on;
+  const char *_color_array_key;
+
+  // Effect program of the last decoded command (decoded from hexadecimal)
+  uint8_t _program[SEQUENCER_PROGRAM_MAX];
+  size_t _program_length = 0;
+
+  // Current position and end of the data being decoded
+  const char *_pos;
+  const char *_end;
+
+  void skipWhitespace(void);
+
+  // Consumes the given character (after any whitespace) if present
+  bool consume(char c);
+
+  // Parses a string, returning the (raw) contents between the quotes
+  bool parseString(const char *&start, size_t &length);
+
+  // Parses a non-negative number in thousandths (i.e. 1.5 becomes 1500)
+  bool parseNumber(uint32_t &milli, bool &negative);
+
+  // Parses a (possibly quoted) number and checks it against the given maximum
+  bool parseValue(uint32_t max, uint32_t &milli, command_result_t &result);
+
+  bool parseBool(bool &value);
+  bool parseColor(light_command_t &command, command_result_t &result);
+  bool parseColorArray(Color &color, command_result_t &result);
+  bool parseEffect(uint8_t &effect, command_result_t &result);
+  bool parseProgram(command_result_t &result);
+
+  // Skips any value at the given depth (up to COMMAND_MAX_DEPTH levels deep)
+  bool skipValue(uint8_t depth);
+
+  static bool equals(const char *start, size_t length, const char *key);
+};
+
+#endif
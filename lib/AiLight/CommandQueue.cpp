@@ -0,0 +1,155 @@
+/**
+ * AiLight Library - Command Queue
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "CommandQueue.hpp"
+
+bool CommandQueueClass::push(const light_command_t &command, uint32_t now) {
+  uint8_t tail = _tail;
+  uint8_t depth = tail - __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+
+  if (depth >= COMMAND_QUEUE_SIZE) {
+    _dropped++;
+    return false;
+  }
+
+  queued_command_t &entry = _entries[tail & (COMMAND_QUEUE_SIZE - 1)];
+  entry.command = command;
+  entry.time = now;
+
+  // Publish the entry only once it has been written completely
+  __atomic_store_n(&_tail, (uint8_t)(tail + 1), __ATOMIC_RELEASE);
+
+  _queued++;
+  if (depth + 1 > _max_depth) {
+    _max_depth = depth + 1;
+  }
+
+  return true;
+}
+
+bool CommandQueueClass::pop(light_command_t &command, uint32_t now,
+                            uint8_t budget) {
+  uint8_t head = _head;
+  uint8_t tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+
+  if (head == tail || budget == 0) {
+    return false;
+  }
+
+  const queued_command_t *entry = &_entries[head & (COMMAND_QUEUE_SIZE - 1)];
+  command = entry->command;
+  head++;
+
+  // The latency of the oldest command taken
+  _latency = now - entry->time;
+  if (_latency > _max_latency) {
+    _max_latency = _latency;
+  }
+
+  while (head != tail && --budget > 0) {
+    entry = &_entries[head & (COMMAND_QUEUE_SIZE - 1)];
+    if (!merge(command, entry->command)) {
+      break;
+    }
+
+    head++;
+    _coalesced++;
+  }
+
+  // Release the entries taken to the producer
+  __atomic_store_n(&_head, head, __ATOMIC_RELEASE);
+
+  return true;
+}
+
+bool CommandQueueClass::merge(light_command_t &into,
+                              const light_command_t &next) {
+  // A colour temperature is applied after the colour levels of a command, so
+  // would overrule the levels of the next command
+  if ((into.fields & COMMAND_COLOR_TEMP) &&
+      (next.fields & (COMMAND_COLOR | COMMAND_WHITE)) &&
+      !(next.fields & COMMAND_COLOR_TEMP)) {
+    return false;
+  }
+
+  uint16_t changes = into.fields & (COMMAND_STATE | COMMAND_LEVELS);
+  if (into.fields & COMMAND_MODIFIERS) {
+    // The next command stops the flash, transition or effect of the
+    // preceding command where it started, so the changes of the preceding
+    // command only merge if the next command makes them again
+    if (changes & ~next.fields) {
+      return false;
+    }
+  } else if ((next.fields & COMMAND_MODIFIERS) && changes) {
+    // A flash, transition or effect starts from the levels set by the
+    // preceding command (e.g. a colour set at once isn't to be faded)
+    return false;
+  }
+
+  // Changing any level of the next command switches the light back on
+  if ((into.fields & COMMAND_STATE) && !(next.fields & COMMAND_STATE) &&
+      (next.fields & COMMAND_LEVELS)) {
+    into.state = true;
+  }
+
+  // A flash, transition or effect only applies to the command it is part of
+  into.fields = (into.fields & ~COMMAND_MODIFIERS) | next.fields;
+
+  if (next.fields & COMMAND_STATE) {
+    into.state = next.state;
+  }
+
+  if (next.fields & COMMAND_BRIGHTNESS) {
+    into.brightness = next.brightness;
+  }
+
+  if (next.fields & COMMAND_COLOR) {
+    into.color.red = next.color.red;
+    into.color.green = next.color.green;
+    into.color.blue = next.color.blue;
+  }
+
+  if (next.fields & COMMAND_WHITE) {
+    into.color.white = next.color.white;
+  }
+
+  if (next.fields & COMMAND_COLOR_TEMP) {
+    into.color_temp = next.color_temp;
+  }
+
+  into.flash = next.flash;
+  into.transition = next.transition;
+  into.effect = next.effect;
+
+  if (next.fields & COMMAND_GAMMA) {
+    into.gamma = next.gamma;
+  }
+
+  return true;
+}
+
+uint8_t CommandQueueClass::getDepth(void) {
+  return __atomic_load_n(&_tail, __ATOMIC_ACQUIRE) -
+         __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+}
+
+uint8_t CommandQueueClass::getMaxDepth(void) { return _max_depth; }
+
+uint32_t CommandQueueClass::getQueued(void) { return _queued; }
+
+uint32_t CommandQueueClass::getCoalesced(void) { return _coalesced; }
+
+uint32_t CommandQueueClass::getDropped(void) { return _dropped; }
+
+uint32_t CommandQueueClass::getLatency(void) { return _latency; }
+
+uint32_t CommandQueueClass::getMaxLatency(void) { return _max_latency; }
@@ -0,0 +1,161 @@
+/**
+ * AiLight Library - Command Queue
+ *
+ * The command queue decouples the network callbacks (MQTT, REST API and
+ * WebSocket) from rendering the light. Decoded commands are queued by the
+ * network callbacks and are processed by the main loop. The queue is a
+ * lock-free ring buffer for a single producer (the network stack) and a single
+ * consumer (the main loop). Commands that are queued while the main loop is
+ * busy are merged, so only the latest target of each attribute is applied.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_CommandQueue_h
+#define AiLight_CommandQueue_h
+
+#include "Command.hpp"
+
+// Number of commands the queue can hold (a power of two, at most 128)
+#ifndef COMMAND_QUEUE_SIZE
+#define COMMAND_QUEUE_SIZE 8
+#endif
+
+#if (COMMAND_QUEUE_SIZE & (COMMAND_QUEUE_SIZE - 1)) != 0 ||                   \
+    COMMAND_QUEUE_SIZE > 128
+#error "COMMAND_QUEUE_SIZE must be a power of two, at most 128"
+#endif
+
+// Attributes that switch on the light when changed
+#define COMMAND_LEVELS                                                         \
+  (COMMAND_BRIGHTNESS | COMMAND_COLOR | COMMAND_WHITE | COMMAND_COLOR_TEMP |   \
+   COMMAND_GAMMA)
+
+// Attributes that only apply to the command they are part of (a command
+// without them stops a flash, transition or effect)
+#define COMMAND_MODIFIERS (COMMAND_FLASH | COMMAND_TRANSITION | COMMAND_EFFECT)
+
+// A queued command
+struct queued_command_t {
+  light_command_t command;
+  uint32_t time; // Time (in microseconds) the command has been queued
+};
+
+class CommandQueueClass {
+public:
+  /**
+   * @brief Queues a command (producer side)
+   *
+   * @param command the command to queue
+   * @param now the current (monotonic) time in microseconds
+   *
+   * @return true if the command has been queued, false if the queue is full
+   */
+  bool push(const light_command_t &command, uint32_t now);
+
+  /**
+   * @brief Takes the queued commands, merged into a single command (consumer
+   * side)
+   *
+   * Commands are merged until the budget is reached or a command can't be
+   * merged with the preceding ones. The remaining commands are left for the
+   * next call.
+   *
+   * @param command the structure to hold the (merged) command
+   * @param now the current (monotonic) time in microseconds
+   * @param budget the maximum number of queued commands to take
+   *
+   * @return true if a command has been taken, false if the queue is empty
+   */
+  bool pop(light_command_t &command, uint32_t now, uint8_t budget);
+
+  /**
+   * @brief Merges a command into a preceding command
+   *
+   * The result has the same effect as processing both commands in order (at
+   * the same time). Commands with a flash, transition or effect only merge if
+   * the preceding command sets no levels, or if its flash, transition or
+   * effect is stopped by the next command and all its levels are set again.
+   *
+   * @param into the preceding command, holding the result
+   * @param next the command following the preceding command
+   *
+   * @return true if the commands have been merged, false if they can't be
+   */
+  static bool merge(light_command_t &into, const light_command_t &next);
+
+  /**
+   * @brief Returns the number of commands currently queued
+   *
+   * @return the number of commands currently queued
+   */
+  uint8_t getDepth(void);
+
+  /**
+   * @brief Returns the largest number of commands queued at the same time
+   *
+   * @return the largest number of commands queued at the same time
+   */
+  uint8_t getMaxDepth(void);
+
+  /**
+   * @brief Returns the number of commands queued since boot
+   *
+   * @return the number of commands queued since boot
+   */
+  uint32_t getQueued(void);
+
+  /**
+   * @brief Returns the number of commands merged into a preceding command
+   *
+   * @return the number of commands merged into a preceding command
+   */
+  uint32_t getCoalesced(void);
+
+  /**
+   * @brief Returns the number of commands rejected as the queue was full
+   *
+   * @return the number of commands rejected as the queue was full
+   */
+  uint32_t getDropped(void);
+
+  /**
+   * @brief Returns the time the last command taken has been queued for
+   *
+   * @return the time (in microseconds) the last command has been queued for
+   */
+  uint32_t getLatency(void);
+
+  /**
+   * @brief Returns the longest time a command has been queued for
+   *
+   * @return the longest time (in microseconds) a command has been queued for
+   */
+  uint32_t getMaxLatency(void);
+
+private:
+  queued_command_t _entries[COMMAND_QUEUE_SIZE];
+
+  // Free running indices (the producer only writes _tail, the consumer only
+  // writes _head)
+  uint8_t _head = 0; // Next command to take
+  uint8_t _tail = 0; // Next free entry
+
+  // Statistics (producer side)
+  uint8_t _max_depth = 0;
+  uint32_t _queued = 0;
+  uint32_t _dropped = 0;
+
+  // Statistics (consumer side)
+  uint32_t _coalesced = 0;
+  uint32_t _latency = 0;
+  uint32_t _max_latency = 0;
+};
+
+#endif
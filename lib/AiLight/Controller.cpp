@@ -0,0 +1,252 @@
+/**
+ * AiLight Library - Light Controller
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "Controller.hpp"
+
+LightControllerClass::LightControllerClass(SequencerClass &sequencer,
+                                           TransitionClass &transition,
+                                           RealtimeClass &realtime,
+                                           easing_t easing)
+    : _sequencer(sequencer), _transition(transition), _realtime(realtime),
+      _easing(easing) {}
+
+void LightControllerClass::begin(AiLightClass *light) { _light = light; }
+
+bool LightControllerClass::process(const light_command_t &command,
+                                   uint32_t now) {
+  bool started = true;
+
+  // Collect all changes and render them as a single frame
+  _light->begin();
+
+  // Any command ends a running effect (or flash) or realtime stream
+  if (_sequencer.isRunning() || _realtime.isActive()) {
+    _sequencer.stop();
+    _realtime.stop();
+    _light->apply(_saved, _saved_state);
+  }
+
+  // Store an uploaded effect program
+  if (command.fields & COMMAND_PROGRAM) {
+    _sequencer.take();
+  }
+
+  bool effect = (command.fields & COMMAND_EFFECT) &&
+                (command.effect != EFFECT_NONE);
+
+  // Flash
+  Frame flashFrame;
+  if (command.fields & COMMAND_FLASH) {
+
+    // Save current settings to be restored later
+    save();
+
+    flashFrame.brightness = (command.fields & COMMAND_BRIGHTNESS)
+                                ? command.brightness
+                                : _saved.brightness;
+
+    flashFrame.color =
+        (command.fields & COMMAND_COLOR) ? command.color : _saved.color;
+    flashFrame.color.white = _saved.color.white;
+
+    flashFrame.color.red =
+        map(flashFrame.color.red, 0, 255, 0, flashFrame.brightness);
+    flashFrame.color.green =
+        map(flashFrame.color.green, 0, 255, 0, flashFrame.brightness);
+    flashFrame.color.blue =
+        map(flashFrame.color.blue, 0, 255, 0, flashFrame.brightness);
+
+    effect = true;
+  }
+
+  // A flash/effect takes the place of a transition
+  uint32_t transitionTime =
+      ((command.fields & COMMAND_TRANSITION) && !effect) ? command.transition
+                                                           : 0;
+
+  // The levels the transition/fade starts from and ends with
+  Frame transFrom = {_light->getColor(), _light->getBrightness()};
+  Frame transTo = transFrom;
+
+  if (transitionTime > 0) {
+    _state = true;
+
+    // If light is off, start fading from Zero
+    if (!_light->getState()) {
+      transFrom.brightness = 0;
+    }
+  }
+
+  if (command.fields & COMMAND_BRIGHTNESS) {
+
+    // In transition/fade
+    if (transitionTime > 0) {
+      transTo.brightness = command.brightness;
+    } else {
+      _light->setBrightness(command.brightness);
+    }
+  }
+
+  // Colour (or colour array, as used by openHAB)
+  if (command.fields & COMMAND_COLOR) {
+
+    // In transition/fade
+    if (transitionTime > 0) {
+      transTo.color.red = command.color.red;
+      transTo.color.green = command.color.green;
+      transTo.color.blue = command.color.blue;
+    } else {
+      _light->setColor(command.color.red, command.color.green,
+                       command.color.blue);
+    }
+  }
+
+  if (command.fields & COMMAND_WHITE) {
+    // In transition/fade
+    if (transitionTime > 0) {
+      transTo.color.white = command.color.white;
+    } else {
+      _light->setWhite(command.color.white);
+    }
+  }
+
+  if (command.fields & COMMAND_COLOR_TEMP) {
+    // In transition/fade
+    if (transitionTime > 0) {
+      transTo.color = AiLightClass::colorTemperature2RGB(command.color_temp);
+    }
+
+    // Also saves the colour temperature setting. In a transition/fade these
+    // levels are overruled by the start of the transition below.
+    _light->setColorTemperature(command.color_temp);
+  }
+
+  // Applied before the state, as setting it switches on the light
+  if (command.fields & COMMAND_GAMMA) {
+    _light->useGammaCorrection(command.gamma);
+  }
+
+  if (command.fields & COMMAND_STATE) {
+    _state = command.state;
+
+    if (transitionTime > 0 && !_state) {
+      transTo.brightness = 0;
+    } else {
+      _light->setState(_state);
+    }
+  }
+
+  // Start the transition/fade; the levels are rendered by update()
+  if (transitionTime > 0) {
+    // When fading out, the light is switched off with its levels restored
+    _end = transTo;
+    if (!_state) {
+      _end.brightness = _light->getBrightness();
+    }
+
+    _light->apply(transFrom, true);
+
+    _transition.begin(transFrom, transTo, now, transitionTime, _easing);
+  } else {
+    _transition.stop();
+  }
+
+  // Start the flash/effect; the levels are rendered by update()
+  Frame current = {_light->getColor(), _light->getBrightness()};
+
+  if (command.fields & COMMAND_FLASH) {
+    // One on/off cycle per second
+    _sequencer.begin(EFFECT_FLASH, flashFrame, current, now, command.flash);
+  } else if (effect) {
+    // Save current settings to be restored once the effect is stopped
+    save();
+
+    started = _sequencer.begin(command.effect, current, current, now);
+  }
+
+  _light->commit();
+
+  return started;
+}
+
+uint8_t LightControllerClass::update(uint32_t now) {
+  uint8_t result = 0;
+
+  // Effects (including flash)
+  if (_sequencer.isRunning()) {
+    Frame frame;
+
+    // Only push levels to the LED driver when the output has changed
+    if (_sequencer.update(now, frame)) {
+      _light->apply(frame, true);
+      result |= CONTROLLER_RENDERED;
+    }
+
+    // Effect has ended
+    if (!_sequencer.isRunning()) {
+      // Return to the state before the effect (e.g. a flash)
+      if (_sequencer.restores()) {
+        _light->apply(_saved, _saved_state);
+      }
+
+      result |= CONTROLLER_SETTLED;
+    }
+  }
+
+  // Transitioning/Fading
+  if (_transition.isRunning()) {
+    Frame frame;
+
+    // Only push levels to the LED driver when the output has changed
+    if (_transition.update(now, frame)) {
+      _light->apply(frame, true);
+      result |= CONTROLLER_RENDERED;
+    }
+
+    // Transition/fade has finished
+    if (!_transition.isRunning()) {
+      _light->apply(_end, _state);
+
+      result |= CONTROLLER_SETTLED;
+    }
+  }
+
+  return result;
+}
+
+void LightControllerClass::suspend(void) {
+  // While an effect runs, the state to restore has been saved already
+  if (_sequencer.isRunning()) {
+    _sequencer.stop();
+  } else if (_transition.isRunning()) {
+    _transition.stop();
+
+    _saved = _end;
+    _saved_state = _state;
+  } else {
+    save();
+  }
+}
+
+void LightControllerClass::resume(void) { _light->apply(_saved, _saved_state); }
+
+bool LightControllerClass::getSaved(Frame &frame) {
+  frame = _saved;
+
+  return _saved_state;
+}
+
+void LightControllerClass::save(void) {
+  _saved.color = _light->getColor();
+  _saved.brightness = _light->getBrightness();
+  _saved_state = _light->getState();
+}
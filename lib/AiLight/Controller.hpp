@@ -0,0 +1,122 @@
+/**
+ * AiLight Library - Light Controller
+ *
+ * The light controller applies decoded light commands to the light: it sets
+ * the levels right away, or starts a transition, flash or effect, and renders
+ * these on each iteration of the main loop. It keeps the state the light
+ * returns to once a flash, effect or realtime stream has ended. Time is passed
+ * in by the caller, so the same code can be run on a simulated clock on the
+ * host (e.g. to replay recorded commands).
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Controller_h
+#define AiLight_Controller_h
+
+#include "AiLight.hpp"
+#include "Command.hpp"
+#include "Realtime.hpp"
+#include "Sequencer.hpp"
+#include "Transition.hpp"
+
+// Results of updating the light (see update())
+#define CONTROLLER_RENDERED 0x01 // A frame has been rendered
+#define CONTROLLER_SETTLED 0x02  // An effect or transition has ended
+
+class LightControllerClass {
+public:
+  /**
+   * @brief Creates a light controller
+   *
+   * @param sequencer the sequencer running the flashes and effects
+   * @param transition the transition engine
+   * @param realtime the realtime stream (ended by any command)
+   * @param easing the easing curve of transitions
+   */
+  LightControllerClass(SequencerClass &sequencer, TransitionClass &transition,
+                       RealtimeClass &realtime, easing_t easing);
+
+  /**
+   * @brief Sets the light to control
+   *
+   * @param light the light
+   *
+   * @return void
+   */
+  void begin(AiLightClass *light);
+
+  /**
+   * @brief Applies a light command
+   *
+   * All changes are rendered as a single frame. An uploaded effect program
+   * (COMMAND_PROGRAM) is taken from the sequencer, so it has to be posted
+   * beforehand.
+   *
+   * @param command the light command
+   * @param now the current (monotonic) time in milliseconds
+   *
+   * @return false if the requested effect could not be started, otherwise
+   * true
+   */
+  bool process(const light_command_t &command, uint32_t now);
+
+  /**
+   * @brief Renders the running flash, effect or transition
+   *
+   * @param now the current (monotonic) time in milliseconds
+   *
+   * @return the result (CONTROLLER_* flags)
+   */
+  uint8_t update(uint32_t now);
+
+  /**
+   * @brief Saves the state to return to, and stops any effect or transition
+   * (e.g. when a realtime stream starts)
+   *
+   * @return void
+   */
+  void suspend(void);
+
+  /**
+   * @brief Returns the light to the saved state
+   *
+   * @return void
+   */
+  void resume(void);
+
+  /**
+   * @brief Returns the state the light returns to once a flash, effect or
+   * stream has ended
+   *
+   * @param frame the variable to hold the levels
+   *
+   * @return the operational state
+   */
+  bool getSaved(Frame &frame);
+
+private:
+  SequencerClass &_sequencer;
+  TransitionClass &_transition;
+  RealtimeClass &_realtime;
+  easing_t _easing;
+  AiLightClass *_light = nullptr;
+
+  // The state restored after a flash/effect/stream
+  Frame _saved = {{0, 0, 0, 0}, 0};
+  bool _saved_state = false;
+
+  // The state and levels to settle on once the transition has finished
+  bool _state = false;
+  Frame _end = {{0, 0, 0, 0}, 0};
+
+  void save(void);
+};
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * AiLight Library - Output Curves
+ *
+ * Generates the lookup tables that map 8-bit channel levels onto the output
+ * levels of the LED driver at compile time. A curve folds in the gamma
+ * correction and the output bit depth, so that rendering a frame only takes a
+ * table lookup, a multiplication and a shift per channel.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Curve_h
+#define AiLight_Curve_h
+
+#include <stdint.h>
+
+// Number of entries of a curve (one for each 8-bit input level)
+#define CURVE_SIZE 256
+
+// Structure holding the output levels for all 8-bit input levels
+struct Curve {
+  uint16_t levels[CURVE_SIZE];
+};
+
+// The functions below are evaluated by the compiler. C++11 only allows a
+// single return statement in a constexpr function, hence the recursion.
+
+constexpr double curveSquare(double value) { return value * value; }
+
+// Taylor series of e^x, accurate for small values of x
+constexpr double curveExpSeries(double x, double term, uint8_t n) {
+  return n > 16 ? term : term + curveExpSeries(x, term * x / (n + 1), n + 1);
+}
+
+// e^x for x <= 0, halving x until the series converges quickly
+constexpr double curveExp(double x) {
+  return x < -0.5 ? curveSquare(curveExp(x / 2)) : curveExpSeries(x, 1, 0);
+}
+
+// Series of ln(x) = 2 * atanh((x - 1) / (x + 1))
+constexpr double curveLogSeries(double y2, double power, uint8_t k) {
+  return k > 16 ? 0
+                : power / (2 * k + 1) + curveLogSeries(y2, power * y2, k + 1);
+}
+
+// ln(x) for 0 < x <= 1, doubling x until it is at least 0.5
+constexpr double curveLog(double x) {
+  return x < 0.5 ? curveLog(x * 2) - 0.69314718055994531
+                 : 2 * curveLogSeries(curveSquare((x - 1) / (x + 1)),
+                                      (x - 1) / (x + 1), 0);
+}
+
+/**
+ * @brief Calculates the output level of a curve for the given input level
+ *
+ * @param level the 8-bit input level
+ * @param gamma the gamma correction factor multiplied by 10 (e.g. 28 for 2.8)
+ * @param bits the output bit depth
+ *
+ * @return the (rounded) output level
+ */
+constexpr uint16_t curveLevel(uint16_t level, uint8_t gamma, uint8_t bits) {
+  return level == 0 ? 0
+                    : (uint16_t)(curveExp(curveLog(level / 255.0) * gamma /
+                                          10.0) *
+                                     ((1UL << bits) - 1) +
+                                 0.5);
+}
+
+// Compile-time sequence of the indices 0 .. N - 1
+template <uint16_t... I> struct CurveIndices {};
+
+template <uint16_t N, uint16_t... I>
+struct CurveIndexSequence : CurveIndexSequence<N - 1, N - 1, I...> {};
+
+template <uint16_t... I> struct CurveIndexSequence<0, I...> {
+  typedef CurveIndices<I...> type;
+};
+
+template <uint8_t GAMMA, uint8_t BITS, uint16_t... I>
+constexpr Curve generateCurve(CurveIndices<I...>) {
+  return Curve{{curveLevel(I, GAMMA, BITS)...}};
+}
+
+/**
+ * @brief Generates a curve at compile time
+ *
+ * @tparam GAMMA the gamma correction factor multiplied by 10 (e.g. 28 for 2.8,
+ * 10 for a linear curve)
+ * @tparam BITS the output bit depth (8, 12, 14 or 16)
+ *
+ * @return the generated curve
+ */
+template <uint8_t GAMMA, uint8_t BITS> constexpr Curve generateCurve() {
+  static_assert(BITS == 8 || BITS == 12 || BITS == 14 || BITS == 16,
+                "Output bit depth must be 8, 12, 14 or 16");
+
+  return generateCurve<GAMMA, BITS>(
+      typename CurveIndexSequence<CURVE_SIZE>::type());
+}
+
+/**
+ * @brief Calculates the factor to scale curve levels with for a brightness
+ *
+ * The factor is a Q0.16 fraction of the brightness level (range 0 - 255),
+ * where 255 maps onto exactly 1.0 (i.e. 65536).
+ *
+ * @param brightness the brightness level (range 0 - 255)
+ *
+ * @return the scaling factor
+ */
+inline uint32_t curveScale(uint8_t brightness) {
+  return (uint32_t)brightness * 257 + (brightness >> 7);
+}
+
+#endif
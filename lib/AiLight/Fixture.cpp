@@ -0,0 +1,192 @@
+/**
+ * AiLight Library - Fixture
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "Fixture.hpp"
+#include "AiLight.hpp"
+#include <stdio.h>
+#include <string.h>
+
+// Characters of the logical channels in a description (in fixture_channel_t
+// order)
+static const char CHANNEL_CHARS[FIXTURE_LOGICAL + 1] = "RGBWcw-";
+
+// Names of the MY92XX models (in my92xx_model_t order)
+static const char *const MODEL_NAMES[] = {"MY9291", "MY9231"};
+
+fixture_t FixtureClass::defaults(my92xx_model_t model, uint8_t chips) {
+  fixture_t fixture;
+  memset(&fixture, 0, sizeof(fixture));
+
+  fixture.magic = FIXTURE_MAGIC;
+  fixture.chains = 1;
+  fixture.chain[0] = {(uint8_t)model, chips, MY92XX_DI_PIN, MY92XX_DCKI_PIN};
+
+  // RGBW, the remaining channels output white as well (e.g. the second white
+  // LED channel of the AiLight)
+  static const uint8_t rgbw[] = {FIXTURE_RED, FIXTURE_GREEN, FIXTURE_BLUE,
+                                 FIXTURE_WHITE, FIXTURE_WHITE};
+  for (uint8_t i = 0; i < FIXTURE_CHANNELS_MAX; i++) {
+    fixture.map[i] = (i < sizeof(rgbw)) ? rgbw[i] : (uint8_t)FIXTURE_OFF;
+  }
+
+  if (!validate(fixture)) {
+    fixture.chain[0].chips = 1;
+  }
+
+  return fixture;
+}
+
+uint8_t FixtureClass::getChannels(const fixture_chain_t &chain) {
+  return chain.chips * ((chain.model == MY92XX_MODEL_MY9291) ? 4 : 3);
+}
+
+bool FixtureClass::validate(const fixture_t &fixture) {
+  if (fixture.magic != FIXTURE_MAGIC || fixture.chains == 0 ||
+      fixture.chains > FIXTURE_CHAINS_MAX) {
+    return false;
+  }
+
+  uint8_t channels = 0;
+  for (uint8_t i = 0; i < fixture.chains; i++) {
+    const fixture_chain_t &chain = fixture.chain[i];
+
+    if (chain.model > MY92XX_MODEL_MY9231 || chain.chips == 0 ||
+        chain.di_pin > FIXTURE_PIN_MAX || chain.dcki_pin > FIXTURE_PIN_MAX ||
+        chain.di_pin == chain.dcki_pin) {
+      return false;
+    }
+
+    // Chains can't share pins
+    for (uint8_t j = 0; j < i; j++) {
+      const fixture_chain_t &other = fixture.chain[j];
+      if (chain.di_pin == other.di_pin || chain.di_pin == other.dcki_pin ||
+          chain.dcki_pin == other.di_pin || chain.dcki_pin == other.dcki_pin) {
+        return false;
+      }
+    }
+
+    channels += getChannels(chain);
+  }
+
+  if (channels > FIXTURE_CHANNELS_MAX) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < channels; i++) {
+    if (fixture.map[i] >= FIXTURE_LOGICAL) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool FixtureClass::parse(const char *description, fixture_t &fixture) {
+  memset(&fixture, 0, sizeof(fixture));
+  fixture.magic = FIXTURE_MAGIC;
+
+  const char *p = description;
+  uint8_t channels = 0;
+
+  while (fixture.chains < FIXTURE_CHAINS_MAX) {
+    fixture_chain_t &chain = fixture.chain[fixture.chains];
+
+    // Model
+    bool found = false;
+    for (uint8_t i = 0; i <= MY92XX_MODEL_MY9231; i++) {
+      size_t length = strlen(MODEL_NAMES[i]);
+
+      if (strncmp(p, MODEL_NAMES[i], length) == 0) {
+        chain.model = i;
+        p += length;
+        found = true;
+        break;
+      }
+    }
+
+    // Number of chips and pins
+    unsigned int chips, di_pin, dcki_pin;
+    int length = 0;
+    if (!found ||
+        sscanf(p, "x%u@%u,%u:%n", &chips, &di_pin, &dcki_pin, &length) != 3 ||
+        length == 0 || chips == 0 || chips > FIXTURE_CHANNELS_MAX ||
+        di_pin > FIXTURE_PIN_MAX || dcki_pin > FIXTURE_PIN_MAX) {
+      return false;
+    }
+    p += length;
+
+    chain.chips = chips;
+    chain.di_pin = di_pin;
+    chain.dcki_pin = dcki_pin;
+    fixture.chains++;
+
+    // Map (a character for each physical channel of the chain)
+    uint8_t end = channels + getChannels(chain);
+    if (end > FIXTURE_CHANNELS_MAX) {
+      return false;
+    }
+
+    for (; channels < end; channels++, p++) {
+      const char *c = (*p != '\0') ? strchr(CHANNEL_CHARS, *p) : NULL;
+      if (c == NULL) {
+        return false;
+      }
+
+      fixture.map[channels] = c - CHANNEL_CHARS;
+    }
+
+    if (*p == '\0') {
+      return validate(fixture);
+    }
+
+    if (*p++ != ';') {
+      return false;
+    }
+  }
+
+  return false;
+}
+
+size_t FixtureClass::format(const fixture_t &fixture, char *buffer,
+                            size_t size) {
+  if (!validate(fixture)) {
+    return 0;
+  }
+
+  size_t length = 0;
+  uint8_t channels = 0;
+
+  for (uint8_t i = 0; i < fixture.chains; i++) {
+    const fixture_chain_t &chain = fixture.chain[i];
+
+    int written = snprintf(buffer + length, size - length, "%s%sx%u@%u,%u:",
+                           (i > 0) ? ";" : "", MODEL_NAMES[chain.model],
+                           chain.chips, chain.di_pin, chain.dcki_pin);
+    if (written < 0 || (size_t)written >= size - length) {
+      return 0;
+    }
+    length += written;
+
+    for (uint8_t end = channels + getChannels(chain); channels < end;
+         channels++) {
+      if (length + 1 >= size) {
+        return 0;
+      }
+
+      buffer[length++] = CHANNEL_CHARS[fixture.map[channels]];
+    }
+  }
+
+  buffer[length] = '\0';
+
+  return length;
+}
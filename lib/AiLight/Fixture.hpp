@@ -0,0 +1,133 @@
+/**
+ * AiLight Library - Fixture
+ *
+ * A fixture describes the LED drivers of a light: one or more chains of MY92XX
+ * chips (each chain on its own data/clock pins) and, for each physical channel
+ * of these chains, the logical channel it outputs. This allows for e.g. RGB
+ * plus cold and warm white (CCT) bulbs, or fixtures with separate zones.
+ *
+ * A fixture can be given as a description (e.g. set in the Web UI): chains
+ * separated by ';', each chain as '<model>x<chips>@<di pin>,<dcki pin>:<map>'
+ * where the map has a character for every physical channel of the chain:
+ *
+ *   R, G, B  red, green, blue
+ *   W        white
+ *   c, w     cold white, warm white (the white level split by the colour
+ *            temperature)
+ *   -        not used (off)
+ *
+ * The AiLight (2 daisy-chained MY9231 chips driving RGB and a doubled white
+ * channel) is described as 'MY9231x2@13,15:RGBWW-'.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Fixture_h
+#define AiLight_Fixture_h
+
+#include <my92xx.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Maximum number of driver chains and physical channels (of all chains)
+#define FIXTURE_CHAINS_MAX 2
+#define FIXTURE_CHANNELS_MAX 12
+
+// Marks a valid (persisted) fixture
+#define FIXTURE_MAGIC 0xF1
+
+// Maximum length of a fixture description (including the NUL terminator)
+#define FIXTURE_DESCRIPTION_SIZE 64
+
+// Highest GPIO pin of the ESP8266
+#define FIXTURE_PIN_MAX 16
+
+// Logical channels a physical channel can output
+enum fixture_channel_t : uint8_t {
+  FIXTURE_RED = 0,
+  FIXTURE_GREEN = 1,
+  FIXTURE_BLUE = 2,
+  FIXTURE_WHITE = 3,
+  FIXTURE_COLD_WHITE = 4,
+  FIXTURE_WARM_WHITE = 5,
+  FIXTURE_OFF = 6,
+  FIXTURE_LOGICAL = 7 // Number of logical channels
+};
+
+// A chain of MY92XX chips
+struct fixture_chain_t {
+  uint8_t model;    // MY92XX model (my92xx_model_t)
+  uint8_t chips;    // Number of chips in the chain
+  uint8_t di_pin;   // Data pin
+  uint8_t dcki_pin; // Clock pin
+};
+
+// A fixture (as persisted in the configuration)
+struct fixture_t {
+  uint8_t magic;                             // FIXTURE_MAGIC
+  uint8_t chains;                            // Number of chains
+  fixture_chain_t chain[FIXTURE_CHAINS_MAX]; // The chains
+  uint8_t map[FIXTURE_CHANNELS_MAX]; // Logical channel of each physical
+                                     // channel (chain after chain)
+};
+
+class FixtureClass {
+public:
+  /**
+   * @brief Returns the fixture of a single chain driving RGBW (the white
+   * channel doubled on the MY9231, as on the AiLight)
+   *
+   * @param model the MY92XX model
+   * @param chips the number of chips
+   *
+   * @return the fixture
+   */
+  static fixture_t defaults(my92xx_model_t model, uint8_t chips);
+
+  /**
+   * @brief Checks whether a fixture is complete and consistent
+   *
+   * @param fixture the fixture to check
+   *
+   * @return true if the fixture is valid, otherwise false
+   */
+  static bool validate(const fixture_t &fixture);
+
+  /**
+   * @brief Returns the number of physical channels of a chain
+   *
+   * @param chain the chain
+   *
+   * @return the number of physical channels of the chain
+   */
+  static uint8_t getChannels(const fixture_chain_t &chain);
+
+  /**
+   * @brief Parses a fixture description
+   *
+   * @param description the fixture description (NUL terminated)
+   * @param fixture the structure to hold the fixture
+   *
+   * @return true if the description is a valid fixture, otherwise false
+   */
+  static bool parse(const char *description, fixture_t &fixture);
+
+  /**
+   * @brief Formats a fixture as a description
+   *
+   * @param fixture the fixture
+   * @param buffer the buffer to hold the description
+   * @param size the size of the buffer (FIXTURE_DESCRIPTION_SIZE suffices)
+   *
+   * @return the length of the description (0 if it does not fit)
+   */
+  static size_t format(const fixture_t &fixture, char *buffer, size_t size);
+};
+
+#endif
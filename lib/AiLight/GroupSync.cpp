@@ -0,0 +1,266 @@
+/**
+ * AiLight Library - Group Synchronisation
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "GroupSync.hpp"
+
+/**
+ * @brief Reads a 32 bit big endian value
+ */
+static uint32_t read32(const uint8_t *data) {
+  return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) |
+         ((uint32_t)data[2] << 8) | data[3];
+}
+
+/**
+ * @brief Writes a 32 bit big endian value
+ */
+static void write32(uint8_t *data, uint32_t value) {
+  data[0] = value >> 24;
+  data[1] = value >> 16;
+  data[2] = value >> 8;
+  data[3] = value;
+}
+
+void GroupSyncClass::begin(uint32_t id, uint32_t delay, uint32_t now) {
+  _id = id;
+  _delay = delay * 1000;
+  _joined = now;
+  _listening = true;
+
+  _leading = false;
+  _synced = false;
+  _leader = 0;
+  _offset = 0;
+  _sample_count = 0;
+  _sample_index = 0;
+
+  _held = false;
+  _announced = false;
+}
+
+uint32_t GroupSyncClass::getTime(uint32_t now) { return now + _offset; }
+
+size_t GroupSyncClass::poll(uint32_t now, uint8_t *packet) {
+  if (!_leading) {
+    // Listen for a leader before taking over
+    if (_listening) {
+      if (now - _joined < GROUP_LEADER_TIMEOUT) {
+        return 0;
+      }
+      _listening = false;
+    }
+
+    if (leaderGone(now)) {
+      _leader = 0;
+    } else if (_leader < _id) {
+      return 0;
+    }
+
+    // Take over, keeping the group clock followed so far (if any)
+    _leading = true;
+    _synced = true;
+    _leader = _id;
+    _beacon_last = now - GROUP_BEACON_INTERVAL;
+  }
+
+  if (_repeats > 0 && now - _repeat_last >= GROUP_START_REPEAT_INTERVAL) {
+    _repeats--;
+    _repeat_last = now;
+
+    return build(packet, GROUP_PACKET_START, _repeat_start, _repeat_hash);
+  }
+
+  if (now - _beacon_last < GROUP_BEACON_INTERVAL) {
+    return 0;
+  }
+  _beacon_last = now;
+
+  return build(packet, GROUP_PACKET_BEACON, getTime(now), 0);
+}
+
+bool GroupSyncClass::receive(const uint8_t *packet, size_t length,
+                             uint32_t now) {
+  if (length < GROUP_PACKET_SIZE || packet[0] != 'A' || packet[1] != 'G') {
+    return false;
+  }
+
+  uint8_t type = packet[2];
+  uint32_t id = read32(&packet[4]);
+  uint32_t time = read32(&packet[8]);
+  uint32_t hash = read32(&packet[12]);
+
+  // Own packets (multicast loopback)
+  if (id == _id) {
+    return true;
+  }
+
+  if (type == GROUP_PACKET_BEACON) {
+    // Only the light with the lowest identifier leads
+    uint32_t leader = _leading ? _id : _leader;
+    if (!_leading && leaderGone(now)) {
+      leader = 0xFFFFFFFFUL;
+    }
+
+    if (id > leader) {
+      return true;
+    }
+
+    // Samples of another leader don't compare
+    if (id != _leader) {
+      _sample_count = 0;
+      _sample_index = 0;
+    }
+
+    _leading = false;
+    _leader = id;
+    _leader_seen = now;
+
+    _samples[_sample_index] = time - now;
+    _sample_index = (_sample_index + 1) % GROUP_SAMPLES;
+    if (_sample_count < GROUP_SAMPLES) {
+      _sample_count++;
+    }
+
+    // Transmission only delays a beacon, so the largest offset is the sample
+    // with the least delay
+    uint32_t offset = _samples[0];
+    for (uint8_t i = 1; i < _sample_count; i++) {
+      if ((int32_t)(_samples[i] - offset) > 0) {
+        offset = _samples[i];
+      }
+    }
+
+    _offset = offset;
+    _synced = true;
+  } else if (type == GROUP_PACKET_START) {
+    if (!_synced) {
+      return true;
+    }
+
+    if (_held && hash == _hash) {
+      if (!_scheduled) {
+        schedule(time, now);
+      }
+    } else if (!_announced || hash != _announced_hash) {
+      // The command itself may still be on its way
+      _announced = true;
+      _announced_hash = hash;
+      _announced_start = time;
+      _announced_time = now;
+    }
+  } else {
+    return false;
+  }
+
+  return true;
+}
+
+size_t GroupSyncClass::hold(uint32_t hash, uint32_t now, uint8_t *packet) {
+  _held = true;
+  _scheduled = false;
+  _hash = hash;
+  _deadline = now + _delay;
+
+  if (_leading) {
+    uint32_t start = getTime(now) + _delay;
+    schedule(start, now);
+
+    _repeats = GROUP_START_REPEATS;
+    _repeat_last = now;
+    _repeat_hash = hash;
+    _repeat_start = start;
+
+    return build(packet, GROUP_PACKET_START, start, hash);
+  }
+
+  if (_announced && _announced_hash == hash &&
+      now - _announced_time < 2 * _delay) {
+    _announced = false;
+    schedule(_announced_start, now);
+  }
+
+  return 0;
+}
+
+bool GroupSyncClass::due(uint32_t now) {
+  if (!_held) {
+    return false;
+  }
+
+  if (_scheduled) {
+    if ((int32_t)(getTime(now) - _start) < 0) {
+      return false;
+    }
+    _starts++;
+  } else {
+    if ((int32_t)(now - _deadline) < 0) {
+      return false;
+    }
+    _fallbacks++;
+  }
+
+  _held = false;
+
+  return true;
+}
+
+bool GroupSyncClass::isHeld(void) { return _held; }
+
+bool GroupSyncClass::isLeader(void) { return _leading; }
+
+bool GroupSyncClass::isSynced(void) { return _synced; }
+
+uint32_t GroupSyncClass::getLeader(void) { return _leader; }
+
+int32_t GroupSyncClass::getOffset(void) { return _offset; }
+
+uint32_t GroupSyncClass::getStarts(void) { return _starts; }
+
+uint32_t GroupSyncClass::getFallbacks(void) { return _fallbacks; }
+
+uint32_t GroupSyncClass::hash(const void *data, size_t length) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint32_t hash = 2166136261UL;
+
+  for (size_t i = 0; i < length; i++) {
+    hash = (hash ^ bytes[i]) * 16777619UL;
+  }
+
+  return hash;
+}
+
+bool GroupSyncClass::leaderGone(uint32_t now) {
+  return _leader == 0 || now - _leader_seen > GROUP_LEADER_TIMEOUT;
+}
+
+void GroupSyncClass::schedule(uint32_t start, uint32_t now) {
+  // A start too far ahead is not plausible (e.g. a stale announcement)
+  if ((int32_t)(start - getTime(now)) > (int32_t)(2 * _delay)) {
+    return;
+  }
+
+  _start = start;
+  _scheduled = true;
+}
+
+size_t GroupSyncClass::build(uint8_t *packet, uint8_t type, uint32_t time,
+                             uint32_t hash) {
+  packet[0] = 'A';
+  packet[1] = 'G';
+  packet[2] = type;
+  packet[3] = 0;
+  write32(&packet[4], _id);
+  write32(&packet[8], time);
+  write32(&packet[12], hash);
+
+  return GROUP_PACKET_SIZE;
+}
@@ -0,0 +1,258 @@
+/**
+ * AiLight Library - Group Synchronisation
+ *
+ * Keeps the lights of a group on a shared clock and starts group commands on
+ * all of them at the same instant. The lights exchange small packets by UDP
+ * multicast:
+ *
+ *   beacon  the group clock, sent periodically by the leader of the group (the
+ *           light with the lowest identifier). Followers estimate the offset of
+ *           their own clock to the group clock from the beacons, taking the
+ *           sample with the least transmission delay of the last few.
+ *   start   the group clock time at which a group command is to start, sent by
+ *           the leader once it receives the command. The command is identified
+ *           by a hash of its payload, so the start can be matched with the
+ *           command each follower receives itself (in either order).
+ *
+ * The leader repeats the start packet a few times, as multicast packets may be
+ * lost. A light that does not learn the start of a group command in time
+ * starts it after the start delay (as if it were the leader). A light taking
+ * over as leader keeps the group clock it has been following, so the group
+ * clock continues without a jump.
+ *
+ * Packet (16 bytes, big endian): magic ('A', 'G'), type, reserved, sender
+ * identifier (32 bit), group clock time (32 bit, in microseconds) and the hash
+ * of the command (32 bit, start packets only).
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_GroupSync_h
+#define AiLight_GroupSync_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Packets
+#define GROUP_PACKET_SIZE 16
+#define GROUP_PACKET_BEACON 1
+#define GROUP_PACKET_START 2
+
+// Interval between beacons and the time without beacons after which the
+// leader is considered gone (in microseconds)
+#define GROUP_BEACON_INTERVAL 1000000UL
+#define GROUP_LEADER_TIMEOUT 3500000UL
+
+// Number of beacons the clock offset is estimated from
+#define GROUP_SAMPLES 8
+
+// Number of times a start packet is repeated and the interval between the
+// repeats (in microseconds)
+#define GROUP_START_REPEATS 2
+#define GROUP_START_REPEAT_INTERVAL 20000UL
+
+class GroupSyncClass {
+public:
+  /**
+   * @brief Joins the group
+   *
+   * @param id the identifier of this light (unique within the group)
+   * @param delay the time (in milliseconds) between receiving a group command
+   * and its start. Must exceed the spread in the time the lights receive a
+   * command.
+   * @param now the current (monotonic) time in microseconds
+   *
+   * @return void
+   */
+  void begin(uint32_t id, uint32_t delay, uint32_t now);
+
+  /**
+   * @brief Returns the group clock time
+   *
+   * @param now the current (monotonic) time in microseconds
+   *
+   * @return the group clock time (in microseconds)
+   */
+  uint32_t getTime(uint32_t now);
+
+  /**
+   * @brief Takes over as leader if the group has none, and builds a beacon or
+   * a repeat of the last start packet when one is due
+   *
+   * @param now the current (monotonic) time in microseconds
+   * @param packet the buffer to hold the packet (GROUP_PACKET_SIZE bytes)
+   *
+   * @return the length of the packet to send (0 if none is due)
+   */
+  size_t poll(uint32_t now, uint8_t *packet);
+
+  /**
+   * @brief Handles a received packet (beacon or start)
+   *
+   * @param packet the received packet
+   * @param length the length of the received packet
+   * @param now the current (monotonic) time in microseconds
+   *
+   * @return true if the packet is valid, otherwise false
+   */
+  bool receive(const uint8_t *packet, size_t length, uint32_t now);
+
+  /**
+   * @brief Holds a received group command until its start
+   *
+   * The leader decides the start and builds the start packet to send. A
+   * command that is still held is replaced (use isHeld() to start it first).
+   *
+   * @param hash the hash of the command payload (see hash())
+   * @param now the current (monotonic) time in microseconds
+   * @param packet the buffer to hold the start packet (GROUP_PACKET_SIZE
+   * bytes)
+   *
+   * @return the length of the start packet to send (0 if none)
+   */
+  size_t hold(uint32_t hash, uint32_t now, uint8_t *packet);
+
+  /**
+   * @brief Checks whether the held group command is to start
+   *
+   * @param now the current (monotonic) time in microseconds
+   *
+   * @return true if the held command is to start now, otherwise false
+   */
+  bool due(uint32_t now);
+
+  /**
+   * @brief Returns whether a group command is held
+   *
+   * @return true if a group command is held, otherwise false
+   */
+  bool isHeld(void);
+
+  /**
+   * @brief Returns whether this light is the leader of the group
+   *
+   * @return true if this light is the leader, otherwise false
+   */
+  bool isLeader(void);
+
+  /**
+   * @brief Returns whether this light follows a group clock (or leads)
+   *
+   * @return true if the group clock is known, otherwise false
+   */
+  bool isSynced(void);
+
+  /**
+   * @brief Returns the identifier of the leader of the group
+   *
+   * @return the identifier of the leader (0 if none)
+   */
+  uint32_t getLeader(void);
+
+  /**
+   * @brief Returns the offset of the group clock to the local clock
+   *
+   * @return the offset (in microseconds)
+   */
+  int32_t getOffset(void);
+
+  /**
+   * @brief Returns the number of group commands started at a shared start
+   *
+   * @return the number of synchronised starts
+   */
+  uint32_t getStarts(void);
+
+  /**
+   * @brief Returns the number of group commands started without a shared
+   * start (not received from the leader in time)
+   *
+   * @return the number of unsynchronised starts
+   */
+  uint32_t getFallbacks(void);
+
+  /**
+   * @brief Calculates the hash of a command payload (FNV-1a)
+   *
+   * @param data the payload
+   * @param length the length of the payload
+   *
+   * @return the hash
+   */
+  static uint32_t hash(const void *data, size_t length);
+
+private:
+  uint32_t _id = 0;
+  uint32_t _delay = 0;     // Start delay (in microseconds)
+  uint32_t _joined = 0;    // Time the group has been joined
+  bool _listening = false; // Whether still listening for a leader
+
+  // Leader and clock
+  bool _leading = false;
+  bool _synced = false;
+  uint32_t _leader = 0;
+  uint32_t _leader_seen = 0; // Time of the last beacon of the leader
+  uint32_t _beacon_last = 0; // Time the last beacon was sent
+  uint32_t _offset = 0;      // Group clock minus local clock
+
+  // Last start packet sent (to be repeated)
+  uint8_t _repeats = 0;
+  uint32_t _repeat_last = 0;
+  uint32_t _repeat_hash = 0;
+  uint32_t _repeat_start = 0;
+
+  // Offset samples of the last beacons of the leader
+  uint32_t _samples[GROUP_SAMPLES];
+  uint8_t _sample_count = 0;
+  uint8_t _sample_index = 0;
+
+  // Held command
+  bool _held = false;
+  bool _scheduled = false;
+  uint32_t _hash = 0;
+  uint32_t _start = 0;    // Start (group clock time) if scheduled
+  uint32_t _deadline = 0; // Start (local time) if not scheduled
+
+  // Last start received without a matching held command
+  bool _announced = false;
+  uint32_t _announced_hash = 0;
+  uint32_t _announced_start = 0;
+  uint32_t _announced_time = 0;
+
+  uint32_t _starts = 0;
+  uint32_t _fallbacks = 0;
+
+  /**
+   * @brief Returns whether the leader has not sent a beacon for too long
+   *
+   * @param now the current (monotonic) time in microseconds
+   *
+   * @return true if the group has no (live) leader, otherwise false
+   */
+  bool leaderGone(uint32_t now);
+
+  /**
+   * @brief Schedules the held command at a start (if plausible)
+   *
+   * @param start the start (group clock time)
+   * @param now the current (monotonic) time in microseconds
+   *
+   * @return void
+   */
+  void schedule(uint32_t start, uint32_t now);
+
+  /**
+   * @brief Builds a packet
+   *
+   * @return the length of the packet
+   */
+  size_t build(uint8_t *packet, uint8_t type, uint32_t time, uint32_t hash);
+};
+
+#endif
@@ -0,0 +1,47 @@
+/**
+ * AiLight Library - Histogram
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "Histogram.hpp"
+
+void HistogramClass::record(uint32_t value) {
+  // The number of bits of (value - 1) is the power of two bounding the value
+  uint8_t bucket = 0;
+  if (value > (1UL << HISTOGRAM_FIRST_BIT)) {
+    bucket = 32 - __builtin_clz(value - 1) - HISTOGRAM_FIRST_BIT;
+
+    if (bucket >= HISTOGRAM_BUCKETS) {
+      bucket = HISTOGRAM_BUCKETS - 1;
+    }
+  }
+
+  _buckets[bucket]++;
+  _count++;
+  _sum += value;
+
+  if (value > _max) {
+    _max = value;
+  }
+}
+
+uint32_t HistogramClass::getBucket(uint8_t bucket) {
+  return (bucket < HISTOGRAM_BUCKETS) ? _buckets[bucket] : 0;
+}
+
+uint32_t HistogramClass::getBound(uint8_t bucket) {
+  return 1UL << (HISTOGRAM_FIRST_BIT + bucket);
+}
+
+uint32_t HistogramClass::getCount(void) { return _count; }
+
+uint64_t HistogramClass::getSum(void) { return _sum; }
+
+uint32_t HistogramClass::getMax(void) { return _max; }
@@ -0,0 +1,88 @@
+/**
+ * AiLight Library - Histogram
+ *
+ * A fixed-size histogram of durations (or any other unsigned values), for the
+ * always-on instrumentation of the firmware. Recording a value takes constant
+ * time and no memory is allocated. The buckets are powers of two: the first
+ * bucket holds values up to 2^HISTOGRAM_FIRST_BIT, each next bucket doubles the
+ * upper bound and the last bucket holds all larger values.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Histogram_h
+#define AiLight_Histogram_h
+
+#include <stdint.h>
+
+// Number of buckets (including the bucket of values above the upper bounds)
+#define HISTOGRAM_BUCKETS 16
+
+// Upper bound of the first bucket (as a power of two)
+#define HISTOGRAM_FIRST_BIT 4
+
+class HistogramClass {
+public:
+  /**
+   * @brief Records a value
+   *
+   * @param value the value to record
+   *
+   * @return void
+   */
+  void record(uint32_t value);
+
+  /**
+   * @brief Returns the number of values recorded in a bucket
+   *
+   * @param bucket the bucket (0 - HISTOGRAM_BUCKETS - 1)
+   *
+   * @return the number of values recorded in the bucket
+   */
+  uint32_t getBucket(uint8_t bucket);
+
+  /**
+   * @brief Returns the (inclusive) upper bound of a bucket
+   *
+   * @param bucket the bucket (0 - HISTOGRAM_BUCKETS - 2, the last bucket has
+   * no upper bound)
+   *
+   * @return the upper bound of the bucket
+   */
+  static uint32_t getBound(uint8_t bucket);
+
+  /**
+   * @brief Returns the number of values recorded
+   *
+   * @return the number of values recorded
+   */
+  uint32_t getCount(void);
+
+  /**
+   * @brief Returns the sum of the values recorded
+   *
+   * @return the sum of the values recorded
+   */
+  uint64_t getSum(void);
+
+  /**
+   * @brief Returns the largest value recorded
+   *
+   * @return the largest value recorded
+   */
+  uint32_t getMax(void);
+
+private:
+  uint32_t _buckets[HISTOGRAM_BUCKETS] = {0};
+  uint32_t _count = 0;
+  uint64_t _sum = 0;
+  uint32_t _max = 0;
+};
+
+#endif
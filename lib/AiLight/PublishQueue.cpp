@@ -0,0 +1,134 @@
+/**
+ * AiLight Library - Publish Queue
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "PublishQueue.hpp"
+
+void PublishQueueClass::configure(uint8_t topic, uint8_t options,
+                                  uint16_t interval, bool replay) {
+  if (topic >= PUBLISH_TOPICS_MAX) {
+    return;
+  }
+
+  publish_topic_t &entry = _topics[topic];
+  entry.interval = interval;
+  entry.replay = replay;
+  setOptions(topic, options);
+
+  if (topic >= _count) {
+    _count = topic + 1;
+  }
+}
+
+void PublishQueueClass::setOptions(uint8_t topic, uint8_t options) {
+  if (topic >= PUBLISH_TOPICS_MAX) {
+    return;
+  }
+
+  // There is no QoS level 3
+  if ((options & PUBLISH_QOS_MASK) > 2) {
+    options = (options & ~PUBLISH_QOS_MASK) | 2;
+  }
+
+  _topics[topic].options = options & PUBLISH_OPTIONS_MASK;
+}
+
+uint8_t PublishQueueClass::getOptions(uint8_t topic) {
+  return (topic < PUBLISH_TOPICS_MAX) ? _topics[topic].options : 0;
+}
+
+uint8_t PublishQueueClass::getQoS(uint8_t topic) {
+  return (topic < PUBLISH_TOPICS_MAX)
+             ? (_topics[topic].options & PUBLISH_QOS_MASK)
+             : 0;
+}
+
+bool PublishQueueClass::getRetain(uint8_t topic) {
+  return (topic < PUBLISH_TOPICS_MAX) &&
+         (_topics[topic].options & PUBLISH_RETAIN);
+}
+
+void PublishQueueClass::queue(uint8_t topic) {
+  if (topic >= _count) {
+    return;
+  }
+
+  if (_topics[topic].pending) {
+    _coalesced++;
+  }
+
+  _topics[topic].pending = true;
+  _queued++;
+}
+
+bool PublishQueueClass::next(uint32_t now, uint8_t &topic) {
+  // Topics are taken in order, so e.g. the availability precedes the state
+  for (uint8_t i = 0; i < _count; i++) {
+    const publish_topic_t &entry = _topics[i];
+
+    if (entry.pending &&
+        (!entry.published || now - entry.last >= entry.interval)) {
+      topic = i;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void PublishQueueClass::published(uint8_t topic, uint32_t now) {
+  if (topic >= _count) {
+    return;
+  }
+
+  publish_topic_t &entry = _topics[topic];
+  entry.pending = false;
+  entry.published = true;
+  entry.last = now;
+
+  _published++;
+}
+
+void PublishQueueClass::connect(void) {
+  for (uint8_t i = 0; i < _count; i++) {
+    if (_topics[i].replay && !_topics[i].pending) {
+      _topics[i].pending = true;
+      _queued++;
+    }
+  }
+}
+
+void PublishQueueClass::disconnect(void) {
+  for (uint8_t i = 0; i < _count; i++) {
+    if (!_topics[i].replay && _topics[i].pending) {
+      _topics[i].pending = false;
+      _dropped++;
+    }
+  }
+}
+
+uint8_t PublishQueueClass::getPending(void) {
+  uint8_t pending = 0;
+
+  for (uint8_t i = 0; i < _count; i++) {
+    pending += _topics[i].pending;
+  }
+
+  return pending;
+}
+
+uint32_t PublishQueueClass::getQueued(void) { return _queued; }
+
+uint32_t PublishQueueClass::getCoalesced(void) { return _coalesced; }
+
+uint32_t PublishQueueClass::getDropped(void) { return _dropped; }
+
+uint32_t PublishQueueClass::getPublished(void) { return _published; }
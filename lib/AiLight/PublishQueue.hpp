@@ -0,0 +1,194 @@
+/**
+ * AiLight Library - Publish Queue
+ *
+ * The publish queue keeps track of the MQTT messages waiting to be published,
+ * one entry per topic (the state, the availability, etc.). Queueing a message
+ * only marks its topic as pending: the payload is rendered when the topic is
+ * taken from the queue, so a topic queued several times is published once,
+ * with the newest payload. Each topic is published at most once per interval
+ * of its own, and has its own QoS level and retain flag (which can be changed
+ * at runtime).
+ *
+ * Messages are only taken from the queue while connected to the MQTT broker.
+ * Topics marked for replay (e.g. the state and the availability) are published
+ * again on each (re)connect; pending messages of the other topics are dropped
+ * on a disconnect, as they would be stale by the time of the reconnect.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_PublishQueue_h
+#define AiLight_PublishQueue_h
+
+#include <stdint.h>
+
+// Number of topics the queue can hold
+#define PUBLISH_TOPICS_MAX 8
+
+// Publish options of a topic: the QoS level (0, 1 or 2) and the retain flag
+#define PUBLISH_QOS_MASK 0x03
+#define PUBLISH_RETAIN 0x04
+#define PUBLISH_OPTIONS_MASK (PUBLISH_QOS_MASK | PUBLISH_RETAIN)
+
+// A topic of the queue
+struct publish_topic_t {
+  uint8_t options;   // QoS level and retain flag (PUBLISH_*)
+  bool replay;       // Whether published again on each (re)connect
+  bool pending;      // Whether a message is waiting to be published
+  bool published;    // Whether a message has been published at all
+  uint16_t interval; // Minimum time between messages (in milliseconds)
+  uint32_t last;     // Time the last message has been published
+};
+
+class PublishQueueClass {
+public:
+  /**
+   * @brief Configures a topic
+   *
+   * @param topic the topic (index, less than PUBLISH_TOPICS_MAX)
+   * @param options the QoS level and retain flag (PUBLISH_*)
+   * @param interval the minimum time between messages (in milliseconds)
+   * @param replay whether the topic is published again on each (re)connect
+   *
+   * @return void
+   */
+  void configure(uint8_t topic, uint8_t options, uint16_t interval,
+                 bool replay);
+
+  /**
+   * @brief Sets the QoS level and retain flag of a topic
+   *
+   * @param topic the topic
+   * @param options the QoS level and retain flag (PUBLISH_*)
+   *
+   * @return void
+   */
+  void setOptions(uint8_t topic, uint8_t options);
+
+  /**
+   * @brief Returns the QoS level and retain flag of a topic
+   *
+   * @param topic the topic
+   *
+   * @return the QoS level and retain flag (PUBLISH_*)
+   */
+  uint8_t getOptions(uint8_t topic);
+
+  /**
+   * @brief Returns the QoS level of a topic
+   *
+   * @param topic the topic
+   *
+   * @return the QoS level (0, 1 or 2)
+   */
+  uint8_t getQoS(uint8_t topic);
+
+  /**
+   * @brief Returns the retain flag of a topic
+   *
+   * @param topic the topic
+   *
+   * @return true if the messages of the topic are retained, otherwise false
+   */
+  bool getRetain(uint8_t topic);
+
+  /**
+   * @brief Queues a message of a topic (replacing a message still pending)
+   *
+   * @param topic the topic
+   *
+   * @return void
+   */
+  void queue(uint8_t topic);
+
+  /**
+   * @brief Takes the next topic whose message is to be published
+   *
+   * The message remains pending until published() is called, so a message
+   * that can't be sent (e.g. the send buffer is full) is taken again.
+   *
+   * @param now the current (monotonic) time in milliseconds
+   * @param topic the variable to hold the topic
+   *
+   * @return true if a message is to be published, otherwise false
+   */
+  bool next(uint32_t now, uint8_t &topic);
+
+  /**
+   * @brief Marks the message of a topic as published
+   *
+   * @param topic the topic
+   * @param now the current (monotonic) time in milliseconds
+   *
+   * @return void
+   */
+  void published(uint8_t topic, uint32_t now);
+
+  /**
+   * @brief Queues the messages of the topics to replay upon a (re)connect
+   *
+   * @return void
+   */
+  void connect(void);
+
+  /**
+   * @brief Drops the pending messages of the topics not replayed upon a
+   * reconnect
+   *
+   * @return void
+   */
+  void disconnect(void);
+
+  /**
+   * @brief Returns the number of messages waiting to be published
+   *
+   * @return the number of messages waiting to be published
+   */
+  uint8_t getPending(void);
+
+  /**
+   * @brief Returns the number of messages queued since boot
+   *
+   * @return the number of messages queued since boot
+   */
+  uint32_t getQueued(void);
+
+  /**
+   * @brief Returns the number of messages replaced by a newer message of the
+   * same topic before being published
+   *
+   * @return the number of messages replaced
+   */
+  uint32_t getCoalesced(void);
+
+  /**
+   * @brief Returns the number of messages dropped on a disconnect
+   *
+   * @return the number of messages dropped
+   */
+  uint32_t getDropped(void);
+
+  /**
+   * @brief Returns the number of messages published since boot
+   *
+   * @return the number of messages published since boot
+   */
+  uint32_t getPublished(void);
+
+private:
+  publish_topic_t _topics[PUBLISH_TOPICS_MAX] = {};
+  uint8_t _count = 0; // Number of topics configured
+
+  uint32_t _queued = 0;
+  uint32_t _coalesced = 0;
+  uint32_t _dropped = 0;
+  uint32_t _published = 0;
+};
+
+#endif
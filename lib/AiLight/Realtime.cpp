@@ -0,0 +1,147 @@
+/**
+ * AiLight Library - Realtime Streaming
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "Realtime.hpp"
+
+void RealtimeClass::begin(uint32_t offset, uint8_t channels,
+                          uint32_t timeout) {
+  _offset = offset;
+  _channels = (channels == REALTIME_CHANNELS_RGBW) ? REALTIME_CHANNELS_RGBW
+                                                   : REALTIME_CHANNELS_RGB;
+  _timeout = timeout;
+  stop();
+}
+
+bool RealtimeClass::receive(const uint8_t *packet, size_t length,
+                            uint32_t now, Frame &frame) {
+  if (length < DDP_HEADER_SIZE) {
+    _invalid++;
+    return false;
+  }
+
+  uint8_t flags = packet[0];
+
+  // Only data for a display is of interest (no queries, replies, etc.)
+  if ((flags & DDP_FLAGS_VERSION_MASK) != DDP_FLAGS_VERSION_1 ||
+      (flags & (DDP_FLAGS_STORAGE | DDP_FLAGS_REPLY | DDP_FLAGS_QUERY)) ||
+      packet[3] != DDP_ID_DISPLAY) {
+    _invalid++;
+    return false;
+  }
+
+  size_t header = DDP_HEADER_SIZE;
+  if (flags & DDP_FLAGS_TIMECODE) {
+    header += DDP_TIMECODE_SIZE;
+  }
+
+  uint32_t offset = ((uint32_t)packet[4] << 24) | ((uint32_t)packet[5] << 16) |
+                    ((uint32_t)packet[6] << 8) | packet[7];
+  uint32_t data_length = (packet[8] << 8) | packet[9];
+
+  if (length < header) {
+    _invalid++;
+    return false;
+  }
+
+  // Only the part received counts (the packet may have been truncated)
+  if (data_length > length - header) {
+    data_length = length - header;
+  }
+
+  if (!checkSequence(packet[1] & DDP_SEQUENCE_MASK)) {
+    _late++;
+    return false;
+  }
+
+  // Copy the channels of this light covered by this packet
+  const uint8_t *data = packet + header;
+  for (uint8_t i = 0; i < _channels; i++) {
+    uint32_t channel = _offset + i;
+
+    if (channel >= offset && channel - offset < data_length) {
+      _levels[i] = data[channel - offset];
+    }
+  }
+
+  if (!(flags & DDP_FLAGS_PUSH)) {
+    return false;
+  }
+
+  // A new stream starts, or the stream continues
+  if (!_active) {
+    _active = true;
+    _sessions++;
+  } else if (now - _last > _max_interval) {
+    _max_interval = now - _last;
+  }
+  _last = now;
+  _frames++;
+
+  frame.color = {_levels[0], _levels[1], _levels[2], _levels[3]};
+  frame.brightness = 255;
+
+  return true;
+}
+
+bool RealtimeClass::checkSequence(uint8_t sequence) {
+  // Sequence numbers are optional
+  if (sequence == 0) {
+    return true;
+  }
+
+  if (_sequence == 0) {
+    _sequence = sequence;
+    return true;
+  }
+
+  // Distance in the cycle of sequence numbers (1 - 15)
+  uint8_t distance = (sequence + 15 - _sequence) % 15;
+
+  // Repeated or older (within half the cycle)
+  if (distance == 0 || distance > 7) {
+    return false;
+  }
+
+  _dropped += distance - 1;
+  _sequence = sequence;
+
+  return true;
+}
+
+bool RealtimeClass::isActive(void) { return _active; }
+
+bool RealtimeClass::expired(uint32_t now) {
+  if (!_active || now - _last < _timeout) {
+    return false;
+  }
+
+  stop();
+
+  return true;
+}
+
+void RealtimeClass::stop(void) {
+  _active = false;
+  _sequence = 0;
+}
+
+uint32_t RealtimeClass::getFrames(void) { return _frames; }
+
+uint32_t RealtimeClass::getDropped(void) { return _dropped; }
+
+uint32_t RealtimeClass::getLate(void) { return _late; }
+
+uint32_t RealtimeClass::getInvalid(void) { return _invalid; }
+
+uint32_t RealtimeClass::getSessions(void) { return _sessions; }
+
+uint32_t RealtimeClass::getMaxInterval(void) { return _max_interval; }
@@ -0,0 +1,172 @@
+/**
+ * AiLight Library - Realtime Streaming
+ *
+ * Decodes realtime colour streams (e.g. for music synchronisation or ambient
+ * lighting) sent using the Distributed Display Protocol (DDP) over UDP. Each
+ * light takes its levels from a slot of the stream, starting at a configurable
+ * channel offset (so a single stream can drive a group of lights). Frames are
+ * sequence checked, so dropped and late (out of order) frames are counted and
+ * late frames are discarded.
+ *
+ * DDP packet: flags (version 1, push, timecode), sequence number (1 - 15, 0
+ * is unused), data type, destination id, data offset (32 bit, big endian),
+ * data length (16 bit, big endian), timecode (if flagged) and the data.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Realtime_h
+#define AiLight_Realtime_h
+
+#include "Color.hpp"
+#include <stddef.h>
+
+// DDP protocol
+#define DDP_PORT 4048
+#define DDP_HEADER_SIZE 10
+#define DDP_TIMECODE_SIZE 4
+#define DDP_FLAGS_VERSION_MASK 0xC0
+#define DDP_FLAGS_VERSION_1 0x40
+#define DDP_FLAGS_TIMECODE 0x10
+#define DDP_FLAGS_STORAGE 0x08
+#define DDP_FLAGS_REPLY 0x04
+#define DDP_FLAGS_QUERY 0x02
+#define DDP_FLAGS_PUSH 0x01
+#define DDP_SEQUENCE_MASK 0x0F
+#define DDP_ID_DISPLAY 1
+
+// Number of channels (RGB or RGBW) a light takes from the stream
+#define REALTIME_CHANNELS_RGB 3
+#define REALTIME_CHANNELS_RGBW 4
+
+class RealtimeClass {
+public:
+  /**
+   * @brief Configures the realtime stream
+   *
+   * @param offset the first channel of this light in the stream
+   * @param channels the number of channels (REALTIME_CHANNELS_RGB or
+   * REALTIME_CHANNELS_RGBW)
+   * @param timeout the time (in milliseconds) without frames after which the
+   * stream has ended
+   *
+   * @return void
+   */
+  void begin(uint32_t offset, uint8_t channels, uint32_t timeout);
+
+  /**
+   * @brief Decodes a received packet
+   *
+   * The data for this light is collected until a packet with the push flag is
+   * received, at which moment the frame is to be displayed.
+   *
+   * @param packet the received packet (may be truncated to the part holding
+   * the channels of this light)
+   * @param length the length of the received packet
+   * @param now the current (monotonic) time in milliseconds
+   * @param frame the light frame to hold the levels to display
+   *
+   * @return true if the frame is to be displayed, otherwise false
+   */
+  bool receive(const uint8_t *packet, size_t length, uint32_t now,
+               Frame &frame);
+
+  /**
+   * @brief Returns whether a stream is active
+   *
+   * @return true if a stream is active, otherwise false
+   */
+  bool isActive(void);
+
+  /**
+   * @brief Checks whether the active stream has timed out (and ends it)
+   *
+   * @param now the current (monotonic) time in milliseconds
+   *
+   * @return true if the stream has just timed out, otherwise false
+   */
+  bool expired(uint32_t now);
+
+  /**
+   * @brief Ends the active stream
+   *
+   * @return void
+   */
+  void stop(void);
+
+  /**
+   * @brief Returns the number of frames displayed
+   *
+   * @return the number of frames displayed
+   */
+  uint32_t getFrames(void);
+
+  /**
+   * @brief Returns the number of frames that have never been received (gaps
+   * in the sequence numbers)
+   *
+   * @return the number of dropped frames
+   */
+  uint32_t getDropped(void);
+
+  /**
+   * @brief Returns the number of frames received out of order (discarded)
+   *
+   * @return the number of late frames
+   */
+  uint32_t getLate(void);
+
+  /**
+   * @brief Returns the number of packets that have been ignored (malformed
+   * or not meant for a display)
+   *
+   * @return the number of invalid packets
+   */
+  uint32_t getInvalid(void);
+
+  /**
+   * @brief Returns the number of streams started since boot
+   *
+   * @return the number of streams started since boot
+   */
+  uint32_t getSessions(void);
+
+  /**
+   * @brief Returns the longest time between two frames of a stream
+   *
+   * @return the longest time (in milliseconds) between two frames
+   */
+  uint32_t getMaxInterval(void);
+
+private:
+  uint32_t _offset = 0;
+  uint8_t _channels = REALTIME_CHANNELS_RGB;
+  uint32_t _timeout = 0;
+
+  bool _active = false;
+  uint8_t _sequence = 0;    // Last sequence number received (0 is none)
+  uint32_t _last = 0;       // Time the last frame has been received
+  uint8_t _levels[4] = {0}; // Levels collected for the next frame
+
+  uint32_t _frames = 0;
+  uint32_t _dropped = 0;
+  uint32_t _late = 0;
+  uint32_t _invalid = 0;
+  uint32_t _sessions = 0;
+  uint32_t _max_interval = 0;
+
+  /**
+   * @brief Checks the sequence number of a packet
+   *
+   * @return true if the packet is to be used, false if it is late
+   */
+  bool checkSequence(uint8_t sequence);
+};
+
+#endif
@@ -0,0 +1,178 @@
+/**
+ * AiLight Library - Command Recorder
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "Recorder.hpp"
+#include <string.h>
+
+RecorderClass::RecorderClass(uint8_t *buffer, size_t size)
+    : _buffer(buffer), _size((buffer != NULL) ? size : 0) {}
+
+bool RecorderClass::record(uint32_t now, uint8_t source, const char *payload,
+                           size_t length) {
+  size_t needed = RECORDER_RECORD_SIZE + length;
+
+  if (_size == 0) {
+    return false;
+  }
+
+  if (_paused || length > 0xFFFF || needed > _size) {
+    _lost++;
+    return false;
+  }
+
+  // Make way for the record
+  while (_size - _used < needed) {
+    drop();
+  }
+
+  uint8_t header[RECORDER_RECORD_SIZE] = {
+      (uint8_t)now,         (uint8_t)(now >> 8),   (uint8_t)(now >> 16),
+      (uint8_t)(now >> 24), source,                (uint8_t)length,
+      (uint8_t)(length >> 8)};
+
+  size_t tail = (_head + _used) % _size;
+  write(tail, header, RECORDER_RECORD_SIZE);
+  write((tail + RECORDER_RECORD_SIZE) % _size, (const uint8_t *)payload,
+        length);
+
+  _used += needed;
+  _records++;
+  _recorded++;
+
+  return true;
+}
+
+void RecorderClass::pause(bool paused) { _paused = paused; }
+
+void RecorderClass::clear(void) {
+  _head = 0;
+  _used = 0;
+  _records = 0;
+  _lost = 0;
+}
+
+size_t RecorderClass::getLength(void) {
+  return RECORDER_HEADER_SIZE + _used;
+}
+
+size_t RecorderClass::read(size_t offset, uint8_t *data, size_t length) {
+  size_t total = getLength();
+  size_t read = 0;
+
+  if (offset >= total) {
+    return 0;
+  }
+  if (length > total - offset) {
+    length = total - offset;
+  }
+
+  // The header is rendered on the fly
+  if (offset < RECORDER_HEADER_SIZE) {
+    uint8_t header[RECORDER_HEADER_SIZE] = {
+        RECORDER_MAGIC & 0xFF, RECORDER_MAGIC >> 8,  RECORDER_VERSION,
+        0,                     (uint8_t)_lost,       (uint8_t)(_lost >> 8),
+        (uint8_t)(_lost >> 16), (uint8_t)(_lost >> 24)};
+
+    read = RECORDER_HEADER_SIZE - offset;
+    if (read > length) {
+      read = length;
+    }
+    memcpy(data, header + offset, read);
+    offset += read;
+  }
+
+  if (read < length) {
+    copy((_head + offset - RECORDER_HEADER_SIZE) % _size, data + read,
+         length - read);
+  }
+
+  return length;
+}
+
+uint32_t RecorderClass::getRecords(void) { return _records; }
+
+uint32_t RecorderClass::getRecorded(void) { return _recorded; }
+
+uint32_t RecorderClass::getLost(void) { return _lost; }
+
+bool RecorderClass::parse(const uint8_t *log, size_t length, size_t &offset,
+                          record_t &record) {
+  if (offset == 0) {
+    if (length < RECORDER_HEADER_SIZE ||
+        (log[0] | log[1] << 8) != RECORDER_MAGIC ||
+        log[2] != RECORDER_VERSION) {
+      return false;
+    }
+
+    offset = RECORDER_HEADER_SIZE;
+  }
+
+  if (offset > length || length - offset < RECORDER_RECORD_SIZE) {
+    return false;
+  }
+
+  const uint8_t *header = log + offset;
+  record.time = (uint32_t)header[0] | (uint32_t)header[1] << 8 |
+                (uint32_t)header[2] << 16 | (uint32_t)header[3] << 24;
+  record.source = header[4];
+  record.length = header[5] | header[6] << 8;
+
+  if (record.length > length - offset - RECORDER_RECORD_SIZE) {
+    return false;
+  }
+
+  record.payload = (const char *)(header + RECORDER_RECORD_SIZE);
+  offset += RECORDER_RECORD_SIZE + record.length;
+
+  return true;
+}
+
+uint32_t RecorderClass::getLost(const uint8_t *log, size_t length) {
+  if (length < RECORDER_HEADER_SIZE) {
+    return 0;
+  }
+
+  return (uint32_t)log[4] | (uint32_t)log[5] << 8 | (uint32_t)log[6] << 16 |
+         (uint32_t)log[7] << 24;
+}
+
+void RecorderClass::write(size_t position, const uint8_t *data,
+                          size_t length) {
+  size_t first = _size - position;
+  if (first > length) {
+    first = length;
+  }
+
+  memcpy(_buffer + position, data, first);
+  memcpy(_buffer, data + first, length - first);
+}
+
+void RecorderClass::copy(size_t position, uint8_t *data, size_t length) {
+  size_t first = _size - position;
+  if (first > length) {
+    first = length;
+  }
+
+  memcpy(data, _buffer + position, first);
+  memcpy(data + first, _buffer, length - first);
+}
+
+void RecorderClass::drop(void) {
+  uint8_t header[RECORDER_RECORD_SIZE];
+  copy(_head, header, RECORDER_RECORD_SIZE);
+
+  size_t length = RECORDER_RECORD_SIZE + (header[5] | header[6] << 8);
+  _head = (_head + length) % _size;
+  _used -= length;
+  _records--;
+  _lost++;
+}
@@ -0,0 +1,181 @@
+/**
+ * AiLight Library - Command Recorder
+ *
+ * The command recorder keeps a log of the light commands received, in a ring
+ * buffer in RAM: the oldest records make way for new ones. Each record holds
+ * the time of reception, the source (MQTT, WebSocket, REST API or group) and
+ * the payload as received, so a session can be downloaded and replayed
+ * through the same code on the host (see the 'replay' mode of the benchmark
+ * program) to reproduce what the light has rendered.
+ *
+ * Log (little endian): magic ('A', 'R'), version, reserved and the number of
+ * records lost (32 bit), followed by the records: time of reception (in
+ * milliseconds, 32 bit), source, length of the payload (16 bit) and the
+ * payload.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Recorder_h
+#define AiLight_Recorder_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Marker identifying a log ('A', 'R') and the version of its format
+#define RECORDER_MAGIC 0x5241
+#define RECORDER_VERSION 1
+
+// Size of the log header and of a record header
+#define RECORDER_HEADER_SIZE 8
+#define RECORDER_RECORD_SIZE 7
+
+// Sources of the recorded commands
+#define RECORD_SOURCE_MQTT 0
+#define RECORD_SOURCE_WEBSOCKET 1
+#define RECORD_SOURCE_API 2
+#define RECORD_SOURCE_GROUP 3
+#define RECORD_SOURCES 4
+
+// A record of the log
+struct record_t {
+  uint32_t time;       // Time of reception (in milliseconds)
+  uint8_t source;      // RECORD_SOURCE_*
+  uint16_t length;     // Length of the payload
+  const char *payload; // The payload (not NUL terminated)
+};
+
+class RecorderClass {
+public:
+  /**
+   * @brief Creates a recorder
+   *
+   * @param buffer the buffer to hold the records (NULL to not record)
+   * @param size the size of the buffer
+   */
+  RecorderClass(uint8_t *buffer, size_t size);
+
+  /**
+   * @brief Records a received command
+   *
+   * Commands larger than the buffer, or received while paused, are not
+   * recorded (but counted as lost).
+   *
+   * @param now the current (monotonic) time in milliseconds
+   * @param source the source of the command (RECORD_SOURCE_*)
+   * @param payload the payload (does not need to be NUL terminated)
+   * @param length the length of the payload
+   *
+   * @return true if the command has been recorded, otherwise false
+   */
+  bool record(uint32_t now, uint8_t source, const char *payload,
+              size_t length);
+
+  /**
+   * @brief Pauses or resumes recording (e.g. while the log is being read)
+   *
+   * @param paused true to pause, false to resume
+   *
+   * @return void
+   */
+  void pause(bool paused);
+
+  /**
+   * @brief Removes all records
+   *
+   * @return void
+   */
+  void clear(void);
+
+  /**
+   * @brief Returns the length of the log (header and records)
+   *
+   * @return the length of the log
+   */
+  size_t getLength(void);
+
+  /**
+   * @brief Reads a part of the log
+   *
+   * @param offset the offset in the log
+   * @param data the buffer to hold the part read
+   * @param length the size of the buffer
+   *
+   * @return the number of bytes read
+   */
+  size_t read(size_t offset, uint8_t *data, size_t length);
+
+  /**
+   * @brief Returns the number of records held
+   *
+   * @return the number of records held
+   */
+  uint32_t getRecords(void);
+
+  /**
+   * @brief Returns the number of commands recorded since boot
+   *
+   * @return the number of commands recorded
+   */
+  uint32_t getRecorded(void);
+
+  /**
+   * @brief Returns the number of commands lost (overwritten, too large or
+   * received while paused) since the log has been cleared
+   *
+   * @return the number of commands lost
+   */
+  uint32_t getLost(void);
+
+  /**
+   * @brief Parses the next record of a log
+   *
+   * @param log the log
+   * @param length the length of the log
+   * @param offset the offset of the record (the header is skipped at 0), set
+   * to the offset of the next record
+   * @param record the structure to hold the record (pointing into the log)
+   *
+   * @return true if a record has been parsed, false at the end of the log or
+   * if the log is invalid
+   */
+  static bool parse(const uint8_t *log, size_t length, size_t &offset,
+                    record_t &record);
+
+  /**
+   * @brief Returns the number of records lost before (or among) the records
+   * of a log
+   *
+   * @param log the log
+   * @param length the length of the log
+   *
+   * @return the number of records lost
+   */
+  static uint32_t getLost(const uint8_t *log, size_t length);
+
+private:
+  uint8_t *_buffer;
+  size_t _size;
+  size_t _head = 0; // Offset of the oldest record
+  size_t _used = 0; // Bytes used by the records
+  bool _paused = false;
+
+  uint32_t _records = 0;
+  uint32_t _recorded = 0;
+  uint32_t _lost = 0;
+
+  // Copies data into and out of the ring buffer (wrapping around)
+  void write(size_t position, const uint8_t *data, size_t length);
+  void copy(size_t position, uint8_t *data, size_t length);
+
+  // Removes the oldest record
+  void drop(void);
+};
+
+#endif
@@ -0,0 +1,301 @@
+/**
+ * AiLight Library - Effect Sequencer
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "Sequencer.hpp"
+#include <Arduino.h>
+
+// Keyframe duration (in units of SEQUENCER_TIME_UNIT) as program bytes
+#define KEYFRAME_TIME(ms)                                                      \
+  ((ms) / SEQUENCER_TIME_UNIT) & 0xFF, ((ms) / SEQUENCER_TIME_UNIT) >> 8
+
+// Jitter level (0 - 7) as keyframe flags
+#define KEYFRAME_JITTER_LEVEL(level) ((level) << KEYFRAME_JITTER_SHIFT)
+
+// Slowly dims the light and back again
+static const uint8_t effectBreathe[] PROGMEM = {
+    SEQUENCE_MAGIC, 2, 0, 0,
+    KEYFRAME_BASE_COLOR | KEYFRAME_SCALE | EASING_EASE_IN_OUT, 0, 0, 0, 0, 26,
+    KEYFRAME_TIME(1500),
+    KEYFRAME_BASE_COLOR | KEYFRAME_SCALE | EASING_EASE_IN_OUT, 0, 0, 0, 0, 255,
+    KEYFRAME_TIME(1500)};
+
+// Cycles through the colour wheel
+static const uint8_t effectColorLoop[] PROGMEM = {
+    SEQUENCE_MAGIC, 6, 0, 0,
+    KEYFRAME_SCALE, 255, 0,   0,   0, 255, KEYFRAME_TIME(2000),
+    KEYFRAME_SCALE, 255, 255, 0,   0, 255, KEYFRAME_TIME(2000),
+    KEYFRAME_SCALE, 0,   255, 0,   0, 255, KEYFRAME_TIME(2000),
+    KEYFRAME_SCALE, 0,   255, 255, 0, 255, KEYFRAME_TIME(2000),
+    KEYFRAME_SCALE, 0,   0,   255, 0, 255, KEYFRAME_TIME(2000),
+    KEYFRAME_SCALE, 255, 0,   255, 0, 255, KEYFRAME_TIME(2000)};
+
+// Warm, randomly flickering light
+static const uint8_t effectCandle[] PROGMEM = {
+    SEQUENCE_MAGIC, 4, 0, 0,
+    KEYFRAME_SCALE | KEYFRAME_JITTER_LEVEL(4), 255, 96, 12, 0, 255,
+    KEYFRAME_TIME(120),
+    KEYFRAME_SCALE | KEYFRAME_JITTER_LEVEL(6), 255, 96, 12, 0, 200,
+    KEYFRAME_TIME(80),
+    KEYFRAME_SCALE | KEYFRAME_JITTER_LEVEL(3), 255, 96, 12, 0, 240,
+    KEYFRAME_TIME(200),
+    KEYFRAME_SCALE | KEYFRAME_JITTER_LEVEL(7), 255, 96, 12, 0, 170,
+    KEYFRAME_TIME(60)};
+
+// Short bursts of light
+static const uint8_t effectStrobe[] PROGMEM = {
+    SEQUENCE_MAGIC, 2, 0, 0,
+    KEYFRAME_HOLD | KEYFRAME_BASE_COLOR | KEYFRAME_SCALE, 0, 0, 0, 0, 255,
+    KEYFRAME_TIME(40),
+    KEYFRAME_HOLD | KEYFRAME_BASE_COLOR | KEYFRAME_SCALE, 0, 0, 0, 0, 0,
+    KEYFRAME_TIME(60)};
+
+// On/off once per second (the number of loops is the flash length)
+static const uint8_t effectFlash[] PROGMEM = {
+    SEQUENCE_MAGIC, 2, 1, SEQUENCE_RESTORE,
+    KEYFRAME_HOLD | KEYFRAME_BASE_COLOR | KEYFRAME_SCALE, 0, 0, 0, 0, 255,
+    KEYFRAME_TIME(500),
+    KEYFRAME_HOLD | KEYFRAME_BASE_COLOR | KEYFRAME_SCALE, 0, 0, 0, 0, 0,
+    KEYFRAME_TIME(500)};
+
+// Built-in programs (indexed by effect, NULL for none/custom)
+static const uint8_t *const effectPrograms[] = {
+    NULL,         effectBreathe, effectColorLoop, effectCandle,
+    effectStrobe, NULL,          effectFlash};
+
+static const uint8_t effectProgramSizes[] = {
+    0, sizeof(effectBreathe), sizeof(effectColorLoop), sizeof(effectCandle),
+    sizeof(effectStrobe), 0, sizeof(effectFlash)};
+
+// Names of the effects that can be selected
+static const char *const effectNames[EFFECT_NAMED] = {
+    "none", "breathe", "colorloop", "candle", "strobe", "custom"};
+
+const char *SequencerClass::getEffectName(uint8_t effect) {
+  return (effect < EFFECT_NAMED) ? effectNames[effect] : NULL;
+}
+
+bool SequencerClass::findEffect(const char *name, size_t length,
+                                uint8_t &effect) {
+  for (uint8_t i = 0; i < EFFECT_NAMED; i++) {
+    if (strlen(effectNames[i]) == length &&
+        strncmp(effectNames[i], name, length) == 0) {
+      effect = i;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool SequencerClass::validate(const uint8_t *program, size_t length) {
+  if (length < SEQUENCE_HEADER_SIZE || program[0] != SEQUENCE_MAGIC) {
+    return false;
+  }
+
+  uint8_t count = program[1];
+  if (count == 0 || count > SEQUENCER_MAX_KEYFRAMES ||
+      length !=
+          (size_t)(SEQUENCE_HEADER_SIZE + count * SEQUENCE_KEYFRAME_SIZE)) {
+    return false;
+  }
+
+  // An endless program needs to take time, or it would never yield
+  uint32_t duration = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    const uint8_t *keyframe =
+        &program[SEQUENCE_HEADER_SIZE + i * SEQUENCE_KEYFRAME_SIZE];
+
+    if ((keyframe[0] & KEYFRAME_EASING) > EASING_PERCEPTUAL) {
+      return false;
+    }
+
+    duration += keyframe[6] | (keyframe[7] << 8);
+  }
+
+  return duration > 0;
+}
+
+void SequencerClass::seed(uint32_t seed) {
+  if (seed != 0) {
+    _random = seed;
+  }
+}
+
+bool SequencerClass::post(const uint8_t *program, size_t length) {
+  if (__atomic_load_n(&_mailbox_full, __ATOMIC_ACQUIRE) ||
+      length > SEQUENCER_PROGRAM_MAX) {
+    return false;
+  }
+
+  memcpy(_mailbox, program, length);
+  _mailbox_length = length;
+
+  __atomic_store_n(&_mailbox_full, true, __ATOMIC_RELEASE);
+
+  return true;
+}
+
+void SequencerClass::discard(void) {
+  __atomic_store_n(&_mailbox_full, false, __ATOMIC_RELEASE);
+}
+
+bool SequencerClass::take(void) {
+  if (!__atomic_load_n(&_mailbox_full, __ATOMIC_ACQUIRE)) {
+    return false;
+  }
+
+  // The custom program can't change while it is running
+  if (_running && _effect == EFFECT_CUSTOM) {
+    stop();
+  }
+
+  memcpy(_custom, _mailbox, _mailbox_length);
+  _has_custom = true;
+
+  __atomic_store_n(&_mailbox_full, false, __ATOMIC_RELEASE);
+
+  return true;
+}
+
+bool SequencerClass::begin(uint8_t effect, const Frame &base,
+                           const Frame &from, uint32_t now, uint16_t loops) {
+  if (effect == EFFECT_CUSTOM) {
+    if (!_has_custom) {
+      return false;
+    }
+    memcpy(_program, _custom, sizeof(_program));
+  } else if (effect < sizeof(effectPrograms) / sizeof(effectPrograms[0]) &&
+             effectPrograms[effect] != NULL) {
+    memcpy_P(_program, effectPrograms[effect], effectProgramSizes[effect]);
+  } else {
+    stop();
+    return false;
+  }
+
+  _effect = effect;
+  _base = base;
+  _frame = from;
+  _index = 0;
+  _loops = (loops > 0) ? loops : _program[2];
+  _changed = false;
+  _running = true;
+
+  startKeyframe(now);
+
+  return true;
+}
+
+void SequencerClass::stop(void) {
+  _running = false;
+  _transition.stop();
+}
+
+bool SequencerClass::isRunning(void) { return _running; }
+
+uint8_t SequencerClass::getEffect(void) { return _effect; }
+
+bool SequencerClass::restores(void) {
+  return (_program[3] & SEQUENCE_RESTORE) != 0;
+}
+
+bool SequencerClass::update(uint32_t now, Frame &frame) {
+  if (!_running) {
+    return false;
+  }
+
+  bool changed = _changed;
+  _changed = false;
+
+  // Advance through the keyframes that have ended (at most one pass through
+  // the program, in case the loop has been stalled for a long time)
+  for (uint8_t i = 0; i <= _program[1]; i++) {
+    Frame levels;
+
+    if (_transition.update(now, levels)) {
+      _frame = levels;
+      changed = true;
+    }
+
+    if (_transition.isRunning()) {
+      break;
+    }
+
+    // Next keyframe (and loop)
+    if (++_index >= _program[1]) {
+      _index = 0;
+
+      if (_loops > 0 && --_loops == 0) {
+        _running = false;
+        break;
+      }
+    }
+
+    // Keyframes start at the scheduled end of the previous one, so the
+    // timing doesn't drift. Resynchronise if we are lagging behind too far.
+    startKeyframe((i < _program[1]) ? _end : now);
+    changed |= _changed;
+    _changed = false;
+  }
+
+  if (changed) {
+    frame = _frame;
+  }
+
+  return changed;
+}
+
+void SequencerClass::startKeyframe(uint32_t start) {
+  const uint8_t *keyframe =
+      &_program[SEQUENCE_HEADER_SIZE + _index * SEQUENCE_KEYFRAME_SIZE];
+  uint8_t flags = keyframe[0];
+  uint32_t duration =
+      (keyframe[6] | (keyframe[7] << 8)) * (uint32_t)SEQUENCER_TIME_UNIT;
+  uint8_t jitter = (flags & KEYFRAME_JITTER) >> KEYFRAME_JITTER_SHIFT;
+
+  Frame target;
+  if (flags & KEYFRAME_BASE_COLOR) {
+    target.color = _base.color;
+  } else {
+    target.color = {keyframe[1], keyframe[2], keyframe[3], keyframe[4]};
+  }
+
+  uint16_t brightness = keyframe[5];
+  if (flags & KEYFRAME_SCALE) {
+    brightness = (brightness * _base.brightness + 127) / 255;
+  }
+
+  // Random variation: lower brightness and a duration of 50 - 150%
+  if (jitter > 0) {
+    uint16_t dip = nextRandom() % (jitter * 32 + 1);
+    brightness = (brightness > dip) ? brightness - dip : 0;
+    duration = duration / 2 + nextRandom() % (duration + 1);
+  }
+  target.brightness = brightness;
+
+  if (flags & KEYFRAME_HOLD) {
+    // Jump to the levels and hold them for the duration
+    _frame = target;
+    _changed = true;
+  }
+
+  _transition.begin(_frame, target, start, duration,
+                    (easing_t)(flags & KEYFRAME_EASING));
+  _end = start + duration;
+}
+
+uint32_t SequencerClass::nextRandom(void) {
+  _random ^= _random << 13;
+  _random ^= _random >> 17;
+  _random ^= _random << 5;
+
+  return _random;
+}
@@ -0,0 +1,241 @@
+/**
+ * AiLight Library - Effect Sequencer
+ *
+ * The sequencer runs light effects on the device, so they don't need to be
+ * driven by a stream of commands. An effect is a small program of keyframes:
+ * each keyframe has target levels, a duration and an easing curve, and the
+ * whole program can be repeated a number of times. The keyframes are rendered
+ * by the transition engine.
+ *
+ * Programs are stored in a compact binary form (4 byte header followed by 8
+ * bytes per keyframe, all values little endian):
+ *
+ *   Header:   magic (SEQUENCE_MAGIC), number of keyframes, number of loops (0
+ *             is endless), flags (SEQUENCE_*)
+ *   Keyframe: flags (KEYFRAME_*), red, green, blue, white, brightness,
+ *             duration (16 bit, in units of SEQUENCER_TIME_UNIT milliseconds)
+ *
+ * The built-in effects (breathe, colour loop, candle, strobe and flash) are
+ * programs in the same format, kept in program memory.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Sequencer_h
+#define AiLight_Sequencer_h
+
+#include "Transition.hpp"
+#include <stddef.h>
+
+// Program format
+#define SEQUENCE_MAGIC 0xE5
+#define SEQUENCE_HEADER_SIZE 4
+#define SEQUENCE_KEYFRAME_SIZE 8
+#define SEQUENCER_MAX_KEYFRAMES 16
+#define SEQUENCER_PROGRAM_MAX                                                  \
+  (SEQUENCE_HEADER_SIZE + SEQUENCER_MAX_KEYFRAMES * SEQUENCE_KEYFRAME_SIZE)
+
+// Unit of the keyframe durations (in milliseconds)
+#define SEQUENCER_TIME_UNIT 10
+
+// Program flags
+#define SEQUENCE_RESTORE 0x01 // Restore the light once the program has ended
+
+// Keyframe flags
+#define KEYFRAME_EASING 0x03     // Easing curve (easing_t)
+#define KEYFRAME_HOLD 0x04       // Jump to the levels (instead of a transition)
+#define KEYFRAME_BASE_COLOR 0x08 // Use the colour the effect was started with
+#define KEYFRAME_SCALE 0x10      // Brightness relative to the starting level
+#define KEYFRAME_JITTER 0xE0     // Random variation of brightness and duration
+#define KEYFRAME_JITTER_SHIFT 5
+
+// Effects
+enum effect_t : uint8_t {
+  EFFECT_NONE = 0,
+  EFFECT_BREATHE = 1,
+  EFFECT_COLOR_LOOP = 2,
+  EFFECT_CANDLE = 3,
+  EFFECT_STROBE = 4,
+  EFFECT_CUSTOM = 5, // The uploaded program
+  EFFECT_FLASH = 6   // Used for the flash attribute only
+};
+
+// Number of effects that can be selected by name
+#define EFFECT_NAMED 6
+
+class SequencerClass {
+public:
+  /**
+   * @brief Returns the name of an effect
+   *
+   * @param effect the effect
+   *
+   * @return the name of the effect (NULL if it can't be selected by name)
+   */
+  static const char *getEffectName(uint8_t effect);
+
+  /**
+   * @brief Looks up an effect by its name
+   *
+   * @param name the name of the effect (does not need to be NUL terminated)
+   * @param length the length of the name
+   * @param effect the effect with the given name
+   *
+   * @return true if the effect exists, otherwise false
+   */
+  static bool findEffect(const char *name, size_t length, uint8_t &effect);
+
+  /**
+   * @brief Checks whether a program is valid
+   *
+   * @param program the program (in RAM)
+   * @param length the length of the program
+   *
+   * @return true if the program is valid, otherwise false
+   */
+  static bool validate(const uint8_t *program, size_t length);
+
+  /**
+   * @brief Seeds the random generator used for the jitter of keyframes
+   *
+   * @param seed the seed (any value but zero)
+   *
+   * @return void
+   */
+  void seed(uint32_t seed);
+
+  /**
+   * @brief Hands over an uploaded program (network side)
+   *
+   * The program is taken over by the main loop with take(). Only a single
+   * program can be waiting at a time.
+   *
+   * @param program the (validated) program
+   * @param length the length of the program
+   *
+   * @return true if the program has been handed over, false if another
+   * program is still waiting
+   */
+  bool post(const uint8_t *program, size_t length);
+
+  /**
+   * @brief Discards the program handed over with post() (network side)
+   *
+   * To be used if the command belonging to the program can't be queued.
+   *
+   * @return void
+   */
+  void discard(void);
+
+  /**
+   * @brief Stores the program handed over with post() as the custom effect
+   * (main loop side)
+   *
+   * @return true if a program has been taken, otherwise false
+   */
+  bool take(void);
+
+  /**
+   * @brief Starts an effect
+   *
+   * @param effect the effect to run
+   * @param base the levels the effect is based on (for keyframes using the
+   * starting colour and/or brightness)
+   * @param from the levels currently shown
+   * @param now the current (monotonic) time in milliseconds
+   * @param loops the number of loops, overruling the program (0 to use the
+   * number of loops of the program)
+   *
+   * @return true if the effect has been started, otherwise false
+   */
+  bool begin(uint8_t effect, const Frame &base, const Frame &from,
+             uint32_t now, uint16_t loops = 0);
+
+  /**
+   * @brief Stops the running effect, leaving the output as it is
+   *
+   * @return void
+   */
+  void stop(void);
+
+  /**
+   * @brief Returns whether an effect is running
+   *
+   * @return true if an effect is running, otherwise false
+   */
+  bool isRunning(void);
+
+  /**
+   * @brief Returns the effect running (or the last effect run)
+   *
+   * @return the effect
+   */
+  uint8_t getEffect(void);
+
+  /**
+   * @brief Returns whether the light is to be restored once the effect has
+   * ended
+   *
+   * @return true if the light is to be restored, otherwise false
+   */
+  bool restores(void);
+
+  /**
+   * @brief Calculates the light frame for the given moment
+   *
+   * The frame is only written to if the output has changed, so callers only
+   * need to push a frame to the LED driver when this method returns true.
+   *
+   * @param now the current (monotonic) time in milliseconds
+   * @param frame the light frame to hold the calculated levels
+   *
+   * @return true if the output has changed, otherwise false
+   */
+  bool update(uint32_t now, Frame &frame);
+
+private:
+  TransitionClass _transition;
+
+  uint8_t _program[SEQUENCER_PROGRAM_MAX]; // The running program
+  uint8_t _custom[SEQUENCER_PROGRAM_MAX];  // The uploaded program
+  bool _has_custom = false;
+
+  // Program handed over by the network side (single slot mailbox)
+  uint8_t _mailbox[SEQUENCER_PROGRAM_MAX];
+  size_t _mailbox_length = 0;
+  bool _mailbox_full = false;
+
+  bool _running = false;
+  uint8_t _effect = EFFECT_NONE;
+  uint8_t _index = 0; // Keyframe being rendered
+  uint16_t _loops = 0; // Loops left (0 is endless)
+  bool _changed = false;
+  uint32_t _end = 0; // Scheduled end of the keyframe being rendered
+
+  Frame _base;  // Levels the effect is based on
+  Frame _frame; // Levels last emitted
+
+  uint32_t _random = 0x2545F491UL; // State of the random generator
+
+  /**
+   * @brief Starts rendering the current keyframe
+   *
+   * @param start the (scheduled) start of the keyframe in milliseconds
+   *
+   * @return void
+   */
+  void startKeyframe(uint32_t start);
+
+  /**
+   * @brief Returns a pseudo random number (xorshift32)
+   */
+  uint32_t nextRandom(void);
+};
+
+#endif
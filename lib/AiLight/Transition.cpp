@@ -0,0 +1,169 @@
+/**
+ * AiLight Library - Transition Engine
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "Transition.hpp"
+
+/**
+ * @brief Integer square root (rounded down)
+ *
+ * @param value the value to take the square root of
+ *
+ * @return the square root of the given value
+ */
+static uint16_t isqrt(uint32_t value) {
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+
+  while (bit > value) {
+    bit >>= 2;
+  }
+
+  while (bit != 0) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return root;
+}
+
+/**
+ * @brief Copies the channels of a light frame into a flat array
+ */
+static void unpack(const Frame &frame, uint8_t *levels) {
+  levels[0] = frame.color.red;
+  levels[1] = frame.color.green;
+  levels[2] = frame.color.blue;
+  levels[3] = frame.color.white;
+  levels[4] = frame.brightness;
+}
+
+/**
+ * @brief Copies a flat array of channel levels into a light frame
+ */
+static void pack(const uint8_t *levels, Frame &frame) {
+  frame.color.red = levels[0];
+  frame.color.green = levels[1];
+  frame.color.blue = levels[2];
+  frame.color.white = levels[3];
+  frame.brightness = levels[4];
+}
+
+void TransitionClass::begin(const Frame &from, const Frame &to, uint32_t now,
+                            uint32_t duration, easing_t easing) {
+  uint8_t levels[TRANSITION_CHANNELS];
+
+  _easing = easing;
+  _start = now;
+  _duration = duration;
+  _rate = (duration > 0) ? 0xFFFFFFFFUL / duration : 0;
+  _target = to;
+
+  unpack(from, levels);
+  for (uint8_t i = 0; i < TRANSITION_CHANNELS; i++) {
+    _from[i] = encode(levels[i]);
+    _last[i] = levels[i];
+  }
+
+  unpack(to, levels);
+  for (uint8_t i = 0; i < TRANSITION_CHANNELS; i++) {
+    _to[i] = encode(levels[i]);
+  }
+
+  _running = true;
+}
+
+void TransitionClass::stop(void) { _running = false; }
+
+bool TransitionClass::isRunning(void) { return _running; }
+
+Frame TransitionClass::getTarget(void) { return _target; }
+
+bool TransitionClass::update(uint32_t now, Frame &frame) {
+  if (!_running) {
+    return false;
+  }
+
+  uint32_t elapsed = now - _start; // Wraps correctly on timer overflow
+  uint8_t levels[TRANSITION_CHANNELS];
+  bool changed = false;
+
+  if (elapsed >= _duration) {
+    unpack(_target, levels);
+    _running = false;
+  } else {
+    int32_t p = progress(elapsed);
+
+    for (uint8_t i = 0; i < TRANSITION_CHANNELS; i++) {
+      int32_t delta = (int32_t)_to[i] - _from[i];
+      levels[i] = decode(_from[i] + ((delta * p) >> TRANSITION_PROGRESS_BITS));
+    }
+  }
+
+  for (uint8_t i = 0; i < TRANSITION_CHANNELS; i++) {
+    if (levels[i] != _last[i]) {
+      _last[i] = levels[i];
+      changed = true;
+    }
+  }
+
+  if (changed) {
+    pack(levels, frame);
+  }
+
+  return changed;
+}
+
+uint32_t TransitionClass::progress(uint32_t elapsed) {
+  // elapsed / duration in Q0.15, using the precalculated reciprocal instead of
+  // a division
+  uint32_t p = ((uint64_t)elapsed * _rate) >> (32 - TRANSITION_PROGRESS_BITS);
+
+  if (p > TRANSITION_PROGRESS_MAX) {
+    p = TRANSITION_PROGRESS_MAX;
+  }
+
+  if (_easing == EASING_EASE_IN_OUT) {
+    // Smoothstep: 3p^2 - 2p^3
+    uint32_t p2 = (p * p) >> TRANSITION_PROGRESS_BITS;
+    p = (p2 * (3 * TRANSITION_PROGRESS_MAX - 2 * p)) >>
+        TRANSITION_PROGRESS_BITS;
+  }
+
+  return p;
+}
+
+uint16_t TransitionClass::encode(uint8_t level) {
+  // Perceptual transitions are interpolated in square root space (Q4.12),
+  // which approximates the lightness response of the human eye
+  if (_easing == EASING_PERCEPTUAL) {
+    return isqrt((uint32_t)level << 24);
+  }
+
+  return (uint16_t)level << 8; // Q8.8
+}
+
+uint8_t TransitionClass::decode(uint16_t value) {
+  uint32_t level = value;
+
+  if (_easing == EASING_PERCEPTUAL) {
+    level = (level * level) >> 16;
+  }
+
+  level = (level + 0x80) >> 8; // Round to nearest
+
+  return (level > 0xFF) ? 0xFF : level;
+}
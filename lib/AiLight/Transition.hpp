@@ -0,0 +1,127 @@
+/**
+ * AiLight Library - Transition Engine
+ *
+ * The transition engine interpolates all channels of a light frame (RGBW and
+ * brightness) together in fixed-point arithmetic between a start and end
+ * timestamp. It has no dependencies on the Arduino framework so it can be used
+ * (and tested) on any host.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_Transition_h
+#define AiLight_Transition_h
+
+#include "Color.hpp"
+
+// Number of channels interpolated by a transition (RGBW + brightness)
+#define TRANSITION_CHANNELS 5
+
+// Fixed-point precision (in bits) of the transition progress
+#define TRANSITION_PROGRESS_BITS 15
+#define TRANSITION_PROGRESS_MAX (1UL << TRANSITION_PROGRESS_BITS)
+
+// Easing curves
+enum easing_t : uint8_t {
+  EASING_LINEAR = 0,      // Constant rate of change
+  EASING_EASE_IN_OUT = 1, // Slow start and end (smoothstep)
+  EASING_PERCEPTUAL = 2   // Linear in (approximately) perceived lightness
+};
+
+class TransitionClass {
+public:
+  /**
+   * @brief Starts a transition between two light frames
+   *
+   * @param from the light frame to start the transition from
+   * @param to the light frame to end the transition with
+   * @param now the current (monotonic) time in milliseconds
+   * @param duration the duration of the transition in milliseconds
+   * @param easing the easing curve to apply
+   *
+   * @return void
+   */
+  void begin(const Frame &from, const Frame &to, uint32_t now,
+             uint32_t duration, easing_t easing = EASING_LINEAR);
+
+  /**
+   * @brief Stops a running transition, leaving the output as it is
+   *
+   * @return void
+   */
+  void stop(void);
+
+  /**
+   * @brief Returns whether a transition is in progress
+   *
+   * @return true if a transition is in progress, otherwise false
+   */
+  bool isRunning(void);
+
+  /**
+   * @brief Returns the light frame the transition ends with
+   *
+   * @return the target light frame
+   */
+  Frame getTarget(void);
+
+  /**
+   * @brief Calculates the light frame for the given moment
+   *
+   * The frame is only written to if the quantized (8-bit) output differs from
+   * the previously calculated frame, so callers only need to push a frame to
+   * the LED driver when this method returns true. Once the end timestamp has
+   * been reached the target frame is emitted and the transition stops.
+   *
+   * @param now the current (monotonic) time in milliseconds
+   * @param frame the light frame to hold the calculated levels
+   *
+   * @return true if the output has changed, otherwise false
+   */
+  bool update(uint32_t now, Frame &frame);
+
+private:
+  bool _running = false;
+  easing_t _easing = EASING_LINEAR;
+
+  uint32_t _start = 0;    // Start timestamp (in milliseconds)
+  uint32_t _duration = 0; // Duration (in milliseconds)
+  uint32_t _rate = 0;     // Reciprocal of the duration (Q0.32)
+
+  // Channel levels at the start and end of the transition in the working
+  // space of the easing curve (Q8.8 or Q4.12 square root for perceptual)
+  uint16_t _from[TRANSITION_CHANNELS];
+  uint16_t _to[TRANSITION_CHANNELS];
+
+  // Last emitted 8-bit channel levels
+  uint8_t _last[TRANSITION_CHANNELS];
+
+  Frame _target;
+
+  /**
+   * @brief Calculates the eased progress for the given moment
+   *
+   * @param elapsed the time elapsed since the start (in milliseconds)
+   *
+   * @return the eased progress (range 0 - TRANSITION_PROGRESS_MAX)
+   */
+  uint32_t progress(uint32_t elapsed);
+
+  /**
+   * @brief Converts an 8-bit level into the working space of the easing curve
+   */
+  uint16_t encode(uint8_t level);
+
+  /**
+   * @brief Converts a working space value back into a rounded 8-bit level
+   */
+  uint8_t decode(uint16_t value);
+};
+
+#endif
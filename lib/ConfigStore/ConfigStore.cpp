@@ -0,0 +1,144 @@
+/**
+ * ConfigStore Library
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "ConfigStore.hpp"
+#include <string.h>
+
+size_t ConfigStoreClass::encode(const void *config,
+                                const config_field_t *fields, uint8_t count,
+                                uint8_t version, uint8_t *buffer,
+                                size_t size) {
+  const uint8_t *base = (const uint8_t *)config;
+  size_t length = CONFIG_STORE_HEADER_SIZE;
+
+  for (uint8_t i = 0; i < count; i++) {
+    const config_field_t &field = fields[i];
+    const uint8_t *value = base + field.offset;
+    size_t value_length = field.size;
+
+    // Strings only take the bytes used
+    if (field.type == CONFIG_FIELD_STRING) {
+      value_length = strnlen((const char *)value, field.size - 1);
+    }
+
+    if (value_length > 0xFF ||
+        length + CONFIG_STORE_RECORD_SIZE + value_length > size) {
+      return 0;
+    }
+
+    buffer[length++] = field.tag;
+    buffer[length++] = value_length;
+    memcpy(buffer + length, value, value_length);
+    length += value_length;
+  }
+
+  size_t records = length - CONFIG_STORE_HEADER_SIZE;
+  buffer[0] = CONFIG_STORE_MAGIC & 0xFF;
+  buffer[1] = CONFIG_STORE_MAGIC >> 8;
+  buffer[2] = version;
+  buffer[3] = 0;
+  buffer[4] = records & 0xFF;
+  buffer[5] = records >> 8;
+
+  uint16_t crc = crc16(0xFFFF, buffer + 2, 4);
+  crc = crc16(crc, buffer + CONFIG_STORE_HEADER_SIZE, records);
+  buffer[6] = crc & 0xFF;
+  buffer[7] = crc >> 8;
+
+  return length;
+}
+
+uint8_t ConfigStoreClass::decode(const uint8_t *buffer, size_t size,
+                                 const config_field_t *fields, uint8_t count,
+                                 void *config, uint8_t &version) {
+  if (size < CONFIG_STORE_HEADER_SIZE ||
+      (buffer[0] | buffer[1] << 8) != CONFIG_STORE_MAGIC) {
+    return CONFIG_STORE_EMPTY;
+  }
+
+  size_t records = buffer[4] | buffer[5] << 8;
+  if (records > size - CONFIG_STORE_HEADER_SIZE) {
+    return CONFIG_STORE_CORRUPT;
+  }
+
+  uint16_t crc = crc16(0xFFFF, buffer + 2, 4);
+  crc = crc16(crc, buffer + CONFIG_STORE_HEADER_SIZE, records);
+  if ((buffer[6] | buffer[7] << 8) != crc) {
+    return CONFIG_STORE_CORRUPT;
+  }
+
+  const uint8_t *start = buffer + CONFIG_STORE_HEADER_SIZE;
+  const uint8_t *end = start + records;
+  const uint8_t *record;
+
+  // The records are to end exactly at the end of the blob (checked before
+  // decoding, so nothing is decoded from a corrupt blob)
+  for (record = start; end - record >= CONFIG_STORE_RECORD_SIZE;) {
+    record += CONFIG_STORE_RECORD_SIZE + record[1];
+  }
+  if (record != end) {
+    return CONFIG_STORE_CORRUPT;
+  }
+
+  version = buffer[2];
+
+  uint8_t *base = (uint8_t *)config;
+  for (record = start; record < end;) {
+    uint8_t tag = record[0];
+    uint8_t length = record[1];
+    const uint8_t *value = record + CONFIG_STORE_RECORD_SIZE;
+    record = value + length;
+
+    // Records without a field (e.g. of a newer firmware) are skipped
+    for (uint8_t i = 0; i < count; i++) {
+      const config_field_t &field = fields[i];
+      if (field.tag != tag) {
+        continue;
+      }
+
+      if (field.type == CONFIG_FIELD_STRING) {
+        size_t copied = (length < field.size) ? length : field.size - 1;
+        memcpy(base + field.offset, value, copied);
+        base[field.offset + copied] = '\0';
+      } else if (length == field.size) {
+        memcpy(base + field.offset, value, length);
+      }
+      break;
+    }
+  }
+
+  return CONFIG_STORE_OK;
+}
+
+size_t ConfigStoreClass::getMaxLength(const config_field_t *fields,
+                                      uint8_t count) {
+  size_t length = CONFIG_STORE_HEADER_SIZE;
+
+  for (uint8_t i = 0; i < count; i++) {
+    length += CONFIG_STORE_RECORD_SIZE + fields[i].size;
+  }
+
+  return length;
+}
+
+uint16_t ConfigStoreClass::crc16(uint16_t crc, const uint8_t *data,
+                                 size_t length) {
+  // CRC-16/CCITT-FALSE (initial value 0xFFFF)
+  while (length--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (uint8_t i = 0; i < 8; i++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+
+  return crc;
+}
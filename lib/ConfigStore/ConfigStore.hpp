@@ -0,0 +1,110 @@
+/**
+ * ConfigStore Library
+ *
+ * The ConfigStore encodes the configuration settings into a compact, versioned
+ * blob of tag-length-value records rather than dumping the configuration
+ * structure as is. Each field of the structure is described by a table entry
+ * (tag, type, offset and size); strings only take the bytes used. Since fields
+ * are identified by their tag rather than their position, fields can be added
+ * to (or removed from) the structure without losing the other settings: fields
+ * missing from the blob keep their defaults and unknown records are skipped.
+ * Changes in the meaning of a field are handled by migrations, based on the
+ * version stored with the blob.
+ *
+ * Blob (little endian): magic ('A', 'C'), version, reserved, length of the
+ * records (16 bit) and the CRC-16 of all bytes from the version onwards,
+ * followed by the records: tag, length (8 bit) and value.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef ConfigStore_h
+#define ConfigStore_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Marker identifying a configuration blob ('A', 'C')
+#define CONFIG_STORE_MAGIC 0x4341
+
+// Size of the blob header and of a record header
+#define CONFIG_STORE_HEADER_SIZE 8
+#define CONFIG_STORE_RECORD_SIZE 2
+
+// Field types
+#define CONFIG_FIELD_BINARY 0 // Fixed size, only decoded if the size matches
+#define CONFIG_FIELD_STRING 1 // NUL terminated, stored without the NUL
+
+// Results of decoding a blob
+#define CONFIG_STORE_OK 0      // Decoded
+#define CONFIG_STORE_EMPTY 1   // No blob (e.g. erased, or another format)
+#define CONFIG_STORE_CORRUPT 2 // Invalid length or checksum
+
+// A field of the configuration structure
+struct config_field_t {
+  uint8_t tag;     // Tag (unique, never to be reused for another field)
+  uint8_t type;    // CONFIG_FIELD_*
+  uint16_t offset; // Offset of the field in the structure
+  uint16_t size;   // Size of the field (including the NUL of strings)
+};
+
+class ConfigStoreClass {
+public:
+  /**
+   * @brief Encodes a configuration structure into a blob
+   *
+   * @param config the configuration structure
+   * @param fields the fields of the structure
+   * @param count the number of fields
+   * @param version the version of the configuration
+   * @param buffer the buffer to hold the blob
+   * @param size the size of the buffer
+   *
+   * @return the length of the blob (0 if it doesn't fit)
+   */
+  static size_t encode(const void *config, const config_field_t *fields,
+                       uint8_t count, uint8_t version, uint8_t *buffer,
+                       size_t size);
+
+  /**
+   * @brief Decodes a blob into a configuration structure
+   *
+   * Fields without a (valid) record are left untouched, so the structure is to
+   * hold the defaults beforehand. Nothing is decoded if the blob is empty or
+   * corrupt (i.e. its checksum doesn't match, or its records don't end exactly
+   * at the end of the blob).
+   *
+   * @param buffer the buffer holding the blob
+   * @param size the size of the buffer
+   * @param fields the fields of the structure
+   * @param count the number of fields
+   * @param config the configuration structure
+   * @param version the variable to hold the version of the configuration
+   *
+   * @return the result (CONFIG_STORE_*)
+   */
+  static uint8_t decode(const uint8_t *buffer, size_t size,
+                        const config_field_t *fields, uint8_t count,
+                        void *config, uint8_t &version);
+
+  /**
+   * @brief Returns the maximum length of the blob of a configuration
+   *
+   * @param fields the fields of the structure
+   * @param count the number of fields
+   *
+   * @return the maximum length of the blob
+   */
+  static size_t getMaxLength(const config_field_t *fields, uint8_t count);
+
+private:
+  static uint16_t crc16(uint16_t crc, const uint8_t *data, size_t length);
+};
+
+#endif
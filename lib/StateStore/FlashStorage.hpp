@@ -0,0 +1,63 @@
+/**
+ * StateStore Library - Flash Storage Interface
+ *
+ * Abstraction of the flash memory used by the StateStore. The firmware uses
+ * the SPI flash of the ESP8266 (see SPIFlashStorage.hpp); other
+ * implementations (e.g. the in-memory emulation of RAMFlashStorage.hpp) allow
+ * the StateStore to run on any host.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef StateStore_FlashStorage_h
+#define StateStore_FlashStorage_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Size of an erasable flash sector
+#define FLASH_STORAGE_SECTOR_SIZE 4096
+
+class FlashStorage {
+public:
+  virtual ~FlashStorage(void) {}
+
+  /**
+   * @brief Reads data from the flash memory
+   *
+   * @param address the (4-byte aligned) flash address to read from
+   * @param data the (4-byte aligned) buffer to read into
+   * @param size the number of bytes to read (multiple of 4)
+   *
+   * @return true if successful, otherwise false
+   */
+  virtual bool read(uint32_t address, void *data, size_t size) = 0;
+
+  /**
+   * @brief Writes data to (erased) flash memory
+   *
+   * @param address the (4-byte aligned) flash address to write to
+   * @param data the (4-byte aligned) data to be written
+   * @param size the number of bytes to write (multiple of 4)
+   *
+   * @return true if successful, otherwise false
+   */
+  virtual bool write(uint32_t address, const void *data, size_t size) = 0;
+
+  /**
+   * @brief Erases a flash sector (i.e. sets all bytes to 0xFF)
+   *
+   * @param sector the number of the sector to erase
+   *
+   * @return true if successful, otherwise false
+   */
+  virtual bool erase(uint16_t sector) = 0;
+};
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * StateStore Library - RAM Flash Storage
+ *
+ * In-memory emulation of (NOR) flash memory, allowing the StateStore to run on
+ * any host (e.g. the native benchmarks). Like real flash, writing can only
+ * clear bits, so writing to flash that hasn't been erased corrupts it. The
+ * erases are counted per sector, and writes can be made to fail, to check the
+ * wear levelling and the error handling of the StateStore.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef StateStore_RAMFlashStorage_h
+#define StateStore_RAMFlashStorage_h
+
+#include "FlashStorage.hpp"
+#include <string.h>
+
+class RAMFlashStorage : public FlashStorage {
+public:
+  /**
+   * @brief Creates the (erased) flash memory
+   *
+   * @param sector the number of the first emulated sector
+   * @param sectors the number of emulated sectors
+   */
+  RAMFlashStorage(uint16_t sector, uint8_t sectors)
+      : _sector(sector), _sectors(sectors) {
+    _data = new uint8_t[(size_t)sectors * FLASH_STORAGE_SECTOR_SIZE];
+    _erases = new uint32_t[sectors]();
+    memset(_data, 0xFF, (size_t)sectors * FLASH_STORAGE_SECTOR_SIZE);
+  }
+
+  RAMFlashStorage(const RAMFlashStorage &) = delete;
+  RAMFlashStorage &operator=(const RAMFlashStorage &) = delete;
+
+  ~RAMFlashStorage(void) {
+    delete[] _data;
+    delete[] _erases;
+  }
+
+  bool read(uint32_t address, void *data, size_t size) {
+    if (!isValid(address, size)) {
+      return false;
+    }
+
+    memcpy(data, getData(address), size);
+
+    return true;
+  }
+
+  bool write(uint32_t address, const void *data, size_t size) {
+    if (!isValid(address, size)) {
+      return false;
+    }
+
+    if (_failures > 0) {
+      _failures--;
+      return false;
+    }
+
+    uint8_t *target = getData(address);
+    const uint8_t *source = (const uint8_t *)data;
+    for (size_t i = 0; i < size; i++) {
+      target[i] &= source[i];
+    }
+
+    return true;
+  }
+
+  bool erase(uint16_t sector) {
+    if (sector < _sector || sector >= _sector + _sectors) {
+      return false;
+    }
+
+    memset(getData((uint32_t)sector * FLASH_STORAGE_SECTOR_SIZE), 0xFF,
+           FLASH_STORAGE_SECTOR_SIZE);
+    _erases[sector - _sector]++;
+
+    return true;
+  }
+
+  /**
+   * @brief Makes the next writes fail (without changing the flash memory)
+   *
+   * @param count the number of writes to fail
+   *
+   * @return void
+   */
+  void failWrites(uint32_t count) { _failures = count; }
+
+  /**
+   * @brief Returns the number of times a sector has been erased
+   *
+   * @param sector the number of the sector
+   *
+   * @return the number of erases
+   */
+  uint32_t getEraseCount(uint16_t sector) { return _erases[sector - _sector]; }
+
+  /**
+   * @brief Gives direct access to the flash memory (e.g. to corrupt it)
+   *
+   * @param address the flash address
+   *
+   * @return the emulated flash memory at the address
+   */
+  uint8_t *getData(uint32_t address) {
+    return _data + (address - (uint32_t)_sector * FLASH_STORAGE_SECTOR_SIZE);
+  }
+
+private:
+  uint16_t _sector;
+  uint8_t _sectors;
+  uint8_t *_data;
+  uint32_t *_erases;
+  uint32_t _failures = 0;
+
+  // Whether an access is aligned and within the emulated sectors
+  bool isValid(uint32_t address, size_t size) {
+    uint32_t start = (uint32_t)_sector * FLASH_STORAGE_SECTOR_SIZE;
+    uint32_t end = start + (uint32_t)_sectors * FLASH_STORAGE_SECTOR_SIZE;
+
+    return address % 4 == 0 && size % 4 == 0 && address >= start &&
+           address <= end && size <= end - address;
+  }
+};
+
+#endif
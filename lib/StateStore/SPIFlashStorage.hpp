@@ -0,0 +1,51 @@
+/**
+ * StateStore Library - ESP8266 SPI Flash Storage
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef StateStore_SPIFlashStorage_h
+#define StateStore_SPIFlashStorage_h
+
+#include "FlashStorage.hpp"
+#include <Arduino.h>
+
+extern "C" {
+#include "spi_flash.h"
+}
+
+class SPIFlashStorage : public FlashStorage {
+public:
+  bool read(uint32_t address, void *data, size_t size) {
+    noInterrupts();
+    SpiFlashOpResult result = spi_flash_read(address, (uint32_t *)data, size);
+    interrupts();
+
+    return result == SPI_FLASH_RESULT_OK;
+  }
+
+  bool write(uint32_t address, const void *data, size_t size) {
+    noInterrupts();
+    SpiFlashOpResult result =
+        spi_flash_write(address, (uint32_t *)data, size);
+    interrupts();
+
+    return result == SPI_FLASH_RESULT_OK;
+  }
+
+  bool erase(uint16_t sector) {
+    noInterrupts();
+    SpiFlashOpResult result = spi_flash_erase_sector(sector);
+    interrupts();
+
+    return result == SPI_FLASH_RESULT_OK;
+  }
+};
+
+#endif
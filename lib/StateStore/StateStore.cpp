@@ -0,0 +1,224 @@
+/**
+ * StateStore Library
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#include "StateStore.hpp"
+#include <string.h>
+
+static_assert(sizeof(state_record_t) == 16,
+              "State records must be 16 bytes (a multiple of 4)");
+
+// Number of records that fit in a flash sector
+#define STATE_RECORDS_PER_SECTOR                                               \
+  (FLASH_STORAGE_SECTOR_SIZE / sizeof(state_record_t))
+
+void StateStoreClass::begin(FlashStorage *flash, uint16_t sector,
+                            uint8_t sectors, uint32_t delay) {
+  _flash = flash;
+  _sector = sector;
+  _sectors = sectors;
+  _delay = delay;
+  _has_last = false;
+  _has_pending = false;
+  _next = 0;
+
+  // Find the most recent valid record. Records are written in order within a
+  // sector, so the scan of a sector ends at the first empty slot.
+  state_record_t record;
+  for (uint16_t slot = 0; slot < getSlots(); slot++) {
+    if (!_flash->read(getAddress(slot), &record, sizeof(record))) {
+      continue;
+    }
+
+    if (isEmpty(record)) {
+      slot |= STATE_RECORDS_PER_SECTOR - 1; // Skip to the next sector
+      continue;
+    }
+
+    if (isValid(record) &&
+        (!_has_last || (int32_t)(record.sequence - _last.sequence) > 0)) {
+      _last = record;
+      _has_last = true;
+      _next = (slot + 1) % getSlots();
+    }
+  }
+}
+
+bool StateStoreClass::load(light_state_t &state) {
+  if (!_has_last) {
+    return false;
+  }
+
+  state.is_on = _last.flags & 0x01;
+  state.gamma = _last.flags & 0x02;
+  state.brightness = _last.brightness;
+  state.color_temp = _last.color_temp;
+  state.red = _last.color[0];
+  state.green = _last.color[1];
+  state.blue = _last.color[2];
+  state.white = _last.color[3];
+
+  return true;
+}
+
+void StateStoreClass::save(const light_state_t &state, uint32_t now) {
+  encode(state, _pending);
+
+  // Nothing to do if this state has already been stored
+  if (_has_last && equals(_pending, _last)) {
+    _has_pending = false;
+    return;
+  }
+
+  // The delay runs from the first change not yet stored, so a steady stream of
+  // changes can't postpone the write indefinitely
+  if (!_has_pending) {
+    _has_pending = true;
+    _pending_since = now;
+  }
+}
+
+bool StateStoreClass::loop(uint32_t now) {
+  if (!_has_pending || (now - _pending_since) < _delay) {
+    return false;
+  }
+
+  if (!flush()) {
+    _pending_since = now; // Retry after another delay
+    return false;
+  }
+
+  return true;
+}
+
+bool StateStoreClass::flush(void) {
+  if (!_has_pending || _flash == nullptr) {
+    return false;
+  }
+
+  _pending.sequence = _has_last ? _last.sequence + 1 : 0;
+  _pending.magic = STATE_RECORD_MAGIC;
+  _pending.crc =
+      crc16((const uint8_t *)&_pending, offsetof(state_record_t, crc));
+
+  // Keep the state scheduled if it couldn't be written
+  if (!write(_pending)) {
+    return false;
+  }
+
+  _has_pending = false;
+  _last = _pending;
+  _has_last = true;
+  _commits++;
+
+  return true;
+}
+
+void StateStoreClass::clear(void) {
+  for (uint8_t i = 0; i < _sectors; i++) {
+    _flash->erase(_sector + i);
+  }
+
+  _has_last = false;
+  _has_pending = false;
+  _next = 0;
+}
+
+uint32_t StateStoreClass::getCommitCount(void) { return _commits; }
+
+uint16_t StateStoreClass::getSlots(void) {
+  return _sectors * STATE_RECORDS_PER_SECTOR;
+}
+
+uint32_t StateStoreClass::getAddress(uint16_t slot) {
+  return (uint32_t)_sector * FLASH_STORAGE_SECTOR_SIZE +
+         (uint32_t)slot * sizeof(state_record_t);
+}
+
+bool StateStoreClass::isEmpty(const state_record_t &record) {
+  const uint8_t *p = (const uint8_t *)&record;
+  for (uint8_t i = 0; i < sizeof(record); i++) {
+    if (p[i] != 0xFF) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool StateStoreClass::isValid(const state_record_t &record) {
+  return record.magic == STATE_RECORD_MAGIC &&
+         record.crc ==
+             crc16((const uint8_t *)&record, offsetof(state_record_t, crc));
+}
+
+bool StateStoreClass::write(state_record_t &record) {
+  state_record_t slot;
+
+  for (uint16_t attempt = 0; attempt < getSlots(); attempt++) {
+    // Entering a new sector: erase it (this drops the oldest records)
+    if (_next % STATE_RECORDS_PER_SECTOR == 0) {
+      if (!_flash->erase(_sector + _next / STATE_RECORDS_PER_SECTOR)) {
+        return false;
+      }
+    } else if (!_flash->read(getAddress(_next), &slot, sizeof(slot)) ||
+               !isEmpty(slot)) {
+      // Slot already used (e.g. an interrupted write): continue with the
+      // next sector
+      _next = (_next / STATE_RECORDS_PER_SECTOR + 1) *
+              STATE_RECORDS_PER_SECTOR % getSlots();
+      continue;
+    }
+
+    // After a failed write the slot is retried by the next write (skipping
+    // it would leave an empty slot, ending the scan at boot early). If a
+    // partial record has been written, the check above moves on instead.
+    if (!_flash->write(getAddress(_next), &record, sizeof(record))) {
+      return false;
+    }
+
+    _next = (_next + 1) % getSlots();
+
+    return true;
+  }
+
+  return false;
+}
+
+uint16_t StateStoreClass::crc16(const uint8_t *data, size_t length) {
+  uint16_t crc = 0xFFFF; // CRC-16/CCITT-FALSE
+
+  while (length--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (uint8_t i = 0; i < 8; i++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+
+  return crc;
+}
+
+void StateStoreClass::encode(const light_state_t &state,
+                             state_record_t &record) {
+  record.flags = (state.is_on ? 0x01 : 0x00) | (state.gamma ? 0x02 : 0x00);
+  record.brightness = state.brightness;
+  record.color_temp = state.color_temp;
+  record.color[0] = state.red;
+  record.color[1] = state.green;
+  record.color[2] = state.blue;
+  record.color[3] = state.white;
+}
+
+bool StateStoreClass::equals(const state_record_t &a, const state_record_t &b) {
+  return a.flags == b.flags && a.brightness == b.brightness &&
+         a.color_temp == b.color_temp &&
+         memcmp(a.color, b.color, sizeof(a.color)) == 0;
+}
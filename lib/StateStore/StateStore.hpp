@@ -0,0 +1,167 @@
+/**
+ * StateStore Library
+ *
+ * The StateStore persists the (frequently changing) state of the light
+ * separately from the configuration settings. States are journaled as small
+ * records, written round-robin across a number of flash sectors, so a sector
+ * only needs to be erased once every few hundred changes. Changes are
+ * batched: a state is only written a while after the first change since the
+ * last write, and only if it differs from the last state written. At boot,
+ * the most recent record with a valid checksum is recovered.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef StateStore_h
+#define StateStore_h
+
+#include "FlashStorage.hpp"
+
+// Marker identifying a state record
+#define STATE_RECORD_MAGIC 0xA15A
+
+// Sequence number of an empty (erased) record slot
+#define STATE_RECORD_EMPTY 0xFFFFFFFFUL
+
+// State of the light as persisted
+struct light_state_t {
+  bool is_on;          // Operational state (true == on)
+  bool gamma;          // Gamma Correction enabled or not
+  uint8_t brightness;  // Brightness level
+  uint16_t color_temp; // Colour temperature (in mired)
+  uint8_t red;         // RGBW channel levels
+  uint8_t green;
+  uint8_t blue;
+  uint8_t white;
+};
+
+// A journaled state record as stored in flash (16 bytes)
+struct state_record_t {
+  uint32_t sequence;   // Incremented for each record written
+  uint8_t flags;       // Bit 0: operational state, bit 1: gamma correction
+  uint8_t brightness;  // Brightness level
+  uint16_t color_temp; // Colour temperature (in mired)
+  uint8_t color[4];    // RGBW channel levels
+  uint16_t magic;      // STATE_RECORD_MAGIC
+  uint16_t crc;        // CRC-16 of all preceding bytes
+};
+
+class StateStoreClass {
+public:
+  /**
+   * @brief Initializes the StateStore and recovers the most recent state
+   *
+   * @param flash the flash memory to store the state records in
+   * @param sector the first flash sector reserved for the state records
+   * @param sectors the number of flash sectors reserved (at least 2)
+   * @param delay the time (in milliseconds) a state needs to be stable before
+   * it is written
+   *
+   * @return void
+   */
+  void begin(FlashStorage *flash, uint16_t sector, uint8_t sectors,
+             uint32_t delay);
+
+  /**
+   * @brief Returns the most recently stored state
+   *
+   * @param state the structure to hold the stored state
+   *
+   * @return true if a stored state is available, otherwise false
+   */
+  bool load(light_state_t &state);
+
+  /**
+   * @brief Schedules a state to be stored
+   *
+   * The state is written once the configured delay has passed since the first
+   * change that hasn't been stored yet (see loop()), so later changes within
+   * the delay are written along with it. Nothing is written if it equals the
+   * last state stored.
+   *
+   * @param state the state to be stored
+   * @param now the current (monotonic) time in milliseconds
+   *
+   * @return void
+   */
+  void save(const light_state_t &state, uint32_t now);
+
+  /**
+   * @brief Writes the scheduled state once the delay has passed
+   *
+   * If the write fails, the state remains scheduled and is retried after
+   * another delay.
+   *
+   * @param now the current (monotonic) time in milliseconds
+   *
+   * @return true if a state has been written, otherwise false
+   */
+  bool loop(uint32_t now);
+
+  /**
+   * @brief Immediately writes the scheduled state (e.g. before a restart)
+   *
+   * If the write fails, the state remains scheduled.
+   *
+   * @return true if a state has been written, otherwise false
+   */
+  bool flush(void);
+
+  /**
+   * @brief Erases all stored states
+   *
+   * @return void
+   */
+  void clear(void);
+
+  /**
+   * @brief Returns the number of records written since boot
+   *
+   * @return the number of records written
+   */
+  uint32_t getCommitCount(void);
+
+private:
+  FlashStorage *_flash = nullptr;
+  uint16_t _sector = 0;
+  uint8_t _sectors = 0;
+  uint32_t _delay = 0;
+
+  state_record_t _last;      // Last record written (or recovered)
+  bool _has_last = false;    // Whether a record has been written/recovered
+  state_record_t _pending;   // Record waiting to be written
+  bool _has_pending = false; // Whether a record is waiting to be written
+  uint32_t _pending_since = 0;
+  uint16_t _next = 0; // Slot (over all sectors) for the next record
+
+  uint32_t _commits = 0;
+
+  // Number of record slots over all reserved sectors
+  uint16_t getSlots(void);
+
+  // Flash address of a record slot
+  uint32_t getAddress(uint16_t slot);
+
+  // Whether a record slot has not been written since the last erase
+  bool isEmpty(const state_record_t &record);
+
+  // Whether a record is complete (magic and checksum)
+  bool isValid(const state_record_t &record);
+
+  // Writes a record to the next slot, erasing its sector when needed
+  bool write(state_record_t &record);
+
+  static uint16_t crc16(const uint8_t *data, size_t length);
+  static void encode(const light_state_t &state, state_record_t &record);
+
+  // Whether two records hold the same state (sequence/checksum excluded)
+  static bool equals(const state_record_t &a, const state_record_t &b);
+};
+
+#endif
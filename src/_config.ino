@@ -0,0 +1,86 @@
+/**
+ * AiLight Firmware - Config Module
+ *
+ * The Config module holds all the code to store the configuration settings in
+ * the EEPROM. The settings are encoded by the ConfigStore as tag-length-value
+ * records (see ConfigStore.hpp), so fields can be added to or removed from
+ * config_t without losing the other settings on an upgrade.
+ *
+ * The configuration structure and the fields stored are described in
+ * configuration.h.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+/**
+ * @brief Migrates a configuration stored as raw config_legacy_t (i.e. by
+ * firmware before the ConfigStore) to version 1
+ */
+void migrateConfigLegacy() {
+  // Read in place from the EEPROM buffer (which is word aligned)
+  const config_legacy_t *legacy =
+      (const config_legacy_t *)(EEPROM.getDataPtr() + EEPROM_START_ADDRESS);
+
+  migrateConfig(*legacy, cfg);
+}
+
+// Migrations of the configuration, by the version migrated from (0 being a
+// configuration stored as raw config_legacy_t)
+void (*const CONFIG_MIGRATIONS[CONFIG_VERSION])() = {migrateConfigLegacy};
+
+/**
+ * @brief Stores the configuration in the EEPROM
+ */
+void saveConfig() {
+  size_t length = ConfigStoreClass::encode(
+      &cfg, CONFIG_FIELDS, CONFIG_FIELDS_COUNT, CONFIG_VERSION,
+      EEPROM.getDataPtr() + EEPROM_START_ADDRESS,
+      SPI_FLASH_SEC_SIZE - EEPROM_START_ADDRESS);
+
+  if (length == 0) {
+    DEBUGLOG("[CONFIG] Configuration does not fit in the EEPROM\n");
+    return;
+  }
+
+  uint32_t start = ESP.getCycleCount();
+  EEPROM.commit();
+  metrics.eeprom.record((ESP.getCycleCount() - start) / ESP.getCpuFreqMHz());
+}
+
+/**
+ * @brief Loads the configuration from the EEPROM
+ *
+ * Configurations of previous versions are migrated (and stored again). If no
+ * (valid) configuration is stored, the factory defaults are loaded.
+ */
+void loadConfig() {
+  EEPROM.begin(SPI_FLASH_SEC_SIZE);
+  setConfigDefaults(); // For the fields not stored
+
+  const uint8_t *eeprom = EEPROM.getDataPtr() + EEPROM_START_ADDRESS;
+  uint8_t version = CONFIG_VERSION;
+  uint8_t result = ConfigStoreClass::decode(
+      eeprom, SPI_FLASH_SEC_SIZE - EEPROM_START_ADDRESS, CONFIG_FIELDS,
+      CONFIG_FIELDS_COUNT, &cfg, version);
+
+  if (result == CONFIG_STORE_EMPTY && eeprom[0] == INIT_HASH) {
+    version = 0;
+  } else if (result != CONFIG_STORE_OK) {
+    loadFactoryDefaults();
+    return;
+  }
+
+  if (version < CONFIG_VERSION) {
+    for (; version < CONFIG_VERSION; version++) {
+      CONFIG_MIGRATIONS[version]();
+    }
+
+    saveConfig();
+  }
+}
@@ -0,0 +1,121 @@
+/**
+ * AiLight Firmware - Group Module
+ *
+ * The Group module starts commands published on the group topic at the same
+ * instant on all lights of the group. The lights keep a shared clock by UDP
+ * multicast (see GroupSync.hpp); a received group command is held until the
+ * start announced by the group leader, and then processed like any other
+ * command. A single publish on the group topic thus replaces a publish per
+ * light, with the lights fading in step.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+/**
+ * @brief Decode a received group command and hand it over to the main loop
+ *
+ * @param payload the JSON payload (does not need to be NUL terminated)
+ * @param length the length of the JSON payload
+ *
+ * @return true if the payload is a valid light command, otherwise false
+ */
+bool processGroupJson(const char *payload, size_t length) {
+  light_command_t command;
+
+  if (!decodeCommand(payload, length, command, RECORD_SOURCE_GROUP)) {
+    DEBUGLOG("[GROUP] Unable to parse message\n");
+    return false;
+  }
+
+  // Without the group, there is nothing to wait for
+  if (!groupJoined) {
+    return queueCommand(command);
+  }
+
+  // A command not taken yet is superseded, so started right away
+  if (groupCommand.received) {
+    queueCommand(groupCommand.command);
+  }
+
+  groupCommand.command = command;
+  groupCommand.hash = GroupSyncClass::hash(payload, length);
+  groupCommand.received = true;
+
+  return true;
+}
+
+/**
+ * @brief Send a packet to the other lights of the group
+ *
+ * @param packet the packet to send
+ * @param length the length of the packet
+ */
+void sendGroupPacket(const uint8_t *packet, size_t length) {
+  groupUDP.beginPacketMulticast(IPAddress(GROUP_MULTICAST_ADDRESS), GROUP_PORT,
+                                WiFi.localIP());
+  groupUDP.write(packet, length);
+  groupUDP.endPacket();
+}
+
+/**
+ * @brief Keep the group clock and start held group commands
+ */
+void loopGroup() {
+  if (os_strlen(cfg.mqtt_group_topic) == 0) {
+    return;
+  }
+
+  // The group is (re)joined once connected to the WiFi network
+  if (WiFi.status() != WL_CONNECTED) {
+    groupJoined = false;
+    return;
+  }
+
+  if (!groupJoined) {
+    groupUDP.stop();
+    groupUDP.beginMulticast(WiFi.localIP(), IPAddress(GROUP_MULTICAST_ADDRESS),
+                            GROUP_PORT);
+    GroupSync.begin(ESP.getChipId(), GROUP_START_DELAY, micros());
+    groupJoined = true;
+
+    DEBUGLOG("[GROUP] Joined the group (port %u)\n", GROUP_PORT);
+  }
+
+  uint8_t packet[GROUP_PACKET_SIZE];
+
+  for (uint8_t i = 0; i < GROUP_PACKET_BUDGET && groupUDP.parsePacket() > 0;
+       i++) {
+    size_t length = groupUDP.read(packet, sizeof(packet));
+    GroupSync.receive(packet, length, micros());
+  }
+
+  size_t length = GroupSync.poll(micros(), packet);
+  if (length > 0) {
+    sendGroupPacket(packet, length);
+  }
+
+  // Hold a received group command until its start
+  if (groupCommand.received) {
+    if (GroupSync.isHeld()) {
+      queueCommand(groupCommand.held);
+    }
+
+    groupCommand.held = groupCommand.command;
+    groupCommand.received = false;
+
+    length = GroupSync.hold(groupCommand.hash, micros(), packet);
+    if (length > 0) {
+      sendGroupPacket(packet, length);
+    }
+  }
+
+  if (GroupSync.due(micros())) {
+    queueCommand(groupCommand.held); // Processed by loopLight()
+  }
+}
@@ -0,0 +1,332 @@
+/**
+ * AiLight Firmware - Metrics Module
+ *
+ * The Metrics module holds the always-on instrumentation of the firmware:
+ * histograms of the duration of the main loop, of the stages of processing a
+ * light command (parse, queue, apply, driver update and publish) and of the
+ * EEPROM commits, the heap low-water mark, queue depths and reconnect
+ * counters. Durations are measured with the CPU cycle counter. All metrics
+ * have a fixed size and recording takes constant time.
+ *
+ * The metrics are available in the Prometheus text format (GET /api/metrics)
+ * and, optionally, are published periodically via MQTT.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+// Names of the stages of processing a light command (as used in the labels)
+static const char *const STAGE_NAMES[METRICS_STAGES] = {
+    "parse", "queue", "apply", "driver", "publish"};
+
+// Names of the boot phases (as used in the labels)
+static const char *const BOOT_PHASE_NAMES[BOOT_PHASES] = {
+    "setup", "light", "ready", "wifi", "mqtt"};
+
+/**
+ * @brief Records the time a boot phase has been reached (the first time only,
+ * so reconnects don't count)
+ *
+ * @param phase the boot phase (BOOT_PHASE_*)
+ *
+ * @return void
+ */
+void recordBootPhase(uint8_t phase) {
+  if (metrics.boot[phase] == 0) {
+    metrics.boot[phase] = micros();
+
+    DEBUGLOG("[BOOT] %s after %u us\n", BOOT_PHASE_NAMES[phase],
+             metrics.boot[phase]);
+  }
+}
+
+/**
+ * @brief Records the duration of a stage of processing a light command
+ *
+ * @param stage the stage (METRICS_STAGE_*)
+ * @param start the cycle count at the start of the stage
+ *
+ * @return the cycle count at the end of the stage (i.e. the start of the next)
+ */
+uint32_t recordStage(uint8_t stage, uint32_t start) {
+  uint32_t now = ESP.getCycleCount();
+
+  metrics.stages[stage].record((now - start) / ESP.getCpuFreqMHz());
+
+  return now;
+}
+
+/**
+ * @brief Walks the heap and records the lowest size of the largest free block
+ *
+ * Walks the heap, so this is only done periodically (see loopMetrics()) and on
+ * request.
+ *
+ * @return the size of the largest free block of the heap (in bytes)
+ */
+uint32_t sampleHeap() {
+  umm_info(NULL, 0);
+
+  uint32_t block =
+      ummHeapInfo.maxFreeContiguousBlocks * METRICS_HEAP_BLOCK_SIZE;
+  if (block < metrics.heap_block_min || metrics.heap_block_min == 0) {
+    metrics.heap_block_min = block;
+  }
+  metrics.heap_sampled = millis();
+
+  return block;
+}
+
+/**
+ * @brief Retrieves the fragmentation of the heap (as of the last walk, see
+ * sampleHeap())
+ *
+ * @return the fragmentation of the heap (percentage, 0 is not fragmented)
+ */
+uint8_t getHeapFragmentation() {
+  if (ummHeapInfo.freeBlocks == 0) {
+    return 0;
+  }
+
+  return 100 - (uint32_t)ummHeapInfo.maxFreeContiguousBlocks * 100 /
+                   ummHeapInfo.freeBlocks;
+}
+
+/**
+ * @brief Prints a 64-bit unsigned value (not supported by printf)
+ *
+ * @param out the output object
+ * @param value the value to print
+ *
+ * @return void
+ */
+void printUint64(Print &out, uint64_t value) {
+  uint32_t high = value / 1000000000UL;
+  uint32_t low = value % 1000000000UL;
+
+  if (high > 0) {
+    out.printf("%u%09u", high, low);
+  } else {
+    out.printf("%u", low);
+  }
+}
+
+/**
+ * @brief Prints a histogram in the Prometheus text format
+ *
+ * @param out the output object
+ * @param name the name of the metric
+ * @param label the label of this histogram (e.g. 'stage="parse"') or an empty
+ * string
+ * @param histogram the histogram
+ *
+ * @return void
+ */
+void printHistogram(Print &out, const char *name, const char *label,
+                    HistogramClass &histogram) {
+  bool labeled = (label[0] != '\0');
+  uint32_t count = 0;
+
+  // Buckets are cumulative
+  for (uint8_t i = 0; i < HISTOGRAM_BUCKETS - 1; i++) {
+    count += histogram.getBucket(i);
+    out.printf("%s_bucket{%s%sle=\"%u\"} %u\n", name, label,
+               labeled ? "," : "", HistogramClass::getBound(i), count);
+  }
+
+  out.printf("%s_bucket{%s%sle=\"+Inf\"} %u\n", name, label,
+             labeled ? "," : "", histogram.getCount());
+
+  out.printf(labeled ? "%s_sum{%s} " : "%s_sum%s ", name, label);
+  printUint64(out, histogram.getSum());
+
+  out.printf(labeled ? "\n%s_count{%s} %u\n" : "\n%s_count%s %u\n", name,
+             label, histogram.getCount());
+}
+
+/**
+ * @brief Prints a single valued metric in the Prometheus text format
+ *
+ * @param out the output object
+ * @param name the name of the metric
+ * @param type the type of the metric ('counter' or 'gauge')
+ * @param value the value of the metric
+ *
+ * @return void
+ */
+void printMetric(Print &out, const char *name, const char *type,
+                 uint32_t value) {
+  out.printf("# TYPE %s %s\n%s %u\n", name, type, name, value);
+}
+
+/**
+ * @brief Responds with all metrics in the Prometheus text format
+ *
+ * @param request the API endpoint request object
+ *
+ * @return void
+ */
+void sendMetricsResponse(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response =
+      request->beginResponseStream(HTTP_MIMETYPE_PROMETHEUS);
+  response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+
+  printMetric(*response, "ailight_uptime_seconds", "counter", millis() / 1000);
+  printMetric(*response, "ailight_heap_free_bytes", "gauge",
+              ESP.getFreeHeap());
+  printMetric(*response, "ailight_heap_free_min_bytes", "gauge",
+              metrics.heap_min);
+  printMetric(*response, "ailight_heap_max_block_bytes", "gauge",
+              sampleHeap());
+  printMetric(*response, "ailight_heap_max_block_min_bytes", "gauge",
+              metrics.heap_block_min);
+  printMetric(*response, "ailight_heap_fragmentation_percent", "gauge",
+              getHeapFragmentation());
+
+  response->print("# TYPE ailight_boot_phase_us gauge\n");
+  for (uint8_t i = 0; i < BOOT_PHASES; i++) {
+    if (metrics.boot[i] > 0) {
+      response->printf("ailight_boot_phase_us{phase=\"%s\"} %u\n",
+                       BOOT_PHASE_NAMES[i], metrics.boot[i]);
+    }
+  }
+
+  response->print("# TYPE ailight_loop_us histogram\n");
+  printHistogram(*response, "ailight_loop_us", "", metrics.loop);
+
+  response->print("# TYPE ailight_command_stage_us histogram\n");
+  for (uint8_t i = 0; i < METRICS_STAGES; i++) {
+    char label[20];
+    os_sprintf(label, "stage=\"%s\"", STAGE_NAMES[i]);
+    printHistogram(*response, "ailight_command_stage_us", label,
+                   metrics.stages[i]);
+  }
+
+  printMetric(*response, "ailight_commands_queued_total", "counter",
+              CommandQueue.getQueued());
+  printMetric(*response, "ailight_commands_coalesced_total", "counter",
+              CommandQueue.getCoalesced());
+  printMetric(*response, "ailight_commands_dropped_total", "counter",
+              CommandQueue.getDropped());
+  printMetric(*response, "ailight_command_queue_depth", "gauge",
+              CommandQueue.getDepth());
+  printMetric(*response, "ailight_command_queue_depth_max", "gauge",
+              CommandQueue.getMaxDepth());
+
+  response->print("# TYPE ailight_eeprom_commit_us histogram\n");
+  printHistogram(*response, "ailight_eeprom_commit_us", "", metrics.eeprom);
+  printMetric(*response, "ailight_state_commits_total", "counter",
+              StateStore.getCommitCount());
+
+  printMetric(*response, "ailight_output_frames_total", "counter",
+              AiLight->getFramesSent());
+  printMetric(*response, "ailight_output_frames_skipped_total", "counter",
+              AiLight->getFramesSkipped());
+
+  printMetric(*response, "ailight_websocket_clients", "gauge", ws.count());
+  printMetric(*response, "ailight_websocket_pushes_skipped_total", "counter",
+              metrics.ws_skipped);
+  printMetric(*response, "ailight_wifi_reconnects_total", "counter",
+              metrics.wifi_reconnects);
+  printMetric(*response, "ailight_wifi_cached_connects_total", "counter",
+              metrics.wifi_cached);
+  printMetric(*response, "ailight_mqtt_reconnects_total", "counter",
+              metrics.mqtt_reconnects);
+  printMetric(*response, "ailight_mqtt_publish_pending", "gauge",
+              MQTTQueue.getPending());
+  printMetric(*response, "ailight_mqtt_publish_queued_total", "counter",
+              MQTTQueue.getQueued());
+  printMetric(*response, "ailight_mqtt_publish_coalesced_total", "counter",
+              MQTTQueue.getCoalesced());
+  printMetric(*response, "ailight_mqtt_publish_dropped_total", "counter",
+              MQTTQueue.getDropped());
+  printMetric(*response, "ailight_mqtt_published_total", "counter",
+              MQTTQueue.getPublished());
+
+  printMetric(*response, "ailight_realtime_frames_total", "counter",
+              Realtime.getFrames());
+  printMetric(*response, "ailight_realtime_frames_dropped_total", "counter",
+              Realtime.getDropped());
+  printMetric(*response, "ailight_realtime_frames_late_total", "counter",
+              Realtime.getLate());
+
+  printMetric(*response, "ailight_recorder_records", "gauge",
+              Recorder.getRecords());
+  printMetric(*response, "ailight_recorder_recorded_total", "counter",
+              Recorder.getRecorded());
+
+  printMetric(*response, "ailight_group_leader", "gauge",
+              GroupSync.isLeader());
+  printMetric(*response, "ailight_group_starts_total", "counter",
+              GroupSync.getStarts());
+  printMetric(*response, "ailight_group_starts_unsynchronised_total",
+              "counter", GroupSync.getFallbacks());
+
+  request->send(response);
+}
+
+/**
+ * @brief Renders a summary of the metrics (as JSON)
+ *
+ * @param payload the buffer to hold the summary
+ * @param size the size of the buffer
+ *
+ * @return void
+ */
+void renderTelemetry(char *payload, size_t size) {
+  snprintf_P(payload, size,
+             PSTR("{\"uptime\":%u,\"free_heap\":%u,\"free_heap_min\":%u,"
+                  "\"max_block_min\":%u,\"loop_max_us\":%u,\"commands\":%u,"
+                  "\"commands_dropped\":%u,\"command_latency_max_ms\":%u,"
+                  "\"state_commits\":%u,\"wifi_reconnects\":%u,"
+                  "\"mqtt_reconnects\":%u}"),
+             millis() / 1000, ESP.getFreeHeap(), metrics.heap_min,
+             metrics.heap_block_min, metrics.loop.getMax(),
+             CommandQueue.getQueued(), CommandQueue.getDropped(),
+             CommandQueue.getMaxLatency() / 1000, StateStore.getCommitCount(),
+             metrics.wifi_reconnects, metrics.mqtt_reconnects);
+}
+
+/**
+ * @brief Publishes a summary of the metrics via MQTT
+ *
+ * @param qos the QoS level
+ * @param retain whether the message is to be retained by the broker
+ *
+ * @return false if the message could not be sent (yet), otherwise true
+ */
+bool publishTelemetry(uint8_t qos, bool retain) {
+  char payload[TELEMETRY_PAYLOAD_SIZE];
+  renderTelemetry(payload, sizeof(payload));
+
+  return mqttPublish(topics.metrics, payload, qos, retain);
+}
+
+/**
+ * @brief Records the metrics of a main loop iteration
+ *
+ * @param start the cycle count at the start of the iteration
+ */
+void loopMetrics(uint32_t start) {
+  uint32_t heap = ESP.getFreeHeap();
+  if (heap < metrics.heap_min || metrics.heap_min == 0) {
+    metrics.heap_min = heap;
+  }
+
+  if (millis() - metrics.heap_sampled >= METRICS_HEAP_INTERVAL) {
+    sampleHeap();
+  }
+
+  if (METRICS_TELEMETRY_INTERVAL > 0 &&
+      millis() - metrics.telemetry >= METRICS_TELEMETRY_INTERVAL * 1000UL) {
+    metrics.telemetry = millis();
+    mqttQueue(MQTT_TOPIC_METRICS); // Published by loopMQTT()
+  }
+
+  metrics.loop.record((ESP.getCycleCount() - start) / ESP.getCpuFreqMHz());
+}
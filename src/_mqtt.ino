@@ -16,20 +16,88 @@
 /**
  * @brief Publish a message to an MQTT topic
  *
+ * Messages are normally queued with mqttQueue() instead, so they are published
+ * by the main loop once connected (and at a limited rate).
+ *
  * @param topic the MQTT topic to publish the message to
  * @param message the message to be published
+ * @param qos the QoS level
+ * @param retain whether the message is to be retained by the broker
+ *
+ * @return false if the message could not be sent (yet), otherwise true
  */
-void mqttPublish(const char *topic, const char *message) {
+bool mqttPublish(const char *topic, const char *message, uint8_t qos,
+                 bool retain) {
   // Don't do anything if we are not connected to the MQTT broker
   if (!mqtt.connected() || _mqtt_connecting) {
-    return;
+    return false;
   }
 
   if ((os_strlen(topic) > 0) && (os_strlen(message) > 0)) {
-    mqtt.publish(topic, MQTT_QOS_LEVEL, MQTT_RETAIN, message);
+    // No packet identifier if the send buffer is full
+    if (mqtt.publish(topic, qos, retain, message) == 0) {
+      return false;
+    }
 
     DEBUGLOG("[MQTT] Published message to '%s'\n", topic);
   }
+
+  return true;
+}
+
+/**
+ * @brief Queue the message of a topic to be published by the main loop
+ *
+ * A message still waiting to be published is replaced, as the payload is only
+ * rendered once the message is published (see mqttSend()).
+ *
+ * @param topic the topic (MQTT_TOPIC_*)
+ */
+void mqttQueue(uint8_t topic) { MQTTQueue.queue(topic); }
+
+/**
+ * @brief Render and publish the message of a topic
+ *
+ * @param topic the topic (MQTT_TOPIC_*)
+ *
+ * @return false if the message could not be sent (yet), otherwise true
+ */
+bool mqttSend(uint8_t topic) {
+  uint8_t qos = MQTTQueue.getQoS(topic);
+  bool retain = MQTTQueue.getRetain(topic);
+
+  switch (topic) {
+  case MQTT_TOPIC_AVAILABILITY:
+    return mqttPublish(cfg.mqtt_lwt_topic, MQTT_STATUS_ONLINE, qos, retain);
+  case MQTT_TOPIC_STATE:
+    return mqttPublish(cfg.mqtt_state_topic, getStatePayload().json, qos,
+                       retain);
+  case MQTT_TOPIC_DISCOVERY:
+    return publishDiscovery(qos, retain);
+  case MQTT_TOPIC_METRICS:
+    return publishTelemetry(qos, retain);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Publish the queued messages (each topic at most once per interval)
+ */
+void loopMQTT() {
+  if (!mqtt.connected() || _mqtt_connecting) {
+    return;
+  }
+
+  uint8_t topic;
+  while (MQTTQueue.next(millis(), topic)) {
+    // Retried by the next loop iteration
+    if (!mqttSend(topic)) {
+      break;
+    }
+
+    MQTTQueue.published(topic, millis());
+  }
 }
 
 /**
@@ -74,7 +142,8 @@ void mqttUnsubscribe(const char *topic) {
  *
  * @param the callback function to register
  */
-void mqttRegister(void (*callback)(uint8_t, const char *, const char *)) {
+void mqttRegister(void (*callback)(uint8_t, const char *, const char *,
+                                   size_t)) {
   _mqtt_callbacks.push_back(callback);
 }
 
@@ -87,10 +156,20 @@ void onMQTTConnect(bool sessionPresent) {
   DEBUGLOG("[MQTT] Connected\n");
 
   _mqtt_connecting = false;
+  recordBootPhase(BOOT_PHASE_MQTT);
+
+  // Only connections following a previous one are reconnects
+  if (_mqtt_connected_before) {
+    metrics.mqtt_reconnects++;
+  }
+  _mqtt_connected_before = true;
+
+  // Replay the state and availability (published by loopMQTT())
+  MQTTQueue.connect();
 
   // Notify subscribers (connected)
   for (uint8_t i = 0; i < _mqtt_callbacks.size(); i++) {
-    (*_mqtt_callbacks[i])(MQTT_EVENT_CONNECT, NULL, NULL);
+    (*_mqtt_callbacks[i])(MQTT_EVENT_CONNECT, NULL, NULL, 0);
   }
 }
 
@@ -103,9 +182,12 @@ void onMQTTDisconnect(AsyncMqttClientDisconnectReason reason) {
 
   _mqtt_connecting = false;
 
+  // Messages that are stale by the time of the reconnect
+  MQTTQueue.disconnect();
+
   // Notify subscribers (disconnected)
   for (uint8_t i = 0; i < _mqtt_callbacks.size(); i++) {
-    (*_mqtt_callbacks[i])(MQTT_EVENT_DISCONNECT, NULL, NULL);
+    (*_mqtt_callbacks[i])(MQTT_EVENT_DISCONNECT, NULL, NULL, 0);
   }
 }
 
@@ -113,26 +195,51 @@ void onMQTTDisconnect(AsyncMqttClientDisconnectReason reason) {
  * @brief Event handler for when a message is received from the MTT broker
  *
  * @param topic the MQTT topic to which the message has been published
- * @param payload the contents/message that has been published
+ * @param payload the contents/message that has been published (not NUL
+ * terminated)
  * @param properties additional properties of the published message
- * @param length size of the published message
- * @param index ?
- * @param total ?
+ * @param length size of this part of the published message
+ * @param index offset of this part within the published message
+ * @param total size of the whole published message
  */
 void onMQTTMessage(char *topic, char *payload,
                    AsyncMqttClientMessageProperties properties, size_t length,
                    size_t index, size_t total) {
 
-  // Convert payload into char variable
-  char message[length + 1];
-  os_memcpy(message, payload, length);
-  message[length] = 0;
+  // Messages spanning multiple packets are assembled in a static buffer (with
+  // room for a NUL terminator), the parts arrive in order
+  if (index != 0 || length != total) {
+    if (total >= sizeof(mqttMessage) || index + length > total) {
+      if (index == 0) {
+        DEBUGLOG("[MQTT] Ignored message on '%s' (too long, %u bytes)\n",
+                 topic, (uint32_t)total);
+      }
+      return;
+    }
+
+    // A part is missing (e.g. the start has been received before a reconnect)
+    if (index != 0 && index != mqttMessageReceived) {
+      return;
+    }
+
+    os_memcpy(mqttMessage + index, payload, length);
+    mqttMessageReceived = index + length;
 
-  DEBUGLOG("[MQTT] Received message on '%s'\n", topic, message);
+    if (mqttMessageReceived < total) {
+      return;
+    }
 
-  // Notify subscribers (message received)
+    mqttMessage[total] = '\0';
+    mqttMessageReceived = 0;
+    payload = mqttMessage;
+    length = total;
+  }
+
+  DEBUGLOG("[MQTT] Received message on '%s'\n", topic);
+
+  // Notify subscribers (message received), the payload is passed as is
   for (uint8_t i = 0; i < _mqtt_callbacks.size(); i++) {
-    (*_mqtt_callbacks[i])(MQTT_EVENT_MESSAGE, topic, message);
+    (*_mqtt_callbacks[i])(MQTT_EVENT_MESSAGE, topic, payload, length);
   }
 }
 
@@ -171,6 +278,13 @@ void mqttConnect() {
  * @brief Bootstrap function for the MQTT connection
  */
 void setupMQTT() {
+  // Publish options, the state is published at a limited rate
+  MQTTQueue.configure(MQTT_TOPIC_AVAILABILITY, cfg.mqtt_lwt_publish, 0, true);
+  MQTTQueue.configure(MQTT_TOPIC_STATE, cfg.mqtt_state_publish,
+                      MQTT_PUBLISH_INTERVAL, true);
+  MQTTQueue.configure(MQTT_TOPIC_DISCOVERY, MQTT_PUBLISH_OPTIONS, 0, false);
+  MQTTQueue.configure(MQTT_TOPIC_METRICS, 0, 0, false);
+
   mqtt.onConnect(onMQTTConnect);
   mqtt.onDisconnect(onMQTTDisconnect);
   mqtt.onMessage(onMQTTMessage);
@@ -179,7 +293,9 @@ void setupMQTT() {
   mqtt.setKeepAlive(MQTT_KEEPALIVE);
   mqtt.setCleanSession(false);
   mqtt.setClientId(cfg.hostname);
-  mqtt.setWill(cfg.mqtt_lwt_topic, 2, MQTT_RETAIN, MQTT_STATUS_OFFLINE);
+  mqtt.setWill(cfg.mqtt_lwt_topic, 2,
+               MQTTQueue.getRetain(MQTT_TOPIC_AVAILABILITY),
+               MQTT_STATUS_OFFLINE);
   mqtt.setCredentials(cfg.mqtt_user, cfg.mqtt_password);
 
   mqttReconnectTimer.attach_ms(MQTT_RECONNECT_TIME, mqttConnect);
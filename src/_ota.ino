@@ -28,6 +28,8 @@ void setupOTA() {
     DEBUGLOG("[OTA ] Start\n");
     events.send("start", "ota");
 
+    StateStore.flush(); // Save the light state before the restart
+
     ws.enable(false); // Disable WebSocket client connections
     ws.closeAll();    // Close WebSocket client connections
   });
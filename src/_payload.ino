@@ -0,0 +1,118 @@
+/**
+ * AiLight Firmware - Payload Module
+ *
+ * The Payload module holds the (JSON) state payload that is shared by MQTT,
+ * the WebSocket and the REST API. The payload is kept in a cache and is only
+ * rendered again once the state of the light has actually changed.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+// Template of the state payload (keys in the same order as before)
+static const char STATE_PAYLOAD_FORMAT[] PROGMEM =
+    "{\"" KEY_STATE "\":\"%s\",\"" KEY_BRIGHTNESS "\":%u,\"" KEY_WHITE
+    "\":%u,\"" KEY_COLORTEMP "\":%u,\"" KEY_COLOR "\":{\"" KEY_COLOR_R
+    "\":%u,\"" KEY_COLOR_G "\":%u,\"" KEY_COLOR_B "\":%u"
+#if MQTT_HOMEASSISTANT_COLOR_MODES
+    ",\"" KEY_COLOR_W "\":%u},\"" KEY_COLOR_MODE "\":\"%s\","
+#else
+    "},"
+#endif
+#ifdef MQTT_OPENHAB_SUPPORT
+    "\"" KEY_COLOR_ARRAY "\":[%u,%u,%u],"
+#endif
+    "\"" KEY_GAMMA_CORRECTION "\":%s,\"" KEY_EFFECT "\":\"%s\"}";
+
+/**
+ * @brief Compares two states of the light
+ *
+ * @param a the first state
+ * @param b the second state
+ *
+ * @return true if both states are the same, otherwise false
+ */
+bool equalLightState(const light_state_t &a, const light_state_t &b) {
+  return a.is_on == b.is_on && a.gamma == b.gamma &&
+         a.brightness == b.brightness && a.color_temp == b.color_temp &&
+         a.red == b.red && a.green == b.green && a.blue == b.blue &&
+         a.white == b.white;
+}
+
+/**
+ * @brief Returns the colour mode of a state (as published in the state
+ * payload)
+ *
+ * The colour temperature is the colour mode in use while the levels are those
+ * of the colour temperature, otherwise RGBW (hue/saturation and CIE xy colours
+ * are converted into RGBW levels).
+ *
+ * @param state the state
+ *
+ * @return the name of the colour mode
+ */
+const char *getPayloadColorMode(const light_state_t &state) {
+  Color color = AiLightClass::colorTemperature2RGB(state.color_temp);
+
+  if (color.red == state.red && color.green == state.green &&
+      color.blue == state.blue && color.white == state.white) {
+    return KEY_COLORTEMP;
+  }
+
+  return "rgbw";
+}
+
+/**
+ * @brief Retrieves the state payload, rendering it only if the state of the
+ * light has changed since it was last rendered
+ *
+ * The returned payload remains valid until the state of the light changes.
+ *
+ * @return the current state payload
+ */
+const state_payload_t &getStatePayload() {
+  light_state_t state = getLightState();
+  uint8_t effect = Sequencer.isRunning() ? Sequencer.getEffect() : EFFECT_NONE;
+
+  if (statePayload.length > 0 && equalLightState(state, statePayload.state) &&
+      effect == statePayload.effect) {
+    return statePayload;
+  }
+
+  // Random per boot, so ETags handed out before a restart never match
+  if (statePayload.version == 0) {
+    statePayload.boot = RANDOM_REG32;
+  }
+
+  int length = snprintf_P(
+      statePayload.json, sizeof(statePayload.json), STATE_PAYLOAD_FORMAT,
+      state.is_on ? MQTT_PAYLOAD_ON : MQTT_PAYLOAD_OFF, state.brightness,
+      state.white, state.color_temp, state.red, state.green, state.blue,
+#if MQTT_HOMEASSISTANT_COLOR_MODES
+      state.white, getPayloadColorMode(state),
+#endif
+#ifdef MQTT_OPENHAB_SUPPORT
+      state.red, state.green, state.blue,
+#endif
+      state.gamma ? "true" : "false", getPayloadEffectName(effect));
+
+  if (length < 0 || (size_t)length >= sizeof(statePayload.json)) {
+    DEBUGLOG("[PAYLOAD] State payload truncated\n");
+    length = os_strlen(statePayload.json);
+  }
+
+  statePayload.state = state;
+  statePayload.effect = effect;
+  statePayload.length = length;
+  statePayload.version++;
+
+  os_sprintf(statePayload.etag, "\"%08x-%x\"", statePayload.boot,
+             statePayload.version);
+
+  return statePayload;
+}
@@ -0,0 +1,91 @@
+/**
+ * AiLight Firmware - Realtime Module
+ *
+ * The Realtime module listens for realtime colour streams (DDP over UDP), as
+ * sent by music synchronisation or ambient lighting applications. Streamed
+ * frames are sent directly to the LED driver: they are not persisted and not
+ * published. Once the stream stops, the light returns to its previous state.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+/**
+ * @brief Saves the current state of the light, to be restored once the stream
+ * has ended, and stops any effect or transition
+ */
+void startRealtime() {
+  LightController.suspend();
+
+  DEBUGLOG("[REALTIME] Stream started\n");
+}
+
+/**
+ * @brief Returns the light to the state it had before the stream started
+ */
+void stopRealtime() {
+  LightController.resume();
+
+  DEBUGLOG("[REALTIME] Stream ended (frames: %u, dropped: %u, late: %u, max "
+           "interval: %u ms)\n",
+           Realtime.getFrames(), Realtime.getDropped(), Realtime.getLate(),
+           Realtime.getMaxInterval());
+}
+
+/**
+ * @brief Bootstrap function for realtime streaming
+ */
+void setupRealtime() {
+  if (!REALTIME_ENABLED) {
+    return;
+  }
+
+  Realtime.begin(REALTIME_OFFSET, REALTIME_CHANNELS, REALTIME_TIMEOUT);
+  realtimeUDP.begin(REALTIME_PORT);
+
+  DEBUGLOG("[REALTIME] Listening on port %u\n", REALTIME_PORT);
+}
+
+/**
+ * @brief Receive and display streamed frames
+ */
+void loopRealtime() {
+  if (!REALTIME_ENABLED) {
+    return;
+  }
+
+  // Only the part of a packet up to the channels of this light is read
+  uint8_t packet[DDP_HEADER_SIZE + DDP_TIMECODE_SIZE + REALTIME_OFFSET +
+                 REALTIME_CHANNELS];
+  Frame frame;
+  bool display = false;
+  bool active = Realtime.isActive();
+
+  // Of the packets received since the last iteration, only the latest frame
+  // is displayed
+  for (uint8_t i = 0;
+       i < REALTIME_PACKET_BUDGET && realtimeUDP.parsePacket() > 0; i++) {
+    size_t length = realtimeUDP.read(packet, sizeof(packet));
+
+    if (Realtime.receive(packet, length, millis(), frame)) {
+      display = true;
+    }
+  }
+
+  if (display) {
+    if (!active) {
+      startRealtime();
+    }
+
+    AiLight->apply(frame, true);
+  }
+
+  if (Realtime.expired(millis())) {
+    stopRealtime();
+  }
+}
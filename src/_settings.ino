@@ -0,0 +1,164 @@
+/**
+ * AiLight Firmware - Settings Module
+ *
+ * The Settings module applies changed settings at runtime, without a restart
+ * (which would leave the light dark for a few seconds and have it reconnect to
+ * the WiFi network and the MQTT broker). Only what changed is redone: topics
+ * are left and subscribed to incrementally, the device is announced again for
+ * Home Assistant discovery and the connection to the MQTT broker is only
+ * renewed when a setting of the CONNECT packet changed (broker or will). The
+ * light output is left untouched. A new hostname or fixture still needs a
+ * restart (see SETTINGS_RESTART).
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+// Names of the groups of settings (as reported to the Web UI)
+static const char *const SETTING_NAMES[SETTINGS] = {
+    "hostname",  "mqtt_broker", "mqtt_will", "mqtt_command", "mqtt_state",
+    "discovery", "wifi",        "api",       "fixture"};
+
+/**
+ * @brief Takes a snapshot of the topics in use, before changing the settings
+ *
+ * @param snapshot the snapshot
+ *
+ * @return void
+ */
+void snapshotSettings(settings_snapshot_t &snapshot) {
+  os_strcpy(snapshot.hostname, cfg.hostname);
+  os_strcpy(snapshot.command, cfg.mqtt_command_topic);
+  os_strcpy(snapshot.group, cfg.mqtt_group_topic);
+  os_strcpy(snapshot.discovery, topics.discovery);
+}
+
+/**
+ * @brief Applies changed settings at runtime
+ *
+ * @param changed the groups of settings changed (SETTING_*)
+ * @param previous the topics in use before the change
+ *
+ * @return the groups of settings that need a restart to be applied
+ */
+uint16_t applySettings(uint16_t changed, const settings_snapshot_t &previous) {
+  buildTopics();
+
+  // Settings passed upon connecting to the MQTT broker (the client ID being
+  // the hostname, set upon the restart)
+  if (changed & SETTING_MQTT_BROKER) {
+    mqtt.setServer(cfg.mqtt_server, cfg.mqtt_port);
+    mqtt.setCredentials(cfg.mqtt_user, cfg.mqtt_password);
+  }
+  if (changed & SETTING_MQTT_WILL) {
+    mqtt.setWill(cfg.mqtt_lwt_topic, 2,
+                 MQTTQueue.getRetain(MQTT_TOPIC_AVAILABILITY),
+                 MQTT_STATUS_OFFLINE);
+  }
+  bool reconnect = changed & (SETTING_MQTT_BROKER | SETTING_MQTT_WILL);
+
+  // Leave the topics no longer used (the session is persistent, so also when
+  // reconnecting), and subscribe to the new ones (subscribed to upon
+  // connecting otherwise)
+  if (os_strcmp(previous.command, cfg.mqtt_command_topic) != 0) {
+    mqttUnsubscribe(previous.command);
+    if (!reconnect) {
+      mqttSubscribe(cfg.mqtt_command_topic);
+    }
+  }
+  if (os_strcmp(previous.group, cfg.mqtt_group_topic) != 0) {
+    mqttUnsubscribe(previous.group);
+    if (!reconnect) {
+      mqttSubscribe(cfg.mqtt_group_topic);
+    }
+  }
+
+  // Announce the device again (removing the announcement under the previous
+  // topic)
+  if (changed & SETTING_DISCOVERY) {
+    cfg.mqtt_ha_is_discovered = false;
+
+    if (cfg.mqtt_ha_use_discovery) {
+      // Cleared by an empty retained message (which mqttPublish() skips)
+      if (os_strcmp(previous.discovery, topics.discovery) != 0 &&
+          mqtt.connected()) {
+        mqtt.publish(previous.discovery, MQTT_QOS_LEVEL, true, "", 0);
+      }
+      mqttQueue(MQTT_TOPIC_DISCOVERY);
+    }
+  }
+
+  if (changed & SETTING_MQTT_STATE) {
+    mqttQueue(MQTT_TOPIC_STATE);
+  }
+
+  // Reconnected by the reconnect timer (replaying the state and availability)
+  if (reconnect) {
+    mqtt.disconnect();
+  }
+
+  // The cached parameters are those of another network
+  if (changed & SETTING_WIFI) {
+    cfg.wifi_cache.magic = 0;
+    setupWiFi();
+  }
+
+  // The REST API handlers check cfg.api upon each request, so SETTING_API
+  // only needs the buffer of the bodies (un)allocated
+  if (changed & SETTING_API) {
+    setupAPIBody();
+  }
+
+  return changed & SETTINGS_RESTART;
+}
+
+/**
+ * @brief Reports the settings applied to a WebSocket client
+ *
+ * @param id the id of the WebSocket client
+ * @param applied the groups of settings applied at runtime
+ * @param restart the groups of settings that need a restart
+ *
+ * @return void
+ */
+void wsSendSettingsReport(uint32_t id, uint16_t applied, uint16_t restart) {
+  char message[192];
+  size_t length = 0;
+
+  for (uint8_t list = 0; list < 2; list++) {
+    uint16_t settings = (list == 0) ? applied : restart;
+    bool first = true;
+
+    wsAppend(message, sizeof(message), length,
+             (list == 0) ? PSTR("{\"" KEY_SETTINGS_REPORT "\":{\"applied\":[")
+                         : PSTR("],\"restart\":["));
+
+    for (uint8_t i = 0; i < SETTINGS; i++) {
+      if (settings & (1 << i)) {
+        wsAppend(message, sizeof(message), length, PSTR("%s\"%s\""),
+                 first ? "" : ",", SETTING_NAMES[i]);
+        first = false;
+      }
+    }
+  }
+  wsAppend(message, sizeof(message), length, PSTR("]}}"));
+
+  ws.text(id, message);
+}
+
+/**
+ * @brief Restarts after a while (so the settings report can be sent)
+ *
+ * @return void
+ */
+void scheduleRestart() {
+  restartTimer.once_ms(SETTINGS_RESTART_DELAY, []() {
+    StateStore.flush();
+    ESP.restart();
+  });
+}
@@ -0,0 +1,97 @@
+/**
+ * AiLight Firmware - Store Module
+ *
+ * The Store module holds all the code to persist the state of the light
+ * (on/off, brightness, colour, etc.) separately from the configuration
+ * settings, using a journal of small records in flash rather than rewriting
+ * the EEPROM sector.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+/**
+ * @brief Retrieves the current state of the light
+ *
+ * @return the current state of the light
+ */
+light_state_t getLightState() {
+  Color color = AiLight->getColor();
+  uint8_t brightness = AiLight->getBrightness();
+  bool is_on = AiLight->getState();
+
+  // While an effect or stream runs, the state is the one restored afterwards
+  if (Sequencer.isRunning() || Realtime.isActive()) {
+    Frame saved;
+    is_on = LightController.getSaved(saved);
+    color = saved.color;
+    brightness = saved.brightness;
+  }
+
+  light_state_t state = {is_on,
+                         AiLight->hasGammaCorrection(),
+                         brightness,
+                         AiLight->getColorTemperature(),
+                         color.red,
+                         color.green,
+                         color.blue,
+                         color.white};
+
+  return state;
+}
+
+/**
+ * @brief Schedules the current state of the light to be persisted
+ *
+ * The state is written to flash LIGHT_STATE_SAVE_DELAY milliseconds after the
+ * first change since the last write (see loopStore()).
+ */
+void storeLightState() { StateStore.save(getLightState(), millis()); }
+
+/**
+ * @brief Retrieves the persisted state of the light
+ *
+ * If no state has been persisted yet, the defaults from the configuration are
+ * used.
+ *
+ * @return the persisted state of the light
+ */
+light_state_t loadLightState() {
+  light_state_t state;
+
+  if (!StateStore.load(state)) {
+    state = {cfg.is_on,      cfg.gamma,       cfg.brightness,
+             cfg.color_temp, cfg.color.red,   cfg.color.green,
+             cfg.color.blue, cfg.color.white};
+  }
+
+  return state;
+}
+
+/**
+ * @brief Bootstrap function for the state store
+ */
+void setupStore() {
+  // The state records are kept in the sectors directly preceding the EEPROM
+  // sector (i.e. at the end of the unused SPIFFS area)
+  uint16_t sector =
+      ((uint32_t)&_SPIFFS_end - 0x40200000) / SPI_FLASH_SEC_SIZE -
+      LIGHT_STATE_SECTORS;
+
+  StateStore.begin(&stateFlash, sector, LIGHT_STATE_SECTORS,
+                   LIGHT_STATE_SAVE_DELAY);
+}
+
+/**
+ * @brief Writes the scheduled state of the light once the delay has passed
+ */
+void loopStore() {
+  if (StateStore.loop(millis())) {
+    DEBUGLOG("[STORE] Saved light state\n");
+  }
+}
@@ -12,6 +12,40 @@
  * Copyright (c) 2016 - 2021 Sacha Telgenhof
  */
 
+/**
+ * @brief Check whether the REST API is enabled (used as the filter of the API
+ * endpoints, so the REST API can be switched without a restart)
+ *
+ * @param request the API endpoint request object
+ *
+ * @return bool true if enabled, otherwise false
+ */
+bool isAPIEnabled(AsyncWebServerRequest *request) { return cfg.api; }
+
+/**
+ * @brief Returns the API Key given with a request
+ *
+ * The API Key is given in the API-Key header. Only the Server-Sent Events
+ * accept it as query parameter (as the EventSource of browsers can't set
+ * headers), so it doesn't end up in the logs and history of other requests.
+ *
+ * @param request the API endpoint request object
+ * @param query whether the API Key may be given as query parameter
+ *
+ * @return the API Key, or NULL if none is given
+ */
+const String *getAPIKey(AsyncWebServerRequest *request, bool query) {
+  if (request->hasHeader(HTTP_HEADER_APIKEY)) {
+    return &request->getHeader(HTTP_HEADER_APIKEY)->value();
+  }
+
+  if (query && request->hasParam(HTTP_PARAM_APIKEY)) {
+    return &request->getParam(HTTP_PARAM_APIKEY)->value();
+  }
+
+  return NULL;
+}
+
 /**
  * @brief Check whether the requester is authorized using the requested API
  * endpoint
@@ -21,9 +55,21 @@
  * @return bool true if authorized, otherwise false
  */
 bool authorizeAPI(AsyncWebServerRequest *request) {
+  return authorizeAPIKey(request, getAPIKey(request, false));
+}
 
+/**
+ * @brief Check whether an API Key authorizes the requester, responding with
+ * the error otherwise
+ *
+ * @param request the API endpoint request object
+ * @param key the API Key given with the request (NULL if none is given)
+ *
+ * @return bool true if authorized, otherwise false
+ */
+bool authorizeAPIKey(AsyncWebServerRequest *request, const String *key) {
   // Check if API Key is provided
-  if (!request->hasHeader(HTTP_HEADER_APIKEY)) {
+  if (key == NULL) {
     DynamicJsonBuffer jsonBuffer;
     JsonObject &root = jsonBuffer.createObject();
     root["error"] = "400";
@@ -39,8 +85,7 @@ bool authorizeAPI(AsyncWebServerRequest *request) {
 
     return false;
   } else {
-    AsyncWebHeader *h = request->getHeader(HTTP_HEADER_APIKEY);
-    if (!h->value().equals(cfg.api_key)) {
+    if (!key->equals(cfg.api_key)) {
 
       DynamicJsonBuffer jsonBuffer;
       JsonObject &root = jsonBuffer.createObject();
@@ -63,28 +108,384 @@ bool authorizeAPI(AsyncWebServerRequest *request) {
 }
 
 /**
- * @brief Publishes data to WebSocket client upon connection
+ * @brief Responds with an error of the REST API
  *
- * @param id the WebSocket client identifier
+ * @param request the API endpoint request object
+ * @param code the HTTP status code
+ * @param message the description of the error
  *
  * @return void
  */
-void wsStart(uint8_t id) {
+void sendErrorResponse(AsyncWebServerRequest *request, uint16_t code,
+                       const char *message) {
   DynamicJsonBuffer jsonBuffer;
   JsonObject &root = jsonBuffer.createObject();
+  root["error"] = String(code);
+  root["message"] = message;
 
-  // Operational state
-  root[KEY_STATE] = AiLight->getState() ? MQTT_PAYLOAD_ON : MQTT_PAYLOAD_OFF;
-  root[KEY_BRIGHTNESS] = AiLight->getBrightness();
-  root[KEY_WHITE] = AiLight->getColor().white;
-  root[KEY_COLORTEMP] = AiLight->getColorTemperature();
+  char buffer[root.measureLength() + 1];
+  root.printTo(buffer, sizeof(buffer));
 
-  JsonObject &color = root.createNestedObject(KEY_COLOR);
-  color[KEY_COLOR_R] = AiLight->getColor().red;
-  color[KEY_COLOR_G] = AiLight->getColor().green;
-  color[KEY_COLOR_B] = AiLight->getColor().blue;
+  AsyncWebServerResponse *response =
+      request->beginResponse(code, HTTP_MIMETYPE_JSON, buffer);
+  response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+  request->send(response);
+}
 
-  root[KEY_GAMMA_CORRECTION] = AiLight->hasGammaCorrection();
+/**
+ * @brief Allocates the buffer of the REST API bodies arriving in parts while
+ * the REST API is enabled, and frees it otherwise
+ *
+ * @return void
+ */
+void setupAPIBody() {
+  if (cfg.api && apiBody == NULL) {
+    apiBody = (char *)malloc(API_BATCH_SIZE);
+  } else if (!cfg.api && apiBody != NULL) {
+    // A body being received is no longer handled
+    apiBodyRequest = NULL;
+    free(apiBody);
+    apiBody = NULL;
+  }
+}
+
+/**
+ * @brief Collects the body of a REST API request, which may arrive in parts
+ *
+ * A body arriving at once is used as it is. Otherwise it is collected in a
+ * buffer allocated while the REST API is enabled (see setupAPIBody(), so the
+ * heap isn't fragmented by each request), which holds one body at a time and
+ * is released once complete or when the client disconnects before. Bodies
+ * larger than the buffer are rejected (413), as are bodies arriving while
+ * another is collected (503).
+ *
+ * @param request the API endpoint request object
+ * @param data the part of the body received
+ * @param len the length of the part
+ * @param index the offset of the part in the body
+ * @param total the length of the body
+ *
+ * @return the complete body (not NUL terminated), or NULL if it isn't complete
+ * yet or has been rejected
+ */
+const char *collectAPIBody(AsyncWebServerRequest *request, uint8_t *data,
+                           size_t len, size_t index, size_t total) {
+  if (index == 0) {
+    if (total > API_BATCH_SIZE) {
+      sendErrorResponse(request, 413, "The request body is too large");
+      return NULL;
+    }
+
+    if (len == total) {
+      return (const char *)data;
+    }
+
+    if (apiBody == NULL) {
+      sendErrorResponse(request, 503, "Out of memory");
+      return NULL;
+    }
+
+    if (apiBodyRequest != NULL) {
+      sendErrorResponse(request, 503, "Another request is being received");
+      return NULL;
+    }
+    apiBodyRequest = request;
+    request->onDisconnect([request]() {
+      if (apiBodyRequest == request) {
+        apiBodyRequest = NULL;
+      }
+    });
+  }
+
+  // Rejected upon the first part
+  if (apiBodyRequest != request) {
+    return NULL;
+  }
+
+  os_memcpy(apiBody + index, data, len);
+
+  // Last part
+  if (index + len == total) {
+    apiBodyRequest = NULL;
+    return apiBody;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Processes a batch of light commands (a JSON array of commands)
+ *
+ * Each command is decoded on its own; consecutive commands without a flash,
+ * transition or effect are merged (as the command queue does) and queued as
+ * few commands, so a batch takes few slots of the queue and is applied without
+ * intermediate frames. Commands with a flash, transition or effect are queued
+ * as they are, so each keeps its own. The response holds the status of each
+ * command (202 if accepted, 400 if it could not be decoded, 503 if the queue
+ * is full).
+ *
+ * @param request the API endpoint request object
+ * @param body the JSON array of commands (does not need to be NUL terminated)
+ * @param length the length of the body
+ *
+ * @return void
+ */
+void processBatch(AsyncWebServerRequest *request, const char *body,
+                  size_t length) {
+  const char *commands[API_BATCH_COMMANDS];
+  size_t lengths[API_BATCH_COMMANDS];
+  uint8_t count = 0;
+
+  command_result_t result = LightCommands.split(
+      body, length, commands, lengths, API_BATCH_COMMANDS, count);
+  if (result == COMMAND_ERROR_RANGE) {
+    sendErrorResponse(request, 413, "Too many commands in the batch");
+    return;
+  }
+  if (result != COMMAND_OK) {
+    sendErrorResponse(request, 400, "Unable to process the JSON message");
+    return;
+  }
+
+  uint16_t status[API_BATCH_COMMANDS];
+  light_command_t pending;
+  bool hasPending = false;
+  uint8_t first = 0; // The first command merged into the pending one
+
+  // Queues the pending command, on behalf of the commands merged into it
+  auto flush = [&](uint8_t end) {
+    if (hasPending && !queueCommand(pending)) {
+      for (uint8_t j = first; j < end; j++) {
+        if (status[j] == 202) {
+          status[j] = 503;
+        }
+      }
+    }
+    hasPending = false;
+  };
+
+  for (uint8_t i = 0; i < count; i++) {
+    light_command_t command;
+
+    if (!decodeCommand(commands[i], lengths[i], command, RECORD_SOURCE_API)) {
+      status[i] = 400;
+      continue;
+    }
+    status[i] = 202;
+
+    // An uploaded effect program is overwritten by the next command decoded,
+    // so it is queued right away
+    if (command.fields & COMMAND_PROGRAM) {
+      flush(i);
+      if (!queueCommand(command)) {
+        status[i] = 503;
+      }
+      continue;
+    }
+
+    // Each flash, transition or effect applies to its own command only
+    if (hasPending &&
+        !((pending.fields | command.fields) & COMMAND_MODIFIERS) &&
+        CommandQueueClass::merge(pending, command)) {
+      continue;
+    }
+
+    flush(i);
+    pending = command;
+    first = i;
+    hasPending = true;
+  }
+  flush(count);
+
+  // Accepted if any of the commands has been accepted
+  uint16_t code = 400;
+  char buffer[16 + API_BATCH_COMMANDS * 4];
+  size_t used = os_sprintf(buffer, "{\"results\":[");
+
+  for (uint8_t i = 0; i < count; i++) {
+    if (status[i] == 202 || (status[i] == 503 && code == 400)) {
+      code = status[i];
+    }
+    used += os_sprintf(buffer + used, "%s%u", (i > 0) ? "," : "", status[i]);
+  }
+  os_strcpy(buffer + used, "]}");
+
+  AsyncWebServerResponse *response =
+      request->beginResponse(code, HTTP_MIMETYPE_JSON, buffer);
+  response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+  request->send(response);
+}
+
+/**
+ * @brief Responds with the current state of the light
+ *
+ * Answers with '304 Not Modified' if the client already has the current state
+ * (i.e. the given If-None-Match header matches the ETag of the state payload).
+ *
+ * @param request the API endpoint request object
+ *
+ * @return void
+ */
+void sendStateResponse(AsyncWebServerRequest *request) {
+  const state_payload_t &payload = getStatePayload();
+  AsyncWebServerResponse *response;
+
+  AsyncWebHeader *h = request->getHeader(HTTP_HEADER_IF_NONE_MATCH);
+  if (h != NULL && h->value().equals(payload.etag)) {
+    response = request->beginResponse(304);
+  } else {
+    // The response holds its own copy, as it is sent asynchronously
+    response = request->beginResponse(200, HTTP_MIMETYPE_JSON, payload.json);
+  }
+
+  response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+  response->addHeader(HTTP_HEADER_ETAG, payload.etag);
+  request->send(response);
+}
+
+/**
+ * @brief Responds with a Web UI asset
+ *
+ * Answers with '304 Not Modified' if the client already has the asset (i.e.
+ * the given If-None-Match header matches the ETag of the asset). Assets of
+ * which the route holds the hash of their content may be cached indefinitely,
+ * others (the index) are to be revalidated.
+ *
+ * @param request the request object
+ * @param asset the asset
+ *
+ * @return void
+ */
+void sendAssetResponse(AsyncWebServerRequest *request,
+                       const web_asset_t &asset) {
+  AsyncWebServerResponse *response;
+
+  AsyncWebHeader *h = request->getHeader(HTTP_HEADER_IF_NONE_MATCH);
+  if (h != NULL && h->value().equals(asset.etag)) {
+    response = request->beginResponse(304);
+  } else {
+    response =
+        request->beginResponse_P(200, asset.mime, asset.data, asset.length);
+
+    if (asset.gzip) {
+      response->addHeader(HTTP_HEADER_CONTENT_ENCODING,
+                          HTTP_HEADER_CONTENT_ENCODING_VALUE);
+    }
+  }
+
+  response->addHeader(HTTP_HEADER_ETAG, asset.etag);
+  response->addHeader(HTTP_HEADER_CACHE_CONTROL,
+                      asset.immutable ? HTTP_HEADER_CACHE_CONTROL_IMMUTABLE
+                                      : HTTP_HEADER_CACHE_CONTROL_REVALIDATE);
+  response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+  response->addHeader(HTTP_HEADER_XSS_PROTECTION,
+                      HTTP_HEADER_XSS_PROTECTION_VALUE);
+  response->addHeader(HTTP_HEADER_CONTENT_TYPE_OPTIONS,
+                      HTTP_HEADER_CONTENT_TYPE_OPTIONS_VALUE);
+  response->addHeader(HTTP_HEADER_FRAME_OPTIONS,
+                      HTTP_HEADER_FRAME_OPTIONS_VALUE);
+
+  request->send(response);
+}
+
+/**
+ * @brief Pushes changes of the light state to the WebSocket clients
+ *
+ * Pushes are throttled to WS_PUSH_RATE per second and only hold the attributes
+ * that changed since a client has last been sent the state, so a burst of
+ * changes (e.g. dragging a slider) results in a few small messages. A client
+ * that can't keep up (its message queue or TCP send buffer is full) is skipped
+ * rather than queueing stale states; it is sent the accumulated changes once
+ * it has caught up.
+ */
+void loopWebSocket() {
+  if (!wsPushPending) {
+    return;
+  }
+
+  uint32_t now = millis();
+  if (WS_PUSH_RATE > 0 && now - wsPushLast < 1000 / WS_PUSH_RATE) {
+    return;
+  }
+  wsPushLast = now;
+
+  wsPushPending = wsPushState(
+      getStatePayload(), wsClients, WS_CLIENTS_MAX,
+      [](uint32_t id, const char *message, size_t length) -> uint8_t {
+        AsyncWebSocketClient *client = ws.client(id);
+        if (client == NULL) {
+          return WS_PUSH_GONE;
+        }
+
+        if (client->queueIsFull() || !client->client()->canSend()) {
+          metrics.ws_skipped++;
+          return WS_PUSH_BEHIND;
+        }
+
+        client->text(message, length);
+
+        return WS_PUSH_SENT;
+      });
+}
+
+/**
+ * @brief Pushes changes of the light state and telemetry to the Server-Sent
+ * Events clients (while the REST API is enabled)
+ *
+ * State events hold the state payload, with its version as event id (which
+ * matches the ETag of the 'Light' API endpoint). Like the WebSocket pushes,
+ * these are throttled to EVENTS_PUSH_RATE per second, so a burst of changes
+ * results in a few events holding the latest state. Telemetry is sent every
+ * EVENTS_TELEMETRY_INTERVAL seconds.
+ */
+void loopEvents() {
+  if (!cfg.api || events.count() == 0) {
+    return;
+  }
+
+  uint32_t now = millis();
+
+  if (eventsPushPending && (EVENTS_PUSH_RATE == 0 ||
+                            now - eventsPushLast >= 1000 / EVENTS_PUSH_RATE)) {
+    eventsPushLast = now;
+    eventsPushPending = false;
+
+    const state_payload_t &payload = getStatePayload();
+    events.send(payload.json, "state", payload.version);
+  }
+
+  if (EVENTS_TELEMETRY_INTERVAL > 0 &&
+      now - eventsTelemetry >= EVENTS_TELEMETRY_INTERVAL * 1000UL) {
+    eventsTelemetry = now;
+
+    char payload[TELEMETRY_PAYLOAD_SIZE];
+    renderTelemetry(payload, sizeof(payload));
+    events.send(payload, "telemetry");
+  }
+}
+
+/**
+ * @brief Publishes data to WebSocket client upon connection
+ *
+ * @param id the WebSocket client identifier
+ *
+ * @return void
+ */
+void wsStart(uint32_t id) {
+  // Operational state (the cached state payload), later changes are pushed
+  // by loopWebSocket()
+  const state_payload_t &payload = getStatePayload();
+  ws.text(id, payload.json, payload.length);
+
+  for (uint8_t i = 0; i < WS_CLIENTS_MAX; i++) {
+    if (wsClients[i].id == id) {
+      wsClients[i].state = payload.state;
+      wsClients[i].effect = payload.effect;
+    }
+  }
+
+  DynamicJsonBuffer jsonBuffer;
+  JsonObject &root = jsonBuffer.createObject();
 
   // Device settings/state
   JsonObject &device = root.createNestedObject("d");
@@ -102,6 +503,9 @@ void wsStart(uint8_t id) {
   settings[KEY_MQTT_STATE_TOPIC] = cfg.mqtt_state_topic;
   settings[KEY_MQTT_COMMAND_TOPIC] = cfg.mqtt_command_topic;
   settings[KEY_MQTT_LWT_TOPIC] = cfg.mqtt_lwt_topic;
+  settings[KEY_MQTT_GROUP_TOPIC] = cfg.mqtt_group_topic;
+  settings[KEY_MQTT_STATE_PUBLISH] = cfg.mqtt_state_publish;
+  settings[KEY_MQTT_LWT_PUBLISH] = cfg.mqtt_lwt_publish;
   settings[KEY_MQTT_HA_USE_DISCOVERY] = cfg.mqtt_ha_use_discovery;
   settings[KEY_MQTT_HA_IS_DISCOVERED] = cfg.mqtt_ha_is_discovered;
 
@@ -120,6 +524,10 @@ void wsStart(uint8_t id) {
 
   settings[KEY_POWERUP_MODE] = cfg.powerup_mode;
 
+  char fixture[FIXTURE_DESCRIPTION_SIZE];
+  FixtureClass::format(cfg.fixture, fixture, sizeof(fixture));
+  settings[KEY_FIXTURE] = fixture;
+
   char buffer[root.measureLength() + 1];
   root.printTo(buffer, sizeof(buffer));
 
@@ -127,11 +535,52 @@ void wsStart(uint8_t id) {
 }
 
 void wsProcessMessage(uint8_t num, char *payload, size_t length) {
-  DynamicJsonBuffer jsonBuffer;
-  JsonObject &root = jsonBuffer.parseObject(payload);
+  light_command_t command;
   bool settings_changed = false;
   bool needRestart = false;
 
+  // Light parameters are decoded in place, without allocating
+  if (!decodeCommand(payload, length, command, RECORD_SOURCE_WEBSOCKET)) {
+    DEBUGLOG("[WEBSOCKET] Error parsing data\n");
+    return;
+  }
+
+  // Commands and settings are only present in messages of the settings page
+  if (command.fields & COMMAND_OTHER) {
+    wsProcessSettings(num, payload, settings_changed, needRestart);
+  }
+
+  // Light parameters are processed by loopLight()
+  if (command.fields & ~COMMAND_OTHER) {
+    queueCommand(command);
+  }
+
+  // Store the new settings
+  if (settings_changed) {
+    saveConfig();
+  }
+
+  if (needRestart) {
+    scheduleRestart();
+  }
+}
+
+/**
+ * @brief Process the commands and settings of a WebSocket message
+ *
+ * @param num the id of the WebSocket client
+ * @param payload the NUL terminated JSON message (parsed in place)
+ * @param settings_changed set to true if the settings have been changed
+ * @param needRestart set to true if the new settings require a restart (other
+ * settings are applied right away)
+ *
+ * @return void
+ */
+void wsProcessSettings(uint8_t num, char *payload, bool &settings_changed,
+                       bool &needRestart) {
+  DynamicJsonBuffer jsonBuffer;
+  JsonObject &root = jsonBuffer.parseObject(payload);
+
   if (!root.success()) {
     DEBUGLOG("[WEBSOCKET] Error parsing data\n");
     return;
@@ -145,22 +594,41 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
 
     // Execute restart command
     if (os_strcmp(command, "restart") == 0) {
+      StateStore.flush();
       ESP.restart();
     }
 
-    // Execute reset command (load factory defaults)
+    // Execute reset command (load factory defaults, applied like any other
+    // settings)
     if (os_strcmp(command, "reset") == 0) {
+      settings_snapshot_t previous;
+      snapshotSettings(previous);
+      fixture_t fixture = cfg.fixture;
+
       loadFactoryDefaults();
-      ESP.restart();
+
+      uint16_t changed = SETTINGS_ALL & ~(SETTING_HOSTNAME | SETTING_FIXTURE);
+      if (os_strcmp(cfg.hostname, previous.hostname) != 0) {
+        changed |= SETTING_HOSTNAME;
+      }
+      if (os_memcmp(&cfg.fixture, &fixture, sizeof(fixture)) != 0) {
+        changed |= SETTING_FIXTURE;
+      }
+
+      uint16_t restart = applySettings(changed, previous);
+      wsSendSettingsReport(num, changed & ~restart, restart);
+      needRestart = (restart != 0);
     }
   }
 
   // Process new settings
   if (root.containsKey(KEY_SETTINGS) && root[KEY_SETTINGS].is<JsonObject &>()) {
-    bool mqtt_changed = false;
-    bool wifi_changed = false;
+    uint16_t changed = 0;
     settings_changed = true;
 
+    settings_snapshot_t previous;
+    snapshotSettings(previous);
+
     JsonObject &settings = root[KEY_SETTINGS];
     DEBUGLOG("[WEBSOCKET] Received new settings\n");
 
@@ -168,9 +636,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *hostname = settings[KEY_HOSTNAME];
       if (os_strcmp(cfg.hostname, hostname) != 0) {
         os_strcpy(cfg.hostname, hostname);
-        cfg.mqtt_ha_is_discovered =
-            false; // Re-register the device via MQTT HASS Autodiscovery
-        needRestart = true;
+        changed |= SETTING_HOSTNAME | SETTING_DISCOVERY;
       }
     }
 
@@ -178,7 +644,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *mqtt_server = settings[KEY_MQTT_SERVER];
       if (os_strcmp(cfg.mqtt_server, mqtt_server) != 0) {
         os_strcpy(cfg.mqtt_server, mqtt_server);
-        mqtt_changed = true;
+        changed |= SETTING_MQTT_BROKER;
       }
     }
 
@@ -188,7 +654,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
                                : MQTT_PORT;
       if (cfg.mqtt_port != mqtt_port) {
         cfg.mqtt_port = mqtt_port;
-        mqtt_changed = true;
+        changed |= SETTING_MQTT_BROKER;
       }
     }
 
@@ -196,7 +662,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *mqtt_user = settings[KEY_MQTT_USER];
       if (os_strcmp(cfg.mqtt_user, mqtt_user) != 0) {
         os_strcpy(cfg.mqtt_user, mqtt_user);
-        mqtt_changed = true;
+        changed |= SETTING_MQTT_BROKER;
       }
     }
 
@@ -204,7 +670,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *mqtt_password = settings[KEY_MQTT_PASSWORD];
       if (os_strcmp(cfg.mqtt_password, mqtt_password) != 0) {
         os_strcpy(cfg.mqtt_password, mqtt_password);
-        mqtt_changed = true;
+        changed |= SETTING_MQTT_BROKER;
       }
     }
 
@@ -212,9 +678,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *mqtt_state_topic = settings[KEY_MQTT_STATE_TOPIC];
       if (os_strcmp(cfg.mqtt_state_topic, mqtt_state_topic) != 0) {
         os_strcpy(cfg.mqtt_state_topic, mqtt_state_topic);
-        mqtt_changed = true;
-        cfg.mqtt_ha_is_discovered =
-            false; // Re-register the device via MQTT HASS Autodiscovery
+        changed |= SETTING_MQTT_STATE | SETTING_DISCOVERY;
       }
     }
 
@@ -222,9 +686,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *mqtt_command_topic = settings[KEY_MQTT_COMMAND_TOPIC];
       if (os_strcmp(cfg.mqtt_command_topic, mqtt_command_topic) != 0) {
         os_strcpy(cfg.mqtt_command_topic, mqtt_command_topic);
-        mqtt_changed = true;
-        cfg.mqtt_ha_is_discovered =
-            false; // Re-register the device via MQTT HASS Autodiscovery
+        changed |= SETTING_MQTT_COMMAND | SETTING_DISCOVERY;
       }
     }
 
@@ -232,9 +694,35 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *mqtt_lwt_topic = settings[KEY_MQTT_LWT_TOPIC];
       if (os_strcmp(cfg.mqtt_lwt_topic, mqtt_lwt_topic) != 0) {
         os_strcpy(cfg.mqtt_lwt_topic, mqtt_lwt_topic);
-        mqtt_changed = true;
-        cfg.mqtt_ha_is_discovered =
-            false; // Re-register the device via MQTT HASS Autodiscovery
+        changed |= SETTING_MQTT_WILL | SETTING_DISCOVERY;
+      }
+    }
+
+    if (settings.containsKey(KEY_MQTT_GROUP_TOPIC)) {
+      const char *mqtt_group_topic = settings[KEY_MQTT_GROUP_TOPIC];
+      if (os_strcmp(cfg.mqtt_group_topic, mqtt_group_topic) != 0) {
+        os_strcpy(cfg.mqtt_group_topic, mqtt_group_topic);
+        changed |= SETTING_MQTT_COMMAND;
+      }
+    }
+
+    // Publish options (QoS level and retain flag) of the state apply right away
+    if (settings.containsKey(KEY_MQTT_STATE_PUBLISH)) {
+      uint8_t options = settings[KEY_MQTT_STATE_PUBLISH];
+      if (cfg.mqtt_state_publish != options) {
+        MQTTQueue.setOptions(MQTT_TOPIC_STATE, options);
+        cfg.mqtt_state_publish = MQTTQueue.getOptions(MQTT_TOPIC_STATE);
+        changed |= SETTING_MQTT_STATE;
+      }
+    }
+
+    // The availability also sets the LWT, which is passed upon connecting
+    if (settings.containsKey(KEY_MQTT_LWT_PUBLISH)) {
+      uint8_t options = settings[KEY_MQTT_LWT_PUBLISH];
+      if (cfg.mqtt_lwt_publish != options) {
+        MQTTQueue.setOptions(MQTT_TOPIC_AVAILABILITY, options);
+        cfg.mqtt_lwt_publish = MQTTQueue.getOptions(MQTT_TOPIC_AVAILABILITY);
+        changed |= SETTING_MQTT_WILL;
       }
     }
 
@@ -242,13 +730,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       bool mqtt_ha_use_discovery = settings[KEY_MQTT_HA_USE_DISCOVERY];
       if (cfg.mqtt_ha_use_discovery != mqtt_ha_use_discovery) {
         cfg.mqtt_ha_use_discovery = mqtt_ha_use_discovery;
-
-        // Reset that light has been discovered already
-        if (!mqtt_ha_use_discovery) {
-          cfg.mqtt_ha_is_discovered = false;
-        }
-
-        mqtt_changed = true;
+        changed |= SETTING_DISCOVERY;
       }
     }
 
@@ -256,7 +738,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *mqtt_ha_disc_prefix = settings[KEY_MQTT_HA_DISCOVERY_PREFIX];
       if (os_strcmp(cfg.mqtt_ha_disc_prefix, mqtt_ha_disc_prefix) != 0) {
         os_strcpy(cfg.mqtt_ha_disc_prefix, mqtt_ha_disc_prefix);
-        mqtt_changed = true;
+        changed |= SETTING_DISCOVERY;
       }
     }
 
@@ -264,7 +746,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *wifi_ssid = settings[KEY_WIFI_SSID];
       if (os_strcmp(cfg.wifi_ssid, wifi_ssid) != 0) {
         os_strcpy(cfg.wifi_ssid, wifi_ssid);
-        wifi_changed = true;
+        changed |= SETTING_WIFI;
       }
     }
 
@@ -272,7 +754,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       const char *wifi_psk = settings[KEY_WIFI_PSK];
       if (os_strcmp(cfg.wifi_psk, wifi_psk) != 0) {
         os_strcpy(cfg.wifi_psk, wifi_psk);
-        wifi_changed = true;
+        changed |= SETTING_WIFI;
       }
     }
 
@@ -281,7 +763,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       bool rest_api_enabled = settings[KEY_REST_API_ENABLED];
       if (cfg.api != rest_api_enabled) {
         cfg.api = rest_api_enabled;
-        needRestart = true;
+        changed |= SETTING_API;
       }
     }
 
@@ -299,63 +781,22 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
       cfg.powerup_mode = power_up_mode;
     }
 
-    // Reconnect to the MQTT broker due to new settings
-    if (mqtt_changed) {
-      EEPROM_write(cfg);
-      mqtt.disconnect();
-    }
-
-    // Reconnect to WiFi due to new settings
-    if (wifi_changed) {
-      EEPROM_write(cfg);
-      setupWiFi();
+    if (settings.containsKey(KEY_FIXTURE)) {
+      const char *description = settings[KEY_FIXTURE];
+      fixture_t fixture;
+      if (description == NULL || !FixtureClass::parse(description, fixture)) {
+        DEBUGLOG("[WEBSOCKET] Invalid fixture: %s\n", description);
+      } else if (os_memcmp(&cfg.fixture, &fixture, sizeof(fixture)) != 0) {
+        cfg.fixture = fixture;
+        cfg.chip_type = (my92xx_model_t)fixture.chain[0].model;
+        cfg.chip_count = fixture.chain[0].chips;
+        changed |= SETTING_FIXTURE;
+      }
     }
-  }
-
-  // Process light parameters
-  if (root.containsKey(KEY_BRIGHTNESS)) {
-    AiLight->setBrightness(root[KEY_BRIGHTNESS]);
-  }
 
-  if (root.containsKey(KEY_COLORTEMP)) {
-    AiLight->setColorTemperature(root[KEY_COLORTEMP]);
-  }
-
-  if (root.containsKey(KEY_COLOR)) {
-    AiLight->setColor(root[KEY_COLOR][KEY_COLOR_R],
-                      root[KEY_COLOR][KEY_COLOR_G],
-                      root[KEY_COLOR][KEY_COLOR_B]);
-  }
-
-  if (root.containsKey(KEY_WHITE)) {
-    AiLight->setWhite(root[KEY_WHITE]);
-  }
-
-  if (root.containsKey(KEY_STATE)) {
-    AiLight->setState(
-        (os_strcmp(root[KEY_STATE], MQTT_PAYLOAD_ON) == 0) ? true : false);
-  }
-
-  if (root.containsKey(KEY_GAMMA_CORRECTION)) {
-    bool gamma = root[KEY_GAMMA_CORRECTION];
-    AiLight->useGammaCorrection(gamma);
-  }
-
-  // Store light parameters for persistence
-  cfg.is_on = AiLight->getState();
-  cfg.brightness = AiLight->getBrightness();
-  cfg.color_temp = AiLight->getColorTemperature();
-  cfg.color = {AiLight->getColor().red, AiLight->getColor().green,
-               AiLight->getColor().blue, AiLight->getColor().white};
-  cfg.gamma = AiLight->hasGammaCorrection();
-  EEPROM_write(cfg);
-
-  if (needRestart) {
-    ESP.restart();
-  }
-
-  if (!settings_changed) {
-    sendState();
+    uint16_t restart = applySettings(changed, previous);
+    wsSendSettingsReport(num, changed & ~restart, restart);
+    needRestart = (restart != 0);
   }
 }
 
@@ -364,6 +805,7 @@ void wsProcessMessage(uint8_t num, char *payload, size_t length) {
  */
 void setupWeb() {
   server = new AsyncWebServer(80);
+  setupAPIBody();
 
   // Setup WebSocket and handle WebSocket events
   ws.onEvent([](AsyncWebSocket *server, AsyncWebSocketClient *client,
@@ -377,9 +819,31 @@ void setupWeb() {
       DEBUGLOG("[WEBSOCKET] client #%u connected (IP: %s)\n", client->id(),
                ip.toString().c_str());
 
+      // Each client takes a slot to keep track of the state pushed to it
+      ws_client_t *slot = NULL;
+      for (uint8_t i = 0; i < WS_CLIENTS_MAX && slot == NULL; i++) {
+        if (wsClients[i].id == 0) {
+          slot = &wsClients[i];
+        }
+      }
+
+      if (slot == NULL) {
+        DEBUGLOG("[WEBSOCKET] client #%u rejected (too many clients)\n",
+                 client->id());
+        client->close();
+        return;
+      }
+
+      slot->id = client->id();
       wsStart(client->id());
     } else if (type == WS_EVT_DISCONNECT) {
       DEBUGLOG("[WEBSOCKET] client #%u disconnected\n", client->id());
+
+      for (uint8_t i = 0; i < WS_CLIENTS_MAX; i++) {
+        if (wsClients[i].id == client->id()) {
+          wsClients[i].id = 0;
+        }
+      }
     } else if (type == WS_EVT_ERROR) {
       DEBUGLOG("[WEBSOCKET] client #%u error(%u): %s\n", server->url(),
                client->id(), *((uint16_t *)arg), (char *)data);
@@ -388,52 +852,67 @@ void setupWeb() {
                (len) ? (char *)data : "");
     } else if (type == WS_EVT_DATA) {
       AwsFrameInfo *info = (AwsFrameInfo *)arg;
-      static char *message;
 
-      // First packet
-      if (info->index == 0) {
-        message = (char *)malloc(info->len);
+      // Messages are assembled in a static buffer (with room for a NUL
+      // terminator)
+      if (info->len >= sizeof(wsMessage) || info->index + len > info->len) {
+        DEBUGLOG("[WEBSOCKET] client #%u message too long (%u bytes)\n",
+                 client->id(), (uint32_t)info->len);
+        return;
       }
 
       // Store data
-      os_memcpy(message + info->index, data, len);
+      os_memcpy(wsMessage + info->index, data, len);
 
       // Last packet
       if (info->index + len == info->len) {
-        wsProcessMessage(client->id(), message, info->len);
-        free(message);
+        wsMessage[info->len] = '\0';
+        wsProcessMessage(client->id(), wsMessage, info->len);
       }
     }
   });
   server->addHandler(&ws);
+
+  // Server-Sent Events: OTA progress, and the state and telemetry while the
+  // REST API is enabled. These then require the API Key, which browsers (their
+  // EventSource can't set headers) give as query parameter.
+  server->on(HTTP_ROUTE_EVENTS, HTTP_GET,
+             [](AsyncWebServerRequest *request) {
+               authorizeAPIKey(request, getAPIKey(request, true));
+             })
+      .setFilter([](AsyncWebServerRequest *request) {
+        const String *key = getAPIKey(request, true);
+        return cfg.api && (key == NULL || !key->equals(cfg.api_key));
+      });
+
+  events.onConnect([](AsyncEventSourceClient *client) {
+    if (cfg.api) {
+      const state_payload_t &payload = getStatePayload();
+      client->send(payload.json, "state", payload.version);
+    }
+  });
   server->addHandler(&events);
 
   server->rewrite("/", HTTP_ROUTE_INDEX);
 
-  // Send a file when /index is requested
-  server->on(HTTP_ROUTE_INDEX, HTTP_GET, [](AsyncWebServerRequest *request) {
-    AsyncWebServerResponse *response =
-        request->beginResponse_P(200, HTTP_MIMETYPE_HTML, html_gz, html_gz_len);
+  // Web UI assets (/index and the resources it references)
+  for (uint8_t i = 0; i < WEB_ASSETS; i++) {
+    const web_asset_t *asset = &web_assets[i];
 
-    response->addHeader(HTTP_HEADER_CONTENT_ENCODING,
-                        HTTP_HEADER_CONTENT_ENCODING_VALUE);
-    response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
-    response->addHeader(HTTP_HEADER_XSS_PROTECTION,
-                        HTTP_HEADER_XSS_PROTECTION_VALUE);
-    response->addHeader(HTTP_HEADER_CONTENT_TYPE_OPTIONS,
-                        HTTP_HEADER_CONTENT_TYPE_OPTIONS_VALUE);
-    response->addHeader(HTTP_HEADER_FRAME_OPTIONS,
-                        HTTP_HEADER_FRAME_OPTIONS_VALUE);
-
-    request->send(response);
-  });
+    server->on(asset->route, HTTP_GET,
+               [asset](AsyncWebServerRequest *request) {
+                 sendAssetResponse(request, *asset);
+               });
+  }
 
-  if (cfg.api) {
-    server->onRequestBody([](AsyncWebServerRequest *request, uint8_t *data,
-                             size_t len, size_t index, size_t total) {
-      // Process requested changes for the light
-      if (request->url().equals(HTTP_APIROUTE_LIGHT)) {
+  // The REST API handlers are always registered, and only handle requests
+  // while the REST API is enabled (so it can be switched at runtime)
+  server->onRequestBody([](AsyncWebServerRequest *request, uint8_t *data,
+                           size_t len, size_t index, size_t total) {
+    // Process requested changes for the light
+    if (cfg.api && request->url().equals(HTTP_APIROUTE_LIGHT)) {
 
+      if (index == 0) {
         // Check for appropriate HTTP method
         if (request->method() != HTTP_PATCH) {
           AsyncWebServerResponse *response =
@@ -441,111 +920,198 @@ void setupWeb() {
           response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
           response->addHeader(HTTP_HEADER_ALLOW, HTTP_HEADER_ALLOW_GET_PATCH);
           request->send(response);
+
+          return;
         }
 
         if (!authorizeAPI(request)) {
           return;
         }
+      }
+
+      // Processed (and responded to) once the whole body has been received
+      const char *body = collectAPIBody(request, data, len, index, total);
+      if (body == NULL) {
+        return;
+      }
+
+      light_command_t command;
+      if (!decodeCommand(body, total, command, RECORD_SOURCE_API)) {
+        sendErrorResponse(request, 400, "Unable to process the JSON message");
+        return;
+      }
+
+      // The command is processed by the main loop, after which the new
+      // state is published (and can be requested)
+      if (!queueCommand(command)) {
+        DynamicJsonBuffer jsonBuffer;
+        JsonObject &root = jsonBuffer.createObject();
+        root["error"] = "503";
+        root["message"] = "Too many commands, please retry";
+
+        char buffer[root.measureLength() + 1];
+        root.printTo(buffer, sizeof(buffer));
+
+        AsyncWebServerResponse *response =
+            request->beginResponse(503, HTTP_MIMETYPE_JSON, buffer);
+        response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+        request->send(response);
+
+        return;
+      }
+
+      // Send response
+      AsyncWebServerResponse *response =
+          request->beginResponse(202, HTTP_MIMETYPE_JSON);
+      response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+      request->send(response);
+    }
+
+    // Process a batch of light commands
+    if (cfg.api && request->url().equals(HTTP_APIROUTE_BATCH)) {
+      if (index == 0) {
+        // Check for appropriate HTTP method
+        if (request->method() != HTTP_POST) {
+          AsyncWebServerResponse *response =
+              request->beginResponse(405, HTTP_MIMETYPE_JSON);
+          response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+          response->addHeader(HTTP_HEADER_ALLOW, HTTP_HEADER_ALLOW_POST);
+          request->send(response);
+
+          return;
+        }
 
-        if (!processJson((char *)data)) {
-          DynamicJsonBuffer jsonBuffer;
-          JsonObject &root = jsonBuffer.createObject();
-          root["error"] = "400";
-          root["message"] = "Unable to process the JSON message";
+        if (!authorizeAPI(request)) {
+          return;
+        }
+      }
 
-          char buffer[root.measureLength() + 1];
-          root.printTo(buffer, sizeof(buffer));
+      const char *body = collectAPIBody(request, data, len, index, total);
+      if (body != NULL) {
+        processBatch(request, body, total);
+      }
+    }
+  });
 
+  // 'Light' API Endpoint
+  server->on(
+      HTTP_APIROUTE_LIGHT, HTTP_GET, [](AsyncWebServerRequest *request) {
+        // Check for appropriate HTTP method
+        if (request->method() != HTTP_GET) {
           AsyncWebServerResponse *response =
-              request->beginResponse(400, HTTP_MIMETYPE_JSON, buffer);
+              request->beginResponse(405, HTTP_MIMETYPE_JSON);
           response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+          response->addHeader(HTTP_HEADER_ALLOW, HTTP_HEADER_ALLOW_GET_PATCH);
           request->send(response);
 
           return;
         }
 
-        sendState(); // Notify subscribers about the new state
+        if (!authorizeAPI(request)) {
+          return;
+        }
 
         // Send response
+        sendStateResponse(request);
+      })
+      .setFilter(isAPIEnabled);
+
+  // 'About' API Endpoint
+  server->on(
+      HTTP_APIROUTE_ABOUT, HTTP_ANY, [](AsyncWebServerRequest *request) {
+        // Only allow HTTP_GET method
+        if (request->method() != HTTP_GET) {
+          AsyncWebServerResponse *response =
+              request->beginResponse(405, HTTP_MIMETYPE_JSON);
+          response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+          response->addHeader(HTTP_HEADER_ALLOW, HTTP_HEADER_ALLOW_GET);
+          request->send(response);
+
+          return;
+        }
+
+        if (!authorizeAPI(request)) {
+          return;
+        }
+
         DynamicJsonBuffer jsonBuffer;
         JsonObject &root = jsonBuffer.createObject();
-        createStateJSON(root);
+        createAboutJSON(root);
 
-        char buffer[root.measureLength() + 1];
-        root.printTo(buffer, sizeof(buffer));
-
-        AsyncWebServerResponse *response =
-            request->beginResponse(200, HTTP_MIMETYPE_JSON, buffer);
+        AsyncResponseStream *response =
+            request->beginResponseStream(HTTP_MIMETYPE_JSON);
         response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+        root.printTo(*response);
+
         request->send(response);
-      }
-    });
-  }
+      })
+      .setFilter(isAPIEnabled);
+
+  // 'Metrics' API Endpoint (Prometheus text format)
+  server->on(
+      HTTP_APIROUTE_METRICS, HTTP_ANY, [](AsyncWebServerRequest *request) {
+        // Only allow HTTP_GET method
+        if (request->method() != HTTP_GET) {
+          AsyncWebServerResponse *response =
+              request->beginResponse(405, HTTP_MIMETYPE_JSON);
+          response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+          response->addHeader(HTTP_HEADER_ALLOW, HTTP_HEADER_ALLOW_GET);
+          request->send(response);
 
-  if (cfg.api) {
+          return;
+        }
+
+        if (!authorizeAPI(request)) {
+          return;
+        }
 
-    // 'Light' API Endpoint
-    server->on(
-        HTTP_APIROUTE_LIGHT, HTTP_GET, [](AsyncWebServerRequest *request) {
-          // Check for appropriate HTTP method
-          if (request->method() != HTTP_GET) {
-            AsyncWebServerResponse *response =
-                request->beginResponse(405, HTTP_MIMETYPE_JSON);
-            response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
-            response->addHeader(HTTP_HEADER_ALLOW, HTTP_HEADER_ALLOW_GET_PATCH);
-            request->send(response);
+        sendMetricsResponse(request);
+      })
+      .setFilter(isAPIEnabled);
 
-            return;
-          }
+  // 'Recording' API Endpoint (log of the light commands received)
+  server->on(
+      HTTP_APIROUTE_RECORDING, HTTP_ANY, [](AsyncWebServerRequest *request) {
+        // Only allow HTTP_GET and HTTP_DELETE methods
+        if (request->method() != HTTP_GET &&
+            request->method() != HTTP_DELETE) {
+          AsyncWebServerResponse *response =
+              request->beginResponse(405, HTTP_MIMETYPE_JSON);
+          response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+          response->addHeader(HTTP_HEADER_ALLOW, HTTP_HEADER_ALLOW_GET_DELETE);
+          request->send(response);
 
-          if (!authorizeAPI(request)) {
-            return;
-          }
+          return;
+        }
 
-          // Send response
-          DynamicJsonBuffer jsonBuffer;
-          JsonObject &root = jsonBuffer.createObject();
-          createStateJSON(root);
+        if (!authorizeAPI(request)) {
+          return;
+        }
 
-          char buffer[root.measureLength() + 1];
-          root.printTo(buffer, sizeof(buffer));
+        if (request->method() == HTTP_DELETE) {
+          Recorder.clear();
 
-          AsyncWebServerResponse *response =
-              request->beginResponse(200, HTTP_MIMETYPE_JSON, buffer);
+          AsyncWebServerResponse *response = request->beginResponse(204);
           response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
           request->send(response);
-        });
-
-    // 'About' API Endpoint
-    server->on(
-        HTTP_APIROUTE_ABOUT, HTTP_ANY, [](AsyncWebServerRequest *request) {
-          // Only allow HTTP_GET method
-          if (request->method() != HTTP_GET) {
-            AsyncWebServerResponse *response =
-                request->beginResponse(405, HTTP_MIMETYPE_JSON);
-            response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
-            response->addHeader(HTTP_HEADER_ALLOW, HTTP_HEADER_ALLOW_GET);
-            request->send(response);
-
-            return;
-          }
-
-          if (!authorizeAPI(request)) {
-            return;
-          }
-
-          DynamicJsonBuffer jsonBuffer;
-          JsonObject &root = jsonBuffer.createObject();
-          createAboutJSON(root);
-
-          AsyncResponseStream *response =
-              request->beginResponseStream(HTTP_MIMETYPE_JSON);
-          response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
-          root.printTo(*response);
 
-          request->send(response);
-        });
-  }
+          return;
+        }
+
+        // The log is sent in parts as it is read, so recording is paused until
+        // the download has ended
+        Recorder.pause(true);
+        request->onDisconnect([]() { Recorder.pause(false); });
+
+        AsyncWebServerResponse *response = request->beginResponse(
+            HTTP_MIMETYPE_BINARY, Recorder.getLength(),
+            [](uint8_t *buffer, size_t length, size_t index) -> size_t {
+              return Recorder.read(index, buffer, length);
+            });
+        response->addHeader(HTTP_HEADER_SERVER, SERVER_SIGNATURE);
+        request->send(response);
+      })
+      .setFilter(isAPIEnabled);
 
   // Handle unknown URI
   server->onNotFound([](AsyncWebServerRequest *request) {
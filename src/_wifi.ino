@@ -4,6 +4,13 @@
  * The WiFi module holds all the code to manage all functions for setting up the
  * WiFi connection.
  *
+ * Connecting doesn't block: setupWiFi() starts the connection and loopWiFi()
+ * follows it up. The channel and BSSID of the access point (and optionally the
+ * IP configuration) of the last connection are cached in the configuration, so
+ * a reconnect or the next boot skips the scan for the access point (and DHCP).
+ * If no connection is made with the cached parameters within
+ * WIFI_CACHE_TIMEOUT, the access point is scanned for as usual.
+ *
  * This file is part of the AiLight Firmware.
  * For the full copyright and license information, please view the LICENSE
  * file that was distributed with this source code.
@@ -36,6 +43,7 @@ void onSTAGotIP(const WiFiEventStationModeGotIP &event) {
   DEBUGLOG("\n");
 #endif
 
+  recordBootPhase(BOOT_PHASE_WIFI);
   mqttConnect();
 }
 
@@ -59,15 +67,81 @@ void onAPConnected(const WiFiEventSoftAPModeStationConnected &event) {
  * @param event WiFiEventStationModeDisconnected Event
  */
 void onSTADisconnected(const WiFiEventStationModeDisconnected &event) {
+  // Failed attempts while connecting are handled by loopWiFi()
+  if (wifiState != WIFI_STATE_CONNECTED) {
+    return;
+  }
+  wifiState = WIFI_STATE_IDLE;
+
   DEBUGLOG("WiFi connection (%s) dropped.\n", event.ssid.c_str());
   DEBUGLOG("Reason: %d\n", event.reason);
 
   DEBUGLOG("Trying to reconnect\n");
+  metrics.wifi_reconnects++;
   mqttReconnectTimer
       .detach(); // Ensure not to reconnect to MQTT while reconnecting to WiFi
   wifiReconnectTimer.once(WIFI_RECONNECT_TIMEOUT, setupWiFi);
 }
 
+/**
+ * @brief Starts connecting to the configured WiFi network
+ *
+ * @param cached whether to use the cached parameters of the last connection
+ * (if any)
+ *
+ * @return void
+ */
+void wifiBegin(bool cached) {
+  const wifi_cache_t &cache = cfg.wifi_cache;
+  wifiCached = cached && (cache.magic == WIFI_CACHE_MAGIC);
+
+  // The address of the last connection skips DHCP
+  if (WIFI_CACHE_IP && wifiCached && cache.ip != 0) {
+    WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway),
+                IPAddress(cache.subnet), IPAddress(cache.dns));
+  } else if (WIFI_CACHE_IP) {
+    wifi_station_dhcpc_start();
+  }
+
+  DEBUGLOG("[WIFI] Connecting to %s%s\n", cfg.wifi_ssid,
+           wifiCached ? " (cached)" : "");
+  WiFi.begin(cfg.wifi_ssid, cfg.wifi_psk, wifiCached ? cache.channel : 0,
+             wifiCached ? cache.bssid : NULL);
+
+  wifiState = WIFI_STATE_CONNECTING;
+}
+
+/**
+ * @brief Caches the parameters of the established WiFi connection (only
+ * written to the EEPROM if they have changed)
+ *
+ * @return void
+ */
+void storeWiFiCache() {
+  wifi_cache_t cache;
+  os_memset(&cache, 0, sizeof(cache));
+
+  cache.magic = WIFI_CACHE_MAGIC;
+  cache.channel = WiFi.channel();
+  os_memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+
+  // Leases change, so the address is only cached when used
+  if (WIFI_CACHE_IP) {
+    cache.ip = WiFi.localIP();
+    cache.gateway = WiFi.gatewayIP();
+    cache.subnet = WiFi.subnetMask();
+    cache.dns = WiFi.dnsIP();
+  }
+
+  if (os_memcmp(&cache, &cfg.wifi_cache, sizeof(cache)) != 0) {
+    cfg.wifi_cache = cache;
+    saveConfig();
+
+    DEBUGLOG("[WIFI] Cached channel %u and BSSID %s\n", cache.channel,
+             WiFi.BSSIDstr().c_str());
+  }
+}
+
 /**
  * @brief Bootstrap function for the WiFi connection
  */
@@ -81,7 +155,7 @@ void setupWiFi() {
   // Set WiFi hostname
   if (os_strlen(cfg.hostname) == 0) {
     os_strcpy(cfg.hostname, getDeviceID());
-    EEPROM_write(cfg);
+    saveConfig();
   }
   WiFi.hostname(cfg.hostname);
 
@@ -92,16 +166,49 @@ void setupWiFi() {
     delay(10);
   }
 
-  // (Re)connect
+  // (Re)connect (followed up by loopWiFi())
   WiFi.disconnect();
-  DEBUGLOG("[WIFI] Connecting to %s\n", cfg.wifi_ssid);
-  WiFi.begin(cfg.wifi_ssid, cfg.wifi_psk);
+  wifiStarted = millis();
+  wifiBegin(true);
 
   MDNS.addService("http", "tcp", 80);
+}
+
+/**
+ * @brief Follows up on connecting to the WiFi network: falls back from the
+ * cached parameters to a scan, and switches to AP mode if no connection can be
+ * made
+ */
+void loopWiFi() {
+  if (wifiState != WIFI_STATE_CONNECTING) {
+    return;
+  }
+
+  if (WiFi.status() == WL_CONNECTED) {
+    wifiState = WIFI_STATE_CONNECTED;
+    if (wifiCached) {
+      metrics.wifi_cached++;
+    }
+
+    DEBUGLOG("[WIFI] Connected in %u ms\n", millis() - wifiStarted);
+    storeWiFiCache();
+    return;
+  }
+
+  uint32_t elapsed = millis() - wifiStarted;
+
+  // The access point may have moved to another channel (or been replaced)
+  if (wifiCached && elapsed >= WIFI_CACHE_TIMEOUT) {
+    DEBUGLOG("[WIFI] Not connected with the cached parameters\n");
+    WiFi.disconnect();
+    wifiBegin(false);
+    return;
+  }
 
-  // Check connection and switch to AP mode if no connection
-  if (WiFi.waitForConnectResult() != WL_CONNECTED) {
+  // Switch to AP mode if no connection
+  if (elapsed >= WIFI_CONNECT_TIMEOUT) {
     DEBUGLOG("[WIFI] Connection not established! Changing into AP mode...\n");
+    wifiState = WIFI_STATE_IDLE;
 
     wifiReconnectTimer.detach(); // Ensure not to reconnect to WiFi while
                                  // changing into AP mode
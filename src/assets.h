@@ -0,0 +1,57 @@
+// Web UI assets (generated by gulp, do not edit)
+#define WEB_ASSETS 5
+
+const uint8_t web_asset_0[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x5b,0x6d,0x6f,0xdb,0x38,0x12,0xfe,0x2b,0x3c,0x1d,0xb0,0xd8,0x05,0x6a,0x2b,0x76,0xe2,0x36,0x6d,0x65,0xe1,0xd2,0x24,0x7d,0xc1,0x6e,0xba,0xd9,0x3a,0xbd,0x5e,0x3f,0x19,0x94,0x34,0x92,0xb8,0xa1,0x48,0x96,0xa4,0xec,0xb8,0xbf,0xfe,0x40,0x52,0xb2,0x64,0x5b,0x76,0x5e,0x9a,0x34,0xed,0xe1,0xbe,0xd8,0x26,0x39,0x9a,0x97,0x87,0xc3,0xe1,0x90,0x1a,0x07,0xff,0x38,0xf9,0xf3,0xf8,0xe2,0xf3,0xf9,0x29,0xca,0x75,0x41,0xc3,0xc0,0x7c,0x22,0x8a,0x59,0x36,0xf6,0x80,0x79,0x61,0x90,0x03,0x4e,0xc2,0xa0,0x00,0x8d,0x51,0x9c,0x63,0xa9,0x40,0x8f,0xbd,0x52,0xa7,0xbd,0x43,0xaf,0xea,0x65,0xb8,0x80,0xb1,0x37,0x23,0x30,0x17,0x5c,0x6a,0x0f,0xc5,0x9c,0x69,0x60,0x7a,0xec,0xcd,0x49,0xa2,0xf3,0x71,0x02,0x33,0x12,0x43,0xcf,0x36,0x9e,0x20,0xc2,0x88,0x26,0x98,0xf6,0x54,0x8c,0x29,0x8c,0x07,0x35,0x8f,0x5c,0x6b,0xd1,0x83,0x2f,0x25,0x99,0x8d,0xbd,0xff,0xf4,0x3e,0x1e,0xf5,0x8e,0x79,0x21,0xb0,0x26,0x11,0x85,0x16,0xc3,0x77,0xa7,0x63,0x48,0x32,0x58,0x15,0xfc,0x16,0xb3,0x24,0x07,0x9a,0xbc,0x96,0x04,0x58,0x42,0x17,0x2d,0x7a,0x2d,0x4b,0x43,0xac,0x89,0xa6,0x10,0x1e,0x91,0x3f,0x48,0x96,0xeb,0xc0,0x77,0xcd,0x80,0x12,0x76,0x89,0x24,0xd0,0xb1,0x47,0x62,0xce,0x3c,0x94,0x4b,0x48,0xc7,0x5e,0x8a,0x67,0xa6,0xd9,0x3f,0x48,0xf7,0xf7,0x9e,0x0d,0x20,0xee,0x0b,0x96,0x79,0x48,0x2f,0x04,0x8c,0x3d,0x52,0xe0,0x0c,0x7c,0xd3,0xd1,0x7e,0x5a,0xe9,0x05,0x05,0x95,0x03,0xe8,0x9a,0x87,0xed,0xe9,0xef,0x3d,0x8b,0xf7,0x47,0xcf,0x71,0xda,0x8f,0x95,0xaa,0x39,0x68,0xb8,0xd2,0xbe,0x69,0x87,0x81,0xef,0x70,0x8d,0x78,0xb2,0x40,0xf6,0x81,0xb1,0xf7,0x95,0xf3,0xe2,0x05,0x1a,0xbc,0xf4,0xc2,0x40,0x41,0xac,0x09,0x67,0x28,0xa6,0x58,0xa9,0xb1,0x97,0x83,0xe4,0x5e,0x18,0x24,0x64,0xd6,0xee,0xe9,0x19,0x16,0xab,0xdd,0xc6,0x74,0x4c,0x18,0x48,0x2f,0x0c,0x18,0x5e,0x76,0x33,0x3c,0x5b,0xa5,0x63,0x78,0xd6,0xa3,0x90,0x6a,0x2f,0x0c,0x70,0xbb,0x8f,0x68,0x28,0x10,0x51,0xbd,0x48,0x62,0x96,0xd4,0xf6,0xfc,0xd3,0x0b,0x03,0x52,0x64,0x48,0xc9,0x78,0xec,0x51,0x9e,0xf1,0xfe,0xf3,0xc3,0x38,0x8d,0x9e,0xef,0xed,0x3b,0x74,0x30,0xd5,0x63,0xaf,0x82,0xd7,0x58,0x86,0x37,0x44,0x19,0xb6,0xc6,0x95,0x86,0x75,0xa7,0x9d,0x03,0x23,0x68,0xe8,0x35,0x13,0x93,0x0f,0xc3,0xc0,0x4f,0xc8,0xac,0xfe,0x5c,0x63,0x12,0x03,0xd3,0xd6,0x30,0x37,0xaa,0x04,0x66,0x88,0x24,0x6e,0x4c,0xf3,0x2c,0xb3,0xae,0xd2,0x90,0x57,0x5d,0x8e,0x30,0x0c,0x7c,0xf7,0xb5,0xbd,0x51,0x7d,0x19,0xa1,0x35,0xd7,0x02,0x58,0xb9,0xc2,0x53,0x1a,0x45,0xd1,0x72,0x68,0x9b,0x9d,0xa2,0x3d,0x1d,0x92,0xd3,0x36,0xca,0x51,0xa9,0x35,0x67,0xc6,0x74,0x21,0x49,0x81,0xe5,0xa2,0x41,0xd9,0xca,0x75,0xe3,0x3d,0x09,0x4a,0x63,0xa9,0x6b,0xf5,0x3f,0x9c,0x4e,0x2e,0x8e,0x3e,0x5c,0xb4,0x15,0xaf,0x19,0x5a,0xef,0x0d,0x03,0xd2,0x6e,0xf7,0x04,0x9f,0x3b,0xa8,0x48,0x63,0x1f,0x0e,0x03,0x5f,0x6c,0xc1,0xf6,0x56,0x8a,0x27,0x98,0x65,0x20,0xcd,0x2f,0x5e,0x6a,0x4a,0x18,0x24,0x6b,0x36,0x48,0x50,0xd0,0x56,0xfd,0xf4,0xe6,0x8a,0x63,0x29,0xf9,0xbc,0x47,0x39,0x17,0xbb,0xb4,0xaf,0x3e,0x19,0x9e,0xad,0xf5,0x54,0xeb,0x66,0xc3,0xf9,0xad,0x5a,0x9b,0x73,0xd6,0x5e,0x2e,0xdb,0xbc,0x0d,0xdb,0x67,0x35,0x8e,0xa6,0x6e,0x46,0xba,0x96,0x8b,0xc6,0x51,0x6b,0xb1,0x54,0xee,0x8c,0x57,0x9e,0x05,0xad,0x09,0xcb,0xd4,0x0d,0x1e,0x9f,0x54,0xa4,0x6b,0x1c,0x70,0xc4,0xcb,0x9b,0x48,0x3f,0x32,0x74,0x0e,0xaf,0x0d,0xac,0xea,0xb0,0x62,0x78,0x0a,0x9c,0x81,0xaa,0x42,0xa5,0xb7,0x39,0xb4,0x66,0x6d,0x8e,0x55,0xcf,0x44,0xaf,0x0a,0x17,0x30,0x71,0x47,0x84,0xc7,0xce,0x4d,0xd0,0x82,0x97,0x12,0x05,0x4a,0x4b,0xce,0xb2,0x7a,0x3d,0xa3,0x49,0x81,0xa5,0x46,0x15,0x18,0xd5,0x18,0x2a,0x15,0x61,0x19,0xd2,0x39,0xa0,0xca,0xc5,0x14,0x8a,0x80,0xf2,0xb9,0x9d,0x5c,0x8d,0x23,0x0a,0xcb,0x10,0x61,0x1a,0x26,0x7a,0x9b,0x10,0x19,0x06,0x5a,0x86,0x81,0xce,0xc3,0xc9,0x9c,0xe8,0x38,0x0f,0x7c,0x9d,0x87,0x81,0x4e,0xc2,0x80,0xe2,0x08,0x68,0xfd,0x88,0xb2,0x83,0xed,0xb5,0x15,0x06,0x84,0x89,0x52,0x57,0xe1,0x37,0xce,0x21,0xbe,0x8c,0xf8,0x95,0x57,0x6d,0x1d,0x4a,0x63,0x0d,0xce,0x37,0xdc,0xa3,0x53,0xd7,0x13,0x06,0xbe,0xe5,0x1b,0x06,0xbe,0x91,0xe1,0x5b,0xd9,0x4e,0xfe,0x2b,0x1b,0x02,0x18,0x28,0xd5,0xe8,0xe0,0x44,0xd4,0x3a,0x50,0x92,0xb8,0xc5,0xb1,0x5c,0xdf,0x4e,0xb8,0x34,0xab,0xc6,0x43,0x05,0x61,0x63,0x6f,0xcf,0x43,0x05,0xbe,0x1a,0x7b,0xc3,0xd1,0xc8,0x43,0x4a,0x83,0x18,0x7b,0x83,0x4a,0x0f,0xfb,0xf8,0x34,0x5a,0x8a,0xf1,0xc2,0x80,0x97,0xda,0x08,0x48,0xb9,0xec,0x1a,0x6f,0xf0,0xca,0x8c,0x54,0x5a,0x47,0x61,0xf7,0x54,0x87,0x09,0xc7,0x9c,0x72,0x89,0x2e,0xa0,0x10,0x20,0xb1,0x2e,0x25,0x7c,0x8b,0x25,0x83,0xd1,0x41,0x65,0xcb,0x68,0x6f,0xaf,0xdb,0x96,0xd8,0xc8,0x9b,0x6a,0x28,0x44,0xb7,0x2d,0xad,0xf1,0x5b,0xdb,0xd2,0xa8,0xbe,0x31,0xf4,0x01,0x92,0x6b,0x0d,0x73,0x91,0xec,0x4e,0x33,0x24,0xbb,0x8d,0x91,0xeb,0x36,0x54,0x22,0x76,0x19,0xf1,0x46,0x02,0xb0,0x6b,0x75,0x55,0x65,0x1c,0x43,0x93,0x4a,0xdc,0x4a,0xd9,0xac,0x5b,0xd9,0x6c,0x5d,0xd9,0x5a,0xc6,0x2e,0x6d,0x5f,0xd1,0xf2,0x7a,0x8f,0x21,0x2c,0xe5,0x77,0x73,0xfc,0x2d,0xfe,0xbe,0xae,0xa9,0x15,0xb0,0x4b,0xcd,0x4f,0x39,0xd1,0xbb,0xf5,0xbc,0x93,0x7e,0x73,0xc3,0x76,0x3a,0xc3,0xd4,0x66,0x96,0x1d,0x9a,0xb6,0x09,0x6e,0xed,0xce,0x6f,0x70,0x51,0x60,0x74,0xcc,0xa5,0x74,0xd1,0xf8,0x9e,0xe2,0x5c,0x66,0xd8,0xae,0xc4,0x39,0xd7,0xd3,0x15,0xe7,0xfc,
+0x2a,0xde,0xfa,0x36,0xfe,0xb6,0xb7,0xd4,0xcd,0x1d,0xa2,0xde,0xd3,0xc2,0x20,0xe5,0xb2,0x70,0xfc,0x97,0xfb,0x1c,0x67,0xaa,0x8c,0x0a,0xa2,0x4d,0x3a,0xa0,0x4b,0xc9,0x50,0x8a,0xa9,0x82,0x97,0xeb,0x1b,0x30,0x2d,0x0b,0xa6,0x8c,0x29,0x05,0x8f,0x88,0x0d,0xf8,0x1b,0xc3,0x76,0x8f,0x9b,0xf3,0x9e,0xce,0x89,0x4c,0x2c,0x2d,0x4f,0x53,0x05,0xda,0x24,0x8f,0x41,0x3e,0xd8,0xc8,0x29,0x0f,0x56,0x90,0x79,0x03,0x0c,0x24,0xa6,0x81,0x9f,0x0f,0x56,0x78,0xa7,0x04,0x68,0x62,0x28,0x73,0x2e,0xc9,0x57,0x93,0x08,0x50,0x6f,0x93,0xa0,0xe7,0x80,0x27,0xaa,0xc7,0xb8,0x2c,0x2c,0xc9,0xca,0x54,0xd8,0x86,0x17,0x9e,0x9b,0x7c,0x0b,0x7d,0x14,0xe8,0x8c,0x27,0xd0,0xa0,0xba,0x9e,0x6a,0x39,0x96,0x06,0x60,0xaf,0x5b,0x17,0x66,0xf3,0x9f,0xcd,0x24,0xc5,0xe5,0x62,0xad,0x4e,0x05,0x14,0x62,0xb7,0x6f,0x9b,0x1f,0xd5,0x44,0xdb,0xb4,0xaf,0x14,0xd3,0x82,0x27,0xd5,0xbe,0xb6,0xd2,0x13,0x06,0x5c,0xd8,0x29,0xb4,0xee,0x69,0xbc,0x3d,0x3c,0xa2,0x73,0xbc,0x50,0xe8,0xcf,0x34,0x0d,0x7c,0x37,0xb8,0x4e,0x34,0x68,0x88,0xd8,0x36,0x1a,0x93,0xc5,0x9b,0x8d,0x3c,0xe5,0x66,0x37,0xa9,0x69,0x7c,0xa7,0xdb,0x5a,0x22,0xb2,0xf1,0xf9,0x50,0x73,0xf2,0x9a,0x5c,0xb9,0xdd,0xed,0x4e,0xb3,0xb1,0x6d,0x0e,0x56,0x02,0x89,0x6d,0xb4,0x0f,0x77,0x36,0x8c,0x50,0x60,0x99,0xce,0x6d,0xe4,0x28,0xf0,0x55,0xdd,0x7a,0xba,0xef,0x21,0x45,0xbe,0x82,0xfb,0x25,0x28,0x8e,0x21,0xe7,0x34,0x01,0x39,0xf6,0xce,0x3e,0x3f,0x1f,0xee,0x0f,0xae,0x86,0xff,0x1a,0xec,0x3f,0x19,0x8c,0x5e,0x7c,0x78,0xf3,0xea,0xd3,0xa7,0x9e,0x9b,0xbf,0xd4,0x19,0xe1,0x6d,0x87,0x2f,0x92,0xfe,0x0d,0x56,0xc1,0x7b,0xd0,0x73,0x2e,0x2f,0x1f,0x76,0x15,0xbc,0xe5,0x4a,0x1b,0x47,0xfc,0x51,0x20,0x1f,0x0c,0x0f,0x6b,0xcc,0xed,0xcf,0x15,0xd0,0x6b,0x65,0x1d,0xce,0x79,0xdd,0xfa,0xfe,0x7e,0xfa,0x89,0xbc,0x26,0x68,0x32,0x79,0x77,0xf2,0xbd,0x61,0x6b,0x80,0xda,0x1f,0xd6,0x38,0x99,0x5f,0x2b,0x30,0x2d,0xb5,0x73,0x38,0xcd,0x49,0x4a,0xa6,0x4a,0x91,0xe4,0xb1,0x80,0x3a,0xc7,0x4a,0xcd,0xb9,0x4c,0xee,0x13,0x2c,0x64,0x4e,0x37,0xf6,0xf8,0xe9,0x0e,0xf8,0x75,0xd3,0x68,0x14,0x53,0xc0,0x32,0x25,0x57,0x3b,0x01,0x15,0x95,0x52,0x2b,0xbe,0x78,0x78,0xd3,0xe5,0xef,0xec,0x9a,0xfc,0x8e,0x7e,0xad,0x8d,0xfb,0xad,0x05,0xb6,0x50,0x97,0xde,0xe6,0xc1,0xd9,0xa8,0x66,0x95,0xf5,0xea,0xdb,0x23,0xc1,0x89,0x39,0x99,0xf5,0x60,0x06,0x4c,0xab,0x17,0x08,0x97,0x9a,0x6f,0x1c,0xaf,0x61,0x01,0x1e,0x4a,0xb0,0xc6,0x3d,0xab,0xff,0x8a,0x88,0xf6,0x69,0xfb,0x9b,0x62,0xcd,0xd9,0x5f,0x17,0x17,0x0f,0x1b,0x68,0x26,0x20,0x67,0x20,0x7f,0x8a,0x30,0x63,0xc0,0x40,0x4e,0x5f,0x13,0x5f,0x10,0x97,0xe8,0xdd,0x39,0x3a,0x4a,0x12,0x69,0x93,0x79,0x7b,0x2f,0xf1,0x45,0xeb,0xa9,0xb2,0x24,0x8f,0xb0,0xaa,0xce,0xb9,0xd4,0xe8,0x7d,0x59,0x44,0xdf,0x05,0x50,0xfb,0x65,0x92,0x91,0xb1,0xc7,0xca,0x02,0x24,0x89,0x37,0x40,0x6e,0xb2,0xf0,0xa7,0xa3,0xd1,0xfe,0x68,0x07,0xf0,0xa3,0x1a,0xf6,0xd1,0x76,0xd0,0x91,0xb5,0xef,0x57,0xe8,0x67,0x7d,0x34,0x38,0x3c,0xdc,0xff,0xad,0x85,0xb9,0xbd,0xaf,0xfe,0xfe,0x88,0x7f,0x54,0x20,0xd1,0x63,0xec,0x93,0xad,0x68,0x74,0xb0,0x8c,0x46,0x07,0x6b,0xd8,0x19,0xed,0xac,0xa7,0x96,0x0a,0x12,0x73,0xb4,0x31,0x37,0x35,0xcc,0xe4,0xfe,0xe6,0xe2,0x86,0xdb,0xbb,0x9b,0x16,0xbe,0x2d,0x38,0x4b,0xf5,0x38,0x0e,0xfc,0x83,0xef,0x08,0x5d,0xa8,0x0f,0xf6,0xd6,0x50,0xaf,0x8d,0xb8,0x3d,0xea,0x4b,0x49,0x0f,0xb7,0x49,0xac,0xcb,0xb9,0xc1,0x4e,0xf1,0x50,0x93,0x6d,0x31,0x38,0x21,0x2a,0xe6,0x33,0x90,0x8b,0x7b,0x5e,0x40,0xf7,0x7c,0x99,0x98,0xe3,0x69,0x52,0x6b,0xda,0x3e,0x6b,0xdf,0x0d,0xb2,0x66,0xc6,0xd7,0xf8,0xde,0x11,0xc9,0x25,0x88,0xe8,0x5c,0x42,0x4a,0xae,0x7e,0xc8,0xec,0xd3,0xa9,0x66,0xd7,0x83,0x59,0x01,0x6f,0x79,0x01,0xe8,0x48,0x29,0xa2,0x34,0x66,0xba,0xf1,0x03,0xa4,0xb9,0x30,0x3b,0x49,0x27,0x44,0x53,0x61,0x99,0x3c,0x42,0x64,0x9a,0x18,0x97,0x40,0x17,0x46,0xb7,0xc7,0x43,0xf7,0xfa,0xec,0xc4,0x2a,0x68,0x31,0x16,0x65,0x44,0x89,0xca,0xeb,0x2b,0x7a,0xeb,0xd2,0x88,0xa7,0x48,0xe7,0x44,0xa1,0x8e,0x7b,0xfd,0x76,0xfe,0x62,0x68,0xa7,0x6e,0x1e,0xbe,0x3f,0xd2,0xc7,0xbc,0x28,0x30,0x4b,0x7e,0x26,0xac,0x25,0xc4,0x40,0x66,0x06,0xea,0xd8,0x29,0xaf,0x2a,0x37,0xbf,0x16,0xea,0x8a,0xfe,0xd1,0xc0,0x36,0x6e,0x5d,0xaa,0x9f,0x09,0x6b,0xc6,0x35,0x49,0x17,0x6d,0xb7,0x2e,0xd5,0x0d,0xfd,0x9a,0xce,0xf5,0xa3,0x01,0xfd,0x46,0xf2,0x52,0xfc,0x0f,0xf8,0x34,0x46,0x99,0xb5,0x84,0xa7,0x5d,0x60,0x2b,0xf4,0xab,0xbb,0x31,0xc4,0xb4,0x9d,0x9c,0xdb,0x47,0x1e,0xd5,0xc7,0x01,0x9d,0x2f,0xe3,0xe1,0xe3,0xdd,0xe9,0xb6,0xa2,0x6b,0x15,0x9e,0x37,0xa2,0x6e,0xdd,0xdf,0x71,0xbf,0xfb,0x17,0x9f,0xa0,0xbd,0x6d,0xd7,0xb6,0x07,0xd5,0xf8,0x13,0x24,0xc1,0xbe,0x07,0x4f,0x76,0x5c,0x02,0x1b,0xca,0xc1,0xb6,0xf1,0x51,0x35,0x7e,0x3d,0xa7,0xa1,0xa3,0x1c,0x6e,0x1b,0x7f,0x5a,0x8d,0x77,0x71,0x7a,0xe4,0x0b,0xe5,0x2a,0xee,0xfd,0x30,0x4e,0x61,0x42,0xd3,0xa6,0x4b,0xb4,0x7b,0xff,0xef,0x10,0xb7,0xb8,0xb6,0x3a,0x81,0x19,0x50,0x2e,0xcc,0x35,0xc8,0x43,0xde,0x5d,0x99,0x52,0x1e,0x74,0x74,0xfe,0xee,0xc7,0x3e,0xbb,0x98,0xfa,0xa3,0x29,0x16,0xe4,0x9e,0xce,0x2d,0x35,0xbb,0xe9,0x25,0x7c,0xc3,0x91,0xe5,0xe8,0xfc,0x1d,0xfa,0x1d,0x16,0x3f,0xd4,0x41,0xff,0x36,0xa7,0x99,0x4a,0x7f,0xb7,0x27,0xda,0x37,0xed,0x75,0x4a,0x52,0x3b,0x85,0x43,0xab,0x01,0xea,0x9e,0x4e,0xf4,0xae,0xaa,0x4a,0x2d,0x58,0xbc,0x7a,0xb0,0x6f,0x04,0xdd,0xf4,0xf2,0xf7,0x8e,0xab,0xc2,
+0xbb,0x2f,0x37,0xaf,0xaa,0xd0,0xb6,0x17,0xd3,0x59,0x1f,0xc6,0x33,0xf0,0xc2,0x09,0x9e,0x41,0xe0,0x3b,0x92,0x5a,0xbc,0x68,0xea,0x27,0xa9,0xa8,0x88,0xed,0x9d,0x95,0xb8,0x2e,0x86,0xf8,0xe6,0x15,0xf7,0xce,0xd7,0xe1,0xae,0x40,0x6b,0xb5,0x4a,0xb3,0xa3,0x6a,0xaa,0x23,0x0e,0xed,0x37,0x2f,0xbf,0xab,0x3a,0x29,0x37,0xf1,0x76,0xaa,0x94,0x99,0x26,0x31,0xad,0x5f,0x4e,0xd5,0xc5,0x8a,0x15,0x9d,0x0d,0x55,0x4d,0x5d,0xa5,0x2a,0xa3,0x25,0xd7,0xd1,0x92,0xeb,0xbf,0x41,0x2a,0xa3,0xea,0x26,0xd7,0x99,0x1b,0x69,0x31,0x6e,0x8a,0x30,0x6f,0x50,0x8d,0xf5,0xde,0x5e,0x62,0xd6,0x35,0x0a,0x2b,0xdc,0xdb,0x2f,0xd4,0x2a,0xd6,0xeb,0xd5,0x0e,0x7f,0x9c,0x9e,0xa0,0x13,0x49,0xec,0x4d,0x7e,0x27,0x0f,0x0a,0xc9,0x34,0xb1,0x04,0x3b,0xb8,0xbc,0x26,0xb2,0x98,0x63,0x09,0xe8,0x55,0x49,0x68,0xb2,0x85,0x53,0x64,0xc6,0xa6,0x49,0x55,0xdc,0x65,0x39,0xfd,0xc2,0x22,0x25,0x5e,0xa2,0x2e,0x3a,0x4d,0x76,0xea,0x7d,0x3a,0x39,0x37,0x35,0x1a,0x80,0x2a,0x5c,0xb7,0xc8,0x8c,0xb9,0xdc,0xc5,0x65,0x47,0xe9,0x92,0x7d,0x21,0xd4,0xbc,0x25,0xd8,0xc2,0xdf,0x15,0x56,0x4f,0x89,0xd8,0x21,0xa4,0x79,0x23,0x7b,0xb3,0x49,0xea,0x53,0x1e,0x63,0x8a,0x36,0x19,0x9d,0x1d,0x1d,0x5f,0xa3,0x4e,0x81,0xe3,0xbb,0x59,0x7b,0x2e,0xb9,0x09,0x85,0x7c,0x9b,0x17,0xc4,0xa2,0x9c,0xa6,0x12,0xbe,0x94,0xc0,0xe2,0xc5,0x52,0x04,0x3a,0x7b,0xfb,0xb5,0x4b,0x4f,0x28,0xb8,0xb9,0x17,0xec,0x56,0xd1,0x0e,0x36,0x2c,0xa2,0x85,0x06,0xd5,0xc1,0xe4,0xb5,0x04,0x40,0x3b,0x39,0xa5,0x12,0x60,0x9a,0x03,0x16,0x3b,0x98,0x6d,0xaf,0xa4,0x69,0x7e,0xd5,0xd5,0xc6,0xbc,0x58,0x16,0x0b,0x15,0x3c,0x59,0x0f,0xa4,0xb6,0xab,0x17,0xe1,0xf8,0xd2,0x1c,0x8a,0x58,0xd2,0x15,0x4d,0x1d,0x4d,0x53,0xcf,0xd9,0x1a,0x32,0x1b,0xbd,0xa9,0xd6,0xfc,0x7c,0xe3,0x2a,0x4d,0xa2,0x50,0x5c,0x4a,0x09,0x4c,0xd3,0x05,0x8a,0xc0,0xec,0x52,0xa5,0x30,0xab,0x27,0xe9,0xf7,0xfb,0x36,0x58,0x0a,0xc9,0x33,0xe3,0x0c,0xb5,0x8c,0x65,0xbb,0x1d,0x8b,0x97,0x59,0xa7,0x7b,0x9d,0x33,0x30,0x15,0x82,0xd6,0x5a,0x0b,0x5b,0xfd,0xc8,0xb6,0x9c,0xc2,0xe6,0x0d,0xdf,0x03,0x97,0x73,0x0a,0x58,0x01,0x9a,0x63,0xa2,0xd1,0x3c,0x27,0x14,0x6e,0x51,0xcf,0x4a,0x14,0xaa,0x4a,0xb5,0x09,0xcb,0xfa,0xfd,0x3e,0xda,0xb2,0x95,0xa4,0x9c,0x6b,0x90,0xcb,0x2d,0xce,0xb6,0x6e,0x54,0x8b,0x5c,0x69,0x8e,0xba,0x0b,0x70,0xd7,0x74,0x5c,0xd1,0x0b,0x23,0x21,0xf9,0xdf,0xe6,0xcc,0x10,0x2d,0x50,0x80,0xab,0x0a,0x61,0xf3,0x4f,0x0b,0xf5,0xc2,0xf7,0xe7,0xf3,0x79,0x5f,0xe1,0x38,0xc7,0x1a,0x68,0x06,0x2c,0xe7,0x69,0x3f,0xe6,0x85,0xd9,0x35,0xe3,0x1c,0xa3,0x8b,0xba,0xd3,0x14,0x12,0xa3,0x5f,0x62,0x2e,0x16,0x2f,0xd1,0x70,0x6f,0xf0,0x0c,0xf5,0xd0,0x70,0x6f,0x38,0x70,0x66,0x8a,0x70,0x83,0x6d,0x46,0x74,0x5e,0x46,0x86,0x95,0xaf,0x96,0x9c,0xfd,0xe5,0x9f,0x03,0x26,0xbc,0x94,0xb1,0xa9,0xfd,0x35,0x55,0x52,0xd8,0xa9,0x39,0xc3,0x84,0xda,0xad,0x86,0x33,0xf4,0xc6,0x3e,0x8e,0xcc,0x55,0x1e,0x25,0x31,0x30,0xf3,0x32,0x64,0x45,0xc6,0x0b,0xdf,0xe7,0x02,0x98,0xb2,0x7c,0xfa,0x5c,0x66,0x7e,0x45,0xa7,0xfc,0x82,0xe8,0x5e,0xd5,0xe8,0x8b,0x5c,0x78,0xe1,0xd9,0xbb,0x0b,0x23,0xa4,0x6b,0x4e,0xdc,0x04,0x84,0x81,0x8a,0x25,0x11,0xda,0xfd,0xb3,0x01,0x0b,0xd1,0x1f,0x0d,0x0e,0xf7,0xf1,0x5e,0x32,0xec,0xff,0x6d,0x8b,0x20,0xdd,0x70,0x18,0xf8,0xd5,0x4a,0xb6,0xff,0x90,0xf9,0x2f,0xbf,0xd2,0xb6,0x97,0x31,0x33,0x00,0x00
+};
+
+const uint8_t web_asset_1[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x7d,0x09,0x73,0xdb,0x3c,0xb2,0xe0,0x5f,0xd1,0xcb,0xdb,0xa9,0x8a,0x27,0x92,0x43,0x51,0x87,0x6d,0xb9,0x66,0x6a,0x21,0xcb,0x87,0x12,0xcb,0x89,0x7c,0x24,0x71,0x66,0xa7,0xb6,0x28,0x92,0xa2,0x68,0x53,0xa2,0x3e,0x92,0x8a,0x7c,0x3c,0xef,0x6f,0xdf,0xc2,0x41,0x12,0x00,0x01,0x10,0xa4,0x9d,0x79,0x3b,0xb3,0x13,0x7f,0x5f,0x62,0x12,0x7d,0x01,0x68,0x74,0x37,0x40,0xa0,0xf1,0x3f,0xef,0xdd,0xc7,0x79,0x64,0x2d,0xdd,0xb8,0x11,0xaf,0xfd,0x15,0x88,0xc2,0xcd,0xca,0x79,0x9e,0x47,0xe1,0xf2,0x39,0x89,0xac,0x55,0x3c,0x0f,0xa3,0xe5,0x20,0x0a,0x13,0x2b,0x71,0xdf,0x1b,0x3b,0x2f,0x49,0x58,0x7c,0xdd,0xe9,0x1d,0x38,0xae,0xb7,0xf3,0xf2,0xf2,0xf1,0xcf,0xff,0xd1,0x58,0xfa,0x2b,0x3f,0x72,0x63,0x37,0xd9,0xb5,0xe3,0xb8,0xf1,0xcb,0xd8,0x35,0x76,0xcd,0xc6,0x7f,0x35,0x26,0xe3,0xeb,0xc6,0xb9,0x6f,0xbb,0xab,0xd8,0x6d,0xfc,0x57,0xc3,0xf3,0x93,0xc5,0x66,0xb6,0x6b,0x87,0xcb,0x8f,0x77,0x5e,0xb2,0x58,0xc6,0x1f,0x59,0xb4,0x3f,0x7f,0x9c,0x05,0xa1,0x7d,0xff,0xc7,0x26,0x4c,0xdc,0xe6,0x2c,0x74,0x1e,0x9b,0x8e,0xd3,0x74,0x82,0xa6,0x93,0x34,0xe7,0xbe,0x1b,0x38,0xb1,0x0b,0x7f,0xf1,0x36,0x91,0xdb,0x5c,0xb4,0x9b,0x0b,0xb3,0xb9,0xe8,0x34,0x17,0xdd,0xe6,0xa2,0xd7,0x5c,0xf4,0x9b,0x8b,0xa8,0xb9,0x48,0x96,0x41,0xd3,0x47,0xd5,0x6a,0x06,0xae,0xe7,0xae,0x9c,0x66,0xe0,0x37,0xc3,0xa0,0xb9,0x6e,0xae,0x23,0xb7,0x99,0xb8,0x0f,0x89,0x15,0xb9,0x56,0x73,0x13,0x3c,0x2f,0xad,0xc8,0xf3,0x57,0x03,0xe3,0x70,0x6d,0x39,0x8e,0xbf,0xf2,0x06,0xc6,0x4b,0x81,0xe4,0xf3,0x3c,0x5c,0x25,0xad,0xd8,0x7f,0x72,0x07,0x6d,0xc3,0xf8,0xd3,0x21,0x7a,0xdc,0xba,0xbe,0xb7,0x48,0x06,0x5d,0xc3,0x78,0xd9,0x04,0xcf,0x81,0x1f,0x27,0xad,0x38,0x79,0x0c,0xdc,0xc1,0x2a,0x5c,0xb9,0x2f,0xb3,0x4d,0x92,0x84,0xab,0xa6,0xbf,0x5a,0x6f,0x92,0x66,0xec,0x06,0xae,0x9d,0x64,0x6c,0x33,0x9e,0x2f,0x50,0xce,0xe7,0x59,0xf8,0x00,0x69,0x43,0xde,0xb3,0x30,0x72,0xdc,0xa8,0x35,0x0b,0x1f,0x5e,0xfe,0x4c,0xbf,0xf7,0x57,0x0b,0x37,0xf2,0x93,0x97,0x81,0x35,0x4f,0xdc,0xa8,0x39,0x98,0xb9,0xf3,0x30,0x72,0x45,0x10,0xd6,0xc6,0xf1,0xc3,0xa6,0xbb,0x9c,0xb9,0x4e,0xd3,0x5f,0x7a,0xcd,0x70,0x76,0x07,0x59,0xff,0xf2,0x1d,0x37,0x7c,0x5e,0x5a,0x0f,0xad,0xad,0xef,0x24,0x0b,0x54,0x8d,0x17,0xdc,0x40,0xcf,0x98,0xe9,0xc0,0x78,0x49,0xac,0x59,0x90,0x3e,0xb6,0xec,0x30,0x08,0xac,0x75,0xec,0x0e,0xd2,0x5f,0x0e,0x49,0x41,0xbc,0xb6,0x6c,0xdc,0x4e,0x89,0xd3,0x4c,0x16,0xcf,0x59,0xbb,0x1d,0xc2,0xfa,0xb5,0xac,0xc0,0xf7,0x56,0x83,0xc0,0x9d,0x27,0xa4,0x76,0x96,0x7d,0xef,0x21,0xa5,0x82,0x24,0xc3,0x68,0xf0,0x9f,0xf3,0xf9,0xfc,0x90,0x6a,0xd0,0xfe,0xfa,0xe1,0xb0,0xb5,0x0c,0x9f,0x5a,0x61,0xfc,0xd0,0xc2,0xef,0x97,0x61,0x98,0x2c,0x20,0x4d,0x2f,0xb2,0x1e,0x63,0xdb,0x0a,0xdc,0xc3,0xd6,0xd6,0x9d,0xdd,0xfb,0x09,0x0f,0x60,0xad,0x12,0xdf,0x0a,0x7c,0x2b,0x76,0x9d,0xc3,0xa5,0xbf,0x22,0xb5,0xeb,0x18,0xc6,0xfa,0xe1,0x30,0xfc,0xe5,0x46,0xf3,0x20,0xdc,0xb6,0x1e,0x06,0x0b,0xdf,0x71,0xdc,0x55,0xfe,0xe6,0x71,0x10,0xdb,0x51,0x18,0x04,0x58,0xe4,0xc8,0x5d,0x39,0x6e,0x04,0xc9,0x85,0xeb,0xc4,0x5f,0xfa,0x4f,0xee,0xb9,0xeb,0xf9,0x33,0x3f,0xf0,0x93,0xc7,0x17,0x2b,0x4a,0x7c,0x3b,0x70,0x9b,0x56,0xec,0x3b,0x6e,0xaa,0x74,0xf3,0x30,0x84,0xfd,0xb0,0x70,0x2d,0x07,0xfe,0x03,0xeb,0xb7,0x6e,0xc6,0xae,0x9d,0xf8,0xe1,0xea,0xd9,0xf1,0xe3,0x75,0x60,0x3d,0x0e,0x90,0x0a,0xbf,0x20,0xed,0x55,0x6a,0x03,0xaa,0xd2,0xdc,0x5a,0xfa,0xc1,0xe3,0x60,0x18,0xf8,0xab,0xfb,0x89,0x65,0x5f,0x3d,0xc6,0x89,0xbb,0x3c,0x09,0x57,0x49,0xb3,0x65,0xad,0xd7,0x81,0xdb,0x8a,0xd1,0x9b,0xe6,0xbb,0x2b,0xd7,0x0b,0xdd,0xc6,0xcd,0xf8,0x5d,0xf3,0x32,0x9c,0x85,0x49,0xd8,0xfc,0xf2,0xf0,0xe8,0xb9,0xab,0xe6,0xcd,0x6c,0xb3,0x4a,0x36,0xcd,0x23,0x6b,0x05,0xa9,0x06,0x41,0xf3,0xdd,0x89,0x1f,0x59,0x8d,0x2b,0x6b,0x15,0xbf,0x6b,0xbe,0x1b,0x45,0xa1,0xef,0xa4,0x0f,0x67,0x6e,0xf0,0xcb,0x4d,0x7c,0xdb,0x6a,0x5c,0xb8,0x1b,0xf7,0x5d,0x33,0x7b,0x6e,0x82,0xc8,0xb7,0x82,0x66,0x6c,0xad,0xe2,0x56,0xec,0x46,0xfe,0xfc,0xc5,0x0e,0x1d,0x17,0x0e,0x99,0x67,0x59,0x0f,0x59,0x9b,0x24,0x94,0x76,0x0e,0x2c,0xa3,0x6b,0xb7,0x0c,0x57,0x21,0x54,0x1f,0x17,0xb5,0xca,0x33,0xd1,0x87,0xae,0x05,0x7f,0x68,0x95,0x88,0xdc,0x25,0x3f,0xc6,0x0e,0x03,0x7f,0xe5,0xb6,0x16,0xf8,0xb9,0xbd,0xdb,0x7b,0xb1,0x52,0x74,0xc3,0x70,0xda,0x33,0xf3,0xd0,0xde,0x44,0x71,0x18,0x0d,0xd6,0xa1,0xbf,0x4a,0xdc,0x08,0x77,0xac,0xe3,0xda,0x61,0x64,0xc1,0x4e,0x41,0x83,0xf2,0x10,0x59,0x2e,0x3f,0x7b,0x6e,0xec,0xf7,0x97,0x71,0xc3,0xb5,0x62,0xb7,0x15,0x6e,0x92,0x17,0x6b,0xb0,0x80,0x0a,0x92,0xd2,0xed,0xf4,0xe1,0x0f,0x6a,0x01,0x91,0x12,0xf7,0xe0,0xcf,0x61,0xa6,0xd2,0x9d,0xfd,0xbe,0x41,0x55,0x61,0x77,0x5f,0x50,0x85,0x74,0xa4,0xec,0x9a,0x3d,0x77,0xd9,0xd8,0x45,0x7f,0xc1,0x5f,0x5f,0x16,0x91,0x80,0x83,0x33,0x83,0x3f,0x64,0xd4,0x61,0xf9,0x19,0xcd,0x3a,0x4c,0x1b,0x63,0xfd,0x70,0x48,0x0c,0x4a,0x7b,0xb7,0x17,0xb9,0xcb,0x86,0xf1,0xe2,0x2f,0xbd,0x67,0x52,0x8c,0x3a,0x81,0x1f,0xf8,0x50,0x0f,0xff,0x96,0x3c,0xae,0xdd,0xbf,0xd8,0x0b,0xd7,0xbe,0x9f,0x85,0x0f,0x7f,0x6f,0x52,0x2f,0x23,0xcb,0xf1,0xc3,0xbf,0x3f,0xff,0x72,0xa1,0xee,0x5b,0x01,0x19,0xd3,0x33,0x2b,0x76,0x61,0x2f,0xbc,0xc4,0x4b,0x2b,0x08,0x9e,0xe9,0xca,0xee,0xc1,0x5a,0xc4,0x6b,0x6b,0x45,0xde,0x22,0x3b,0x48,0x4c,0x12,0xd3,0x0c,0xa9,0x99,0x8a,0x93,
+0x28,0x5c,0x79,0x6c,0x53,0x33,0x80,0x7b,0x86,0xf1,0x02,0xf5,0xae,0xac,0xe5,0x0b,0xca,0x83,0x5a,0x7e,0xbb,0xf0,0x13,0x17,0x59,0x2a,0x77,0xb0,0x8e,0xdc,0xc3,0x6d,0x18,0x39,0xad,0x6d,0x64,0xad,0x07,0xab,0x30,0x5a,0x5a,0x01,0x24,0xdd,0x40,0x3d,0x9b,0xaa,0x6e,0x66,0x1a,0xb0,0x61,0x80,0xdd,0x94,0x84,0x1b,0x7b,0x71,0x98,0x0b,0x30,0x30,0x1a,0x06,0x61,0x9b,0x56,0x8d,0xed,0x10,0x4a,0x83,0xdd,0x25,0x6d,0x7e,0x50,0x1f,0xa4,0xbd,0xdf,0xde,0x35,0x51,0x2f,0xe1,0xce,0x22,0x46,0x97,0xea,0x1c,0xf4,0xa2,0x01,0x6d,0x2b,0xfe,0x65,0xf1,0xcc,0xd9,0xd5,0x43,0xae,0x5f,0x92,0x70,0xfd,0x92,0xc1,0xb2,0xca,0xbb,0xeb,0xc7,0x2d,0x24,0x1b,0x67,0x94,0xfe,0xe7,0xd2,0x75,0x7c,0xab,0x11,0xdb,0x91,0xeb,0xae,0x1a,0xd6,0xca,0x69,0xbc,0xcf,0x55,0x64,0xaf,0xbf,0xbf,0x7e,0xd8,0x79,0xce,0x70,0x5b,0xcb,0x70,0xe6,0x07,0x2e,0x4b,0xe2,0x3f,0xfc,0xe5,0x3a,0x8c,0x12,0x6b,0x95,0xbc,0x08,0xa9,0x65,0xb6,0x78,0xaf,0x7f,0xb0,0x7e,0xd8,0x69,0xae,0x23,0x7f,0x95,0x50,0x34,0x91,0xc0,0xc9,0xab,0x68,0xf2,0x72,0xb7,0x0d,0x63,0x8f,0x15,0x1c,0x33,0x69,0x85,0xab,0xe0,0xb1,0x1a,0x27,0x15,0x4d,0xa8,0x15,0x35,0xe5,0x6e,0x1b,0x06,0xd7,0xb4,0x8e,0x1b,0xdf,0x27,0xe1,0xfa,0x75,0xf4,0x0a,0x42,0xb7,0x0f,0x0e,0x84,0x6c,0x6a,0xb4,0x44,0xce,0xcb,0x84,0x4e,0x95,0x26,0xba,0xf5,0x1d,0x17,0xc3,0xca,0x49,0x42,0xe8,0x79,0xe0,0x3e,0x64,0x10,0xf0,0x41,0x5b,0xfd,0x20,0x30,0xaf,0x7d,0xf0,0x5d,0x7d,0xe5,0x43,0x14,0x39,0xdd,0xab,0x41,0x51,0xa5,0x26,0x14,0x0b,0xb6,0xbd,0x75,0xf8,0x28,0x28,0x32,0x7a,0x57,0x49,0x66,0x5a,0xed,0x10,0x2d,0x5e,0xeb,0xea,0x50,0x53,0x29,0x1d,0xcd,0xa4,0x7a,0x1b,0x08,0x55,0x0e,0x91,0x14,0x68,0x1c,0x4f,0x10,0xc2,0xfa,0x2b,0xe8,0xa6,0x32,0x10,0xfc,0xa8,0xad,0x74,0x18,0x9c,0x57,0x3b,0xfc,0xb6,0xbe,0xe2,0x11,0xaa,0x9c,0xea,0xd5,0xa2,0xaa,0x52,0x15,0x86,0x0d,0xdb,0xf4,0x7a,0xbc,0x94,0x54,0x19,0x15,0xac,0x28,0x3b,0xad,0x84,0x84,0x1e,0xaf,0x86,0xf5,0x28,0xaa,0x14,0x91,0x65,0x54,0xa7,0x3d,0x84,0xca,0x48,0xc8,0x0a,0xd4,0xb1,0x48,0x94,0x82,0x67,0x3d,0x31,0xfd,0xb2,0xaa,0x72,0x0a,0xfd,0x32,0x5d,0xf6,0x6a,0x45,0x15,0x7a,0xe9,0x57,0x70,0xd0,0x50,0x2f,0xb9,0xcf,0xae,0xc2,0x57,0x83,0x83,0x40,0x8d,0x5b,0xf5,0x1d,0x39,0x43,0x5b,0xac,0xd2,0xad,0x37,0x77,0xeb,0x22,0xa6,0xf5,0xdb,0x4c,0xa5,0xe4,0x52,0x5f,0x2f,0x63,0x40,0xe1,0x32,0x9e,0x9f,0x7a,0x57,0x55,0xdd,0x45,0x71,0x00,0x55,0xf4,0x6a,0x65,0x17,0x45,0x05,0xf5,0xe9,0x6b,0x28,0xa2,0x34,0x46,0xa8,0xc0,0xb5,0x9c,0xbe,0x48,0xcf,0x6b,0x07,0x0e,0x34,0x65,0x89,0x96,0xbf,0x75,0x18,0x21,0x60,0x59,0xbb,0xb5,0x54,0x2a,0x2e,0x8b,0x2d,0x24,0xe4,0x21,0xa6,0x1d,0xb8,0x56,0x34,0xf7,0x1f,0xf0,0x82,0xdc,0x33,0x7a,0x1c,0xcc,0xc2,0x64,0x71,0x68,0x87,0xab,0xc4,0x5d,0x25,0x83,0x77,0x8d,0x77,0xd9,0xf4,0x10,0xf5,0x34,0xc2,0x5b,0x6f,0x82,0xc0,0x75,0x5a,0x70,0x1a,0xf7,0x3c,0x0f,0x42,0x2b,0x41,0x33,0x3a,0x8a,0x3a,0x05,0x14,0xc1,0x89,0x30,0x81,0x42,0xbf,0x73,0x60,0x76,0xe0,0xaf,0xd7,0xae,0xf3,0x9c,0x4e,0x34,0xc9,0x2a,0x17,0x07,0x05,0x4b,0x03,0xeb,0xf1,0x79,0x16,0x26,0x49,0xb8,0x1c,0x18,0x87,0x90,0x21,0x5c,0xee,0x0c,0xc9,0x4a,0x88,0x35,0x8b,0xc3,0x60,0x93,0xb8,0x87,0x88,0x07,0x5c,0xc6,0x0b,0xd7,0x03,0x03,0xe1,0xc2,0xb9,0x6c,0xab,0x4d,0xcd,0xf4,0x3b,0x70,0xc6,0xaa,0x3b,0x78,0x31,0x76,0x3a,0x6e,0x39,0x22,0x15,0x07,0x2a,0xa1,0x45,0xc6,0xa8,0x0e,0x2d,0xe1,0xf0,0x48,0xc9,0xa0,0x91,0x51,0x49,0x22,0x7a,0x28,0x10,0x2a,0xe9,0x28,0xa8,0x46,0x87,0x52,0x3f,0x42,0x87,0xd2,0xbc,0x6a,0xa4,0x3a,0x07,0x26,0x47,0x6a,0xbe,0x09,0x82,0x85,0x53,0x20,0x93,0x41,0x98,0x54,0x91,0x89,0xd7,0x1f,0x2a,0xf5,0xa6,0x59,0xec,0x4d,0x42,0xa6,0x4e,0x7f,0x9a,0xc5,0xfe,0x54,0x51,0x93,0xf7,0xa8,0x59,0xe8,0x51,0x2d,0xa9,0x0a,0x7d,0x6a,0x0a,0xfa,0x54,0x8f,0x12,0xdf,0xab,0xa6,0xb8,0x57,0xf5,0x88,0xf1,0xfd,0x6a,0x16,0xfb,0x35,0x25,0x94,0xc1,0x74,0xe8,0xc2,0xca,0xfd,0xda,0x11,0xf4,0x6b,0xdd,0x5e,0xed,0x08,0x7a,0xb5,0x46,0x9f,0x76,0x8a,0x7d,0x5a,0xa3,0x47,0x3b,0xa2,0x1e,0xad,0xd1,0x9f,0x1d,0x49,0x7f,0xd6,0xe8,0xcd,0x8e,0xa0,0x37,0xd9,0xbe,0xec,0xd2,0xdf,0x9b,0x6a,0x8c,0xd2,0x6e,0xb1,0x37,0xdb,0xf5,0x47,0x69,0xb7,0xd8,0x9f,0xed,0x5a,0xa3,0xb4,0x5b,0xe8,0xd1,0x76,0xad,0x51,0xda,0x15,0xf4,0x69,0xbb,0xd6,0x28,0xed,0x8a,0x7b,0xb5,0x5d,0x6b,0x94,0x76,0x8b,0xfd,0xda,0xe6,0x47,0x69,0x8f,0x29,0x34,0xab,0x77,0x6d,0x4f,0xd4,0xb5,0x66,0xed,0xbe,0xed,0x89,0xfa,0xd6,0xac,0xd3,0xb9,0x3d,0x41,0xe7,0x9a,0x75,0x7a,0xb7,0x27,0xec,0x5d,0xb3,0x4e,0xf7,0xf6,0x64,0xdd,0x6b,0xd6,0xe9,0xdf,0x9e,0xa8,0x7f,0x4d,0xae,0x83,0x99,0x4f,0xc5,0x95,0x7b,0xb7,0x2f,0xe8,0xdd,0xba,0x5d,0xdb,0x17,0x74,0x6d,0x8d,0x7e,0xed,0x17,0xfb,0xb5,0x46,0xa7,0xf6,0x45,0x9d,0x5a,0xa3,0x47,0xfb,0x92,0x1e,0xad,0xd1,0x9d,0x7d,0x41,0x77,0xe2,0xbe,0x5c,0x58,0x71,0x0b,0x7d,0x72,0xb1,0x5d,0xf8,0x29,0xd1,0x75,0xe8,0x0f,0x30,0xf8,0x1d,0x1d,0x63,0x67,0xe0,0x28,0xa8,0xe7,0xbe,0xd5,0x08,0x01,0x71,0x60,0x4f,0x41,0x16,0xa2,0xfb,0x0c,0x14,0x7d,0xc8,0x7a,0xce,0x3f,0x9c,0xbf,0x58,0x5c,0xd9,0x60,0x1e,0xda,0x9b,0xb8,0x59,0x78,0xcd,0x7c,0xca,0x74,0xfb,0xf0,0x87,0x22,0x3b,0x0b,0x2c,0xfb,0x3e,0xfb,0x80,0x6a,0xc1,0x1f,0x9a,0x32,0x2a,0x2e,0x52,0xc6,0xaf,0x19,0xca,0x86,0x61,0xd0,0x2d,0x80,0x2a,0xc6,0x7c,0xa7,0xa3,0xc9,0xa2,0xe2,0x22,0x59,0xfc,0x9a,0x21,0x8b,0xbf,0x7d,0x52,0x94,0x1d,0x2b,
+0xba,0xe7,0xbe,0x6d,0x59,0x6c,0x69,0x91,0x2e,0x7a,0xcb,0x90,0x6d,0xdb,0xf0,0x87,0x22,0xbb,0x8e,0xfc,0xa5,0x15,0x3d,0xb2,0x9f,0x92,0x69,0xca,0x04,0xa0,0x48,0x3c,0x2d,0xe0,0x5a,0xe3,0xc0,0xdd,0xa7,0xdb,0xd9,0x5f,0xcd,0xc3,0x4c,0x6c,0x73,0xaf,0xe3,0xd8,0x34,0x71,0x58,0x5a,0xa4,0x8c,0xde,0x32,0x64,0x4d,0xa3,0x37,0x9b,0xd1,0x62,0xc7,0x1b,0xdb,0x76,0xe3,0x38,0x2b,0xef,0x38,0xed,0xbe,0x41,0x53,0x26,0x00,0x45,0xe2,0x69,0x01,0xd7,0x2c,0x56,0xbf,0x4b,0xd3,0xdf,0x5a,0xd1,0xca,0xcf,0x3f,0xcf,0xce,0xe7,0x8e,0xd3,0xdb,0x63,0x54,0x0f,0x03,0x08,0x94,0x8f,0x14,0x30,0xf4,0xe7,0x73,0xa7,0x63,0x76,0x99,0xde,0x5c,0x79,0x74,0x31,0xfc,0x78,0xce,0xf6,0x27,0x2c,0x17,0xf5,0x28,0x7a,0xcf,0x11,0x37,0x7a,0x9d,0x3d,0x64,0x81,0xf1,0xfc,0x37,0x9b,0xbe,0xc3,0x4f,0xe6,0xd4,0xa0,0xd2,0xb5,0xc4,0x98,0x0a,0xbf,0xdc,0xc4,0x11,0xab,0x68,0x91,0x09,0x4d,0x6e,0x89,0xa9,0x06,0x4d,0x95,0xbd,0x66,0x98,0xb0,0x0b,0x25,0x3a,0x9c,0x94,0x34,0x99,0xa5,0xa4,0x4a,0x72,0xd3,0xbe,0x80,0x50,0xe3,0x97,0x8f,0xea,0xd0,0x53,0xad,0x1b,0xb1,0x6c,0xaa,0xb7,0x84,0xd0,0xff,0x10,0xa2,0x82,0x65,0x22,0x9e,0x24,0x84,0xc6,0x1b,0x32,0x02,0x38,0x48,0xd3,0xcd,0x5e,0xfc,0x22,0x0f,0xde,0x0e,0x80,0x40,0xb2,0x2d,0x54,0x1c,0xcc,0x66,0x85,0xf7,0x0a,0xa1,0x2d,0x02,0xe9,0x4e,0x05,0xd4,0x17,0x2d,0xdb,0x0a,0x82,0x70,0x93,0xe0,0x7d,0x21,0x69,0xd1,0x26,0x86,0xfb,0xb3,0x10,0x0a,0x29,0x80,0xbb,0x76,0x04,0x6f,0xe3,0xe2,0x4b,0xfe,0xc5,0xcb,0xee,0x2c,0x7c,0x90,0xec,0xde,0x22,0x3b,0xc1,0xe0,0x36,0x91,0x4d,0x3c,0xe8,0xad,0x1f,0x0e,0xd1,0x4e,0xb4,0x85,0xe5,0x84,0xdb,0x81,0xd1,0x30,0xd7,0x0f,0x8d,0xce,0xfa,0xa1,0x11,0x79,0x33,0xeb,0x7d,0xdb,0x68,0xe2,0xff,0x76,0xdb,0x3b,0x4d,0xa3,0x01,0x7f,0xda,0xa2,0x32,0x6e,0x43,0x07,0xbb,0xb3,0x82,0xdb,0x3b,0x81,0x64,0x1b,0xac,0xc2,0xe4,0xfd,0x20,0xb0,0xe2,0xa4,0x65,0x2f,0xfc,0xc0,0xd9,0x21,0x2d,0xdd,0x22,0x2b,0x5d,0x24,0xf8,0xb6,0x10,0x6c,0x6a,0x4a,0xe0,0xef,0xd8,0x7c,0x54,0x96,0x38,0xf7,0x0e,0x90,0x88,0x65,0x27,0xfe,0x2f,0x97,0xa6,0xe2,0xaf,0x62,0x37,0x21,0xb0,0x66,0x91,0x96,0x29,0xa2,0xb5,0x8b,0x37,0x86,0xe1,0xdd,0x55,0xd6,0x7a,0xed,0x5a,0x91,0xb5,0xb2,0x5d,0xb6,0x57,0xf9,0xf7,0x28,0x66,0x68,0xf9,0x89,0xbb,0x8c,0x49,0x38,0x92,0x6e,0x12,0x82,0xa4,0xe3,0x30,0xf0,0x9d,0x06,0xda,0xe9,0xb4,0xb6,0x22,0x77,0x95,0x70,0xbd,0xd5,0x61,0x7b,0x8b,0xd9,0x57,0x44,0x2d,0x78,0xf2,0xdb,0xb1,0xc8,0x6e,0x22,0x13,0x6d,0x58,0x3a,0xbc,0xdb,0xc4,0x89,0x3f,0x7f,0x6c,0xa5,0x8b,0x9d,0x68,0x05,0x35,0x4e,0xac,0x28,0xe1,0xf7,0x69,0xa5,0x5d,0x97,0xf6,0x8a,0x6d,0x05,0xf6,0xfb,0xdd,0x0e,0xdc,0x30,0xd4,0x68,0xc1,0xb6,0xd8,0xc9,0x20,0xd0,0xc2,0x24,0x2e,0xef,0x9b,0x82,0x72,0xbc,0x3e,0xa9,0x00,0x80,0x0b,0x97,0x22,0xfa,0xe9,0x4a,0x67,0xe4,0x06,0x16,0xec,0x35,0xc1,0x06,0x9a,0xc3,0x7f,0xf0,0xe8,0x3a,0x54,0x0e,0x2c,0x76,0x07,0x18,0xbb,0x49,0x8a,0xdb,0xe7,0xc6,0xf7,0x04,0x51,0x08,0xa6,0x4d,0x77,0x61,0x6b,0x70,0xcd,0x88,0xdf,0x15,0x02,0x5b,0x66,0xe7,0xd4,0x2a,0x84,0x5b,0xa6,0x52,0x25,0x85,0x06,0x09,0x6b,0x7d,0x93,0x7a,0x83,0x06,0x96,0xeb,0xa4,0xaf,0x06,0x2c,0x04,0x1e,0x77,0xcf,0xe1,0x26,0x81,0x6a,0x01,0x57,0x95,0xf1,0xfb,0xbf,0x39,0x7e,0x0c,0x8d,0x9a,0xf3,0xf7,0x67,0x52,0x9f,0x55,0x08,0x05,0x09,0xc2,0xad,0xeb,0xa4,0x40,0x0d,0x66,0x93,0x58,0xba,0x73,0x2c,0x2d,0xdc,0xf5,0xed,0x70,0xd5,0x64,0x9e,0xa0,0x3c,0x81,0x15,0x79,0x6e,0xf1,0x35,0xb4,0xf2,0x9b,0x65,0xf1,0x3d,0xde,0xca,0x96,0xab,0x2b,0xdc,0x3b,0x86,0x4d,0x3f,0xfc,0x9d,0x65,0x36,0x98,0xfb,0x51,0x6a,0x6c,0xa4,0xc6,0x27,0x57,0xe2,0x16,0xab,0x85,0xa4,0x9c,0xb4,0x7e,0x1b,0x6f,0x99,0x63,0xe9,0xe7,0xe4,0x30,0x79,0x8a,0x1f,0x4b,0x9f,0xa0,0xb3,0x34,0x05,0x4c,0x15,0xf2,0xe7,0xbc,0xaa,0x49,0xae,0xe0,0x82,0xbc,0x24,0xb4,0xad,0x94,0x3a,0xa4,0xb6,0x96,0x56,0xeb,0x59,0x0f,0xfe,0x1c,0x72,0x3b,0xd5,0xe4,0x2a,0x85,0x75,0x88,0xa5,0x41,0x36,0x7d,0x32,0x46,0xdc,0xc0,0x5b,0x2a,0x91,0xdd,0x35,0x9a,0xa6,0x71,0xd0,0x6c,0xef,0xed,0x37,0x77,0xcd,0xde,0x8e,0x9c,0x17,0xa7,0xae,0x99,0x55,0xa7,0x79,0x11,0x8f,0x54,0xc5,0xd4,0xcb,0x19,0xc2,0xfd,0xbd,0x45,0xaf,0x2a,0x30,0xd7,0xc5,0x02,0x56,0x1c,0x7e,0x83,0xeb,0x06,0xee,0x61,0x46,0x1b,0x5d,0x38,0x6e,0xe2,0x71,0x9b,0x96,0x70,0x8d,0x4d,0x17,0x71,0x7d,0x99,0x16,0x0d,0xc4,0xc4,0x88,0x8b,0xe5,0xdf,0x12,0x05,0x28,0xd9,0xc5,0x29,0x6e,0x27,0xca,0x4a,0xd4,0x6b,0x31,0xce,0xcf,0xd1,0xf4,0xf1,0xc4,0x5a,0xc3,0x0a,0x0b,0x7a,0x80,0x4c,0x98,0x79,0x6a,0x92,0x36,0xa3,0xe7,0xe3,0x02,0x7e,0x07,0xf0,0xe7,0x35,0x2c,0x05,0x3d,0x48,0xad,0x0c,0x3c,0xeb,0x34,0x0e,0x3b,0x76,0xcc,0x5e,0xaf,0x99,0xfe,0x4f,0x8f,0x1e,0x85,0x0c,0x45,0x95,0xc0,0x22,0xa4,0xe3,0xa9,0x58,0x6d,0x13,0xfe,0x68,0xf5,0x9c,0xf6,0x60,0x93,0xc8,0xa7,0xd2,0x22,0x75,0x77,0x97,0xa9,0x0f,0xfe,0x84,0x0c,0x83,0x09,0xd7,0x11,0xd0,0xc6,0xf2,0x1c,0x52,0x8b,0x37,0x2a,0x02,0x52,0x0d,0x41,0x4b,0x2c,0x0a,0x44,0x65,0xfd,0x88,0x0c,0xba,0x55,0x2c,0x13,0x36,0x08,0x2d,0x14,0x87,0xe3,0xaf,0xde,0x32,0xaa,0x74,0xf4,0xd9,0x20,0x22,0xa4,0xff,0xd2,0x33,0x1c,0x01,0x03,0x12,0x29,0x38,0x15,0x06,0x3c,0xea,0xc3,0x12,0xb9,0x53,0xb2,0x45,0x23,0x55,0x04,0x91,0x8e,0xd4,0x42,0x7c,0x46,0x31,0x56,0x8c,0x8d,0x94,0x70,0xdd,0xf6,0x9b,0xcf,0xe7,0xe8,0x2f,0xcd,0x96,0xab,0x65,0x34,0x49,0xe5,0x2a,0xe9,0x42,0xaa,0x7f,0x75,0xbb,0x8d,0x1d,
+0x1e,0x8a,0x06,0x14,0x31,0x52,0x74,0xa4,0x10,0x5c,0x3a,0xb8,0x2a,0x8d,0xd1,0xd7,0xb7,0x73,0x36,0x1e,0x85,0x4d,0x5d,0x6c,0x04,0xbc,0x50,0x5b,0x7d,0x5c,0x8b,0x2b,0x84,0xa8,0x49,0xdc,0x14,0xbd,0xb8,0x2b,0xe0,0xd7,0x85,0x3f,0xb5,0xf9,0x09,0x7c,0x14,0xb5,0xc6,0x5c,0xc3,0x47,0x51,0xf6,0x3f,0x77,0x50,0x32,0xee,0x45,0xef,0x84,0x99,0x4b,0xbd,0x93,0x61,0x18,0x6f,0xeb,0x9a,0x44,0x92,0xbd,0xa5,0xdd,0x16,0x56,0x5b,0xe1,0x9a,0x94,0x96,0xab,0x40,0x40,0x6e,0x12,0x91,0x17,0x57,0xe2,0xbe,0x99,0xf7,0xd5,0x90,0xf7,0xed,0xad,0x6b,0x46,0xfa,0x77,0x18,0xb8,0x02,0xf1,0xa2,0x51,0x2b,0x82,0x94,0x18,0x32,0x95,0x04,0xb2,0xe1,0xf1,0x5a,0x07,0xa5,0xe3,0xe0,0x0b,0xcc,0xfe,0x81,0xe6,0xf3,0x2d,0x9c,0x95,0x3c,0xc6,0x50,0xb2,0x50,0xf4,0x68,0x25,0x37,0x55,0x6d,0xbc,0xfe,0x23,0xc3,0x01,0xfc,0xc9,0x4f,0x3a,0xbf,0x2b,0x73,0x18,0xa2,0x89,0x9f,0xb7,0x48,0xa4,0xd3,0xcf,0xfc,0x4b,0x61,0x91,0xa5,0xeb,0xba,0xaf,0xe1,0x27,0x9c,0x09,0x67,0x1f,0x2c,0xeb,0xcc,0xa3,0xba,0xbd,0x66,0xfa,0xbf,0x7a,0x15,0x22,0x93,0x41,0x34,0xb5,0x46,0x87,0x38,0x65,0x9e,0xca,0xdd,0x87,0x3f,0x6f,0xeb,0xac,0x24,0xf2,0xa9,0x2d,0x79,0x49,0x77,0x2b,0xfc,0x55,0x56,0x79,0x85,0xbf,0x4a,0xd7,0x3e,0x99,0x2f,0xcb,0x2a,0x1a,0x52,0x25,0x31,0x0f,0xe0,0x8f,0x12,0x57,0x59,0x51,0x22,0x49,0xe5,0x09,0x95,0x5c,0xe4,0x3a,0x26,0x17,0x4b,0x91,0xfe,0x2b,0x36,0xb9,0x19,0x83,0x5a,0xf6,0x8e,0x3d,0xde,0x2c,0x97,0x5e,0x6e,0xe9,0x8a,0x20,0x25,0x6b,0x41,0x2a,0x09,0x14,0x63,0xe6,0xd5,0xf3,0x2b,0xc4,0x28,0xfd,0x57,0xb3,0x2d,0x6b,0x9a,0xd5,0xb4,0xa2,0x55,0x75,0xe4,0xb5,0xee,0x8b,0x1d,0x3f,0x8a,0xc6,0xd4,0x73,0x62,0x6a,0x70,0x59,0x37,0x57,0x1e,0xc4,0xaf,0x6f,0xf0,0x6c,0xb4,0x0a,0x1b,0xbc,0xd8,0x0e,0x68,0x9b,0x49,0xf5,0x41,0x2f,0xad,0x12,0xa4,0x27,0xf1,0x65,0xd4,0xee,0x14,0x81,0x95,0x42,0x91,0xf5,0x2b,0x18,0x0a,0x9c,0x59,0xbe,0x49,0xa6,0x86,0x2f,0xeb,0x75,0x9b,0xf8,0x3f,0x66,0xbe,0x25,0x65,0x5f,0xf4,0x63,0x88,0xbb,0xd4,0x8d,0x61,0xab,0xfc,0xc6,0x73,0x2e,0xa1,0x74,0x6f,0x69,0xdc,0x45,0x35,0x57,0x4d,0xba,0x4a,0x2c,0x1a,0x4f,0x42,0x1e,0xe8,0x20,0xa7,0xaf,0x42,0x7d,0x4b,0x5f,0x5d,0x2e,0xf0,0xef,0xb2,0xba,0x29,0xfd,0xdf,0x61,0xf1,0x78,0xda,0x45,0x23,0x57,0x80,0x28,0xb1,0x6b,0x2a,0xfe,0xf2,0x91,0xf2,0x5a,0xef,0xa5,0x13,0x09,0xf0,0xbc,0xfe,0x71,0xb6,0xf4,0x4d,0xa6,0x5e,0x25,0xa1,0x88,0x8a,0x8f,0xbc,0x57,0xab,0x4d,0xbf,0x2a,0x8e,0xdc,0x7f,0x7c,0xa4,0x90,0x6e,0x64,0x14,0xad,0x65,0x91,0x2f,0xa5,0x95,0x56,0xee,0x08,0x3d,0x89,0xef,0x62,0x37,0x3f,0x8a,0x78,0xda,0x5d,0x6b,0xef,0x15,0x3c,0x05,0xee,0x8b,0xd9,0x89,0x59,0xc3,0x83,0x89,0xbf,0x08,0xcb,0x45,0x28,0xba,0xb0,0x54,0x02,0xc5,0xb2,0xe1,0x6c,0xff,0xc0,0xfe,0xad,0x2b,0x87,0x44,0x06,0xf5,0xda,0x61,0x49,0x8f,0x2b,0xbc,0x18,0x55,0x7f,0xcd,0xd5,0x43,0x66,0x1f,0x93,0x84,0x44,0x85,0xf5,0x43,0x01,0xf6,0xdb,0xaf,0x20,0xaa,0x64,0x7e,0xfb,0x35,0x44,0x8a,0x78,0xad,0x55,0x44,0x92,0xde,0x4a,0x43,0x76,0xb9,0xd5,0x13,0x01,0xc9,0x07,0x6f,0x51,0x7d,0x38,0x29,0xe4,0xa3,0xe6,0xd5,0x6b,0x89,0x88,0x4f,0xfa,0xaf,0x76,0x83,0xd6,0x5c,0x4d,0x2c,0x6c,0x22,0xd1,0x56,0x93,0xdf,0xb7,0x9e,0x58,0xc2,0x44,0xd9,0xb7,0xb5,0xd7,0x14,0xab,0x56,0xf5,0x77,0xaf,0x2a,0xa2,0x7d,0xf3,0x82,0x48,0x0b,0x6d,0xa1,0xaf,0xea,0x57,0x20,0x31,0x89,0x23,0xa3,0xf6,0xda,0x0b,0x26,0x25,0x7b,0x7d,0xdb,0xb1,0xea,0x72,0x13,0xb8,0xb0,0x7c,0xbf,0x7f,0x9d,0x19,0x98,0xd1,0x6c,0xb7,0x7b,0x4d,0xd3,0x54,0x7e,0xf3,0x4a,0xb9,0x17,0xbd,0x17,0x62,0x2e,0x9f,0x80,0x75,0xfa,0x7d,0xa7,0xfd,0x5b,0x5d,0x17,0x14,0x40,0x3d,0xfb,0x2a,0xe9,0x5d,0x85,0xdf,0x4a,0xab,0xad,0xe7,0xb4,0xc8,0x49,0x0c,0x05,0x7e,0x05,0x8f,0xc5,0xa3,0xbe,0xb9,0xbb,0x92,0x4b,0xfb,0xf6,0xbe,0x2a,0xa5,0x5c,0x6b,0xc6,0x85,0xbb,0xaf,0x54,0x6a,0xb9,0x25,0x2b,0x40,0x48,0x67,0x5c,0x02,0x4d,0xe1,0xf8,0x4b,0xc6,0xc5,0xab,0xa7,0x5b,0x88,0x49,0xfa,0xaf,0x5e,0x23,0xd6,0x9c,0x6e,0xa5,0x75,0xac,0xa8,0x14,0xbf,0xcf,0x33,0xa9,0x38,0xc8,0x3b,0xb3,0xae,0x4f,0xaa,0x56,0xc3,0xdf,0xed,0x90,0xd2,0x13,0x57,0x22,0xcb,0x09,0x0f,0x5f,0x55,0xf5,0x12,0x84,0x9e,0xc4,0x2d,0xb1,0xa7,0xb4,0x04,0x3c,0x4d,0xbb,0xdf,0x9b,0xbd,0x82,0xa7,0xc0,0x39,0x31,0x47,0xc6,0x6a,0xf8,0xa7,0x4e,0x0f,0x4d,0xb0,0x0e,0xfa,0x2a,0xf7,0x44,0x89,0x50,0xf4,0x50,0xa9,0x04,0x72,0x27,0x65,0xcc,0xec,0x5e,0xff,0xb7,0x3a,0x29,0x22,0x83,0xd2,0x88,0x97,0xf5,0xb8,0xc2,0x4f,0x51,0xf5,0xd7,0x73,0x55,0xe4,0x68,0x9f,0x9a,0x44,0x05,0x6f,0x25,0xc0,0x7e,0x73,0x87,0xa5,0x94,0xf9,0xed,0x7d,0x16,0x45,0xbc,0x8e,0xbd,0x23,0xbd,0xa9,0x23,0xbb,0xdc,0xd8,0x89,0x80,0xa4,0x83,0x57,0xa0,0x3e,0x9c,0x14,0xf2,0x51,0xf3,0x5a,0xff,0x85,0xf9,0xa4,0xff,0x6a,0x37,0x68,0x3d,0xf3,0x9a,0xd5,0xb4,0xba,0x9a,0xfc,0x3e,0x2f,0x56,0xc2,0x44,0xd9,0xb7,0x75,0x7d,0x59,0xe5,0xaa,0xfe,0xf6,0x4d,0x9c,0xe4,0x80,0xaf,0x48,0x6a,0x78,0xd6,0xb7,0xcc,0xb5,0x90,0x15,0x35,0xf8,0xb3,0xbb,0xb7,0x23,0xa0,0x2c,0xdb,0x0b,0xcf,0x1c,0x0f,0x16,0x72,0x9f,0x75,0xad,0x37,0xe1,0x2e,0xda,0x16,0x4f,0x9f,0x5a,0xae,0xbb,0x31,0xde,0x6c,0x37,0xf7,0xf7,0x68,0x1f,0xa7,0x25,0x8d,0x60,0x83,0x3c,0x11,0x46,0xbe,0x45,0x7e,0xee,0xec,0x77,0x9c,0x37,0xf5,0x76,0xa5,0xa2,0x96,0xf8,0x02,0xb5,0x6a,0xa8,0xb6,0xcb,0xe7,0x2d,0x21,0xf7,0x7b,0xac,0x74,0x87,0xec,0xe1,0x73,0x35,0x31,0x99,0x42,0x69,0xf5,0x8d,0x8e,0x23,0xe4,0x64,0xab,
+0xbe,0x9f,0x5e,0x51,0x89,0x1a,0x76,0x9c,0x15,0x87,0x7b,0x94,0x6c,0x14,0xcf,0x19,0xd6,0x33,0xa8,0xa8,0xf3,0x75,0xea,0xa3,0xd8,0xa3,0x2d,0x00,0x52,0x98,0x82,0x82,0xb6,0xb1,0x52,0x68,0x75,0xee,0xeb,0x77,0xdf,0x43,0x8e,0xe9,0xbf,0xda,0x4d,0x5b,0xd7,0x80,0x93,0x3a,0x57,0x57,0xa2,0x57,0x3a,0x4c,0xe1,0xd8,0xab,0x34,0x7a,0xb4,0x7b,0xbe,0x8a,0x13,0x7d,0x85,0x49,0x78,0x75,0x6f,0x14,0x86,0xbc,0xa8,0x53,0xe4,0x4d,0x44,0x72,0x5c,0x88,0x14,0x1b,0xdd,0x15,0x51,0x71,0xf2,0x86,0xc9,0x49,0xf7,0x92,0x50,0x79,0x31,0x44,0x1c,0xcd,0x59,0xaf,0x5f,0x9f,0xa3,0x70,0x33,0x49,0x9e,0xa1,0xa3,0xa6,0x27,0xed,0xf5,0x4b,0x26,0x8b,0xb9,0x00,0xa2,0xed,0x24,0x88,0xbf,0xc2,0x79,0xb6,0xe7,0xdd,0xd9,0x6f,0x9d,0x2a,0x62,0x11,0x4a,0x3c,0xa6,0xba,0xab,0x95,0xfb,0x49,0xd2,0xca,0xeb,0x4d,0x14,0x49,0x12,0x15,0x25,0x85,0x0a,0xf3,0xc4,0x22,0xf2,0x9b,0x4f,0x13,0x55,0x12,0xbf,0xfd,0x2c,0x31,0xa7,0x5d,0xcf,0xfb,0xa1,0x8e,0xd4,0x90,0x5c,0xb5,0xf3,0xa0,0x00,0x23,0x1f,0xb0,0x45,0xbd,0x29,0xc8,0x30,0x57,0x0b,0x50,0xbf,0x19,0x21,0x9b,0xf4,0x5f,0xdd,0xc6,0xac,0xeb,0xef,0x48,0x3d,0x2b,0x2b,0xc8,0xef,0x9b,0x1f,0xaa,0x79,0xa8,0xba,0xb5,0xee,0xec,0xb0,0x6a,0x3d,0x7f,0xfb,0x5a,0x27,0xca,0x89,0xc0,0x66,0x0d,0x31,0xd7,0x74,0x46,0x90,0xdd,0x3d,0x92,0x85,0x25,0xc3,0xc1,0xf9,0x15,0x04,0xa9,0xf1,0xe8,0xfd,0x9d,0x30,0x35,0x43,0x31,0x3b,0x62,0x31,0x25,0x44,0x85,0xdc,0x18,0x7c,0x8d,0x42,0x78,0x39,0x59,0xf2,0x38,0xd8,0x65,0x76,0xc7,0xc0,0x4c,0x6f,0x28,0xad,0x03,0x73,0x6d,0xc4,0x21,0x75,0xe9,0x0e,0x2d,0x26,0x1e,0x34,0xcf,0x85,0x06,0xcd,0xc7,0xc2,0x21,0xc9,0xbe,0xd1,0x72,0x7f,0xb9,0xab,0x24,0x2e,0x6e,0x69,0x67,0xc6,0x9d,0xb5,0xf2,0x97,0xf8,0x8c,0x7e,0x7e,0xc1,0x5e,0x63,0xb7,0x17,0x37,0xfc,0xd5,0xdc,0x5f,0xf9,0x89,0xdb,0x80,0xdd,0x6a,0x65,0x59,0x5c,0xcc,0x2c,0x8b,0x0b,0x7b,0x07,0x54,0xd6,0x17,0x07,0x46,0x77,0xbf,0x8f,0xd2,0xb8,0xe0,0xd7,0x70,0xdf,0xac,0xbc,0xff,0x61,0x0a,0x24,0x91,0xcf,0x27,0x69,0xaa,0xdf,0x49,0x6e,0x95,0x82,0x19,0x43,0x0a,0x89,0x53,0x48,0x8b,0xd1,0x65,0x59,0xfa,0xe8,0x3c,0x7f,0x44,0xcf,0xf8,0x53,0xa3,0xd5,0x78,0xdf,0x76,0x97,0x8d,0x8f,0x0d,0x73,0x67,0xe7,0x30,0x4b,0xcc,0x52,0x28,0x29,0x90,0x91,0x2c,0x49,0x25,0x56,0xe2,0xdb,0xba,0x5b,0xc7,0xd9,0xbc,0x29,0x7b,0x16,0xfc,0x29,0x68,0x8a,0xa8,0x0b,0x09,0x43,0xfa,0xb6,0x36,0x7c,0x21,0x56,0xbc,0x99,0x2d,0xfd,0xe4,0xef,0x69,0xba,0x1e,0x26,0xc7,0x0d,0x9f,0xe1,0x66,0xb7,0x4b,0x25,0x5b,0x81,0x35,0xdf,0xed,0xa0,0x54,0x1f,0x69,0x8b,0xeb,0xa5,0x2d,0x4a,0xc1,0x1b,0x81,0xff,0x21,0xf0,0x53,0x18,0x44,0xce,0xa4,0xc9,0x35,0xf2,0x8b,0x12,0x0b,0x94,0x9b,0x19,0x90,0x13,0x28,0x0a,0x43,0x55,0xe1,0x5a,0x55,0x16,0xa9,0x78,0xa2,0xac,0x55,0x8a,0xf2,0x4d,0x50,0xda,0x14,0x74,0x3d,0x17,0xed,0x1c,0x75,0x61,0x52,0xbf,0x77,0xa8,0xdf,0xbb,0xd4,0xef,0x3d,0xea,0xf7,0xbe,0xe2,0xa6,0xb1,0xe2,0xe5,0x72,0x6d,0xb3,0x47,0xf3,0xa5,0x13,0xf5,0xe6,0x49,0x57,0xd2,0xde,0xee,0xb1,0x42,0xca,0x33,0xb7,0xc0,0xbe,0x63,0x6b,0x64,0x32,0xc6,0x90,0xce,0xe8,0x92,0x11,0xdf,0x6b,0x77,0x59,0x94,0x12,0xfa,0xbb,0xed,0xae,0xb9,0xcf,0x60,0x74,0x58,0x8b,0x5b,0xe4,0xd1,0xef,0xf7,0xfb,0x2c,0x46,0x19,0x8f,0x4e,0xa7,0xd3,0x61,0x30,0xba,0x9c,0xe1,0x2f,0x32,0x61,0x65,0x62,0xd3,0xe0,0xb6,0x85,0x08,0xfb,0xfb,0x2c,0x0e,0x93,0x59,0xb5,0x00,0xdf,0x16,0x0f,0x89,0x52,0x8b,0x81,0x8c,0x56,0xaf,0x60,0x70,0xe9,0x7c,0x63,0xf8,0xaa,0x36,0x9a,0x7e,0xc8,0x5c,0xf7,0xe9,0xb8,0xb6,0xbf,0xb4,0x82,0x46,0xb8,0x49,0xe0,0x15,0x91,0x87,0x74,0x3a,0x1d,0x4a,0x5f,0x0a,0xdd,0xcf,0x5e,0x1a,0xea,0xf8,0xb1,0x5d,0x83,0x04,0x4b,0xa5,0x05,0x8d,0xd5,0xc0,0xf6,0x23,0x3b,0x70,0x69,0x24,0x56,0x7c,0x84,0x25,0x42,0x8c,0xff,0xd8,0x58,0x91,0x9b,0x03,0x3a,0x6c,0x6e,0x20,0x93,0x26,0x82,0x2f,0xc2,0x2c,0x66,0x46,0xe5,0x21,0x1a,0xf0,0x2a,0x42,0xe1,0x95,0x37,0x3c,0xe0,0xdc,0xf7,0x6c,0x6b,0x8d,0x6e,0xd0,0xa4,0x2f,0x11,0x4c,0xac,0xc0,0xb7,0x5f,0x68,0x9b,0x53,0x7e,0x67,0x9f,0xea,0xea,0xbd,0xb4,0x3b,0xcb,0xef,0x08,0xcc,0x78,0xc6,0x9b,0x59,0x93,0x7a,0xa0,0x93,0xd8,0xee,0xc1,0xd8,0x81,0xb1,0x78,0xf4,0x55,0x7e,0x6c,0x09,0xbc,0xd3,0x8f,0x7f,0xb3,0x78,0x2e,0xa4,0x6e,0xe3,0x9c,0x3e,0x26,0x47,0x12,0xc7,0xe5,0x57,0x48,0xa2,0xcb,0x23,0x91,0xc9,0x10,0xdc,0x06,0x58,0xe4,0xc2,0x9a,0x3f,0xfe,0xa2,0x56,0x1e,0x3e,0x2a,0xd9,0x09,0x5d,0x64,0xe0,0x5a,0x8e,0xb0,0x7a,0xe8,0x7d,0x5a,0x49,0xaa,0x2e,0x30,0x9e,0xe4,0xb6,0x53,0x73,0xa8,0xf0,0x8a,0x55,0x11,0x49,0xfc,0x9e,0x23,0x09,0x43,0xa6,0xfc,0x76,0x46,0x19,0x49,0x78,0xe9,0x28,0xac,0x5c,0xee,0x71,0x44,0x0c,0x44,0x50,0x19,0x3b,0x6c,0x6e,0xd2,0x8a,0x64,0x1c,0xf2,0xb0,0xb9,0x18,0x24,0x53,0x20,0xf2,0x28,0x99,0x02,0x92,0x85,0xc9,0xf8,0xf2,0xd8,0xdd,0xec,0xda,0xd8,0x7f,0xe7,0x0c,0xfc,0xef,0xce,0x19,0x58,0x3b,0x87,0x9f,0xfe,0xea,0x53,0x7b,0x87,0xbb,0xbb,0x95,0x99,0xb4,0x20,0x95,0xa0,0x17,0xc8,0xb2,0x17,0xd9,0x92,0x1d,0x7a,0x33,0x60,0xca,0xd3,0x39,0x6c,0xaa,0x49,0x34,0x01,0xfa,0x5d,0x46,0x23,0x7d,0x39,0xe0,0xa1,0x8a,0xe9,0xfd,0x70,0xcc,0x9c,0x4d,0xe5,0x72,0xd0,0x92,0x8c,0x7f,0x99,0xe0,0xd9,0xea,0x26,0x16,0x15,0x3d,0xb2,0x62,0x65,0x10,0x99,0x14,0xf2,0x24,0x73,0xff,0xcf,0x34,0x91,0x68,0xe3,0xb1,0x5e,0x6b,0x55,0x3b,0x2e,0x2b,0x99,0xe1,0xe3,0x39,0x50,0x81,0xe1,0x60,0x80,0x8c,0xc8,0x3a,0xb0,0x6c,0x77,0x11,0x06,0x0e,0xdd,
+0xd4,0x2a,0xa8,0x67,0x6a,0xf1,0x3b,0x3f,0x19,0xd8,0xd9,0x11,0x31,0x20,0x06,0x09,0x15,0x68,0x70,0x92,0x81,0xeb,0xb3,0xd4,0xaa,0x52,0xfd,0x1a,0xc1,0xf4,0x9e,0x7a,0x95,0x11,0x42,0x96,0x31,0xc2,0xd3,0x4d,0xd7,0x8a,0xec,0x05,0xad,0x0f,0xf4,0xeb,0x67,0xf1,0x72,0x00,0xa5,0xeb,0x28,0xb4,0x61,0x35,0x95,0xe4,0xbb,0xe3,0x97,0x84,0x28,0x24,0x94,0x46,0x82,0x45,0x22,0xd9,0x87,0x04,0x29,0x38,0x28,0x3c,0x74,0x6c,0x97,0xc5,0x23,0x49,0x21,0x04,0x0a,0x4a,0xe1,0xc1,0x43,0x53,0x2c,0x1a,0x3e,0x7d,0x2b,0x38,0x74,0x46,0x61,0x91,0x8d,0xe9,0x2c,0x62,0x76,0xfa,0x49,0x3e,0xca,0xd2,0x0d,0x84,0x2c,0x22,0xde,0x67,0x2e,0xd8,0x77,0x49,0x61,0x91,0xad,0x1a,0x2c,0x62,0xb6,0x1f,0x50,0xb0,0xe1,0x85,0xee,0x08,0xfc,0x5d,0x8a,0xeb,0x8a,0x74,0xf3,0x85,0xe0,0xdb,0x1f,0xd3,0x3e,0x70,0x11,0x90,0x6f,0x21,0xfc,0x51,0x49,0xb0,0x8a,0x4a,0x4b,0x0c,0x23,0x11,0x4e,0x5e,0xed,0x35,0xbd,0x8c,0x4a,0x9a,0x32,0x95,0x26,0x23,0x0f,0x60,0x72,0x75,0xc0,0x09,0x58,0x19,0x75,0x50,0x45,0x34,0xcc,0xfa,0x1c,0x67,0x5d,0x0b,0xcb,0x76,0x78,0x89,0x4a,0xe8,0x02,0x71,0x1c,0xc2,0x77,0xaf,0xe0,0x22,0x58,0x82,0x0e,0x27,0x06,0x2f,0x79,0x34,0xc5,0x72,0xe0,0x7c,0x2e,0x93,0x7d,0xfc,0x4f,0x79,0x10,0x8e,0x22,0x8a,0xc3,0xc8,0x45,0xb5,0x4a,0x03,0x84,0x9c,0x28,0x9a,0x47,0xff,0x2d,0x0a,0xb7,0xf1,0xdf,0xe1,0x0c,0xfa,0x21,0x0d,0x71,0xfa,0x30,0xab,0x38,0x22,0x9a,0xc6,0x3c,0xa6,0x01,0xc7,0x6f,0x36,0xda,0x11,0x4a,0x9a,0x95,0x16,0x26,0x01,0x87,0x21,0x3a,0xb9,0xa8,0xbd,0xb9,0x8b,0x6e,0x67,0x7f,0xe6,0xf2,0x00,0x8b,0xa6,0x58,0x5c,0x5c,0x65,0xf6,0x8a,0x61,0x4d,0x4e,0xb7,0x41,0xe2,0x4b,0x44,0x1d,0x3f,0x70,0x3c,0x72,0xd8,0xd4,0x2d,0x23,0x58,0x36,0x1d,0x7f,0x16,0x7a,0x13,0x50,0xda,0xbb,0x21,0x70,0x3a,0x10,0x60,0x16,0xe8,0x44,0x61,0x01,0xc2,0xf8,0x40,0x6a,0xcc,0x64,0xc0,0x45,0x33,0x5a,0x9c,0x50,0x59,0x38,0xbd,0xe4,0xbb,0x50,0x27,0xa0,0x4b,0x09,0xa2,0x7e,0x43,0xea,0xbe,0x09,0x12,0x7f,0x1d,0xb8,0x3b,0xcf,0x4c,0x28,0x2b,0x87,0x1b,0x30,0x9f,0x5a,0xe8,0x49,0x1d,0x7b,0xaa,0x2a,0xbd,0x6a,0x2f,0x5f,0xa2,0x1d,0x18,0xc2,0x9b,0x03,0x99,0x35,0x59,0x34,0x6d,0x15,0xac,0x5b,0x0a,0x16,0x63,0x51,0x2c,0x3f,0x0f,0xa3,0xe5,0x20,0x0a,0x13,0x2b,0x71,0xdf,0xb7,0xba,0x3d,0xc7,0xf5,0x76,0x88,0xf2,0xd3,0xeb,0x40,0x90,0x39,0x49,0xe8,0x4b,0xae,0x00,0x4c,0x97,0x64,0x60,0x49,0xcf,0xf8,0xd3,0xe1,0x53,0xcb,0x5f,0x39,0xee,0xc3,0xa0,0x9b,0x56,0xbc,0x41,0x1a,0xfe,0xdf,0x53,0x90,0x7f,0xda,0x29,0x88,0xc4,0x7c,0x60,0x7d,0xe3,0x57,0xda,0x98,0x91,0x44,0x45,0xfb,0x8c,0x36,0xd0,0x31,0x72,0xa1,0x20,0x0b,0x94,0x99,0x92,0x81,0x10,0xbe,0x38,0xab,0x60,0x8a,0x4b,0x66,0x12,0x05,0xd6,0xd9,0x7c,0x81,0x65,0xa2,0x9a,0x34,0xfc,0xd6,0x7a,0x89,0x83,0x14,0x59,0x15,0xdf,0x34,0xfc,0x97,0x30,0xa9,0x12,0xe0,0xcb,0x49,0x54,0x8f,0xdc,0x65,0xb4,0x5e,0x2f,0x4d,0xc5,0xd0,0xfb,0x9f,0x47,0x33,0x06,0xa8,0x6a,0xee,0xc3,0xda,0x5a,0x39,0xcc,0x05,0x24,0xf2,0xb6,0x10,0x55,0x27,0x0d,0xc6,0x59,0xda,0x28,0x5c,0x49,0x7d,0xd9,0xdf,0x77,0x9e,0x59,0x0b,0x66,0xd2,0x3e,0x37,0x65,0x93,0x41,0x33,0xd1,0x4a,0x16,0x21,0x19,0x52,0xf8,0x46,0x88,0x97,0x7a,0x99,0x05,0xcd,0x36,0xe5,0x5b,0x91,0xd8,0x03,0xd1,0xd6,0x85,0x2c,0xc6,0xc8,0x1b,0x1b,0xcd,0x6e,0x52,0xaf,0x24,0x98,0xe4,0xe4,0x90,0x68,0x4a,0x23,0x86,0x4c,0x67,0x36,0x39,0x30,0x9a,0xc7,0x48,0xc8,0x32,0x2d,0x98,0xce,0x5e,0xc4,0xb0,0x45,0x79,0xc9,0x84,0x45,0x22,0x07,0xd3,0xf1,0xe9,0x34,0x45,0x42,0x9a,0xcc,0x56,0x72,0x58,0x32,0x33,0x11,0x83,0xa7,0x13,0x14,0xaa,0xe5,0xf0,0x64,0x44,0xd6,0x76,0x78,0x4e,0x42,0x57,0x12,0x4e,0x40,0x64,0xd0,0x78,0x1e,0x42,0xc9,0xa2,0x3d,0xeb,0xc8,0x71,0xe4,0x53,0x0c,0xaa,0x5f,0x24,0x13,0x0a,0x4a,0x4e,0xa2,0xfe,0x62,0x05,0x62,0xed,0x21,0x3b,0xd5,0xa0,0x27,0x17,0x82,0xf2,0xb4,0xea,0x62,0xb0,0xf4,0xc3,0xff,0xbf,0xf2,0x97,0x7f,0x2a,0x6c,0x94,0xdf,0x22,0x4d,0xa6,0x46,0xe8,0xe3,0x13,0xf9,0x35,0x8b,0x48,0x69,0x73,0x45,0x35,0x5a,0xa6,0x30,0xa4,0xf1,0x54,0x4a,0x42,0xa1,0x60,0x7d,0x29,0xe0,0x88,0xb4,0x26,0x47,0x42,0x0a,0x24,0xc0,0xc1,0x28,0x81,0x35,0x73,0x03,0xee,0x93,0x89,0x34,0x40,0x82,0x51,0x26,0xfd,0x39,0x79,0x0f,0xa6,0x6b,0x47,0x14,0xca,0x3e,0x6f,0x63,0x7b,0x8a,0x40,0x55,0xdf,0x0f,0x32,0x00,0xf9,0xc8,0xc8,0x40,0x64,0x03,0x63,0xe1,0x06,0xeb,0x67,0x59,0x15,0x30,0xa3,0x43,0x76,0x8b,0x41,0x86,0x96,0x2f,0x1e,0xd1,0x06,0x35,0x2d,0x11,0x5d,0x24,0x98,0x15,0x8a,0xae,0x03,0xcc,0x0a,0x05,0x37,0xfa,0x65,0x65,0xe2,0x6b,0xf9,0xb2,0x62,0xc1,0xad,0x7a,0x59,0x99,0xf8,0x6a,0xbc,0xbc,0x26,0xc2,0x9b,0xed,0x28,0xa1,0x04,0x17,0xd3,0xed,0xce,0x7d,0x57,0x71,0xe3,0x4b,0xda,0x9b,0xa4,0xbb,0x10,0x30,0xba,0xb2,0xce,0x72,0x9c,0x70,0x15,0xb3,0x5b,0x8e,0xe4,0x33,0x90,0x22,0x66,0x03,0x7d,0x15,0x8a,0x42,0xb9,0x22,0xe1,0xb1,0xd6,0x6a,0xc3,0xc5,0x03,0x39,0x36,0xf5,0x21,0xbf,0x91,0xee,0x6d,0xd1,0x05,0x27,0x8b,0x02,0x9a,0xd0,0xec,0xec,0x90,0xfd,0x64,0x06,0xa7,0x49,0xec,0x64,0x2e,0xb3,0x51,0x5c,0x91,0xaa,0x2e,0xd4,0x47,0x39,0x8d,0xaa,0xd0,0xd0,0xa5,0x35,0xa1,0x81,0x55,0x15,0xc1,0x46,0x57,0x5c,0x13,0xbe,0x4c,0x51,0x15,0x0d,0xf9,0xcb,0x85,0x96,0x48,0x4a,0x04,0x30,0x34,0xd8,0x33,0x33,0xa4,0x52,0xe8,0x74,0xe1,0xa7,0x4c,0x64,0x5d,0xaa,0xcc,0x47,0x1e,0xdd,0x5a,0xea,0x12,0x17,0x45,0xf5,0xe9,0x52,0x86,0xa9,0xd9,0x34,0x69,0xb8,0xae,0x05,0x9c,0x85,0xfc,0xe5,0xed,0xa8,0x4d,
+0x37,0xfd,0x12,0xa5,0xd3,0xe2,0x1a,0x44,0x8b,0x5f,0xbf,0x4a,0x7b,0x47,0x97,0xaa,0x86,0xa4,0xd2,0xd9,0x53,0x15,0x1c,0x1d,0xc9,0xc5,0x73,0x2e,0x6d,0x04,0x3c,0x1d,0x4b,0x75,0xa5,0x53,0x49,0x57,0x34,0xb4,0xb9,0xa0,0x31,0xda,0x38,0x83,0x8a,0x3c,0x70,0x4d,0xaa,0x8c,0x5a,0x6d,0x06,0xbc,0x26,0xe9,0xa2,0x0c,0xaa,0x71,0xd0,0xae,0x81,0x44,0xb7,0xea,0x60,0xea,0xd7,0x48,0xa4,0x67,0x95,0xd1,0xa8,0x1a,0x3e,0x53,0x4b,0xad,0x52,0x7c,0x28,0x22,0x5e,0x01,0x70,0x9d,0x67,0x14,0x40,0x78,0x51,0xb8,0x1d,0xb4,0x8b,0x28,0xd4,0xaf,0xf9,0x65,0xd6,0xe2,0x1b,0x03,0xd5,0xc8,0xf8,0xc6,0x6a,0x61,0xf0,0xe2,0xae,0x1c,0x35,0x6e,0x3e,0x75,0x4a,0x2b,0x40,0x0b,0x7d,0x88,0x23,0xa0,0x45,0x04,0x2f,0x0b,0xcb,0x1c,0x96,0x1f,0xc3,0xe2,0xcd,0xda,0x75,0xaa,0x86,0x4f,0x39,0xe6,0x5f,0x59,0x76,0x72,0x16,0x7f,0x2d,0x8d,0xb3,0x48,0x88,0x67,0x70,0x97,0xf8,0x31,0x11,0x9f,0x80,0x9e,0xac,0xa3,0x98,0x3a,0xb7,0x8b,0x04,0xa8,0x5f,0x75,0xbb,0x4d,0x8c,0x5c,0xd2,0x6d,0x15,0xee,0x30,0xce,0xb8,0x2c,0xc2,0xc8,0x7f,0x0a,0x57,0x89,0x15,0x30,0x3d,0xf3,0x42,0x04,0x69,0xa1,0xa9,0x48,0x83,0x4c,0xa1,0xf2,0x39,0x46,0x7a,0x7b,0xa3,0xd6,0x25,0xcc,0x14,0xa5,0xc2,0x94,0xa9,0xfc,0xa6,0x77,0x81,0xe0,0x84,0x16,0xaa,0xf8,0xcc,0x8a,0xfd,0x78,0x60,0x1c,0x4a,0x75,0x90,0xed,0x64,0x3c,0x83,0x3a,0xe4,0x2f,0x6b,0x67,0xaa,0x2b,0x9f,0xbd,0x71,0xfb,0xc0,0xf1,0x9d,0x8f,0x1c,0x26,0xde,0x6d,0xf8,0xac,0x01,0x29,0x9b,0x00,0xea,0x70,0x11,0xcf,0x0c,0x45,0x98,0x29,0x2a,0xda,0x07,0x87,0x7f,0x27,0xff,0xf0,0xc3,0xa1,0x7a,0x3f,0x40,0x9a,0xec,0x88,0x96,0xf4,0x49,0x4f,0x38,0x46,0x68,0x99,0x0a,0xc2,0x50,0x20,0x7f,0x25,0x20,0x52,0x1a,0x7f,0xa5,0xe6,0x74,0xa8,0x0f,0xac,0x28,0x0a,0xb7,0x3b,0x02,0x6b,0x5a,0x00,0x97,0xcf,0xc3,0x88,0x3d,0x78,0xc9,0xed,0x0e,0xbb,0x4a,0x50,0x5c,0x54,0x11,0xee,0xc3,0x84,0x86,0x03,0x9a,0x4f,0x78,0x65,0x27,0xbe,0xb8,0xf3,0x99,0xfd,0x90,0xc3,0x7e,0xd3,0xd2,0xfc,0x1e,0x88,0x56,0x6b,0xc8,0x66,0x49,0x8c,0x48,0xb9,0x1a,0x01,0xdb,0xdc,0xf7,0x7e,0x60,0x64,0x48,0x97,0xce,0x24,0x28,0xd9,0x50,0x20,0x58,0xe2,0xed,0x90,0x12,0x44,0xac,0xdf,0x05,0x4c,0x66,0x93,0xa4,0x04,0x15,0xa9,0xb7,0x00,0x53,0x8c,0x88,0xfb,0x3d,0x7d,0xc2,0xdd,0xb7,0x43,0xda,0x1a,0x7d,0xce,0x33,0xf4,0x71,0xd0,0x87,0x72,0xe6,0x5b,0xa0,0x49,0x9d,0xd0,0xa0,0x29,0x70,0xc8,0x84,0x1f,0xf9,0x14,0xac,0x03,0xce,0xb0,0x8a,0x98,0x0f,0xd2,0x3c,0x72,0x8c,0x44,0x61,0xfa,0xf1,0xff,0x90,0x1b,0x73,0x65,0xa0,0x74,0x34,0x22,0x87,0xa5,0x65,0xd1,0x84,0x2d,0x12,0x2e,0x53,0x26,0x46,0xfa,0x4c,0xa5,0xf4,0x2a,0xa0,0x01,0x4e,0xd7,0x41,0x1f,0x5c,0x48,0x5e,0x43,0xc1,0x0b,0x95,0xc1,0x6a,0xae,0x5f,0x9b,0x32,0x78,0xbe,0x3a,0x9a,0xf0,0x62,0x06,0x3a,0xe3,0xae,0x50,0x23,0x34,0xfa,0xf4,0x2b,0x54,0x02,0xce,0xd7,0x47,0x0f,0x5c,0x48,0x5e,0xc3,0x16,0x64,0x95,0x29,0x91,0xe6,0xbf,0xc3,0x0e,0x33,0x0d,0x5d,0xd6,0xb2,0xe9,0x1a,0x90,0x96,0x2d,0xa2,0x6b,0x8d,0xda,0xcc,0x9d,0x27,0x52,0xd3,0xc7,0x76,0x49,0x69,0x1f,0xf0,0x82,0x94,0x59,0x2a,0xaa,0x85,0xa1,0x28,0x38,0x68,0x2d,0x98,0xc5,0xff,0x4f,0xbe,0xae,0x28,0x0e,0x44,0xca,0x3e,0xad,0x88,0xda,0xa8,0xfc,0x63,0x8a,0x18,0xa7,0xec,0x6b,0x8a,0x18,0x4b,0xfd,0x39,0x05,0x0d,0x1d,0xc1,0xee,0x1f,0xd1,0xf6,0x1d,0xc9,0x75,0xf6,0xf9,0xc6,0x9c,0x88,0xbe,0xa1,0x3d,0x23,0xdf,0xd8,0x9d,0x5b,0xf4,0x31,0x3d,0xb4,0x22,0x2e,0xbe,0xe3,0x9d,0x22,0x90,0xa1,0x67,0x50,0x1c,0x9d,0x76,0x97,0xa6,0x43,0xc2,0xef,0x74,0xd8,0xe7,0x84,0x4c,0x86,0x10,0x06,0xe3,0x25,0xda,0xa7,0x29,0xe1,0x60,0x9c,0x10,0xea,0xe4,0x84,0x3a,0x0c,0x21,0x04,0xc5,0xd1,0xe9,0x9a,0x68,0xa3,0x20,0x3a,0x68,0xa4,0x4e,0x9f,0x89,0x3f,0x5b,0x89,0xce,0x96,0x32,0xfb,0x27,0xf3,0x93,0x49,0xbf,0xf7,0x44,0x52,0xca,0x27,0x8f,0xb6,0x73,0x8e,0xf9,0xbb,0x67,0xfa,0x50,0xd6,0x2a,0x84,0xa7,0xb1,0x52,0x69,0x73,0x59,0x4b,0x4f,0x33,0x95,0x9f,0x62,0xb2,0xe0,0x4f,0x0e,0x88,0xfa,0x1f,0x19,0x2d,0xf1,0x45,0xce,0xc5,0xe4,0xe7,0x22,0xcc,0x86,0xd5,0x14,0xbf,0x8f,0x93,0x28,0xcc,0xbe,0x39,0xd9,0x9b,0x08,0x1a,0x8a,0x23,0xf8,0x20,0xa1,0x43,0xf5,0x06,0x57,0xb0,0x78,0x96,0xa5,0x31,0x10,0x92,0xcd,0x8e,0x65,0x55,0x38,0x8e,0x95,0xc6,0x64,0xfc,0x31,0xac,0x0a,0xc7,0xaf,0x38,0x12,0x92,0x63,0x57,0x75,0x8e,0x5b,0x21,0x1c,0xf4,0xdd,0x11,0x95,0xd3,0x6d,0xc5,0xbe,0xe5,0x04,0x6c,0x67,0xa3,0x86,0x05,0x13,0x0b,0xa5,0x82,0x11,0x8b,0xc6,0xd2,0xc7,0xba,0xcc,0xd2,0x4b,0xdf,0x2d,0xf2,0x1d,0x2f,0x68,0x2f,0x20,0xfe,0x08,0x9c,0x81,0xc5,0x49,0xe4,0xaf,0x21,0xd7,0xb4,0x59,0xd2,0x19,0x6a,0xaa,0x03,0x3b,0x83,0x55,0xb2,0xc0,0xc2,0xbc,0x87,0xa1,0xc6,0x4e,0x99,0x7a,0xd7,0xa3,0x5a,0x7a,0x00,0x30,0xb1,0x3c,0x91,0x4d,0x2f,0xdb,0xae,0xc6,0xbb,0x5a,0x02,0xd4,0xb5,0xe0,0x4f,0xc9,0x86,0x4e,0xb2,0xa4,0x92,0xda,0x5f,0xc1,0x7e,0x4e,0x22,0x84,0x6c,0x2f,0x27,0xde,0x39,0xbc,0x8f,0x6c,0x14,0x1b,0x9c,0x90,0x97,0x45,0xeb,0x83,0x2a,0xda,0xd8,0x75,0xdc,0xc0,0x4d,0x5c,0x76,0x07,0x32,0x7d,0x6a,0x99,0x7c,0x88,0x4d,0xd7,0x5e,0x12,0xcb,0xa3,0xce,0x5c,0xe8,0xdc,0xe6,0x49,0x30,0x4a,0xae,0x7b,0x66,0x2d,0x90,0xa7,0x71,0xff,0x26,0xf7,0x81,0x9d,0x20,0xa9,0xaf,0x39,0x2b,0xf6,0xb4,0xd6,0x0d,0x33,0x02,0xe1,0xd4,0x69,0xfc,0x05,0x08,0xa5,0x69,0x96,0x05,0x38,0xa5,0xb9,0x2c,0xc5,0x99,0xba,0xb2,0xa6,0x50,0xa7,0xe9,0x12,0x30,0x2c,0x2e,0xc3,0x45,0x54,0xa7,0x17,0x17,0xda,0xd2,0x8d,0x28,0x9b,0x59,
+0xe2,0x27,0x01,0x3c,0xa2,0x00,0xff,0x79,0x46,0xe7,0x8d,0x67,0x91,0x6b,0xdd,0x0f,0xd0,0xdf,0x2d,0xf8,0x22,0x07,0x13,0x64,0x4e,0x10,0xbf,0x97,0xe4,0x8f,0x48,0xe9,0x34,0xdc,0x65,0x33,0x7f,0x88,0xd7,0xd6,0x8a,0x10,0x42,0x05,0xf9,0xdb,0x67,0x7a,0x13,0x4b,0x07,0x6e,0x62,0xc9,0x91,0x90,0xff,0xca,0x80,0xb1,0x37,0xa3,0xc1,0x7b,0x0c,0x38,0x6c,0x89,0x14,0x18,0xd9,0x09,0x2e,0x1e,0x58,0xfa,0x8e,0x13,0xb8,0x2f,0xa4,0x19,0x04,0x89,0x19,0x70,0xc4,0xc4,0x6f,0xac,0xe9,0x88,0xf3,0x34,0x30,0x42,0x61,0x62,0xe9,0x62,0x33,0x2e,0xfb,0xb0,0xbb,0xf0,0xbd,0x05,0x1e,0x27,0xcc,0x96,0x77,0x12,0x08,0xe7,0xad,0x8a,0x34,0x10,0x0e,0x7e,0x67,0xe7,0x43,0x56,0x1d,0x06,0x27,0x6d,0x5c,0x54,0x02,0xc1,0xe9,0xe4,0x10,0x1d,0xb6,0x88,0xce,0xee,0x60,0xf2,0x78,0x74,0x56,0x06,0x93,0x2d,0xea,0x0a,0x42,0xe8,0xac,0xb0,0x27,0xd2,0xac,0xac,0xb4,0x5f,0x50,0xca,0xac,0x16,0xac,0xa1,0x2d,0x2e,0x21,0xab,0x5b,0x1a,0x36,0x34,0xa7,0x0e,0xfc,0xde,0x1d,0x46,0x6f,0x99,0x96,0x94,0x37,0x63,0x8a,0x23,0x6e,0x49,0xba,0x54,0xd4,0x98,0x74,0x79,0xb1,0x3d,0xe9,0x52,0x51,0x93,0xd2,0xe5,0x3d,0xd5,0x78,0x15,0x37,0xec,0x3a,0x0a,0xbd,0x08,0x9a,0xaa,0x4a,0x67,0x20,0x48,0x68,0x4d,0xfd,0x5e,0xf0,0x88,0xe2,0x59,0x23,0xec,0xa2,0x34,0xab,0xc1,0x60,0xe1,0x3b,0x8e,0xbb,0xca,0x37,0xd9,0x32,0x01,0x7d,0x2a,0x98,0xae,0x9d,0xc8,0xe0,0xb3,0x1d,0xdc,0xe9,0x9b,0xd6,0xcc,0x12,0x19,0x46,0x3c,0x19,0x50,0x22,0xfe,0xb2,0x82,0x8d,0xc8,0xf1,0x61,0xed,0x63,0x50,0xd1,0x56,0x6f,0x35,0x43,0x1e,0x2b,0x73,0xad,0x15,0x38,0x23,0xfb,0x2d,0x22,0xa0,0xc1,0xbf,0x80,0x8b,0xbc,0x74,0x05,0xe6,0xa9,0x93,0x17,0xd1,0xd0,0xe0,0x2f,0x42,0xc7,0xd7,0x42,0x57,0xa8,0x3f,0x71,0xe6,0x22,0x1a,0x3a,0x4d,0x20,0x40,0x47,0x37,0x7a,0xea,0x4b,0x90,0xda,0x09,0x01,0x09,0x0d,0x01,0x44,0xd8,0xe9,0x7d,0x6c,0x15,0x3a,0x82,0x6c,0x24,0x14,0x53,0xd1,0xe9,0x0a,0x01,0x01,0x74,0xb1,0x4e,0x85,0x76,0x20,0x1b,0x16,0x05,0x24,0x74,0xda,0x41,0x80,0x9d,0xde,0x9b,0xa0,0x2f,0x43,0xba,0x2b,0x52,0x4c,0x45,0x43,0x0c,0x11,0x81,0x34,0xa1,0x75,0x95,0x41,0x89,0x77,0x5f,0x8a,0xa9,0x68,0x8d,0xcc,0x22,0x01,0x92,0x19,0xb4,0x8a,0x14,0x78,0x97,0xa7,0x90,0x88,0x96,0x10,0x45,0x7c,0x66,0xc9,0x29,0x0d,0x34,0x68,0x00,0x76,0x2d,0x29,0xf3,0x39,0xcc,0xf0,0xa4,0x17,0x89,0xb2,0x5c,0x79,0xd0,0x2b,0x54,0x49,0x21,0x66,0xf9,0x2b,0x37,0x22,0xe5,0x03,0xa3,0x81,0xd3,0xe1,0x14,0x4e,0x81,0x2a,0x3f,0xe4,0xb6,0x0d,0x03,0x7f,0x97,0xa7,0xe9,0xa5,0xdf,0xec,0x0f,0xfa,0xf0,0x2c,0x2b,0xf5,0x3b,0xc5,0x16,0xed,0xa5,0x09,0x36,0x3e,0x97,0x46,0xa8,0x0b,0x0f,0xbf,0xd2,0xf3,0x26,0xf2,0x26,0x25,0x89,0xbc,0x23,0x75,0x48,0x57,0xbd,0x69,0xa0,0xdd,0x3e,0x38,0x60,0xa5,0x43,0x6a,0xe4,0x3b,0x2e,0x86,0x7f,0xa6,0x41,0x7b,0x66,0x26,0xac,0x0e,0xe9,0xce,0x41,0xbb,0x48,0x1a,0xee,0x67,0x59,0x38,0x34,0xd9,0x4e,0xb7,0xab,0x41,0x36,0x6f,0x4f,0x13,0x9e,0xff,0x95,0xb4,0x27,0x23,0x23,0x7e,0x28,0x23,0xd7,0x39,0x30,0xe5,0xe4,0x68,0xd9,0xf0,0xc3,0xcb,0x4b,0x3a,0x9d,0x4d,0x87,0x08,0x4a,0x9a,0xd4,0xb2,0xe1,0x11,0xba,0x4d,0xc2,0x06,0x30,0x9b,0xd8,0x8d,0x5a,0xd9,0xf1,0x20,0x58,0x00,0x47,0x84,0xe0,0x6d,0x5c,0x7c,0x29,0xc6,0xd5,0x0e,0x95,0x84,0xb9,0xa0,0x99,0xbc,0xbc,0x1a,0xd1,0x94,0xce,0x29,0xe9,0xfc,0xa3,0xbf,0xc1,0xed,0x04,0x91,0x1c,0x26,0x35,0x88,0xba,0xf2,0xcf,0x64,0x31,0x8c,0x3b,0xdc,0x9d,0x3d,0x53,0xc5,0xd9,0xd9,0x46,0xbd,0x53,0x9e,0x39,0x66,0xda,0x77,0x78,0xb1,0xbd,0x99,0x3e,0xcd,0xdc,0x79,0x18,0xc9,0x97,0x1a,0x24,0x9f,0x24,0x70,0xf2,0x33,0xfa,0x70,0x34,0xf3,0x9d,0x0a,0x96,0xe4,0xa7,0x36,0xd0,0x6f,0x81,0x95,0xb8,0x3f,0xde,0xb7,0x7a,0xc6,0x9f,0x76,0x1a,0xd9,0x8b,0x5b,0xf2,0x82,0x9c,0x34,0x26,0x07,0x8d,0x33,0xcc,0x56,0x18,0xf9,0xd0,0xf8,0xe0,0xc5,0x99,0x46,0xba,0x6f,0x89,0x95,0x3c,0x6d,0xab,0x4c,0x57,0x7b,0x30,0x96,0xa5,0xeb,0x9a,0x82,0xf4,0xb2,0x1c,0x38,0x26,0xd5,0x1c,0x64,0xef,0x29,0x79,0x52,0x65,0x13,0xcf,0x35,0x08,0x9e,0xfc,0x4b,0x39,0x48,0xf2,0x48,0x73,0x18,0xdd,0x0c,0xa3,0xf8,0x5d,0xa1,0xcf,0x2a,0x45,0xf6,0x4c,0x86,0x5e,0x9f,0x3b,0xf1,0xdf,0x67,0x94,0x02,0x3d,0xe6,0xbf,0xd2,0x5c,0xb8,0xaf,0x0e,0x5d,0x4e,0xf7,0x58,0xd3,0x89,0x1f,0x29,0xdd,0xeb,0xb2,0xba,0x97,0xdb,0x02,0xb3,0xcb,0xb2,0x61,0x3f,0x49,0x98,0x2c,0x97,0xec,0x99,0x7c,0xa6,0x30,0x59,0x2e,0xd9,0x33,0x55,0x9c,0xff,0xfa,0x52,0xfc,0x36,0x73,0x58,0x48,0x1b,0x27,0xfc,0x66,0x00,0x97,0xab,0xe1,0xca,0x8e,0xf4,0xec,0x0d,0x24,0x15,0xb8,0x09,0xfc,0xec,0x0a,0x67,0x9b,0x28,0xc5,0x5b,0xee,0x5c,0x88,0x37,0xec,0xa5,0xfc,0x72,0x5d,0xde,0xac,0xd7,0x6e,0x64,0x5b,0xb1,0xfb,0x42,0xad,0x0d,0xf0,0x39,0x21,0xf9,0x63,0xcf,0xb2,0xd9,0x17,0x45,0x43,0xd7,0x31,0x67,0x08,0x28,0x9d,0x5d,0x46,0x19,0x39,0x67,0x96,0xed,0xcb,0x2e,0xfc,0xcc,0xf6,0x2f,0xfa,0xb1,0xf3,0x65,0x77,0xb5,0x59,0xce,0x60,0xe5,0x5e,0xbf,0x90,0x5c,0x92,0x0b,0x80,0xac,0x72,0x94,0xaf,0x1d,0x8b,0x36,0xff,0x51,0x03,0x68,0x97,0x5a,0x3b,0x26,0xc7,0xa4,0x1a,0x85,0x1d,0x82,0x0a,0x95,0x5e,0x59,0xbf,0x5a,0x49,0xe8,0x79,0x70,0x45,0x46,0x75,0x02,0x3f,0x1d,0x59,0xe9,0x06,0x3f,0x49,0x23,0x76,0xd2,0xc0,0x31,0xa7,0x8b,0x17,0xf3,0x64,0xb3,0x68,0x49,0x3f,0xa1,0x71,0x44,0x9c,0x01,0x1d,0xab,0xb5,0xf6,0xe0,0x17,0x3e,0xb5,0x77,0xc0,0x65,0xd0,0x09,0x37,0xf6,0xfb,0xcb,0xb8,0xe1,0x5a,0xb1,0x0b,0x73,0x55,0x53,0xa5,0x30,0x84,0x5e,0xbb,0x51,0xf2,0x38,0xc8,
+0xe5,0x6a,0x42,0x06,0x4d,0x92,0xaf,0xb9,0x99,0x8d,0xcd,0x54,0x3b,0x7a,0xd0,0x70,0x70,0xb5,0xa2,0x3e,0x52,0xb4,0x99,0x94,0xa4,0xad,0xbe,0x1a,0xda,0x64,0xa1,0xdb,0x6a,0xe8,0x0e,0x03,0xdd,0x65,0x81,0x4b,0x3f,0x8c,0xe4,0xa0,0xf9,0x26,0x74,0x59,0x9f,0xa4,0xd3,0x49,0x29,0x8e,0xb0,0xc6,0xb8,0x67,0x90,0x59,0xe3,0xb3,0x7c,0xc8,0x7c,0x2f,0xda,0xec,0xc1,0x29,0xa0,0x9c,0x95,0xb9,0xf3,0x9c,0xe6,0xd1,0x36,0xf4,0x30,0x3a,0x3a,0xc2,0xb5,0x94,0xd2,0x61,0x13,0x59,0x65,0x4b,0x29,0x35,0x96,0x98,0x93,0xf0,0x58,0x64,0x68,0x4d,0x54,0xbb,0x0e,0xf2,0xdd,0xa7,0x3a,0xa1,0x5f,0xb5,0x2f,0x4d,0x78,0x9f,0x72,0x23,0x9d,0xf8,0xa5,0xe2,0x34,0x2c,0xd5,0xce,0xf7,0x0c,0x0a,0x66,0x4c,0xa5,0x23,0x89,0x02,0x19,0xb8,0xa8,0x4e,0x1f,0xbc,0x2b,0xdb,0x97,0x2a,0x42,0xcf,0xa1,0xe5,0xd9,0x7e,0x49,0xa6,0x1d,0x88,0xad,0xb5,0x6f,0x3b,0x6b,0x76,0xc5,0x36,0x7d,0xba,0x35,0xf0,0x52,0x31,0x3e,0xa9,0xb2,0xd3,0xb4,0xb2,0x12,0xe6,0x3d,0xbf,0x57,0x50,0x82,0x4e,0x4e,0x5d,0x48,0x88,0x88,0x73,0x14,0x49,0x48,0x51,0x07,0x93,0x24,0xe4,0x72,0x88,0x0a,0x24,0x13,0x6b,0xa6,0xa2,0x97,0x58,0x33,0xf6,0xd3,0xb2,0x3a,0x2d,0x0e,0xca,0x05,0x2c,0x04,0x10,0x66,0xae,0x41,0x2a,0x24,0xcc,0x5c,0xd3,0x8e,0x0a,0x5f,0x43,0xdb,0xfc,0xce,0xf0,0x22,0x8d,0xb2,0x9a,0xaa,0xbb,0x83,0x01,0xe2,0x3e,0xa8,0x0b,0x6f,0xa1,0x17,0x86,0x1f,0x65,0x32,0xe8,0xf5,0x23,0x03,0xc8,0xf5,0x40,0xa7,0x90,0xbf,0x89,0x95,0x4e,0xd9,0xd4,0x1d,0xd8,0x4c,0x7a,0x0b,0x2b,0x8a,0x7a,0xcc,0x22,0x6b,0xe5,0xa8,0xe4,0x47,0x00,0xec,0xa6,0x3f,0x83,0x8c,0x32,0xe4,0x61,0xd1,0x6f,0x78,0x4f,0x5d,0x69,0xde,0x64,0xda,0x5c,0xc6,0x49,0xe4,0x26,0xf6,0x42,0x66,0x2f,0x8b,0x87,0x26,0xc4,0xd1,0x32,0x5a,0x0f,0xd1,0x5b,0x0e,0x11,0x89,0x4c,0x1f,0x0f,0xa0,0x6a,0xa5,0xb0,0x30,0xc2,0x8f,0xf8,0x39,0x41,0xf9,0x19,0x26,0x08,0x83,0xcd,0xfa,0x73,0x85,0x76,0xe0,0xfd,0x86,0x3a,0xac,0x44,0xdd,0x43,0xc2,0x7c,0xca,0x42,0x4b,0x1b,0x49,0x68,0x62,0x97,0xee,0x6a,0x43,0xd5,0x48,0x96,0x02,0x8a,0xba,0x7a,0xa9,0xbb,0x7e,0x68,0xec,0x09,0x93,0xcb,0x62,0x7d,0x39,0xa4,0xfd,0xe7,0x61,0x9a,0x9c,0x0c,0x99,0x18,0x43,0xb4,0x3c,0xf0,0x22,0x90,0xa3,0x91,0x9b,0x7f,0xa1,0x89,0xc2,0xf7,0x3e,0xb5,0x0f,0x9a,0xe9,0xff,0xbb,0xbd,0x9d,0xdc,0x5f,0x52,0x2e,0x8e,0x25,0x4b,0x8d,0x4d,0x26,0x74,0xc5,0xca,0x20,0xec,0x29,0x71,0x83,0x30,0xfd,0x57,0x1a,0x5e,0x17,0xa3,0xf9,0x74,0x9b,0x6e,0x1b,0xbb,0xea,0xbf,0x52,0xcb,0x6d,0xa5,0xea,0x42,0xcf,0x95,0x09,0x4b,0x7a,0x8a,0xb7,0xb2,0x7e,0xa1,0xed,0xb0,0xb8,0xbf,0x9e,0x99,0xae,0x83,0xf3,0xb8,0x8e,0xa8,0xeb,0x5e,0x76,0x97,0xa1,0x63,0x05,0xad,0xbc,0xb6,0xcf,0xd9,0x31,0x35,0xd2,0xab,0xb2,0xe4,0x1c,0x06,0xd9,0x86,0x5c,0xb6,0xdc,0xb1,0xdf,0xcf,0xb8,0xd8,0x56,0xe4,0x34,0xd3,0xdf,0xb1,0x6a,0xe7,0x8b,0xca,0xfc,0x82,0x18,0xb2,0x83,0x6d,0xc3,0xf8,0xb5,0x80,0xde,0x02,0x2e,0x0a,0xef,0xb0,0x06,0x41,0x3e,0x29,0x84,0xed,0x51,0x21,0x04,0xd4,0x10,0x2e,0x9b,0x54,0x8b,0x84,0xeb,0x22,0xd9,0x30,0xe5,0x3e,0x7c,0x78,0xc9,0x2a,0x1c,0x84,0xf1,0xbf,0x57,0x48,0xff,0x09,0x57,0x48,0xa9,0x66,0x81,0x5b,0x1b,0x53,0x91,0x60,0xe7,0xe6,0xa4,0xe6,0xfe,0x83,0xeb,0x90,0xd1,0x80,0x90,0xe0,0x80,0x30,0xf3,0x2f,0x19,0x48,0x15,0x68,0x4d,0x48,0xd7,0x5b,0xe9,0x57,0xff,0x84,0x8b,0xae,0x02,0xf1,0xc5,0x2b,0xaf,0x85,0xaa,0x4b,0x96,0x5f,0x69,0x38,0xb2,0x06,0x4b,0xbf,0xd2,0x5f,0x88,0x65,0x18,0xea,0xaf,0xc6,0x52,0x68,0xbf,0x7b,0x49,0x96,0x63,0xf5,0x5b,0xd7,0x65,0x39,0x5e,0xbf,0x73,0x71,0x36,0x37,0xa1,0x82,0x83,0x99,0x8e,0x1f,0xb9,0x36,0x52,0x52,0x3b,0x0c,0x36,0xcb,0x55,0x89,0x21,0xe5,0xd6,0x48,0x69,0xe2,0x2d,0xb8,0x71,0xb8,0x49,0xbf,0x80,0xab,0xbb,0x95,0x56,0xfe,0x8a,0xe2,0x49,0xa3,0x2e,0x2a,0x1c,0x4c,0x43,0x0c,0x93,0x31,0x00,0x79,0xfe,0x5b,0x5e,0x22,0xd9,0x1c,0x8c,0x5b,0x46,0xe5,0xf3,0xd6,0xf4,0x14,0x89,0x60,0x7a,0x6c,0x3b,0xb7,0x84,0x1b,0xdf,0xa4,0x91,0x75,0xe1,0xcc,0x2e,0xb3,0xe8,0x50,0x68,0x63,0x45,0xda,0x1d,0x4a,0x46,0x51,0x2e,0x1b,0xb6,0x0a,0xc5,0xaa,0x17,0x58,0x65,0x59,0x26,0xd4,0xeb,0x0f,0x6d,0x83,0xab,0x3f,0x3a,0x05,0x5c,0x3a,0x19,0x11,0xdb,0x55,0xe9,0x31,0x7a,0x3e,0xc2,0xa0,0xba,0x9d,0x30,0xaf,0x1c,0x1f,0x29,0x56,0x8f,0x90,0x47,0x95,0xc4,0xfa,0x85,0x2f,0x05,0xac,0xd7,0xc9,0x52,0xd0,0x18,0x44,0x2e,0x41,0x88,0x8b,0x8e,0xd4,0xef,0xe2,0x31,0xc7,0x7f,0xfe,0xd0,0x39,0xc4,0xde,0x2e,0x44,0xd6,0x98,0x16,0xde,0x7b,0x10,0xce,0xfc,0xc0,0xfd,0x2b,0x79,0x45,0x1d,0xbe,0x80,0x14,0x48,0x76,0x36,0x25,0x38,0xfc,0x02,0x9e,0x03,0x1f,0xb2,0x17,0xde,0x28,0xf0,0x92,0x45,0xe4,0xba,0x2d,0x78,0xc9,0x50,0xe2,0x46,0x71,0x81,0xc2,0x5e,0xaf,0x94,0xc0,0x36,0x6c,0x25,0x0b,0x3f,0x72,0x8a,0xc8,0xfd,0x3e,0xba,0xc8,0xaa,0x8c,0xc2,0xc2,0x0a,0xe6,0x05,0xdc,0x5e,0xa9,0xe4,0xe1,0xca,0xc5,0x8c,0x0b,0xb8,0x9d,0x0e,0xba,0x0e,0x4b,0x87,0x00,0xa9,0x78,0x81,0x84,0x59,0x5a,0xef,0x70,0x3e,0x8f,0xdd,0x84,0x6f,0x3f,0x7a,0x4e,0xb9,0xa7,0x4d,0x23,0x6f,0x42,0x1a,0x5f,0xb3,0xf9,0x08,0x11,0xd4,0x8a,0x34,0xba,0x46,0x0b,0x62,0xcc,0xbc,0x21,0x69,0x74,0xdd,0x46,0xcc,0x69,0xa4,0x6d,0xc9,0x6c,0x2c,0x29,0x6d,0x83,0x76,0xa1,0xed,0xf7,0x11,0x63,0xfc,0x47,0x93,0x7d,0x9b,0x61,0x5a,0x85,0x80,0x59,0x1c,0x34,0xb8,0xd9,0xd1,0x9f,0x3d,0x4d,0xfe,0x26,0xc3,0xbf,0x12,0x85,0x4e,0x7d,0xdd,0xeb,0x54,0x6c,0xea,0xae,0x6c,0xa4,0x54,0x6a,0xeb,0xae,0x48,0x4d,0xf4,0x28,0xf4,0x0a,
+0x02,0x74,0xdb,0xd5,0x1b,0xbb,0xc7,0x08,0x50,0x89,0x42,0xbf,0x8e,0x9d,0xc1,0x5c,0xfb,0x15,0x07,0xd7,0x5e,0x91,0x55,0x0d,0xc5,0xde,0x63,0xb9,0x56,0xa1,0xb0,0x2f,0xb3,0xc7,0x95,0x1a,0x7b,0x5f,0x64,0x92,0xf4,0x28,0x1c,0xd4,0xf0,0x26,0x84,0xeb,0x41,0x45,0x43,0xda,0x36,0x8a,0x56,0xa4,0x86,0x6a,0xb7,0x0d,0xd6,0x8e,0x54,0x21,0xd1,0x2e,0x1a,0xb2,0x83,0x1a,0xca,0xdd,0x66,0x4d,0x59,0x25,0x12,0x6d,0xb3,0x4e,0x04,0x90,0x32,0xe6,0x6c,0x98,0x6c,0xd5,0xa7,0xb0,0xfc,0xc9,0x87,0x2c,0x84,0x45,0x31,0x72,0x49,0xc3,0x94,0x02,0x80,0x40,0xd6,0x62,0x68,0x22,0xc3,0xa2,0x94,0x83,0x0d,0x47,0x64,0x08,0xbc,0x5b,0x4d,0x43,0x10,0x19,0x7c,0x8f,0x95,0x2a,0xf3,0x96,0x32,0x78,0xde,0x71,0x72,0xa1,0x86,0x0c,0xcd,0x64,0xeb,0x21,0x0c,0x2f,0x52,0x5c,0xc9,0xe0,0x10,0x86,0x14,0x22,0x1c,0x51,0x13,0x50,0x61,0x84,0x08,0x85,0x6f,0x05,0x2e,0x74,0x10,0xa1,0x08,0x1b,0xa2,0x10,0x2e,0x88,0x30,0xb9,0xb6,0x68,0xcb,0xda,0x4c,0x68,0x0e,0x69,0x9d,0x16,0x11,0x97,0x22,0x99,0x52,0xc5,0x14,0x5a,0x3d,0xda,0xfd,0x8b,0xf8,0xc8,0xb1,0x3a,0xd5,0x74,0xa0,0xa3,0xd1,0x44,0xdd,0x12,0x6d,0x94,0xb7,0x51,0x57,0xd1,0x75,0x02,0xac,0x9e,0x8c,0x91,0xd8,0x0f,0xd3,0x6e,0x5b,0xc4,0x48,0x8e,0xd5,0xd7,0x1d,0x8f,0xc4,0x3d,0x6b,0x28,0xed,0x9e,0x94,0x64,0x99,0x22,0xed,0x09,0xa9,0x4b,0xb1,0xf6,0x4b,0x6c,0x8f,0xbc,0x91,0xf6,0x15,0xc3,0x55,0x80,0x75,0xa0,0x69,0x15,0x53,0xb7,0xaa,0x61,0x40,0xda,0x86,0x74,0xb4,0x95,0xa9,0x52,0x8e,0x5a,0xee,0x45,0xb1,0xcb,0x94,0xb1,0x3a,0x28,0x53,0xa6,0xb6,0x70,0x68,0xcb,0xd1,0xda,0xa6,0xae,0xd7,0xc9,0xdc,0xa1,0x70,0x4c,0x43,0xe0,0x2a,0x1f,0x43,0x78,0xe7,0xd8,0x2c,0xba,0x4b,0x74,0x22,0x3c,0x91,0xbb,0xcb,0x26,0xef,0x3e,0x79,0x04,0x2d,0xf7,0xd9,0x94,0x3b,0x56,0x09,0x3d,0xa9,0x63,0x6d,0x8a,0xdd,0xad,0x84,0x8c,0xcc,0xdd,0x36,0x79,0xf7,0x2b,0xc1,0x97,0xb9,0xdf,0xa6,0xd0,0x27,0x4b,0x88,0x94,0xf8,0xe4,0xa6,0xc4,0x55,0x4b,0xa8,0xe9,0xb8,0xea,0x66,0xa9,0x2f,0x27,0xc4,0xab,0xf8,0xf2,0xa6,0xd2,0xd1,0x0b,0x08,0x96,0x38,0xfa,0xa6,0xc4,0xff,0x0b,0x28,0x95,0xf8,0xff,0xa6,0x2a,0x36,0x10,0x90,0xd3,0x8b,0x0d,0x9a,0xea,0xc8,0x41,0x40,0x97,0x8f,0x1c,0x9a,0x4c,0x18,0x21,0xe9,0xcf,0xd2,0x30,0xa2,0x29,0x0a,0x2d,0x04,0xdc,0xe5,0xa1,0x45,0x93,0x89,0x33,0x64,0x23,0xb8,0x34,0xce,0x68,0x8a,0x62,0x0f,0x81,0x20,0x8a,0xd8,0xa3,0xc9,0x04,0x22,0x95,0x34,0xbc,0xd3,0x14,0x05,0x27,0xe5,0xbd,0xd0,0x6d,0x32,0x91,0x8a,0x7a,0x8c,0x2a,0x22,0x95,0xa6,0x28,0x7a,0x91,0x2b,0x97,0x28,0x7a,0x69,0x32,0xa1,0x8c,0x44,0x92,0xf2,0x50,0xa6,0x29,0x0a,0x6f,0x04,0x92,0x28,0xc2,0x9b,0x26,0x13,0xeb,0x68,0x1a,0x3f,0x12,0xeb,0x34,0x45,0xf1,0x4f,0xf9,0xa0,0xdd,0x6b,0x32,0xc1,0x90,0x8c,0x67,0x69,0x30,0xd4,0x14,0x05,0x48,0x22,0xf6,0xf2,0x00,0xa9,0xc9,0x44,0x4b,0x6a,0xd7,0xa1,0x88,0x96,0x9a,0xa2,0x08,0x4a,0x6e,0x07,0x45,0x11,0x54,0x93,0x09,0xa7,0xf4,0x7c,0x61,0x1a,0x4e,0x35,0x45,0x21,0x56,0xb9,0x5d,0x87,0x1f,0x4a,0x99,0x80,0x4b,0x66,0x97,0xca,0x03,0xae,0xa6,0x30,0x0a,0x13,0x99,0x26,0x45,0x14,0xd6,0x64,0x63,0x32,0x89,0x34,0x1a,0x31,0x59,0x53,0x18,0xa8,0x09,0xa4,0x51,0x05,0x6a,0x4d,0x36,0x6c,0xd3,0x8c,0x76,0xb2,0xb0,0xad,0x29,0x8c,0xe5,0x44,0x36,0x52,0x1a,0xcb,0xd1,0xdb,0xe6,0xf6,0xc4,0x6b,0x1c,0xe8,0x73,0x98,0x62,0x89,0x83,0x2b,0xd7,0x5b,0xe1,0x10,0x23,0xc9,0x17,0x38,0xc4,0xf0,0xd2,0xf5,0x0d,0x31,0xb8,0x74,0x79,0x43,0x0c,0x5e,0xb6,0xba,0x21,0xc6,0xd2,0x5a,0xdc,0xc0,0xa8,0x95,0xd6,0x36,0x8a,0x28,0x65,0x4b,0x1b,0x45,0x8c,0xb2,0x95,0x8d,0x22,0x86,0xe6,0xc2,0x46,0x11,0xb1,0xb0,0xae,0x21,0x6e,0xad,0xf2,0x65,0x8d,0x22,0x69,0xc5,0xaa,0x86,0x44,0x17,0xcb,0x17,0x35,0x8a,0x5c,0x54,0x6b,0x1a,0x55,0x7a,0xbe,0x53,0xde,0x38,0x5d,0xb5,0x02,0xaa,0x16,0x34,0xa4,0x3d,0x26,0x5c,0xcf,0x10,0xb3,0xd1,0x58,0xce,0x28,0xb2,0x51,0xad,0x66,0xe8,0x8d,0xbe,0xcc,0x99,0x97,0xa9,0xe9,0x9e,0x8c,0x60,0xf9,0x52,0x86,0x80,0xb6,0x62,0x25,0x43,0x69,0x64,0x54,0x0b,0x19,0xd2,0xb1,0x29,0x5c,0xc7,0xd0,0xb2,0x7d,0xb9,0x8f,0x2d,0x33,0x15,0xd0,0x09,0x8a,0xc7,0x96,0xc6,0x22,0x86,0x60,0x74,0xa9,0xd6,0x30,0xc4,0x8c,0x74,0x96,0x30,0x8a,0x8c,0x94,0x2b,0x18,0x7a,0x4e,0x85,0x72,0x7a,0xc5,0xf1,0x5b,0xbe,0x7e,0x41,0x65,0x16,0xe0,0x7c,0x9e,0xe3,0xc6,0xf7,0x49,0xb8,0x56,0x78,0xbd,0x02,0x84,0x9e,0xdf,0x93,0xa1,0xc9,0x3d,0x9f,0x0c,0x43,0xea,0xfb,0x64,0x08,0x52,0xef,0x27,0x43,0x28,0xf3,0x7f,0x32,0x3c,0x2d,0x0f,0x98,0x22,0x57,0xf2,0x81,0x22,0xa4,0x32,0x2f,0x28,0xc2,0x29,0xf3,0x83,0x22,0x1c,0x4d,0x4f,0x28,0x42,0x2d,0xf8,0x42,0x59,0xcb,0x95,0x7b,0x43,0x11,0x79,0x85,0x3f,0x94,0x6a,0x69,0xb9,0x47,0x14,0x71,0x52,0xf9,0xc4,0x6a,0xda,0xd0,0xd1,0x69,0xa8,0x6e,0x99,0x6a,0xaa,0x3c,0xa3,0xa2,0x0f,0x85,0xbe,0x51,0xc6,0x4a,0xc3,0x3b,0x8a,0x58,0xa9,0xfc,0xa3,0xee,0x08,0x4d,0x3d,0xa4,0x86,0x0a,0xef,0xc9,0x89,0x96,0x7b,0x49,0x21,0x7d,0x85,0x9f,0x2c,0x31,0x49,0x2a,0x4f,0xa9,0x18,0xc1,0x42,0x5f,0xa9,0x69,0x2f,0x33,0x6f,0xa9,0x61,0x56,0xda,0x86,0x7c,0xfc,0x69,0x78,0x4c,0xe1,0x08,0x54,0xf9,0x4c,0x19,0x33,0x1d,0xaf,0x29,0x62,0xa6,0xf4,0x9b,0xba,0x6e,0x29,0xf7,0x9c,0xc2,0x71,0xae,0xe1,0x3b,0xf3,0x2c,0x32,0x9c,0xef,0xa4,0x72,0xdf,0xc8,0xdd,0xa7,0x08,0x48,0xcf,0x83,0x2a,0x30,0xe5,0x4e,0x54,0x81,0x24,0xf5,0xa3,0x0a,0x1c,0xa9,0x2b,0x55,0xe0,0x94,0x79,0x53,0x05,0xaa,0x96,0x43,0x65,0x52,0x0e,0x55,0xf0,0xa9,0x12,
+0xbc,0x32,0xb7,0x2a,0x41,0x2b,0xf3,0xac,0x12,0x34,0x4d,0xe7,0x2a,0xc1,0x2e,0xf8,0x57,0x45,0x5b,0x96,0xbb,0x58,0x09,0x13,0x85,0x97,0x55,0x29,0x73,0xb9,0xa3,0x95,0xf0,0x53,0xf9,0xda,0xca,0xba,0xd2,0xd1,0x6c,0xba,0xae,0x86,0x06,0xab,0x9c,0xae,0xba,0x7b,0x85,0x7e,0x57,0xc1,0x50,0xc3,0xf5,0x4a,0x18,0xaa,0xbc,0x6f,0x85,0x71,0x9d,0x3a,0x60,0x3d,0x65,0xdf,0x53,0x92,0x2e,0x77,0xc3,0x32,0x2e,0x0a,0x4f,0x5c,0x6e,0xd7,0x54,0xce,0x58,0x3d,0xf4,0x85,0xfe,0x58,0xdf,0xfa,0x66,0x2e,0x59,0xcf,0x30,0xb5,0x0d,0xe5,0xa8,0xd5,0x70,0xcc,0xb2,0x71,0xab,0xf2,0xcd,0x0a,0x96,0x3a,0xee,0x59,0xc2,0x52,0xe9,0xa1,0x2b,0x78,0xbe,0xdc,0x49,0xcb,0x6c,0x84,0x86,0x9f,0xce,0xd3,0xb3,0x71,0x7e,0x9a,0x24,0x92,0x93,0xfb,0x68,0x1e,0x40,0xcf,0x3f,0x4b,0xb0,0xe4,0xbe,0x59,0x82,0x20,0xf5,0xcb,0x12,0x78,0xa9,0x4f,0x96,0xc0,0x97,0xf9,0x63,0x09,0x9a,0x96,0x2f,0xce,0x72,0xf4,0x55,0xf0,0xc3,0x02,0x9c,0x32,0x1f,0x2c,0x40,0x29,0xf3,0xbf,0x02,0x14,0x4d,0xdf,0x2b,0xc0,0x2c,0xf8,0x5d,0x49,0x9b,0x95,0xfb,0x5c,0x01,0x71,0x85,0xbf,0x95,0x29,0x66,0xb9,0xaf,0x15,0xf0,0x51,0xf9,0xd9,0x4a,0x3a,0xd0,0xd1,0x68,0xa2,0x6e,0x89,0x36,0xaa,0x7c,0xab,0xbc,0xeb,0x84,0x7e,0x55,0xc2,0x48,0xc3,0xa7,0x0a,0x18,0xa9,0xfc,0xa9,0xe6,0x78,0x4c,0x7d,0x69,0xb9,0xd2,0xee,0x49,0x49,0x96,0xfb,0x50,0x11,0x75,0x85,0xff,0x54,0xdb,0x1e,0x95,0xef,0x94,0x0f,0x57,0xa1,0xdf,0xd4,0xb3,0x8a,0x99,0xcf,0x2c,0x37,0x20,0x6d,0x43,0x3a,0xda,0x34,0x7c,0xa5,0x68,0xbc,0xa9,0xfc,0xa4,0x84,0x95,0x8e,0x8f,0x14,0xb0,0x52,0xfa,0x47,0x4d,0xaf,0x93,0xfb,0x46,0xd1,0x98,0x46,0x7e,0x31,0xdd,0x0b,0xce,0xe6,0x86,0x22,0xd7,0x78,0x70,0x37,0x67,0x30,0x2f,0x99,0xfc,0xfc,0x84,0x08,0x75,0xbe,0x90,0xcb,0xaa,0x57,0x80,0x2c,0xc9,0xc2,0x27,0x38,0x12,0x57,0x7a,0xcb,0x2e,0x05,0xeb,0x59,0xeb,0x00,0x26,0x7e,0xa7,0x2b,0xc5,0x5d,0x1a,0x6b,0xd0,0x15,0x31,0x44,0xd8,0xf2,0xda,0x88,0xc1,0xb5,0x33,0xfe,0xf2,0x98,0xe9,0xee,0xfb,0x2c,0x21,0x02,0x95,0xb8,0xb0,0xf2,0xde,0x42,0x4c,0x38,0xf2,0xc9,0xcd,0xaa,0x30,0xb7,0xca,0x00,0x27,0x58,0xe1,0xca,0x29,0xae,0xd9,0xb9,0x64,0xe2,0xe5,0xb8,0x93,0x89,0xaa,0x63,0x74,0x34,0xa5,0x0f,0x6c,0x3d,0xf2,0x44,0x37,0x85,0xf3,0x06,0xc2,0x43,0x94,0xb8,0x7c,0x13,0x24,0x3e,0x3c,0x3d,0xab,0x12,0xff,0x57,0xa6,0x0b,0xc5,0xe3,0x9f,0x35,0x5a,0x2c,0xbb,0x0e,0x81,0x2c,0xf3,0xec,0x70,0xd7,0x26,0x57,0xf9,0x3e,0x12,0x53,0x74,0xf8,0xdb,0x97,0x17,0x6e,0x14,0xb6,0x7e,0xf9,0x8e,0x1b,0x56,0x3e,0xe6,0x5a,0x38,0xb5,0x9d,0xd3,0x6a,0x60,0x8a,0x79,0x6e,0x40,0xea,0xb8,0xbc,0x41,0x9e,0xa9,0xac,0x3f,0x95,0x52,0x1a,0x74,0x1c,0x94,0xc2,0xa0,0x89,0xfe,0x32,0x76,0x68,0xb6,0x28,0x40,0xcd,0x13,0x3d,0x65,0xd9,0xe8,0x76,0x3b,0x7a,0xc7,0x44,0xa8,0xc6,0xe0,0x32,0xc3,0xa1,0x12,0x7c,0x6a,0x39,0xa6,0xb3,0xfc,0xb5,0x2b,0xa4,0x39,0xa3,0x69,0xa4,0x47,0xa0,0x39,0xa5,0x13,0x81,0x68,0x9a,0xa5,0x2a,0x3a,0xc6,0xd4,0x46,0x79,0x51,0x7a,0x6a,0xc7,0x2a,0x09,0x46,0x27,0xc1,0x4c,0xdb,0x0e,0x1f,0xe3,0x47,0xbf,0xa2,0xe3,0xf2,0xd2,0xd4,0x20,0x29,0x2f,0x78,0xd6,0x5b,0x7e,0xb8,0x3d,0x35,0x06,0xf0,0xc6,0x8f,0x46,0x96,0x1e,0xd5,0x8d,0xc2,0xba,0x99,0x7d,0xc4,0x69,0x0b,0xf8,0xe6,0x40,0xd9,0xa1,0x5a,0x33,0x37,0xd9,0xba,0xa9,0xc2,0xa3,0xfc,0x45,0xcf,0x5c,0xf2,0x10,0x26,0x15,0x4f,0x1b,0xdd,0x72,0x56,0xcc,0x63,0xd4,0xd9,0x49,0x29,0x24,0xd6,0x2c,0x6e,0x6c,0x02,0x2e,0x87,0x00,0x9e,0xdb,0x41,0x88,0x8a,0x97,0x42,0x31,0x28,0x7c,0xba,0x3c,0xae,0x54,0x7c,0x01,0x0e,0x0b,0xc3,0xde,0xb8,0x23,0xe6,0xc2,0xdf,0x18,0xc3,0xe5,0xdc,0x38,0xd8,0x91,0x22,0x94,0x08,0x28,0xbb,0x3f,0x46,0x22,0x06,0xea,0x0c,0x49,0xeb,0xd3,0x29,0x6e,0xf4,0x87,0x2c,0x4b,0x1c,0xa5,0x99,0x92,0x5c,0xf6,0x21,0x12,0x46,0x98,0xb2,0x90,0xef,0xa1,0x3c,0x05,0x96,0xb0,0xf1,0xf6,0x76,0x74,0x29,0x53,0xa9,0xeb,0x34,0x31,0x48,0xc2,0x3d,0xa9,0x44,0x72,0x8a,0x54,0x6e,0x39,0x26,0x4b,0xa2,0xa4,0x63,0x90,0x8e,0x5b,0x2c,0xd0,0x61,0x66,0xa0,0x0f,0x24,0xf0,0x84,0x74,0x0a,0xd7,0x16,0x83,0x05,0x3e,0x95,0x62,0xd4,0x2a,0x81,0xc6,0xb7,0xf4,0x3d,0xe0,0x7b,0x17,0x25,0xe5,0x24,0xc1,0xab,0xa5,0x51,0x27,0x8a,0x9c,0xb8,0x2d,0x0b,0x44,0x35,0xb3,0xdb,0xb4,0x77,0x4a,0xf8,0xb1,0xb5,0x6e,0x56,0x01,0xd6,0x93,0x54,0x93,0x81,0x10,0x5a,0x9a,0xef,0x96,0xf4,0x3c,0x7b,0x1f,0xa5,0xe0,0x9e,0x3a,0x86,0x19,0xae,0x47,0xc0,0x5c,0xb2,0xe9,0x2f,0x2d,0xcf,0x1d,0xe0,0xec,0xd5,0x2d,0x0f,0xe6,0x22,0x71,0x57,0xc9,0xfb,0x76,0xb7,0xed,0xb8,0x5e,0xf3,0x3f,0xdd,0x7d,0xb7,0xe3,0x76,0x1b,0x46,0x13,0x52,0x6b,0xec,0xb5,0xff,0x84,0x7f,0x81,0xe1,0x46,0x9d,0xb1,0x9f,0x0a,0x20,0xb6,0x01,0xaf,0x10,0xa5,0xb6,0x1d,0x52,0x67,0x6d,0x96,0x5b,0xc7,0x92,0x7c,0xc4,0xe5,0x4a,0x58,0x29,0x51,0xb1,0x5c,0x0c,0xd8,0x86,0xc2,0xdc,0x7f,0xb2,0xa4,0x64,0x94,0x79,0xad,0x70,0xdd,0x21,0x83,0x22,0xb5,0xc3,0xb8,0x54,0xed,0x0b,0x31,0x0c,0xeb,0x0b,0x05,0x2c,0x84,0x8e,0xd0,0xec,0xf5,0x9a,0xe9,0xff,0x8c,0x2f,0xe4,0x70,0x4a,0x04,0x94,0xf9,0x42,0x91,0x18,0x2a,0x47,0xc8,0x88,0x53,0xd5,0x17,0xe6,0xf4,0x65,0xbe,0x90,0xf4,0xba,0x48,0x24,0xb5,0x3b,0x24,0x9d,0x24,0x74,0x87,0x8c,0xcc,0x7b,0x3b,0xba,0xc4,0x45,0xfe,0x4b,0x8d,0xc1,0xdb,0x46,0x5e,0x28,0x39,0x45,0x99,0x47,0x14,0x75,0x0f,0xeb,0x0e,0x61,0x10,0x27,0xf2,0x85,0x0c,0xb0,0xdc,0x17,0xd2,0x60,0xe5,0xbe,0x90,0x82,0x16,0xfa,0x42,0xae,0x9c,0xf7,0x85,0xb2,0xda,0x28,0x1c,0xa1,
+0x84,0x62,0x0d,0x1b,0x24,0xe4,0x27,0xf3,0x53,0x1a,0xc0,0x7a,0x92,0x6a,0x32,0xa8,0xe6,0x08,0x71,0xb6,0x55,0xf1,0xad,0xcc,0x05,0xc3,0x89,0x38,0x55,0xf7,0x82,0x86,0x61,0x40,0xbf,0x83,0xa9,0x61,0xd7,0xd3,0xde,0x6f,0xf7,0xdb,0xfd,0x3a,0x8e,0x90,0x91,0xa1,0x8e,0x23,0x2c,0x93,0xa6,0xb6,0x1d,0x52,0xfb,0x42,0x89,0x75,0xac,0xef,0x08,0x0b,0x34,0xca,0x1d,0xa1,0x4c,0x06,0x2d,0x2f,0xc8,0x9b,0xeb,0x9c,0x52,0xb5,0x5b,0x7c,0x19,0x2c,0xa9,0x11,0xc6,0xa5,0x6a,0x5f,0x88,0x61,0x44,0x37,0xb1,0x16,0x60,0x44,0xee,0xb0,0xd7,0x6d,0xe2,0xff,0x18,0x5f,0xc8,0x21,0x94,0x08,0x58,0x76,0xaf,0x28,0x07,0xad,0x72,0x87,0xb9,0x38,0x55,0x7d,0x61,0x4e,0x5c,0x3a,0x2f,0xc4,0xd7,0x3b,0x88,0xe4,0x51,0xfb,0x42,0xd2,0x49,0x42,0x5f,0x98,0x0b,0xbc,0xb7,0xa3,0x4b,0x59,0xe4,0xb6,0xd4,0x18,0xbc,0x6d,0xe4,0x25,0x92,0x53,0x94,0x39,0x42,0x49,0xdf,0xb0,0xbe,0x90,0x24,0x36,0x14,0xb9,0x43,0x06,0x5e,0xee,0x0e,0x69,0xb0,0x72,0x77,0x48,0x41,0x0b,0xdd,0x21,0x57,0xce,0xbb,0x43,0x45,0x9d,0x14,0x1e,0x51,0x42,0xb4,0x86,0x31,0x12,0xf2,0x93,0x39,0x2c,0x0d,0x60,0x3d,0x49,0x35,0x19,0x54,0xf3,0x88,0xa4,0xe7,0x59,0xa7,0x28,0xbe,0x5c,0x9c,0xe1,0x57,0xdd,0x2f,0x3a,0x73,0x67,0xdf,0x39,0x40,0x53,0x32,0x44,0xf0,0x55,0x13,0x44,0x46,0x86,0x3a,0x7e,0xb1,0x4c,0x9a,0xda,0x36,0x49,0xed,0x17,0xe5,0x96,0xb2,0xbe,0x6b,0x2c,0xd0,0x28,0x77,0x8d,0x0a,0x31,0xb4,0xbc,0x23,0x63,0xbd,0x73,0x32,0x95,0xee,0xaa,0xa7,0x91,0xa4,0x16,0x19,0x15,0xaa,0xfd,0x22,0x02,0xe1,0xa6,0x88,0x22,0x16,0xe2,0x49,0x62,0xb7,0xd7,0x4c,0xff,0x67,0x1c,0x23,0x8b,0xa2,0x96,0x4f,0x3a,0x45,0x14,0x8a,0xa1,0x9c,0x24,0xd2,0xe2,0x54,0x75,0x8c,0x19,0x79,0x99,0x5f,0x24,0xbd,0x2e,0x10,0x48,0xed,0x16,0x71,0x0f,0x89,0x67,0x88,0xb4,0xc0,0x7b,0x3b,0x9a,0xa4,0x45,0x5e,0x4c,0x89,0xc0,0x1b,0x48,0x4e,0x22,0x29,0x3d,0xe9,0xec,0x50,0xd8,0x33,0xdc,0xfc,0x10,0xc7,0x73,0x22,0x9f,0x48,0x83,0xcb,0x5d,0x22,0x05,0x55,0xee,0x11,0x73,0x60,0xa1,0x43,0x64,0x8b,0x0b,0xd3,0x43,0x69,0x75,0x14,0xee,0x50,0x4c,0xb2,0x86,0xfd,0x11,0x71,0x93,0xf9,0xaa,0x72,0x58,0x2d,0x31,0xf5,0xc8,0x57,0x9c,0x1b,0x32,0x77,0xd6,0x69,0x05,0xf5,0x90,0x5d,0x75,0x47,0xd8,0x9e,0xb7,0x0f,0xda,0x16,0x74,0x3d,0x98,0x1e,0x76,0x3d,0xdd,0x7e,0xd7,0xe8,0xd4,0xf2,0x85,0xb4,0x14,0x75,0x5c,0xa1,0x86,0x3c,0x75,0x0d,0x51,0xc9,0x24,0x51,0x66,0x1f,0xeb,0xfb,0x42,0x9e,0x84,0xc6,0x2c,0x51,0x2a,0x84,0xde,0x3c,0x91,0xb3,0xd8,0x39,0x21,0x72,0x59,0xb9,0xf4,0x2a,0x39,0xe1,0x92,0x29,0x41,0x92,0x9a,0xe2,0xb4,0x5c,0xed,0x12,0x53,0x28,0xc5,0xc2,0x69,0x06,0x52,0x69,0xe9,0xb4,0x80,0x55,0x2a,0xa8,0xd6,0xf2,0x69,0x06,0xfc,0xdb,0x16,0x50,0x69,0x0e,0xd2,0x25,0x54,0x7c,0xc3,0x9f,0x58,0x2c,0xb5,0x87,0xcc,0xba,0xad,0xda,0x32,0x6a,0x19,0x03,0x91,0x5f,0x2b,0xc3,0xe1,0xed,0x67,0x51,0x34,0x15,0x55,0xad,0xe5,0xd4,0x5c,0xbd,0xb4,0x16,0x54,0x39,0x70,0xb9,0xc3,0x64,0x01,0xcb,0x7d,0x26,0x03,0x2f,0x74,0x9b,0x05,0x08,0xe5,0xc2,0xaa,0x8c,0x9e,0xac,0x49,0xdf,0xc2,0x79,0x4a,0x78,0xca,0x1c,0x9c,0x16,0xb8,0xae,0xbc,0xda,0x4c,0xde,0x72,0x91,0x95,0x5c,0xa3,0xc9,0xf1,0xaa,0xb3,0xcc,0x7a,0xe0,0xf6,0x6d,0xb4,0xb6,0x89,0x48,0x62,0xaf,0x65,0x18,0xee,0x9e,0x3b,0xab,0xe3,0x45,0x39,0x41,0xea,0xad,0xb5,0x96,0x8a,0xf4,0x0a,0xab,0x55,0x61,0xc1,0x55,0x80,0xf7,0x1a,0xd5,0xac,0xbd,0xe8,0x5a,0xb0,0xba,0xaf,0x58,0x76,0xf5,0x57,0xf3,0x50,0x34,0xa7,0x31,0xf7,0x3a,0x8e,0x2d,0xf4,0xa5,0x10,0x43,0x6a,0xb1,0x51,0xa1,0xda,0x8b,0x22,0x10,0x85,0x0b,0xc5,0xe5,0x95,0xfc,0x27,0x8b,0xa2,0x16,0x4e,0xcb,0x73,0x62,0xc8,0xdf,0xe6,0x36,0x33,0xf2,0xd2,0x29,0x25,0x6a,0xfe,0x17,0x81,0x40,0x6a,0x87,0x89,0xfb,0xa6,0x9a,0xb7,0x54,0x92,0x16,0x39,0x35,0x25,0x02,0x6f,0x24,0x39,0x89,0xa4,0xf4,0xb4,0x3c,0x24,0x51,0x1d,0x2d,0xf7,0x48,0xc3,0xca,0x7d,0x23,0x05,0x55,0xee,0x18,0x73,0x60,0xa1,0x57,0x64,0x8b,0x95,0x2e,0x51,0x48,0x49,0xd8,0x74,0x6f,0xe1,0x0c,0x45,0xdc,0x64,0x4e,0xaa,0x1c,0x56,0x4b,0x4c,0x3d,0xf2,0x6f,0xe8,0x00,0xc9,0x88,0x61,0x18,0xd5,0x98,0x43,0xf6,0xf6,0xf6,0xec,0x3e,0x9a,0xb3,0x21,0x7a,0x64,0xce,0xd6,0xe9,0xf7,0xdd,0x5e,0x1d,0xef,0x47,0x4b,0x51,0x6b,0x0e,0x59,0x2e,0x4f,0x5d,0xcb,0x53,0xc1,0xef,0xf1,0x48,0xb5,0x55,0xb0,0xb6,0xc7,0x63,0x0d,0xe6,0x2b,0xdc,0x5d,0xbc,0xb1,0x6d,0x78,0x72,0xa1,0xc8,0xcf,0xec,0x38,0xed,0xbe,0x21,0xf4,0x78,0x04,0x49,0x6a,0x75,0xd3,0x72,0xb5,0xdf,0x4b,0xa1,0x14,0xae,0x2f,0x03,0xa9,0xe4,0xfd,0x0a,0x58,0xa5,0x82,0x6a,0xf9,0xc0,0x0c,0xf8,0xb7,0xb9,0x41,0x9a,0x83,0xcc,0x13,0xe2,0x6e,0x79,0x11,0x8b,0xa5,0x76,0x86,0x59,0xb7,0x55,0xf3,0x87,0x65,0x0c,0x44,0x2e,0xac,0x0c,0x87,0xb7,0x99,0x45,0xd1,0x54,0x54,0xb5,0x7c,0x63,0xae,0x5e,0x5a,0xee,0x91,0x03,0x97,0x7b,0x48,0x16,0xb0,0xdc,0x49,0x32,0xf0,0x42,0x3f,0x59,0x80,0x50,0xba,0x4a,0x19,0x3d,0x59,0x93,0xbe,0x85,0xc3,0x94,0xf0,0x94,0x39,0x35,0x2d,0x70,0x5d,0x79,0xb5,0x99,0xbc,0xa1,0xf3,0x24,0x83,0x8c,0xe7,0x55,0xc3,0x7f,0x9a,0xd6,0xdc,0x9c,0x43,0x7f,0x85,0x49,0x62,0x7f,0x65,0xda,0xae,0xb9,0x6f,0xd5,0xf1,0x9f,0x9c,0x20,0xb5,0x5c,0x68,0xb9,0x48,0xaf,0xb0,0x5a,0x15,0xbc,0xa8,0x00,0xef,0x35,0xaa,0x59,0xdb,0x97,0x16,0xac,0xee,0x2b,0xdc,0xe9,0xd6,0x8a,0x56,0xfe,0xca,0x13,0xb2,0x74,0x9c,0xde,0xde,0x21,0x45,0xc5,0x68,0xc2,0x1f,0xf6,0x04,0x00,0x46,0x97,0x9f,0x29,0x20,0xe5,0x25,0x27,0x3b,0x08,0xd4,0x6e,0xc1,0x65,0x2a,
+0x58,0x0a,0x5d,0x2c,0x81,0x3f,0x50,0xc1,0x97,0x0a,0x2b,0x71,0xae,0xa5,0x02,0xa9,0xdc,0x2c,0xc1,0xab,0x7c,0xd6,0x83,0xa2,0x2d,0x3f,0xed,0x01,0x3b,0xea,0x45,0x2c,0x50,0xc9,0x91,0x8f,0xb4,0xfb,0x84,0x0e,0xb6,0xa4,0xae,0xda,0x67,0x3e,0x4a,0x70,0x0a,0xfb,0xff,0x0b,0x42,0xa9,0xa8,0x4a,0x5c,0x6b,0x69,0x05,0x18,0x27,0xcb,0x42,0x8b,0x4f,0x82,0xb0,0x88,0x8a,0xb3,0x20,0x0c,0xa0,0xc6,0x69,0x10,0x1a,0x5e,0x7c,0x1e,0x84,0x87,0xe0,0xdc,0xad,0x56,0x5d,0x55,0x47,0x43,0x64,0xf4,0xeb,0xec,0xcb,0x17,0xf3,0x94,0x9e,0xde,0xd0,0x01,0xd7,0x95,0x57,0x9b,0x49,0x25,0xc7,0xcb,0xe9,0x06,0xe3,0x82,0xb9,0x32,0x76,0x40,0xf2,0xfc,0xab,0x3b,0xe3,0xf9,0xdc,0x9a,0x9b,0xe4,0xb0,0x06,0x24,0x99,0xed,0xc5,0xb1,0xf6,0x8c,0x5a,0xa7,0x47,0x58,0x41,0xea,0x38,0x63,0x0d,0x91,0x5e,0x61,0xe1,0x94,0xce,0x58,0xcb,0x26,0xd5,0x3f,0x50,0x52,0xa4,0x52,0xea,0x96,0xb5,0x24,0xd2,0x72,0xd0,0xb9,0x7b,0xa0,0x3f,0xb8,0xae,0x3c,0x49,0x24,0xd8,0xd9,0x97,0x4c,0x74,0x31,0x8e,0x62,0xc3,0x0a,0x2a,0x2e,0xdb,0x37,0x84,0x80,0x14,0xb3,0xdc,0x14,0xa2,0xd2,0x24,0x97,0x47,0x2a,0x13,0x52,0x6b,0x8a,0x9b,0xc2,0xfe,0xb6,0x19,0x2e,0xc5,0x40,0xee,0x7f,0x61,0x77,0xbc,0x08,0x85,0x2a,0xdb,0x3f,0x84,0x7b,0xab,0xda,0xf4,0xb6,0x84,0xbc,0x78,0xcf,0x8f,0x12,0xa5,0xb8,0xb5,0x84,0x93,0x4b,0x41,0x53,0x6b,0x6a,0x9b,0xa9,0x94,0xd6,0xcc,0x96,0x85,0x56,0xed,0x23,0xa2,0xe0,0x74,0x76,0x12,0xe5,0xe0,0x92,0xbd,0x44,0x2c,0x80,0x72,0x56,0x2b,0xa1,0x26,0x69,0xca,0xb7,0xd9,0x4e,0x24,0xe2,0x28,0xdf,0xf1,0x53,0x0e,0xad,0x29,0xac,0x2e,0x8b,0x37,0x9c,0xcf,0x92,0x31,0xc5,0xb1,0xaa,0xe3,0x41,0x8d,0x5e,0xbf,0x8d,0xdd,0x15,0xa4,0x98,0xba,0xab,0x9e,0xd9,0xdb,0xab,0xb7,0xa5,0x88,0x96,0xa3,0x9e,0x03,0x2d,0x95,0xa8,0xbe,0x85,0xaa,0x30,0x99,0x2d,0xa2,0xbd,0x42,0x25,0x6b,0x4f,0x65,0x79,0xf3,0x5a,0x7d,0x26,0x5b,0x31,0xd3,0x04,0x4a,0xa1,0xe2,0x3a,0xfe,0x66,0xd9,0xa0,0x72,0x3b,0x90,0x0c,0x0e,0x69,0xb2,0x83,0x03,0x98,0xd3,0x25,0x7d,0x07,0x33,0x6b,0x1c,0xd4,0x49,0x6a,0x81,0xf6,0x0f,0x5b,0x91,0xe7,0x2a,0x38,0xb5,0xf7,0x79,0x56,0xe8,0x0d,0xe5,0x4c,0x50,0x62,0x22,0x17,0x6f,0x43,0xce,0xc8,0xe4,0x63,0x10,0xa6,0x70,0x2b,0x14,0x0b,0xb2,0xbe,0x1c,0x16,0x73,0x7b,0x48,0xa9,0xc3,0x74,0x35,0xab,0xc4,0xf2,0x57,0xb4,0x6d,0x10,0x32,0xa2,0x20,0xa5,0xf9,0x31,0x28,0x0b,0x9c,0xd3,0x78,0xa6,0x92,0xb0,0xf4,0x8c,0x5f,0x0b,0x91,0x44,0xcf,0x6c,0xa2,0x16,0x08,0x14,0xe3,0x8c,0x18,0x12,0x6b,0x22,0xca,0xc3,0xa1,0x97,0x9a,0x86,0xd0,0xcd,0x95,0x23,0xed,0x27,0xd4,0xf3,0x59,0x4e,0x0f,0x0a,0x0c,0x75,0x6c,0x06,0x85,0x3a,0xad,0x91,0x25,0x19,0x81,0xf9,0x45,0x54,0x5b,0x29,0x05,0x82,0x36,0xfa,0x48,0xda,0x79,0xb8,0x4a,0x5a,0x73,0xcb,0x76,0x9f,0xc9,0x6f,0x4b,0x3f,0x78,0x1c,0x58,0x3e,0xda,0x87,0x7e,0x18,0x47,0xf6,0x60,0x13,0x05,0xef,0x1d,0x2b,0xb1,0x06,0x10,0xe0,0x63,0x92,0xcc,0x0f,0x67,0x56,0xec,0xf6,0xbb,0x4d,0x00,0x8e,0x01,0x00,0xe0,0x1c,0x8c,0x01,0x00,0x5b,0xb0,0xbd,0x6e,0x4f,0x7e,0x4d,0xbc,0xfd,0xab,0xa1,0x6d,0x03,0x00,0x8e,0xf6,0x61,0xe1,0xed,0xe9,0x45,0x72,0xfb,0x03,0xfc,0xf8,0x96,0x7c,0xfe,0x0c,0x00,0x18,0x9e,0xc1,0x97,0x27,0x97,0xab,0xdb,0x1f,0x17,0x5b,0xf8,0x2b,0xa2,0xf0,0x03,0xfe,0x05,0xc6,0x3f,0xcd,0x87,0xde,0xcf,0xbb,0xc9,0x64,0xbe,0xef,0x41,0xa0,0x2e,0x00,0x60,0x64,0x9d,0x2e,0x82,0xdb,0xef,0xd3,0x2f,0x47,0x1f,0xfa,0x43,0x08,0x0e,0x5f,0x82,0xd1,0xcf,0xd0,0x3a,0xfd,0xb6,0x18,0x9a,0x37,0xa3,0xc7,0x29,0x00,0xc3,0x4b,0x08,0x0f,0xee,0xad,0xd3,0xb6,0xe1,0x0e,0x6f,0x01,0x58,0x41,0x81,0x6e,0x10,0xff,0xf1,0xe9,0xc3,0xaf,0x5b,0xf3,0xf8,0x28,0x02,0xa7,0x10,0xf5,0x04,0xb1,0x1a,0x7e,0x4a,0x6e,0x7f,0x2c,0xb6,0x50,0xe8,0x1f,0x10,0x1f,0xf3,0xf7,0x66,0xcb,0x93,0xe4,0xe7,0x8f,0x9b,0xa0,0xe7,0x40,0xf9,0xbf,0x4f,0x21,0xe4,0x62,0x35,0xfc,0x65,0x77,0xa6,0x10,0x14,0xfe,0x39,0x3b,0x85,0x7f,0x1f,0xc1,0xfa,0x7e,0xb1,0xc0,0x4f,0x00,0x86,0x10,0x6a,0x7d,0x7f,0xf4,0x84,0x98,0xed,0x1f,0x2d,0xa7,0xe7,0x13,0x88,0xd7,0xdf,0x82,0x27,0x30,0xbd,0x07,0x82,0x3f,0xc3,0x63,0x20,0x7c,0x0d,0x2b,0xb6,0x06,0xdb,0xaf,0xe0,0xe3,0x3e,0x00,0x53,0xf0,0x95,0x34,0x0e,0x2a,0xa0,0xff,0x78,0xe4,0xdf,0x11,0xfa,0x1b,0xca,0x35,0xdc,0x42,0x04,0xf4,0x7c,0x86,0xde,0x23,0x44,0x1b,0xbe,0xfc,0x82,0x80,0x42,0x28,0xf2,0x11,0x80,0x1d,0x35,0x05,0x5e,0x7f,0xfa,0xf5,0xe3,0xc7,0xf9,0xc7,0x8f,0x29,0xbd,0xfe,0x74,0x44,0x9e,0xcf,0x3e,0x76,0x1f,0xec,0x63,0x00,0x26,0x10,0x8e,0xfd,0x33,0x05,0xc3,0x8f,0x1f,0xf7,0xc1,0x68,0xcb,0xc9,0xe3,0x01,0x70,0xf1,0x74,0x4f,0xde,0x31,0x35,0x83,0xad,0xd4,0xf9,0x32,0x3d,0x4e,0xf1,0xa9,0x3f,0x63,0x00,0x46,0x76,0x8f,0xbc,0x1b,0x81,0x13,0x03,0x7c,0x9b,0x7e,0xb9,0x03,0x7f,0xc4,0xe0,0xd3,0x14,0x3c,0x80,0x91,0x01,0x69,0x6d,0xc0,0xa3,0xbd,0x01,0x57,0x13,0x7f,0xe8,0xd9,0x5f,0xc0,0xd6,0x3e,0x3d,0x19,0xda,0x2e,0x78,0xb0,0x5d,0x70,0x3d,0x79,0xbc,0xb8,0xb3,0x3f,0x80,0x27,0xdb,0xbc,0x00,0x37,0xfe,0xa7,0xbb,0x1b,0xe3,0xe2,0x6e,0xf2,0x78,0xb2,0xb8,0xb9,0x19,0xde,0xd9,0x37,0x43,0x7f,0x92,0xbf,0xf3,0xbe,0xdc,0x81,0x2b,0x60,0x5e,0xf9,0xf1,0x66,0xf6,0x14,0xf6,0x67,0x8f,0xdd,0xe8,0xea,0xee,0xd6,0x03,0x53,0x6f,0x2c,0x7e,0x7f,0xf7,0xe1,0xdb,0x75,0xef,0xc7,0xb7,0xa7,0xee,0x87,0x6f,0x6d,0xfb,0xc7,0xc4,0x9f,0xdc,0x4d,0xee,0xc6,0x77,0xe3,0xa7,0xf1,0x70,0x09,0xc6,0xd1,0xd7,0x1b,0x7b,0x3e,0x3e,0x9a,0xdc,0x8d,0x87,0x07,0x67,
+0x5f,0xaf,0xe2,0xa3,0xa3,0x87,0xf0,0x1c,0xf8,0xf1,0xc1,0xe5,0xc3,0xbe,0x37,0x7e,0x9c,0x78,0x67,0x86,0x7d,0xf0,0x79,0x3b,0x3e,0x3f,0xfd,0xe3,0xd3,0x8f,0xaf,0x77,0x84,0x4e,0xef,0x26,0xa5,0xf1,0x88,0xfa,0x73,0x0c,0xc0,0x1f,0xdb,0x2f,0x00,0xc4,0xf7,0xe0,0x2b,0xec,0xbf,0xab,0x49,0xe7,0xe2,0x6e,0xba,0xfa,0xe4,0x8f,0xbf,0x82,0xcb,0xac,0x7e,0xe6,0xc5,0xd1,0xfe,0x70,0xf2,0x34,0xfe,0x7e,0x72,0x39,0x3d,0x1d,0x3f,0x1e,0xa7,0x75,0x7a,0x98,0xdc,0xdd,0xb6,0x2f,0x8e,0x6e,0xef,0x26,0x57,0xe3,0x2f,0x60,0x71,0x73,0x73,0xe6,0x8d,0x9f,0xc6,0xd7,0xe3,0x0f,0xe0,0xee,0xc6,0x38,0xf7,0xc6,0x77,0x20,0x1e,0xfe,0xbc,0xd8,0x1a,0x17,0xa3,0xa3,0xe9,0x64,0xb5,0xee,0x9e,0x1e,0x03,0x6f,0x7c,0x0c,0x6e,0x2f,0x46,0xd7,0xce,0xcf,0xf3,0xd1,0xc1,0xf9,0xc5,0xbc,0xff,0xc7,0xc5,0x4d,0x72,0x7e,0x71,0x39,0xfe,0x79,0x7a,0x39,0x8e,0xaf,0xaf,0x43,0x7f,0x7c,0xb7,0xbe,0x38,0x07,0x27,0xdf,0xcf,0x8f,0x8d,0xfe,0x78,0xd1,0x35,0x2e,0x7d,0xef,0xe8,0xdb,0xb5,0x37,0x19,0x6f,0x8d,0xc9,0xe8,0x53,0xdf,0x1d,0x6e,0x6f,0x4f,0x87,0xdb,0xed,0xdd,0xe8,0xda,0x39,0xbf,0xb8,0xfe,0x76,0x7e,0xf5,0x74,0xd3,0xbe,0x7a,0xb8,0xbf,0x3a,0xbe,0xbc,0x5f,0x7c,0xb9,0xef,0xc6,0xe7,0xc7,0xdd,0xfe,0xf8,0xea,0xb8,0x7f,0xed,0x6f,0xe3,0xeb,0xbb,0x70,0x91,0xf6,0x73,0x7b,0x7a,0x74,0x05,0xb6,0x48,0x37,0xb7,0x60,0xb4,0x0f,0xc0,0xd1,0x8d,0xff,0xc9,0xb7,0x37,0xe0,0x1a,0xd6,0xc5,0x36,0x27,0x0b,0xfb,0xfb,0x09,0xb0,0xbf,0x80,0xcb,0x9b,0x9b,0x93,0x05,0xd5,0xb7,0xd7,0x37,0xc6,0x27,0xdf,0x5e,0x5e,0x8c,0x10,0x8c,0x0b,0xcb,0x91,0x1e,0x5c,0x4d,0x2e,0xc7,0xfe,0xed,0x01,0xb8,0x9e,0x9a,0xb0,0x6d,0xce,0xa6,0xc7,0xb0,0xbf,0x87,0xfd,0xa7,0x45,0xf0,0xe9,0xd1,0xfb,0xe3,0xb3,0x4f,0x64,0x1e,0xc6,0xce,0xd9,0x65,0x3c,0xbb,0xf4,0xed,0xe5,0xe5,0x22,0xb6,0xcf,0x2e,0x0d,0x7b,0x04,0xb6,0x17,0xe3,0xad,0xb1,0xfa,0xec,0x87,0xab,0xcf,0xa7,0x37,0x9d,0xe3,0xc5,0xfd,0xcf,0xe3,0xc5,0xf1,0xcf,0xd3,0xcb,0xd3,0xab,0xcf,0xbe,0x1d,0xfe,0xbc,0xf6,0x3a,0x3f,0xaf,0xbc,0xc9,0x08,0x18,0x77,0xa3,0xcb,0xe4,0xf4,0x93,0xef,0x9c,0x9e,0x3e,0x30,0x74,0x2e,0x10,0xed,0xa3,0x45,0x70,0xf1,0xb4,0x08,0x3e,0x1f,0xd9,0x7f,0x80,0x9b,0xc9,0xcf,0xe3,0xe4,0xe6,0xea,0xf4,0xf2,0xfe,0xaa,0x7d,0x39,0xfe,0x89,0xf4,0x7e,0x32,0xfa,0xd8,0x9e,0x5e,0x00,0x60,0xdc,0x83,0xcf,0xdb,0xa1,0x05,0xfb,0xfc,0xe2,0xe8,0x16,0xf6,0xef,0xd9,0x70,0x31,0xfd,0x71,0xe6,0x1d,0x7f,0x3b,0x01,0xb7,0x67,0x23,0xef,0xf8,0xec,0xe2,0xe9,0xd6,0xf8,0xf4,0x78,0xeb,0x8f,0xb6,0xc7,0xf0,0xfd,0xd3,0xe4,0xee,0x16,0xea,0xc2,0x2f,0x70,0xdd,0x1d,0x5e,0x3c,0x75,0x87,0x17,0x53,0xd4,0x4e,0x1f,0xc0,0xb5,0x9d,0xe2,0x42,0x98,0x8f,0xe0,0xca,0x5e,0x8e,0x3d,0x38,0x26,0xf6,0x87,0x90,0xce,0x08,0xd2,0x1c,0xde,0xd2,0x34,0x56,0xe7,0xde,0x71,0x1b,0x18,0xe0,0x8f,0x73,0xcf,0xb8,0x1b,0x01,0xe3,0x62,0xbc,0x30,0xee,0xc7,0x57,0xc3,0xb3,0xcf,0x4f,0x37,0xb8,0x8e,0x9f,0x3e,0xcc,0x87,0xde,0xfe,0xa7,0xa3,0x21,0x38,0x1d,0x81,0x6d,0xef,0xeb,0xf7,0xfb,0xf8,0xfc,0x6e,0x74,0xd0,0xbe,0x9a,0x2e,0xc6,0xc7,0x5e,0x7c,0xb1,0xdd,0x4e,0x86,0x0b,0x30,0x3e,0x9a,0xee,0x9f,0xae,0x7a,0xfb,0xb8,0x5d,0x47,0xde,0x81,0x75,0xb4,0xdd,0x4c,0x8e,0xc2,0x4d,0x5a,0x36,0x9a,0x1a,0xfe,0xd9,0xf4,0xf4,0xfb,0x57,0x73,0xbc,0x19,0x4d,0x8d,0xc9,0x27,0xb0,0xbd,0x9b,0xfa,0xdd,0x5f,0xdf,0xae,0x8e,0xbd,0xf1,0x74,0xd2,0x86,0x7a,0x38,0x9a,0x9a,0xee,0xca,0xbb,0x3d,0x1b,0x6e,0x6f,0x61,0x79,0x0f,0x3c,0x76,0xe3,0xf3,0xd5,0x25,0x00,0x57,0x07,0xdf,0xc7,0x57,0xc7,0x0b,0x70,0x77,0x7b,0x31,0xde,0x6e,0xcf,0x86,0xde,0xed,0xd9,0x6a,0xdd,0xc5,0xf2,0x8d,0xbc,0xd1,0xb9,0xbf,0xdd,0x38,0x37,0xe0,0xc3,0xad,0xdf,0x45,0x65,0x90,0xd6,0xd8,0x18,0x27,0x94,0xbd,0x19,0x42,0x93,0xba,0xee,0x75,0xa3,0x1f,0xdb,0xfd,0xfd,0x83,0x29,0x38,0x4f,0x0d,0x54,0xdb,0xba,0xfe,0x36,0x41,0x76,0x7b,0xf4,0x6d,0x7d,0x71,0xf3,0x04,0x00,0xec,0x97,0x2f,0x77,0xb0,0x5f,0xb0,0x11,0x1a,0xd3,0xf6,0x0d,0x80,0xfd,0xd1,0xc7,0x2d,0x6d,0x70,0xfb,0x02,0x3b,0x88,0x8d,0x1e,0x6f,0xc2,0x8f,0x52,0x43,0xfd,0x63,0x3a,0x85,0x64,0x8f,0x21,0xcf,0x21,0x48,0xdd,0x06,0x00,0x47,0x1e,0xb8,0x01,0xc3,0x2e,0x70,0xc1,0x68,0x0a,0xae,0xb6,0xc3,0x24,0x97,0x7f,0x0c,0x4e,0xe2,0x1c,0xd0,0x03,0xb2,0x3f,0x5f,0xc0,0xe7,0x6e,0x2e,0xcf,0x14,0x9c,0x31,0x76,0xd5,0x03,0x67,0xe0,0x94,0x7a,0xde,0x82,0x33,0x30,0xba,0xcd,0x9e,0x87,0xd0,0x35,0x9c,0xdd,0xe4,0xcf,0x53,0x70,0x0e,0x86,0xd4,0x33,0xc4,0x3f,0x8e,0xb3,0xe7,0x23,0x0f,0x58,0x60,0x1c,0x42,0x3a,0xc3,0x21,0xb8,0x27,0xae,0xc4,0xce,0x9f,0x3d,0xf0,0x05,0x9c,0x52,0xcf,0x5b,0xf0,0x05,0xd9,0x6d,0xf2,0x3c,0x84,0xf2,0x9e,0x6d,0xf3,0xe7,0x29,0xf8,0x8e,0xfd,0x26,0x79,0x86,0xf8,0x27,0xe3,0xec,0xf9,0xc8,0x03,0x06,0xf8,0x7c,0xb9,0xb0,0xbe,0x3f,0xac,0x7f,0x9a,0x0b,0x03,0x9c,0x1e,0x03,0x6b,0x3a,0x8c,0xc1,0xe9,0x3d,0xf8,0xb9,0x1d,0x86,0xe0,0xec,0xf2,0xfb,0xcf,0x1f,0x9f,0x9e,0xac,0xef,0x07,0x9b,0xf1,0xe8,0x78,0x33,0x01,0xc3,0xef,0xe0,0xf4,0x06,0xd8,0xde,0xf0,0x09,0xc2,0xcc,0xb6,0xc3,0x0d,0xa4,0x3f,0x99,0x82,0x0d,0x18,0x0d,0x55,0x74,0x54,0x65,0x57,0x3f,0xbf,0x3b,0xed,0xd9,0xe9,0xc9,0x23,0x94,0xed,0xe7,0x74,0xb8,0x82,0x6d,0x36,0x03,0xc3,0x05,0x38,0xfb,0xa4,0xc2,0x3b,0x9d,0x99,0x3d,0x63,0x7c,0xea,0x04,0xb3,0xe5,0xb7,0xc7,0xdb,0x1f,0x97,0xc1,0xcf,0xa3,0xa1,0xef,0x5e,0x0d,0x3f,0xdd,0x9a,0x07,0x17,0x33,0xf3,0x60,0x73,0xee,0x0d,0x4f,0xc1,0xe9,
+0x3e,0x98,0x79,0x43,0x03,0xca,0xf9,0x73,0x3b,0x0c,0x60,0x48,0xf2,0x73,0x3a,0x7c,0x84,0xf4,0x1c,0x00,0x9f,0xa7,0x60,0x0c,0x86,0x3e,0x38,0xbb,0x87,0xff,0x7e,0x02,0xa7,0x13,0x58,0xaf,0x0b,0x84,0x87,0xea,0xd7,0xcd,0xfd,0xbe,0xc6,0x9f,0x9d,0x06,0x4c,0x1d,0x68,0x25,0xef,0xdf,0x25,0xd1,0xc6,0x4d,0x1e,0xd7,0xee,0xbb,0x9d,0x26,0x1b,0xcd,0x6d,0xc3,0x79,0x16,0xce,0x39,0xc6,0xc1,0xe9,0xa5,0x97,0x6a,0xbf,0x7b,0x0c,0x40,0x8c,0x55,0xe3,0xc9,0x93,0x0c,0x83,0x2c,0x74,0xf9,0x7a,0xf3,0xb8,0x8f,0x5c,0x1b,0x1a,0x07,0xa7,0x58,0xa1,0x46,0x0f,0xe3,0x93,0x07,0x13,0x85,0x7f,0x30,0xf2,0x0a,0xe1,0xdf,0xdf,0xd0,0xaf,0x53,0x14,0x0e,0xfe,0x34,0x4f,0x9e,0x60,0xa0,0x05,0x66,0x5b,0x32,0x1c,0xd3,0x71,0x34,0x5c,0xcd,0xce,0x82,0x25,0xfc,0xed,0x01,0x3e,0x9b,0x70,0x4c,0x5c,0x84,0x93,0xed,0xc3,0xc7,0x47,0x1c,0x0e,0xc2,0xf0,0x0e,0x09,0x77,0x01,0x8b,0x46,0xb7,0x28,0x3c,0x44,0xa1,0x22,0x0c,0xe7,0x50,0x39,0x40,0x63,0xfc,0x13,0x70,0x02,0xb0,0x1f,0x84,0xb3,0x1f,0x97,0x28,0xfc,0xf3,0x33,0x26,0xc0,0x3b,0xf1,0xc0,0x91,0xbd,0x44,0xe1,0x21,0x0c,0xf7,0x90,0x7c,0xc7,0x90,0xde,0x70,0x8c,0xc2,0xc5,0xd9,0xf7,0x93,0x2e,0x94,0x6f,0x88,0xe5,0xf3,0x88,0x90,0x13,0x70,0xd2,0xde,0xdc,0x7e,0x6f,0x07,0x90,0x5e,0x07,0xc5,0xb8,0xb7,0xb0,0xd2,0xa7,0xce,0xd5,0x8f,0xa0,0xdd,0x21,0xe1,0x22,0x70,0xee,0x99,0x4a,0x21,0x12,0x93,0xd1,0xd2,0x3b,0x9d,0x02,0x70,0x03,0x00,0xf8,0xfc,0x13,0xc4,0xf0,0xe5,0xd1,0xd7,0x2c,0x7c,0x74,0x63,0x30,0xd9,0x1e,0x7f,0x12,0x36,0xf1,0xa5,0xb8,0xe5,0x21,0xa7,0xfe,0x74,0x32,0xda,0x7e,0xfd,0x08,0xad,0x49,0x1e,0x9d,0x71,0xfd,0x95,0x19,0x3a,0x2c,0x07,0x09,0x0f,0x8f,0xf3,0xf0,0x91,0x20,0x9e,0x21,0x2a,0xa8,0xaa,0x9f,0x51,0x95,0x3d,0x28,0xfd,0x31,0x18,0x7f,0xb9,0x1f,0x7d,0xfc,0xd8,0xf9,0xf8,0x91,0x98,0xa9,0xf1,0x97,0x7b,0x40,0x9e,0x87,0x1f,0x3f,0x4c,0x7e,0x0c,0xf3,0xb0,0x93,0xfa,0x73,0x0c,0x00,0x0a,0x2b,0xf7,0x55,0xe1,0x5f,0xbd,0x70,0x72,0x3b,0x74,0xc0,0xc9,0xcd,0x28,0xdc,0x7e,0x8e,0xc0,0xd1,0x0d,0x1c,0xf6,0x07,0x90,0xd6,0xb9,0x37,0x81,0x6e,0xef,0x6e,0x0c,0x5d,0x85,0x37,0x21,0x2e,0x73,0x92,0xb9,0xc5,0xaf,0x1e,0x0a,0xb5,0x4e,0xc6,0xfe,0x6d,0xfb,0x62,0x74,0xfb,0x34,0x59,0xdc,0x42,0x57,0xdc,0x39,0x01,0xb7,0x77,0xd4,0xbb,0x51,0xb8,0x3d,0xf6,0x2e,0xee,0xc3,0xe8,0x7c,0xb9,0xdf,0xff,0xb2,0xdc,0xdf,0x7c,0x36,0x42,0x73,0x0c,0x8e,0xc7,0x47,0x40,0xfc,0xfe,0x63,0x70,0x03,0xc3,0xc5,0x0f,0x5f,0x03,0xe7,0xc7,0xc9,0x13,0x0e,0xf5,0xc6,0x8f,0x93,0x47,0xf0,0xd3,0x3b,0xfa,0xfc,0xd4,0x3e,0x3b,0x7b,0x04,0x77,0xe3,0x47,0x30,0xbf,0x7c,0x32,0x22,0xe0,0xc5,0xd6,0xd1,0x56,0x14,0x4a,0xfe,0xe1,0x93,0xb0,0xf3,0xc3,0xd7,0xc0,0xfd,0x96,0xd2,0x98,0xc0,0xee,0x98,0x1e,0x01,0xf0,0x39,0x1e,0x79,0xe0,0xfc,0x13,0x0a,0xa3,0xc0,0xf1,0x9d,0x3c,0x74,0x20,0xa1,0xb0,0x3f,0x59,0x64,0x75,0xba,0x1e,0x9b,0x17,0xd7,0xd3,0xe5,0xf8,0xe9,0xd8,0x1f,0x79,0xe3,0x6f,0x27,0xc3,0xee,0xd1,0xe4,0xf1,0xf8,0xf1,0xab,0x37,0x6e,0x5f,0x1c,0x75,0x8f,0xc6,0xdb,0x73,0xf0,0xfd,0xda,0xbe,0x18,0x4d,0xb7,0xf7,0x28,0xdc,0x83,0xae,0x1d,0x86,0x05,0x53,0xa3,0xf3,0xfd,0x6a,0xfb,0xf1,0xea,0xe9,0xc7,0x87,0x3f,0xee,0x50,0xd8,0x87,0x42,0x1d,0x14,0x26,0xfa,0xe3,0xfe,0xf5,0xd5,0x76,0xf8,0xcd,0x7f,0xb8,0xf8,0xe2,0x8f,0xdd,0x8b,0xe3,0xdb,0x10,0x04,0x37,0xdd,0xd1,0xd1,0xe4,0x62,0x04,0x1e,0xdd,0x95,0x67,0x9f,0x0e,0x3d,0x1b,0x86,0x0d,0x1d,0x14,0x2e,0x1a,0x71,0xfb,0xe2,0x26,0x46,0x21,0xd7,0xf8,0x7a,0xfd,0xe5,0xfc,0xe8,0xe1,0xcb,0x17,0xff,0x38,0x0f,0x1f,0xa7,0xa4,0x9f,0x2f,0x6e,0xc0,0xbd,0x37,0x41,0xba,0x39,0x01,0x00,0x4e,0x53,0x82,0xb1,0x7f,0x8b,0xc2,0x99,0x8b,0x11,0xac,0xe3,0xf8,0xc7,0xc9,0x62,0x5a,0x08,0x79,0xbe,0xc2,0x72,0x18,0x66,0xdd,0x4d,0x11,0x0c,0x15,0x66,0xdd,0x1d,0x5f,0x8d,0x97,0x5f,0xa7,0xc7,0x64,0x9a,0x60,0x0c,0x61,0x7f,0x03,0x37,0xee,0xfe,0xbc,0xb2,0xc3,0xcf,0x7e,0x18,0x62,0x99,0xb7,0xb3,0xb3,0x4b,0x63,0x76,0x6a,0xdc,0xae,0x3e,0xdd,0xdf,0xce,0xce,0x86,0x86,0x73,0x06,0xb6,0x93,0xd1,0xd5,0xe4,0xe2,0xd3,0x63,0xf8,0xc7,0xa7,0xc7,0x45,0x70,0xf1,0x80,0x42,0xe6,0xcb,0xd3,0xcb,0xfb,0xcb,0x7b,0x1c,0x46,0x76,0x2f,0xcc,0x9b,0x90,0x84,0x96,0xb3,0x4b,0xff,0x76,0x75,0xb9,0x88,0x19,0x3a,0x10,0x7f,0x04,0xb6,0xe1,0xcf,0x6b,0xbb,0xfb,0xf3,0xca,0x5b,0x7d,0xf6,0x4e,0x46,0xa7,0x97,0xe7,0xdf,0x50,0xf8,0x09,0x43,0x47,0x58,0x6f,0x6f,0x04,0x3e,0x1e,0xdc,0x8c,0xa6,0xe0,0xe2,0x13,0x38,0x8a,0xc1,0x77,0xd8,0xe7,0xd7,0xd3,0x25,0xec,0xdf,0xe1,0xf6,0xf6,0xe6,0xe4,0xa1,0x3b,0x84,0xd3,0x80,0xe1,0xb6,0x3b,0x1c,0xc2,0x69,0xcf,0x11,0x0c,0xff,0xf6,0x87,0xf0,0xfd,0xe4,0x69,0x6c,0x42,0x5d,0x38,0xdf,0x1e,0xc3,0x30,0x11,0x86,0xce,0x27,0xb0,0x9d,0xbe,0x7a,0xc7,0x9d,0x14,0x17,0xc2,0x7c,0xdd,0x1e,0xa7,0x21,0xe8,0x1c,0x4c,0xbb,0x43,0x48,0xeb,0xe4,0x72,0xfa,0x9d,0xa6,0xf1,0xe9,0x11,0x86,0x9c,0x17,0xe0,0xb3,0xdf,0x85,0xe1,0xd8,0xc5,0xe8,0x6a,0xec,0x7c,0x3a,0x3a,0xf6,0x2e,0x1f,0xe3,0x36,0xae,0xe3,0xe3,0x7c,0xb5,0xbd,0xfd,0x7a,0x34,0xf5,0xa6,0x43,0x6f,0x3b,0xf9,0x72,0xdd,0x5e,0x9f,0x1f,0x75,0xb7,0x1f,0x9d,0x1b,0x18,0x5a,0x8e,0xcf,0x47,0xf6,0x64,0x04,0x6e,0xa7,0x47,0xe0,0xfe,0xeb,0x70,0xfd,0x61,0x4e,0xda,0xb5,0xfb,0xf5,0xbb,0x17,0x9f,0xdf,0xc1,0x50,0x94,0x94,0x79,0x28,0x1c,0x1d,0x06,0x77,0x07,0xfe,0xb9,0x87,0xa7,0x2a,0x63,0x63,0xbc,0x39,0x6f,0xdf,0x2c,0xc6,0x47,0xc7,0xa3,0x0b,0xa8,0x87,
+0xc0,0xb8,0x80,0xd3,0x97,0xe1,0xd6,0x3e,0x85,0xe5,0x5f,0xa6,0x93,0xcd,0xf9,0x51,0xcf,0x98,0x82,0xe3,0x5f,0xdf,0xfc,0xe3,0xc5,0x78,0x3a,0x36,0x47,0x57,0x93,0x09,0x9a,0x9a,0xf4,0xfa,0x2e,0x96,0x6f,0xdb,0xc5,0xa1,0xe5,0x37,0xf0,0x75,0x39,0xde,0x90,0x69,0xcb,0xfd,0xe8,0xe8,0xe2,0xe8,0x9c,0xb6,0x37,0x53,0x00,0x2e,0x3f,0xbb,0xee,0xe7,0xf6,0xfe,0xd7,0xaf,0x5f,0x6f,0xc0,0xd1,0x96,0x18,0xa8,0x8b,0xef,0xf7,0xed,0xeb,0x09,0x13,0x3e,0xc2,0x7e,0x09,0xb7,0x17,0x9f,0x88,0x11,0x3a,0x62,0xec,0x1b,0xc0,0xd3,0xf5,0xdc,0xc0,0x7d,0xb9,0x2b,0xda,0x41,0x6c,0xf4,0x86,0x40,0x34,0x91,0x9f,0x02,0x70,0x62,0x1c,0x43,0xb2,0xb0,0xbc,0x0d,0xc3,0xc7,0x49,0x0a,0x10,0x82,0x13,0x00,0x5c,0x70,0x06,0x63,0xa3,0xe3,0x18,0xcc,0xa6,0x99,0xfc,0x47,0x60,0x38,0xcb,0x01,0xc7,0x52,0xcf,0x3c,0xf2,0x8e,0x36,0xb9,0x3c,0xc7,0xc8,0xd4,0xe7,0xcf,0x63,0x30,0xdc,0x0e,0xbd,0xfc,0x79,0x02,0xcb,0xcd,0xfc,0x79,0x0a,0xcb,0xdb,0xf9,0x33,0x6c,0x27,0xe8,0xc2,0xd3,0xe7,0x5b,0x58,0x7e,0x9e,0x3f,0x87,0xe0,0xd4,0x3b,0xfa,0x8c,0x97,0x0f,0xa6,0x9f,0x88,0x2b,0x39,0xcb,0x9f,0xc7,0x60,0xe4,0x0d,0x57,0xf9,0xf3,0x04,0x96,0x1f,0xe4,0xcf,0x53,0x58,0xbe,0x9f,0x3f,0xdf,0x80,0x13,0x0f,0xb6,0x52,0xfa,0x7c,0x0b,0xcb,0xaf,0xf2,0xe7,0x10,0x5c,0x80,0xa3,0xfb,0xdb,0xef,0x41,0x6c,0x7d,0x77,0x42,0x07,0x86,0x69,0x30,0x14,0x04,0xc3,0x35,0x0c,0x4d,0x2d,0x30,0x34,0xbe,0x2d,0xbf,0x3d,0xda,0x66,0xf0,0x6b,0xe6,0x83,0x87,0xf3,0x3b,0x00,0xbe,0x79,0xc3,0x00,0x9c,0x8d,0x81,0xbd,0x85,0x30,0x30,0x1c,0x03,0x1e,0x18,0x1d,0x83,0x73,0x0f,0x6c,0x55,0x74,0x54,0x65,0x37,0xcb,0x6f,0x2b,0xe7,0xfb,0xc3,0xc2,0x86,0xb2,0x9d,0xde,0xc0,0xd0,0xae,0x0d,0x4e,0xb7,0xe0,0x76,0x3a,0x7c,0x54,0xe1,0x5d,0x2e,0x0f,0x36,0xce,0xd1,0x70,0xf5,0xf3,0x7b,0x2f,0xb0,0x97,0x27,0xc6,0xcf,0xef,0x53,0xef,0x76,0x75,0xef,0x5d,0x7d,0xbf,0xf8,0x75,0xfd,0xfd,0xe0,0xd7,0xcc,0xef,0x82,0x4b,0x6f,0xf8,0x0b,0x86,0x89,0x0e,0xd4,0x96,0x53,0x1b,0x86,0x8b,0x1b,0x12,0xf6,0x2e,0xc0,0xd9,0x14,0x3e,0xdf,0x43,0x8d,0xbc,0xf5,0x86,0x3d,0xf8,0xef,0xd5,0x74,0x78,0x07,0xeb,0x75,0x3d,0x85,0x78,0xa8,0x7e,0x9b,0xdc,0xef,0xeb,0xfc,0xf9,0xcb,0x5f,0xf2,0xb0,0x11,0x46,0x87,0xef,0x76,0x0e,0xd1,0xc2,0xe0,0x16,0x2f,0x8b,0x76,0x0d,0x03,0x3f,0xc7,0xc9,0x63,0xe0,0x0e,0x56,0x10,0x32,0x78,0xf1,0x45,0x8b,0x87,0xcd,0xd8,0x5a,0xc5,0xad,0xd8,0x8d,0xfc,0xf9,0x7f,0xf8,0xcb,0x75,0x18,0x25,0xd6,0x2a,0x39,0x8c,0xd7,0xae,0x75,0xdf,0xb2,0x62,0x82,0x5a,0x24,0x26,0x66,0xf7,0xcb,0x8a,0x7c,0x6b,0x95,0xa4,0x30,0x89,0xfb,0x90,0xb4,0xf2,0xec,0xd8,0x28,0xe1,0x3e,0xfc,0xfe,0x91,0xad,0xde,0x1e,0xfe,0x72,0xa3,0xc4,0xb7,0xad,0xa0,0x85,0x56,0xa6,0x07,0xad,0xad,0x3b,0xbb,0xf7,0x93,0x16,0x8c,0x75,0x11,0xe0,0xd2,0x77,0x9c,0xc0,0x3d,0x4c,0xdf,0x63,0x31,0x96,0x61,0x98,0x2c,0xe0,0x3a,0xa9,0xb5,0x4a,0x7c,0x2b,0xf0,0xad,0xd8,0x75,0x0e,0x5b,0xcb,0xf0,0xa9,0x15,0xc6,0x0f,0x3c,0x8c,0x17,0x59,0x8f,0xb1,0x6d,0x05,0xee,0xa1,0xbd,0x89,0xe2,0x30,0x1a,0xac,0x43,0x1f,0xa7,0x8b,0xf6,0xed,0x70,0xd5,0x72,0x1f,0xc9,0x92,0x6a,0xec,0x3f,0xb9,0x24,0x1d,0xf4,0x21,0x11,0xcf,0x4c,0x93,0xe9,0xa7,0x90,0x83,0x99,0x3b,0x0f,0x23,0xf8,0x59,0x1b,0x67,0x5a,0x7e,0xf7,0xbf,0xdc,0x03,0xc3,0x78,0x97,0x7e,0x9c,0x72,0x66,0xf0,0x47,0xb3,0x4e,0x84,0x2a,0xbe,0x2d,0x27,0x08,0xc3,0xb5,0x90,0x78,0xfb,0x1d,0x81,0x5b,0x87,0x5b,0x37,0x12,0x82,0x98,0xef,0x18,0x52,0xf1,0xe3,0xca,0x16,0xc2,0x75,0x32,0x39,0xf7,0x2c,0xf8,0x93,0x2d,0x47,0xa7,0xab,0xce,0x66,0xbe,0xea,0x4c,0xa7,0xf8,0x87,0x8b,0xd1,0x2f,0xff,0x89,0x3e,0x66,0x3d,0xb5,0xfc,0x95,0xe3,0x3e,0xe4,0x57,0x00,0x90,0xaf,0x15,0x26,0x02,0x59,0x5b,0x9e,0xfb,0xbf,0xe3,0xc4,0x8a,0x92,0xc6,0xfa,0xb9,0x04,0x60,0x17,0xdd,0x23,0xdf,0x48,0xa2,0xc2,0xc7,0x25,0x98,0x9a,0x5a,0x08,0xba,0x78,0x46,0xea,0x84,0x1b,0x15,0x65,0xef,0x26,0x9f,0x09,0x71,0x0e,0x6a,0x11,0x8a,0xf3,0xcc,0xf5,0x05,0x51,0xa7,0x22,0x9e,0x35,0x0b,0x37,0x49,0xc3,0xf1,0x7f,0x0d,0xe6,0x7e,0x24,0xb9,0xbc,0xa0,0x9d,0x57,0x02,0x83,0x6b,0x55,0x82,0x05,0xd5,0xaa,0x04,0x8b,0xa2,0x53,0x09,0xb4,0xcf,0x21,0xfd,0x6c,0x82,0x54,0x36,0xfb,0xa2,0xef,0x2f,0x3d,0x74,0x51,0x01,0x29,0xed,0xa4,0x3a,0x1d,0x6f,0xfd,0xc4,0x5e,0x3c,0xb7,0xd2,0x02,0xd3,0x5c,0x3f,0x1c,0x5a,0xeb,0xb5,0x6b,0x45,0xd6,0xca,0x76,0xf1,0x60,0xcd,0x72,0xde,0x47,0x6e,0x60,0xc1,0x8f,0x77,0x87,0xe1,0x26,0x81,0x4a,0x3c,0x30,0xd2,0x6f,0xb4,0xf0,0x3b,0xe6,0x26,0x1e,0xd8,0x56,0x60,0xbf,0xdf,0xdd,0x6f,0xfc,0xb9,0xf1,0xcb,0x8a,0xde,0xa7,0x54,0x77,0x76,0xc8,0x15,0x08,0xa8,0xb8,0xbd,0xdb,0x37,0x7b,0x45,0x08,0x22,0x00,0xf3,0x56,0x90,0x0d,0x9d,0x8c,0x2e,0x52,0x6d,0xb8,0x8f,0x23,0x0e,0x03,0xdf,0x69,0xa4,0x05,0xec,0xf0,0xc6,0xd9,0xcd,0xfd,0x27,0xa8,0xd8,0x59,0xc6,0xf2,0x87,0xec,0x6b,0x97,0xbf,0x42,0x43,0x71,0x16,0x84,0xf6,0x7d,0x66,0x5d,0x12,0x6b,0xdd,0x5a,0xf8,0xde,0x02,0xd9,0x45,0xc2,0x96,0xca,0xd4,0x9f,0xb6,0x59,0xc3,0x5f,0xad,0x37,0x79,0xde,0x7e,0x43,0x4c,0x94,0xba,0x39,0x80,0xbe,0x54,0xa0,0x78,0x8b,0x40,0x3a,0xa8,0xda,0x05,0x03,0x85,0xd9,0x0d,0xac,0x79,0x02,0x3f,0xb8,0x91,0x27,0x7e,0x68,0x37,0xde,0x49,0x6e,0x26,0xc8,0xae,0x48,0x20,0xec,0x51,0x17,0x30,0x8d,0xdc,0x68,0x35,0xe0,0xed,0x5d,0xa2,0x9e,0x14,0x02,0x7e,0x6c,0x98,0x3b,0xf8,0xb2,0x03,0xcc,0xce,0xec,0x74,0x96,0xf1,0x0b,0x27,0x58,0x59,0x7f,0x67,0x4c,0x25,0x1d,
+0xcc,0x56,0x9b,0x26,0xa7,0x49,0x06,0xef,0x1f,0xa0,0xb6,0xfc,0x98,0xeb,0x87,0x46,0x67,0xfd,0x40,0xd2,0xab,0xef,0x35,0xf1,0x7f,0xe8,0x7b,0x35,0x66,0xb5,0x6b,0x2f,0x5c,0xfb,0xde,0x75,0x9e,0xd9,0x6d,0x07,0x5d,0x0b,0xfe,0x08,0x38,0xe0,0x02,0x1e,0x3b,0x6d,0x80,0xdc,0xdf,0x21,0xb7,0xf3,0xde,0x28,0xf0,0x21,0x55,0x13,0x5c,0x1b,0xf1,0xe3,0x3d,0x1e,0x47,0xa2,0x71,0x92,0x93,0xa1,0x0e,0x5f,0x8b,0x25,0x27,0xf9,0x32,0xa4,0x19,0x1b,0x90,0x02,0xff,0x0d,0x2e,0x35,0xfd,0x25,0x82,0x1f,0xda,0xff,0xbe,0x1b,0x07,0xbe,0xe3,0x46,0xb9,0x35,0xd8,0x5f,0x3f,0xd0,0x06,0x86,0x53,0x11,0xf3,0xc0,0xe8,0xee,0xf7,0xd7,0x0f,0xe2,0xa1,0x9b,0xdd,0xc1,0x72,0x98,0x5d,0xcb,0xc2,0x8d,0x4d,0xca,0x88,0xe4,0x26,0x33,0x1d,0xc7,0xba,0xa3,0x51,0x56,0x89,0xc1,0x3c,0xb4,0x37,0xf1,0x73,0xc6,0x43,0x0e,0x38,0x40,0x31,0x03,0x02,0x6f,0x85,0x1b,0xf4,0x65,0x96,0xb2,0xa9,0x32,0xb4,0xa6,0x82,0x1e,0x11,0x1d,0x3f,0xb7,0xa2,0xcd,0x6a,0x05,0x6d,0x38,0x0c,0x81,0xec,0x7b,0x7d,0xbc,0x64,0xb1,0x59,0xce,0x9e,0x79,0x5b,0x9c,0x02,0x71,0xef,0x5f,0x2a,0x92,0x65,0x7b,0xb2,0x97,0x9b,0x27,0xc1,0x18,0xfb,0x73,0xc3,0xdc,0xed,0x74,0x18,0x1b,0x2e,0x06,0x50,0xed,0xe2,0x11,0xe0,0x41,0x43,0x92,0x5a,0xef,0x74,0x94,0x69,0x8d,0x58,0xd1,0x55,0x2b,0x3f,0xdf,0x1b,0x8c,0x55,0xda,0x6d,0xb7,0xfb,0xbd,0xb8,0xe1,0x5a,0xb1,0xdb,0xf2,0x57,0xb0,0x63,0xc5,0xbe,0xa0,0x62,0xc3,0x11,0x1f,0xcf,0x8f,0xee,0xf6,0xae,0xd9,0xdb,0xa9,0x4a,0x0a,0x6f,0x84,0x79,0x26,0xa3,0xc2,0x8b,0xac,0xd9,0xcc,0x5f,0x79,0x2f,0x35,0x15,0x8b,0xbd,0x1c,0x45,0xb0,0xc5,0x43,0xec,0x60,0xc5,0x23,0xba,0x85,0x69,0xb6,0xa8,0x81,0xc9,0xef,0x58,0x4a,0xc2,0x06,0x8a,0x5c,0x9a,0x0d,0x6a,0x38,0x12,0x63,0x15,0x84,0xdb,0x9d,0x66,0xe3,0x7f,0xc0,0x20,0xa7,0x81,0xfa,0xdd,0xf8,0x53,0xf6,0x4c,0xf8,0xfb,0xde,0x62,0x87,0x45,0x4d,0x01,0x77,0x1a,0xab,0xb0,0x15,0xb9,0x6b,0xd7,0x4a,0x1a,0x78,0xd3,0x30,0x6d,0x1f,0x30,0x3a,0x2f,0x5d,0x05,0x95,0x28,0x33,0x04,0xe8,0xdd,0xbf,0x47,0x89,0xfe,0x28,0xe1,0x1a,0xad,0xee,0x08,0xe1,0xc9,0x54,0x1f,0x1d,0x39,0x85,0x75,0x14,0x7a,0x11,0xbc,0x53,0x8c,0x73,0x02,0x69,0x2b,0x1b,0x9a,0x82,0x44,0x6c,0xee,0x7e,0x14,0xcf,0x57,0x12,0xa0,0x74,0x50,0x16,0xe3,0x43,0xad,0xf1,0x29,0x8d,0x46,0x54,0xd2,0xc5,0xff,0xd6,0xea,0x0a,0x5a,0x1d,0xbf,0x52,0x9d,0xe3,0xfa,0x7a,0x0c,0xf7,0xca,0x86,0x41,0xe2,0xaf,0xd9,0xab,0xbd,0x64,0x28,0x54,0x24,0xa8,0xf6,0xf6,0x7a,0xe1,0x9f,0x8a,0x1c,0xe7,0x72,0xde,0xc6,0x4d,0x20,0xb1,0x68,0x3f,0x81,0x5f,0xfc,0x1e,0x47,0xa1,0x59,0x6d,0x89,0x27,0xa8,0xd3,0x82,0x02,0xab,0x50,0x39,0x24,0xe7,0x28,0xc6,0x6f,0x20,0x55,0xdc,0x9a,0xfb,0x41,0x00,0xfb,0x40,0x7c,0xf7,0x4d,0x39,0x31,0x98,0xb4,0x41,0x4b,0xe1,0x48,0xee,0x8e,0xca,0xb4,0xfe,0xc5,0xb5,0x8d,0xd4,0x59,0xad,0x6a,0xfa,0x6d,0xa7,0xa5,0x67,0x15,0xc8,0xc5,0xaf,0x95,0xa7,0x44,0xc3,0x34,0x28,0x91,0xa3,0xcc,0x5a,0x4a,0x46,0xce,0xb8,0xd7,0x21,0xf7,0x2f,0xae,0x67,0x79,0xb5,0xd5,0xaa,0x56,0xa9,0x05,0xb5,0xb4,0xad,0x1a,0xc5,0xf8,0x0d,0xa4,0x2a,0xd1,0x39,0x0d,0x62,0xf8,0xcc,0x81,0x96,0xca,0x91,0x63,0x28,0x35,0xa8,0xfd,0x8b,0x6b,0x5c,0x56,0x6b,0xb5,0xc2,0x55,0x69,0x3f,0x2d,0x7d,0xab,0x44,0x30,0x7e,0xbd,0x4c,0x25,0xda,0x46,0x68,0x85,0x9b,0x04,0xae,0x14,0xe7,0x07,0x0b,0xcc,0xdd,0x3e,0xf5,0x75,0x05,0xad,0xcf,0xe2,0xb3,0x01,0xff,0x17,0xa6,0x62,0x1a,0x9a,0xa9,0x8e,0x01,0x00
+};
+
+const uint8_t web_asset_2[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x3c,0xfd,0x77,0x13,0x37,0xb6,0xbf,0xfb,0xaf,0x10,0x3d,0xbb,0xcc,0x0c,0x71,0xec,0x04,0x76,0xfb,0xda,0x94,0x40,0x9d,0x10,0x20,0x0f,0x08,0xbc,0x38,0x94,0xb3,0x9b,0x66,0x7d,0xe4,0x99,0x6b,0x5b,0x64,0x46,0x9a,0x4a,0xb2,0x8d,0x77,0x9b,0xff,0xfd,0x9d,0x2b,0x69,0xbe,0xc7,0x76,0x42,0xe8,0xee,0xd2,0x53,0xf0,0x8c,0xa4,0x2b,0xe9,0x7e,0xe9,0x7e,0x69,0xfa,0x8f,0x1e,0x75,0xc8,0x23,0x32,0x60,0x6f,0xd9,0x74,0xa6,0xc9,0x4b,0x26,0x93,0x25,0x95,0xd0,0x21,0xe6,0xf5,0xc5,0x8c,0x29,0x32,0x61,0x31,0x10,0xa6,0x48,0x4a,0xa5,0x26,0x62,0x42,0xf4,0x0c,0x1a,0xfd,0x7b,0xd8,0xfb,0xa5,0x90,0xa6,0x71,0x32,0x8f,0x63,0x12,0x8a,0x74,0x25,0x4d,0x1f,0xca,0x23,0x12,0xb3,0x10,0xb8,0x02,0xc2,0xf8,0x44,0xc8,0x84,0x6a,0x26,0x78,0x97,0xa4,0x31,0x50,0x05,0x64,0xc1,0x60,0x69,0xc6,0xbd,0x3d,0x3d,0x3e,0x39,0x1b,0x9e,0x20,0x28,0x33,0xa7,0x9e,0x51,0x4d,0x96,0x54,0x91,0x88,0x29,0x2d,0xd9,0x78,0xae,0x21,0x22,0x4b,0xa6,0x67,0x44,0xe3,0xba,0x94,0x98,0xcb,0x10,0x48,0x28,0x22,0xe8,0x75,0x70,0xd0,0xb1,0x04,0x8a,0x5d,0xc6,0x2b,0x32,0xa4,0xe1,0x8c,0x92,0x0b,0x88,0xa7,0xc0,0x67,0x62,0x42,0x9e,0x26,0x40,0xa8,0x26,0x0a,0x5f,0xeb,0xfc,0x6d,0x24,0x34,0x09,0x45,0xf2,0x0c,0x07,0xfb,0x33,0xad,0x53,0x75,0xd0,0xef,0x2f,0x97,0xcb,0x5e,0xb5,0x5f,0x2f,0x14,0x49,0x60,0x26,0xc8,0xf7,0xe4,0x87,0x01,0x79,0xbc,0xb7,0xff,0x3d,0xd9,0x25,0x8f,0xf7,0x1e,0xef,0xd7,0xe7,0xeb,0x90,0x47,0xfd,0x4e,0xa7,0xff,0x88,0x7c,0x56,0x33,0xc6,0x35,0x09,0xe7,0x32,0x5e,0x1d,0x10,0x2d,0xe7,0xd0,0x25,0x73,0x1e,0xc1,0xa4,0x78,0x98,0x2b,0x88,0xb2,0x27,0xf8,0x0d,0xff,0xcb,0x9f,0xd4,0x02,0xa4,0x62,0x82,0x1f,0x90,0xef,0xbb,0x64,0x41,0xa5,0xd2,0x89,0xce,0x1a,0xc7,0x52,0x2c,0x15,0xc8,0xec,0x31,0x82,0x05,0xc4,0xf6,0xc1,0xce,0xdd,0x27,0x6f,0x60,0x45,0x38,0x4d,0x40,0x11,0xaa,0x08,0xce,0x42,0x18,0xd7,0x20,0x39,0x8d,0xe3,0x95,0x21,0x0a,0xe3,0xe4,0xb5,0x48,0x80,0x0c,0x94,0x62,0x4a,0x53,0xae,0x3b,0xa1,0xe0,0x4a,0x93,0x37,0xa3,0x21,0x39,0x24,0x9e,0xd2,0x54,0x83,0x97,0xbf,0x3b,0x3a,0xc7,0x97,0x63,0xb3,0x7f,0x0e,0x4a,0x15,0x2d,0xc7,0x17,0xd8,0x12,0x8a,0x58,0xc8,0x91,0x86,0x24,0x2d,0xb5,0xe4,0x0d,0xc5,0x3b,0x03,0xa6,0xf4,0xfc,0x0a,0x9f,0xa7,0xa5,0x79,0xcc,0x34,0xc5,0xf3,0x27,0x7c,0x5e,0xce,0x98,0x86,0xd1,0x82,0xc6,0xf3,0xd2,0x8a,0x5e,0xbd,0x33,0x43,0x69,0x92,0xd0,0xe2,0xe5,0xeb,0x17,0xf8,0x72,0x46,0x47,0x11,0x53,0xa1,0x58,0x80,0x5c,0x95,0xa6,0x1e,0x98,0xb9,0x41,0xe9,0x11,0x4d,0x99,0xd7,0x71,0x0d,0xc3,0xd1,0xfb,0x33,0x6c,0x78,0x7f,0xe6,0x15,0x6f,0x5e,0xbe,0x34,0xaf,0x5e,0xbe,0xcc,0xbb,0x7d,0x1a,0x9c,0xe2,0x46,0xf7,0xf7,0xf6,0xf6,0xf6,0x90,0xb8,0x46,0x42,0xde,0x8f,0x3f,0x43,0xa8,0x89,0x84,0x54,0x82,0x02,0xae,0x19,0x9f,0x12,0x4a,0x86,0x4b,0xa6,0xc3,0x19,0xf2,0x56,0x2a,0x38,0x70,0xed,0xc4,0xe9,0xe7,0x94,0x4a,0x9a,0x10,0x16,0x19,0x76,0x7f,0xf1,0xfe,0x1d,0x81,0x18,0x12,0xe0,0x9a,0x68,0x41,0xc6,0x40,0x24,0xf0,0x08,0x24,0x44,0x48,0xb0,0x56,0x20,0x19,0x84,0x68,0x4e,0xd4,0x4c,0xcc,0x63,0x0b,0xc8,0x10,0x2a,0x93,0x4c,0x37,0x6a,0x0c,0xc8,0x21,0x34,0x0a,0xa9,0x42,0x91,0xf0,0x3f,0xc1,0x78,0x28,0xc2,0x6b,0xd0,0x2a,0x20,0x42,0x12,0x2e,0xf4,0xf3,0x6c,0x51,0x12,0xf4,0x5c,0x72,0xb2,0x10,0x2c,0x32,0x7c,0x3b,0x99,0xf3,0x10,0x05,0xd4,0x81,0xf2,0x59,0xd4,0xc5,0x09,0x0f,0x0d,0x73,0x05,0xe4,0x5f,0x1d,0x42,0x88,0x91,0xc0,0x1e,0x8b,0xc8,0x21,0xc1,0x51,0xd9,0x0b,0xd3,0x2d,0x9a,0x97,0x7a,0x70,0xa6,0xfd,0xa0,0x73,0xd3,0xe9,0xfc,0xe4,0xe7,0x70,0xfd,0x0a,0x90,0x29,0xe8,0xa1,0xd9,0xc0,0x21,0x69,0xf6,0xc0,0x3f,0x6e,0x7d,0xa6,0xb3,0xd9,0xaa,0x69,0xb9,0xe9,0x14,0x20,0x54,0x1b,0x08,0xd3,0xb5,0x0c,0xc7,0x52,0xf1,0xf8,0xed,0x60,0x38,0x1c,0x1d,0xbf,0x3e,0x39,0x7e,0x73,0x62,0x58,0x25,0x9c,0x41,0x78,0x0d,0x91,0x97,0xf7,0x2b,0x26,0x22,0x87,0xa4,0x98,0x30,0x6f,0x82,0xb8,0xe7,0xc6,0x20,0x4e,0x8a,0x55,0xe5,0xbd,0xd8,0x84,0xf8,0xb5,0x9e,0xe5,0x75,0x94,0x01,0xa5,0x54,0x02,0xd7,0x67,0xa8,0xc2,0xc2,0x98,0x2a,0xf5,0x96,0x29,0xdd,0xa3,0x51,0xe4,0x57,0x96,0x19,0xe4,0x63,0x6f,0x08,0xc4,0x0a,0xee,0x02,0x4c,0x42,0x22,0x16,0xb0,0x16,0x5e,0x03,0x97,0x5a,0x4c,0xa7,0x31,0x6c,0xa6,0x48,0x05,0x43,0x0f,0x6a,0x84,0x69,0x50,0xc5,0x2f,0x3a,0x04,0x05,0x92,0x62,0xd0,0x24,0x03,0xf1,0xaf,0x9b,0xca,0x6b,0x23,0xe6,0xdb,0x70,0x8b,0xbc,0x77,0x98,0x6b,0xa9,0x3a,0x7e,0x9b,0x20,0xc8,0x73,0x2b,0xe7,0x07,0x56,0xb8,0x4b,0x18,0xc8,0x7f,0xf6,0xfb,0xe4,0x35,0xe5,0x51,0x8c,0x47,0x92,0x62,0x63,0x16,0x33,0xbd,0x42,0xb1,0x7a,0x3d,0x20,0x2f,0x32,0x65,0x42,0x14,0x68,0x14,0x72,0xb5,0x76,0x45,0xa8,0x82,0xea,0xcb,0xc1,0x5d,0x51,0x64,0x97,0x48,0x84,0x73,0x14,0x78,0xe4,0xfa,0x13,0x2b,0xfb,0x47,0xab,0xd3,0xc8,0xf7,0x92,0xdf,0xb4,0x1e,0x55,0xb4,0x56,0x50,0x81,0x40,0xa3,0x9e,0xd2,0xab,0x18,0x7a,0x11,0x53,0x69,0x4c,0x57,0xf5,0xbd,0x79,0x93,0x18,0xbe,0x78,0xe4,0x80,0x78,0x5c,0x70,0xf0,0xee,0xb2,0xbd,0xf3,0x93,0xe1,0x05,0x19,0x7c,0x38,0xbd,0xcd,0xd6,0xce,0x07,0xad,0x5b,0x4b,0x37,0x6d,0x2d,0xd3,0xb7,0xa3,0x6b,0x68,0xec,0x2a,0xbd,0xf7,0xae,0x4c,0xd7,0x4b,0xb7,0xca,0x2b,0x72,0x68,0x49,0xdf,0xc2,0x30,0xd1,0xbc,0xbe,0xf4,0xdf,0xe6,0x30,0xb7,0x9c,0xee,0x94,0xc5,0x06,0xb1,0x40,0x45,0xb6,0x59,0x1e,0x20,0xde,0x84,0x04,0x65,0x74,0xe9,0xc8,0x23,0x3b,0x99,0xea,0x0c,0xda,0xc5,0xa9,
+0xa6,0x38,0x1a,0xaa,0x87,0x46,0xd1,0xc9,0x02,0xb8,0x46,0xe1,0x06,0x0e,0xd2,0xf7,0xc2,0x98,0x85,0xd7,0x5e,0xb7,0x21,0xbe,0xbd,0x31,0xe3,0x91,0xd9,0x7b,0xd0,0xad,0xed,0x3c,0xa5,0x4a,0xb1,0x05,0x38,0xe3,0xa1,0xd8,0x76,0xe0,0xf6,0x7d,0xd3,0x0b,0x69,0x1c,0xfb,0xf6,0x00,0xe8,0xa5,0x52,0x68,0xa1,0x57,0x29,0x04,0xc1,0xb6,0x73,0x2f,0x66,0x11,0xc8,0xfb,0x9e,0x7b,0x6b,0x80,0xac,0x3f,0xa7,0xcc,0x00,0x9f,0x45,0x9b,0x0f,0xa7,0xd1,0xed,0x0e,0xa3,0x5f,0x9c,0xea,0xd8,0x7e,0x18,0x41,0xdc,0xb3,0xcc,0xd6,0x72,0x1e,0x35,0xa1,0x2c,0x68,0x5c,0x06,0xd4,0xef,0x93,0x17,0x82,0x7b,0x9a,0xa0,0x7a,0xb6,0xc7,0xb8,0xdd,0xf7,0x72,0x66,0xec,0x6d,0x8d,0x26,0xf7,0x18,0x10,0xaf,0x91,0xa4,0xd3,0x29,0x1e,0xe2,0xe9,0x5c,0xcd,0x20,0xb2,0x2c,0xaf,0x48,0x42,0x57,0x65,0x68,0x31,0x9d,0x92,0x31,0xcc,0x18,0x2f,0x71,0x56,0xce,0xfc,0x23,0x1a,0x6a,0xb6,0x80,0xba,0x04,0xd8,0xdd,0xb4,0x89,0x55,0x65,0x83,0x56,0xaa,0xaa,0x6d,0x23,0x05,0x7a,0xc6,0xa6,0x33,0x3f,0x68,0x6c,0x3f,0x6b,0xda,0x2c,0x2f,0x23,0xd7,0xc5,0xf7,0xab,0x73,0xed,0xe6,0x73,0x27,0x8c,0x07,0xa4,0x5f,0x9c,0xa5,0x09,0xfd,0x52,0x6b,0x0d,0xc8,0x23,0xb4,0xc7,0xc8,0x0e,0xf1,0xfe,0xec,0x35,0xd6,0x6e,0x55,0x8b,0x02,0xfd,0x41,0x8a,0x14,0xa4,0x5e,0xf9,0xde,0xee,0x2e,0xce,0x9a,0x09,0x8b,0x59,0x42,0xed,0x4c,0x12,0x73,0x9d,0xce,0x75,0x49,0x10,0x4b,0xa7,0x6a,0x21,0xd4,0xea,0x68,0x75,0x41,0xa7,0x67,0x34,0x01,0xdf,0xb3,0x23,0xbc,0xe0,0x72,0xef,0xaa,0x8a,0xf8,0x55,0x0a,0x62,0x92,0x01,0x7c,0x80,0x87,0x95,0x31,0xfd,0x19,0x87,0xa8,0x71,0x60,0xd9,0x5e,0x3d,0xc6,0x39,0xc8,0xd7,0x17,0xef,0xde,0x96,0x16,0x50,0xf0,0x58,0xbb,0x6a,0x1a,0x29,0xe0,0xd1,0x5a,0x5c,0xe3,0x9e,0x12,0x35,0xc5,0x53,0xb6,0x32,0xa1,0x61,0x22,0x73,0x18,0x9e,0x75,0x6b,0xc0,0xf1,0x4f,0xa2,0xa6,0x65,0xa5,0x5a,0x5d,0x4b,0xa7,0x45,0x83,0x26,0x6a,0xda,0xc2,0x09,0x8c,0x5b,0x64,0x6e,0xe2,0x03,0xcb,0x9a,0xce,0xbe,0xdc,0xc8,0x64,0xc5,0x7b,0xc1,0xc3,0x19,0xe5,0x53,0x68,0xe3,0x3e,0xdb,0x72,0xdb,0x49,0x27,0x34,0x56,0x70,0x07,0xe8,0xf7,0x3e,0x08,0x8c,0x94,0x6f,0x38,0x08,0xd6,0x31,0x6e,0x2c,0x96,0x5e,0x97,0x78,0x7b,0x7f,0xf6,0x82,0xb5,0x48,0xba,0xc5,0x69,0x91,0x88,0xb9,0x32,0x26,0x61,0x2e,0x04,0x6e,0xf8,0x57,0x1f,0x17,0x9b,0xe7,0xd3,0x62,0x1e,0xce,0xfe,0x8d,0xf3,0xa1,0xb2,0xfc,0x37,0x4d,0x55,0x39,0x78,0xef,0x35,0x57,0x59,0x8f,0x1f,0x1b,0xd6,0x53,0x84,0x4a,0x20,0x78,0xb2,0xba,0x03,0xc1,0x1c,0x02,0x78,0x1a,0xf8,0xa1,0xa0,0x31,0xa8,0x10,0x22,0x92,0x82,0x24,0x94,0x33,0x1b,0x4f,0x21,0x13,0x49,0x93,0x92,0x0d,0x83,0x82,0x2f,0xa7,0x63,0x72,0x48,0x2e,0xdf,0x8c,0xce,0xbb,0xe8,0x2f,0xe3,0x5f,0x47,0x57,0x6b,0x98,0x9d,0x1c,0x62,0xf7,0x1e,0xe3,0x61,0x3c,0x8f,0x40,0x65,0x86,0x5f,0x40,0x9e,0xe3,0x32,0xa2,0xf3,0x57,0x47,0xe4,0xa0,0xa4,0x70,0x4a,0xfb,0xbc,0x0d,0xdb,0x19,0x45,0x90,0xe3,0xca,0x3c,0xfd,0x51,0x54,0x31,0xbb,0xc9,0xa7,0xb2,0x8f,0xdf,0xc0,0x16,0x32,0x72,0x5b,0xb3,0x85,0xfa,0xe4,0x55,0x2c,0xc6,0x34,0x56,0x1d,0xc4,0xf6,0x12,0xc6,0x4a,0x84,0xd7,0xe6,0x37,0x2c,0x5c,0x78,0xea,0x90,0xf0,0x79,0x1c,0x9b,0x77,0x29,0xf0,0x88,0xf1,0x69,0xe6,0x5b,0xe5,0xef,0x95,0x76,0x4e,0xfb,0x21,0xe1,0xb0,0xcc,0xdc,0xee,0x37,0xa3,0x61,0x60,0x9a,0xc7,0xd2,0x59,0x44,0xae,0xd9,0x5a,0x3b,0x18,0x90,0xb1,0xed,0xa1,0x6e,0x6f,0x3f,0xbe,0xb0,0xed,0x6b,0x86,0xbb,0xd1,0xd3,0xf6,0xd6,0x57,0x6e,0xee,0x35,0x53,0xdb,0xd6,0x65,0x7b,0xeb,0x27,0x07,0x39,0x69,0xdf,0xd6,0xab,0x77,0xb6,0x7d,0x16,0xb5,0xb7,0xbf,0x7e,0xd1,0xb5,0x5a,0xd9,0x2d,0x9f,0xb6,0x77,0x3b,0x1f,0x54,0xba,0xcd,0x86,0xb9,0x32,0xcf,0x6c,0xd4,0x21,0xf0,0x48,0x19,0xd3,0x0a,0x99,0x57,0x4b,0x96,0x16,0x4e,0xa7,0x16,0xa6,0x21,0x14,0x9c,0x43,0x88,0x11,0x92,0x3c,0x40,0x42,0xc2,0x98,0xe1,0x09,0xbf,0xd5,0xec,0x74,0x52,0x91,0x1f,0x00,0x6d,0x27,0x6d,0xe3,0x94,0x75,0x67,0x09,0x1e,0xaf,0x6f,0x46,0xc7,0x57,0x85,0xf3,0x9b,0xbd,0xb9,0x74,0xe4,0x72,0x07,0x6f,0xf6,0x94,0x19,0xa6,0xee,0x48,0xca,0x7b,0x4f,0x2b,0xbd,0xa7,0x5b,0x7a,0x8f,0x2b,0xbd,0xc7,0xcd,0xde,0x9d,0xb6,0x53,0xfd,0x26,0xc7,0xe8,0xff,0x61,0x0b,0xda,0xe8,0xb1,0x89,0x82,0x5a,0x54,0x3a,0xf5,0x61,0x4d,0x79,0xab,0xb1,0x6c,0x8c,0x16,0x08,0x87,0x2f,0xba,0xae,0xa1,0x7a,0x99,0x86,0x43,0x80,0x66,0x2a,0x13,0x89,0xc4,0xee,0x09,0x50,0xae,0x19,0x86,0x6a,0x25,0x3e,0xc8,0x29,0x44,0x5d,0xa2,0x04,0x46,0x6e,0x13,0xa1,0x34,0x11,0x1c,0x5f,0x2b,0x45,0xa7,0x26,0x20,0x6d,0xe6,0x42,0x1d,0x68,0xe0,0x22,0xb8,0x99,0x58,0xc2,0x02,0x5f,0x50,0xa5,0x09,0xcd,0x2c,0x6a,0xa6,0x32,0x13,0xba,0x57,0x75,0x48,0x90,0x5a,0x38,0x2f,0xd5,0x2e,0xbc,0xac,0xb2,0x28,0x5a,0x79,0x7f,0x5a,0xb8,0x2d,0x6e,0xe5,0x88,0x1a,0xe2,0x1c,0x1f,0xa0,0x2d,0x58,0x15,0xfd,0x43,0x2b,0xfc,0x65,0xcb,0xa1,0xa6,0x1b,0x4a,0x11,0x91,0x25,0xe3,0x91,0x58,0xf6,0x24,0xfc,0x36,0x07,0xa5,0x07,0x19,0x32,0x5f,0xe2,0x9e,0x7d,0xe4,0xc1,0x61,0xe1,0xbb,0x3a,0xee,0xb2,0xce,0x59,0x0f,0x15,0xdb,0x94,0x57,0xe6,0xee,0x92,0x1a,0x45,0x0b,0x19,0x71,0xa4,0x68,0x52,0x56,0x11,0x0c,0x48,0x98,0x3e,0x25,0x21,0xb1,0x82,0xc3,0x04,0xbf,0x95,0x9c,0x58,0xa4,0x94,0x31,0xe2,0x94,0x25,0x79,0xf8,0x30,0xd3,0x9b,0x3d,0x09,0x34,0x5a,0x15,0x28,0xca,0x27,0xeb,0xbd,0xff,0x70,0x72,0x56,0x46,0x56,0x36,0x00,0x21,0xfb,0xff,0x3b,0x7c,0x7f,0xd6,0xc3,0xfc,0x00,0x9f,0xb2,0xc9,0xaa,0xb2,0xdb,0xa0,0x82,0x95,0x36,0xf5,0x5b,0x20,0xe2,
+0x03,0x95,0xca,0xb0,0xb6,0x46,0x9e,0xb5,0xf0,0x90,0xf4,0x94,0xe0,0x04,0x85,0xa3,0x4b,0xcb,0x7b,0xb6,0x6c,0xa4,0xb4,0xac,0x8f,0x1a,0x03,0xa6,0x4b,0x14,0xfa,0xef,0x15,0xec,0x24,0xec,0x0b,0x44,0x16,0xa2,0xd2,0x72,0x1e,0xea,0xb9,0x04,0xb2,0x9c,0x01,0x27,0x6a,0x1e,0x86,0xa0,0xd4,0x64,0x1e,0xff,0x64,0xd5,0x98,0x7d,0xcd,0x85,0xae,0x62,0x73,0x0a,0x1a,0x87,0xfb,0x4a,0xcb,0xdc,0x73,0x95,0xab,0xa6,0x87,0x6a,0xd0,0x62,0xd6,0x60,0xba,0x5a,0x44,0x90,0x90,0xa2,0x26,0xf5,0xa1,0xc5,0xa5,0x2d,0x0c,0xe1,0x9b,0x32,0x5a,0xa4,0xc0,0x65,0x11,0xc6,0x43,0x91,0x18,0x67,0x94,0x6a,0x4a,0x26,0x52,0x24,0x5b,0x19,0xc2,0x85,0xaa,0xb1,0xbf,0x84,0x10,0xd8,0x02,0x22,0xfb,0x54,0xec,0xfc,0x56,0x70,0xd6,0x32,0x56,0x6a,0xd7,0xf6,0x82,0x6a,0xea,0x23,0xe0,0x6c,0x53,0x13,0x21,0x89,0x8f,0xda,0xf8,0x1a,0x56,0xa8,0x5a,0xca,0x6d,0x19,0xfb,0x3d,0xc0,0x97,0xbd,0x19,0x55,0xef,0x97,0x3c,0xb7,0xb2,0xaf,0x61,0x15,0xd4,0x1d,0x33,0x8c,0x1a,0x8b,0x18,0x7a,0xb1,0x98,0xfa,0xde,0xe5,0xa7,0x93,0xa3,0xe1,0xfb,0xe3,0x37,0x27,0x17,0x57,0xe4,0x23,0xa7,0xe3,0xd8,0x68,0x07,0xb7,0x8e,0x4c,0x35,0xd5,0x62,0x5c,0xeb,0x7d,0xec,0x7e,0x3f,0x47,0xef,0x0b,0x58,0xb0,0xb0,0x92,0x1e,0xab,0xac,0x16,0x37,0x62,0xa2,0x9d,0x4d,0xc7,0x31,0x77,0x34,0x34,0xd3,0x31,0xf2,0xb5,0xd9,0x58,0xd4,0xa3,0x69,0x3a,0xc2,0xec,0x4f,0xa7,0xd2,0xbb,0xdf,0x27,0x47,0x8c,0x3b,0x3a,0x68,0x81,0xb1,0x98,0x4a,0x7b,0x8e,0xba,0x08,0x16,0x19,0xea,0x2e,0xaf,0x61,0x75,0x55,0x9f,0xb6,0x0c,0x4c,0x0b,0xa2,0x52,0xca,0xb3,0xa0,0x8e,0x6a,0x74,0x34,0x00,0xcb,0x4e,0xd1,0x6f,0x73,0x90,0xab,0x21,0xc4,0x10,0x6a,0x21,0x07,0x71,0xec,0x7f,0x87,0x00,0x2e,0x71,0xb6,0x5d,0x75,0xe8,0x7d,0x47,0x76,0xcc,0x02,0x76,0xc8,0x77,0xde,0xd5,0x77,0x41,0x03,0xde,0x4f,0x97,0x57,0xbd,0x89,0x90,0x27,0x34,0x9c,0x59,0xe3,0x2c,0xea,0x96,0x1c,0x32,0xa6,0x21,0x69,0x5b,0x6e,0x86,0xcc,0x7c,0x4f,0x75,0xf2,0x47,0xb0,0x08,0xd6,0x0d,0x34,0x83,0x35,0x24,0x15,0x0f,0x3d,0x87,0x74,0x19,0xc1,0xe2,0xaa,0x75,0xdc,0x4d,0xe3,0xed,0x4d,0x75,0x3f,0x37,0x5b,0x38,0xa3,0x35,0x28,0x9b,0xf3,0x83,0xda,0xc6,0x0f,0x3b,0x87,0xc4,0x23,0xbb,0x04,0xdd,0xcd,0xd2,0xbe,0x85,0xd2,0xf7,0xe0,0x0d,0xf5,0x6d,0x39,0x83,0x6e,0x72,0x97,0x53,0x3a,0x05,0x15,0x0a,0xae,0x81,0x6b,0x2f,0xb8,0x0d,0xe3,0xa8,0xdb,0xb3,0x0d,0xfd,0x26,0x6c,0xa3,0xbe,0x96,0x69,0xd4,0x1d,0x58,0x66,0x33,0x8a,0x21,0x64,0x13,0x16,0x96,0x23,0xab,0x4d,0x54,0x6f,0xd9,0x03,0x1e,0xc4,0xeb,0xa8,0xa0,0x02,0x13,0xbe,0xaa,0xdb,0x2c,0xad,0x6c,0xd7,0x18,0x9a,0x87,0x10,0x37,0x6e,0xfc,0xa6,0x75,0x87,0x43,0xd0,0xb5,0xec,0x8b,0x75,0x05,0x30,0x7b,0x9d,0x4a,0x98,0xb0,0x2f,0x64,0xc2,0x20,0x8e,0x5a,0x37,0xab,0x9c,0x88,0xd8,0xc8,0x7b,0x35,0xb7,0xf2,0xed,0xe9,0x9c,0x79,0x33,0x45,0xda,0xab,0xbc,0xdf,0x16,0x02,0x7e,0xbb,0xdc,0x50,0x7d,0x07,0x0f,0x2a,0x33,0x6f,0x58,0xf3,0x9a,0xc4,0x52,0x2d,0xd9,0xb2,0x9d,0x3f,0xd7,0x70,0xed,0x5a,0x92,0x16,0x19,0xa7,0x82,0x9c,0xf8,0x88,0x15,0x0b,0xb7,0xa5,0x67,0x9e,0xc5,0xff,0x03,0x68,0x99,0xb9,0x9c,0x5f,0x47,0xcb,0xaf,0x4d,0x86,0xdd,0x8f,0x8c,0xe9,0x1f,0x47,0xc6,0x0d,0x44,0xed,0xf7,0x89,0x09,0xbf,0x28,0x82,0xfe,0x09,0x93,0x36,0x93,0x91,0xd1,0xd2,0x46,0xae,0x8c,0x03,0x9e,0x51,0x9c,0x29,0x02,0xc6,0x70,0xaa,0xd2,0x18,0xd4,0xb1,0xb5,0xfb,0x4a,0x24,0xab,0x11,0x9a,0x3c,0x2f,0x9d,0x60,0x0e,0x83,0x98,0x19,0xf4,0x82,0x2d,0x27,0x28,0xce,0x2f,0x21,0x15,0x45,0xf5,0x52,0x76,0xa6,0x12,0x45,0xd1,0x28,0xf5,0x69,0x9a,0xc6,0x0c,0x22,0xe2,0xea,0x95,0x96,0x74,0xd5,0xc5,0x22,0x09,0x3a,0xd1,0x20,0xcb,0x10,0xd1,0x90,0x55,0x9a,0x4a,0x1d,0xb4,0x9f,0xc6,0xd2,0x6b,0xcb,0x8e,0x2a,0xb9,0x31,0x1e,0x2c,0x6b,0x6c,0xa0,0x64,0xe5,0xb8,0xf0,0x06,0x76,0x71,0x07,0xe6,0x0c,0xf7,0xcb,0x28,0x30,0xef,0x7b,0x9f,0x05,0xe3,0x3e,0x46,0x86,0x03,0xf2,0xfb,0xef,0x48,0x74,0x3d,0x63,0x7c,0xea,0xd5,0xb8,0xb4,0x2a,0x0d,0x6e,0x1b,0xbd,0x18,0xf8,0x54,0xcf,0xc8,0x33,0xb2,0xd7,0xc6,0x5f,0x95,0x95,0xa0,0x21,0xd1,0x23,0xe7,0x76,0x20,0x3a,0x02,0x13,0x21,0x0f,0x6a,0x76,0x45,0x06,0xb6,0x58,0x52,0xab,0x0a,0xf8,0x44,0x99,0x36,0xd6,0x04,0xd2,0x22,0xb2,0x96,0xaf,0x16,0x64,0x46,0x17,0x90,0x21,0x18,0xab,0xb8,0x60,0x22,0x24,0xbe,0x88,0x05,0x8d,0x8c,0x5b,0x35,0x43,0xa7,0x6a,0x0a,0x0d,0x90,0xb6,0x8b,0x6f,0xca,0x53,0x6e,0x65,0x5b,0x0d,0xb3,0x30,0x50,0x2b,0x19,0x31,0xf0,0xd6,0x48,0x96,0xac,0x55,0x08,0xe6,0x64,0x34,0x25,0x05,0xad,0x7c,0x58,0x05,0x7c,0x74,0x5e,0x87,0x9c,0x05,0xf7,0xf2,0x9c,0x61,0x01,0xf9,0x16,0xf0,0x8e,0x2f,0x1a,0xee,0x8a,0xfe,0x7a,0x78,0xae,0x52,0xab,0x91,0x24,0x5c,0x0b,0x11,0x03,0xcb,0x57,0x55,0x94,0x4f,0x37,0x75,0x7e,0x55,0xeb,0x3c,0xde,0xd4,0xf9,0xe8,0x36,0x08,0xf8,0x54,0x5f,0xec,0xf2,0x3e,0xe8,0x7c,0xf5,0xae,0x0e,0x2e,0x8b,0x61,0xb6,0x10,0xbe,0x59,0x2d,0x50,0x78,0xcd,0xf5,0x60,0x22,0xc1,0xac,0x11,0xa3,0x31,0xfb,0xa7,0x0d,0x84,0xe1,0x81,0x07,0x0b,0x13,0xbe,0xb2,0x4a,0x8a,0xf1,0xe9,0x56,0x77,0x77,0x99,0xeb,0xc8,0x72,0xc4,0x11,0x6d,0x79,0x72,0x98,0x45,0x89,0x62,0x11,0x9a,0x19,0x0a,0x13,0x3f,0xeb,0x67,0xf4,0xdf,0x21,0xc9,0x3b,0xe0,0x73,0xa7,0x1e,0x8d,0x69,0x0b,0xb2,0x84,0xb1,0x50,0xb5,0x4c,0x58,0x16,0xbb,0xb1,0x11,0xd9,0x7c,0xb3,0xbe,0xb7,0xc4,0x02,0x4a,0xd4,0x09,0x66,0x55,0x3b,0xc4,0x3b,0xc0,0x07,0x33,0xf5,0x0e,0xf1,0xfa,0x4b,0x95,0x69,0x84,0x0c,0xb8,0xe0,0x22,0x05,0x5e,
+0xc9,0xa7,0x35,0x6a,0xb6,0x5a,0xbd,0xef,0xe3,0x3c,0x70,0xab,0x85,0xd1,0x42,0xd0,0xd3,0x54,0x4e,0x41,0xf7,0xe6,0x32,0x6e,0x5b,0x6c,0x4f,0x70,0xb3,0x93,0xaf,0x9f,0x0b,0x47,0x18,0x10,0x51,0x49,0x63,0x97,0x07,0xc1,0x9a,0xd7,0x18,0xd8,0x52,0x82,0xaf,0x59,0x15,0x48,0x29,0xe4,0x57,0xac,0xea,0x04,0xc7,0x59,0x0d,0x0c,0x6b,0x40,0x67,0xb1,0xd2,0xb5,0xc0,0x8d,0x63,0x8e,0xee,0xde,0x61,0x1e,0x57,0x82,0x9e,0x09,0x97,0x74,0xea,0x07,0x47,0x5d,0x32,0x1a,0xc1,0x97,0x0d,0xe2,0x60,0x4c,0x84,0xa1,0x2b,0xd7,0xbd,0xb3,0x40,0xd8,0x38,0x12,0x4a,0xe9,0x45,0xc9,0xb6,0xf0,0x9d,0xc1,0x11,0x6d,0xb6,0x32,0x82,0xad,0x62,0x55,0x98,0x1e,0x18,0xfe,0x29,0x45,0x28,0x1f,0x3c,0x70,0x42,0x55,0x5a,0x7e,0x3d,0x8c,0x94,0xa7,0x79,0xd6,0xf9,0x47,0x59,0x87,0x8a,0x18,0xd5,0x94,0x90,0x31,0x12,0xf2,0x6c,0x11,0x2c,0xcb,0xf8,0xf2,0xbd,0xbe,0xc1,0x8b,0x32,0xa7,0x3f,0x22,0xe1,0x39,0xf1,0x9e,0x3b,0xf3,0xe7,0xd0,0x10,0x9f,0x63,0x05,0xf4,0xc7,0xf3,0xd3,0xe3,0xac,0x60,0xc6,0x6e,0xc4,0x98,0x46,0xc5,0x7c,0xa5,0x84,0x94,0xfd,0x51,0x2a,0xa1,0xb2,0x2b,0x6c,0xa4,0xd2,0x2a,0x1b,0xf1,0x50,0x50,0xbd,0x6e,0x35,0x22,0xd0,0xce,0x55,0xed,0xac,0x7b,0xf2,0xcb,0xc9,0xd9,0xc5,0xf0,0xfd,0xc7,0xf3,0xe3,0x93,0x5b,0x89,0x6f,0x8e,0xa8,0xda,0x9c,0x95,0x7c,0x7d,0x70,0xd7,0x5d,0x18,0x69,0xbb,0xdb,0x36,0x0c,0x9d,0xb3,0xe5,0x95,0x62,0xd4,0x48,0xf2,0x12,0xa5,0x1a,0x51,0xea,0xbb,0xa1,0xa2,0x55,0xbb,0xac,0xb1,0xc1,0xbf,0x29,0x46,0xb2,0xa8,0xe5,0xd7,0x93,0x36,0x87,0x40,0xea,0xca,0xe3,0x2e,0xab,0xcd,0xca,0x13,0xd1,0xd4,0x7b,0x7f,0x31,0xb0,0xea,0x40,0xdd,0x95,0x49,0x35,0xfd,0x1a,0xe2,0x9a,0x98,0xa9,0x31,0x3c,0xd5,0x27,0xa6,0x67,0xbe,0x97,0xee,0x7a,0x6b,0x3d,0x44,0x73,0x9a,0x8e,0x37,0xd9,0xf4,0x22,0x5d,0xe3,0xda,0x99,0xa1,0xe4,0xd0,0xe6,0x06,0x4e,0xb9,0xce,0xa7,0x4e,0x63,0xa6,0x7d,0x6f,0xd7,0x0b,0x2e,0xf7,0xd7,0xf9,0x97,0xe9,0x38,0x8f,0xa4,0xa4,0x9d,0xb5,0x1e,0x6f,0x6a,0x4c,0x19,0xac,0x89,0x7a,0xf8,0x90,0x3c,0x98,0x0d,0x37,0x86,0x2c,0x86,0xf5,0xa2,0x9b,0xb6,0xf5,0x4e,0xca,0x3b,0x0d,0xcd,0x15,0x0b,0xb7,0x59,0xdf,0x4b,0x37,0xb8,0xb0,0x93,0xb2,0x1b,0xb3,0xd1,0x77,0xf5,0x50,0x73,0xc5,0x80,0xda,0xa0,0xc8,0x82,0xc4,0xab,0x07,0xe4,0x83,0xbd,0x20,0xb2,0xcc,0xfc,0x85,0x95,0x98,0xcb,0xfc,0xea,0xc9,0x30,0xc1,0xfb,0x28,0xf6,0x77,0x56,0x46,0xe8,0x7c,0x87,0xde,0x7a,0xaf,0x37,0x1d,0x97,0x0b,0xba,0x68,0x8a,0x49,0xa1,0xe3,0x19,0x8b,0x23,0x7f,0xb2,0x7e,0x2b,0xce,0xc1,0x70,0xd9,0xe6,0x7b,0x45,0x3f,0x66,0x62,0x69,0xb8,0xfb,0x9d,0x88,0x4a,0x15,0x75,0x4d,0x6e,0xcc,0x8b,0x9b,0xa5,0xf6,0xee,0x1a,0x73,0xf3,0x44,0xe2,0x05,0xb5,0x7a,0x72,0x8f,0xa9,0x5d,0x5b,0xf3,0x74,0x5f,0xf5,0x52,0x3f,0xdc,0xcf,0x0d,0x72,0x54,0xee,0x9e,0x59,0xb7,0xd9,0x10,0x0d,0x45,0x39,0x04,0xa9,0x29,0xe6,0x77,0x59,0x02,0xbd,0xfc,0x5a,0x11,0x98,0xe7,0xcc,0xc7,0xcb,0x87,0xe6,0x25,0x8f,0x16,0xe3,0x98,0x19,0x56,0xc4,0x95,0xcc,0xe1,0xb5,0x1e,0xec,0xe8,0xe1,0x3d,0x0c,0xcf,0x56,0xf3,0x53,0xae,0x6b,0x29,0x5d,0x85,0x08,0x3e,0xe5,0x11,0x0b,0x4d,0x8d,0xe4,0x72,0x06,0x7a,0x86,0x55,0x32,0x24,0x41,0x84,0x3b,0x33,0x59,0x11,0x0e,0x80,0x4b,0x36,0x6c,0xe3,0x22,0x26,0x10,0xb9,0x8b,0x11,0xbd,0xad,0x26,0x83,0xe3,0x07,0x9c,0xab,0x6c,0x30,0x94,0x9f,0x37,0xd2,0x47,0xde,0x82,0x3e,0x8e,0x7f,0x14,0xe8,0x0b,0x96,0x80,0x98,0x6b,0x7f,0x4d,0x7d,0x5f,0x66,0xd0,0xbb,0x45,0xb9,0xd1,0x5d,0x73,0x5d,0xa5,0x9c,0xe9,0xb5,0xb5,0xdf,0x32,0x77,0xbc,0x9d,0x2b,0x4f,0xc6,0x73,0xad,0x1b,0xc9,0xb6,0xb1,0x10,0x31,0x50,0x6e,0xef,0x13,0x99,0x44,0xe4,0x5c,0x21,0x1a,0xd3,0x54,0x8a,0x05,0x28,0x57,0x79,0x41,0x04,0x22,0x77,0xc9,0x90,0x3f,0xaa,0xf8,0x31,0xa0,0x2b,0x7e,0x8a,0x04,0x95,0x0a,0x6e,0xec,0x6f,0x67,0x56,0x85,0x82,0x4f,0x98,0x4c,0x7c,0x6f,0x20,0x01,0x45,0x9b,0xa8,0xb9,0xfb,0xb1,0xa4,0xb6,0x34,0xd8,0xc1,0x59,0x2b,0xf7,0xcf,0x1d,0xae,0x10,0xf9,0x05,0xfc,0x43,0x57,0x07,0xb2,0x25,0xc7,0xd9,0x69,0x64,0x92,0xf3,0xde,0xb5,0x94,0x72,0x3d,0x21,0x98,0x24,0x94,0x63,0x3c,0xc6,0x2d,0xcf,0x6b,0x14,0x0d,0x39,0x0d,0xfe,0x8d,0x42,0x1d,0x95,0xf0,0xc6,0x46,0x7a,0xc2,0x1f,0x45,0x4d,0xb8,0x2d,0x2d,0x73,0x4c,0x78,0x7f,0x13,0x73,0x53,0xc6,0x41,0xc7,0x62,0x9e,0x11,0x13,0xf4,0x46,0x15,0x6e,0xee,0x0e,0x52,0xcc,0xec,0xac,0x50,0xe8,0xe9,0x3c,0xd6,0xea,0xc1,0xaf,0x9c,0x38,0xfe,0xf0,0xc8,0x4e,0xf5,0xb0,0xcf,0x19,0xa6,0xd9,0x52,0xe2,0x20,0xd0,0xcf,0xbd,0x4e,0xa1,0xba,0xfe,0x73,0xbc,0x02,0xff,0x0d,0x9c,0x92,0xd0,0xeb,0x62,0x98,0x52,0x4b,0x21,0x23,0xe2,0x33,0x1e,0x98,0x2b,0x21,0xf1,0xf6,0x12,0x17,0x7b,0xbf,0xe0,0x83,0x1b,0x5a,0xe1,0x0a,0x06,0x1b,0x6c,0x22,0x7b,0x05,0x83,0x6a,0xaa,0x00,0xab,0x9c,0xd3,0xb9,0x8b,0xa1,0x32,0xe8,0x61,0x35,0x1d,0x96,0xea,0x67,0xbf,0xf0,0xe0,0xc3,0x72,0x0a,0x0f,0x5d,0x9d,0x6c,0x91,0xe6,0x12,0x88,0x79,0x5b,0xda,0xd8,0x20,0x8a,0x14,0x56,0xa6,0xb3,0xc8,0x7a,0x91,0x99,0xbf,0xeb,0x78,0x49,0x99,0x3c,0x21,0x44,0x59,0x4e,0xac,0x7a,0x52,0x40,0xdc,0x76,0x1b,0x61,0x39,0x63,0xa1,0xad,0x5d,0x6a,0x81,0x5b,0x3e,0x35,0x68,0x14,0x99,0xea,0x8e,0xbc,0x96,0x28,0x9b,0xbb,0x7d,0x68,0xed,0xa8,0xd9,0x8a,0x67,0x1a,0x45,0xbf,0xe4,0x50,0xde,0x59,0x20,0x3e,0xc4,0xdd,0x0c,0x60,0x86,0xf8,0xf2,0xa5,0xb6,0x4f,0x83,0xf3,0xb3,0xd3,0x33,0x73,0x9f,0x92,0xa9,0xdd,0x08,0x6b,0x77,0xa4,0x97,0x93,0x67,0x71,0x0b,0x3b,0x6e,0x51,0x09,0x3d,0xbb,0xa9,
+0x5c,0x4b,0xed,0xbc,0x9a,0x41,0x9c,0x7a,0xdd,0xea,0xcc,0x16,0x48,0xb5,0x66,0xbe,0x6c,0x62,0x2d,0xf2,0x0e,0x6d,0x97,0xdd,0x72,0x20,0xed,0x9c,0x9b,0x21,0x15,0x2f,0x9a,0xf0,0x08,0x43,0xf7,0xf8,0xd3,0x28,0xb2,0xcc,0x42,0x28,0x72,0xe5,0xdb,0x4a,0x92,0xe8,0x02,0x2a,0xbc,0xab,0x8a,0x9a,0xab,0x52,0x19,0x5f,0xf1,0x82,0x29,0x43,0x8d,0xcc,0x5e,0xce,0xdf,0xbf,0x64,0x5f,0xb0,0x90,0xe5,0x1c,0xa6,0xf0,0x85,0x1c,0x92,0xfe,0x3f,0xde,0xfd,0xed,0xc7,0xc7,0xfe,0x8f,0xfb,0xbf,0x3f,0xd9,0x0f,0xbe,0xfc,0x1a,0xed,0xfc,0xfc,0x6b,0xb4,0xd3,0xfd,0x35,0xda,0x39,0xb8,0x3c,0x7f,0x75,0xf4,0x29,0x5c,0xee,0x5e,0xed,0xf8,0x3f,0x6d,0xef,0x13,0x3c,0xff,0x53,0x3f,0x9f,0xc3,0xcc,0xfc,0xe3,0x5f,0x1f,0xbf,0x76,0x21,0x3d,0x37,0x59,0xe1,0x38,0xfd,0xc3,0xf7,0x2f,0xe9,0xee,0x3f,0x07,0xbb,0x7f,0xbf,0xfa,0x3d,0xfb,0xe1,0xfe,0xdd,0xdb,0xfd,0xf1,0xd7,0xdd,0xab,0x47,0xc5,0xd3,0x55,0xf0,0x6b,0x2f,0x78,0xe4,0x5f,0x0e,0x76,0xff,0x4e,0x77,0xff,0x79,0xf5,0x7b,0xf6,0xc3,0xfd,0x9b,0xf5,0xcf,0x9f,0xae,0x82,0x3f,0xf5,0x59,0xae,0xa4,0x4c,0x91,0x14,0xa1,0x71,0x4c,0x6c,0x61,0xbf,0x49,0xd6,0x29,0x43,0x0f,0x47,0x1e,0x73,0xbe,0x48,0x2b,0x2a,0x2e,0xc7,0x63,0xf0,0x87,0xdd,0x55,0x99,0x03,0xb1,0xd0,0x45,0x5d,0xee,0x5d,0x35,0x53,0xfa,0xae,0x56,0x38,0xa8,0xd6,0xf2,0x30,0x72,0x48,0xf6,0x7e,0x22,0x8c,0x3c,0x75,0xc0,0x5c,0xf2,0xe2,0x27,0xc2,0x76,0x76,0xea,0x31,0x2d,0x7b,0xf7,0xc7,0x74,0xbb,0x64,0x57,0x3d,0x16,0x65,0x1e,0x56,0xcf,0x0b,0x7a,0xa9,0x48,0xfd,0x5a,0xc9,0x75,0x0c,0x14,0x2b,0xa9,0x57,0x2d,0x92,0x5b,0x2a,0xbc,0xc8,0xe1,0x35,0x6e,0x57,0x96,0xe4,0xad,0x5a,0x80,0x9d,0x56,0xd6,0x51,0x88,0x45,0xf5,0xbe,0x23,0xba,0x74,0x2d,0x78,0x48,0x7b,0x6d,0x60,0x1b,0x55,0x0c,0x8b,0x6d,0x55,0x0c,0xa9,0x5b,0xa6,0x15,0x42,0xd3,0x63,0x5d,0xf1,0xf9,0x2f,0x19,0x15,0xb3,0xf8,0xb1,0x5d,0x7d,0x25,0xe6,0x95,0xdd,0xbc,0xcc,0xba,0x78,0xc6,0xd5,0x6c,0xe5,0xd2,0x9e,0x06,0xa5,0xfd,0x02,0x01,0xc6,0x81,0x6d,0x38,0xd6,0xad,0xba,0x2e,0x1f,0xd4,0x25,0x9e,0xf9,0x0c,0x41,0xb1,0x22,0xac,0x3f,0x31,0x84,0xea,0xd5,0x7c,0x99,0x42,0x4a,0xab,0x4e,0x8b,0x53,0x94,0x9a,0xf1,0xca,0x45,0x9a,0xd6,0x8d,0x7f,0x62,0x2f,0x19,0x51,0x8a,0x45,0xad,0x7b,0x5e,0xb2,0x09,0x1b,0x61,0x6b,0xc3,0x29,0x33,0x11,0xc3,0xda,0x4e,0x31,0x21,0x57,0x7b,0x95,0xa5,0xdc,0x10,0xda,0x5e,0x4b,0x3b,0x79,0x46,0x9e,0xec,0xb7,0x39,0x7c,0x5b,0x91,0x34,0xb0,0x4b,0x1f,0x0e,0x4f,0x5f,0x90,0x64,0xae,0xb4,0xa9,0x41,0xb4,0x35,0x8b,0xb6,0x20,0x97,0x92,0x84,0x7e,0x61,0xc9,0x3c,0xc1,0x34,0xe8,0x93,0x7d,0xac,0xee,0x94,0x34,0xd4,0x20,0x55,0xaf,0xc5,0x27,0xdc,0x84,0xcb,0x56,0x7c,0x6e,0x4a,0xb8,0x55,0xb1,0xfb,0x61,0xf8,0x66,0x3d,0x72,0x53,0x75,0xdd,0x8a,0xdb,0xe6,0x02,0x6b,0x88,0x7b,0xf8,0x70,0x5b,0x97,0x52,0xba,0xb3,0xad,0xb7,0xbf,0xb6,0xfb,0xf7,0x4f,0x36,0x50,0xf2,0x29,0xf9,0xa1,0x8a,0xbd,0xfb,0x50,0x0f,0x0d,0xab,0x74,0x26,0x31,0xea,0x61,0x82,0xdc,0x99,0xa1,0x15,0xe4,0x24,0x1d,0x83,0x5e,0x02,0x70,0xf2,0x83,0xd1,0xba,0xdf,0x3f,0xf9,0x8f,0x90,0x71,0x62,0x8f,0x3d,0xe2,0x87,0x33,0xca,0xb8,0xa9,0x9a,0xf6,0x9e,0x26,0x22,0x82,0xf8,0xd9,0x97,0xa7,0xe1,0x8c,0xa5,0xea,0xd9,0xcf,0x4f,0x23,0x46,0x52,0xc6,0x9f,0x75,0x9f,0x46,0xe1,0xb5,0xfd,0x79,0xf0,0x34,0xa1,0xe9,0x33,0x2f,0x68,0xa5,0xbe,0x83,0x69,0xb5,0x49,0xf9,0x5c,0xfd,0x96,0x4a,0x24,0x5b,0xf8,0x1f,0xab,0x43,0x5c,0x8e,0xa2,0x75,0x9b,0x79,0xed,0xc7,0x7f,0x19,0x8f,0x3f,0x79,0xfc,0xc7,0xf3,0x38,0xcf,0xb3,0x37,0xed,0xdc,0xfc,0xe4,0xf1,0xbf,0x8d,0x9b,0xd5,0xa5,0xbd,0x03,0x51,0x6c,0xb8,0x70,0x3e,0xcc,0xd5,0xeb,0xb1,0xf8,0x82,0x0e,0x48,0xe9,0xd0,0x77,0xdf,0x7c,0x38,0xa8,0x23,0xa9,0xec,0x23,0x56,0x6c,0x24,0xeb,0x7f,0x38,0x23,0xa9,0x30,0x35,0xcd,0xdb,0xdb,0xda,0x42,0xb6,0x77,0xdd,0x18,0xfa,0x6c,0x8d,0xa1,0xcf,0xe4,0x69,0x06,0x2e,0xb7,0x86,0x3e,0xaf,0xb1,0x86,0x5c,0xbf,0xcb,0xcf,0xed,0xe6,0x50,0x1d,0x2f,0xa5,0xee,0x8d,0x4d,0x1a,0x76,0xb6,0x94,0x28,0x4f,0x95,0xa8,0x69,0x0f,0xb7,0xa5,0x6e,0x55,0xa7,0x8f,0xf7,0x10,0x9a,0xc1,0xc4,0xd3,0x2c,0x2d,0x08,0x8a,0x68,0x3a,0xce,0x0d,0x1b,0x8a,0x1f,0x2b,0xd8,0x6a,0xd6,0x63,0x52,0xf1,0x82,0x8e,0x55,0xc5,0xb4,0x47,0x9e,0xa0,0x8c,0xc3,0xc6,0x2a,0x9c,0x04,0xf8,0xdc,0x21,0xd9,0x7a,0x54,0x17,0x83,0xa3,0xe1,0x68,0x78,0xf2,0xf6,0xe4,0xf8,0xe2,0xbd,0xf9,0x62,0x4d,0xc4,0x16,0x04,0xff,0xa7,0x5e,0x4e,0xe9,0x13,0x5b,0x01,0x6e,0xae,0x01,0xba,0xec,0xa5,0xf3,0x3c,0x35,0x1d,0x17,0x04,0xc7,0x07,0x72,0x58,0xac,0xa3,0x49,0xe5,0xca,0x64,0xeb,0xed,0x5e,0x04,0xb4,0xce,0xea,0xc5,0x36,0xe4,0x48,0xcc,0x72,0x33,0x93,0x9a,0x77,0xbe,0xe6,0x87,0xcc,0x83,0x2b,0x38,0x14,0xcb,0x5f,0xc2,0xb9,0x94,0x66,0xc1,0x74,0x5c,0x60,0xca,0xbe,0xbb,0xa0,0xe3,0xf5,0xcb,0xad,0xaf,0x35,0x87,0xa9,0x85,0xb9,0xc9,0x60,0xbc,0x67,0x3a,0x46,0x05,0x9b,0x4d,0x21,0x78,0x51,0x85,0x60,0x58,0xb1,0x98,0xa7,0xc4,0x8a,0x23,0x93,0xfb,0xb0,0x14,0x28,0xda,0x4b,0x8e,0xa4,0x02,0x3d,0xc8,0xee,0xe9,0xf8,0x9e,0xa9,0xf8,0x75,0x1d,0xbd,0x2e,0xc9,0x6e,0xd1,0x96,0x86,0x6e,0x88,0xaf,0x66,0x8b,0x7e,0xcd,0x22,0x43,0x2b,0xe2,0x0a,0x8c,0x15,0x59,0x02,0x89,0xcc,0xad,0x7c,0xf4,0x5f,0x8a,0xda,0x09,0xf4,0x03,0xee,0x53,0xa5,0xec,0x29,0x9b,0xe1,0x6b,0x93,0xe3,0x7d,0x2b,0xc7,0x06,0xc4,0x3a,0x29,0x36,0x8d,0x28,0x8b,0x1b,0x6a,0xfc,0xca,0x62,0x84,0x24,0xb4,0x7c,0xd0,0xb7,0x81,0xf5,0x6c,0xc4,
+0xcc,0x3a,0xd4,0x5b,0x25,0xa9,0xc4,0x3c,0x7e,0x5b,0xa8,0x61,0x70,0x7c,0x71,0xfa,0xcb,0x89,0x8b,0x34,0x38,0xbc,0x96,0x3b,0x7d,0x3c,0x3f,0x3f,0x39,0xbb,0x18,0x0d,0x2e,0x2e,0xce,0x4f,0x8f,0x3e,0x5e,0x98,0x9e,0x15,0x92,0x95,0x3a,0x9f,0xbe,0x18,0x5d,0x0c,0x8e,0x46,0x1f,0x06,0xaf,0x4c,0x37,0x5c,0xef,0xc8,0xab,0x33,0x65,0x76,0x07,0xbd,0x7a,0x1b,0xbf,0x60,0x88,0xc6,0x8c,0x05,0x95,0xcf,0x8d,0xf3,0x43,0x0c,0x3f,0xa0,0xa5,0xe2,0xae,0x7e,0x23,0xdd,0xf1,0xd0,0x99,0x21,0x13,0x64,0x0c,0xd0,0xd9,0x18,0xb7,0xd7,0x74,0x6c,0x2e,0x6e,0xbb,0x35,0x05,0xeb,0x3e,0xb3,0x63,0xb1,0x13,0x6c,0x04,0x56,0xde,0x75,0x09,0xe2,0x1a,0x02,0x67,0x7b,0x19,0x44,0x91,0xdb,0x88,0x16,0xa6,0x54,0xa0,0xb6,0x19,0x93,0xfe,0xa8,0x6c,0x26,0x97,0x3a,0x77,0x9f,0xb7,0x26,0x6f,0xc5,0xcd,0xf6,0xb6,0x90,0xcc,0xdd,0x37,0xc2,0xa2,0x96,0x3d,0x8c,0x63,0x11,0x5e,0x7b,0xc5,0x54,0xeb,0xa4,0xba,0x41,0x44,0x2b,0xd8,0xed,0xf1,0x20,0x07,0x9f,0xf1,0x69,0x7f,0xc6,0xf2,0x58,0xe8,0x8c,0x26,0xe3,0xb9,0x9c,0x82,0x24,0xa8,0xd2,0x89,0xef,0xe2,0x9a,0x04,0x1d,0x7a,0x31,0x36,0x17,0xa9,0x4d,0x6c,0x55,0x05,0xb7,0x0c,0x75,0x9e,0xd1,0xc5,0xdd,0x24,0x00,0x11,0xce,0xe9,0x62,0x93,0xba,0xe0,0x74,0xb1,0xeb,0x4e,0x9c,0xa2,0xda,0x84,0xd3,0x72,0x8c,0xcd,0xa9,0x5f,0x55,0x25,0x44,0x59,0x27,0x54,0xfb,0xb7,0xd3,0xac,0xf1,0xb9,0xa8,0xea,0xa0,0xb5,0x4c,0x7b,0xb3,0x06,0xe7,0x53,0x4c,0xb9,0x67,0x31,0xb8,0xc2,0xcc,0xcd,0x93,0x7a,0xae,0x1d,0x22,0x7b,0xf5,0x0a,0xaf,0xd3,0x61,0x92,0x2e,0xa2,0x32,0x22,0x1f,0x3f,0x9e,0xbe,0x70,0xdf,0x65,0x82,0x2f,0x78,0xc7,0x3c,0x27,0xd9,0x2a,0x9d,0x01,0x57,0xe6,0x13,0x82,0xb6,0x94,0xe2,0x80,0x64,0x1f,0xe3,0x53,0x9a,0x86,0xd7,0x58,0xf3,0x3e,0x89,0x4d,0x96,0x21,0xe9,0x9b,0x5b,0x90,0x4c,0x70,0xd5,0xdf,0xdf,0xfb,0xeb,0xde,0x93,0xbf,0xf4,0x6d,0x28,0x73,0x77,0x3a,0x67,0xd1,0xee,0x1c,0xff,0x62,0x7c,0xf7,0x33,0x5d,0x50,0x15,0x4a,0x96,0x6e,0xff,0x78,0x4c,0xb6,0xe4,0xc1,0x87,0xd3,0x37,0xb0,0xaa,0x58,0x0e,0xf4,0x7a,0x23,0x15,0x8b,0x2a,0x6e,0x33,0x82,0x5e,0x2f,0xf2,0x04,0xbd,0x7f,0xb9,0x0f,0xff,0x73,0x45,0x76,0xc8,0x3e,0x3c,0x21,0x3b,0xe4,0x2f,0xe6,0xef,0x1f,0xcc,0xdf,0xfb,0xb0,0xbf,0x1f,0xf4,0x24,0xa4,0x31,0x0d,0xc1,0xef,0x5f,0xee,0xed,0xff,0x70,0xd5,0x9f,0x76,0xcd,0x17,0x05,0x0f,0x9f,0xe5,0x84,0xf2,0x43,0xf2,0x0f,0xe2,0x87,0x72,0x95,0x6a,0x81,0x33,0x9f,0x53,0x1e,0x89,0xc4,0x94,0x34,0x2a,0x1f,0x05,0xff,0x23,0xe3,0xfa,0x87,0x81,0x94,0x74,0xe5,0xef,0x07,0xf8,0xed,0x11,0xf2,0x90,0xf8,0xfb,0x7f,0x25,0xcf,0x9e,0xe1,0xd8,0x3e,0xf9,0x4b,0x10,0x04,0x41,0x4f,0x8b,0xa1,0xb1,0xb8,0xfc,0xfd,0xef,0xb3,0x84,0x43,0x41,0xd9,0x77,0x94,0xad,0xbd,0x64,0x97,0xef,0xba,0x79,0xc1,0xfe,0xc5,0xfb,0x77,0xc7,0x56,0xc3,0xbc,0x35,0x39,0x5a,0xaf,0xdb,0xf2,0x35,0x8c,0xb5,0x58,0xb3,0x09,0xaa,0xdd,0x2c,0x77,0x16,0x6c,0xf8,0xae,0x82,0xeb,0xd3,0xad,0x1c,0x84,0x8d,0xcb,0xfa,0x37,0x9b,0xd5,0x93,0xcb,0xbc,0x6c,0x99,0x07,0xee,0x3b,0x0b,0x8a,0xb4,0x55,0x18,0x1b,0xa7,0xca,0x75,0xca,0x3d,0xa7,0xc3,0x00,0xf6,0xc6,0x89,0xb0,0xc3,0xf6,0x39,0x0a,0x0b,0x67,0x79,0x2f,0xf3,0x86,0xf5,0x58,0x28,0xf8,0x2e,0xac,0xb2,0xec,0x75,0x23,0x48,0x99,0x2e,0x37,0x45,0x29,0xcd,0x25,0xa9,0x35,0xdf,0x0e,0x71,0x39,0xd6,0x5a,0xe6,0xe9,0xee,0x5f,0x8c,0x58,0x33,0x47,0x95,0x32,0x5f,0x07,0xbe,0x8c,0x49,0x7a,0xfd,0xb5,0x98,0xcc,0xd1,0x48,0xa5,0x14,0xcb,0x5d,0xb5,0xe2,0xa1,0xc3,0x26,0xbd,0xde,0x86,0x9c,0xaa,0x16,0xbb,0x1d,0x73,0xb5,0x42,0xcd,0xd0,0x71,0x57,0x80,0xf6,0x1c,0xcb,0xfd,0x2f,0x9b,0x30,0x2d,0x0a,0x96,0x3b,0x37,0x41,0xe7,0xff,0x01,0xa9,0x56,0xff,0x26,0x6b,0x56,0x00,0x00
+};
+
+const uint8_t web_asset_3[] PROGMEM = {
+0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x08,0x03,0x00,0x00,0x00,0xf4,0xe0,0x91,0xf9,0x00,0x00,0x00,0x9f,0x50,0x4c,0x54,0x45,0x00,0x00,0x00,0xce,0x00,0x76,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x71,0xcf,0x00,0x72,0xcf,0x00,0x73,0xcf,0x00,0x71,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xce,0x00,0x73,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x73,0xcf,0x00,0x73,0xcf,0x00,0x72,0xd0,0x00,0x73,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x71,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x71,0xcf,0x00,0x70,0xd2,0x00,0x6c,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x71,0xd0,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xfb,0x8a,0x72,0x05,0x00,0x00,0x00,0x34,0x74,0x52,0x4e,0x53,0x00,0x07,0xf4,0xee,0xbe,0xf8,0x23,0x8e,0x34,0xe8,0xe2,0x18,0xc3,0xd3,0xaa,0x48,0x5a,0x1d,0x9d,0x93,0x3e,0x0e,0x5f,0x43,0x56,0xae,0xb9,0x67,0xd7,0x74,0x27,0x51,0x4c,0x2f,0x13,0x0b,0x39,0x8a,0x84,0xdd,0xcf,0xa2,0x78,0xb5,0xcc,0x2b,0x7f,0x99,0xc9,0xa7,0x6b,0x70,0x11,0x88,0xdd,0x0a,0x00,0x00,0x09,0xc3,0x49,0x44,0x41,0x54,0x78,0xda,0xc4,0x58,0xe9,0x7a,0xa2,0x30,0x14,0x65,0x11,0x50,0x36,0x11,0x37,0x44,0x54,0xdc,0xb5,0x5a,0x9d,0x2a,0xef,0xff,0x6c,0x33,0xb9,0x22,0x9e,0x00,0xa1,0xca,0x4c,0xc7,0xfb,0xa7,0x9f,0x36,0xc4,0xbb,0x9c,0x25,0x41,0xaa,0x15,0x7a,0x7c,0x31,0x46,0xb6,0xd3,0x52,0x95,0x24,0x51,0xd4,0x96,0x63,0xbb,0xc6,0x25,0xd6,0xa5,0xff,0x14,0x17,0x5b,0x4d,0x4a,0x43,0xb1,0x8d,0xc0,0x92,0x7e,0x3c,0xda,0x49,0x65,0x44,0x46,0x5b,0x96,0x7e,0x34,0x2e,0x09,0x86,0xa6,0x15,0x73,0x50,0xf7,0xf1,0x4f,0xe6,0x60,0x6d,0x93,0xc4,0x3c,0x18,0xd7,0xd9,0x4a,0x5f,0x48,0x14,0x7d,0x7d,0x35,0xbb,0x1a,0x07,0x13,0x72,0x68,0xad,0x7f,0x10,0x11,0xf2,0x7c,0x21,0x95,0xc6,0x62,0x78,0x0a,0x95,0x2c,0x87,0x51,0x53,0x7a,0x47,0xc8,0x43,0x63,0x9b,0xa4,0x11,0xf6,0xa4,0xf7,0x44,0xd3,0x68,0xa5,0x29,0xd8,0x43,0xe9,0x3d,0x21,0x07,0x8d,0xfb,0x20,0x3a,0xd2,0x9b,0x62,0xee,0xa6,0xe2,0x70,0x92,0xff,0x62,0x93,0xc1,0xe2,0x1f,0xa4,0xe0,0xd4,0x85,0x82,0xbc,0x4e,0x12,0xb3,0x2f,0xfd,0x45,0x7c,0xa6,0x83,0x58,0xd7,0x6a,0x42,0xc7,0x66,0xcf,0x56,0xa0,0x48,0x6f,0x0e,0x63,0x6f,0x3c,0xf6,0xe2,0x61,0x53,0x48,0x7a,0xef,0x06,0x47,0xbb,0x06,0x12,0x62,0x95,0x44,0xad,0x74,0x06,0x96,0xb7,0x19,0x39,0x1a,0x27,0x88,0xce,0x68,0xe3,0x95,0xf9,0x40,0xdf,0xa0,0x75,0x6a,0x2c,0xbd,0x18,0x6b,0xda,0x77,0x3b,0x2f,0xaa,0x4d,0xd0,0x8d,0x84,0x3e,0xd0,0x0d,0x8a,0x09,0x37,0xb7,0xb7,0x31,0xbc,0x36,0xfe,0xaf,0x1b,0x87,0xfa,0xf9,0xef,0x63,0x57,0x4b,0x2a,0x43,0x3b,0x04,0x72,0xbe,0x09,0xe9,0x66,0x2f,0x00,0x61,0x19,0xd2,0x5e,0xd7,0x3c,0xa6,0xba,0x9c,0x0f,0x6f,0xed,0x83,0x7b,0x36,0x8c,0xb3,0x7b,0xb0,0xb7,0x9c,0x17,0x75,0x3f,0x25,0x3e,0x06,0x24,0xd0,0x8d,0xa7,0x01,0x6d,0x1d,0xcb,0xda,0xdf,0x1c,0x3d,0x8c,0x3f,0x3c,0x05,0x73,0x99,0xf7,0x87,0xa0,0xca,0x07,0xe6,0x94,0xe1,0xd1,0x7a,0xf2,0xb8,0x53,0xb6,0x7a,0x15,0x26,0x69,0xfc,0x3a,0xf5,0x64,0xc1,0xe0,0x7a,0xa7,0x63,0xe6,0x03,0x2b,0xbe,0xa6,0x1d,0xd5,0xf4,0x94,0x45,0x2e,0xa2,0x62,0xbf,0xac,0x7d,0xba,0xaf,0xd9,0x9d,0x57,0x3f,0x3d,0x3d,0xdd,0xc7,0xe1,0x5a,0xc5,0xa9,0x6e,0x9f,0xe8,0x41,0x9f,0x8a,0x70,0xb9,0x22,0x2f,0xe9,0xec,0x1b,0xed,0xa7,0x8e,0x4c,0x8d,0x14,0x0b,0x17,0xae,0x3d,0x23,0xea,0xeb,0xb7,0x38,0x90,0xe9,0x69,0x9f,0x2b,0x2a,0xed,0xeb,0x61,0x25,0x3d,0x19,0xab,0x43,0x3a,0xad,0x29,0x7e,0xeb,0x53,0x0d,0xdf,0x71,0xc1,0x25,0x0c,0x71,0x62,0x76,0xc3,0x96,0xdd,0x7c,0xc9,0x91,0xed,0x1b,0x5a,0x3d,0xc1,0xde,0xd5,0xfa,0x83,0x59,0xca,0xdd,0x5b,0x3b,0xaf,0xd2,0x8b,0x31,0xb8,0x89,0xf0,0x7e,0x89,0xdd,0xfd,0x56,0x91,0x62,0x72,0x2f,0x98,0x53,0xc7,0xa1,0x6d,0xfc,0x1a,0xae,0xb8,0xf0,0xe9,0xd1,0x5d,0x27,0x8f,0xaf,0x59,0x85,0xff,0xa8,0x19,0x52,0x91,0x91,0x8a,0x27,0xb6,0xdc,0x70,0x67,0x87,0xae,0x31,0x1e,0x96,0xc1,0x7b,0xa6,0x12,0x71,0xa6,0xfc,0x81,0x36,0x51,0x3b,0x42,0x00,0xb2,0xc1,0x69,0x73,0x98,0x64,0x8b,0x6a,0xa8,0x60,0xaf,0x93,0xdc,0xc3,0xf4,0x07,0x56,0x81,0x93,0xc4,0x7e,0x75,0x05,0x09,0x2b,0x0c,0x9b,0x72,0x15,0x00,0xc6,0x8f,0xcf,0x43,0x85,0xa6,0x58,0x85,0xdb,0x56,0x82,0xd1,0x18,0xf4,0x73,0x25,0xed,0xa9,0x83,0x70,0x22,0x19,0x57,0xc0,0xa0,0xc7,0xfe,0xf7,0x05,0xf5,0x2b,0x25,0x8b,0xf5,0x73,0xeb,0xb0,0x00,0xa8,0xe5,0xbc,0x49,0x39,0xe7,0xda,0x65,0x10,0xaa,0xe0,0x0b,0x72,0xa6,0x5e,0xe9,0x00,0x1c,0x06,0x80,0x47,0x09,0x53,0xaa,0x6e,0xc2,0xdb,0x11,0x3d,0xbe,0x41,0x85,0xd3,0x9b,0xbd,0x78,0x72,0x6e,0xa8,0x99,0x1d,0xee,0x79,0x2b,0x9a,0x30,0x9b,0xc6,0x07,0x22,0x96,0x51,0x59,0x57,0x3f,0x78,0x00,0x74,0xe8,0xa2,0x33,0xc8,0x1f,0x2e,0x84,0x1d,0x6c,0x4e,0x1a,0xf7,0x14,0x8c,0x3e,0x7f,0x28,0x32,0xdb,0xdc,0x42,0x0d,0xea,0x42,0x06,0xb0,0x86,0x1b,0x8f,0x44,0x9d,0x42,0xfd,0x81,0x99,0xea,0x9b,0x25,0x22,0xd1,0x47,0x94,0x02,0x32,0x90,0x2a,0xa2,0xcb,0x46,0x55,0x64,0x02,0x93,0xea,0x56,0x1f,0x75,0x93,0x2f,0x55,0x3e,0x27,0x14,0xbb,0xca,0xcd,0x87,0xbf,0x12,0xd0,0x1f,
+0x81,0xdb,0xb0,0x42,0xdc,0xd2,0x4b,0xf7,0x63,0x6f,0x8f,0x76,0xc1,0xe9,0xdf,0x8a,0x73,0x86,0xdf,0x5a,0xd1,0x6d,0x61,0xf4,0x29,0x5e,0xe2,0x95,0x9d,0x76,0x6d,0xe6,0xe1,0x0f,0xac,0xab,0x84,0x14,0x64,0xe4,0xd3,0x97,0x0c,0xf9,0x7a,0x5b,0x5b,0xe1,0x9c,0x0d,0x46,0xd9,0x12,0x0a,0x3e,0x24,0x8b,0x49,0xa6,0xaa,0x43,0xce,0x1a,0x0d,0x5f,0x7f,0xf2,0x44,0x73,0x24,0x2c,0x8a,0xf5,0xf3,0xb3,0x48,0xc5,0x90,0x24,0x80,0x7b,0x07,0xe1,0xe5,0xdf,0x49,0x18,0xdf,0x97,0xcf,0x3b,0x18,0x9e,0x07,0x8a,0x80,0x0b,0x39,0x6a,0xb0,0xf5,0x99,0xdf,0x5a,0x6c,0x00,0x7e,0x6e,0x66,0xda,0xe0,0x25,0x2f,0xd4,0xa0,0x86,0x62,0xcc,0xb3,0xdf,0x83,0x8c,0x0e,0xd9,0xa7,0x3d,0x7f,0x23,0x19,0xb2,0xcd,0x94,0xf8,0xc5,0x7b,0x8d,0xc2,0x92,0x16,0xe2,0xe0,0xc0,0x9f,0x0c,0x74,0x96,0xd0,0x8a,0xc3,0xc3,0x00,0xfd,0x83,0xe4,0xfc,0xc5,0xe8,0xd1,0x63,0x22,0x2e,0xac,0xd8,0x6f,0xe8,0x9c,0x0b,0x35,0x38,0x3c,0xfc,0x42,0xe9,0xa4,0x52,0x5e,0x8e,0x58,0x63,0x6c,0xec,0x8b,0x88,0x80,0x92,0x2e,0x33,0xd5,0x9f,0xf1,0x78,0x80,0x79,0x50,0x3f,0x6a,0xc4,0x00,0x4e,0x97,0x85,0x08,0x98,0xee,0xc9,0xf7,0x5c,0xf1,0x03,0xe2,0x81,0x16,0x92,0x42,0xd7,0x0a,0xe2,0x42,0xc0,0x5d,0x5f,0x96,0x5c,0xd1,0x6d,0x28,0x72,0xcd,0x71,0x74,0xc5,0xc9,0xe6,0x51,0xae,0x97,0x80,0x7c,0xe4,0xe5,0xbd,0x1f,0x25,0x2d,0x1d,0x7d,0xda,0x4f,0xd7,0xa9,0xd8,0xf3,0x2e,0xe1,0x01,0x97,0x29,0xba,0x54,0x33,0x74,0x32,0x38,0x8e,0xce,0x5d,0x84,0xa1,0x2a,0x67,0x36,0xb0,0x95,0x24,0xc8,0xa6,0x9d,0xb5,0x03,0xac,0xb3,0x4e,0x90,0xc5,0x4f,0x81,0x5e,0x30,0xea,0x6d,0x66,0x08,0x5d,0x4c,0x73,0xc6,0xdc,0x14,0x8e,0x2f,0x64,0x09,0xb5,0x43,0x8e,0x38,0x4f,0x33,0x11,0xec,0x46,0x36,0xf8,0x08,0xbd,0x69,0x84,0xf4,0xd0,0xc1,0xb6,0xea,0xbf,0xd9,0xd6,0x74,0xa4,0xfb,0x08,0xff,0xe5,0xd0,0x31,0x82,0x8d,0xf9,0x5e,0xe5,0x82,0xf5,0x3c,0x53,0x0f,0x1f,0x14,0xa1,0x66,0xb0,0xf3,0xc1,0x19,0x01,0xae,0x2d,0xee,0xdd,0x61,0x00,0xb1,0x52,0xa2,0x85,0xc8,0xba,0x63,0x86,0x5a,0xb6,0x24,0x96,0x6a,0x05,0x8e,0x54,0xe9,0xa3,0xcb,0xce,0x50,0x8b,0x66,0x29,0x04,0x4e,0xc8,0x81,0x13,0x2a,0x49,0x54,0x79,0x17,0x1f,0x6f,0x7c,0x7f,0x33,0x9e,0x56,0xad,0x89,0x50,0xc7,0x4e,0xc8,0x83,0x4d,0x8a,0x3d,0x1b,0xe7,0x1c,0xa1,0x51,0x37,0x2a,0x29,0xb0,0xa4,0x13,0x20,0x45,0xf4,0xb1,0xac,0x24,0x42,0x03,0x79,0xe0,0x20,0x08,0xec,0x3f,0x7f,0x19,0xef,0xee,0x73,0xb1,0x00,0x0f,0x04,0x8e,0x44,0x78,0x8d,0x1a,0x73,0x77,0x92,0xd6,0xb8,0xb0,0x00,0x77,0xb1,0xf2,0x73,0x27,0xbc,0x31,0x25,0xb8,0x21,0xdd,0x44,0xa9,0x08,0x71,0x02,0x0d,0x11,0xbf,0xfc,0x24,0x17,0x5f,0x72,0x85,0xed,0x78,0xf8,0x21,0xc0,0x6b,0x55,0x87,0x8c,0xe0,0x80,0x63,0x39,0xa1,0x0d,0x4d,0xaa,0x5e,0x63,0x24,0xea,0xd7,0xd5,0xf3,0xae,0xae,0x92,0x54,0xbd,0x7a,0xf8,0x40,0x4b,0x3a,0x21,0xcb,0x43,0xd2,0xbc,0x2b,0xca,0xd0,0x08,0x51,0x6a,0x92,0x42,0x63,0xf0,0x16,0xa9,0x4e,0xe4,0x34,0x9d,0x89,0x2a,0x36,0x3e,0x72,0x57,0x13,0x59,0xe6,0x22,0xe2,0x2f,0x24,0x48,0x57,0xbc,0xec,0xce,0x61,0x78,0xaa,0x60,0xfe,0xf4,0xba,0xa7,0x03,0x83,0xde,0x89,0x4d,0x9b,0x40,0x66,0xc1,0x59,0x6c,0x87,0xb7,0xb6,0x35,0x5f,0x34,0x93,0xa1,0x7b,0x27,0x87,0x42,0x08,0x2c,0xd9,0xf0,0x8e,0x4b,0xee,0x2b,0x96,0x81,0xb9,0x2c,0x07,0x01,0x30,0x4b,0x66,0x28,0x47,0x8d,0x70,0x89,0x85,0x2b,0x90,0xde,0x2d,0x96,0x79,0x16,0x4e,0x55,0xed,0x94,0xbc,0xdb,0xf8,0x28,0x5d,0x7e,0xc6,0x4b,0xbf,0x09,0xcc,0x5a,0xb1,0x12,0xa9,0xeb,0x3a,0x8c,0xcb,0x46,0xb3,0xb8,0x8a,0xb4,0xa5,0x88,0xce,0x89,0x50,0xb5,0x26,0x88,0x32,0x1b,0x80,0x35,0x65,0xaa,0x40,0x5c,0xe8,0x67,0x5d,0x07,0x46,0xb8,0x22,0x1d,0x9e,0x66,0x4e,0x4e,0x81,0x14,0x9f,0x8a,0xd4,0xd8,0xc5,0xe3,0x70,0x0f,0x84,0xc0,0x24,0x88,0xe0,0xd9,0xec,0x0b,0x49,0xd2,0x2b,0x85,0x20,0xac,0x82,0x70,0xb1,0xd3,0x18,0x3d,0x51,0x59,0x32,0xc1,0x9c,0x25,0x8e,0x3a,0x74,0xc6,0x66,0x95,0xbe,0x97,0xdd,0x94,0xeb,0xc3,0x04,0x28,0x8e,0xc1,0x0f,0xd6,0x47,0x59,0x22,0x44,0x32,0x87,0xcc,0x6a,0xc3,0x69,0xed,0x08,0x1c,0x10,0xb8,0x47,0x50,0x7e,0xe7,0xf5,0x45,0x23,0xdb,0x21,0xb2,0xc6,0x48,0xba,0x9a,0x09,0x78,0xe5,0x09,0x9c,0x6b,0x24,0xa0,0xbd,0x79,0x04,0x35,0x41,0xe8,0xfe,0x33,0x10,0x12,0x0d,0x17,0x2f,0xd3,0x50,0xa9,0x4b,0xc3,0xb0,0x40,0xc3,0xfa,0x42,0x54,0x94,0x47,0xa7,0x86,0x10,0xbd,0x5f,0x8a,0x7f,0xf7,0x6e,0xad,0xdb,0x89,0xc2,0x40,0x18,0x2d,0xde,0xb8,0xda,0x80,0x82,0x52,0xa1,0x2a,0x20,0xd2,0xd5,0x5a,0x37,0xef,0xff,0x6c,0x7b,0x16,0xb4,0x9d,0x24,0x84,0x40,0x80,0xce,0x4f,0x0f,0xa5,0x40,0x26,0x99,0x99,0xef,0x22,0x5b,0x8c,0x32,0xa9,0x62,0x74,0x64,0x8a,0x11,0xbf,0x1c,0xeb,0x45,0x8a,0xf0,0xe7,0xde,0xac,0xa7,0x72,0x7c,0xa7,0x1b,0x12,0xbf,0x41,0x43,0x82,0x88,0x86,0xe4,0x98,0xbf,0x60,0xee,0x7a,0x29,0x71,0x6d,0x43,0x12,0xd4,0xb4,0x64,0x48,0xd8,0x92,0x8d,0xad,0xdd,0x72,0xb9,0xeb,0xd6,0x92,0xf5,0xd6,0x94,0x22,0xc9,0xa6,0x54,0xba,0x2d,0x5f,0x6b,0x18,0x84,0xb6,0x96,0x6c,0xcb,0x85,0x83,0x49,0xde,0x64,0x30,0x31,0x9b,0x0e,0x26,0x5e,0xd5,0x60,0x32,0xeb,0x32,0x9a,0x5d,0x11,0xba,0x06,0xd3,0xc6,0xa3,0x59,0x4a,0x8f,0x66,0x09,0x3d,0x9c,0x46,0xc3,0x0e,0xa7,0x59,0xd5,0x70,0xaa,0x0f,0x32,0x9e,0xc3,0x79,0xf8,0x13,0x02,0xa4,0x93,0x15,0x9d,0x0f,0x2c,0x40,0x91,0x10,0x00,0x85,0xdd,0x2f,0x40,0x61,0x31,0x00,0x85,0x32,0xab,0x87,0x68,0xde,0xfa,0x85,0x68,0xde,0x61,0xba,0x25,0xdf,0x8f,0xa2,0x01,0xfc,0x8e,0x06,0xa9,0xf2,0xbe,0x40,0x2a,0xbb,0x00,
+0xa9,0xe0,0xd3,0x78,0x3f,0xc0,0x58,0x3c,0x10,0x4c,0x07,0x79,0x1f,0x83,0x03,0xd3,0x29,0x67,0xb8,0x06,0x21,0x20,0x13,0xba,0x03,0x95,0xb0,0x44,0xba,0x18,0x26,0xb8,0x03,0x4e,0x68,0x5b,0x04,0xd5,0x3a,0x1d,0xa0,0xda,0x88,0x00,0xc1,0xad,0xca,0xa5,0x1e,0x69,0xe0,0x84,0xa6,0xc1,0x6a,0xd4,0x19,0xac,0x86,0x08,0xfd,0x9e,0x01,0xab,0xc5,0x70,0xbd,0x59,0xbc,0x87,0x24,0x5c,0x6f,0x1e,0x09,0xc0,0xee,0x83,0xc8,0x87,0x94,0x43,0x58,0xc4,0x24,0x87,0x7d,0xe9,0x42,0x58,0x84,0x24,0xa6,0x30,0x27,0x09,0x8b,0x36,0x94,0xcd,0x24,0xea,0x46,0xd9,0x1c,0x4a,0x1e,0x0a,0x7e,0xe5,0xcd,0xf0,0xa4,0x95,0xaf,0xd0,0x2f,0xc5,0x92,0x56,0x30,0x43,0x05,0xb4,0x9d,0xd3,0x96,0xb6,0x0b,0x14,0x72,0x33,0x05,0x9c,0x2f,0x0e,0xf6,0x28,0x4c,0x98,0x71,0x48,0x13,0x97,0x7f,0xda,0x11,0x97,0xe0,0xfd,0xc3,0x31,0x91,0xd8,0x7b,0x90,0x73,0x30,0x2b,0x0d,0x3e,0x75,0x6b,0x97,0x74,0x6c,0xde,0x84,0xba,0xcd,0xcb,0x6b,0x3d,0xf0,0x53,0x06,0x5e,0x88,0xa2,0x6e,0x61,0xaf,0x82,0x97,0x35,0xe4,0xb5,0x59,0x82,0xb2,0x76,0x43,0xf2,0xda,0x0c,0x69,0xd5,0x84,0x4f,0x1e,0x10,0xae,0x80,0xbe,0xff,0x2c,0x56,0x9d,0x5d,0x57,0x9c,0xad,0x6b,0x93,0xbf,0x8a,0xbe,0x9f,0x91,0xf7,0x5a,0x2d,0xc0,0x0c,0xcc,0x15,0x30,0x8c,0x32,0xae,0x80,0xe1,0x2d,0x7f,0x15,0x09,0x18,0x22,0xb2,0x24,0xc2,0x7a,0x02,0x05,0x0c,0xec,0x0c,0x39,0xb9,0x50,0x12,0x8e,0x80,0x96,0x70,0x94,0xa1,0xe6,0x73,0x06,0x05,0xc8,0xbf,0x25,0x1c,0xc9,0x91,0x41,0x35,0x4f,0x3a,0xb9,0xe5,0xff,0xf2,0x44,0x2c,0xa9,0x52,0x2b,0x62,0x09,0xcf,0x93,0x6f,0xdd,0xa4,0xfa,0xb9,0xfb,0xaf,0xa7,0x9d,0xce,0x3d,0x4a,0xc4,0x12,0x32,0x2d,0x01,0x60,0xeb,0x94,0xd5,0x89,0xcb,0x43,0xb9,0x45,0xa6,0xd0,0x32,0x1e,0x87,0x96,0xf1,0x8c,0x31,0x11,0x02,0x19,0x4f,0x52,0xfc,0x3a,0xa7,0x14,0x6d,0x2e,0x27,0x81,0x11,0x48,0x30,0xae,0x90,0x69,0xb5,0x56,0x31,0x88,0x7a,0x21,0xd3,0x17,0xbd,0x23,0xef,0x40,0x07,0xc4,0x0b,0x5a,0xca,0x65,0x32,0x14,0xb8,0xbe,0x46,0x1a,0xa6,0xe2,0x84,0x58,0x5d,0x71,0x68,0x56,0x4a,0xb9,0x0c,0xd1,0x69,0xd2,0x48,0xcc,0xa6,0x7b,0xc1,0xcc,0xda,0x1a,0x19,0x25,0x66,0x63,0xc5,0xb4,0x27,0x5a,0xcc,0xb6,0x68,0x23,0xb3,0xd6,0xb3,0x72,0x5b,0xcb,0xc8,0xf9,0xce,0x98,0x16,0xc7,0xae,0x32,0xdc,0x70,0xd4,0x19,0x52,0xd0,0x98,0x2a,0x2d,0xc3,0x2f,0xd3,0xfe,0xd6,0x4a,0xd2,0x19,0xdf,0xca,0xe7,0xf6,0x19,0x49,0xe7,0x97,0x44,0x73,0x7d,0x6b,0x6b,0x19,0x71,0xb7,0x18,0xb3,0xba,0x1f,0x54,0xdc,0x44,0xaa,0xc3,0x0e,0x9e,0xb2,0xde,0x46,0x8f,0x60,0x1b,0x8f,0xa3,0x2a,0x20,0xd6,0xd2,0xc2,0x14,0xcf,0x22,0x0e,0x56,0xd8,0x2c,0x6e,0x8f,0xf7,0xc9,0x73,0x83,0xa2,0x83,0x84,0xb0,0x59,0x28,0x15,0xde,0xd4,0x5b,0x7c,0xd2,0x0c,0x3f,0xe2,0x63,0x5e,0xb1,0x9b,0xde,0x5e,0x3b,0x99,0x77,0x36,0x54,0x69,0xa0,0xc5,0xed,0xea,0x8f,0xba,0xd2,0xda,0x57,0x79,0x0c,0x6e,0x07,0xa5,0x5b,0x5c,0xae,0x4b,0x06,0xa7,0xb9,0x17,0xf2,0x7e,0x8d,0xa0,0x71,0x9d,0x50,0x42,0xde,0x2f,0x19,0x1b,0xc6,0xe0,0x60,0xbd,0x4b,0x1b,0x1c,0xd8,0x88,0xd2,0x8b,0xe0,0x0a,0xd2,0x79,0x68,0x3a,0xd1,0x8a,0x67,0xf1,0x48,0x25,0x87,0x3b,0xa7,0xfe,0xbb,0xa1,0x67,0x19,0xce,0xac,0xd4,0xaf,0x34,0xb9,0x38,0xe5,0xb2,0x48,0xe1,0x2c,0xa8,0xf8,0xd3,0x65,0x6d,0xe2,0x47,0xc1,0xf2,0xdd,0x9d,0xf3,0xd1,0x44,0x60,0xf3,0x91,0xf6,0x56,0xaa,0x17,0x69,0xaf,0xd5,0xe3,0x48,0x4a,0x65,0x51,0x1e,0xd7,0x7c,0x58,0x46,0xf6,0x72,0xfb,0x56,0xd6,0xea,0x05,0xf5,0xa1,0x2f,0xb2,0xbe,0xbd,0xf8,0x03,0x9a,0xdd,0xe4,0xe3,0xd5,0x7a,0xb6,0x5b,0xfe,0xa8,0x8d,0xdd,0xcf,0x78,0x0a,0x2b,0xba,0xdb,0x70,0xbd,0xe7,0xbd,0x16,0xb3,0xb8,0xe1,0xcb,0x3b,0x0b,0xdc,0xa8,0x7a,0xb5,0xa9,0xae,0x65,0x68,0x42,0x4f,0xef,0xd1,0x76,0x34,0x8c,0x81,0x29,0x45,0x36,0xf8,0x26,0x27,0xf5,0x6a,0xf3,0x4c,0xaf,0x76,0xaa,0x4e,0x86,0x32,0xbd,0x4e,0xd3,0x05,0xa4,0x07,0xb6,0xce,0x2e,0x8a,0xc3,0xc3,0xe3,0x1f,0x87,0x71,0xb4,0x73,0xb6,0xc4,0x05,0x69,0xff,0xb6,0xdf,0x91,0x7d,0x2e,0xb7,0x84,0xd8,0xf8,0x8c,0x88,0x85,0xea,0xd7,0xd3,0x6b,0x62,0x41,0x98,0x89,0x37,0xac,0xf5,0x5b,0x8f,0x66,0x3c,0xf3,0xfb,0x8b,0x31,0x8b,0x74,0xe5,0x57,0x62,0x6a,0xdf,0x13,0x4b,0x35,0xb5,0xd2,0xfe,0xaf,0x99,0xaa,0x95,0xdc,0x6d,0xb9,0xf3,0xfe,0x1f,0x6d,0xaa,0xbb,0x26,0xd5,0x47,0xf5,0x04,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82
+};
+
+const uint8_t web_asset_4[] PROGMEM = {
+0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x08,0x03,0x00,0x00,0x00,0xf4,0xe0,0x91,0xf9,0x00,0x00,0x00,0x93,0x50,0x4c,0x54,0x45,0x00,0x00,0x00,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x71,0xcf,0x00,0x71,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xd0,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xcf,0x00,0x72,0xf9,0x05,0x1f,0xa1,0x00,0x00,0x00,0x30,0x74,0x52,0x4e,0x53,0x00,0x05,0xf2,0xea,0x08,0xd7,0xf6,0x0f,0x0b,0x15,0x24,0xfa,0xdb,0xc7,0xcc,0xe2,0x32,0xae,0x38,0x87,0xb4,0x5d,0x54,0x9d,0xd2,0x62,0x92,0x3d,0x2e,0x21,0x8c,0x7d,0x58,0x4f,0xb9,0x43,0x4a,0xa7,0x98,0x1b,0xa2,0x1e,0x6a,0x29,0x82,0x77,0xc0,0x72,0x1d,0x06,0xbb,0x4a,0x00,0x00,0x0a,0x4a,0x49,0x44,0x41,0x54,0x78,0xda,0xc4,0x58,0xeb,0x7a,0xa2,0x30,0x10,0x95,0x84,0xab,0x02,0x02,0xa2,0xa8,0x88,0x22,0x55,0x51,0xab,0x2d,0xef,0xff,0x74,0x6b,0x06,0xc1,0x13,0x0a,0xde,0xf6,0xeb,0xee,0xfc,0x6a,0x21,0x26,0x33,0x73,0xce,0x9c,0x99,0xd0,0x7b,0xc3,0x54,0xc3,0x5a,0x4c,0x56,0x51,0xe8,0x0e,0x19,0x2b,0x0a,0xc6,0x86,0x6e,0x18,0xad,0x26,0x0b,0xcb,0x50,0x7b,0xff,0xc2,0x94,0x99,0xaf,0x15,0xad,0xa6,0xf9,0xa7,0x89,0x67,0xf4,0x7e,0xdb,0xe2,0xe2,0x9e,0x0d,0xdd,0x68,0xfc,0xcb,0x3e,0x8c,0x8b,0x07,0x36,0x60,0xe1,0x47,0xef,0x17,0xcd,0xd2,0x18,0x1f,0xba,0xdb,0xd3,0x38,0xfe,0xb4,0x14,0xc2,0xc4,0xfa,0x8c,0xc7,0xa7,0xad,0x3b,0xe4,0x7a,0xed,0x04,0x3f,0x27,0xbf,0x47,0x08,0x6b,0xb3,0x30,0xdb,0x9e,0x9b,0x5e,0x3a,0xba,0xd1,0x43,0xdf,0xaf,0xcd,0xde,0xbf,0x37,0xf5,0x10,0xac,0xa6,0x95,0x0b,0xee,0xb8,0xf7,0x7f,0x2c,0x99,0x57,0x58,0x68,0x71,0xef,0x3f,0xd9,0xcc,0x61,0x05,0x99,0xbf,0xe8,0xfd,0x27,0xfb,0xd8,0x95,0x2e,0xf0,0x91,0xf5,0xfe,0x26,0xc1,0xb7,0xf1,0x17,0x82,0x95,0xcc,0x0b,0x32,0x7b,0xfd,0xee,0x0e,0xa7,0x8b,0xff,0x7f,0x25,0x2a,0x7d,0xa7,0x20,0x1b,0x29,0xef,0xfc,0xda,0x13,0xbf,0x1e,0x74,0x11,0x59,0xcd,0xfb,0x5e,0xf0,0xb1,0x99,0x5c,0x6c,0xf3,0x11,0x78,0x7d,0x4b,0x6d,0x57,0xad,0xb2,0x24,0x9c,0xc5,0x1b,0x34,0xe2,0xe2,0x97,0x2c,0x69,0x3b,0x3c,0x3e,0xce,0x43,0xc7,0xe6,0x83,0x5a,0xfb,0xb8,0xed,0x84,0xf3,0x63,0xd0,0xe2,0x84,0xb5,0xa2,0x55,0x7c,0xf6,0xea,0xf9,0x25,0x7e,0x5a,0xff,0xa7,0xdc,0xcc,0x32,0xce,0x06,0xed,0x12,0xcc,0xb3,0x99,0xf9,0x13,0x87,0x52,0x9b,0x96,0xaf,0xc1,0x1f,0xd2,0x8e,0x91,0xd2,0x78,0x6c,0x6c,0xb2,0xe2,0x81,0x65,0x1b,0x43,0x69,0x06,0x43,0xfe,0x86,0x2f,0x10,0xe1,0x40,0xe4,0xe1,0xc7,0xc6,0xf1,0xf1,0x68,0x58,0xd4,0xc6,0x35,0x27,0xf3,0xb7,0xd1,0x6e,0x17,0x6d,0xfd,0xcc,0xd1,0x38,0x34,0xc4,0x51,0xdc,0x38,0xeb,0x48,0x6f,0xbf,0x0e,0xcf,0x9e,0x9f,0x13,0x73,0x5c,0x4f,0x7e,0x9a,0x66,0xac,0x3a,0xc2,0xde,0x1f,0x37,0x5e,0x72,0xe3,0x9d,0x6a,0x25,0xde,0xe6,0xb8,0xb7,0xab,0xf7,0x2c,0x4b,0x1b,0x84,0x76,0x69,0xc7,0xfc,0xc9,0x66,0xc3,0x29,0x95,0x96,0x2c,0x09,0xd3,0x0a,0xf7,0xe9,0xf7,0x41,0x55,0x5a,0x71,0x53,0x0f,0xdf,0xd3,0x8a,0x0f,0xd3,0x40,0xde,0x93,0xa0,0xe3,0xd6,0x53,0xf1,0x73,0x42,0x4c,0x95,0x7e,0x7f,0xd5,0x14,0xdd,0x5e,0x3e,0xc8,0x63,0xb2,0x1c,0x5e,0x1b,0xc1,0x5c,0x3a,0x4d,0x0d,0xc9,0x83,0xfc,0x09,0xfc,0x29,0x88,0x08,0x1f,0x19,0xc7,0x12,0x7b,0xe6,0xa7,0x4f,0x74,0x58,0x33,0xf5,0x59,0xc9,0x85,0xa3,0xb4,0x3a,0x22,0x14,0x1e,0xf2,0x40,0x71,0x7e,0x48,0xd7,0xe7,0x55,0xcf,0x22,0x4f,0x7d,0xb2,0x27,0x7b,0xd7,0x84,0x39,0x9f,0xb8,0xf3,0x88,0x98,0xf8,0xa8,0x16,0x7c,0x3a,0x0a,0x57,0xa5,0x05,0x99,0x9b,0xbc,0xd4,0x91,0xdd,0x82,0x2c,0x45,0x0f,0x22,0xc2,0xf6,0x09,0xfd,0xc1,0x35,0x46,0x19,0xcc,0xf0,0xbb,0xf7,0xa2,0x7d,0x97,0xb0,0xed,0x0c,0x54,0x97,0x87,0x8a,0x34,0x23,0xfe,0x9b,0x10,0xc9,0x57,0x49,0xa8,0x7e,0x37,0x66,0x5d,0x2f,0x3e,0xe7,0x45,0xb3,0xfa,0x55,0xaa,0x85,0x3b,0xaa,0xbc,0xe0,0x22,0xd7,0x16,0xc8,0x28,0x85,0xc1,0x26,0x9d,0xa7,0x7c,0xb8,0x9a,0x36,0x75,0xb6,0xe7,0x75,0xd2,0xe2,0xda,0x9a,0x53,0xf2,0x80,0x08,0x96,0x40,0x86,0x2f,0x3a,0xc9,0xe3,0x88,0xd7,0x1e,0x14,0x3f,0x23,0xd9,0xe9,0x0e,0xdf,0x72,0x8a,0xca,0x58,0xcb,0x10,0x9a,0xd8,0xf4,0x26,0x06,0x45,0xe2,0xf7,0x88,0x28,0x68,0x3a,0x38,0x42,0x78,0x14,0xc1,0xb6,0xa9,0x13,0x26,0xfc,0xed,0x16,0x68,0xfe,0xa4,0xe1,0xab,0x42,0x9c,0xe6,0xe0,0xc1,0x51,0xe8,0xd9,0xa9,0xfd,0xfc,0x35,0x91,0x06,0xe2,0xe7,0x54,0x91,0x8d,0x21,0x29,0x72,0xb7,0x39,0x90,0x66,0x58,0x48,0x66,0x47,0x81,0xbc,0x1e,0x6a,0x0f,0xe4,0x60,0xdd,0x9a,0x4e,0x5b,0x6c,0x00,0x24,0xa2,0xfc,0x9f,0x65,0x62,0x85,0x4c,0x7e,0xa6,0x58,0x79,0x9e,0x78,0xe3,0x65,0xa6,0xd7,0x50,0x84,0x72,0x16,0x56,0x82,0x56,0x0a,0xfc,0x42,0x13,0xc7,0xb4,0x69,0xf2,0x52,0x00,0x70,0xfb,0x71,0x42,0xb1,0x49,0xd5,0x67,0x2e,0x0b,0xb2,0x55,0x2b,0x81,0x57,0x5a,0xe5,0xc4,0x52,0x22,0xc3,0x51,0xe7,0x1b,0x69,0x3e,0x18,0x60,0x5e,0xb1,
+0x02,0xa4,0xad,0x8d,0xaf,0x1f,0xf1,0xa7,0xf6,0xb5,0xe3,0x77,0x49,0x92,0x37,0x72,0xae,0x40,0x4c,0xe4,0x26,0x25,0x2f,0x5b,0xb5,0x57,0xc2,0x56,0x34,0x3a,0x0b,0x15,0x49,0xf6,0xd3,0xdc,0x0f,0xaa,0x81,0xe3,0xde,0xad,0xcd,0x2f,0x9b,0xe1,0xf6,0xde,0xa2,0x69,0x45,0x6d,0xb4,0x58,0x16,0xce,0xb4,0xc9,0xff,0x85,0x5d,0xc6,0x16,0xa8,0x0f,0xfa,0x40,0x70,0x5d,0xb8,0x78,0x70,0xbf,0x0e,0x1a,0x0f,0x05,0x35,0x9c,0x1b,0x4e,0xb4,0x87,0x02,0x15,0xc9,0x88,0x60,0xa3,0xde,0x13,0x36,0x2a,0xd7,0xde,0xb9,0xa2,0x0b,0xa4,0xb4,0x16,0xa7,0x6a,0x06,0x1a,0x62,0x05,0xeb,0xc3,0xeb,0x01,0x55,0xd3,0x93,0xc3,0xf5,0xe2,0xab,0xe8,0x98,0xe8,0x31,0x3e,0xe9,0xb5,0xe9,0x0a,0xc1,0xbf,0x11,0xb7,0x51,0xab,0x2b,0x9d,0x18,0xf1,0xf4,0x25,0xc5,0x18,0x91,0x07,0xab,0xbb,0x3d,0xcf,0x41,0x30,0xd7,0x3a,0x46,0x6c,0x0d,0x85,0x3b,0x0a,0xc6,0x4f,0x04,0x79,0xc1,0xd6,0xf7,0x73,0x90,0x5c,0x50,0xd2,0x21,0x42,0x75,0x2f,0x34,0x50,0x41,0xff,0x86,0x37,0x00,0x62,0x11,0x3f,0x7b,0xf1,0x82,0xb7,0x61,0xc2,0x83,0xb8,0xab,0x85,0xee,0x2e,0x6f,0xf7,0xea,0xcd,0x21,0x1d,0x49,0x13,0xc8,0x0a,0xe4,0x31,0x71,0x3e,0x69,0xc9,0xcb,0x1e,0xb0,0x26,0x6b,0x90,0xd4,0xfa,0x4d,0x4f,0xce,0x52,0x09,0x88,0x32,0x75,0x6f,0x78,0xda,0x40,0x88,0x97,0x3c,0xa0,0x4a,0x32,0x3a,0x0b,0x01,0x83,0xe4,0x38,0x26,0xa4,0x02,0xf1,0x44,0x12,0xa8,0x62,0xd2,0x7b,0xc3,0x26,0x85,0xc8,0x73,0xe3,0x21,0xf2,0x9c,0xd7,0xf9,0x10,0x03,0xb7,0x52,0xc1,0x93,0x49,0x3d,0x31,0x05,0xe5,0x7e,0xda,0xb0,0xbd,0xa3,0xef,0xb9,0x97,0xd7,0x2c,0x10,0xc4,0xaa,0x50,0x0f,0xb1,0x06,0x63,0xf1,0xf5,0xd5,0xab,0xeb,0xd3,0x16,0xf5,0x6f,0xbc,0x78,0x32,0xf6,0x13,0xcd,0x84,0xf9,0x6e,0xe0,0xd6,0xe3,0xd1,0xee,0x36,0x7c,0x1a,0x8c,0x72,0x0e,0xc3,0xb3,0xaf,0x42,0x8b,0x24,0x26,0xbd,0x67,0x0b,0x46,0xe9,0xc3,0x61,0xe4,0xa4,0x80,0x18,0x31,0xa3,0x2e,0xf3,0x69,0xed,0xf5,0xf0,0x02,0x47,0x5a,0xf7,0x7f,0x68,0x49,0xef,0xd8,0x52,0x12,0xd8,0x89,0x8e,0x09,0xd1,0x2e,0xf8,0xa4,0xf5,0x8c,0x72,0x46,0xee,0xda,0xf5,0xa2,0x0c,0x44,0xfb,0x2d,0x13,0x08,0x86,0x18,0x5c,0x11,0x60,0x57,0x8e,0xe8,0xb1,0x8b,0x8f,0x33,0x9c,0xdc,0x03,0x46,0xaf,0xde,0x30,0xd4,0x14,0x16,0xe0,0x38,0xe6,0x63,0xff,0x75,0x8d,0xeb,0xe8,0xa7,0x1d,0x2a,0xd2,0x89,0x9c,0x1d,0xf0,0x07,0xa1,0xfa,0x37,0x0e,0xa8,0x21,0x5e,0x34,0x17,0x62,0xf7,0x6a,0xbf,0xc3,0x05,0x83,0xa1,0x27,0x90,0x41,0xd6,0xcd,0x0a,0xe0,0x43,0x5f,0x24,0xf0,0x81,0x04,0x2a,0xca,0x23,0x39,0xc2,0xb9,0x5e,0x83,0x2e,0x68,0xfa,0x57,0x81,0x39,0x21,0xcf,0x32,0x10,0x28,0x72,0xcd,0x31,0xee,0x94,0x59,0x3c,0x3b,0xcd,0xe7,0xa7,0x59,0x7c,0x6f,0xfc,0x71,0x50,0x47,0xbf,0xc5,0x48,0x85,0x32,0xb1,0xba,0x24,0xc9,0x07,0xda,0xab,0x1c,0x11,0xf0,0xef,0x96,0x80,0xb9,0x74,0x79,0x41,0xc6,0xdd,0xa5,0xd9,0xad,0x46,0x38,0x5a,0x1d,0xc4,0xea,0x2a,0xdb,0xa9,0x4e,0xa9,0x37,0x34,0x71,0x1b,0x02,0x15,0xd2,0x54,0xe0,0x83,0xde,0xa9,0x01,0x33,0x56,0x80,0xb1,0xce,0x0b,0x9f,0xa7,0x03,0xee,0xaa,0x0d,0x9c,0xf4,0x04,0xf9,0x8c,0x9e,0x25,0x7a,0xaf,0x09,0x52,0xb1,0x57,0xa0,0xa7,0x4f,0xbb,0xc2,0xdf,0x15,0xa5,0xe9,0xd5,0x2c,0x1e,0x75,0x25,0x41,0x03,0x0c,0x94,0x3d,0xdd,0xbd,0xa0,0x2a,0x2d,0x62,0xa6,0x8b,0x93,0xc0,0x11,0xdb,0xd0,0xaa,0xe3,0xfc,0x72,0xf8,0xd5,0xf6,0xe7,0xd9,0xec,0xbc,0xd7,0xe8,0x1f,0xbf,0xc3,0x83,0x13,0xb6,0xa4,0x23,0xaa,0xbe,0xa8,0xff,0x45,0x6f,0x02,0x18,0xa9,0x21,0xd2,0x5e,0xe4,0xf8,0xb3,0x7d,0xd3,0x88,0xa0,0x1f,0xe7,0x0a,0x85,0x95,0x8f,0x39,0xde,0xea,0x64,0xa3,0x08,0x19,0x16,0x85,0xaf,0x40,0x84,0x13,0x12,0xa4,0x13,0x50,0x96,0x7b,0x20,0xd6,0xfa,0x9d,0xcf,0x08,0xd3,0x43,0xf3,0xc3,0x52,0x07,0x0f,0x04,0x48,0x09,0xe0,0xee,0x58,0x90,0x9b,0x33,0x05,0x33,0x86,0xc2,0xd7,0x12,0xa0,0x40,0xd6,0x0e,0x00,0x13,0xe7,0xab,0xd2,0x23,0xe1,0x01,0x6b,0x07,0x21,0x03,0x12,0xf4,0x35,0x90,0x85,0xb1,0xa0,0x0e,0xbd,0x8e,0x25,0xff,0x40,0xab,0x97,0x9d,0x2d,0x86,0x1f,0x9a,0x1f,0xf7,0xee,0x2e,0x3f,0xb7,0xe5,0xf8,0x83,0x1a,0x85,0x0b,0x48,0xc7,0x83,0x4b,0xd0,0x2a,0x20,0x34,0x6e,0xd5,0x1f,0xb7,0x2d,0xdd,0xe3,0x52,0xda,0xc1,0xf0,0xcd,0x16,0x3e,0xd2,0x0c,0x02,0xe8,0xb5,0x6e,0x8f,0x6a,0x01,0x5c,0xf2,0x71,0x6a,0xf3,0xda,0x36,0x8c,0x45,0xfd,0xe6,0xcd,0xa7,0xb9,0x86,0x5f,0x22,0xd0,0x3c,0x9c,0x38,0x7d,0x18,0x84,0x48,0x01,0x68,0x1e,0x54,0x80,0xa3,0x5b,0x9c,0x4d,0x93,0x0e,0x0a,0x92,0x58,0xc8,0xa6,0xec,0xbb,0x68,0xd8,0x47,0x3d,0xd9,0x42,0x9d,0x29,0x02,0x4a,0xe2,0x28,0x8a,0x7f,0x84,0x02,0xd2,0x88,0x13,0xc9,0xfb,0xc3,0xce,0x5d,0xdf,0x5e,0x72,0x1c,0x2a,0x22,0x6c,0x0d,0x54,0xa0,0x03,0x70,0x20,0x85,0x6a,0x56,0xba,0x1c,0x50,0x2e,0x6a,0xa5,0xb7,0x84,0x3a,0xd3,0xf1,0x3a,0xd5,0x74,0x40,0x81,0x51,0x30,0x05,0x07,0x06,0x7f,0x8a,0xb7,0xda,0xed,0x54,0x61,0x20,0xa8,0xe5,0x43,0xa4,0xa0,0x80,0xa0,0x56,0x14,0xe4,0xa2,0x54,0x0b,0x2a,0xef,0xff,0x74,0xf7,0xb6,0x89,0x2d,0x43,0x80,0x40,0x8c,0xb7,0xfb,0xaf,0xe7,0x58,0x0f,0x91,0xec,0xee,0xec,0xcc,0xac,0xc4,0x07,0x78,0x15,0x7a,0x80,0xff,0xfd,0x0a,0x4e,0xf5,0x57,0xf0,0xfb,0x97,0x50,0x56,0x1a,0x9e,0x05,0xd3,0x10,0x0a,0x91,0xf7,0x40,0x21,0x7a,0xeb,0x5d,0x88,0x74,0x5a,0x88,0x68,0x23,0xf6,0x25,0x96,0xe2,0x45,0xbf,0x52,0xbc,0x85,0x52,0x2c,0xdc,0x8c,0x8c,0x21,0xcd,0xe8,0x50,0x69,0x46,0x1a,0x34,0x23,0x39,0xed,0x78,0xa7,0x11,0xd6,0x47,0xa0,0x1d,0x8b,0x01,0x92,0x8c,0xc8,0xb1,0x14,0x90,0x9c,0xdf,0x1e,0x00,0x24,0xbf,0x06,
+0xc9,0x68,0xa2,0x6f,0x49,0x2e,0x4c,0x9e,0x0c,0x4a,0x0f,0xed,0xa0,0x94,0xc2,0xf2,0xca,0x30,0x68,0x01,0x2c,0x77,0xa4,0xc2,0x72,0x83,0x85,0xe5,0xbf,0x30,0x98,0x8c,0x71,0x30,0x19,0xc5,0x0f,0x8e,0x66,0xf1,0xc0,0xd1,0xcc,0x87,0xd1,0xac,0x69,0x38,0xd5,0x60,0x38,0x4d,0x1e,0x1b,0x4e,0x13,0xfe,0x70,0xea,0x30,0xe3,0xf9,0x4e,0xf2,0x78,0x9e,0x01,0x47,0xac,0x56,0x14,0xad,0xb9,0x73,0x2f,0xed,0xe1,0xf3,0x09,0x0a,0x9a,0xe5,0x3e,0x43,0x50,0x8c,0x56,0xd5,0x7c,0x3f,0x90,0x51,0xb1,0xc2,0x9f,0x59,0xd2,0x28,0x1a,0xe3,0x33,0xef,0x52,0xa0,0x68,0x78,0x24,0x95,0x29,0x95,0xa4,0x0a,0x74,0x42,0x9d,0x02,0x49,0xf5,0x54,0x9a,0xce,0x01,0x9a,0xce,0xf0,0x3f,0xff,0x02,0x9a,0xce,0xe0,0x13,0x95,0x9a,0x24,0xa2,0x92,0x8e,0x3d,0x8a,0x57,0x6d,0x27,0x6e,0x2b,0x55,0xbb,0x92,0x4e,0xd5,0xd2,0xde,0xe2,0x03,0x55,0x1b,0xf6,0x21,0xab,0x4f,0xc2,0x64,0xf5,0x1e,0xc8,0x6a,0xd2,0xde,0x53,0x86,0xac,0xe6,0xd2,0xf5,0x86,0x2c,0xba,0x7e,0x06,0x5f,0x0b,0x74,0x3d,0x23,0x58,0x00,0xee,0xde,0x4a,0x10,0x2c,0xe8,0x21,0x4b,0x07,0x05,0x8b,0x4e,0xc9,0x26,0x97,0x2b,0xd9,0xe4,0x73,0x5a,0xe1,0x58,0xc9,0x86,0x2f,0x5a,0xed,0x75,0x22,0x5a,0x0d,0x15,0x2b,0xf4,0x00,0x45,0xa2,0xf9,0xb4,0x2a,0x5a,0xbd,0x24,0x1c,0xd9,0x6e,0xf9,0x80,0x6c,0x17,0x51,0xd9,0x0e,0x1f,0xe8,0x03,0x20,0x9d,0xad,0xb6,0x0b,0x97,0xc6,0x97,0x70,0x99,0x8b,0x0a,0x97,0xce,0x95,0x9e,0x1f,0xad,0x00,0xb6,0x01,0x2a,0xc0,0x9e,0x05,0x4e,0xb3,0x76,0xe9,0x36,0x24,0x72,0x6c,0xd4,0xab,0xfe,0x92,0xcf,0x86,0xb5,0x96,0x50,0x9a,0x90,0x02,0xeb,0x26,0xf1,0x3a,0xc0,0x1c,0x76,0xe5,0x88,0xd7,0xd4,0xc8,0xb1,0x6c,0x11,0xaf,0x51,0xbe,0xc7,0x36,0x12,0x35,0xc8,0xf7,0xd7,0xa4,0x0b,0xff,0x24,0x3e,0x91,0xef,0x4f,0x93,0xba,0x8d,0x63,0x83,0xf2,0xfd,0xa9,0x9f,0x81,0x21,0x86,0x9b,0xad,0x51,0x83,0x56,0xd4,0x02,0x11,0xf2,0xc2,0xa6,0x7e,0xe6,0x25,0x1a,0x16,0x48,0x3f,0xa9,0xe2,0x74,0x25,0x6f,0xa8,0xdc,0x68,0xe1,0x38,0x37,0x58,0x38,0x16,0x77,0x2c,0xae,0x15,0x5b,0xe6,0x00,0x85,0xa6,0x53,0xc7,0xdf,0x02,0x20,0xea,0xed,0xcb,0x4c,0x74,0x1e,0x71,0x5b,0xfc,0xd4,0x42,0xe2,0xc1,0x7c,0x61,0xfd,0x22,0xa6,0xff,0x0d,0xc6,0xf5,0x3f,0x51,0xe0,0x98,0xef,0xff,0xc2,0xec,0x34,0xb1,0x5c,0x4a,0xcc,0xa8,0xb1,0x55,0x31,0xb1,0xb0,0xf8,0x31,0x1d,0x71,0x6d,0x3c,0x56,0xd9,0x11,0x56,0x46,0x5e,0x0f,0x5a,0xe8,0x14,0x0f,0x68,0xe6,0x56,0x19,0x26,0x8d,0x88,0x67,0x0b,0x8d,0x4c,0x6e,0x0d,0xf7,0x9a,0x4b,0xb7,0x6c,0x89,0x63,0xd2,0x6c,0x64,0x4a,0x79,0x46,0x26,0x0c,0xc6,0xca,0x95,0x33,0xb9,0x96,0xae,0x5e,0xca,0x5a,0xe8,0xee,0x9e,0xc9,0xd0,0x9c,0x58,0xb9,0x3c,0xfc,0x55,0xf9,0x9e,0xc2,0x5e,0x66,0xb6,0x5d,0x72,0x39,0xda,0x6b,0x4d,0x93,0x67,0x66,0xc3,0x40,0x3b,0x5f,0x96,0x0f,0x1f,0x4c,0xf2,0x8c,0xd8,0x7e,0x06,0xd8,0xf9,0x30,0xd0,0xd0,0x18,0x0b,0x1a,0x1a,0xa3,0x61,0x86,0x46,0x0c,0xb4,0x74,0x9a,0x83,0x7c,0xf5,0x6b,0x52,0x11,0x97,0x7c,0x4b,0x27,0x3f,0x76,0xb4,0xbe,0xb9,0xa1,0xd1,0x73,0x1e,0xf3,0x4e,0xb4,0x66,0x9a,0x1c,0x53,0x6b,0xcf,0x30,0xa8,0xad,0xf7,0xd5,0xdf,0xf7,0xf9,0x74,0xe0,0xeb,0xd4,0xd6,0x3b,0x11,0xb0,0xf5,0x42,0xb0,0xc6,0xe6,0x0b,0xf7,0xb7,0xdf,0xdc,0x8d,0xcd,0xd1,0x14,0x1e,0x0b,0x8c,0xcd,0x02,0xe1,0xcc,0xf4,0xaf,0x3b,0xdd,0x35,0xa9,0x1b,0xe7,0x9b,0x76,0xaf,0x0a,0xb6,0x83,0x27,0xb8,0x82,0xb5,0x5b,0x28,0x52,0x5f,0x69,0x23,0xad,0xd4,0xa9,0x09,0xe6,0x76,0xc5,0x4d,0x6b,0x15,0x0d,0xcd,0xed,0xe2,0x3b,0x2f,0x8c,0xb5,0xfb,0x3d,0x6e,0xb2,0xf7,0x7b,0x23,0x8e,0xbd,0x5f,0x5a,0xa8,0x6c,0x5b,0xf0,0x53,0x66,0xc1,0x21,0x83,0x05,0x87,0x01,0x31,0x4e,0x2f,0x3b,0x9e,0x13,0x1e,0x57,0x3c,0xfc,0x40,0x65,0xaf,0xa5,0x45,0xee,0xa4,0x98,0x13,0xe9,0x35,0xee,0xbc,0x37,0x6a,0x46,0xae,0x9c,0x62,0xd9,0xee,0xe6,0xc3,0x6b,0x38,0xe3,0xb4,0x20,0xb7,0x22,0x10,0xa6,0x17,0xd6,0x9d,0xff,0x3a,0x39,0xdc,0xd7,0x7c,0xc6,0x5d,0x6b,0x3e,0xd7,0xad,0xd8,0xbd,0x87,0x7a,0x26,0x10,0x39,0xf5,0x3d,0x17,0xe3,0x91,0x58,0x24,0x34,0xb1,0x36,0xa6,0xc0,0x37,0x8c,0xcd,0x8c,0xa2,0xa4,0xc3,0x48,0x38,0xa6,0x0b,0x85,0x00,0xbd,0x2c,0x95,0xb0,0xec,0x26,0x14,0xdb,0x15,0xc5,0x9a,0xf6,0x4d,0x1d,0x70,0x7a,0x99,0xeb,0x7e,0xe1,0x77,0x79,0xcd,0xcc,0x9e,0xbd,0x38,0xbb,0x63,0xe4,0xb5,0x27,0x67,0xcf,0xd6,0xfe,0xfe,0xc2,0x38,0x3c,0x1b,0x9d,0xad,0xf0,0x1c,0xc6,0x3f,0xfd,0x20,0x90,0x56,0xf0,0x92,0x93,0xfe,0xb3,0xdd,0xbc,0xd8,0x37,0x6f,0x37,0x4f,0xea,0x4b,0xaf,0xaa,0xcc,0x9a,0xbb,0xbb,0x29,0x3f,0x00,0x58,0x99,0xaf,0x8f,0x45,0x90,0xe6,0x53,0x95,0xb4,0xa2,0x3c,0x0d,0x8a,0xe3,0x1a,0xd6,0x7e,0x6f,0x4f,0x58,0xfb,0x0d,0x7d,0xba,0x65,0xc7,0x5f,0x7c,0x7e,0xd6,0xae,0xeb,0x64,0xbf,0x9a,0xcd,0x4b,0xde,0xea,0x37,0xb4,0x4c,0xe9,0x31,0x71,0x96,0x71,0xfb,0xf2,0x7b,0x2c,0xb6,0xfc,0x2e,0xbe,0xfe,0xaf,0x7c,0x92,0x4d,0xca,0x43,0xeb,0xff,0x7f,0x01,0x99,0xf5,0x84,0x8a,0x03,0x93,0xb8,0xb3,0x00,0x00,0x00,0x00,0x49,0x45,0x4e,0x44,0xae,0x42,0x60,0x82
+};
+
+const web_asset_t web_assets[WEB_ASSETS] = {
+    {"/index.html", "text/html", "\"f91d5068\"", web_asset_0, 2619, true, false},
+    {"/style.07c359af.css", "text/css", "\"07c359af\"", web_asset_1, 16630, true, true},
+    {"/app.5183a0d2.js", "application/javascript", "\"5183a0d2\"", web_asset_2, 5678, true, true},
+    {"/favicon.4f3071ec.png", "image/png", "\"4f3071ec\"", web_asset_3, 2791, false, true},
+    {"/logo.98cfb903.png", "image/png", "\"98cfb903\"", web_asset_4, 2910, false, true},
+};
@@ -29,6 +29,132 @@
 
 #define POWERUP_MODE POWERUP_OFF
 
+/**
+ * Easing curve used for transitions. Options are EASING_LINEAR,
+ * EASING_EASE_IN_OUT (slow start and end) and EASING_PERCEPTUAL (evenly
+ * perceived change in lightness, avoids a sudden jump at low levels).
+ */
+#define LIGHT_TRANSITION_EASING EASING_LINEAR
+
+/**
+ * The state of the light is saved the given period (in milliseconds) after
+ * the first change since the last save, so a burst of commands results in a
+ * single write to flash. States are journaled over a number of flash sectors
+ * (at least 2) to spread the wear.
+ */
+#define LIGHT_STATE_SAVE_DELAY 5000
+#define LIGHT_STATE_SECTORS 2
+
+/**
+ * Commands are queued by the network callbacks and processed by the main loop.
+ * Commands queued in the meantime are merged (up to the given number per loop
+ * iteration), so a burst of commands is applied as a single change.
+ */
+#define LIGHT_COMMAND_BUDGET 8
+
+/**
+ * Changes are rendered into a frame buffer that is sent to the LED driver by
+ * the main loop at most at the given refresh rate (in Hz), capping the time
+ * spent on the LED driver during fast fades. Frames rendered in between are
+ * skipped. Set to 0 to send each change right away.
+ */
+#define LIGHT_REFRESH_RATE 100
+
+/**
+ * Realtime streaming
+ * --------------------------
+ * Colour streams (e.g. for music synchronisation or ambient lighting) can be
+ * received using the Distributed Display Protocol (DDP) over UDP. This light
+ * takes its levels from the channels of the stream starting at the given
+ * offset (3 channels for RGB, 4 for RGBW), so a single stream can drive a
+ * group of lights. Once no frames have been received for the given timeout (in
+ * milliseconds), the light returns to its previous state.
+ */
+#define REALTIME_ENABLED false
+#define REALTIME_PORT 4048
+#define REALTIME_OFFSET 0
+#define REALTIME_CHANNELS 3
+#define REALTIME_TIMEOUT 2500
+
+/**
+ * Command recorder
+ * --------------------------
+ * The light commands received (with the time of reception and the source) can
+ * be kept in a ring buffer of the given size (in bytes; 0 disables recording),
+ * the oldest records making way for new ones. The log can be downloaded with
+ * the REST API (GET /api/recording) and replayed on the host with the native
+ * environment ('program replay <log>') to reproduce what the light rendered.
+ */
+#define RECORDER_SIZE 0
+
+/**
+ * Group synchronisation
+ * --------------------------
+ * Lights sharing a group topic (set in the Web UI) keep a shared clock by UDP
+ * multicast, so commands published on the group topic start on all lights at
+ * the same instant: the given delay (in milliseconds) after the group leader
+ * receives them. The delay must exceed the spread in the time the lights
+ * receive a command from the MQTT broker.
+ */
+#define GROUP_MULTICAST_ADDRESS 239, 255, 65, 76
+#define GROUP_PORT 4049
+#define GROUP_START_DELAY 150
+
+/**
+ * WebSocket
+ * --------------------------
+ * Changes of the light state are pushed to the Web UI at most the given number
+ * of times per second (0 pushes each change right away), each push holding
+ * only the attributes a client hasn't been sent yet. A client that can't keep
+ * up is skipped until it has caught up, instead of queueing stale states. The
+ * number of clients is limited to the given maximum.
+ */
+#define WS_PUSH_RATE 20
+#define WS_CLIENTS_MAX 4
+
+/**
+ * Received WebSocket messages are assembled in a static buffer of the given
+ * size (in bytes). Longer messages are ignored.
+ */
+#define WS_MESSAGE_SIZE 1536
+
+/**
+ * Server-Sent Events
+ * --------------------------
+ * While the REST API is enabled, changes of the light state are streamed to
+ * the clients of '/events' (given the API Key as header or as 'api_key' query
+ * parameter) at most the given number of times per second, each event holding
+ * the state and its version as event id. The telemetry summary is sent every
+ * given number of seconds (0 to disable).
+ */
+#define EVENTS_PUSH_RATE 4
+#define EVENTS_TELEMETRY_INTERVAL 10
+
+/**
+ * REST API batches
+ * --------------------------
+ * Several light commands can be posted at once as a JSON array to
+ * '/api/batch'. The size of a batch (in bytes, the size of the buffer holding
+ * it while received, which is only allocated while the REST API is enabled)
+ * and the number of commands it holds are limited to the given maximums.
+ * Larger batches are rejected (413 Payload Too Large), and a batch posted
+ * while another is received is to be retried (503). The size also limits the
+ * commands sent to '/api/light'.
+ */
+#define API_BATCH_SIZE 2048
+#define API_BATCH_COMMANDS 16
+
+/**
+ * Metrics
+ * --------------------------
+ * The metrics (durations of the main loop and of processing commands, heap
+ * usage, queue depths, reconnects, etc.) are available in the Prometheus text
+ * format with the REST API (GET /api/metrics). Optionally, a summary is
+ * published periodically to the '<state topic>/metrics' MQTT topic. Set the
+ * interval (in seconds) to 0 to disable.
+ */
+#define METRICS_TELEMETRY_INTERVAL 0
+
 /**
  * LedDriver
  * --------------------------
@@ -38,6 +164,17 @@
 #define MY92XX_TYPE MY92XX_MODEL_MY9291
 #define MY92XX_COUNT 1
 
+/**
+ * Fixture
+ * --------------------------
+ * Optionally, describe the LED driver chains and the channel mapping of the
+ * light (overrides the type and number of chips above). Chains are separated
+ * by ';', each given as '<model>x<chips>@<di pin>,<dcki pin>:<map>' with a
+ * character for every channel: R, G, B, W (white), c/w (cold/warm white, mixed
+ * by the colour temperature) or - (off). Can be changed in the Web UI.
+ */
+// #define MY92XX_FIXTURE "MY9231x2@13,15:RGBWW-"
+
 /**
  * OTA (Over The Air) Updates
  * ---------------------------
@@ -55,6 +192,23 @@
 #define WIFI_PSK ""
 #define WIFI_OUTPUT_POWER 1.0 // 20.5 is the maximum output power
 
+/**
+ * Connecting to the WiFi network doesn't hold up the boot: the light is
+ * restored first and the connection is made in the background. If no
+ * connection can be made within WIFI_CONNECT_TIMEOUT, the device switches to
+ * Soft AP mode.
+ *
+ * The channel and BSSID of the access point are cached, so reconnecting (and
+ * the next boot) skips the scan for it. If the cached access point can't be
+ * reached within WIFI_CACHE_TIMEOUT, it is scanned for as usual. Set
+ * WIFI_CACHE_IP to true to also reuse the IP configuration of the last
+ * connection, skipping DHCP (only if your DHCP server always hands out the
+ * same address to your Smart Light).
+ */
+#define WIFI_CONNECT_TIMEOUT 10000 // Timeout (in milliseconds)
+#define WIFI_CACHE_TIMEOUT 3000    // Timeout (in milliseconds)
+#define WIFI_CACHE_IP false
+
 /**
  * Timeout period for the device to keep trying to (re)connect to the
  * configured WiFi Access Point. If this timeout period has been reached, the
@@ -79,6 +233,21 @@
 #define MQTT_RETAIN false
 #define MQTT_KEEPALIVE 30
 
+/**
+ * Messages are queued and published by the main loop, keeping only the newest
+ * message of each topic. The state is published at most once per the given
+ * interval (in milliseconds), and again (with the availability) on each
+ * reconnect. The QoS level and retain flag of the state and availability can
+ * be changed in the UI environment.
+ */
+#define MQTT_PUBLISH_INTERVAL 250
+
+/**
+ * Received MQTT messages spanning multiple packets are assembled in a static
+ * buffer of the given size (in bytes). Longer messages are ignored.
+ */
+#define MQTT_MESSAGE_SIZE 1536
+
 #define MQTT_PAYLOAD_ON "ON"
 #define MQTT_PAYLOAD_OFF "OFF"
 
@@ -96,6 +265,15 @@
  */
 #define MQTT_HOMEASSISTANT_DISCOVERY_PRE_0_84 false
 
+/**
+ * Home Assistant 2021.4 introduced colour modes: the light is announced with
+ * the colour modes it supports (colour temperature, hue/saturation, RGBW and
+ * CIE xy), which are converted on the light itself, and its state holds the
+ * colour mode in use. If you are using an older version of Home Assistant and
+ * the MQTT discovery feature, set the following directive to "false"
+ */
+#define MQTT_HOMEASSISTANT_COLOR_MODES true
+
 /**
  * HTTP
  * ---------------------------
@@ -0,0 +1,224 @@
+/**
+ * AiLight Firmware - Configuration
+ *
+ * The configuration structure, the fields of it stored by the ConfigStore and
+ * the migration of configurations stored before the ConfigStore (see
+ * _config.ino). Kept apart from main.h so the native benchmarks can check the
+ * stored format on the host.
+ *
+ * Tags are never to be reused or renumbered. When the meaning of a stored
+ * field changes (e.g. its unit), increment CONFIG_VERSION and add a migration
+ * from the previous version to CONFIG_MIGRATIONS (see _config.ino).
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_configuration_h
+#define AiLight_configuration_h
+
+#include "Color.hpp"
+#include "ConfigStore.hpp"
+#include "Fixture.hpp"
+#include <stddef.h>
+#include <stdio.h>
+
+#define INIT_HASH 0x5F // Marks a configuration stored as raw config_legacy_t
+#define CONFIG_VERSION 1
+
+// Marks a valid cache of the WiFi connection parameters
+#define WIFI_CACHE_MAGIC 0xA5
+
+// Parameters of the last WiFi connection, so a reconnect (or the next boot)
+// can skip the scan for the access point and (optionally) DHCP
+struct wifi_cache_t {
+  uint8_t magic;    // WIFI_CACHE_MAGIC if valid
+  uint8_t channel;  // Channel of the access point
+  uint8_t bssid[6]; // BSSID (MAC address) of the access point
+  uint32_t ip;      // IP address, gateway, subnet mask and DNS server
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+};
+
+// Configuration structure that gets stored to the EEPROM (encoded by the
+// ConfigStore, see _config.ino)
+struct config_t {
+  bool is_on;                 // Operational state (true == on)*
+  uint8_t brightness;         // Brightness level*
+  uint16_t color_temp;        // Colour temperature (in mired)*
+  Color color;                // RGBW channel levels*
+  uint16_t mqtt_port;         // MQTT Broker port
+  char hostname[128];         // Hostname/Identifier
+  char wifi_ssid[33];         // WiFi SSID
+  char wifi_psk[65];          // WiFi Passphrase Key
+  char mqtt_server[128];      // Server/hostname of the MQTT Broker
+  char mqtt_user[64];         // Username used for connecting to the MQTT Broker
+  char mqtt_password[64];     // Password used for connecting to the MQTT Broker
+  char mqtt_state_topic[128]; // MQTT Topic for publishing the state
+  char mqtt_command_topic[128]; // MQTT Topic for receiving commands
+  char mqtt_lwt_topic[128];     // MQTT Topic for publishing Last Will and
+  // Testament
+  bool gamma;                 // Gamma Correction enabled or not
+  bool mqtt_ha_use_discovery; // Home Assistant MQTT discovery enabled or not
+  bool mqtt_ha_is_discovered; // Has this device already been discovered or
+  // not
+  char mqtt_ha_disc_prefix[32]; // MQTT Discovery prefix for Home Assistant
+  bool api;                     // REST API enabled or not
+  char api_key[32];             // API Key
+  uint8_t powerup_mode;         // Power Up Mode
+  my92xx_model_t chip_type;     // Device Type
+  uint8_t chip_count;
+  fixture_t fixture; // LED driver chains and channel mapping
+  char mqtt_group_topic[128]; // MQTT Topic for receiving group commands
+  uint8_t mqtt_state_publish; // QoS level and retain flag of the state topic
+  uint8_t mqtt_lwt_publish;   // QoS level and retain flag of the LWT topic
+  wifi_cache_t wifi_cache;    // Parameters of the last WiFi connection
+}; // * Defaults only, the light state is persisted by the StateStore
+
+// Configuration as stored before the ConfigStore: config_t dumped as is (only
+// read to be migrated, see migrateConfig())
+struct config_legacy_t {
+  uint8_t ic; // INIT_HASH
+  bool is_on;
+  uint8_t brightness;
+  uint8_t color_temp; // Truncated (mired up to 504)
+  Color color;
+  uint16_t mqtt_port;
+  char hostname[128];
+  char wifi_ssid[32];
+  char wifi_psk[63];
+  char mqtt_server[128];
+  char mqtt_user[64];
+  char mqtt_password[64];
+  char mqtt_state_topic[128];
+  char mqtt_command_topic[128];
+  char mqtt_lwt_topic[128];
+  bool gamma;
+  bool mqtt_ha_use_discovery;
+  bool mqtt_ha_is_discovered;
+  char mqtt_ha_disc_prefix[32];
+  bool api;
+  char api_key[32];
+  uint8_t powerup_mode;
+  my92xx_model_t chip_type;
+  uint8_t chip_count;
+  fixture_t fixture;          // The fields from here on were appended over
+  char mqtt_group_topic[128]; // time, so may not have been stored (0xFF)
+  uint8_t mqtt_state_publish;
+  uint8_t mqtt_lwt_publish;
+  wifi_cache_t wifi_cache;
+};
+
+#define CONFIG_FIELD(tag, type, field)                                         \
+  { tag, type, offsetof(config_t, field), sizeof(config_t::field) }
+
+// The fields of the configuration as stored
+static const config_field_t CONFIG_FIELDS[] = {
+    CONFIG_FIELD(1, CONFIG_FIELD_BINARY, is_on),
+    CONFIG_FIELD(2, CONFIG_FIELD_BINARY, brightness),
+    CONFIG_FIELD(3, CONFIG_FIELD_BINARY, color_temp),
+    CONFIG_FIELD(4, CONFIG_FIELD_BINARY, color),
+    CONFIG_FIELD(5, CONFIG_FIELD_BINARY, mqtt_port),
+    CONFIG_FIELD(6, CONFIG_FIELD_STRING, hostname),
+    CONFIG_FIELD(7, CONFIG_FIELD_STRING, wifi_ssid),
+    CONFIG_FIELD(8, CONFIG_FIELD_STRING, wifi_psk),
+    CONFIG_FIELD(9, CONFIG_FIELD_STRING, mqtt_server),
+    CONFIG_FIELD(10, CONFIG_FIELD_STRING, mqtt_user),
+    CONFIG_FIELD(11, CONFIG_FIELD_STRING, mqtt_password),
+    CONFIG_FIELD(12, CONFIG_FIELD_STRING, mqtt_state_topic),
+    CONFIG_FIELD(13, CONFIG_FIELD_STRING, mqtt_command_topic),
+    CONFIG_FIELD(14, CONFIG_FIELD_STRING, mqtt_lwt_topic),
+    CONFIG_FIELD(15, CONFIG_FIELD_BINARY, gamma),
+    CONFIG_FIELD(16, CONFIG_FIELD_BINARY, mqtt_ha_use_discovery),
+    CONFIG_FIELD(17, CONFIG_FIELD_BINARY, mqtt_ha_is_discovered),
+    CONFIG_FIELD(18, CONFIG_FIELD_STRING, mqtt_ha_disc_prefix),
+    CONFIG_FIELD(19, CONFIG_FIELD_BINARY, api),
+    CONFIG_FIELD(20, CONFIG_FIELD_STRING, api_key),
+    CONFIG_FIELD(21, CONFIG_FIELD_BINARY, powerup_mode),
+    CONFIG_FIELD(22, CONFIG_FIELD_BINARY, chip_type),
+    CONFIG_FIELD(23, CONFIG_FIELD_BINARY, chip_count),
+    CONFIG_FIELD(24, CONFIG_FIELD_BINARY, fixture),
+    CONFIG_FIELD(25, CONFIG_FIELD_STRING, mqtt_group_topic),
+    CONFIG_FIELD(26, CONFIG_FIELD_BINARY, mqtt_state_publish),
+    CONFIG_FIELD(27, CONFIG_FIELD_BINARY, mqtt_lwt_publish),
+    CONFIG_FIELD(28, CONFIG_FIELD_BINARY, wifi_cache)};
+
+#define CONFIG_FIELDS_COUNT (sizeof(CONFIG_FIELDS) / sizeof(CONFIG_FIELDS[0]))
+
+/**
+ * @brief Migrates a configuration stored as raw config_legacy_t (i.e. by
+ * firmware before the ConfigStore) to version 1
+ *
+ * Fields that were not stored yet keep their value in the configuration (i.e.
+ * the defaults).
+ *
+ * @param legacy the stored configuration (read in place, e.g. from the EEPROM
+ * buffer, as a copy would take over a kilobyte of stack)
+ * @param config the configuration to migrate the fields to
+ *
+ * @return void
+ */
+inline void migrateConfig(const config_legacy_t &legacy, config_t &config) {
+#define MIGRATE_VALUE(field) config.field = legacy.field
+#define MIGRATE_STRING(field)                                                  \
+  snprintf(config.field, sizeof(config.field), "%.*s",                        \
+           (int)sizeof(legacy.field), legacy.field)
+
+  MIGRATE_VALUE(is_on);
+  MIGRATE_VALUE(brightness);
+  MIGRATE_VALUE(color_temp); // Values truncated before can't be told apart
+  MIGRATE_VALUE(color);
+  MIGRATE_VALUE(mqtt_port);
+  MIGRATE_STRING(hostname);
+  MIGRATE_STRING(wifi_ssid);
+  MIGRATE_STRING(wifi_psk);
+  MIGRATE_STRING(mqtt_server);
+  MIGRATE_STRING(mqtt_user);
+  MIGRATE_STRING(mqtt_password);
+  MIGRATE_STRING(mqtt_state_topic);
+  MIGRATE_STRING(mqtt_command_topic);
+  MIGRATE_STRING(mqtt_lwt_topic);
+  MIGRATE_VALUE(gamma);
+  MIGRATE_VALUE(mqtt_ha_use_discovery);
+  MIGRATE_VALUE(mqtt_ha_is_discovered);
+  MIGRATE_STRING(mqtt_ha_disc_prefix);
+  MIGRATE_VALUE(api);
+  MIGRATE_STRING(api_key);
+  MIGRATE_VALUE(powerup_mode);
+  MIGRATE_VALUE(chip_type);
+  MIGRATE_VALUE(chip_count);
+
+  // Configurations stored before fixtures were introduced only have the chip
+  // type and count
+  if (FixtureClass::validate(legacy.fixture)) {
+    MIGRATE_VALUE(fixture);
+  } else {
+    config.fixture =
+        FixtureClass::defaults(config.chip_type, config.chip_count);
+  }
+
+  // Nor a group topic, publish options or WiFi cache (kept at their defaults)
+  if ((uint8_t)legacy.mqtt_group_topic[0] != 0xFF) {
+    MIGRATE_STRING(mqtt_group_topic);
+  }
+  if (legacy.mqtt_state_publish != 0xFF) {
+    MIGRATE_VALUE(mqtt_state_publish);
+  }
+  if (legacy.mqtt_lwt_publish != 0xFF) {
+    MIGRATE_VALUE(mqtt_lwt_publish);
+  }
+  if (legacy.wifi_cache.magic == WIFI_CACHE_MAGIC) {
+    MIGRATE_VALUE(wifi_cache);
+  }
+
+#undef MIGRATE_VALUE
+#undef MIGRATE_STRING
+}
+
+#endif
@@ -1,32 +0,0 @@
-#define html_gz_len 28130
-const uint8_t html_gz[] PROGMEM = {
-0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xec,0xbd,0x09,0x93,0xa3,0x4a,0x92,0x30,0xf8,0x57,0x34,0x35,0xdb,0x66,0xaf,0x5a,0x99,0x25,0x40,0xe8,0xca,0xec,0xd7,0xf6,0x81,0xee,0xfb,0x3e,0x67,0xdb,0xd6,0x10,0x20,0x40,0x42,0x20,0x01,0x3a,0x73,0x6b,0x7f,0xfb,0x46,0x70,0x48,0x1c,0x01,0x42,0xaa,0x7a,0xf3,0xed,0xcc,0x4e,0xaa,0xb2,0x52,0x10,0x1e,0xee,0x1e,0xe1,0x1e,0xee,0x1e,0xf7,0x3f,0xfe,0xad,0xd4,0x2d,0x8e,0xe6,0xbd,0x72,0x42,0x34,0xb6,0xf2,0x3f,0xff,0x01,0xff,0x4f,0xc8,0x8c,0x22,0xfc,0xf9,0x8d,0x57,0xbe,0x81,0x67,0x9e,0xe1,0xfe,0xf9,0x8f,0x2d,0x6f,0x30,0x09,0x56,0x64,0x34,0x9d,0x37,0xfe,0xfc,0x76,0x30,0x56,0xef,0xf9,0x6f,0xf6,0x5b,0x85,0xd9,0xf2,0x7f,0x7e,0x3b,0x4a,0xfc,0x69,0xa7,0x6a,0xc6,0xb7,0x04,0xab,0x2a,0x06,0xaf,0x00,0xa8,0x93,0xc4,0x19,0xe2,0x9f,0x1c,0x7f,0x94,0x58,0xfe,0xdd,0x7c,0x78,0x93,0x14,0xc9,0x90,0x18,0xf9,0x5d,0x67,0x19,0x99,0xff,0x13,0x77,0x50,0x88,0x86,0xb1,0x7b,0xe7,0xf7,0x07,0xe9,0xf8,0xe7,0xb7,0xd9,0xfb,0x98,0x7a,0x2f,0xaa,0xdb,0x1d,0x63,0x48,0x4b,0x99,0x77,0xe1,0xab,0x97,0xff,0xe4,0x39,0x81,0xf7,0xd2,0xad,0x31,0x0a,0x27,0xf2,0x32,0x57,0xd1,0x24,0x5e,0xe1,0xe4,0x8b,0x0b,0xde,0xd0,0x0e,0x10,0xd8,0x90,0x0c,0x99,0xff,0x27,0x25,0xb5,0x24,0x41,0x34,0xfe,0x91,0xb2,0x1e,0xff,0x21,0x4b,0xca,0x26,0xa1,0xf1,0xf2,0x9f,0xdf,0x74,0x11,0xb0,0xcd,0x1e,0x8c,0x84,0x04,0x72,0x7e,0x4b,0x88,0x1a,0xbf,0xfa,0xf3,0x1b,0xc7,0x18,0xcc,0x87,0xb4,0x65,0x04,0x3e,0xb5,0x53,0x84,0xcf,0x25,0xa3,0xf3,0x59,0xf2,0x4d,0x9a,0xd0,0xdd,0xc1,0x09,0x6b,0x56,0x05,0x95,0x02,0x3f,0x9d,0xe1,0x58,0x2c,0x8f,0x05,0xf0,0xad,0x0e,0x1f,0x8b,0xe0,0xd3,0x06,0x7f,0x4b,0x18,0xd9,0xa8,0x65,0xe0,0x1b,0x05,0xa7,0xdb,0x93,0xf2,0x18,0xbe,0xeb,0x52,0xb5,0x65,0x8f,0xaa,0xb5,0xec,0xdf,0x9a,0xfd,0xb7,0xe7,0x7c,0xef,0xdb,0x69,0x5d,0xeb,0x5d,0xcb,0xff,0xdb,0xf7,0xfe,0xed,0xd9,0xbf,0xf0,0xb9,0x87,0x48,0x77,0xfe,0xd6,0x7c,0xdf,0x4b,0x43,0xaa,0x7a,0x8d,0xc2,0x0f,0xe1,0xfa,0xde,0xe7,0x96,0xff,0x19,0xfe,0xe6,0x24,0xa5,0x5e,0x31,0x2b,0xa1,0x36,0x18,0x8e,0xe4,0x36,0x45,0xa7,0x46,0x87,0xe3,0x51,0x58,0xaf,0xd7,0x23,0x95,0x14,0xd7,0x25,0x2c,0xbb,0xab,0x4f,0x45,0x82,0xdb,0x5c,0xc9,0xee,0x0c,0xeb,0x4c,0x35,0x4d,0x56,0xf0,0x74,0x5f,0x19,0x8f,0x4f,0xc7,0xf2,0x49,0xcf,0x48,0xea,0x88,0xbb,0x66,0x1b,0xa4,0xc1,0x9e,0xb4,0x55,0x46,0x69,0xec,0x08,0xe3,0x54,0x9e,0xaf,0xb9,0x22,0xa8,0xcf,0x22,0xdb,0x69,0x0c,0xca,0x95,0x31,0xdf,0xd1,0xca,0xd3,0xae,0x9c,0x55,0xd7,0xd4,0x78,0x31,0xa8,0xf4,0x3b,0x62,0x39,0x3d,0xa8,0x8c,0x58,0x63,0xb2,0xe7,0x9a,0x87,0x54,0x6a,0x59,0xea,0x66,0xea,0x3b,0x92,0x52,0xd9,0x5d,0xfb,0x9c,0x3a,0x28,0xca,0x75,0x59,0x3e,0x64,0x4e,0x72,0x9f,0x51,0x27,0xbc,0x72,0x3a,0x0f,0xb4,0xe5,0x68,0xbc,0x1b,0x6f,0xc6,0xdc,0x70,0x3a,0xcf,0x1d,0xab,0x0d,0x8e,0x91,0x53,0xe7,0xfe,0x6c,0x8a,0xe1,0xcd,0x7e,0xae,0xda,0x39,0x35,0x1a,0xc9,0x5e,0x67,0xd7,0x58,0x8c,0x07,0xd5,0x69,0x66,0x91,0xec,0x14,0xc9,0x86,0xb8,0x9f,0x4f,0x58,0xbc,0x94,0xce,0x8f,0x53,0xdb,0x79,0x95,0x18,0x9d,0x4b,0xa7,0x39,0x5e,0x90,0x9b,0x33,0x4c,0x18,0xaf,0x66,0x18,0x7e,0x38,0xab,0xb5,0x72,0xba,0xa1,0x6a,0xb3,0x7c,0xbf,0xbc,0x6a,0xe4,0xeb,0x8b,0x59,0x75,0xae,0x08,0x4d,0x79,0x78,0xa9,0x8d,0x27,0x9d,0xec,0x20,0x2f,0x96,0xe6,0x99,0xc3,0xa6,0xbc,0x62,0x36,0x05,0x6c,0x34,0x62,0x9a,0xe3,0x1d,0x51,0xee,0xed,0x7a,0xc3,0x72,0x6d,0xbd,0xd2,0x85,0xae,0xd1,0x5c,0xce,0x0f,0xd9,0x2d,0xa9,0x14,0x87,0x29,0xa2,0x39,0x3a,0xf1,0xf5,0xd5,0xae,0x5b,0x1a,0x8b,0xf3,0x66,0x7e,0x24,0x36,0xaf,0xad,0x14,0x5e,0x59,0x35,0x99,0xd2,0xb4,0xc3,0xed,0xfb,0x3a,0xb7,0xbd,0xe2,0x8c,0x30,0xac,0xe6,0xbb,0x73,0x22,0x9f,0x2f,0x1c,0x1a,0xe2,0x18,0x13,0xb3,0xb9,0xd3,0xa2,0x76,0x38,0xcd,0x87,0xf3,0xdd,0xa4,0xac,0xcd,0xfa,0x55,0x59,0x63,0x17,0xdd,0x81,0xaa,0x48,0xed,0x8c,0x4a,0x66,0x66,0x99,0x7e,0x27,0x29,0x70,0x53,0x55,0x3f,0x0e,0x44,0x8d,0x50,0xd8,0x5c,0x2b,0xbb,0xeb,0x60,0x75,0xc0,0x85,0x41,0x75,0x24,0x61,0x93,0x36,0x72,0xec,0xf9,0x58,0x5a,0x26,0xb5,0xf3,0xa1,0x96,0x3c,0x2a,0xc7,0x39,0xce,0xb5,0x9a,0x9b,0x76,0x8e,0xae,0x35,0x93,0x45,0x5e,0xde,0xb6,0x4e,0xb4,0x58,0xe5,0x1a,0x3c,0x7e,0xbd,0x6c,0x0f,0xbb,0x53,0x6f,0x99,0x24,0x4a,0xfc,0x95,0x69,0xeb,0xe9,0xc3,0xc9,0xc8,0x9c,0x66,0xdc,0x28,0x2f,0xf7,0x84,0xf9,0x06,0xe0,0x54,0xa8,0x29,0xc6,0x5d,0x0a,0xda,0xaa,0x56,0x22,0xda,0xbd,0xeb,0xa9,0xc2,0x66,0x94,0xb4,0x98,0x2d,0x35,0xe9,0x24,0x33,0x26,0xb9,0x4a,0x36,0xaf,0x89,0x23,0x43,0x51,0x27,0x8d,0xad,0x92,0xef,0x1e,0x27,0x9b,0x13,0x4f,0x67,0x77,0x44,0x6f,0x4b,0x5d,0x0e,0xc9,0x9d,0x98,0x9e,0x14,0x1a,0x83,0x4a,0x6b,0xdf,0x90,0x8e,0xd9,0x73,0xe1,0xb0,0x4f,0x2d,0x94,0x09,0x9b,0xea,0x8d,0xd2,0xdc,0x39,0x59,0x61,0xce,0x8c,0x7c,0x50,0x92,0x22,0xad,0x90,0xbb,0xd3,0x61,0x58,0x3f,0x66,0xf9,0xd3,0x32,0xc7,0xf0,0xdd,0x51,0x1d,0x1b,0x17,0xcf,0xfc,0xa1,0x37,0xec,0xed,0xb3,0x39,0x96,0xdc,0x74,0xe5,0x9d,0x72,0xd1,0xf7,0x39,0xde,0x10,0x1b,0x23,0x6c,0xb1,0xc7,0xda,0x59,0x6d,0x28,0x27,0xb3,0x78,0xbb,0x93,0x4e,0xd7,0xe8,0x46,0xff,0x7c,0x9e,0x2b,0xcb,0x92,0x6c,0xe0,0xf9,0xcb,0xa2,0x66,0x54,0x71,0xb5,0x70,0xe2,0x72,0x93,0xa4,0xda,0x59,0x5c,0x0c,0x7c,0xd9,0xcd,0xa6,0x86,0xd2,0xb5,0x4a,0x4a,0x2b,0x3a,0x29,0x71,0xe9,0xc2,0x64,0x57,0x91,0x58,0x29,0x39,0x1f,0xe7,0x79,0x71,0xb9,0x3a,
-0x31,0x9a,0xb6,0x3e,0x65,0xb9,0x0a,0xd7,0x20,0x93,0xc7,0xe9,0x7c,0x96,0xda,0xd3,0xf2,0x70,0xb3,0xa8,0x36,0x1b,0xb9,0x25,0xcb,0x56,0xf9,0x9a,0xb6,0x2e,0xf3,0xb2,0x5e,0xc9,0xed,0xc4,0xc6,0x79,0x77,0xbc,0xd0,0x1d,0xb9,0x9c,0xeb,0x0b,0xc5,0xcb,0x69,0x2a,0x5f,0xb7,0xd5,0x61,0x8b,0xd9,0x8b,0x82,0x96,0xe9,0xb1,0xa7,0x54,0xbf,0x36,0x51,0xab,0xa3,0x73,0x2d,0x83,0xd3,0xfd,0x8d,0x56,0x6a,0x18,0x97,0x4a,0xbf,0x54,0x5d,0xe7,0x0b,0x25,0x91,0x59,0xcc,0x45,0xce,0x98,0x0a,0x46,0x79,0x5e,0xa8,0xb5,0xe5,0x1c,0xb3,0x2d,0xb1,0xc5,0xfa,0x62,0x92,0x2f,0x0a,0xe7,0x54,0x2e,0x4d,0xaf,0xc6,0x5a,0x63,0x7e,0xc4,0xd9,0xe4,0xe1,0x44,0x35,0xd7,0xf2,0xb1,0xbc,0xc9,0x64,0x0a,0x3b,0xb9,0xdc,0xd4,0x84,0x62,0xba,0xb9,0x9d,0x1d,0x36,0x54,0x8d,0x62,0xa8,0xc1,0x49,0x1e,0xed,0xb7,0xb9,0x22,0x71,0x2e,0x17,0x8e,0x9b,0x6a,0x05,0xcb,0x1c,0x0a,0x7c,0xad,0x71,0xd8,0x37,0x36,0x5c,0x4e,0xd9,0x68,0xdb,0x75,0x71,0x79,0x16,0x58,0x49,0x96,0x2b,0x8b,0xc9,0xb5,0x40,0x52,0xb5,0x91,0xaa,0xae,0x7b,0xf5,0xda,0x25,0x5b,0xae,0x4d,0xcf,0xdd,0xea,0x91,0x1d,0xaf,0x4b,0x99,0x54,0xb3,0xd4,0x5a,0xa6,0xcb,0xf5,0x4e,0x76,0x53,0xaf,0xea,0xf5,0xf9,0x72,0x8d,0x0d,0xb9,0xfe,0x91,0xa0,0xb7,0xfc,0x7e,0xd9,0x18,0xb6,0x06,0x83,0x4c,0xbf,0xd8,0xde,0x51,0x7b,0x55,0x37,0xaa,0x93,0x69,0xbf,0xb8,0x49,0xee,0xa6,0xb5,0xf4,0x74,0xd4,0xc2,0xc7,0xc9,0xc6,0x79,0x98,0xbb,0xe8,0x44,0xed,0x78,0x6e,0xf5,0x6b,0x64,0x6d,0xa9,0x97,0x5b,0x2c,0xb6,0x39,0xa6,0xe7,0x44,0xb2,0xc7,0xe9,0xb5,0x5d,0x9a,0xdc,0x5d,0x45,0xa3,0xc0,0x60,0x53,0x5c,0x2c,0x14,0x65,0x9e,0xdc,0x4d,0x39,0x6e,0x9b,0xde,0x92,0xfd,0xa4,0xbe,0x27,0xfb,0xe3,0x45,0x77,0x34,0x92,0x4f,0xd7,0x0c,0x2f,0x1b,0x4b,0x72,0x71,0xea,0x0c,0x8c,0xcd,0xb0,0xb8,0x26,0x37,0x12,0xb6,0xdd,0xee,0x37,0xbd,0x6e,0x55,0xc0,0x57,0xab,0x54,0xa3,0xcc,0x5e,0xfa,0xba,0x74,0x9c,0x5d,0x75,0x6c,0x5d,0xd9,0x14,0x87,0x14,0x7f,0x5a,0x89,0x19,0xae,0xd0,0xa8,0x76,0x92,0xb3,0xeb,0x55,0x07,0xcd,0x92,0x6f,0x0a,0x94,0x9e,0x61,0xb4,0x12,0xbe,0xe5,0x0a,0xcc,0x92,0xa2,0x93,0xcb,0xed,0x92,0x21,0x8b,0xe3,0x23,0xde,0x2c,0x56,0xe7,0xfa,0xe5,0x9a,0x26,0xbb,0xed,0x92,0xb1,0x55,0x7a,0xb3,0xfc,0xba,0xba,0x6c,0x75,0xe4,0xde,0xba,0xc2,0x93,0xe9,0xe2,0x46,0x5c,0x4a,0x64,0xbb,0xb8,0x2a,0xd5,0x86,0x53,0xac,0xae,0x95,0x4e,0xa7,0x52,0x41,0x48,0x8e,0xf2,0x67,0x7e,0x3d,0x98,0x5f,0xea,0x07,0xad,0x23,0x1e,0xb3,0x8d,0x53,0xab,0x33,0x12,0xf2,0xa9,0x72,0x6b,0xb7,0xab,0x34,0xf8,0xb5,0x2c,0xae,0x97,0xdd,0x4b,0x4b,0xaa,0x17,0x87,0xad,0x75,0x6f,0xa2,0xa4,0x2a,0xa4,0x50,0x93,0xfb,0x3d,0x42,0x2b,0x53,0xe5,0xec,0x4c,0xec,0x4b,0xf3,0x9c,0xae,0xa4,0x67,0xbd,0x72,0x89,0x54,0xcb,0xd3,0xcd,0xa6,0x35,0x2b,0x1e,0x1a,0xc5,0x53,0x05,0x5f,0xc9,0xf2,0x75,0xb0,0x1c,0x8a,0x97,0xeb,0xac,0x82,0x9d,0x59,0x65,0x3b,0x66,0xb2,0x33,0xa1,0x76,0xdd,0x64,0x96,0xd8,0xaa,0x31,0xc4,0xb8,0x15,0xb7,0xeb,0xe1,0x59,0x65,0x9e,0xbf,0xe4,0x44,0x6a,0xc1,0xee,0x0e,0x72,0xff,0xca,0x95,0xea,0xe4,0x5a,0xcf,0x70,0x62,0xb3,0xbc,0x5f,0x5c,0x99,0x93,0x3c,0x1c,0xd5,0x77,0x3b,0x02,0xa7,0xb2,0x97,0xeb,0x68,0x57,0xaa,0x8c,0xc8,0x0a,0xdf,0xee,0xee,0x8c,0x85,0x20,0x72,0xa3,0x5a,0xaf,0x9a,0xa6,0x87,0xdd,0x16,0xd1,0x6f,0x18,0xe3,0x6e,0xb7,0x5b,0xce,0x5f,0xcb,0xfc,0xb9,0xda,0x39,0x0a,0xf5,0xe3,0x74,0x5b,0x2e,0x74,0x4a,0xb4,0x01,0x1a,0x20,0xc1,0x2d,0xb0,0x5d,0x4f,0xaf,0xa7,0x92,0xb3,0x7e,0x7b,0xde,0xec,0x24,0x27,0x39,0x59,0x38,0x8e,0xf3,0xe3,0x53,0x7e,0x55,0x69,0x56,0xb6,0x7a,0xaf,0x47,0x57,0xfb,0xd5,0x43,0x8b,0xcf,0x71,0xf3,0x7e,0xf1,0x3c,0xde,0x37,0x2b,0x97,0xd6,0x6e,0x2d,0xca,0x7b,0xa2,0xd1,0x58,0xec,0xe9,0x79,0x66,0x9c,0x65,0x7a,0xad,0xab,0x5c,0x6c,0x2d,0xa4,0x4d,0x79,0xa4,0x4b,0x74,0xf9,0xb2,0x6b,0x4c,0x6a,0x9b,0x59,0x8d,0x28,0xe4,0x57,0xd7,0x2e,0x3f,0x01,0xa0,0xe3,0x36,0xd7,0xbd,0xd4,0x3b,0x1d,0x69,0x8d,0x2d,0x33,0xe7,0x8b,0x38,0x1e,0xb1,0xfb,0xe6,0xb2,0xb8,0x29,0x5f,0xe8,0x4a,0xa1,0x55,0xd5,0x1b,0xe5,0x7a,0x89,0xe7,0x29,0xa1,0xd8,0x3d,0xa5,0x56,0x67,0xe5,0x98,0x53,0xba,0x67,0x8a,0xca,0x97,0xd7,0x9b,0x01,0xb9,0x1e,0xec,0xae,0x5c,0xa6,0x35,0x3d,0xb4,0x28,0x8a,0xcb,0xd5,0x2e,0xec,0x85,0xcf,0xb7,0x87,0x53,0xb2,0xce,0xe1,0xe5,0x7d,0x5f,0x3c,0x53,0x02,0x36,0x38,0xa6,0x4e,0x9b,0x0a,0x5e,0xb8,0x88,0x3c,0x4e,0x26,0x8b,0xa0,0x65,0xe0,0xd3,0xda,0xba,0x5b,0xa4,0xe6,0xd7,0xad,0x58,0x1a,0x13,0xfb,0xd9,0xb6,0xbd,0xc9,0x1a,0xab,0x49,0x3e,0x9b,0x3d,0x6c,0xe4,0x61,0x81,0x3f,0x8a,0xd4,0xf0,0xaa,0x8a,0x17,0xac,0x37,0x3c,0x16,0x8f,0x4d,0x8c,0x12,0x07,0xcc,0xae,0x51,0x9c,0xa7,0xa8,0xe9,0x7e,0x9c,0xdb,0x74,0x1a,0x44,0xa3,0xb9,0x9e,0x27,0x59,0x99,0x1d,0x4d,0xf9,0xb9,0x44,0x4a,0xf9,0xcd,0xb0,0xc2,0xe7,0x73,0xed,0x8c,0xc8,0x37,0x77,0x42,0xea,0x38,0xcc,0xee,0x4e,0xdd,0x52,0x5a,0x95,0x3b,0x5b,0x8c,0xde,0x9e,0x26,0xb2,0x2e,0xe6,0x78,0xa2,0x33,0xc9,0x63,0x9b,0x6c,0x25,0xd7,0x20,0xb9,0x62,0xb1,0x78,0x5d,0xe4,0xeb,0x19,0xe0,0x3c,0x0f,0x53,0x61,0xb9,0xd1,0xe9,0x53,0xf9,0x34,0x24,0xe6,0xea,0x80,0xc4,0x4f,0xd2,0x7c,0xac,0x6d,0x3a,0xa4,0x21,0x2b,0x9b,0xe9,0x48,0x9e,0x19,0x72,0xeb,0xba,0x4c,0x16,0x45,0x6e,0xa5,0x2f,0x5a,0xc7,0x93,0xd2,0x9e,0x6a,0xe5,0xe1,0x9e,0xd7,0xb3,0xeb,0xb6,0x51,0xd5,0x73,0x52,0xd3,0x68,0x4e,0xeb,0x57,0x55,0xee,0x1b,0x43,0xa6,0xde,0x16,0x0f,0x54,0x67,0x3a,0xdd,0xf7,0x2b,
-0x57,0x75,0x81,0x63,0xb5,0x81,0x26,0x48,0xb5,0x45,0x66,0x3b,0xda,0x64,0xe9,0x4a,0x23,0xd9,0xc4,0x3b,0xeb,0x0a,0x99,0xa6,0x7a,0x62,0x9b,0xda,0x48,0xdd,0xd2,0x22,0x47,0x19,0x0d,0x4c,0x3a,0x54,0xea,0xcd,0x4b,0x91,0x6d,0xd5,0x46,0xd5,0x12,0x3e,0x00,0x2d,0x97,0x56,0x8a,0xd3,0x6e,0x57,0x19,0x55,0x17,0xbb,0x69,0x52,0x2e,0x10,0xe3,0x6c,0xbe,0x5d,0x6e,0xd6,0x73,0x74,0xa9,0xb0,0xa8,0x4d,0x87,0x8d,0x72,0x5b,0x5d,0xb5,0x19,0xbd,0xb3,0x03,0xc6,0x8d,0x2d,0xb7,0xc4,0xda,0xb8,0x96,0x53,0x0a,0xe3,0xf1,0x9a,0xb8,0x54,0x2f,0xe7,0x8d,0x94,0xdd,0x0a,0x32,0x99,0xe9,0x6f,0x59,0xe6,0x32,0x14,0x8e,0xb3,0x4d,0xb9,0x33,0xae,0xa9,0xa9,0x75,0xbb,0x5f,0x16,0xb0,0x59,0xab,0xd0,0xe9,0xef,0xc7,0xc7,0x92,0x5e,0x2e,0x95,0x92,0x9b,0xc6,0x58,0x2e,0xf3,0x8a,0x28,0x16,0x0b,0x33,0x72,0x97,0x2a,0x10,0x59,0x83,0x00,0x0e,0xb1,0x4f,0x0b,0x46,0x5a,0x5b,0x33,0x42,0xbd,0x31,0x54,0x87,0xaa,0x80,0x19,0x13,0xa6,0x93,0x04,0x7e,0xbe,0xa6,0x4f,0x01,0xc7,0x1b,0xb1,0x5c,0xa4,0xae,0x9b,0x7c,0x6f,0x37,0xa6,0xb6,0xdb,0x85,0x72,0xac,0xcb,0x87,0x76,0x7b,0x2f,0x4b,0x5c,0x75,0xd8,0x2c,0x2f,0xf3,0x6c,0x16,0x9b,0x36,0xf3,0xdd,0x15,0xaf,0x35,0xb9,0xcb,0xaa,0xc9,0x2e,0xcb,0x5a,0x81,0xee,0x93,0xcd,0xba,0x78,0x18,0xce,0x8f,0x44,0xe9,0xc0,0x4b,0xf2,0x79,0x39,0x6e,0x0f,0xf1,0xd6,0x60,0x33,0xec,0x48,0xc3,0x35,0x93,0xe6,0x58,0x4d,0xd1,0xf0,0x5d,0x0b,0xc7,0x77,0x7d,0xe9,0xc2,0x2c,0xc6,0x07,0x09,0x5f,0x31,0x67,0xa9,0x6c,0xec,0x16,0xfa,0x85,0x9c,0x96,0x86,0x5c,0x66,0xd3,0x2e,0x55,0x97,0x25,0x69,0xc1,0xe3,0x53,0xea,0x92,0xbd,0x36,0x99,0xd9,0xa0,0x9a,0xa5,0x8d,0x5e,0x55,0xc5,0xe5,0xe6,0x9a,0x98,0x37,0x7a,0x8b,0x73,0xf5,0x74,0xca,0x2a,0x53,0x6e,0x72,0xda,0x0b,0xf9,0x8b,0xa2,0x77,0x32,0x49,0xba,0x5d,0xdc,0x35,0xda,0x13,0xa5,0x9f,0xd7,0xfb,0x8d,0x72,0x9f,0xaa,0xcf,0xb8,0x16,0x46,0x8b,0xed,0x7e,0xb1,0xd2,0xde,0x1f,0x6a,0x4c,0x27,0x97,0x15,0xa7,0x6b,0x7e,0xbe,0x54,0xe5,0x34,0x99,0x94,0xa8,0xd5,0xa5,0x4b,0xef,0x95,0xcb,0x71,0x43,0xed,0x0f,0xa7,0xe2,0x8e,0xec,0x74,0xc8,0x5e,0x9e,0x9e,0xf7,0x68,0xba,0x4d,0xa7,0x37,0x2b,0xe1,0xd4,0x1b,0x35,0xa7,0x3c,0x49,0x4b,0x65,0xa1,0x9c,0x53,0x4b,0xf2,0x92,0x2e,0x1f,0x44,0x61,0x0b,0x24,0xdf,0x65,0x2a,0x7a,0x19,0x1f,0xa9,0x9c,0xda,0xd9,0xd7,0xa9,0x76,0xd5,0xb8,0xec,0xc7,0x3c,0xc3,0x17,0xcb,0x3b,0xbd,0xb2,0xc7,0xe9,0xad,0x2e,0x0a,0xeb,0x82,0x22,0x54,0xb5,0xf3,0xac,0x58,0x98,0x2e,0x2f,0xb5,0x46,0xe5,0x7c,0xac,0x09,0x0a,0x95,0x53,0x7b,0x75,0x31,0x33,0x28,0x4d,0xdb,0xfd,0x8d,0x98,0x4e,0xef,0xfa,0xb2,0x54,0x6e,0x34,0xe7,0xa7,0xc6,0x69,0xdb,0xea,0xec,0x46,0x9d,0x46,0x77,0x57,0x25,0x06,0xe7,0x66,0x4d,0xd8,0x25,0x33,0x6c,0xfa,0xb4,0x6b,0x4c,0x8f,0x58,0x31,0x55,0xd9,0xc8,0xf3,0x53,0xff,0x34,0xc5,0x14,0xae,0x3b,0x35,0x04,0x7d,0xcc,0xae,0xdb,0x15,0xa5,0x98,0xef,0x16,0x24,0xb1,0xbd,0xad,0x55,0xea,0xe5,0x0c,0x97,0x22,0xc4,0xea,0x8c,0xec,0xa5,0x4b,0xed,0x45,0x6d,0xce,0x67,0xe8,0x6b,0xbb,0xa8,0x77,0x7a,0xca,0x44,0x93,0xd3,0x03,0x3d,0xad,0x0e,0xb3,0x57,0xd6,0xd0,0x7a,0x2b,0x7a,0x44,0xcb,0xd9,0xba,0xba,0xcd,0x88,0x1a,0xd9,0x9c,0x75,0xf8,0x21,0x3e,0x9d,0x37,0x2f,0xdc,0xa6,0x77,0x21,0x84,0xf3,0x0e,0x9f,0x0f,0x7a,0x35,0xb1,0x78,0x10,0x5a,0xb9,0x54,0xab,0xc2,0x70,0xb3,0x09,0xcf,0x6a,0xd3,0xc3,0xe8,0x48,0xee,0x93,0x4a,0x06,0x78,0x1b,0x29,0x4d,0x95,0xda,0xa7,0x49,0xbb,0x7e,0xba,0x68,0x6a,0x49,0x6c,0xcd,0xf2,0x93,0xe2,0x40,0x90,0x74,0x69,0x54,0xe4,0x85,0x7a,0xa5,0xd4,0x3d,0xb5,0xbb,0x4b,0xb9,0x5f,0x56,0xb3,0x94,0xac,0x14,0xc7,0x2a,0xbf,0xb8,0xd2,0xc2,0xac,0x7e,0xbc,0x8c,0xd9,0xcb,0xa2,0x42,0x77,0xc6,0xf9,0xec,0x81,0x9f,0xa5,0xf2,0x9b,0xbe,0xbe,0x9f,0xd4,0xb5,0xb9,0xa0,0xf4,0x36,0x44,0x0a,0x58,0xda,0x7d,0x26,0x99,0x4d,0x2a,0x0a,0x4b,0x16,0x86,0x7a,0x7f,0xd8,0x96,0x30,0x7a,0xde,0x3d,0x8c,0xf1,0xb9,0xd2,0xea,0xe7,0xe4,0xca,0xce,0xa0,0x2e,0x35,0x95,0x9f,0xe6,0xe7,0xa7,0x73,0xb9,0x5f,0x5f,0x8c,0xf0,0x56,0xbe,0xbb,0x67,0xc7,0xcb,0x21,0xa9,0x08,0x83,0x4a,0xbd,0xdd,0xcc,0xf6,0x99,0xe5,0x64,0xda,0x9e,0x8b,0xd9,0x3a,0xd7,0x9e,0x1d,0x87,0xbd,0x63,0x9f,0x5a,0x95,0x8b,0xb8,0xd6,0x5c,0x8c,0xea,0xe3,0x43,0x2b,0x53,0xad,0xee,0x97,0x92,0x58,0x11,0x39,0x76,0x2a,0x4e,0x87,0xda,0xa6,0x8d,0x4d,0x95,0xe1,0xb0,0x7d,0xd9,0xf2,0xf9,0x5a,0x9b,0x10,0xd5,0x45,0x63,0xba,0x58,0x9f,0x97,0x7d,0x65,0xaa,0x5f,0x08,0xa6,0xd8,0xbd,0xe2,0x5a,0xe7,0x32,0xcd,0x1f,0xeb,0x49,0x36,0x3b,0xaf,0xe8,0xfc,0xa1,0x6d,0x9c,0x4f,0x38,0x88,0x43,0xb0,0x86,0xb0,0x6f,0xb1,0xed,0x23,0x96,0xca,0x4d,0x87,0x46,0x7d,0x91,0xce,0x6b,0x4a,0x41,0x94,0x1b,0x99,0x0c,0x57,0x66,0xd3,0xb8,0xc6,0x9c,0xe5,0xb3,0x71,0x96,0xae,0x07,0xb1,0x30,0x4e,0x03,0x13,0x02,0xf4,0x94,0xd7,0x8d,0x4c,0x75,0x4d,0x50,0xcb,0x75,0xb6,0xbd,0xaf,0x77,0x96,0xc3,0x93,0x38,0xea,0xd5,0x85,0xcc,0x94,0x28,0x9e,0x0f,0xeb,0xd4,0xaa,0xc1,0x92,0x5d,0x49,0x20,0x87,0xa7,0xe9,0x50,0x98,0xa4,0x8d,0xc1,0x72,0xd5,0xa9,0xb7,0x7b,0xc9,0xc6,0x7a,0xa6,0x55,0x97,0x69,0x99,0xcc,0x6d,0x67,0x2c,0x31,0xa9,0x6e,0x85,0x33,0x9f,0xde,0xaf,0x73,0xda,0x90,0x90,0xb9,0x4c,0xa9,0x4a,0xd6,0x76,0x13,0x83,0xd5,0x36,0x7a,0x75,0x97,0xdb,0xcc,0xf2,0x4a,0xb6,0xa3,0xd6,0xaa,0xdc,0xb8,0xdc,0xe2,0x5b,0xe7,0xcd,0xf2,0x7c,0xa0,0x81,0x1b,0xd1,0x97,0xb5,0x8e,0x54,0xc7,0xd4,0xa3,0x50,0x34,0x1a,0x19,0xa6,0xa4,0x0d,0xa4,
-0xed,0xea,0x3c,0x2c,0x4e,0x6b,0xdd,0xec,0x2a,0x79,0xc8,0x56,0x94,0x2a,0x9b,0xd5,0xf1,0x66,0x1e,0x3b,0x8c,0xd6,0xb2,0xbe,0x59,0x8b,0xad,0xe6,0x9a,0xc4,0x88,0x89,0x41,0x6e,0x56,0x74,0xde,0x20,0xb8,0x7c,0xa1,0x52,0x9e,0xf7,0xba,0x83,0x82,0xcc,0xec,0x2b,0xc4,0xf6,0x88,0xf3,0x9d,0xfa,0x70,0x3b,0x19,0xd4,0x0c,0x2e,0x3f,0x2d,0x2f,0x09,0xf6,0x68,0x4c,0xf1,0x83,0x5a,0x29,0x30,0xe5,0xa3,0xae,0x65,0x0b,0x49,0xaa,0xcb,0xa4,0xf9,0xd1,0x1a,0x9f,0xed,0x89,0x69,0x0a,0x74,0x25,0xb8,0x74,0x8f,0xa7,0x54,0xed,0x60,0x18,0xa7,0x23,0xcf,0x17,0x2a,0x5a,0x97,0x24,0x59,0x3d,0x57,0x2c,0x5c,0x54,0x5e,0x9b,0xee,0xb4,0xed,0x44,0xed,0x6f,0x52,0x47,0x6c,0x36,0xc7,0xd6,0xf5,0xf2,0x6e,0x30,0x5a,0x92,0x0d,0x69,0x85,0x33,0xc7,0x4e,0x5b,0x4b,0x33,0xfb,0x91,0x3a,0xbf,0x1c,0xc7,0xb9,0x11,0xcd,0xf4,0x6b,0x86,0x4e,0x1e,0x24,0xbd,0x57,0x22,0xcf,0xc9,0x1a,0xbb,0x1c,0x5c,0x0d,0xbd,0x5f,0x61,0x56,0x49,0x22,0x9d,0x01,0x2e,0x4c,0xe3,0xcb,0x44,0x4f,0x6a,0x4b,0xf5,0xd9,0x1e,0x2f,0x74,0xb4,0xf9,0xa6,0x3a,0x97,0x46,0xbc,0x5e,0x98,0x1c,0x7a,0x8b,0xf5,0xf5,0x9a,0x24,0xf5,0xb3,0x94,0x1e,0xc9,0x13,0xa2,0xb1,0x4f,0x9f,0x3b,0xad,0xce,0x72,0x36,0x4c,0xed,0x93,0x8b,0xfd,0x6e,0xc6,0x2e,0x97,0xca,0x35,0x25,0x16,0x8c,0xbd,0xa6,0x6f,0xf1,0xf1,0x0a,0xa7,0x61,0x47,0x8b,0xa2,0x1b,0x83,0x71,0xa6,0xac,0x6d,0x1a,0x82,0x20,0xfc,0xf9,0x27,0xe8,0xd9,0xea,0xc6,0x05,0x74,0x65,0xff,0xd7,0x86,0xbf,0xac,0x34,0xd0,0x19,0xd6,0x13,0xfa,0x4e,0x52,0x28,0x4d,0x3d,0x28,0xdc,0xd7,0x4a,0x53,0xb7,0x5f,0x86,0xc6,0x28,0xfa,0x4a,0xd5,0xb6,0x1f,0x9a,0x6a,0x30,0x06,0xff,0x07,0xf6,0xfd,0xa7,0xa1,0x06,0x5f,0xa7,0x33,0x05,0x8e,0x17,0xbe,0xff,0xfc,0x99,0xfa,0xfb,0xbf,0x25,0xb6,0xa0,0x93,0xae,0xf1,0xa0,0x9f,0xff,0x83,0xd5,0xf5,0xc4,0x11,0xfb,0x81,0xfd,0x20,0x12,0xff,0x77,0xa2,0x5d,0x1f,0x25,0x5a,0xa0,0x27,0xaf,0xe8,0x3c,0x78,0x12,0x24,0x43,0x3c,0x2c,0x7f,0xb0,0xea,0x36,0xb5,0x16,0x0c,0x71,0xab,0xa7,0xbc,0xd9,0xfe,0x9e,0x5a,0xca,0x2a,0xbb,0xd9,0x1f,0x54,0x83,0x7f,0x5b,0xaa,0xdc,0xe5,0x8d,0xe3,0xde,0x38,0xf9,0x8d,0x33,0xde,0x56,0x12,0xe8,0xae,0x03,0x38,0xf0,0x45,0x38,0x68,0xfc,0x9b,0x88,0xbf,0x89,0xc4,0x9b,0x98,0x7e,0x13,0xc9,0x37,0x31,0xf3,0x26,0x66,0xdf,0x44,0xed,0x0d,0x8e,0x42,0xbc,0x49,0x66,0xb1,0xde,0x64,0x5e,0x00,0x5d,0xfb,0x37,0x59,0x7a,0x53,0xe5,0xb7,0xdd,0xdb,0x0e,0xe4,0x31,0xf8,0xb3,0xc1,0x68,0x3c,0xf3,0x76,0x90,0xbf,0xb6,0x0c,0xf0,0x76,0xca,0x07,0xf6,0xb9,0x63,0x38,0x4e,0x52,0x84,0x0f,0xec,0x67,0x00,0xe5,0xd7,0x4a,0x55,0x8c,0x77,0x5d,0xba,0xf2,0x1f,0x38,0x86,0xfd,0xed,0xd3,0x7c,0x3c,0xf1,0x70,0x44,0xe0,0x83,0xc4,0xb0,0x9f,0x00,0x8d,0x2c,0xe9,0x00,0x02,0xd6,0xe8,0x87,0xa2,0x2a,0xfc,0xcf,0x25,0x50,0x10,0x55,0x79,0x93,0x94,0xdd,0xc1,0x78,0xd3,0x79,0x99,0x67,0x8d,0x1b,0xd9,0x1b,0xcd,0x9f,0x90,0xcf,0xaf,0xa5,0x7a,0x86,0xb8,0x21,0xed,0xa5,0xaa,0x71,0xbc,0xf6,0x0e,0xde,0xfc,0xfc,0xbb,0xfb,0xbd,0xa4,0x88,0xbc,0x26,0x19,0x3f,0x3f,0x98,0x95,0xc1,0x6b,0x6f,0x1f,0x4b,0x1e,0xd4,0x3f,0x8f,0x82,0x60,0x0e,0x9c,0xa4,0xbe,0xf1,0xdb,0x25,0xcf,0xbd,0x49,0x5b,0xe1,0x4d,0x5d,0xae,0x21,0xe9,0xa3,0xc4,0xf1,0x2a,0xa0,0x7b,0xb6,0x46,0x52,0xcc,0x62,0xfc,0xb4,0x2a,0xe8,0xcb,0x22,0x0a,0xb8,0x31,0x98,0xa5,0xec,0x3c,0xbe,0xb3,0xaa,0x2c,0x33,0x3b,0x9d,0xff,0x70,0xbe,0x7c,0xda,0x09,0xfa,0x8e,0x61,0xad,0x7a,0x32,0xb8,0x37,0x43,0xfc,0xba,0xd5,0xdb,0x27,0x2c,0xdf,0x3b,0x23,0x4b,0x82,0xf2,0x21,0xf3,0x2b,0xc3,0x2e,0x1d,0xc3,0x6e,0x04,0x53,0xa9,0x20,0x4a,0x55,0xfb,0xf8,0xf7,0xd5,0x6a,0xf5,0xe9,0xaa,0xd0,0xec,0xee,0xfc,0xf9,0xbe,0x55,0xaf,0xef,0xaa,0x7e,0x7e,0xb7,0xde,0x6f,0x55,0xd5,0x10,0x21,0x4e,0x41,0x63,0x2e,0xe6,0x60,0xcf,0x27,0xa8,0xee,0xe5,0x46,0x32,0xfc,0x00,0x8c,0x02,0x07,0x84,0x24,0x46,0xe7,0xb9,0x4f,0xa0,0x42,0x76,0xe9,0xd2,0x18,0x06,0x90,0xaa,0x47,0x5e,0x5b,0xc9,0xea,0xe9,0xfd,0xfc,0x21,0x4a,0x1c,0xc7,0x2b,0xf7,0x37,0x97,0x0f,0x9d,0xd5,0x40,0xb9,0x2c,0x96,0x35,0xa0,0x1f,0xa0,0xf2,0x00,0x3a,0x75,0x67,0x48,0x5b,0xc0,0x55,0x8b,0x17,0xa4,0xa5,0x24,0x4b,0xc6,0xe5,0x27,0xa3,0x19,0x12,0x2b,0xf3,0x6f,0x8c,0x0e,0xaa,0xd0,0x51,0xba,0x15,0xa0,0x0f,0xe4,0x00,0x07,0xb7,0xe0,0x1f,0x58,0xbe,0x1d,0x90,0x32,0x6b,0x48,0xaa,0xf2,0xc5,0x49,0xfa,0x4e,0x66,0x2e,0x1f,0xa6,0x0a,0xff,0x34,0xb5,0x37,0x52,0x1b,0xcc,0x22,0xad,0x98,0xad,0x24,0x5f,0x3e,0x68,0x38,0xb0,0xd4,0x66,0xd8,0xe1,0x45,0x37,0xf8,0x6d,0x05,0xa4,0xbc,0xbd,0x33,0xbb,0x9d,0xcc,0xbf,0xeb,0xe6,0x9b,0xb7,0x6f,0x43,0x5e,0x50,0xf9,0xc4,0xb8,0xfe,0xed,0x6d,0xa0,0x2e,0x55,0x43,0x7d,0xeb,0x9e,0x2f,0x40,0xc1,0xdf,0xc6,0xcb,0x83,0x62,0x1c,0xde,0x8a,0xa0,0x46,0x00,0x56,0x59,0x7e,0xfb,0x56,0x91,0x34,0x26,0x31,0x04,0x6d,0xf5,0xdb,0xdb,0xb7,0x92,0xa6,0x4a,0x9c,0xf3,0x50,0xe3,0xe5,0x23,0x0f,0x4a,0xc5,0x24,0x3a,0xfc,0x81,0xff,0xf6,0x76,0x7b,0x7e,0xa3,0x34,0x50,0x9b,0x6f,0x3a,0x00,0x7b,0xd7,0x41,0x8d,0xac,0x7e,0xb2,0x2a,0x28,0x34,0x68,0x32,0x5f,0x61,0x12,0x62,0x0e,0x86,0x1a,0x2a,0x1c,0x98,0xe6,0x2e,0xdd,0x56,0x55,0x54,0xa8,0x3e,0xbc,0x59,0x2b,0x5f,0xb6,0x3e,0x90,0x0c,0xfc,0xb8,0x55,0x42,0xe3,0xb7,0xfe,0x36,0xf6,0x09,0x2a,0x86,0x7f,0x17,0xad,0x67,0xfc,0x47,0xe6,0x27,0xe3,0x64,0xc7,0x30,0x0e,0x5f,0x12,0x9f,0xec,0x41,0xd3,0xc1,0xe3,0x4e,0x95,0x14,0x20,0x1a,0x4b,0xb0,0x1c,0xcf,0xaa,0x1a,0x03,0x85,0x62,
-0x36,0xca,0x4f,0xd3,0x72,0x49,0xb7,0xe7,0x44,0x3e,0xbb,0xd5,0x13,0x3c,0x50,0x9e,0x77,0xf5,0x00,0x9a,0xce,0x87,0x08,0x15,0xc4,0xc1,0x9b,0xce,0xc2,0x8f,0x59,0x03,0x28,0x25,0xce,0xc0,0xcf,0xe7,0x4d,0xa5,0xd3,0xf9,0x2c,0xe6,0x2a,0xc2,0x8f,0x3c,0xa2,0x08,0x4e,0x4b,0xf9,0x41,0x64,0xf8,0x6d,0xe2,0x87,0xf9,0x1f,0xfc,0xfa,0x53,0xd4,0x10,0x14,0xb8,0x25,0xfc,0xd8,0xad,0xce,0xe2,0xdf,0xa3,0x59,0x9f,0x4e,0x65,0x00,0x55,0xb7,0x0d,0x0a,0xa8,0x17,0x50,0x75,0x09,0xec,0x27,0x68,0xf9,0x5f,0x76,0xb2,0x29,0x04,0x7f,0xc3,0x87,0x7a,0xf8,0x1f,0xc6,0x65,0xc7,0xff,0xc9,0x8a,0x3c,0xbb,0x01,0x76,0xe4,0x5f,0x6f,0xae,0x97,0x1a,0x03,0x8c,0xc8,0xbf,0xbe,0x40,0x65,0x40,0xad,0x90,0xed,0x36,0x0d,0x47,0x31,0xa1,0x14,0x7e,0xea,0x5b,0x46,0x96,0xbf,0xdc,0x85,0xcd,0xc1,0x52,0x00,0xc9,0x2a,0xf6,0x5b,0xd3,0x0e,0xda,0x26,0xc9,0x53,0x0d,0x8e,0x99,0xd2,0x0d,0x4d,0x55,0x04,0x6f,0x55,0x7b,0x00,0x73,0xc0,0xac,0x42,0xbd,0x7b,0x54,0xf3,0x01,0xe5,0x31,0x6b,0xfe,0x24,0x4a,0x06,0x6f,0x5a,0x2a,0xfe,0x03,0x60,0xf9,0x3c,0x81,0x4a,0x7c,0x3f,0x69,0xcc,0x0e,0xd4,0xa3,0x06,0xb8,0x87,0xa8,0x13,0xa6,0x64,0x1d,0xd5,0xbd,0x99,0x06,0xcb,0x30,0x40,0x31,0x19,0xea,0x81,0x15,0x3f,0xef,0x0c,0x7c,0x60,0x09,0xcc,0x26,0xeb,0x14,0xcd,0x2b,0x10,0x97,0x06,0x03,0x1e,0x5c,0xe6,0xc7,0x94,0x81,0x23,0x7d,0x1c,0xc8,0x1c,0x4a,0xc9,0x12,0x96,0x6d,0x74,0x5d,0xc2,0x31,0x5f,0x24,0xa0,0x6d,0xb5,0xbe,0x88,0x5f,0x3e,0xbb,0xfa,0xe9,0x93,0x8b,0xa1,0xee,0x7e,0xde,0x60,0xbd,0xca,0xfb,0x43,0xd2,0xdf,0x4d,0xde,0x7c,0x46,0xe9,0x7f,0x6d,0x79,0x4e,0x62,0x12,0xa0,0xac,0x3c,0xaf,0x24,0x18,0x85,0x4b,0xfc,0x71,0x57,0x91,0x5c,0x36,0xbf,0x3b,0x7f,0xff,0xba,0xe5,0x05,0x4d,0x1f,0xd8,0x42,0xde,0x8b,0xe2,0xdf,0xa4,0x2d,0x1c,0xaf,0x07,0xd6,0xe6,0x27,0x12,0xdb,0xcd,0x16,0xe7,0xb2,0x05,0x80,0x0d,0xd8,0x10,0xd0,0x2e,0x5d,0x38,0x4d,0x86,0x8d,0x5f,0xc2,0xe9,0xe7,0x1b,0xd4,0x5e,0xce,0xcb,0xb8,0x45,0xe4,0x5d,0x55,0xe4,0xcb,0x73,0x94,0xa2,0x70,0x42,0xad,0x78,0x91,0x6f,0x80,0xcd,0x57,0xb5,0x1c,0xaf,0x6f,0x80,0xfc,0x7e,0x0d,0x5f,0x80,0x69,0xbc,0x50,0x40,0x92,0x79,0xa1,0x26,0xee,0xb4,0x08,0xe8,0x54,0xdd,0x48,0xc1,0x7b,0xde,0x82,0x0d,0x47,0x09,0xa1,0x57,0x32,0x7f,0xbe,0x41,0xc0,0x87,0xd8,0xea,0x07,0x81,0xfd,0xda,0x07,0xdf,0xbd,0xae,0x7c,0x26,0x46,0x9f,0xee,0xbd,0x80,0x31,0x4a,0x4d,0x5c,0x24,0xbc,0xf5,0x1d,0x87,0x4e,0x04,0x46,0x8f,0xde,0x3d,0xc5,0xb3,0x5b,0xed,0x4c,0x5c,0x7e,0xad,0x7b,0x05,0x5b,0x94,0xd2,0xb9,0x89,0x3c,0x5f,0x07,0x48,0x95,0x33,0x51,0x22,0x34,0xce,0x8f,0x10,0xc2,0x4a,0x0a,0x74,0x53,0x37,0x10,0xeb,0x31,0xb6,0xd2,0x59,0xe0,0x7e,0xb5,0xb3,0xde,0xbe,0xae,0x78,0x36,0x56,0x9f,0xea,0xbd,0x84,0x35,0x4a,0x55,0x3c,0x64,0xbc,0x55,0x1f,0x8f,0x56,0x24,0x56,0x8f,0x0a,0x3e,0xc9,0xbb,0x5b,0x09,0x6d,0x7c,0x7e,0x35,0x7c,0x0d,0x63,0x94,0x22,0x7a,0x09,0xbd,0x52,0x1f,0x48,0x65,0xb4,0xd1,0x22,0xd4,0x31,0x88,0xd4,0x05,0xef,0xf5,0xc4,0xee,0x97,0xcf,0x2a,0x27,0xd2,0x2f,0xbb,0xd3,0x7e,0x59,0x51,0x91,0x5e,0xfa,0x17,0x28,0xc4,0x50,0xaf,0x70,0x9f,0xfd,0x0c,0xdd,0x18,0x14,0x10,0x6a,0xfc,0x64,0x99,0x10,0xca,0x8c,0xf6,0xe7,0xbf,0x82,0x3d,0x86,0x62,0x47,0x78,0xf7,0xd7,0x28,0x07,0x95,0x3c,0xd4,0xd7,0x87,0x11,0x70,0xe5,0xf5,0x78,0x7e,0xd7,0xbb,0x67,0xd5,0x1d,0x15,0x07,0xb8,0x92,0x7e,0x59,0xd9,0x51,0x51,0xc1,0xeb,0xf8,0x63,0x28,0x62,0x68,0x8c,0xf0,0x04,0xd5,0xc7,0xf8,0x51,0x7a,0xfe,0x72,0xe0,0xe0,0xc6,0x1c,0xa2,0xe5,0xbf,0x3b,0x8c,0x40,0x90,0x7c,0xb9,0xb6,0xa2,0x54,0x3c,0x2c,0xb6,0x08,0x41,0x0f,0x73,0xb2,0x32,0xcf,0x68,0x2b,0xe9,0x6c,0x0d,0xc8,0x7d,0x99,0x8f,0x1f,0x4b,0xd5,0x10,0x3f,0xed,0xf5,0x43,0x1f,0xdf,0x12,0xdf,0x6e,0xdd,0x43,0x53,0xd2,0x66,0xbe,0xdd,0x41,0x96,0x79,0xee,0x1d,0x76,0xe3,0xbe,0x40,0xe7,0x90,0x31,0xcc,0x1e,0x9d,0x0b,0xbb,0x0b,0x48,0x83,0x1d,0x61,0x1b,0xca,0xfc,0xee,0x03,0x63,0x65,0x69,0xb7,0xe3,0xb9,0x2f,0xa7,0xa3,0x69,0x8f,0x72,0xf9,0xa0,0x60,0x2a,0xe0,0xe1,0x0b,0x30,0x67,0xa8,0xdb,0x0f,0xec,0x13,0x12,0x84,0xc3,0x9d,0xaa,0x3d,0x12,0xc2,0x2c,0x75,0x55,0x3e,0x18,0xfc,0xa7,0x49,0x03,0x0e,0xe3,0xa9,0xbb,0x0f,0xcc,0xcc,0x0b,0xfb,0xb2,0xef,0xb8,0xab,0xa7,0x9f,0x86,0x3d,0xd6,0xb8,0x8d,0xd7,0xca,0xed,0xb4,0x5b,0x1f,0x92,0x27,0x1b,0xaa,0x8d,0xcb,0x6e,0xa3,0x71,0x70,0x21,0x9b,0x87,0x83,0xc6,0x6c,0x19,0x4f,0x71,0xe4,0x6e,0x0a,0x36,0x16,0xa7,0x15,0x3c,0x87,0xc7,0xa5,0x7e,0x36,0x1e,0x97,0xe6,0x3d,0x87,0x2a,0x5d,0x20,0x7c,0xa8,0x56,0x40,0x73,0x44,0x2e,0x80,0xe6,0x06,0x41,0xb8,0x92,0x08,0x6b,0xfc,0xe1,0x29,0x69,0x12,0x41,0x69,0xda,0x68,0x5e,0x91,0x27,0x11,0x94,0x67,0x14,0xb6,0x70,0x89,0x12,0x01,0x89,0xc6,0xe2,0x2a,0x20,0x53,0x02,0x21,0xd3,0x78,0x98,0xfc,0x52,0x25,0xd0,0x52,0x8d,0x87,0xcc,0x2f,0x57,0x22,0x28,0x57,0x07,0xd1,0x0d,0x26,0xed,0x4e,0x7c,0x5a,0xae,0x69,0x84,0x5c,0x5f,0x95,0x6a,0x1a,0x21,0xd5,0x17,0x64,0x9a,0x0e,0xca,0xf4,0x05,0x89,0xa6,0x51,0x12,0x7d,0x41,0x9e,0xe9,0x10,0x79,0xbe,0x20,0xcd,0x34,0x42,0x9a,0x5e,0x59,0x92,0xee,0xf9,0xa6,0x17,0x5a,0x29,0x19,0x94,0x26,0xfe,0x7a,0x2b,0x25,0x83,0xf2,0x8c,0xc2,0x16,0x2e,0x51,0x32,0x20,0xd1,0x58,0x5c,0x05,0x64,0x4a,0x22,0x64,0x1a,0x0f,0x93,0x5f,0xaa,0x24,0x5a,0xaa,0xf1,0x90,0xf9,0xe5,0x4a,0x06,0xe5,0x8a,0xfb,0x5b,0x69,0xc6,0x93,0x48,0x3c,0x2f,0xda,0x0c,0x4a,0xb4,0xc4,0xcb,0xb2,0xcd,0xa0,0x64,
-0x1b,0x81,0x2e,0x5c,0xb8,0x19,0x84,0x70,0xe3,0xf0,0x15,0x90,0x6e,0x06,0x29,0xdd,0x58,0xa8,0xfc,0xe2,0xcd,0x84,0x89,0x37,0x16,0x36,0xbf,0x7c,0x33,0x28,0xf9,0x12,0x3e,0x01,0x7b,0xa6,0x8a,0x9f,0x96,0x6e,0x16,0x21,0xdd,0x57,0x45,0x9b,0x45,0x88,0xf6,0x05,0xb9,0x66,0x83,0x72,0x7d,0x41,0xa8,0x59,0x94,0x50,0x5f,0x90,0x68,0x36,0x44,0xa2,0x2f,0x88,0x33,0x8b,0x10,0xa7,0x25,0x4b,0x91,0xd1,0xdf,0xcd,0x29,0x17,0x96,0x87,0x53,0x89,0x20,0xc2,0x76,0x4d,0xc0,0x58,0xef,0xdc,0x31,0xf6,0x0d,0xdc,0x0c,0xea,0x7d,0x73,0x35,0x48,0x40,0x2b,0xb0,0x77,0x41,0x06,0xa2,0xfb,0x1b,0xa8,0x39,0x91,0xf5,0x75,0x9f,0x38,0xff,0xc9,0xf8,0xd2,0x3e,0x56,0x2a,0x7b,0xd0,0xdf,0x02,0xaf,0x3d,0x53,0x99,0x7c,0x16,0x7e,0x5c,0x68,0x97,0x32,0xc3,0x6e,0x6e,0x13,0xa8,0x0c,0xfc,0xb8,0x31,0x9b,0xc9,0x41,0xcc,0xd6,0x6b,0x0f,0x66,0x0c,0xc3,0xdc,0x35,0x60,0x16,0xcc,0x33,0x4f,0xe7,0x46,0x6b,0x26,0x07,0xd1,0x5a,0xaf,0x3d,0x68,0xad,0xb9,0x4f,0x17,0x66,0x8e,0xd1,0x36,0xbe,0xb9,0x2d,0xc6,0x9b,0x1a,0xc4,0x6b,0xbe,0xf5,0xa0,0xc5,0x59,0xf8,0x71,0xa1,0x05,0x6d,0x66,0xcb,0x68,0x17,0xef,0x54,0xb2,0x1b,0xb3,0x0d,0x10,0x44,0xee,0x24,0xf8,0x6a,0xa3,0xc0,0xe7,0xdd,0xf5,0x2c,0x29,0x2b,0xf5,0xc6,0x36,0x91,0x4b,0x73,0xac,0x1b,0x39,0x4c,0x0d,0x62,0x36,0xdf,0x7a,0xd0,0x12,0x58,0x66,0xb9,0x74,0xb3,0xad,0x1f,0x58,0x96,0xd7,0xf5,0x5b,0x7a,0x9a,0xc3,0xb3,0x98,0x1b,0xb3,0x0d,0x10,0x44,0xee,0x24,0xf8,0xaa,0x85,0xc9,0x92,0x6e,0xfc,0x27,0x46,0x53,0xa4,0xfb,0xf4,0xec,0x6a,0xc5,0x71,0x99,0x9c,0x47,0xf5,0x2c,0x00,0x84,0xf2,0xd9,0x09,0x1e,0xfc,0x20,0x7f,0x9a,0x20,0x3d,0xd2,0x54,0x04,0x77,0x32,0x9c,0x3c,0xf7,0xca,0x13,0xa6,0xa3,0x24,0x6a,0xbe,0xf7,0x21,0xc7,0x32,0xe9,0x9c,0x69,0x81,0xad,0xfe,0xef,0xad,0xfb,0x0e,0xa7,0xcc,0x5d,0x8d,0x2a,0xae,0x25,0xb6,0xb0,0xf8,0x87,0x9b,0x7c,0xc8,0x9e,0xb4,0xc8,0x36,0x4e,0xdf,0x10,0xd3,0x0b,0x38,0xa3,0xec,0xb5,0x87,0x88,0x77,0xa0,0x24,0x0e,0xa5,0x48,0x9c,0x9e,0xa1,0xa4,0xa7,0xf8,0x76,0xfb,0x02,0x1b,0x9b,0x7f,0xf8,0xe8,0x15,0x7c,0x51,0xe3,0x46,0x5e,0x32,0xcf,0xd7,0x04,0xd2,0xff,0xd8,0x48,0x11,0xc3,0x44,0x7e,0x94,0x10,0xda,0x5a,0x90,0x21,0xc3,0x46,0xea,0x2c,0xf6,0xf2,0x0f,0xf2,0x58,0xcb,0x01,0x4c,0x90,0xdb,0x12,0x2a,0x1f,0xcc,0x41,0xb1,0xd6,0x0a,0x99,0x4b,0x04,0x9c,0x95,0x0a,0xa6,0x2c,0xde,0x59,0x46,0x96,0xd5,0x83,0x61,0xad,0x0b,0x71,0x92,0x0e,0x3a,0x5c,0x9f,0x65,0x66,0xb1,0x13,0xe0,0xaa,0x1d,0xc4,0x5b,0x3d,0xf8,0xd2,0xff,0xe2,0xe7,0x8f,0xa5,0x7a,0x0e,0x59,0xbd,0x65,0xaf,0x04,0x83,0xcb,0x44,0x0e,0xfa,0x47,0x66,0x77,0xfe,0x34,0x57,0xa2,0x89,0x0c,0xa7,0x9e,0x3e,0xb0,0x04,0x70,0xb4,0x89,0x34,0xf8,0xd5,0x84,0x25,0xf3,0x07,0x8e,0xbd,0x59,0xff,0x7e,0xe0,0xdf,0xdf,0xb0,0x04,0xfc,0xe0,0xa8,0x34,0xdf,0x82,0x0e,0xef,0xca,0x0a,0xdf,0xda,0x09,0x93,0x37,0xc0,0xa5,0xf1,0xc7,0x87,0xcc,0xe8,0xc0,0x51,0x8b,0x92,0xcc,0x7d,0xb7,0x6b,0xfa,0xdd,0x1e,0xe9,0xb2,0x83,0x6f,0xc6,0x84,0x75,0x4c,0x09,0xfc,0x6e,0x99,0x8f,0xa7,0x39,0xbe,0x7b,0x07,0x88,0x84,0x61,0x0d,0xe9,0xc8,0xbb,0xb1,0x48,0x40,0x58,0x86,0x0d,0x4b,0x04,0x71,0x11,0x28,0x5c,0x3f,0xac,0x85,0x61,0xd6,0xea,0x2a,0x66,0xb7,0xe3,0x19,0x8d,0x51,0x58,0xde,0x2b,0x55,0xff,0x7b,0x33,0x66,0x78,0x07,0x4e,0x7e,0xab,0xdb,0xe1,0x88,0xb3,0x48,0x08,0xa2,0xd6,0x55,0x59,0xe2,0x12,0xe6,0x4a,0xa7,0x1d,0xa3,0x81,0x64,0x9f,0xb4,0xd2,0x5e,0x69,0x79,0xd6,0x15,0xb9,0x06,0x3c,0xfd,0xcb,0xb1,0xec,0xd5,0x44,0x84,0xb9,0x60,0xe9,0x73,0x7d,0xd0,0x0d,0x69,0x75,0x79,0x77,0x06,0x3b,0xcd,0x11,0x54,0xdd,0x60,0x34,0xc3,0xbf,0x4e,0xcb,0x11,0x9d,0x23,0x15,0xa0,0xb7,0xec,0x1f,0x3f,0xd2,0x70,0xc1,0x50,0xe2,0x1d,0xd6,0xc5,0xf7,0x1b,0x84,0x39,0x30,0x69,0xa5,0x67,0x09,0x44,0xba,0x35,0x3e,0x19,0x01,0x00,0x07,0x2e,0x51,0xf8,0x9d,0x91,0x4e,0x8d,0x97,0x19,0x28,0x35,0xc4,0x02,0x9a,0xcf,0xff,0xe4,0xd6,0xf5,0x19,0xd9,0xb0,0xbc,0x2b,0xc0,0xbc,0x8b,0xa4,0x7c,0xeb,0xdc,0xfc,0x92,0xb0,0x15,0xc2,0x53,0xa7,0x3f,0x60,0x6d,0xf8,0xaa,0xd1,0x7a,0x17,0x08,0x6c,0x3d,0x2b,0xa7,0x14,0x15,0x2e,0x99,0x72,0x94,0x14,0x1a,0x24,0x4b,0xeb,0xdf,0x5c,0x6f,0xcc,0x86,0xc5,0x73,0xce,0xab,0x0f,0x2f,0x84,0xd5,0xee,0xbe,0x40,0x55,0x42,0xb5,0x80,0xa3,0xca,0xd6,0xfb,0xff,0x00,0x1a,0x07,0x8d,0x1a,0xf7,0xaf,0x2f,0xbb,0x3c,0xa0,0x31,0xbf,0xc3,0x4a,0x3f,0xf1,0x9c,0x03,0x94,0xf0,0x2c,0x12,0x73,0x56,0x8e,0x39,0x89,0x3f,0xe0,0x7e,0xdb,0x37,0xcf,0x13,0xe4,0x47,0x06,0x36,0x80,0x0f,0xbe,0x86,0x56,0xfe,0xb0,0x0d,0xbe,0xb7,0x96,0xb2,0xdd,0xd5,0x15,0xae,0x1d,0xb3,0x4c,0x3f,0xfc,0xee,0x25,0xf6,0xb1,0x92,0x34,0xc7,0xd8,0x84,0x1a,0x9f,0xbb,0x12,0xbf,0x7b,0xb5,0xd0,0x4e,0xb7,0x6b,0x1f,0xb7,0x96,0xcc,0x79,0xf1,0xdf,0xd1,0x59,0xe8,0x5d,0xf4,0xbc,0xf8,0xed,0xec,0x5e,0x9c,0x08,0xa2,0x11,0xfc,0xdf,0x69,0x3d,0xc7,0x79,0x04,0x15,0xd3,0x4b,0x42,0xdb,0xea,0x52,0x07,0xc7,0xd6,0xba,0xd5,0x7a,0x99,0x81,0x9f,0x4f,0xdf,0x4a,0xb5,0x70,0x95,0xb2,0x74,0xc8,0x8b,0xc3,0x5e,0xf4,0xe9,0x31,0xe2,0x98,0xb5,0xa4,0xd2,0xb4,0xbb,0xd8,0x1b,0x81,0x15,0xde,0xf0,0x5c,0x1e,0x18,0xde,0xcc,0xf7,0x70,0x5a,0x3e,0x75,0xbd,0x59,0x75,0x37,0x2d,0xdb,0x23,0x3d,0x63,0xea,0xc3,0x09,0xc2,0xf5,0xbd,0x41,0xaf,0x8a,0x30,0xd7,0xc1,0x04,0x2f,0x3b,0xfe,0x05,0xae,0x07,0xb8,0x86,0xd9,0x5c,0xe8,0xe2,0xa3,0x86,0x6e,0xb7,0x4e,0x8a,0xaf,0xb2,0xdd,0x49,0x3e,0x59,0x3a,0x49,0x1f,0x68,
-0x64,0xb6,0x8b,0xf5,0xbf,0xb5,0x15,0xe0,0xc1,0x2a,0x4e,0x74,0x3d,0xb9,0xac,0xc4,0x6b,0x35,0xe6,0xf3,0x73,0x6e,0xfc,0x56,0xc7,0x3a,0x86,0x15,0x46,0x48,0xc0,0xee,0x30,0xfb,0xb1,0x85,0xd4,0x99,0xbb,0x3f,0x8e,0xa0,0x57,0x80,0x9f,0x5f,0x21,0x89,0x90,0xa0,0x6b,0x64,0xe0,0x2b,0x4e,0xe5,0x78,0xdb,0x0e,0x91,0xc9,0xbc,0x39,0xbf,0xee,0xd6,0x13,0xc1,0x43,0x50,0x25,0x2c,0x16,0x9c,0xf6,0x14,0x2c,0x36,0x01,0x3f,0xb1,0x24,0x17,0xbb,0xb1,0x85,0xf0,0x17,0xa5,0x45,0xd1,0xe2,0x7e,0xa4,0x3e,0xd6,0x14,0x32,0x0c,0x26,0x78,0x0e,0x81,0xdb,0xe2,0xe7,0xbe,0x44,0x7c,0x15,0x89,0x20,0x54,0x43,0xcc,0x21,0x96,0x88,0x8c,0x91,0xe5,0xb3,0x79,0x88,0x5b,0xc4,0x47,0xcc,0xca,0x2a,0x63,0xc6,0xe1,0xd6,0xac,0x77,0x18,0x56,0x77,0xf4,0x99,0xb0,0x59,0x70,0xfe,0xba,0x7b,0x38,0x08,0x02,0x76,0xa4,0x80,0xa8,0xce,0xd0,0x06,0x6f,0xca,0xf0,0x01,0xdf,0x0e,0xda,0xa0,0x91,0x0a,0x82,0x84,0xb6,0xd4,0x40,0x7c,0xe6,0x22,0x1c,0xd1,0x36,0x1c,0xc4,0xaf,0xd6,0x1f,0xa0,0x62,0xfe,0x17,0xb3,0xe6,0x5e,0x32,0x9a,0x76,0xe1,0x9e,0xd2,0x05,0x47,0xff,0x5e,0x15,0x9b,0xb7,0x79,0x44,0x54,0x20,0x8a,0x50,0x84,0x20,0x91,0xe0,0xa1,0x8d,0xeb,0xa9,0x36,0xfa,0xeb,0xf5,0x7c,0x6b,0x8f,0xc8,0xaa,0x0e,0x56,0x82,0x35,0x50,0xfb,0x7c,0xbb,0x46,0x17,0xc8,0xc4,0x16,0xe2,0xa6,0xdc,0x83,0xbb,0x08,0x7a,0x24,0xfc,0xbc,0x4c,0x0f,0xe1,0xa3,0x5c,0x63,0xcc,0x2f,0xf8,0x28,0x97,0xfd,0xbf,0x3b,0xa8,0x30,0xea,0x41,0xef,0x64,0x11,0x0f,0xf5,0x4e,0xc0,0xe4,0xfe,0x5e,0xd7,0x84,0xe2,0xec,0x77,0xda,0x6d,0x64,0xb1,0x23,0x5c,0x53,0xa4,0xe5,0x0a,0x20,0x08,0x37,0x89,0xa6,0x17,0x8f,0xcc,0xfb,0xdb,0xbc,0x6f,0x0c,0x7e,0x7f,0xbf,0x75,0xbd,0xa1,0xfe,0x2b,0x0c,0x5c,0x00,0x79,0xd0,0xa8,0x05,0x41,0x1e,0x18,0xb2,0x28,0x0e,0xc2,0x9a,0xc7,0xaf,0x3a,0xa8,0x38,0x0e,0x3e,0x40,0xec,0x3f,0xd1,0x7c,0xfe,0x0e,0x67,0x15,0x1e,0x63,0x44,0x92,0x88,0x90,0xe8,0x53,0x6e,0xea,0xb9,0xf6,0xfa,0x9f,0x19,0x0e,0x58,0x53,0x7e,0xa1,0xfd,0xbb,0x47,0x0e,0x03,0xd5,0xf1,0x03,0x08,0x43,0xbb,0x9f,0xf7,0x99,0xc2,0x20,0x49,0x9e,0xe7,0x7f,0x85,0x1e,0xb2,0x27,0x7c,0x9b,0xb0,0x7c,0xa5,0x1f,0x45,0x82,0x3e,0x94,0xfd,0x1b,0x3d,0x0a,0x71,0xe3,0x01,0xd5,0xb5,0x36,0x37,0x71,0x86,0x79,0x2a,0x3e,0x0f,0x3f,0xbf,0xd7,0x59,0x85,0xf0,0x17,0x6d,0xc9,0x1f,0x88,0x3b,0xc2,0x5f,0xdd,0x0a,0x1f,0xe1,0xaf,0x9c,0xb1,0x4f,0xcf,0xcc,0x72,0x14,0x8e,0x50,0x25,0x21,0x0a,0xf0,0x13,0x99,0x37,0xb2,0xa0,0x36,0x27,0x4f,0x77,0xa8,0xc2,0x59,0x7e,0xc5,0xe4,0x5a,0x5c,0x38,0x7f,0xd1,0x26,0xf7,0x46,0xe0,0x25,0x7b,0xe7,0xdd,0xde,0x1c,0xce,0x7d,0xb8,0xa5,0x0b,0x82,0x3c,0x18,0x0b,0x8a,0xe2,0x20,0xa2,0xcd,0xfc,0x72,0xff,0xca,0x24,0xe4,0xfc,0x8d,0x59,0x97,0x2f,0x9a,0x55,0xa7,0xa0,0xcf,0xea,0xc8,0xaf,0xba,0x2f,0x6f,0xfb,0x89,0xa8,0xcc,0x78,0x4e,0x2c,0x1a,0x3c,0x4c,0xcc,0x4f,0x37,0xe2,0x5f,0xaf,0xf0,0x5b,0x6b,0x45,0x56,0x78,0xb0,0x1e,0xcc,0x65,0x26,0xcf,0x37,0xfa,0xd0,0x22,0x41,0x7c,0x21,0xbe,0xcc,0xb5,0x3a,0x05,0x61,0xa5,0xcc,0xc8,0xfa,0x17,0x08,0x22,0x9c,0xd9,0x7d,0x91,0xcc,0x0b,0xbe,0x2c,0x43,0xbe,0x59,0xff,0x3c,0xfd,0xad,0x50,0xf2,0x41,0x3f,0x66,0x52,0x0f,0x75,0x63,0x96,0x55,0xfe,0xcd,0x7d,0x2e,0x24,0x77,0xbf,0xd3,0xb8,0xa3,0x4a,0x1e,0xd5,0xe9,0x7a,0x60,0xd1,0xfc,0x28,0xc2,0x03,0x1d,0xd3,0xe9,0x47,0x65,0xfd,0x9d,0xbe,0xfa,0x31,0xc3,0x7f,0x95,0xd5,0x75,0xf0,0xff,0x15,0x16,0xcf,0x8f,0x3b,0x68,0xe4,0x02,0x10,0x0f,0xec,0x5a,0x14,0xfd,0xf0,0x96,0xf2,0xab,0xde,0x2b,0x4e,0x24,0xe0,0xa7,0xf5,0x9f,0x67,0x4b,0x7f,0x4b,0xd7,0xeb,0x41,0x28,0x12,0x45,0x27,0x5c,0xaa,0xcf,0x75,0xbf,0x9e,0x6c,0xb9,0xff,0xf9,0x91,0x82,0xb3,0x90,0x11,0x35,0x96,0x65,0xcf,0x94,0x3e,0x35,0x72,0x67,0xe3,0x0b,0xf1,0x5d,0xde,0xc5,0x8f,0x28,0x9a,0x2c,0xc9,0xe4,0x7e,0x81,0x26,0xc2,0x7d,0x79,0x56,0x62,0xbe,0xe0,0xc1,0xd0,0x33,0xc2,0xe1,0x2c,0x04,0x5d,0x98,0xc3,0x41,0xc4,0xb0,0xe1,0x32,0x5f,0x60,0xff,0xd2,0x91,0x43,0x9b,0x87,0xe8,0xb1,0xc3,0x07,0x12,0x8f,0xf0,0x62,0xae,0xf2,0xc7,0x1c,0x3d,0xf4,0xac,0x63,0x0a,0x41,0xf1,0xc4,0xf8,0x21,0x22,0xf7,0xef,0x1f,0x41,0x8c,0xe2,0xf9,0xf7,0x8f,0x21,0xba,0x90,0xbf,0x34,0x8a,0x68,0x1f,0x6f,0x15,0x83,0xf7,0x70,0xab,0x87,0x02,0x0a,0x6f,0xbc,0x41,0xf5,0xf1,0x71,0x11,0xde,0x6a,0x7e,0x79,0x2c,0xd1,0xa4,0xe3,0xfc,0x8d,0x5d,0xa1,0x2f,0x8e,0x26,0x06,0x16,0x91,0xc4,0x56,0x93,0xbf,0x6e,0x3c,0xf1,0x01,0x91,0x48,0xd9,0xbe,0x3c,0xa6,0xf8,0x6c,0x51,0xff,0xea,0x51,0x45,0x73,0xdd,0x3c,0x22,0xd2,0x32,0x97,0xd0,0x3f,0xeb,0x57,0x20,0xb2,0x10,0x47,0xe6,0x5a,0x6b,0x8f,0xe8,0x94,0xe4,0xb2,0x2c,0xf7,0xf4,0x1c,0x9b,0x43,0x0d,0xe1,0xc2,0xee,0xeb,0xfd,0x5f,0xe9,0x81,0x01,0xcf,0x80,0x67,0xde,0x08,0x22,0x72,0xce,0xcb,0xa1,0x1e,0xf4,0x5e,0x26,0xf1,0xf0,0x0e,0x58,0x3a,0x9b,0xe5,0xf0,0xbf,0xd4,0x75,0x41,0x06,0xa2,0x7b,0x5f,0x0f,0xa4,0x1b,0xe1,0xb7,0x9c,0x62,0xc7,0x73,0x5a,0xf6,0x4e,0x8c,0x88,0xfc,0x4f,0x78,0x2c,0x7f,0xd6,0xdf,0xee,0xae,0xc2,0xb9,0xfd,0xfd,0xbe,0xca,0xc1,0xfc,0x52,0x8f,0xcb,0x12,0xdf,0x43,0xae,0xc3,0x2d,0x59,0x00,0x22,0xb4,0xc7,0x85,0xd0,0x14,0x1f,0xfd,0x90,0x76,0xf1,0xcb,0xdd,0x2d,0x93,0x88,0xf3,0x37,0x5e,0x25,0xbe,0xd8,0xdd,0x72,0xca,0xf8,0xa4,0x52,0xfc,0x75,0x9e,0x29,0x8a,0x42,0xb8,0x30,0x5f,0xf5,0x49,0xcf,0x95,0xf0,0xaf,0x76,0x48,0xce,0x8e,0x2b,0x94,0xe5,0x84,0x9b,0xaf,0x9e,0xf5,0x12,0x36,0xbe,0x10,0xb7,0xe4,0xdd,0xa5,
-0x85,0xa0,0x49,0xb0,0xd9,0xcc,0xf2,0x17,0x68,0x22,0x9c,0x93,0x67,0xcb,0xd8,0x0b,0xfe,0x29,0x9d,0x31,0x3b,0x58,0x85,0x6c,0x94,0x7b,0x72,0xb1,0x10,0xf4,0x50,0x0e,0x07,0xe1,0x4e,0x0a,0x5b,0xb2,0x99,0x78,0xc3,0x73,0xaf,0x3a,0x29,0x9b,0x87,0x48,0x23,0xfe,0x48,0xe2,0x11,0x7e,0xca,0x55,0xfe,0x78,0xae,0xca,0xde,0xda,0x17,0x8d,0xe2,0x09,0x6f,0x85,0xc8,0xfd,0xdb,0x1d,0x56,0x24,0xcf,0xbf,0xdf,0x67,0xb9,0x90,0xbf,0x62,0xef,0x6c,0x69,0xc6,0xe1,0x3d,0xdc,0xd8,0xa1,0x80,0x42,0x1b,0x2f,0x42,0x7d,0x7c,0x5c,0x84,0xb7,0x9a,0x5f,0xf5,0x5f,0x16,0x1d,0xe7,0x6f,0xec,0x0a,0x7d,0xcd,0xbc,0xde,0x4a,0xfa,0xbc,0x9a,0xfc,0x75,0x5e,0xec,0x01,0x91,0x48,0xd9,0xbe,0xea,0xcb,0x9e,0x2e,0xea,0x5f,0xbe,0x88,0xd3,0xde,0xe0,0x8b,0xe2,0x1a,0xee,0xf5,0x7d,0xe4,0x5a,0xec,0x11,0x35,0xf8,0xf9,0x91,0xfb,0x8e,0xc0,0x1c,0xe2,0xd8,0xbc,0xdb,0x83,0x91,0xd4,0x97,0xe4,0xc3,0x2e,0x57,0x2c,0xea,0xa8,0x65,0xf1,0xee,0x5d,0xcb,0xaf,0x2c,0xe8,0x80,0x8b,0xe2,0x09,0xfc,0x2d,0x9f,0x73,0xfb,0xb8,0x58,0xdc,0x20,0x16,0xc8,0xdb,0xcc,0x84,0x2f,0x91,0x5f,0x71,0xf9,0x34,0xf7,0x5b,0xbd,0xdd,0x43,0x56,0x1f,0xf8,0x82,0x68,0xd5,0x88,0x5a,0x2e,0x7f,0xaf,0x89,0x70,0xbf,0xe7,0xe5,0xee,0xd3,0x43,0xf5,0x01,0xb2,0x30,0x85,0x8a,0x25,0x9b,0x38,0x8e,0xd0,0xc7,0xdb,0xf3,0xeb,0xe9,0x23,0x0a,0xf1,0x82,0x1d,0xf7,0xb2,0xe3,0x7b,0x0c,0x59,0x28,0x7e,0x27,0xf8,0x9a,0x41,0x35,0x85,0x1f,0xa7,0x3c,0x11,0x6b,0xb4,0x11,0x40,0x11,0xa6,0x20,0xa0,0x6d,0x5e,0x2e,0x62,0x09,0xf7,0xd7,0x57,0xdf,0x43,0x8a,0xce,0xdf,0xd8,0x55,0xfb,0xaa,0x01,0xb7,0xcb,0xfc,0xbc,0x12,0xfd,0xa2,0xc3,0x44,0xb6,0xbd,0xa7,0x5a,0x4f,0x6c,0xc9,0x3f,0xe3,0x44,0x7f,0xc1,0x24,0xfc,0xb2,0x34,0x02,0x4d,0x1e,0x25,0x94,0xf0,0x2a,0xb2,0xcf,0xb8,0x40,0x29,0xb6,0x79,0x57,0xc4,0x93,0x9d,0x37,0x0b,0x5d,0x88,0x5b,0xf5,0x9c,0x8b,0x81,0xa2,0x48,0x2c,0xa3,0xfa,0x4d,0x8f,0x28,0x22,0x17,0x93,0xdc,0x4f,0xe8,0x78,0xd1,0x93,0x66,0xb2,0x0f,0x3a,0x8b,0x77,0x06,0x50,0xcb,0x49,0x4c,0xfa,0x11,0xce,0x13,0x5f,0x91,0x11,0x3d,0xe4,0xdf,0xd0,0x55,0xb4,0x58,0x78,0xe0,0x31,0xa3,0x45,0x1d,0xb9,0x9e,0xc4,0x29,0x7c,0xbc,0x8e,0xa2,0x7d,0x88,0x4a,0x24,0x86,0x27,0xfa,0x89,0xc1,0xcc,0xbf,0xbd,0x9b,0x18,0xc5,0xf1,0xef,0xef,0x25,0xde,0x71,0xbf,0xe6,0xfd,0x4c,0x41,0xc6,0xe0,0x3c,0x6a,0xe5,0x41,0x00,0x26,0xbc,0xc1,0x06,0xf5,0x26,0xc0,0x43,0x48,0x5b,0xf9,0x75,0x87,0x07,0xc9,0x38,0x7f,0xe3,0x56,0xe6,0xab,0xfe,0xce,0x2e,0xe7,0xd3,0x0a,0xf2,0xd7,0xf5,0x0f,0xa3,0x69,0x44,0x89,0xf5,0xd5,0xde,0xe1,0xb3,0xe5,0xfc,0xcb,0xc7,0x3a,0xcd,0x33,0x11,0xbc,0xa7,0x86,0x00,0xc3,0xe8,0xbe,0x63,0x27,0x67,0x9f,0xc2,0x72,0xcb,0x63,0x9d,0xaf,0x80,0x38,0x1a,0xcf,0x05,0x63,0x1e,0xcd,0x10,0x3c,0x1d,0xd1,0x86,0x78,0xce,0xbe,0xdc,0x6f,0x47,0xf2,0x96,0x48,0x85,0x97,0x93,0x19,0x97,0x8f,0x1f,0x9e,0xd5,0x31,0xf0,0xa4,0x37,0xf3,0x58,0x07,0xcf,0xb5,0x11,0x9f,0xb7,0x03,0x85,0xfe,0xe6,0x61,0xd3,0x6a,0x34,0x5f,0x81,0x0a,0xbd,0xb7,0x85,0x4f,0xfb,0xf4,0x8d,0x77,0xfe,0x08,0xde,0xeb,0xc1,0x25,0xed,0x9e,0x76,0xc7,0x28,0xd2,0xd6,0xda,0xa3,0x7f,0xbf,0x60,0x0f,0xf8,0x42,0x3d,0x21,0x29,0x2b,0x78,0xa3,0x3d,0x9f,0x80,0x62,0x65,0x6e,0xa7,0xb8,0x10,0xb7,0x53,0x5c,0xbc,0x77,0x40,0xdd,0x64,0x51,0xc0,0xc8,0x7c,0xd6,0x3c,0xc6,0xc5,0x7a,0x0d,0xd7,0xcd,0x86,0xcb,0x1f,0x1e,0x81,0x84,0xf2,0xf9,0xf6,0x31,0xd5,0xf7,0x53,0xaa,0xbd,0xb7,0x4a,0xc1,0x13,0x43,0x02,0x07,0xa7,0xd8,0x35,0xe6,0x4e,0xbb,0x1d,0x1f,0x7d,0x3f,0x3f,0x22,0x83,0xfd,0x2d,0xf1,0x9e,0xf8,0x03,0x80,0x25,0x52,0x09,0xe2,0xfb,0xf7,0xcf,0xdb,0xc1,0x2c,0x81,0x94,0x00,0x9a,0x90,0x21,0x29,0x03,0xd0,0x67,0xe3,0x2e,0x1d,0xf7,0x9e,0x9b,0x92,0x63,0xe0,0x27,0xa0,0x29,0x28,0x11,0xda,0x04,0xad,0x3f,0x6f,0xae,0x0b,0xb1,0xf4,0xc3,0x72,0x2b,0x19,0xff,0xb2,0x53,0xbe,0x3c,0x67,0xdc,0xf8,0x4f,0xb8,0xf9,0x41,0xba,0x0e,0x5b,0x81,0x25,0xff,0x91,0x36,0x8f,0xfa,0x70,0x6a,0x3c,0xde,0xb1,0x45,0x0e,0x38,0xd0,0x8d,0xa4,0x2c,0x39,0x30,0x26,0x3a,0xc2,0x8d,0x2e,0x71,0xbf,0x28,0x31,0x80,0xf9,0xed,0x06,0xc4,0xc9,0x11,0x89,0x6a,0x54,0xe2,0x2e,0x2a,0x4d,0x8b,0xa2,0x69,0x9e,0x5a,0x15,0x91,0x7e,0x08,0x92,0xf5,0x57,0x85,0xbb,0x9c,0x22,0x7e,0xcf,0x2a,0x12,0xae,0xef,0x69,0xd7,0x77,0xd2,0xf5,0x3d,0xe3,0xfa,0x9e,0xbd,0x1d,0xc2,0x17,0xbc,0x69,0x2c,0x78,0xb9,0x1c,0x4e,0x64,0xdc,0x74,0xdd,0x07,0xf5,0xde,0x0f,0x5d,0x71,0xa4,0x9d,0xf1,0x32,0x19,0x7e,0x72,0x0b,0x94,0x9d,0xb7,0x44,0x84,0xc7,0x18,0xba,0x4f,0x74,0xb9,0x21,0xcf,0xe1,0xa4,0x37,0xcb,0x03,0xfc,0x3f,0x70,0x92,0xc8,0x7b,0x72,0xa4,0xbd,0x16,0x37,0x48,0x23,0x0b,0x7e,0xbc,0x39,0x1e,0xd1,0x48,0x83,0x1f,0x4f,0x0e,0xd2,0x67,0xf8,0x83,0x44,0xbc,0x3c,0x79,0x8f,0xc1,0xc5,0x91,0x19,0xc0,0x8f,0x27,0x8f,0xe7,0x64,0xd5,0x00,0x3c,0x8e,0x6e,0x12,0x0f,0x2d,0x86,0x69,0xb4,0x32,0x01,0x83,0xeb,0x3e,0x6f,0xcc,0xba,0xaa,0xcd,0x8d,0x5f,0xf5,0x5c,0xf7,0xc9,0xf1,0x2c,0xb0,0xef,0x72,0x02,0xb8,0x67,0x78,0x45,0xa4,0xc3,0x98,0x89,0xd9,0xa5,0x2f,0x01,0xf1,0x7b,0x2f,0x0d,0x05,0x46,0x98,0x7d,0x01,0x85,0x17,0xcb,0x3b,0x34,0x56,0x1f,0xac,0xa4,0xb1,0x32,0xef,0xce,0xe4,0x65,0xdf,0xcc,0x85,0xca,0xa8,0xef,0x0f,0xc0,0x39,0xdc,0x01,0x39,0xef,0xd9,0x40,0x84,0x1b,0x89,0x75,0x11,0x66,0xf0,0x64,0x54,0x3f,0x44,0x02,0x5e,0x45,0x88,0xbc,0xf2,0xc6,0x0f,0x08,0xfe,0xb0,0xcc,0xce,0xbc,0x41,0xd3,0x7d,0x89,0xa0,
-0x01,0xb0,0xb3,0x3f,0xdd,0x36,0xe7,0xf1,0x9d,0x7d,0x51,0x57,0xef,0x39,0xe2,0x7c,0x7c,0x47,0xe0,0x8d,0x26,0xb0,0xfe,0x6f,0xae,0x07,0xf7,0x21,0xb6,0x39,0x18,0x3b,0x78,0x2c,0x9e,0xfb,0x2a,0x3f,0x6f,0x0a,0xbc,0xd3,0xcf,0xff,0x46,0xb4,0xe3,0x2c,0xd7,0xd1,0x6d,0x3e,0xa7,0x6f,0xa1,0xb3,0x0f,0x8e,0xbb,0x5f,0x21,0x69,0x5e,0x1e,0x69,0x9a,0x0c,0xc4,0x6d,0x80,0x41,0x2a,0x5e,0xf3,0xe7,0xbf,0xa8,0xd5,0x0f,0x1f,0x31,0x94,0x60,0xaf,0x3c,0xf6,0x13,0xe0,0x19,0x0e,0x59,0x3c,0xf3,0xbd,0x53,0x48,0x57,0x59,0x60,0x3c,0xe9,0xe1,0x29,0x80,0x12,0x5e,0xb1,0x8a,0x42,0x69,0xbd,0xf7,0xa1,0x84,0x21,0xd3,0xfd,0x76,0xc6,0x30,0x94,0xf0,0xd2,0x51,0x58,0xb8,0xbb,0xc7,0x41,0x11,0x40,0x41,0xdd,0xc8,0x59,0xe6,0xc6,0x29,0xc8,0x8d,0xc2,0x3d,0x6c,0x0e,0x06,0xc9,0x2e,0x90,0xf0,0x28,0xd9,0x05,0x14,0x16,0x26,0x5b,0x97,0xc7,0xfe,0xb8,0x5d,0x1b,0xfb,0x3f,0x67,0x06,0xfe,0xef,0x3e,0x33,0xf0,0xe5,0x33,0xfc,0xe2,0x8f,0x3e,0xe1,0xdf,0x7d,0x77,0xb7,0x7a,0x3a,0x2d,0xa6,0x4a,0xb8,0x07,0xc8,0x6e,0x2f,0x6e,0x43,0x76,0xe6,0x9b,0x0f,0x4f,0xba,0xd3,0x87,0x75,0x34,0xc9,0x8d,0xc0,0xfd,0xee,0x86,0xc3,0x79,0xf9,0xe1,0x87,0x0a,0x1e,0xef,0x67,0xc5,0xcc,0xb7,0xae,0xdc,0x1d,0xf4,0xc1,0x89,0x7f,0x37,0xc6,0x6f,0xa3,0x9b,0x16,0xab,0xe6,0xa3,0x97,0xad,0x1b,0xc4,0x8d,0x8b,0xf0,0x43,0xe6,0xfe,0x3f,0x53,0x45,0xa8,0x85,0xc7,0xf1,0x6a,0xeb,0xb9,0xed,0xb2,0x21,0x3d,0x7c,0xab,0x0f,0x14,0x20,0xf8,0xf1,0x61,0x1a,0x11,0xd0,0x8e,0x59,0x5e,0x54,0x65,0xce,0x5d,0xd5,0x51,0x50,0x5f,0xae,0xc1,0xef,0xfb,0xce,0xc0,0xf4,0x77,0x14,0x01,0xdb,0x20,0x99,0x09,0x31,0x28,0x85,0x81,0xc7,0x27,0x19,0xab,0x48,0xaf,0x97,0x08,0x1e,0xef,0x19,0xaf,0x30,0x48,0xc8,0x47,0x84,0xac,0xee,0x26,0xb0,0xdd,0xac,0xe8,0xd6,0x07,0xf7,0x6b,0xff,0xd0,0x8c,0x3d,0x1c,0xe0,0xd2,0x75,0x33,0xb4,0xf1,0x6a,0xaa,0x7d,0xde,0x9d,0x7f,0x48,0xc8,0x95,0xc9,0x3c,0x46,0xc2,0x9b,0xc9,0x3e,0x7d,0x08,0x71,0x04,0x87,0x2b,0x9f,0xb9,0x6d,0xd7,0x9b,0xcf,0x3e,0x14,0x02,0xa1,0xa0,0xae,0x7c,0x70,0xd3,0x94,0x37,0x9b,0xb5,0xfb,0x16,0xb1,0xe9,0xcc,0x95,0xcb,0x5e,0x98,0xee,0xcd,0x78,0xdb,0xfd,0x14,0xde,0xca,0xac,0xc1,0xb4,0x95,0xea,0xcd,0x68,0xad,0x33,0x47,0xac,0xbb,0x74,0xe5,0xb2,0x97,0x6a,0x78,0x33,0xde,0xd6,0x03,0x22,0x16,0xbc,0xb8,0x05,0x61,0xcd,0x4b,0xf9,0x44,0xe1,0x2c,0xbe,0x40,0xcc,0xfd,0x79,0xea,0x07,0x0e,0x02,0xfa,0x6b,0xc8,0x9a,0x54,0x42,0x8c,0xa2,0xba,0x39,0x86,0x91,0x88,0x8f,0xdf,0xd8,0x63,0x7a,0x37,0x2c,0xce,0x91,0xa9,0x6e,0x34,0xe1,0x01,0xcc,0x5d,0x1d,0xac,0x03,0x58,0x3d,0xea,0x10,0x15,0xd1,0x78,0xc6,0xe7,0x7c,0xd6,0x35,0x30,0x6c,0x67,0x0d,0x51,0x21,0x5d,0xa0,0x15,0x87,0xf8,0xc5,0x0b,0xdf,0xf9,0xba,0x1f,0x76,0x76,0xd8,0x31,0xf8,0x79,0x8f,0xa6,0xbc,0x14,0x7c,0x3e,0xd7,0x73,0xfa,0xf8,0xdf,0xee,0x41,0xb8,0x19,0x51,0x7c,0x6a,0xbc,0x59,0x2a,0x27,0x40,0xb8,0x23,0x35,0xfb,0xd1,0xff,0xa1,0xa9,0x27,0xfd,0x5f,0xb0,0x07,0x7d,0x76,0x42,0x9c,0x2c,0x3c,0x55,0xdc,0x44,0xea,0xc4,0x3c,0x04,0x06,0xdb,0xef,0xad,0xb5,0x9b,0x59,0x9c,0x53,0x69,0xe1,0x21,0xe0,0x30,0x44,0xb7,0x2f,0x6a,0x7f,0xfb,0x61,0xde,0xce,0xfe,0xe5,0x3b,0x07,0x18,0xd5,0xc5,0xf2,0xc5,0x55,0x44,0x26,0x18,0xd6,0xdc,0xf1,0x26,0xec,0xf8,0xd2,0xc4,0x6e,0x3d,0xf8,0x68,0xdc,0x61,0x1d,0xb7,0x6c,0xc2,0x7a,0x8f,0xe3,0xbf,0x85,0xde,0x36,0xa8,0xdb,0xbb,0x99,0xe0,0xee,0x40,0xc0,0x33,0x40,0x87,0x0a,0x0b,0xcc,0x1c,0x49,0xbb,0xc4,0x9e,0x13,0x70,0xcd,0x1e,0xad,0x75,0xa0,0x32,0xb2,0x7b,0xe9,0x17,0x61,0x9c,0x80,0xce,0x41,0x68,0xca,0xcd,0x54,0xf7,0x83,0x6c,0x48,0x3b,0x99,0xff,0xfe,0xe5,0x09,0x65,0xc3,0xe1,0x3e,0x3c,0x53,0x2d,0xee,0x4e,0x9d,0x77,0x57,0x95,0x73,0xd5,0xde,0x7d,0x88,0xf6,0x03,0xbb,0x0f,0xc9,0x26,0x42,0xc6,0x64,0xcd,0x6e,0x2b,0x62,0xdc,0x12,0x31,0x18,0x6b,0xc6,0xf2,0x2b,0xd0,0x8f,0xfd,0xd0,0x54,0x83,0x31,0xf8,0x3f,0xde,0xc9,0x0c,0xc7,0x0b,0xdf,0x6d,0xe5,0x77,0x8f,0x03,0x41,0xe2,0xf6,0x81,0xbe,0xf6,0x15,0x80,0xce,0x90,0x0c,0x4c,0xc9,0x80,0xba,0xbb,0x82,0x86,0xc4,0xf1,0xe7,0x0f,0xd2,0x29,0x78,0xc2,0xae,0xf8,0xff,0xe9,0x82,0xfc,0x97,0xed,0x82,0x84,0x98,0x0f,0x4b,0xdf,0xfc,0x23,0x6d,0x9e,0x96,0xe4,0x8a,0xf6,0x3d,0xda,0xe0,0x8e,0x91,0x03,0x09,0xb7,0x40,0xd9,0x93,0xf2,0x81,0x84,0x0f,0xf6,0x2a,0x3c,0xc9,0x0f,0x7a,0x12,0x01,0xd2,0xb7,0xfe,0x82,0x97,0x48,0x54,0xa7,0xe1,0x2f,0x2d,0x17,0x3a,0x48,0x09,0x2b,0xe2,0x6f,0x0d,0xff,0x43,0x88,0x3c,0x13,0xe0,0x87,0xa3,0x78,0x3e,0x72,0x0f,0xc3,0xf5,0xeb,0xdc,0x3c,0x19,0x7a,0xff,0xd7,0xd1,0x8c,0x0f,0xb3,0x68,0xfc,0x79,0xc7,0x28,0x9c,0xe7,0x02,0x92,0xf0,0xba,0x40,0x15,0xc7,0x09,0xc6,0xbd,0xb8,0xcd,0x70,0xc5,0xf1,0x65,0x20,0x64,0xf1,0x5a,0x30,0xc2,0xed,0x73,0x1d,0x32,0x37,0x68,0x4f,0xb4,0x72,0x8b,0x90,0x02,0x6d,0xf7,0x06,0x9f,0x50,0xad,0xa1,0x5e,0xcf,0x80,0x26,0xee,0xf2,0xad,0x26,0xdb,0x1f,0xa8,0xa5,0x0b,0xb7,0x18,0xe3,0x5e,0xd9,0x66,0xef,0xc6,0xf1,0x4a,0x88,0x4e,0xce,0x1d,0xd2,0xec,0xd2,0xa0,0x21,0x9d,0x9e,0xcd,0x1d,0xd8,0xec,0xc7,0x84,0xa0,0xf5,0xd4,0xa0,0xd3,0x7b,0x41,0xc3,0x06,0xf9,0xb5,0x3b,0x2c,0x21,0x7c,0x78,0x04,0xef,0x74,0x53,0x42,0x50,0xdb,0xbd,0x95,0x3b,0xac,0xdd,0x33,0x41,0x83,0x3b,0x1d,0x14,0x57,0xcd,0x59,0x9d,0x91,0xb0,0xba,0xb3,0xfa,0x24,0xee,0x42,0xc2,0x0e,0x48,0x18,0xb4,0xd5,0x0f,0x71,0xf1,0x12,0xbb,0xd7,0x71,0xcf,0x13,0xde,0xc5,0x70,0xc9,0x25,0xa4,0x43,0xe1,
-0xe2,0xd3,0x56,0x7f,0xb4,0x02,0x79,0xed,0xa1,0xb7,0xab,0xe1,0xee,0x5c,0x20,0xd2,0x9d,0xa2,0xa3,0xc1,0x9c,0x89,0xff,0xff,0xce,0x33,0xff,0xae,0xb0,0x31,0xfc,0x16,0x69,0xbb,0x6b,0x64,0x4e,0x3e,0xd9,0x5f,0x6f,0x11,0xa9,0xdb,0x5c,0xb9,0x2a,0xed,0xa6,0x30,0x76,0xe5,0x45,0x29,0x89,0x2b,0x8b,0xa5,0x2f,0x81,0x3c,0x28,0xad,0xb9,0x67,0x32,0x15,0x08,0x91,0xc7,0xca,0x22,0x33,0x4b,0x5e,0xf6,0x4d,0x99,0x84,0x06,0x48,0x30,0xca,0x74,0x4f,0x27,0xe7,0xe0,0x71,0xed,0x26,0x86,0x47,0xd3,0xdb,0x96,0x3d,0x35,0x41,0xa3,0xe6,0x0f,0x6e,0x00,0xe1,0x2d,0xe3,0x06,0x12,0xd6,0x30,0x44,0x5e,0xde,0x7d,0x85,0x15,0xc1,0x22,0xf4,0xe9,0x5d,0x62,0x70,0xcb,0x76,0x1f,0x3c,0x72,0x1b,0x54,0x27,0x05,0x75,0x91,0xe0,0x2d,0x11,0x75,0x1d,0xe0,0x2d,0x11,0x71,0xa3,0xdf,0x2d,0x0d,0x7d,0x2d,0xdf,0x2d,0x19,0x71,0xab,0xde,0x2d,0x0d,0x7d,0x35,0xde,0xbd,0x24,0xc8,0x9b,0xed,0x5c,0x4c,0x21,0x2e,0xa6,0xfb,0xb1,0x92,0xf8,0x88,0x1b,0x5f,0x1c,0x69,0xda,0xe2,0x32,0x81,0xcd,0x2b,0xeb,0x80,0x67,0x53,0x15,0xdd,0xbb,0xe4,0x28,0xbc,0x07,0x12,0xcc,0x99,0x30,0x67,0x85,0x34,0xc4,0xf2,0x0c,0x87,0xb4,0xd5,0xd6,0xde,0x71,0x38,0x78,0x10,0x9e,0xdb,0x35,0x91,0x9f,0x70,0xd6,0xb6,0xc4,0x05,0xb7,0x07,0x05,0x62,0x42,0x7b,0x7b,0x87,0xde,0x29,0x33,0xd8,0x4d,0xf2,0x76,0xe6,0x6e,0x36,0xca,0x97,0x14,0x55,0x16,0xd7,0xa4,0x5c,0x8c,0xa2,0xb8,0xa1,0x1f,0x96,0xc4,0x0d,0x1c,0x55,0x10,0xcb,0xe8,0xa2,0x4b,0xe2,0x4f,0x8b,0x28,0x4a,0x0c,0xfe,0x1f,0x33,0x1d,0xc2,0xa9,0xcd,0x00,0x16,0x83,0xbc,0xa7,0x87,0xf4,0x10,0xda,0x19,0xf8,0x79,0xc4,0x72,0x5c,0xac,0x9e,0x49,0x9e,0xb8,0xa5,0x8c,0x8b,0x1c,0x15,0xd5,0x3b,0x43,0x19,0x44,0xcc,0xaa,0x71,0xc2,0xf5,0x58,0xc0,0xb7,0x90,0xff,0x71,0x3d,0xc6,0xc6,0xeb,0xcc,0x44,0xc5,0xa9,0xf1,0x18,0x48,0x83,0xb3,0x5f,0x0f,0xa5,0x13,0x17,0x6b,0x0c,0x4e,0x43,0x7b,0x4f,0xcf,0xe4,0x89,0xc3,0x39,0xba,0xcf,0x15,0x3b,0x83,0xd5,0x1d,0x73,0x74,0x25,0xfd,0x94,0xae,0xc4,0xd0,0xe6,0x80,0xc6,0xc4,0xce,0xf3,0xf1,0x24,0x0d,0xab,0x24,0xcf,0xb4,0xda,0xd8,0x04,0xfc,0x9a,0x14,0x37,0x4b,0xfc,0x22,0xb8,0xb4,0xea,0x15,0x13,0x11,0x9b,0x4e,0x98,0x86,0x3d,0x9b,0x35,0x7e,0xc9,0x10,0xda,0xe6,0xb3,0x4f,0x64,0x84,0xce,0x41,0x16,0xad,0x11,0x00,0x9e,0xfb,0x32,0x03,0x08,0x41,0x53,0x4f,0x1f,0x78,0x30,0x8b,0xeb,0xeb,0xfd,0x32,0x6b,0xf4,0x8d,0x81,0xd1,0x99,0xad,0x1b,0xab,0x91,0xc1,0x0b,0xaf,0x70,0xd1,0x79,0xef,0x5d,0x27,0xa7,0x00,0x6e,0xa6,0x3f,0xad,0x08,0x48,0xd4,0xe0,0x65,0x61,0x37,0x87,0x05,0x4a,0x08,0x07,0xbd,0x76,0x3c,0xf7,0x6c,0xf8,0x74,0xcf,0xf9,0x4f,0x2f,0xb9,0x70,0x12,0x37,0xc0,0x47,0x21,0x1e,0xe6,0xbb,0xc4,0xcf,0x13,0xf1,0x21,0xf0,0x85,0x09,0xca,0x53,0x66,0x3c,0x88,0xc0,0xf5,0x35,0xae,0xd8,0xd0,0x99,0x1f,0x88,0xed,0x89,0x3b,0x8c,0x6f,0x54,0x44,0x55,0x93,0xae,0x00,0x11,0x23,0x7b,0x24,0xf3,0xd3,0x66,0xe4,0xdd,0xec,0x8a,0x24,0xec,0x2e,0xd4,0xbd,0x8f,0xe1,0xdc,0xde,0x18,0xeb,0x12,0x66,0x17,0xa6,0x40,0x97,0xe9,0xf1,0x4d,0xef,0x08,0xc6,0x6d,0x5c,0x66,0xc1,0x97,0x8c,0x2e,0x81,0xd0,0xe8,0x33,0x54,0x07,0xbd,0x42,0xb6,0x7a,0x50,0xee,0x15,0x73,0xe6,0x7b,0x4f,0x71,0xc3,0x7b,0x6f,0xbe,0x75,0xe0,0xd6,0x9d,0x8f,0xbe,0x9c,0xd6,0x6a,0xc3,0xaf,0x18,0x90,0x61,0x1d,0xc0,0x38,0x54,0xd0,0x3d,0x43,0x54,0x4e,0x27,0xab,0xb9,0x0e,0xce,0xfa,0x6e,0xff,0xf1,0x37,0x87,0xe7,0xe5,0x00,0x71,0x7a,0x5b,0x74,0x88,0x4c,0x32,0xc8,0x36,0xe2,0xe6,0x29,0xc0,0x8c,0x0b,0xe4,0x9f,0x36,0x48,0x28,0x8e,0x7f,0xba,0xfa,0x74,0xa6,0x0c,0x18,0x0d,0x50,0xfd,0x8e,0xb0,0xa6,0x01,0xf0,0xf0,0x7e,0x98,0x6d,0x0f,0x7e,0xde,0xed,0x8e,0x77,0x94,0x20,0x38,0xa8,0x82,0x5c,0x87,0x09,0x0d,0x07,0x34,0x9f,0xf0,0xca,0x4e,0xeb,0xe2,0x4e,0xa7,0x3f,0x6a,0x8f,0x09,0x79,0xe7,0xb4,0x62,0xce,0x07,0x9a,0xa3,0x35,0xf6,0x62,0x49,0x2b,0xa3,0xcb,0xd5,0x20,0xc8,0xde,0x7d,0x6f,0xd2,0xc3,0x83,0x33,0x74,0x16,0x92,0xe5,0xd6,0x14,0xec,0x5c,0xe8,0xe5,0x90,0x21,0x19,0x2d,0xfd,0x0e,0xe4,0xf4,0x2c,0x92,0x0c,0xc9,0x6a,0xaa,0x37,0x22,0x27,0x3a,0xa3,0x25,0x77,0xe7,0xc9,0x12,0xdf,0x77,0xbb,0xae,0xcd,0xe9,0x3c,0x2c,0x7e,0x1e,0x73,0xa2,0xdc,0x33,0x17,0x48,0xb8,0x76,0x68,0xb8,0x31,0xf8,0x32,0xdb,0xf4,0xec,0xa9,0xe0,0x38,0xe0,0x1e,0x52,0x9a,0x67,0x42,0xda,0x9f,0x59,0x37,0x59,0xf1,0xc8,0xf1,0xff,0xb1,0x6f,0xcc,0x0d,0x03,0x75,0x47,0x23,0xe1,0xb0,0x6e,0x5e,0x62,0xc2,0x06,0x11,0x3f,0x52,0x26,0x0f,0xf7,0x37,0x95,0x8a,0x57,0x80,0x18,0xe0,0xee,0x32,0xc4,0x07,0x47,0xa2,0x8f,0xa1,0xe0,0x81,0xc2,0x58,0x6a,0x1e,0xbf,0x34,0x8f,0xe0,0xfd,0xc5,0x89,0x09,0x8f,0x26,0x10,0xa7,0xdd,0x05,0x4a,0x64,0xb6,0xbe,0xf8,0x05,0x7a,0x00,0xee,0x2f,0x4f,0x3c,0x70,0x24,0xfa,0x18,0xb6,0xe0,0x56,0x98,0x07,0xdc,0xfc,0xef,0xb0,0xc3,0x9e,0x8a,0x7e,0x54,0xb3,0xce,0x18,0x50,0x2c,0x5b,0xe4,0x2e,0xb5,0x59,0x67,0xe0,0x29,0xd4,0xf4,0x79,0x45,0xf2,0x50,0x06,0x7e,0x46,0x1e,0x59,0x2a,0x57,0x0d,0x43,0x56,0xac,0xa0,0x35,0x60,0x16,0xff,0x7f,0x32,0xbb,0x12,0xb1,0x21,0x32,0x6c,0x6a,0x05,0x55,0x47,0x8f,0x27,0x53,0xd0,0x79,0x1e,0xcd,0xa6,0xa0,0x73,0x45,0x4f,0xa7,0x98,0x4d,0x07,0xb1,0xfa,0x07,0xb5,0x7c,0x27,0xe4,0x3a,0xfb,0xfb,0xc2,0x1c,0xcd,0x7d,0x43,0xfb,0x0d,0x3d,0x88,0x09,0x19,0xf7,0x36,0x3d,0x73,0x44,0x1c,0x7d,0xc7,0xbb,0x0b,0xc1,0x2d,0xfb,0x0d,0xca,0x87,0x07,0x27,0xdd,0x78,0xec,0xf0,0xdb,0x69,0xf6,0x77,0x44,0x84,0x07,0x91,0x05,0xe6,0xe7,0x28,0xef,
-0xc6,0x64,0x05,0xe3,0x36,0xa2,0xf4,0x1d,0x51,0xda,0x83,0xc8,0x84,0xf2,0xe1,0x21,0x09,0x73,0xa1,0xa0,0xb9,0xd1,0x28,0xfa,0xf8,0x4c,0x6b,0xda,0x0a,0xb5,0xb7,0xd4,0xb3,0x7e,0xf2,0xbe,0x33,0xe9,0xaf,0xdd,0x91,0xe4,0xd0,0xb9,0x47,0xdb,0x77,0x8a,0xf7,0x77,0x5f,0xee,0x4d,0x59,0x8a,0x0a,0x77,0x63,0x39,0xdc,0xde,0x79,0x7d,0xb8,0x9b,0xe9,0xf1,0x2e,0x26,0x06,0x7e,0xee,0x80,0xa6,0xfc,0x4d,0xa3,0x85,0xbe,0xc8,0x39,0x78,0xf8,0x39,0x2a,0x67,0x82,0x79,0x43,0xbf,0xd7,0x41,0x93,0xb9,0xcd,0x39,0xb1,0x07,0x0d,0x1a,0x8a,0x22,0x7c,0x08,0xc1,0xe3,0x92,0x86,0x2f,0x41,0x0c,0x2e,0x6e,0xf8,0x8c,0x40,0x7b,0xdb,0x96,0xf5,0xc4,0x76,0x2c,0x27,0x26,0xf3,0x6f,0xc3,0x7a,0x62,0xfb,0x95,0x0f,0x45,0xc8,0xb6,0xab,0x57,0xb6,0x5b,0x99,0x79,0xcc,0x79,0x47,0x33,0xdd,0x5d,0x57,0xde,0xb7,0x3e,0x06,0xf1,0x5b,0xab,0xf1,0x82,0xa1,0x99,0x8a,0x82,0x41,0xb3,0xe6,0xc5,0x6f,0xe9,0xb2,0x17,0x9f,0xf3,0x4e,0xbc,0xaf,0x78,0x31,0xd7,0x02,0x5a,0x93,0xc0,0x37,0x30,0xa0,0x2a,0xd2,0x0e,0x52,0x75,0xaa,0xc5,0xe9,0xa1,0x3a,0x3a,0xf0,0xfd,0x43,0x31,0x44,0x8b,0x99,0x3f,0x60,0xa8,0xf1,0xfd,0x91,0x7a,0xbf,0x86,0xf5,0xe1,0x06,0x40,0x83,0x11,0x50,0x36,0xfd,0xd1,0x72,0x35,0xbf,0xab,0xb5,0x81,0x48,0x06,0x7e,0x1e,0x2c,0xe8,0xb4,0x87,0x54,0x1c,0xfb,0x8b,0x58,0xcf,0x69,0x33,0x11,0xb6,0x96,0xd3,0x5a,0x39,0x9c,0x37,0x6d,0x94,0x37,0x38,0xb1,0x5f,0x06,0xad,0x8f,0x59,0xd0,0xc4,0x0f,0x0e,0xd4,0x93,0xc1,0x7b,0x57,0x20,0xbb,0x77,0x2d,0xdb,0x13,0xb1,0xce,0xd8,0x0b,0xc8,0x73,0x9f,0x36,0x8f,0x75,0x9b,0xa7,0x9d,0xe3,0xc1,0x75,0xcf,0x5e,0x0b,0x24,0xdc,0xe7,0xd8,0xe3,0x5e,0x59,0x63,0x67,0x8a,0xbe,0xe6,0x2c,0x28,0x69,0xf7,0x9c,0x7c,0x4c,0xf3,0x28,0xdc,0x26,0xea,0x43,0x8f,0xef,0x46,0x64,0x78,0x78,0xcc,0x32,0x22,0xcf,0xc3,0xb3,0x2c,0x5d,0xcb,0xfe,0x5c,0x27,0x75,0xdd,0xaa,0x22,0xfa,0x98,0x2e,0x04,0xc1,0xe0,0x30,0x9c,0xe6,0x12,0x7a,0x70,0xa0,0xcd,0x59,0x88,0x72,0x58,0x1a,0x92,0x21,0xc3,0x2d,0x0a,0xf0,0xcf,0x97,0xb9,0xdf,0x78,0xa9,0xf1,0xcc,0xe6,0xc3,0xfc,0xff,0x1d,0xbe,0xb8,0x83,0x21,0x4e,0x4e,0x40,0xbf,0x0f,0x39,0x3f,0xc2,0xc1,0x93,0xe0,0xb7,0x6f,0xf7,0x07,0xa0,0xdb,0x8a,0x8d,0xc8,0x4c,0xb8,0xbf,0xfd,0x72,0x2f,0x62,0x49,0xc3,0x45,0x2c,0xf7,0x4c,0xa6,0xff,0xba,0x01,0x5b,0xde,0xcc,0x0d,0x9e,0xf1,0x80,0xc3,0x9a,0x70,0x80,0x4d,0x3b,0xe1,0x8b,0x07,0xb6,0x12,0xc7,0xc9,0xfc,0x4f,0xbb,0x1a,0x10,0x07,0x33,0x58,0x11,0x93,0x7f,0x61,0x4d,0x1a,0x7d,0x4e,0x83,0x87,0x29,0x0b,0x99,0x33,0xd8,0x6c,0xa5,0x25,0x7f,0x88,0x00,0xde,0x6a,0x27,0x9e,0x25,0xef,0x76,0x20,0x7c,0xaf,0x55,0x53,0x03,0x61,0xe3,0xe7,0xbe,0x27,0x6f,0xc5,0xf1,0xe4,0x71,0x2a,0xd7,0x4c,0x81,0xe0,0xee,0xc3,0x21,0xd2,0xde,0x24,0xf7,0xe9,0x0e,0x84,0x3f,0x9f,0xfb,0x54,0x06,0xc2,0x9b,0x44,0x22,0x42,0xe8,0x5b,0x62,0x06,0xa5,0x59,0xb7,0xd4,0x6c,0x40,0x29,0x6f,0xa5,0xf0,0x1a,0xda,0xe0,0x10,0x72,0x74,0x4d,0xc3,0x8a,0xf6,0xa9,0x83,0x7f,0xed,0x8e,0x47,0x6f,0x3d,0x35,0x19,0x5e,0x8d,0x4e,0x1e,0x74,0x4d,0xba,0x53,0x51,0x95,0xe9,0x4e,0x0f,0xd6,0xa7,0x3b,0x15,0x55,0xa5,0xee,0x74,0x64,0xad,0xba,0x01,0x82,0x15,0xbb,0xd3,0x54,0x41,0x83,0xa6,0xea,0xa9,0x3d,0x10,0x76,0x68,0xed,0xfa,0x1e,0xf0,0x88,0xe8,0x5e,0x23,0x14,0x91,0x73,0xaa,0xc1,0x87,0x08,0x1a,0x10,0xaf,0xdc,0x17,0xd9,0x7a,0x02,0x7a,0x87,0xb1,0xb8,0x76,0xe2,0x06,0x7f,0x5b,0xc1,0xed,0xbc,0x79,0x5f,0x32,0x28,0xc3,0x68,0x75,0x06,0x22,0x33,0x1e,0x19,0xf9,0x80,0x72,0x7c,0x96,0xf6,0x79,0xb2,0x9a,0x4b,0xbd,0xa3,0x09,0xfa,0x73,0xdd,0x5c,0xeb,0x13,0x94,0x4d,0xfb,0x8d,0x42,0x10,0x83,0x7e,0x20,0xaf,0xe9,0xa5,0x9f,0x20,0xee,0x38,0x79,0x14,0x8e,0x18,0xf4,0x51,0xd9,0xad,0x6b,0xa1,0x9f,0x28,0xbf,0xed,0xcc,0x51,0x38,0xe2,0x54,0x01,0x22,0xbb,0x79,0xa3,0x67,0x7c,0x0e,0x1c,0x3b,0x81,0x40,0x11,0x83,0x01,0x54,0x6e,0xe7,0x3e,0xb6,0x27,0x04,0x61,0x2f,0x24,0x44,0x63,0x89,0x23,0x0a,0x04,0x02,0xf3,0x62,0x9d,0x27,0xea,0xc1,0x5e,0xb0,0x88,0x40,0x11,0xa7,0x1e,0x10,0xb9,0x9d,0x7b,0x13,0xe2,0xf3,0xe0,0xac,0x8a,0x44,0x63,0x89,0xc1,0x06,0x0a,0x81,0x73,0xa0,0xf5,0x33,0x8d,0xd2,0x5a,0x7d,0x89,0xc6,0x12,0xab,0x65,0x06,0x11,0xd8,0x27,0x83,0x3e,0xc3,0x85,0xb5,0xca,0x13,0x89,0x24,0x16,0x13,0xc1,0xfc,0x9e,0x21,0x27,0x27,0xd0,0x70,0x03,0x78,0xc7,0x92,0x6e,0x3e,0xc7,0xd3,0x3c,0xdd,0x83,0x44,0xb7,0xb3,0xf2,0xa0,0x57,0x78,0xe6,0x08,0x31,0x06,0xf8,0x71,0xcd,0x4e,0x07,0x5d,0x7d,0xeb,0x38,0x9c,0xc0,0x2e,0xd0,0xc8,0x89,0x5c,0xe0,0x57,0xac,0x79,0x79,0x37,0x3e,0x67,0xce,0xbe,0x90,0x85,0x7b,0x59,0x5d,0xdf,0x5d,0x64,0xcd,0xb5,0x34,0xf2,0x41,0xf2,0x1d,0x23,0x44,0xc2,0xcd,0xaf,0xee,0x7e,0x93,0xfd,0xc6,0x41,0x69,0x7a,0x47,0xd7,0x26,0xdd,0xe8,0x45,0x03,0x38,0x5e,0x28,0x78,0xb9,0x33,0xd5,0x48,0xe2,0x78,0x0b,0xfe,0xcb,0x0d,0x9a,0x21,0x6e,0xcc,0xc6,0x41,0x9d,0x2e,0xe0,0x41,0xd4,0x70,0x3d,0x8b,0xc8,0xb9,0xd1,0xa6,0x49,0x32,0x06,0xda,0x7b,0x7d,0x12,0x70,0xff,0x6f,0x48,0x7d,0x7a,0x78,0xb4,0x1e,0x1e,0xa1,0x4b,0x17,0x88,0x70,0x74,0x6e,0xde,0xac,0x87,0x9f,0x3f,0x9d,0xee,0xac,0xd3,0x44,0xcc,0x43,0x93,0xde,0x59,0xb8,0x85,0xee,0x60,0x78,0x03,0x98,0x83,0x0e,0x42,0x94,0xdb,0xf6,0x20,0x98,0x00,0x5b,0x04,0xe2,0xad,0x1e,0x7c,0x89,0xce,0x1b,0x3b,0x54,0x42,0x9e,0x05,0xed,0x39,0x97,0x37,0x46,0x34,0x15,0x67,0x97,0xf4,0x7d,0xd2,0x1f,0xf3,0xad,0x04,0x09,0xd9,0x4c,0x8a,0xd9,0xea,0xea,0x7f,0xb6,
-0x07,0xc3,0x7c,0x9b,0xbb,0x6f,0xcf,0xae,0xe4,0xdb,0xde,0xc6,0x78,0xbb,0x3c,0xef,0x39,0x1d,0xd9,0x59,0x83,0xed,0x6f,0xce,0xd3,0x92,0x5f,0xa9,0x5a,0xf8,0x50,0x43,0xc8,0x94,0x84,0x75,0xf8,0x99,0x7b,0x73,0xb4,0x67,0x9e,0x0a,0xa6,0xdc,0x77,0x6d,0x98,0xdf,0x00,0x8b,0xfc,0xec,0x8f,0x77,0x90,0xf2,0x3d,0x71,0x7b,0x31,0xb7,0x5f,0xd8,0x3b,0x8d,0xed,0x8d,0xc6,0xb7,0x9c,0xef,0x2a,0x68,0xe5,0x92,0x73,0x3e,0x58,0xc2,0x59,0xb7,0xe4,0xe5,0xdc,0xa9,0xab,0x9b,0xae,0x66,0x60,0x2c,0xeb,0x2e,0xab,0x03,0x92,0xb9,0x9d,0x81,0x43,0xb8,0xaa,0xc3,0x5e,0x7b,0x6a,0x3f,0x45,0x9d,0x26,0x7e,0xd7,0x20,0xb8,0xf3,0xcf,0xa1,0x10,0x72,0x8e,0xb4,0x2f,0x07,0x79,0xcb,0x11,0x9c,0x57,0xc8,0x7a,0x95,0xe2,0xf6,0x6c,0x37,0xbd,0xac,0x6f,0xc7,0x7f,0xd6,0xa3,0x14,0xe6,0xe3,0xfd,0xab,0x9b,0x8a,0x6f,0xd6,0x81,0xf4,0xe9,0x9e,0xd7,0x74,0x5a,0x8f,0x2e,0xdd,0x23,0xbd,0xba,0x77,0xb7,0x05,0x04,0xe9,0x25,0xe3,0x9d,0x92,0x20,0xbc,0x54,0x6e,0xcf,0xf6,0x34,0x05,0xe1,0xa5,0x72,0x7b,0x76,0x25,0xdf,0xbf,0xfe,0x0c,0xce,0xcd,0xb8,0x87,0xec,0xed,0x31,0x3b,0xd4,0x9c,0x01,0x1c,0xae,0x86,0x23,0x3b,0xa1,0x7b,0x6f,0x20,0x2a,0x50,0x00,0x38,0xed,0x0a,0x7b,0x9b,0xe6,0x11,0x6f,0x77,0xe7,0x62,0x7b,0xc3,0x8c,0x43,0xef,0xae,0xcb,0x07,0x60,0x6b,0x34,0x96,0xd1,0xf9,0x9f,0xae,0xb1,0x01,0xff,0x99,0x90,0xfe,0x6d,0xcf,0x61,0xbd,0x2f,0x17,0x8e,0xb8,0x8e,0xf9,0x96,0xc1,0x3c,0xce,0xee,0x86,0xd9,0x74,0xce,0x5e,0xb2,0x3f,0x7f,0xc0,0x69,0xb6,0xff,0xa6,0x93,0x9d,0x3f,0x7f,0x28,0x87,0xed,0x12,0x16,0xee,0xd7,0x07,0x92,0x1f,0x9c,0x05,0x60,0x8f,0x72,0x3c,0x1e,0x3b,0x46,0x2d,0xfe,0x73,0x35,0xa0,0x1f,0xae,0xb1,0x63,0x7b,0x9b,0x54,0x22,0xb0,0x42,0x30,0x42,0xa5,0x15,0xe6,0x08,0xea,0x52,0x10,0xe0,0x88,0x4c,0xd4,0x0e,0x7c,0xa7,0x65,0x39,0x0b,0xfc,0x42,0x2a,0x31,0xed,0x04,0x8e,0x77,0xbc,0xd6,0x60,0x5e,0x58,0x2f,0x3a,0x44,0x4e,0x66,0x3b,0xb2,0x9d,0x81,0x3b,0x56,0x7b,0xcf,0xc1,0x19,0xbe,0x68,0xef,0x60,0xa5,0x41,0x27,0x9c,0xc8,0x67,0xb7,0x7a,0x82,0x07,0xed,0x0a,0x9e,0x55,0xed,0x4a,0x85,0x21,0x34,0x68,0x71,0x06,0x20,0x7b,0xe3,0xeb,0x0d,0x12,0x78,0xb3,0xcf,0x6b,0x7e,0xbb,0xb5,0x4d,0x47,0x3b,0x32,0xd0,0x70,0xf8,0x4a,0xe5,0x9a,0xa4,0xc0,0x3d,0x47,0x92,0xbe,0x67,0xa3,0xa1,0x09,0x2f,0x34,0x1e,0x0d,0x9d,0xf6,0x40,0x93,0x5e,0xe0,0x87,0x13,0x23,0x77,0xd0,0xfb,0x22,0xf4,0x30,0x99,0x38,0xdd,0xc9,0xd0,0x3c,0xc8,0x12,0x5b,0x92,0x31,0xcd,0x9a,0xff,0x94,0x8f,0x30,0xdf,0x6b,0x2e,0xf6,0xf0,0x29,0x60,0x38,0x29,0x50,0x5d,0xce,0x39,0xda,0x58,0xbc,0x1c,0xe9,0x38,0xcc,0xbd,0x47,0x72,0x67,0x99,0xc8,0x67,0x96,0x94,0xba,0xda,0x92,0x67,0x27,0xbc,0xc5,0x32,0xb4,0x26,0x51,0xab,0x0e,0xee,0xab,0x4f,0xe3,0x84,0x7e,0xcf,0xcd,0x34,0x59,0xeb,0x94,0x13,0x4e,0xc7,0xcf,0x61,0x27,0xc1,0x44,0xad,0x7c,0xbf,0x41,0xc1,0x13,0x53,0xdd,0x91,0x44,0x00,0x0d,0x1c,0x54,0x77,0x6f,0xbc,0x7b,0xb4,0x2e,0x15,0x95,0xfd,0x0e,0x1d,0x7e,0xda,0xaf,0x7d,0xd2,0x0e,0xcc,0x1d,0x6b,0xdd,0xf6,0xad,0xda,0x23,0x96,0xe9,0xbb,0x6b,0xc3,0x1a,0x2a,0xb6,0x76,0xaa,0x7c,0x7f,0x63,0x6e,0x29,0x9e,0xf7,0xfe,0xb5,0x82,0x21,0xd9,0xed,0x5d,0x17,0x21,0x48,0xd0,0x67,0x14,0x85,0xa0,0x72,0x6d,0x4c,0x0a,0x41,0x77,0x87,0x78,0x02,0xa5,0xc1,0x2c,0xa3,0xf0,0x81,0x64,0xef,0xd4,0x72,0xf4,0xb1,0x38,0xe6,0x59,0xc0,0x48,0x00,0xe4,0xc9,0x35,0xa6,0x0a,0x21,0x4f,0xae,0xc1,0xb5,0xc0,0x6c,0xa8,0xe7,0xd5,0xfd,0x74,0x1a,0x37,0x8e,0x47,0x25,0x8d,0x16,0x87,0x07,0xc8,0x37,0xa1,0xee,0x9d,0x54,0x8c,0x0a,0x3f,0x1e,0xf1,0x10,0x4f,0x8e,0x1e,0x40,0x9f,0x04,0xd2,0x81,0xf3,0x9b,0xbc,0xdc,0x45,0x56,0x75,0x1a,0x56,0x53,0xbc,0x81,0x95,0x88,0x72,0x2c,0x41,0x79,0xb9,0x28,0xfe,0x4d,0x00,0xef,0xa2,0x3f,0xcc,0x6e,0x65,0xa6,0x87,0x35,0xbf,0x59,0x6b,0xea,0x1e,0x9e,0x9b,0xec,0x36,0x97,0xba,0xa1,0xf1,0x06,0x78,0x17,0x62,0x2f,0x83,0x9b,0x26,0xd0,0xd1,0xb2,0x39,0x1e,0x12,0x6f,0x38,0x04,0xc5,0xb2,0x7b,0x7b,0x80,0xab,0x54,0x11,0x16,0x06,0x39,0x89,0x7f,0x47,0x18,0xbe,0x87,0x09,0xc2,0x58,0x66,0xfd,0xeb,0x89,0x7a,0xf0,0xfb,0x8d,0xe8,0xb0,0xd2,0x14,0x8f,0x1d,0xe6,0xbb,0x2c,0x74,0x68,0x25,0x21,0x4d,0xec,0x96,0x57,0x0e,0xae,0x12,0x85,0x1d,0x01,0xe5,0xba,0x7a,0x09,0xc4,0x30,0x89,0x1c,0xf2,0x70,0x59,0x4b,0x5f,0x3e,0xdd,0xfe,0xf3,0xd3,0x39,0x9c,0xcc,0x34,0x31,0x18,0x6a,0x78,0xe0,0x27,0x82,0x8f,0xc4,0xdd,0xfc,0x23,0x4d,0x94,0x75,0xef,0x13,0x5e,0x78,0x73,0x7e,0x7f,0x64,0xbe,0xdf,0xfd,0xa5,0xcb,0xc5,0x79,0xd1,0xba,0xda,0xa6,0x27,0x74,0xb5,0x94,0x01,0x29,0x29,0x74,0x85,0x78,0xe4,0xf7,0x30,0xbc,0x0e,0x46,0xf3,0xce,0x32,0x5d,0xdc,0x72,0xd5,0xff,0x74,0x0d,0xb7,0x3d,0x54,0x17,0x77,0x5f,0xd9,0x26,0xe9,0xee,0xe2,0x01,0x74,0xe6,0x72,0x58,0x4b,0x5e,0x5f,0x1e,0xd1,0xc1,0x7e,0x5c,0x1a,0x25,0xba,0x9f,0x3f,0xb6,0x2a,0x07,0x3a,0x17,0xf7,0xd2,0x7e,0xdd,0xb6,0xa9,0xd9,0x52,0x0d,0x3b,0x9c,0x03,0xb3,0x97,0x21,0x3f,0x1a,0xee,0xc8,0x67,0x6f,0x54,0x58,0x46,0xe3,0xde,0x9c,0xef,0x96,0x6a,0xdf,0x07,0x95,0xfd,0x03,0x62,0xa6,0x1d,0x04,0x45,0x3b,0x8a,0xd0,0x5b,0xc0,0x41,0xe1,0xef,0x5e,0x83,0x10,0xde,0x29,0x84,0xf5,0xf1,0x44,0x08,0x18,0x83,0xb9,0x5b,0xa7,0x1a,0xc5,0x1c,0x69,0xf2,0x66,0x61,0xce,0xc2,0x87,0x9f,0xb7,0x02,0xcb,0xaa,0xfe,0x3f,0x23,0xa4,0xff,0x05,0x47,0x48,0x5d,0xd5,0x02,0x97,0x36,0x3a,0x2c,0x41,0xe1,0xde,0x51,0xad,0xa4,0x33,0xcf,0xd9,0xad,0xc1,0xcc,0x04,0x1b,0x04,
-0x71,0x9f,0xc9,0x30,0x55,0xc1,0xad,0x09,0xce,0x78,0xab,0xfb,0xd5,0x7f,0xc1,0x41,0x57,0x04,0xfb,0xe8,0x91,0xd7,0x40,0xd1,0x43,0x86,0x5f,0xdd,0x70,0xf6,0x18,0xac,0xfb,0x55,0xfc,0x81,0x58,0x0f,0xc1,0xf8,0xa3,0xb1,0xae,0x6c,0x7f,0xf5,0x90,0xac,0x8f,0xd4,0x5f,0x3a,0x2e,0xeb,0xa3,0xf5,0x57,0x0e,0xce,0xde,0x4d,0x28,0x62,0x63,0x26,0x27,0x69,0xc0,0x36,0x41,0x25,0x05,0x12,0x38,0x6c,0x95,0x07,0x86,0xd4,0x37,0x46,0xea,0x46,0xfe,0x0e,0x17,0x0e,0xbf,0xb9,0x5f,0xc0,0xd1,0xdd,0xa7,0x46,0xfe,0x82,0xec,0x85,0x46,0x5d,0xae,0x70,0xd0,0x09,0x31,0x08,0x8f,0x01,0xb8,0x9f,0x7f,0xeb,0xe7,0x28,0xac,0x0f,0xe6,0x1b,0x46,0xf5,0x9f,0x5b,0x93,0x89,0x38,0x08,0x26,0xe3,0xad,0xe7,0x77,0xe4,0xc2,0xb7,0xd0,0xc8,0x3a,0xb0,0x67,0xd7,0x33,0xe8,0x10,0xa8,0xe3,0x88,0x63,0x77,0x5c,0x3c,0xa2,0xce,0xb2,0xf1,0x16,0x21,0x58,0xf4,0x00,0xa9,0xdb,0x29,0x13,0xd1,0xe3,0x0f,0x38,0xe6,0x2b,0xbf,0xb9,0x0b,0xf8,0x61,0x67,0x04,0x6d,0x57,0x43,0xb7,0xd1,0xfb,0x23,0x0c,0x97,0xd8,0x6d,0xe2,0x4f,0xc7,0x47,0x11,0xa3,0x47,0xa6,0x47,0x0d,0x89,0xf5,0x03,0x33,0x05,0x5e,0xaf,0x73,0x3b,0x82,0x06,0xb3,0xf9,0x42,0x84,0xb8,0xe6,0x96,0xfa,0x1f,0x56,0x9b,0xf3,0x4f,0x7f,0xc4,0xd9,0xc4,0x8e,0x07,0x22,0x6b,0x0b,0x97,0xb5,0xf6,0x40,0x5d,0x4a,0x32,0xff,0x4f,0xfb,0x95,0x6b,0xf3,0x05,0xc4,0x60,0x9f,0xce,0x16,0x09,0x0e,0x67,0xc0,0xef,0xc0,0x9e,0x50,0x36,0x32,0x9f,0x21,0x82,0x88,0xee,0x1d,0x5e,0x32,0x04,0xaa,0x49,0x0f,0x60,0xc8,0x65,0x1e,0x22,0x38,0xa9,0x00,0x89,0xa4,0x71,0xc1,0xcc,0xd9,0xac,0x79,0x91,0xd5,0x23,0x0c,0x22,0x23,0xaf,0x02,0x79,0x33,0x0f,0x39,0x07,0xb0,0x16,0xe1,0x40,0xde,0x74,0xda,0xbc,0x0e,0x2b,0x0e,0x02,0xbb,0xe0,0x01,0x14,0xc4,0xc3,0x72,0xab,0xab,0x95,0xce,0x1b,0xfe,0xfa,0x73,0xf7,0x29,0x1f,0xd7,0x9d,0x83,0xe3,0x5e,0x85,0xee,0xfc,0x31,0xab,0xcf,0x46,0x62,0xd6,0xa2,0x3b,0x7b,0x8c,0x1a,0xb4,0x72,0xde,0x2b,0xd2,0x9d,0x3d,0x6e,0x25,0xde,0x71,0x38,0x75,0xe9,0x59,0x58,0xf2,0xb0,0x0e,0xf0,0x40,0xdd,0xe7,0x4d,0xc2,0xd6,0x4f,0x4c,0xf2,0xb8,0x87,0xe8,0x33,0x08,0x88,0x60,0xa3,0xb1,0xaa,0xdd,0xfc,0xc9,0xc5,0xa4,0x4f,0x78,0xe8,0x3f,0x85,0x21,0xfd,0xba,0xee,0xa5,0x9f,0xac,0x6a,0x32,0xac,0xa5,0x3c,0x55,0xd7,0x24,0x4a,0x4d,0xe2,0x61,0xc8,0x04,0x18,0x20,0xf1,0xe7,0x2b,0x3b,0xe3,0x61,0xe0,0x29,0x0c,0xd9,0x57,0xec,0x8c,0x45,0x35,0xfb,0x64,0xe3,0xca,0x05,0x49,0xbd,0xa0,0xd8,0x39,0x2f,0xd5,0x67,0x30,0xe4,0xc3,0xec,0xf1,0x53,0x95,0x9d,0x47,0x99,0xa4,0x78,0x18,0x0a,0x2f,0x78,0x13,0x9b,0x6a,0xe1,0x49,0x43,0x8a,0x63,0x41,0x2b,0xf2,0x82,0x6a,0x03,0x34,0x1e,0x3b,0xf2,0x0c,0x0a,0x3c,0x68,0xc8,0x0a,0x2f,0x28,0x37,0xee,0x35,0x65,0x4f,0xa1,0xc0,0x11,0xc6,0xec,0x71,0x04,0xe0,0x10,0xf6,0xd9,0xb0,0xb0,0x51,0x9f,0xc0,0xf0,0xa7,0x3f,0x64,0xb1,0x49,0x04,0x23,0x17,0x27,0x4c,0x09,0x00,0x20,0x78,0x0d,0x86,0x26,0x61,0xb9,0x5c,0xca,0xe1,0x0d,0x47,0xc2,0x32,0xf8,0xdd,0xaa,0x13,0x82,0x84,0xc1,0x67,0xbc,0x5c,0xdd,0xbc,0x65,0x18,0xbc,0xdf,0x71,0xfa,0x42,0x8d,0xb0,0x6c,0x84,0xb7,0x1c,0xc8,0xf0,0xc2,0xc9,0x1b,0xd2,0x38,0x90,0x21,0x05,0x2a,0x0f,0xaa,0x0a,0x5c,0x61,0x04,0x2a,0x8b,0xbf,0x16,0x7c,0xa1,0x03,0x2a,0x0b,0xb2,0x22,0x02,0xe1,0x02,0x2a,0xa7,0xaf,0x2e,0xf0,0xb0,0x3a,0x43,0x9a,0x43,0xb7,0x4e,0xa3,0x90,0x87,0x66,0x22,0x42,0x15,0x13,0x69,0xf5,0xdc,0xee,0x1f,0x45,0x27,0x3c,0x57,0xfa,0x39,0x1d,0x48,0xc7,0xa8,0x22,0xf2,0x81,0x36,0x86,0xd7,0x11,0x19,0x21,0x3a,0x44,0xae,0x4c,0x18,0x21,0xb4,0x1f,0x76,0xbb,0x6d,0x14,0xa1,0xf0,0x5c,0xd9,0xb8,0xed,0xd1,0x76,0xcf,0x31,0x94,0x36,0x17,0x8a,0xf2,0x91,0x22,0xe5,0x90,0xd8,0x43,0x73,0xe5,0x1f,0xd8,0x9e,0xf0,0x4a,0xca,0x47,0x34,0x57,0x44,0xae,0x42,0x4c,0xab,0xe8,0xb8,0xd5,0x18,0x06,0x04,0xc7,0x42,0x5b,0xdb,0x23,0x55,0xba,0x67,0x7d,0xec,0x45,0x2d,0x97,0x19,0x46,0x0a,0xed,0xf6,0x3c,0x6e,0x12,0x45,0x2a,0x3c,0x1b,0x1e,0xde,0xb8,0x31,0xa4,0x3e,0xe1,0xe8,0x36,0x0d,0x81,0x9f,0x99,0x0c,0xf1,0x3b,0xc7,0xb7,0xa0,0xbb,0x34,0x77,0x84,0x1b,0xe1,0xee,0xf2,0xcd,0xf7,0x1c,0xc8,0x10,0xcb,0x7d,0xbe,0x85,0xa6,0x84,0xe1,0x0b,0x75,0xac,0x6f,0xc8,0xb7,0x61,0x68,0xc2,0xdc,0xed,0x9b,0xef,0x39,0x2c,0x7f,0x98,0xfb,0x7d,0x43,0xbd,0x0c,0x43,0xf2,0xc0,0x27,0xfb,0x71,0x39,0xae,0x29,0x04,0x5b,0x1c,0x57,0xfd,0xf6,0x08,0xc0,0x41,0xfe,0x8c,0x2f,0x47,0x21,0x0d,0x08,0xe0,0x09,0x47,0x8f,0xc0,0xe7,0x16,0xc5,0x13,0xfe,0x1f,0x81,0x29,0x20,0x94,0xe7,0x63,0x83,0x10,0xac,0x3e,0xf1,0x44,0x45,0x0e,0x6e,0x0c,0x78,0x98,0x3c,0x1f,0x86,0x11,0x08,0x3e,0x70,0x14,0xf5,0xf0,0xd0,0xc2,0x8d,0x81,0x08,0x6d,0xc1,0x0f,0xe3,0x0c,0x04,0x23,0x04,0x8a,0x91,0x88,0xd8,0xc3,0x8d,0x22,0xfd,0x9c,0x86,0xa7,0x11,0xe4,0xd3,0x31,0xa4,0x40,0xba,0xf3,0x91,0x0f,0xda,0x68,0x44,0xa4,0x82,0x20,0x4f,0x46,0x28,0x17,0x2a,0x7a,0x71,0xa3,0xc8,0x84,0x71,0xf2,0x38,0x94,0x41,0x70,0x92,0x41,0x71,0x12,0x11,0xde,0xb8,0x51,0x64,0xe3,0x1a,0x3f,0x3b,0xd6,0x41,0x90,0xcf,0xc6,0x68,0xb4,0x39,0x77,0xbe,0x5c,0x28,0xcd,0x87,0xc1,0x10,0x82,0x7c,0x0e,0x49,0x3e,0x3c,0x40,0x72,0xa3,0xc8,0x3f,0x70,0x1d,0x11,0xd1,0x12,0x82,0x93,0x7c,0x84,0x1d,0x44,0x45,0x50,0x6e,0x14,0x85,0x98,0xbe,0xd0,0x09,0xa7,0x10,0xe4,0x0b,0x31,0xec,0x3a,0x9c,0x28,0xf5,0x04,0x5c,0x61,0x76,0xe9,0x71,0xc0,0x85,0xb2,0x4c,0x18,0xd2,0x34,0x45,0x44,0x61,0x1e,0x6e,0x42,0xad,0x64,0x8c,0x98,0x0c,0xc5,0x0d,0xd2,0x50,0x46,
-0x05,0x6a,0x1e,0x6e,0xc2,0x6d,0x65,0x58,0xd8,0x86,0xe2,0x01,0x6d,0x23,0x43,0x63,0x39,0xf7,0xb2,0xb9,0x1c,0x7a,0x8c,0xc3,0x9c,0x0e,0x8b,0x18,0xe2,0xf0,0xa5,0xc7,0x1b,0xe1,0x40,0x67,0x0a,0x1f,0xe0,0x40,0xc3,0x87,0x8e,0x6f,0xa0,0xc1,0x43,0x87,0x37,0xd0,0xe0,0x8f,0x46,0x37,0xd0,0xb9,0x62,0x0d,0x6e,0x58,0x59,0x9f,0x1a,0xdb,0x08,0x66,0x79,0x34,0xb4,0x11,0xcc,0xf1,0x68,0x64,0x23,0x98,0x23,0xe6,0xc0,0x46,0x30,0x63,0x60,0x5c,0x03,0x5d,0x5b,0x8f,0x87,0x35,0x82,0xa8,0x23,0x46,0x35,0x42,0x74,0xf1,0xf1,0xa0,0x46,0x90,0x4a,0xd4,0x98,0xc6,0x33,0x92,0x4f,0x3f,0xae,0x1c,0x32,0x5a,0x01,0x23,0xc2,0x84,0x70,0x89,0xa1,0x22,0x82,0x10,0x32,0x31,0x86,0x33,0x82,0x64,0xa2,0x46,0x33,0xe2,0xb5,0xbe,0x9b,0x33,0x7f,0xa4,0xa6,0xb9,0x30,0x84,0x8f,0x87,0x32,0x10,0xb8,0x23,0x46,0x32,0x22,0x8d,0x4c,0xd4,0x40,0x46,0x68,0xdb,0x44,0x8e,0x63,0xc4,0xb2,0x7d,0x77,0x1f,0xfb,0xc8,0x54,0x40,0x27,0x88,0x6e,0x5b,0x31,0x06,0x31,0x10,0xad,0x2b,0x6a,0x0c,0x03,0x4d,0x28,0xce,0x10,0x46,0x90,0x50,0xe4,0x08,0x46,0x3c,0xa7,0xe2,0x72,0x7a,0xc1,0xf6,0xfb,0x78,0xfc,0xc2,0x75,0xb2,0x80,0xcf,0xe7,0x71,0xbc,0xbe,0x31,0xd4,0x5d,0x84,0xd7,0x0b,0x40,0xc4,0xf3,0x7b,0x61,0xd9,0xc2,0x3d,0x5f,0x58,0x8e,0x50,0xdf,0x17,0x96,0x21,0xd4,0xfb,0x85,0x65,0x78,0xe4,0xff,0xc2,0xf2,0xc5,0xf2,0x80,0x4e,0xe6,0xa7,0x7c,0x20,0x2a,0xd3,0x23,0x2f,0x88,0xca,0xf3,0xc8,0x0f,0xa2,0xf2,0xc4,0xf4,0x84,0xa8,0xac,0x01,0x5f,0x18,0x56,0x73,0x8f,0xbd,0x21,0x0a,0x7d,0x84,0x3f,0x0c,0xd5,0xd2,0xc7,0x1e,0x11,0x45,0x29,0xca,0x27,0x3e,0xa7,0x0d,0xe9,0x38,0x15,0x45,0x3e,0x52,0xcd,0x28,0xcf,0x18,0x21,0x43,0xa4,0x6f,0x0c,0x23,0x15,0xc3,0x3b,0xa2,0x48,0x45,0xf9,0xc7,0xb8,0x2d,0xd4,0xf1,0x90,0x31,0x54,0x38,0x17,0x8e,0xf4,0xb1,0x97,0x44,0xe2,0x8f,0xf0,0x93,0x0f,0x4c,0x52,0x94,0xa7,0x8c,0x68,0xc1,0x48,0x5f,0x19,0xd3,0x5e,0xde,0xbc,0x65,0x0c,0xb3,0x02,0xbc,0x5e,0x68,0xfb,0x8b,0xe1,0x31,0x91,0x2d,0x30,0xca,0x67,0x86,0x11,0x8b,0xe3,0x35,0x51,0xc4,0x22,0xfd,0x66,0x5c,0xb7,0x74,0xf7,0x9c,0xc8,0x76,0x1e,0xc3,0x77,0xde,0x4f,0x91,0xf1,0xf9,0xce,0xd3,0xfd,0xec,0x9b,0x70,0xf7,0x89,0x02,0x8a,0xe7,0x41,0x23,0x72,0x86,0x3b,0xd1,0x88,0x4c,0xa1,0x7e,0x34,0x22,0x4f,0xa8,0x2b,0x8d,0xc8,0xf3,0xc8,0x9b,0x46,0x64,0x8d,0xe5,0x50,0x4f,0xee,0x23,0x87,0x9e,0xf0,0xa9,0x21,0xf9,0x1e,0xb9,0xd5,0x90,0x6c,0x8f,0x3c,0x6b,0x48,0xb6,0x98,0xce,0x35,0x24,0x77,0xc0,0xbf,0x46,0xd4,0xe5,0x63,0x17,0x1b,0x42,0x24,0xc2,0xcb,0x46,0x29,0xf3,0x63,0x47,0x1b,0x42,0x2f,0xca,0xd7,0x3e,0xad,0x2b,0xe9,0x98,0x55,0x47,0xc6,0xd0,0xe0,0x28,0xa7,0x1b,0x2d,0x5e,0xa4,0xdf,0x8d,0x20,0x18,0xc3,0xf5,0x86,0x10,0x8c,0xf2,0xbe,0x4f,0xb4,0x6b,0xc7,0x01,0xc7,0x53,0xf6,0x5c,0x24,0xea,0xc7,0x6e,0x38,0x8c,0x4a,0x84,0x27,0x7e,0x6c,0xd7,0xa2,0x9c,0x71,0x74,0xd3,0x47,0xfa,0xe3,0xf8,0xd6,0xf7,0xe6,0x92,0xe3,0x19,0x26,0xe0,0x59,0xa3,0x5a,0x6d,0x0c,0xc7,0x1c,0xd6,0x6e,0xa3,0x7c,0x73,0x04,0xc9,0x38,0xee,0x39,0x84,0x64,0xa4,0x87,0x7e,0xc2,0xf3,0xdd,0x9d,0x74,0x98,0x8d,0x88,0xe1,0xa7,0xef,0xc7,0xb3,0xf9,0xfc,0xb4,0x7d,0x90,0x5c,0xb8,0x8f,0xf6,0x03,0xc4,0xf3,0xcf,0x21,0xb9,0xc2,0x7d,0x73,0x48,0x86,0x50,0xbf,0x1c,0x02,0x1f,0xea,0x93,0x43,0xe0,0x1f,0xf9,0xe3,0x90,0x6c,0xb1,0x7c,0xf1,0xed,0x8c,0xbe,0x27,0xfc,0x30,0x22,0xcf,0x23,0x1f,0x8c,0xc8,0xf2,0xc8,0xff,0x22,0xb2,0xc4,0xf4,0xbd,0x88,0x9c,0x01,0xbf,0x1b,0x52,0x67,0x8f,0x7d,0x2e,0x02,0x79,0x84,0xbf,0x0d,0x53,0xcc,0xc7,0xbe,0x16,0x41,0x27,0xca,0xcf,0x3e,0xa5,0x03,0xe9,0x18,0x55,0x44,0x3e,0xd0,0xc6,0x28,0xdf,0x1a,0x2e,0x3a,0xa4,0x5f,0x0d,0x21,0x14,0xc3,0xa7,0x22,0x08,0x45,0xf9,0xd3,0x98,0xed,0xd1,0xf1,0xa5,0x8f,0x95,0x36,0x17,0x8a,0xf2,0xb1,0x0f,0x45,0x61,0x8f,0xf0,0x9f,0xd1,0xb6,0x27,0xca,0x77,0x86,0x37,0x57,0xa4,0xdf,0x8c,0x67,0x15,0x6f,0x3e,0xf3,0xb1,0x01,0x01,0x0e,0x2f,0xac,0xb5,0xc5,0xf0,0x95,0xa8,0xf6,0x16,0xe5,0x27,0x43,0x48,0xc5,0xf1,0x91,0x08,0x52,0x91,0xfe,0x31,0xa6,0xd7,0xb9,0xfb,0x46,0x54,0x9b,0x36,0xfd,0xa2,0x0d,0xed,0xdd,0x69,0x64,0x9f,0xbb,0xff,0xe9,0xd9,0x22,0xe8,0x7b,0xe9,0x39,0x9f,0xdf,0x46,0xe2,0xda,0x5f,0xe8,0xe0,0xb3,0xf7,0xf3,0x05,0x20,0x1f,0x9c,0xc2,0x87,0xd8,0x12,0xf7,0xf0,0x96,0x5d,0x17,0xac,0xc0,0xec,0x64,0x78,0xf0,0xbb,0xbb,0x50,0xbe,0x4b,0x63,0x31,0x77,0x41,0x30,0x54,0xee,0xf0,0xd2,0xa0,0xc1,0x63,0x9f,0xf8,0xeb,0xcf,0xe9,0xac,0xbe,0xb7,0x33,0xc0,0x5d,0x8f,0xb7,0x83,0x0b,0x9f,0x5e,0x5b,0x68,0x21,0xd6,0x24,0xfb,0x66,0x55,0x78,0xb6,0xca,0x87,0x75,0xc0,0x8a,0x2f,0xdd,0x45,0xf5,0xb6,0x2f,0xd9,0xf6,0x72,0xbe,0x9d,0x89,0x51,0xdb,0xe8,0xdc,0x98,0x92,0xde,0x72,0xdc,0x0f,0xba,0x71,0xc1,0xdb,0x8b,0x28,0x51,0x9b,0x28,0xad,0xf4,0x83,0x6c,0x48,0x70,0xf7,0x6c,0x14,0xfb,0xc7,0x9b,0x2e,0x04,0xb7,0x7f,0xbe,0x50,0x63,0x1f,0xce,0x75,0x08,0xf6,0x30,0xcf,0x77,0xdf,0xb5,0xc9,0xcf,0xcc,0x8f,0xe8,0x2e,0x3c,0xfe,0xdb,0x97,0x45,0x5e,0x53,0xdf,0x8f,0x20,0x4a,0x55,0x9f,0xde,0xe6,0x1a,0xd8,0xb5,0x7d,0xc7,0x95,0xb0,0x30,0xde,0xce,0x2c,0x70,0x6f,0x97,0xc7,0xec,0xe7,0xbb,0x79,0x78,0xee,0x48,0x83,0x34,0x67,0x1e,0x61,0xf0,0x66,0xfe,0x87,0x7d,0x77,0x93,0x35,0x03,0xd4,0xfb,0x41,0x4f,0xb7,0xd3,0xe8,0x7e,0xa4,0xe3,0x6d,0x13,0x71,0x55,0x86,0xef,0x64,0x38,0x33,0xc5,0xda,0xb5,0x7c,0x6b,0xc1,0xe6,0x66,0xe7,0x27,0x8e,0x39,0x73,0xe3,0x70,0xb6,0x40,0xfb,0x94,
-0x0e,0x05,0x12,0xd3,0x2c,0x3d,0xa3,0x63,0x9e,0xd2,0x44,0x5e,0x94,0xee,0xd8,0xb1,0xa7,0x18,0x73,0x1f,0x82,0xe9,0xd4,0x9d,0xb5,0x8d,0xdf,0xfc,0x6a,0x6e,0x97,0x37,0x5b,0x12,0xea,0x68,0x10,0x87,0x16,0xdc,0xeb,0x7d,0x07,0xf2,0x6f,0x6e,0x77,0x8c,0x01,0xbc,0xf1,0x23,0x71,0x3b,0x1e,0x15,0x64,0x7c,0xf5,0x64,0x1f,0x13,0x7d,0xe0,0xd8,0x02,0x7f,0x75,0x98,0xa7,0x43,0xbd,0x2f,0x79,0xe3,0xc4,0x3b,0x0a,0x6f,0x9e,0x5f,0xf4,0xe5,0x3b,0x3c,0xc4,0x73,0x14,0x0f,0x6e,0xde,0x72,0x16,0x3c,0xc7,0x28,0xfd,0xdd,0xc1,0x60,0x00,0xbd,0x4f,0x1c,0x64,0xdf,0x19,0x02,0x56,0xdf,0x0e,0x42,0x40,0xbd,0x7e,0xe2,0x52,0x28,0x4f,0x16,0xff,0x71,0x79,0xbe,0x54,0xf4,0x05,0x38,0x5e,0x18,0xef,0x8d,0x3b,0x68,0x2a,0xfe,0x1b,0x63,0x7c,0x67,0x6e,0x14,0xbe,0x87,0x66,0x78,0xc0,0x60,0xd8,0xfd,0x31,0x21,0x6c,0x98,0xc2,0x08,0xa9,0x7d,0xf7,0x11,0x37,0xf1,0x9b,0xac,0x17,0xb9,0x79,0xcc,0x54,0xc8,0x65,0x1f,0x28,0x66,0x90,0x47,0x16,0xfa,0x25,0x74,0x3f,0x02,0x0b,0x59,0x79,0xb9,0x60,0xe5,0x3d,0x3e,0x82,0x30,0x66,0x0e,0xfb,0xc0,0xbd,0x50,0x8e,0xc2,0x31,0xba,0xce,0x96,0xf3,0x9c,0x92,0x18,0x22,0x18,0x53,0xc7,0x19,0x2f,0xd0,0xe7,0xcd,0x40,0x17,0x42,0xe0,0x6d,0xd4,0x0e,0x1c,0x8e,0x06,0x93,0xa5,0x3b,0x9b,0x80,0x46,0x34,0x34,0x7c,0x04,0x1a,0x62,0xdd,0xbb,0x18,0x92,0x6e,0x1f,0xf0,0xca,0xc4,0x28,0x93,0x0b,0x1d,0xba,0x2e,0x03,0x48,0x63,0x9e,0x6e,0x83,0x07,0xa5,0xee,0xa5,0xe7,0x2d,0x75,0x28,0x59,0x14,0x70,0x3c,0x4e,0x63,0x12,0x40,0x42,0x87,0x9e,0x77,0x6b,0x4b,0xde,0x7b,0x1f,0x25,0xe2,0x9e,0x3a,0x0f,0x31,0xab,0x1c,0xb2,0xe7,0x92,0x4d,0x69,0xcb,0x08,0xfc,0x87,0x75,0x7a,0x35,0x70,0x12,0x0c,0x27,0x01,0x0b,0xfd,0x07,0x4e,0xe2,0x1c,0x2f,0xbc,0xfd,0x3b,0x9f,0xe7,0xd3,0x3c,0x99,0xc0,0xde,0x20,0xb6,0x44,0x0e,0xff,0x9b,0xf5,0x05,0x86,0x1b,0xaf,0xb4,0x7d,0x87,0x01,0xb4,0x0d,0xf8,0x05,0x56,0x5e,0xb6,0x43,0xd1,0xa7,0x36,0x87,0x5b,0xc7,0x07,0xe7,0x11,0x3f,0x56,0xc2,0xa7,0x0e,0x2a,0x0e,0x67,0x03,0xd6,0x21,0xf2,0xec,0xbf,0xb0,0x43,0xc9,0x5c,0xe6,0xf5,0x89,0xeb,0x0e,0x3d,0x59,0x42,0xed,0xb0,0x95,0x1a,0xed,0x0b,0x2d,0x18,0xaf,0x2f,0x44,0x90,0x40,0x3a,0x42,0x22,0x93,0x79,0x73,0x7e,0x3d,0xbe,0xd0,0x97,0xe7,0x01,0x83,0x61,0xbe,0x10,0xc5,0x46,0x94,0x23,0xf4,0xb0,0xf3,0xac,0x2f,0xbc,0xe3,0x0f,0xf3,0x85,0xb6,0xd4,0x51,0x2c,0x45,0xbb,0x43,0x5b,0x48,0x48,0x77,0xe8,0xe1,0x39,0x17,0xac,0xc2,0x27,0x3c,0x62,0x74,0x0e,0xbf,0x6d,0xf4,0x33,0x15,0x8e,0x31,0xcc,0x23,0xa2,0xc4,0xe3,0x75,0x87,0x30,0x88,0x43,0xf9,0x42,0x0f,0x70,0xb8,0x2f,0x74,0x83,0x3d,0xf6,0x85,0x2e,0x68,0xa4,0x2f,0xf4,0xa5,0xfb,0x7d,0x61,0x58,0x69,0x22,0x1c,0x61,0x08,0xc6,0x17,0x6c,0x10,0x92,0x5e,0x98,0x9f,0x8a,0x01,0x1c,0x8f,0xd3,0x98,0x04,0x9e,0x73,0x84,0xd6,0x69,0xab,0xe8,0x5b,0x99,0x03,0x86,0xd3,0xa4,0xf4,0xbc,0x17,0xc4,0x30,0x0c,0xfa,0x1d,0x0b,0x9b,0xe5,0x7a,0xf0,0x3c,0x9e,0xc5,0xb3,0xaf,0x38,0x42,0x0f,0x0f,0xaf,0x38,0xc2,0x47,0xdc,0xbc,0x6c,0x87,0xa2,0x7d,0x61,0x88,0x75,0x7c,0xdd,0x11,0x06,0x70,0x3c,0x76,0x84,0x61,0x3c,0xc4,0xf2,0x82,0x7e,0x73,0x7d,0xc7,0xf4,0xdc,0x2d,0xbe,0x9e,0x5c,0xa1,0x46,0xd8,0x4a,0x8d,0xf6,0x85,0x16,0x0c,0xea,0x26,0xd6,0x00,0x0c,0xca,0x1d,0x66,0xc8,0x37,0xeb,0x9f,0xc7,0x17,0xfa,0x32,0x3c,0x60,0xf0,0xd1,0xbd,0xa2,0x3e,0xe8,0x28,0x77,0x78,0x67,0xe7,0x59,0x5f,0x78,0x47,0x1e,0xda,0x2f,0xb4,0xae,0x77,0x40,0xf1,0x13,0xed,0x0b,0x6d,0x21,0x21,0x7d,0xe1,0x9d,0xe1,0x5c,0xb0,0xfe,0x9e,0x70,0x84,0xd1,0x39,0xfc,0xb6,0xd1,0xcf,0x51,0x38,0xc6,0x30,0x47,0x18,0x22,0x1b,0xaf,0x2f,0xb4,0x0f,0x36,0x44,0xb9,0x43,0x0f,0x7c,0xb8,0x3b,0x74,0x83,0x3d,0x76,0x87,0x2e,0x68,0xa4,0x3b,0xf4,0xa5,0xfb,0xdd,0x61,0x44,0x99,0x22,0x3c,0x62,0x08,0xd2,0x17,0x8c,0x11,0x92,0x5e,0x98,0xc3,0x8a,0x01,0x1c,0x8f,0xd3,0x98,0x04,0x9e,0xf3,0x88,0xb6,0xe4,0xbd,0x4e,0x11,0x7d,0xb9,0xb8,0x87,0xde,0xf3,0x7e,0x91,0x5b,0x71,0x79,0xae,0x60,0x76,0xc9,0x4c,0x84,0xbf,0xd4,0x41,0xf4,0xf0,0xf0,0x8a,0x5f,0x7c,0xc4,0xcd,0xcb,0x36,0x29,0xda,0x2f,0x86,0x5b,0xca,0xd7,0x5d,0x63,0x00,0xc7,0x63,0xd7,0x18,0xc1,0x46,0x2c,0xef,0xe8,0xb1,0xde,0x77,0x34,0x4f,0xdd,0x55,0xef,0xce,0x14,0x6a,0x91,0xcd,0xc4,0x68,0xbf,0x68,0x82,0xf8,0xba,0x88,0x28,0x12,0xe8,0x4e,0x22,0x09,0x5c,0xbc,0xfd,0xeb,0x71,0x8c,0xde,0x2c,0xd1,0xfc,0x85,0x76,0x11,0x91,0x6c,0x44,0x76,0x12,0xdd,0xec,0x3c,0xeb,0x18,0x6f,0xe8,0xc3,0xfc,0xa2,0x2d,0x75,0x04,0x43,0xd1,0x6e,0xd1,0x92,0x10,0xba,0x87,0xe8,0x66,0x38,0x17,0xa8,0xbf,0x27,0xfc,0x62,0x64,0x06,0xbf,0x81,0xf4,0x71,0x14,0x8a,0x2f,0xb4,0x77,0x88,0x94,0x8c,0xaf,0x7f,0x68,0xc5,0x73,0x28,0x9f,0xe8,0x06,0x0f,0x77,0x89,0x2e,0xa8,0xc7,0x1e,0xf1,0x0e,0x8c,0x74,0x88,0xde,0xe4,0x40,0xf7,0x30,0xb4,0x38,0x11,0xee,0x10,0x8d,0xf2,0x05,0xfb,0x83,0xa2,0x16,0xe6,0xab,0x1e,0xc3,0xc6,0x62,0x33,0x1e,0xfa,0x27,0xfb,0x86,0x9e,0x3b,0xeb,0x62,0x05,0xf5,0x90,0xdc,0xf3,0x8e,0x10,0x5f,0xe1,0x05,0x9c,0x81,0xae,0xc7,0xc2,0x67,0xb9,0x1e,0x32,0x4b,0x62,0xe9,0x97,0x7c,0xa1,0x9b,0x8b,0x57,0x5c,0x61,0x0c,0x7e,0x5e,0x35,0x44,0x0f,0x3a,0x89,0x61,0xf6,0xf1,0x75,0x5f,0xe8,0x47,0x11,0xa3,0x97,0x18,0xca,0x44,0xbc,0x7e,0xa2,0xcf,0x62,0xdf,0x11,0xd9,0x97,0x95,0x87,0x5e,0x25,0x87,0x1c,0x32,0xb5,0x33,0x85,0x9a,0x62,0x27,0x3d,0xda,0x25,0x3a,0x50,0x11,0x03,0xa7,0x37,0x90,0xa7,0x86,0x4e,0x03,0xb9,0x1e,0x32,0x1a,0x6b,0xf8,
-0xf4,0x06,0xfc,0x97,0x0d,0xa0,0xba,0x29,0x84,0x0e,0xa1,0x5a,0x37,0xfc,0xa1,0xd9,0x8a,0xf6,0x90,0x37,0xb1,0x3d,0x37,0x8c,0xfa,0x88,0x00,0xca,0xaf,0x3d,0xca,0xe3,0xb7,0x9f,0x41,0xd6,0xa2,0xb0,0xc6,0x1a,0x4e,0xbd,0xab,0x57,0xac,0x01,0x55,0x1f,0x78,0xb8,0xc3,0xf4,0x02,0x3e,0xf6,0x99,0x1e,0x78,0xa4,0xdb,0x0c,0x40,0x44,0x0e,0xac,0x86,0xe1,0x0b,0xab,0xd2,0xdf,0xe1,0x3c,0x43,0x68,0x86,0x39,0xb8,0x58,0xe0,0x71,0xf9,0x8d,0x4d,0xe4,0x77,0x0e,0xb2,0xda,0xd7,0x68,0xfa,0x68,0x3d,0xef,0x45,0x31,0xac,0xc0,0x67,0x59,0x73,0x6c,0xd3,0x44,0x69,0x79,0x2d,0x0c,0xe3,0x73,0xfc,0xf2,0x15,0x2f,0xea,0x63,0xe4,0xb5,0xb1,0xd6,0x87,0x2c,0xfd,0x82,0xd5,0x7a,0x62,0xc0,0x15,0x91,0xef,0x57,0x54,0xf3,0xe5,0x41,0xd7,0x80,0xd5,0xfd,0x85,0x61,0x57,0x49,0x59,0xa9,0xa8,0x3e,0x0d,0x91,0x4b,0x73,0x2c,0xd2,0x97,0xc2,0x1c,0xa1,0x16,0xdb,0x4c,0x8c,0xf6,0xa2,0x26,0x48,0x84,0x0b,0xb5,0xd2,0x9f,0xf2,0x9f,0xde,0x2c,0xd1,0xcc,0xc5,0xf2,0x9c,0x16,0xe4,0x5f,0xe6,0x36,0x6f,0xe8,0x43,0xbb,0x94,0x66,0xf5,0xff,0x44,0x30,0x14,0xed,0x30,0x2d,0xd9,0x3c,0xe7,0x2d,0x23,0x51,0xa3,0x9c,0x5a,0x64,0x06,0xbf,0x91,0xf4,0x71,0x14,0x8a,0x2f,0x96,0x87,0xb4,0x55,0x27,0x96,0x7b,0x74,0xc3,0x86,0xfb,0x46,0x17,0xd4,0x63,0xc7,0x78,0x07,0x46,0x7a,0x45,0x6f,0x72,0xa4,0x4b,0x44,0x62,0x42,0x56,0xdd,0xef,0x70,0x86,0x28,0x6a,0x61,0x4e,0xea,0x31,0x6c,0x2c,0x36,0xe3,0xa1,0xff,0x8d,0x0e,0xd0,0x6e,0x31,0x1e,0x42,0x2f,0xf4,0x21,0x33,0xb9,0x1c,0x9b,0x35,0xfb,0x6c,0x26,0x3e,0xbb,0xcf,0x96,0xce,0x66,0xf9,0xcc,0x2b,0xde,0xcf,0xcd,0xc5,0x4b,0x7d,0xc8,0xc7,0xfc,0xbc,0x6a,0x79,0x9e,0xf0,0x7b,0xfe,0x4c,0x2f,0xab,0xe0,0xcb,0x1e,0xcf,0x6b,0x30,0x7f,0xc1,0xdd,0xe9,0x07,0x96,0x85,0x3b,0x17,0x82,0xf4,0x88,0x34,0x87,0x67,0x31,0xa4,0xc7,0xb3,0x33,0x85,0x5a,0x5d,0x27,0x3d,0xda,0xef,0x39,0x50,0x11,0xae,0xef,0x06,0xf2,0x94,0xf7,0x0b,0xe4,0x7a,0xc8,0x68,0x2c,0x1f,0x78,0x03,0xfe,0xcb,0xdc,0xa0,0x9b,0x42,0x98,0x27,0xb4,0xc4,0x12,0x94,0x60,0x0c,0x67,0x78,0x13,0xdb,0x73,0xfe,0xf0,0x11,0x01,0x94,0x0b,0x7b,0x94,0xc7,0x6f,0x33,0x83,0xac,0x45,0x61,0x8d,0xe5,0x1b,0xef,0xea,0x15,0xcb,0x3d,0xfa,0xc0,0xc3,0x3d,0xa4,0x17,0xf0,0xb1,0x93,0xf4,0xc0,0x23,0xfd,0x64,0x00,0x22,0xd2,0x55,0x86,0xe1,0x0b,0xab,0xd2,0xdf,0xe1,0x30,0x43,0x68,0x86,0x39,0xb5,0x58,0xe0,0x71,0xf9,0x8d,0x4d,0xe4,0x37,0x3a,0x4f,0xbb,0x91,0xf9,0x69,0xbd,0xe0,0x3f,0x09,0x66,0x45,0xac,0xa0,0xbf,0xb2,0x50,0x5a,0xfe,0x8a,0x60,0x79,0x22,0xcf,0xbc,0xe2,0x3f,0x7d,0x8c,0xbc,0xe4,0x42,0x1f,0xb3,0xf4,0x0b,0x56,0xeb,0x09,0x2f,0x8a,0xc8,0xf7,0x2b,0xaa,0xf9,0xb2,0x2f,0x0d,0x58,0xdd,0x5f,0x70,0xa7,0x27,0x46,0x53,0x24,0xe0,0x3f,0x50,0x24,0x39,0x2e,0x93,0xfb,0x74,0x61,0xc1,0xde,0xe0,0xc7,0xbb,0x03,0xc0,0xca,0x1e,0xbe,0xa7,0xc0,0x4e,0x7f,0xb0,0xb3,0xc3,0x86,0xfa,0x11,0x70,0x99,0x11,0x24,0x91,0x2e,0xd6,0x86,0x2f,0x44,0xc1,0x3f,0x64,0x36,0xc4,0xb9,0x3e,0x64,0x28,0xca,0xcd,0xda,0xf9,0x9e,0xde,0xeb,0xe1,0xc2,0x1d,0xbe,0xdb,0x03,0x0a,0x2a,0x28,0xd3,0x38,0x5b,0x3e,0x1c,0xf1,0x21,0x1d,0xec,0x83,0xb2,0xc6,0xde,0xf3,0xf1,0x20,0x4f,0x60,0xfd,0x7f,0x80,0xa9,0x28,0xac,0x21,0xae,0xf5,0x61,0x01,0x3c,0x4e,0xd6,0x0b,0x8d,0xde,0x09,0xe2,0xcd,0x18,0xb1,0x17,0xc4,0x03,0x18,0x63,0x37,0x88,0x1b,0x1e,0xe9,0x6e,0x03,0x10,0x3e,0x77,0x1b,0xab,0xac,0x11,0x8e,0x37,0x14,0xff,0x2b,0xeb,0xf2,0xd1,0x34,0x43,0x77,0x6f,0xc4,0x01,0x8f,0xcb,0x6f,0x6c,0x22,0x4f,0x39,0x5e,0x9f,0x6e,0x78,0x5c,0xb0,0x2f,0xcd,0xdb,0x20,0xfd,0xf4,0x9f,0x77,0xc6,0xab,0x15,0xf0,0x7c,0xf6,0x66,0x0d,0x88,0xf2,0xb6,0x16,0x87,0xc9,0x61,0x2f,0xed,0x1e,0xf1,0x32,0xf2,0x8a,0x33,0x8e,0xc1,0xd2,0x2f,0x58,0xb8,0x48,0x67,0x1c,0xcb,0x26,0xbd,0xbe,0xa1,0x24,0x88,0xe5,0xa1,0x5b,0x8e,0xc5,0x51,0x2c,0x07,0x7d,0x77,0x0f,0xee,0x09,0x57,0x45,0x08,0x89,0x04,0xd3,0xf9,0x90,0x8e,0xae,0x95,0x27,0x62,0xc1,0x8a,0x99,0xfc,0x68,0xdd,0x90,0x09,0x14,0xd1,0xcb,0x75,0x20,0x9e,0xea,0xe4,0xfa,0x33,0x3d,0x62,0x32,0x56,0x17,0xd7,0x81,0xfd,0xcb,0x7a,0xb8,0x2e,0x02,0xe1,0xfe,0x17,0x8a,0x23,0x20,0xb8,0x58,0xeb,0x87,0x2c,0x69,0x3d,0xd7,0xbd,0x7d,0x80,0x1e,0xe5,0x2c,0x1f,0x64,0x09,0x2e,0x2d,0xf1,0xf1,0x15,0x81,0x33,0x56,0xd7,0xf6,0xa6,0x52,0xb1,0x7a,0xb6,0x5e,0xe8,0xa8,0x75,0x44,0x2e,0xb8,0x38,0x2b,0x89,0xee,0xe0,0x48,0x3f,0xeb,0x07,0x88,0xec,0xd5,0x86,0x60,0x0b,0xa9,0xca,0xdf,0xb3,0x9c,0x08,0x45,0x31,0x7c,0xc5,0xcf,0x63,0xe8,0x98,0xcc,0xc6,0x25,0xf1,0x1b,0xfb,0xb3,0x76,0x9b,0xf2,0x91,0x7a,0xc5,0x83,0x62,0x99,0x2c,0x6e,0xb9,0x2b,0x88,0xd1,0x71,0x57,0x19,0x02,0xb8,0xae,0x97,0x96,0x14,0xb9,0xf9,0x78,0xcd,0x81,0x3e,0xe4,0xe8,0x75,0x0b,0xf5,0x44,0x67,0x36,0x98,0xed,0x17,0x54,0xf2,0xe5,0xae,0xac,0xdf,0xbc,0x3e,0xdf,0x93,0x7d,0xf2,0xa4,0x09,0x48,0x14,0xe6,0x38,0x6c,0x13,0xe6,0xb3,0x75,0xb6,0x83,0x7d,0x82,0x83,0x73,0xd8,0x41,0x01,0x9e,0xe9,0xe2,0xbc,0x83,0x27,0x6b,0x14,0x5e,0x39,0xd4,0x02,0x92,0x92,0x19,0x4d,0xe0,0x23,0x28,0xe1,0x79,0x3f,0x29,0xf3,0x8d,0xcb,0x99,0x98,0x07,0x13,0xf1,0xd6,0x32,0xe4,0x1b,0x9a,0x7b,0x1b,0x84,0x47,0xb8,0x05,0x92,0x11,0xa7,0xbe,0x7c,0x06,0xcf,0xf6,0x08,0xc5,0x0e,0x8f,0xab,0x51,0x0c,0x06,0x28,0xb0,0xf6,0x80,0x90,0x0b,0x32,0xf4,0x7c,0x0c,0x97,0x05,0xbe,0xe3,0xf8,0x72,0x1d,0xc2,0x92,0xc1,0x8e,0x22,0x8a,0x23,0x37,0x0c,0x68,0x18,0x10,0x48,0xb7,0x4e,0xc4,0x08,
-0xb1,0x26,0xa8,0x73,0x38,0xe2,0x1d,0x4d,0x63,0xe3,0xbd,0x2b,0x87,0x23,0x27,0x53,0xf2,0xb7,0x33,0x3d,0x5c,0x60,0xa6,0x60,0x6f,0x50,0xa6,0xd0,0x12,0xb7,0x43,0x46,0xe0,0xf9,0x22,0x51,0x4b,0x29,0x11,0x8c,0x26,0xb2,0x26,0xb7,0x2b,0x50,0x9d,0xef,0x2b,0x86,0xe5,0xbf,0xec,0x6f,0x5b,0x49,0xbe,0x7c,0x30,0x92,0xb9,0x0e,0xfd,0x53,0xd7,0xd8,0x8f,0x83,0x26,0xff,0xc1,0x31,0x06,0xf3,0x01,0x01,0x52,0x86,0x01,0x8c,0x28,0xa3,0xf3,0x59,0xf2,0x8d,0xa2,0xca,0x14,0xf8,0x69,0x51,0x75,0xf0,0xff,0x89,0x3a,0x8d,0xf0,0xf6,0xb1,0x2d,0xe4,0x87,0x34,0xcb,0x82,0x17,0xc5,0x3c,0x4c,0x9c,0x57,0x3b,0xc6,0x7c,0x46,0xcd,0x26,0x46,0xb3,0x09,0x1e,0xe9,0x1a,0x7c,0x59,0x19,0x28,0xf3,0x59,0xe7,0x04,0xbf,0x9a,0x18,0x66,0xf0,0x3f,0xaa,0xbe,0x20,0xce,0x99,0xc5,0xba,0xdd,0x5e,0xe5,0x05,0x08,0x44,0x82,0xff,0x4a,0x4c,0x55,0x94,0xe7,0xd3,0x7e,0xb7,0x98,0xcc,0xd2,0x10,0x1c,0xbe,0xa4,0x4a,0x0b,0x95,0xa9,0x4e,0x44,0x9a,0x18,0x97,0x2e,0x7d,0x80,0x74,0x00,0xe1,0xa9,0x0d,0x53,0xc5,0x31,0x9e,0x9e,0x53,0x94,0x02,0x19,0x1a,0x9b,0xf4,0xeb,0xd5,0xf3,0x71,0x4e,0x94,0x8b,0x1a,0x55,0x85,0x59,0x2b,0x26,0x29,0xba,0x01,0x78,0x12,0x4f,0x90,0xe9,0x19,0xcc,0x6f,0xd1,0x17,0x96,0xdb,0x8a,0xb1,0x98,0x8d,0xe5,0x0c,0x07,0xf9,0x9f,0xf6,0x21,0xa4,0xa8,0xd0,0x47,0x36,0xdd,0x87,0xa0,0xf0,0xa7,0x56,0x85,0xff,0x17,0x61,0x79,0xbb,0x0c,0xb5,0x00,0x00,0x10,0x6a,0xb7,0x29,0x5e,0x4d,0x62,0xf9,0xe2,0xb6,0xdf,0x6a,0xc3,0x7c,0xd9,0x13,0x75,0xa5,0xfa,0x1b,0x0a,0xf1,0x43,0x97,0x51,0x6f,0x29,0x58,0xbc,0xd2,0x8e,0x3a,0xf5,0xa8,0x14,0xe0,0xbc,0x4f,0xf5,0xec,0xca,0x31,0x13,0xdc,0x3f,0x82,0xfd,0xb7,0x64,0xfe,0x0f,0xf9,0xa2,0x4f,0x30,0x83,0xf9,0x5c,0x33,0xdf,0x9b,0x19,0x59,0xf8,0xb2,0x6b,0x02,0xa9,0x90,0x65,0xf0,0xaf,0x0e,0x5f,0x09,0xd9,0x7e,0x2f,0x95,0x5a,0xa5,0x52,0x0e,0xbe,0x6c,0xbf,0x64,0x3f,0xd7,0x52,0xe4,0x99,0x05,0x99,0xdb,0x10,0xce,0xfb,0xd3,0xa7,0xe8,0x14,0x60,0xac,0x74,0xf2,0xf1,0x03,0xb8,0xe9,0x5c,0x37,0xf6,0x3b,0x4f,0xc9,0x60,0x2d,0xa5,0xbb,0xfd,0xb2,0x93,0xdf,0xf5,0x03,0xf8,0x28,0xb1,0x19,0xfb,0x5d,0x89,0xaa,0x60,0xd4,0xa4,0xdf,0x5d,0x53,0x7b,0x9d,0x6a,0xf4,0xa9,0x33,0x55,0xc2,0x20,0xae,0x03,0x75,0x61,0x0f,0xd4,0xb0,0x2d,0xd1,0x02,0xdb,0xa5,0x4e,0x6c,0xb5,0x42,0xb3,0x3c,0x75,0x06,0xbf,0xa3,0xf6,0xa5,0xb3,0x66,0x93,0xd4,0x95,0x25,0x3a,0xd4,0x58,0x6a,0xac,0xc7,0x58,0x67,0xdd,0xbe,0x54,0xc4,0xf1,0x98,0x5e,0xb3,0x63,0x5a,0x6a,0xdf,0xdf,0x09,0x00,0xef,0x90,0x22,0x86,0x12,0x08,0xee,0xaf,0x6a,0x76,0x79,0x21,0xb5,0xe1,0x7a,0x2e,0x50,0x7d,0xa1,0x8e,0x7e,0xbf,0x4e,0x4e,0x46,0x99,0xd9,0xe4,0x4a,0x26,0x27,0x38,0x3b,0x6b,0x4b,0xed,0x75,0x7b,0x5d,0x5f,0xd7,0xaf,0x75,0x7a,0x4b,0xd5,0xb5,0xde,0x98,0x5d,0xd5,0x8b,0xe0,0x0d,0x5d,0xa8,0xf5,0x86,0x7a,0xb1,0x78,0x56,0x5b,0x94,0xa4,0x17,0x06,0xe7,0xbc,0x50,0xbf,0xb4,0x85,0x1a,0xc6,0x16,0x9a,0xa7,0x7a,0xab,0xba,0x6f,0xcc,0x7a,0x6b,0x1b,0x4f,0x66,0xec,0xe0,0xb8,0x98,0xf2,0x04,0xc5,0xdf,0x9f,0x80,0x64,0xf4,0x0d,0xd5,0x83,0xf2,0x1b,0xb6,0xd3,0x9d,0x75,0x5f,0x69,0x48,0xf5,0x1e,0x35,0xb8,0x95,0x8f,0xe8,0x14,0xf3,0x74,0xfb,0x5a,0x9f,0x56,0x06,0xfd,0x6a,0xfd,0x52,0x76,0xca,0x74,0x6e,0xaf,0xe7,0x78,0xa7,0x38,0x5f,0xb7,0x87,0xf5,0x2e,0x05,0xca,0x5c,0x13,0x00,0xe6,0x51,0x3d,0x49,0x81,0xf4,0x96,0x50,0x5f,0x53,0x3a,0xbd,0xe8,0x9c,0xb0,0x4e,0xa9,0xd8,0x6f,0x2b,0x3b,0xb2,0x5a,0xa6,0x84,0x7a,0x99,0x9a,0x77,0x4a,0x23,0x6e,0xd1,0x2a,0x15,0x5a,0x9d,0x55,0x76,0xdf,0x19,0x1b,0xad,0xce,0xa0,0xbe,0xa8,0x0e,0xea,0xfa,0x68,0xa4,0x4a,0xf5,0xf5,0xae,0xd3,0xa2,0x2a,0xd3,0x56,0x19,0xcb,0xd6,0x45,0x12,0x1b,0x48,0x42,0x71,0x32,0x12,0xda,0xf5,0x13,0xd6,0x2e,0x35,0xb2,0x3c,0x7d,0x9a,0x57,0xe9,0xd3,0x69,0x0d,0x70,0xb4,0x3a,0xa3,0x49,0x6b,0x78,0x1d,0xe3,0xc3,0xf3,0x66,0x58,0x1e,0x6c,0xc4,0xee,0x86,0xd4,0x5b,0x65,0x32,0x5b,0x1f,0x96,0xb3,0x23,0xe9,0xa4,0x8f,0xd6,0xaa,0xe8,0xc8,0x19,0xef,0x17,0x87,0x40,0x47,0x4b,0xa6,0xa6,0x96,0x80,0x62,0x17,0x81,0xbc,0x24,0x20,0xd7,0x11,0x2c,0x0b,0x4b,0xb4,0x45,0x76,0x5a,0xa1,0x80,0x7c,0x07,0xe3,0x71,0x45,0x74,0xc9,0x16,0xa4,0x03,0xb8,0x6d,0xa7,0x64,0xc2,0xf0,0x30,0xdd,0xd4,0x83,0x61,0x7b,0x50,0x97,0xe6,0x05,0x6a,0xd4,0x27,0x60,0xdd,0xd4,0xfa,0x65,0x28,0x6f,0x3a,0x7b,0x15,0xe5,0xc6,0x45,0xd8,0x37,0x25,0x9b,0x67,0x5a,0xe7,0x6a,0x03,0x7d,0x39,0x00,0x38,0x06,0xa2,0xce,0xd6,0x06,0x18,0x5b,0xa2,0x4e,0x1d,0x90,0xa6,0x34,0x81,0x45,0x6d,0x56,0xc7,0xe9,0xb2,0xb8,0x59,0x94,0xc5,0x32,0xa8,0x83,0xea,0xb0,0x29,0xb1,0xea,0x62,0x24,0xa4,0x17,0x43,0xa1,0x5d,0xa2,0xb0,0x75,0x69,0x60,0x54,0x1b,0x12,0x57,0xad,0x9e,0x3d,0x78,0x3a,0x26,0xee,0xa2,0x28,0x77,0x00,0xbd,0x66,0x91,0xdd,0x53,0xe3,0xf6,0xa2,0x6c,0x8c,0x87,0xd5,0xc1,0x66,0x88,0x83,0xfa,0x34,0xf5,0xbe,0x5d,0x4a,0xe1,0xfd,0x0e,0x45,0x61,0x1b,0xaa,0x79,0xa2,0x19,0x28,0x73,0x20,0x2f,0x28,0xdf,0x1a,0x2d,0xf6,0x67,0x35,0xa1,0x3c,0xa9,0x50,0xf3,0x5a,0x49,0x28,0xd7,0x3a,0xd7,0x39,0xd6,0xb8,0xcc,0xa5,0xd2,0xa9,0x0c,0xdf,0x5f,0x81,0x6c,0xa1,0x2e,0x1c,0xa9,0x11,0x49,0x77,0xae,0xe0,0xb7,0x6f,0xd6,0x13,0xa8,0x0f,0xd6,0xc9,0x0b,0x61,0x52,0xd4,0x90,0xdd,0xd6,0x05,0xd8,0x26,0xf2,0x34,0xc4,0x53,0x82,0x38,0xe9,0xb9,0x1b,0x87,0xd2,0x12,0xca,0x38,0x85,0x51,0xfb,0x96,0x00,0xca,0x43,0x61,0x9d,0xba,0x88,0x6d,0xea,0x43,0xba,0xd6,0xbc,0x8e,0xad,0x32,
-0x36,0x92,0x2b,0x5a,0xc8,0x37,0x8a,0x34,0x55,0x05,0x75,0x93,0xe9,0x4d,0x37,0x7a,0x6b,0x5d,0x2a,0xe0,0xc3,0xbe,0x58,0x2f,0x0b,0x7a,0xe7,0x74,0x6a,0xd3,0x22,0x55,0x2f,0xf6,0xf3,0x55,0x25,0x93,0xb7,0xea,0xb5,0x24,0x14,0x98,0xe2,0xe9,0xd0,0x2e,0xaa,0x07,0x27,0xad,0xd4,0xc7,0xa4,0x5a,0xbf,0x3a,0xed,0x11,0xf5,0x03,0xf8,0xde,0x6e,0x50,0xa7,0x75,0x5f,0x22,0x8f,0x93,0x61,0x59,0xa8,0xf7,0xdb,0x38,0xd4,0xc3,0x52,0x9f,0xe0,0x15,0x61,0x5e,0x03,0x7a,0x04,0xd3,0x33,0xd4,0x05,0xe8,0x8c,0x32,0x00,0xba,0x5f,0x98,0x02,0xbd,0x11,0xa9,0xf5,0x1c,0xd4,0xed,0xa9,0x46,0x03,0x18,0xa0,0xb3,0x16,0x7f,0x25,0xa1,0xd4,0x92,0x4e,0x07,0x6e,0x4c,0x25,0xe7,0x12,0x69,0xa6,0x41,0x5c,0x75,0xac,0x6e,0xb8,0xec,0x0d,0x0d,0x4d,0xea,0x2e,0x43,0x6a,0xb3,0x53,0x3e,0x5f,0xe8,0x53,0x2d,0xc7,0x40,0xe1,0xcc,0x68,0xd2,0x36,0xed,0x76,0x69,0xb2,0xeb,0x8c,0x81,0x89,0x86,0x72,0x01,0xf6,0x00,0xdb,0xd8,0x46,0xa8,0xee,0xb6,0x6f,0x14,0x95,0x2f,0xa5,0x4e,0x6e,0x83,0x9b,0x45,0xd8,0x41,0xcb,0xe8,0xf9,0x4d,0x78,0xd1,0x66,0x04,0xf8,0x93,0x3e,0x44,0x5b,0x86,0x34,0x69,0xca,0x71,0x1b,0x00,0x40,0xa0,0xc6,0x14,0x4d,0x52,0x3c,0x55,0xea,0x53,0xc3,0x13,0x6d,0xdc,0xf9,0xaf,0x53,0x15,0xfd,0x0e,0x28,0x50,0x61,0x3f,0x5d,0xaa,0x49,0xde,0xf9,0xe9,0x53,0xb5,0x1b,0xdf,0x56,0xbe,0x1a,0x55,0x75,0x3d,0x9f,0xc0,0x73,0x69,0x7e,0x7b,0xa6,0xa1,0x6b,0xa8,0x8d,0xef,0xcf,0xa0,0x9e,0x28,0xda,0xf5,0x0c,0xf3,0x97,0xf5,0xdb,0x33,0xe0,0x97,0xa1,0xea,0x2a,0xc4,0x43,0xd3,0xd4,0xc6,0x76,0x25,0xec,0xfd,0x59,0x00,0xcf,0x55,0xd7,0xf3,0x09,0x3c,0x43,0xbb,0x6d,0x3f,0xd3,0x90,0xdf,0xda,0xe9,0xfe,0xdc,0xa7,0xa6,0x96,0xdf,0xb4,0x9f,0x61,0xfe,0x4a,0xfd,0xf6,0x0c,0xe8,0x61,0x54,0x73,0x20,0x32,0xd3,0xf3,0x6e,0x41,0x88,0x18,0x05,0xac,0x16,0xd3,0xa7,0x75,0xaa,0xba,0xa1,0x16,0x27,0x5a,0xa5,0x6a,0x83,0xe9,0x62,0xd6,0xb8,0x32,0xd3,0xc2,0xa1,0x5e,0x2a,0x1f,0xda,0x14,0x3d,0xa5,0xaa,0x63,0x8a,0x15,0xe8,0x2b,0x84,0x59,0x9e,0xe8,0x03,0xc4,0xdf,0xee,0x53,0x07,0xaa,0x44,0x47,0xe1,0x89,0x4a,0x1b,0x2e,0xa6,0x1c,0xbe,0xac,0x56,0x2e,0x90,0xb7,0x45,0x9f,0x56,0x60,0x9d,0x2d,0x41,0x18,0x40,0xd5,0x1a,0x51,0xf9,0xaa,0x4b,0x22,0x83,0xd5,0xab,0x9c,0xbc,0xdc,0x4e,0x2e,0xf3,0xd9,0x40,0x5e,0x14,0x69,0x89,0x1f,0xd2,0x8d,0x39,0x51,0xe8,0x2c,0x89,0xc2,0xa1,0x25,0xd0,0x55,0xaa,0x9a,0xa7,0x96,0x02,0x8d,0x41,0x3e,0x41,0x3e,0x19,0x86,0x24,0x80,0xc6,0x05,0xe2,0xe3,0x28,0xf8,0xdc,0x07,0xca,0x40,0x4b,0x54,0x6d,0x03,0xff,0x36,0xa8,0x6a,0x1b,0x96,0xab,0x63,0xe6,0x33,0xcb,0x67,0x45,0x3f,0xa1,0x1a,0xe2,0xfb,0xf9,0x9e,0x80,0x47,0x07,0x32,0xc6,0x1f,0xdf,0x0c,0xed,0xc0,0x1b,0x97,0x1d,0xff,0xed,0xfb,0x9b,0x37,0x9a,0x3b,0xa9,0xab,0x5b,0x38,0xc7,0x61,0x85,0x2a,0x88,0xa4,0x6c,0xed,0xe7,0x81,0x6e,0xea,0x96,0x6a,0x5c,0x85,0x90,0x66,0xe0,0xfc,0xd0,0xbd,0xf1,0x25,0x6f,0xba,0x36,0xb3,0x1d,0x54,0x2d,0x85,0x2a,0x9d,0xeb,0x95,0x33,0x61,0x86,0x7f,0xe0,0xa7,0xa2,0xc2,0xff,0x27,0xe6,0xd7,0xbe,0x19,0x0e,0x2e,0x88,0xca,0x15,0x06,0x5a,0xa0,0x6c,0xf0,0x7f,0xb3,0x2d,0x5a,0xed,0x88,0x56,0x96,0x35,0x79,0x0b,0xbf,0x9d,0xe1,0x33,0x01,0xdb,0x44,0x47,0x6d,0x9f,0xce,0xa9,0x8b,0x15,0x0e,0x82,0xe7,0xb1,0xc9,0x5c,0x07,0x26,0x95,0xe6,0x66,0x78,0x68,0x86,0x8a,0x30,0x9c,0x33,0xd3,0x29,0xb3,0x8d,0x37,0x28,0x4e,0xa6,0xf2,0xb2,0xba,0x9c,0x0d,0xcc,0xf0,0x4f,0xba,0x11,0xa1,0x84,0x8a,0x40,0x15,0xd9,0xad,0x19,0x1e,0x82,0xc7,0xa9,0xc9,0x5f,0x19,0xe2,0xa3,0xeb,0x66,0xb8,0xb8,0x9c,0x56,0x48,0xc8,0x1f,0x6d,0xf1,0x27,0xd8,0x4c,0xb6,0xa9,0x0a,0x7e,0x98,0x4f,0x71,0x19,0xe2,0x4b,0xc3,0x97,0xf3,0x39,0x2c,0x74,0x95,0x1b,0xce,0x64,0x3c,0x6d,0x87,0x8b,0x14,0xe7,0xd8,0x18,0x3b,0x5c,0x84,0x5f,0xda,0xa5,0xad,0x00,0x64,0x0c,0x2c,0x01,0x45,0x35,0x17,0x94,0x0e,0x5f,0x16,0x7b,0xb7,0xf0,0x91,0xd7,0xa9,0xf6,0xa9,0xdc,0x40,0x56,0xf1,0x00,0x5d,0xf3,0x90,0x52,0x16,0x58,0xd7,0x53,0x2f,0x05,0xad,0xc9,0x3d,0x3a,0xf3,0xc9,0xeb,0x66,0xe8,0x2c,0x3e,0xe0,0x7f,0xac,0x69,0x7e,0x9c,0xf0,0xd1,0xce,0x58,0x33,0xb1,0x98,0x45,0x6d,0x9a,0x45,0x16,0x20,0xf7,0x65,0xaa,0xde,0xdd,0x80,0x18,0x31,0x9d,0x4a,0xd9,0x66,0x0a,0x3c,0x53,0xf6,0x33,0x9d,0x4a,0xb6,0x67,0xf4,0x3d,0xec,0x74,0xfd,0x80,0x67,0x33,0xac,0xcc,0x47,0x85,0x7f,0xaf,0x85,0x93,0x27,0x9a,0xa3,0x2a,0xe3,0x92,0x7a,0x6a,0x6a,0x20,0xa4,0x80,0xcd,0xbe,0x00,0x71,0xb5,0x84,0x36,0x74,0x7b,0xeb,0x3a,0x74,0x15,0x42,0xdb,0x76,0x99,0xed,0x9b,0x5b,0xec,0x09,0x66,0xa8,0x55,0x01,0x21,0x04,0xde,0x29,0xcd,0xaf,0x6d,0x71,0x0e,0x5d,0x71,0x1a,0xfc,0xae,0x5d,0xef,0x00,0xde,0xb2,0xd0,0xd9,0xa8,0x5a,0x6b,0x9b,0xcf,0x76,0xb7,0xf9,0x43,0x13,0x53,0x09,0x60,0xd5,0xeb,0x45,0x0a,0xfd,0x3e,0x25,0x8f,0x61,0xb8,0x98,0xec,0xc9,0xdc,0xac,0x72,0xb5,0x42,0x3d,0x10,0x0e,0x5e,0xa8,0x85,0x50,0x6c,0x5e,0xf1,0x5a,0xed,0x42,0xad,0x41,0xf0,0xb7,0x1a,0x5c,0x31,0x8d,0x12,0x74,0xe0,0x41,0x51,0xa1,0xe4,0x5e,0xb2,0xc3,0x4e,0x80,0x87,0x9f,0x38,0x38,0xda,0x50,0x1c,0x7d,0x50,0xfc,0xa6,0x0e,0x24,0xd3,0x6a,0x98,0x61,0x14,0x55,0x5e,0x87,0x87,0x0e,0x76,0x28,0x2c,0xb5,0xc5,0x5b,0x99,0x46,0x75,0xa2,0x33,0xea,0x6f,0xeb,0xd7,0xb2,0x54,0x12,0xea,0x20,0x54,0x20,0x8b,0xed,0x4b,0xf9,0xd2,0x13,0xea,0x20,0x94,0x24,0x8b,0xf5,0x53,0x8b,0x9a,0x8e,0xd8,0x4e,0xa9,0x7f,0xda,0x98,0xe1,0x1e,0x74,0xed,0x30,0x2c,0xe8,0x63,0xe9,0xe9,0xf0,0x94,0x1a,0x5e,
-0x67,0xc9,0xfd,0xda,0x0c,0xfb,0xcc,0x50,0xc7,0x0c,0x13,0xa5,0x7a,0x76,0x04,0x5c,0xd9,0x44,0x3a,0x77,0xba,0x52,0x9d,0xef,0x94,0xe7,0x2a,0x25,0x8f,0xc9,0x52,0xb1,0xdd,0x29,0x51,0x17,0xe0,0xee,0xd9,0x2a,0x08,0xd9,0x60,0xd8,0x90,0x36,0xc3,0x45,0x4c,0xc7,0x3b,0x63,0xdd,0x0c,0xb9,0xea,0xa3,0x5d,0xb7,0x55,0x3c,0x77,0xbb,0x52,0xf9,0x1e,0x3e,0xf6,0x6d,0x39,0x77,0xc6,0xd4,0x46,0x68,0x9b,0xba,0x09,0xfe,0x87,0xdd,0x14,0x19,0x94,0xc3,0x0c,0x67,0x40,0x59,0x40,0x19,0xeb,0xb3,0x8a,0xd8,0x0f,0x84,0x3c,0x3d,0x98,0x0e,0xc3,0xac,0x75,0xdf,0x84,0x71,0x85,0x59,0xeb,0xf2,0xb0,0xbe,0xed,0xf5,0xcb,0x76,0x37,0x01,0xa3,0xa1,0xbc,0x41,0x7b,0x23,0x17,0x43,0x56,0x05,0xe1,0xa0,0x6a,0xf1,0x7c,0x5a,0x82,0x30,0x71,0x59,0xc5,0x00,0x8e,0xcd,0x7c,0x59,0xa3,0x31,0xae,0x46,0x9d,0xda,0xa5,0x61,0xbb,0xd3,0xb8,0xa8,0xfb,0xc6,0x05,0x84,0x7d,0x67,0x33,0x64,0x1e,0x80,0x3a,0x18,0x6c,0xac,0x30,0x92,0xec,0x10,0x63,0xd5,0x0e,0x2d,0x41,0x98,0x38,0x57,0x40,0x98,0xe8,0xc1,0x03,0xf3,0x83,0x74,0x10,0x5e,0xb2,0x80,0x9e,0xa0,0x34,0x85,0x4a,0xa9,0x3a,0x68,0x4d,0xcc,0xf0,0x13,0x86,0x8e,0xb0,0xdc,0x42,0x89,0x4a,0x15,0xc6,0x20,0x36,0xe8,0x34,0xa8,0xa2,0x4e,0x4d,0xa1,0xcc,0x81,0xbc,0xa0,0x7c,0x41,0xc8,0x34,0xae,0x9c,0x49,0x1a,0x76,0x03,0xe8,0x13,0x49,0xd3,0xb0,0xdb,0x53,0x84,0xe1,0x5f,0x9e,0x86,0xef,0x41,0x18,0x4c,0x40,0x5d,0x68,0x9d,0xca,0x30,0x4c,0x84,0xa1,0x73,0x05,0xd6,0x13,0xa8,0x8f,0xb4,0x93,0x17,0xc2,0xf4,0x4e,0x65,0x27,0x04,0x5d,0x51,0x7d,0x80,0xe7,0x64,0xe2,0x9c,0xba,0x71,0x34,0x2e,0x30,0xe4,0xec,0x50,0x4d,0x89,0x84,0xe1,0x58,0xa7,0x34,0xac,0x73,0x8d,0x62,0x59,0x18,0x5c,0x74,0xdc,0x2a,0xe3,0x65,0xa5,0x9c,0xe6,0xbd,0x62,0x5f,0xe8,0xd3,0xc2,0xa9,0xdd,0x1d,0xe1,0xbb,0x56,0x91,0x3c,0xa5,0xb8,0x31,0x0c,0x2d,0xeb,0xad,0x12,0x0b,0x42,0xb7,0x39,0xd0,0xd6,0x4d,0x8f,0xde,0x25,0x57,0x76,0xbd,0x92,0xbd,0xa9,0x00,0x42,0x4b,0x18,0x8a,0xda,0x69,0x82,0x19,0x8e,0xd2,0xf2,0xba,0x20,0x81,0xf0,0xb4,0x63,0x87,0x75,0x87,0x16,0x3e,0x16,0xeb,0xc5,0x72,0xa9,0x03,0xf5,0x10,0x84,0xac,0xb0,0xfb,0x42,0x83,0xae,0x1f,0x4c,0xef,0xf6,0xdb,0x87,0x56,0x31,0x83,0xf5,0xa9,0xf2,0x71,0x02,0xf4,0xa6,0xde,0xaf,0x13,0xa0,0x6e,0xdb,0x66,0xd7,0x24,0x93,0xe5,0x2d,0xfe,0x4e,0xa4,0x15,0x5a,0x4e,0xa8,0xde,0xb6,0x7e,0xb0,0xbb,0x2d,0x9b,0x52,0xb1,0x53,0x6c,0xb9,0xed,0x0d,0xf8,0x3e,0x68,0xf2,0x7c,0x13,0xcf,0xf7,0x7a,0xbd,0x31,0x55,0x3c,0xd9,0x06,0xaa,0x33,0xdd,0xe0,0x23,0xd3,0x3e,0xde,0xc2,0x47,0x28,0x17,0xf5,0xd4,0x69,0xd8,0x46,0xa8,0xe8,0xb1,0x6f,0x94,0xd5,0x5d,0xbf,0x1b,0x38,0x10,0x5e,0x06,0xec,0xa0,0x65,0xf4,0xfc,0xfd,0x78,0xcb,0xa3,0x80,0x7c,0x15,0xac,0x0c,0xd1,0xc2,0x74,0x1c,0x86,0x8f,0x6d,0x07,0x40,0xa5,0x2a,0xc0,0x2b,0x50,0x35,0x18,0x1b,0x81,0xd8,0x6c,0xd9,0xbf,0xf1,0x0f,0xa0,0x97,0x77,0xc0,0xba,0x1f,0xf3,0xed,0xa7,0x24,0x14,0x0f,0x77,0x7e,0xca,0xa6,0xa9,0xbf,0x3f,0x83,0x20,0xe3,0x04,0x02,0xb1,0xdb,0x73,0x1b,0xa6,0x13,0xf7,0xe7,0x3e,0x4c,0xc7,0xef,0xcf,0xb0,0x9e,0xa0,0x0b,0x77,0x9e,0xe7,0x30,0xbd,0x75,0x7f,0x56,0xa9,0x2a,0x30,0x77,0xd6,0xf0,0x41,0xbf,0x61,0xbb,0x92,0xda,0xfd,0xb9,0x0e,0x9e,0x41,0x48,0x75,0x7b,0x6e,0xc3,0xf4,0xc2,0xfd,0xb9,0x0f,0xd3,0xf3,0xf7,0xe7,0x31,0x05,0x7c,0xb4,0x70,0x7f,0x9e,0xc3,0xf4,0xe1,0xfd,0x59,0xa5,0x3a,0x54,0x71,0x33,0x9f,0xca,0x3a,0x33,0xe5,0x54,0x0e,0x86,0x69,0x30,0x14,0xa4,0xe8,0x1d,0x0c,0x4d,0x19,0x8a,0xc6,0x26,0x20,0x1c,0x63,0x09,0xf9,0xb8,0x94,0xa8,0x33,0xd0,0x3f,0x6a,0x22,0x80,0x30,0xab,0x56,0xa7,0xd8,0x13,0x84,0x81,0xe1,0x18,0xc0,0x5f,0x2a,0x53,0x2d,0x81,0x3a,0x45,0xe1,0x89,0x4a,0x1b,0x6f,0x27,0x0a,0x37,0x3d,0x8b,0x2c,0xe4,0x0d,0x84,0xa4,0x0b,0x58,0x67,0xd5,0x13,0x68,0x05,0xf4,0x25,0x2a,0xdf,0x60,0x5b,0x38,0x70,0x45,0x5a,0x59,0x4c,0x33,0x32,0xbb,0xad,0x60,0x8b,0x69,0x5f,0x98,0x2b,0x1b,0x61,0x38,0xed,0x1c,0x47,0xd3,0x02,0xe0,0x99,0xa4,0x06,0x02,0x7d,0x84,0x61,0x22,0x07,0xb5,0x05,0xe4,0x03,0xe1,0xe2,0xc1,0x0e,0x7b,0x41,0x48,0xda,0x87,0xcf,0x1b,0xa8,0x91,0x73,0x81,0xce,0xc0,0xbf,0xc3,0x3e,0xbd,0x86,0xe5,0x1a,0xf5,0x61,0x3e,0xb3,0x7c,0x07,0x53,0x34,0x4e,0xf7,0xe2,0xe1,0xcf,0x9f,0x7f,0xde,0xc3,0x46,0x18,0x1d,0x7e,0xfb,0xfe,0x69,0x0e,0x0c,0x9e,0xac,0x61,0x51,0x12,0xc3,0xac,0x67,0xdd,0xb8,0xc8,0xfc,0x87,0x02,0x21,0xe5,0x9f,0x12,0x6a,0xf0,0xf0,0x4d,0x67,0x14,0xfd,0x5d,0xe7,0x35,0x69,0xf5,0x6f,0xd2,0x76,0xa7,0x6a,0x06,0xa3,0x18,0x9f,0xfa,0x8e,0x67,0x36,0xef,0x8c,0x6e,0x67,0x0d,0x22,0x43,0x93,0x3b,0x32,0x9a,0x04,0xb2,0x3b,0x30,0x06,0x7f,0x36,0xde,0xef,0xa7,0x63,0x9b,0x07,0xee,0xc3,0xf9,0x8f,0xdb,0xe8,0xed,0xe7,0x91,0xd7,0x0c,0x89,0x65,0xe4,0x77,0x73,0x64,0xfa,0x03,0x20,0x5c,0x6e,0x24,0xe3,0x1d,0xc6,0xba,0x26,0xe0,0x56,0xe2,0x38,0x99,0xff,0x74,0xde,0x5b,0x6c,0x6c,0x55,0xd5,0x10,0xe1,0x38,0x29,0x20,0x25,0x81,0x8c,0x00,0x98,0xfb,0x7c,0xdf,0xaa,0xd7,0x77,0x55,0x3f,0xfb,0x61,0x04,0x8d,0xb9,0xe8,0x80,0x02,0xff,0xc9,0x1e,0x34,0x5d,0xd5,0x3e,0x76,0xaa,0x64,0x1d,0x17,0x2d,0xb1,0xaa,0xf2,0xce,0x5f,0xec,0x21,0x55,0x5d,0xba,0xf2,0xf6,0x71,0xd0,0x9f,0x36,0x7b,0x84,0x73,0x98,0xbe,0x03,0xf9,0xb1,0xe4,0x41,0x41,0xe0,0xb4,0xb6,0x75,0xd2,0xf2,0xb7,0xff,0x93,0x2f,0x60,0xd8,0x37,0x67,0x72,0x8a,0x5b,0xc2,0x4f,0xcc,0x32,0xd9,0x58,0xad,0xdb,0x72,0x64,0x55,0xdd,0x21,0x91,0xe3,0xdf,0x6c,0xb8,0x9d,
-0x7a,0xe2,0x35,0x24,0x08,0xf1,0xcd,0x83,0x4a,0xbf,0x28,0x2c,0x12,0x2e,0x7d,0xe3,0x33,0xc7,0xc0,0xcf,0x6d,0x38,0xda,0x19,0x75,0x26,0xee,0xa3,0xce,0xee,0x23,0xfe,0xe1,0x60,0xf4,0xcf,0x7f,0x37,0x27,0xb3,0xae,0xef,0x92,0xc2,0xf1,0xe7,0xfb,0x15,0x00,0xf6,0x6c,0x05,0x61,0x82,0xec,0x18,0x81,0xff,0xbf,0x74,0x83,0xd1,0x8c,0xc4,0xee,0xeb,0x01,0xc0,0x0f,0xf3,0x1e,0xf9,0x84,0xa1,0x05,0x26,0x97,0xe0,0xd1,0xd4,0x48,0x50,0xf1,0xcb,0x54,0x27,0xab,0x52,0xcd,0xd3,0xbb,0xed,0x69,0x42,0xeb,0x0c,0x6a,0x54,0x16,0xee,0xcb,0x27,0x0b,0x5b,0x9d,0x82,0xf9,0x98,0xa5,0x7a,0x30,0x12,0x9c,0x74,0xfc,0x58,0x49,0x5a,0xc8,0xe5,0x05,0xf8,0xbd,0x10,0x16,0x78,0xac,0x42,0x78,0x41,0x63,0x15,0xc2,0x9b,0x25,0x4e,0x21,0xcc,0x75,0x0e,0xce,0xb4,0x89,0xa9,0xb2,0xb7,0x19,0x7d,0x69,0x2b,0x98,0x17,0x15,0xd8,0xa9,0x69,0x47,0xa7,0xf5,0x93,0x64,0xb0,0xe2,0xd7,0xbb,0x93,0x40,0x10,0xbb,0xf3,0x27,0xb3,0x03,0xed,0x1e,0xb4,0x57,0x96,0xb7,0x1a,0xeb,0xed,0xcc,0x7b,0x8d,0x97,0x19,0x38,0x79,0xf7,0x09,0x38,0x83,0x4a,0xfc,0x81,0x39,0x73,0xb4,0x70,0x1e,0xf3,0xa0,0x7f,0x00,0xf6,0xd8,0x3f,0x7e,0xe4,0x13,0x7f,0x4f,0x00,0x1b,0xf0,0x87,0x83,0xf5,0xfb,0x77,0xfb,0x0a,0x04,0x33,0x19,0xff,0x91,0x25,0x32,0x41,0x08,0x9b,0x01,0xcf,0x5b,0xc4,0x69,0xe8,0x76,0xeb,0xb2,0x8b,0x0d,0xd7,0x71,0xe8,0xaa,0x2c,0x71,0x09,0x27,0xc1,0xdb,0xbc,0xad,0xd3,0xcd,0xa5,0x2b,0x54,0xec,0xdb,0x89,0xe5,0xe7,0xdb,0x6c,0x97,0xa4,0x98,0x4d,0x71,0x29,0xab,0xec,0xe6,0x66,0x5d,0x0c,0x66,0xf7,0x2e,0x02,0xf2,0xa6,0x5d,0xb4,0xc9,0xba,0x4e,0xea,0x77,0xea,0x2c,0x21,0x29,0xbb,0xc3,0xfd,0xdc,0x7e,0x0c,0x8d,0xd4,0x75,0x73,0x80,0xfb,0x52,0x81,0xe0,0x2d,0x02,0x4e,0xa3,0xc2,0x03,0x06,0xca,0x22,0xf7,0xc1,0xac,0x0c,0x38,0xe1,0x66,0x3f,0xf9,0x9b,0x76,0xe2,0x5b,0xc8,0xcd,0x04,0xb7,0x2b,0x12,0x6c,0xf2,0xa6,0x08,0x3c,0x95,0x9c,0x78,0x4f,0xc0,0xdb,0xbb,0x50,0x92,0x44,0x02,0xa6,0x12,0xc4,0x77,0xeb,0xb2,0x03,0x8b,0x1c,0x91,0x4e,0x6f,0xf5,0x9f,0x3e,0xc6,0x1e,0xc9,0xfb,0x46,0x34,0x44,0xc0,0xde,0x62,0xbb,0xd1,0xc5,0x44,0x63,0xad,0x1f,0x70,0x2d,0xf9,0x01,0x70,0x89,0x34,0xf8,0xb5,0xe6,0xab,0x73,0x6f,0xd6,0x3f,0x73,0xbe,0xda,0x22,0xf5,0x83,0x15,0x79,0x76,0xc3,0x73,0x5f,0xde,0x65,0x07,0x24,0x03,0x3f,0x08,0x0a,0x56,0x82,0x3f,0xb7,0x53,0x01,0x77,0x7f,0x67,0xba,0x9d,0x3f,0xb0,0x00,0x1d,0xbb,0x68,0x88,0x6b,0x23,0x66,0x7f,0x58,0xed,0x08,0xd5,0x4e,0xee,0x68,0xa4,0xfb,0xe6,0x6b,0x34,0xe7,0xf6,0x79,0x19,0xa1,0x27,0x36,0x98,0x0a,0xfc,0x1f,0x70,0xa8,0xe9,0x4f,0x0d,0x4e,0xb4,0xff,0xeb,0x87,0x0e,0x5a,0x12,0x60,0xe9,0x66,0x0d,0xf2,0xc0,0x18,0xb8,0x0c,0x8c,0x4f,0x45,0x88,0x02,0x46,0xe6,0xb3,0x00,0x04,0xd9,0x74,0x6f,0x77,0xb0,0x7c,0xde,0xae,0x65,0xf1,0xb5,0x4d,0x97,0x11,0xb9,0x9b,0x4c,0xa7,0x1d,0xc7,0x6d,0x8d,0x61,0x85,0xf8,0x58,0xa9,0xec,0x41,0xff,0xba,0xd1,0x08,0x07,0xfc,0x30,0x63,0x06,0x13,0xfc,0x1d,0x80,0x43,0x0b,0xee,0xb2,0xa9,0x61,0xd9,0xde,0x22,0xf0,0xd9,0xac,0x5b,0xcf,0xef,0xda,0x41,0x51,0xa0,0x0d,0x87,0x21,0x10,0xbb,0x89,0x9f,0xcf,0x10,0x0f,0xdb,0xe5,0x97,0xdf,0x16,0x3b,0x40,0xbe,0xf7,0x51,0xc5,0x43,0xa1,0xf5,0x4a,0x32,0x73,0x37,0x4f,0x88,0x36,0xf6,0xf7,0x04,0xf1,0x23,0x9d,0xf6,0xd8,0x70,0x34,0x40,0xd4,0x2a,0x1e,0x44,0x3e,0x68,0x48,0x1c,0xeb,0xed,0xb4,0xb2,0x58,0x2d,0x16,0x75,0xd5,0xca,0x02,0xb4,0x30,0xb7,0x55,0xfa,0x81,0xe3,0xd9,0x8c,0x9e,0xe0,0x41,0xb8,0x05,0x2c,0x2b,0x14,0x2c,0xda,0x17,0x3c,0x59,0x71,0xb6,0x8f,0xf7,0xb7,0x6e,0xfc,0x07,0x91,0xf9,0xfe,0x2c,0x2a,0x6b,0x21,0xcc,0x97,0xdd,0x2a,0x40,0x84,0xba,0x5c,0x02,0xde,0xe2,0x63,0xf1,0x2a,0x96,0xf7,0x72,0x14,0xc4,0x12,0x0f,0xb4,0x83,0x45,0xb7,0xe8,0x77,0x0b,0xe7,0xbb,0xab,0x61,0xfa,0x57,0x2c,0x19,0x6a,0xc2,0x8c,0x5c,0xde,0x12,0xae,0xe6,0x68,0x1b,0x2b,0x59,0x3d,0x7d,0x7f,0x4b,0xfc,0x1f,0x30,0xc8,0x49,0x98,0x72,0xc7,0xfe,0x76,0x7b,0xb6,0xe9,0x83,0xac,0xdf,0xbd,0x59,0x1d,0xc0,0xef,0x09,0x45,0x7d,0xd7,0x78,0xa0,0xde,0x46,0xc2,0x5a,0x34,0xec,0xb6,0x0f,0x56,0x76,0x3f,0x77,0x4f,0xa8,0xc4,0x23,0x43,0x60,0xbe,0xfb,0x9f,0x56,0x12,0xbf,0x95,0xf8,0x2a,0xed,0xd5,0x16,0xe2,0x47,0xf3,0x7c,0xeb,0xb8,0x63,0xd8,0x69,0xaa,0xa0,0xc1,0x3b,0xc5,0x7c,0x4e,0xc0,0xa9,0xe5,0x87,0xde,0xc0,0x66,0x44,0xf3,0x9e,0xdd,0x6f,0xc6,0xf3,0x4f,0x31,0xf0,0xb0,0x51,0x06,0xe3,0xc3,0x58,0xed,0x33,0x34,0x1a,0x89,0xe2,0x4e,0xff,0x1f,0xad,0x7e,0x42,0xab,0xf5,0x5f,0x54,0x67,0xfd,0x75,0x3d,0x86,0x6b,0x65,0x55,0xd9,0x90,0x76,0xde,0xab,0xbd,0xc2,0xb2,0xb8,0x22,0xc1,0x68,0x6f,0x1f,0x2f,0xfc,0x8b,0x42,0xe7,0x73,0x39,0xbf,0xc7,0x4d,0x98,0x6c,0xb9,0xfd,0x84,0xf5,0xe2,0xaf,0x71,0x14,0x31,0x8b,0x1d,0xe2,0x09,0x5e,0xa9,0x41,0x84,0x55,0x78,0x3a,0x24,0xf7,0x61,0xd4,0x7f,0x03,0x57,0xfa,0xfb,0x4a,0x92,0x65,0x28,0x03,0xf4,0xdd,0x37,0x8f,0x91,0xc1,0x43,0x1b,0x62,0x29,0x9c,0x7d,0x76,0xc7,0xd3,0xb8,0xfe,0x9b,0x6b,0x9b,0x5d,0xe6,0x68,0x55,0x8b,0x5f,0x77,0xb1,0xf4,0xec,0x09,0x74,0x68,0x25,0x7b,0x0a,0x41,0xa4,0x86,0xc5,0xc0,0x64,0x6f,0x65,0x8e,0xa5,0x64,0xf6,0x1e,0xf7,0x57,0xd0,0xfd,0x37,0xd7,0xb3,0x7b,0xb1,0xa3,0x55,0xed,0xa9,0x1a,0x8c,0xa5,0x6d,0xcf,0x61,0x44,0x2b,0xdc,0xb3,0x38,0x22,0x75,0x2e,0x06,0x32,0x6b,0xcf,0x41,0x2c,0x95,0xb3,0xb7,0xa1,0xbc,0x80,0xed,0xbf,0xb9,0xc6,0xdd,0x4a,0x1d,0xad,0x70,0xcf,0xd4,0x5f,0x2c,0x7d,0x7b,0x0a,0x21,0x5a,0xdd,0x9e,0x44,
-0x11,0xa9,0x6d,0x36,0x2e,0x10,0x7f,0xc2,0x91,0xe2,0xfb,0xc6,0x02,0xe2,0x47,0xd6,0x35,0xbb,0x62,0x8e,0xcf,0x5a,0x7b,0x03,0xfe,0x91,0x32,0x27,0xd7,0xfe,0xf9,0x8f,0x14,0xbc,0x78,0xf4,0x9f,0xff,0x80,0x9b,0x28,0x12,0xe6,0xab,0x3f,0xbf,0x5d,0x55,0x38,0xf9,0xf0,0xed,0x9f,0xff,0xb0,0xb7,0x19,0x24,0x58,0x99,0xd1,0xf5,0x3f,0xbf,0xc1,0x9d,0x11,0xe0,0x2d,0x27,0x1d,0xdd,0x6f,0xcc,0x9b,0x4b,0xbd,0xaf,0x6f,0x7b,0x31,0xc0,0x6b,0x85,0xb9,0xbd,0x06,0x5f,0xbd,0x70,0x70,0xce,0x00,0xf2,0x04,0xde,0x32,0xee,0x77,0xd6,0x3c,0x82,0xfe,0xbe,0x04,0x15,0xc2,0x7d,0x4b,0x88,0x1a,0xbf,0xfa,0xf3,0xdb,0xbf,0x03,0x28,0x69,0x2b,0x24,0x74,0x8d,0xfd,0xf3,0x9b,0xb9,0x54,0xcd,0xdc,0xdf,0x94,0x3a,0x28,0x1b,0x45,0x3d,0x29,0xce,0x72,0x35,0x69,0x42,0x77,0x07,0x27,0xac,0x59,0x15,0xcc,0x95,0x5b,0x9d,0xe1,0x58,0x2c,0x8f,0x05,0xea,0xb6,0xe6,0xaa,0x68,0x4e,0x8f,0x97,0x30,0xb2,0x51,0xcb,0xc0,0x37,0x1b,0x9c,0x6e,0x4f,0xca,0x70,0xe9,0x55,0xa9,0x47,0xd5,0x5a,0xce,0x6f,0xdf,0xfb,0xbd,0xd6,0xb3,0x7e,0x3d,0xef,0xe3,0xfc,0x46,0xc1,0x87,0xa5,0xf5,0x5f,0xcc,0x97,0xa1,0x07,0x49,0x73,0x85,0x75,0xbb,0x36,0x18,0x8e,0xe4,0x36,0x45,0xaf,0x5a,0xfb,0x62,0x67,0x45,0x94,0x4e,0xfa,0xa4,0xd1,0xd3,0x96,0xe7,0xfc,0x55,0x6a,0xef,0x49,0x52,0xcc,0x0d,0xb8,0x49,0x23,0x3d,0x9c,0xef,0xea,0x85,0x96,0x54,0x6d,0xaf,0x26,0x62,0xef,0x30,0xee,0x34,0x77,0x19,0x61,0xa9,0x8a,0x99,0x7d,0x73,0xde,0x48,0x9f,0x6a,0x75,0x8e,0xd6,0x0c,0xb8,0x3b,0xa3,0x39,0xdc,0xc8,0xe5,0xfe,0x64,0x40,0x12,0xfa,0x60,0x9e,0x4d,0xef,0xa5,0x36,0x5d,0x9c,0x88,0x4d,0xbd,0x48,0xed,0x9b,0xaa,0x54,0x6c,0x4c,0xc6,0x8c,0x6e,0xe4,0x52,0x05,0x8c,0x39,0x2d,0xe9,0xf2,0x49,0xe3,0x0b,0x87,0xe3,0x21,0x55,0x55,0xc5,0xc6,0xba,0x73,0xbd,0xee,0x2e,0x0b,0xac,0x76,0x2c,0x4d,0xda,0x1d,0x66,0x54,0x59,0x0c,0xb2,0x14,0xb9,0x68,0x9e,0xb4,0xaa,0xb8,0x25,0xe7,0xda,0x70,0xde,0xba,0xe0,0x74,0x2e,0x95,0x6f,0x8e,0xb7,0x4c,0x7e,0x02,0x7a,0x2c,0x99,0x1d,0x29,0x2b,0x85,0x5a,0x6e,0x49,0x1e,0x9a,0x7c,0x89,0xc3,0xd5,0x54,0x5b,0x4f,0xae,0xeb,0x7a,0xad,0xb3,0x2d,0x89,0x83,0x64,0x7e,0x76,0xe5,0xea,0xf3,0x5a,0x4e,0x5b,0x62,0xd7,0x75,0xd2,0xa0,0x47,0xc5,0x73,0x6f,0xdf,0x3e,0x67,0x79,0xa3,0x9b,0x1c,0x64,0x73,0xfd,0x7e,0xaa,0x91,0x2b,0xd4,0x8a,0xd5,0xc3,0xb5,0xdd,0x39,0xf0,0x5b,0x9c,0xcc,0x1e,0x8c,0x4a,0x29,0x9d,0x4d,0x75,0xd2,0x5a,0x3e,0x5d,0x18,0x14,0xf5,0xdd,0x6e,0xdc,0xca,0x69,0xeb,0xf4,0xea,0x72,0x59,0x4c,0x70,0x51,0x65,0xf9,0x7c,0x8a,0x60,0xcf,0x22,0xbd,0xd8,0xa6,0xb2,0x3d,0x4c,0x49,0x16,0xa4,0x49,0xeb,0x58,0x1c,0x14,0x56,0xe4,0xf6,0xb4,0x5c,0x9d,0x2b,0x64,0x73,0x72,0xa5,0xf4,0x0b,0x9f,0x4a,0x1f,0x4a,0x7b,0xbe,0x95,0x4a,0xe7,0xe5,0xa6,0x42,0x28,0x75,0x5a,0xdf,0xe5,0x52,0x57,0xa6,0x9c,0xcb,0xf3,0x1c,0x5d,0x59,0x5c,0x57,0x06,0x9f,0x6f,0x55,0x17,0xb3,0xea,0xf5,0x5a,0x9e,0x89,0x85,0x21,0x81,0xcf,0xb4,0x65,0x7d,0xa3,0xb4,0xc7,0xcb,0x4e,0xb7,0x25,0xc9,0x97,0xf3,0xae,0x7b,0x3d,0x25,0xaf,0x9b,0x5e,0x2d,0xa3,0x76,0x98,0x64,0x6e,0x6d,0x88,0xbd,0xce,0x1a,0xeb,0x36,0xcb,0x06,0xd3,0x98,0xac,0x7a,0xcb,0x7d,0x72,0x38,0x49,0x4e,0x8f,0x49,0x25,0xdd,0x3e,0x5d,0xae,0xc2,0xd2,0x28,0xeb,0x97,0xeb,0x76,0xb5,0x19,0x89,0x78,0x73,0x29,0xef,0x53,0x74,0xad,0xd0,0xec,0x6e,0xb8,0x06,0xb9,0xac,0x5e,0x2e,0xa4,0x5a,0x91,0xab,0x58,0x67,0x47,0x6f,0x7a,0x49,0x51,0xca,0xf7,0xc9,0x71,0x69,0x43,0xb2,0xab,0x6a,0x7e,0x55,0x51,0xa7,0x9d,0x51,0xb5,0x33,0x5c,0x5d,0x8d,0x42,0xe5,0x50,0x21,0xd2,0x85,0x6b,0xa7,0x4c,0x76,0xda,0x83,0x41,0xba,0xb4,0xd6,0x86,0xd5,0x64,0xaa,0xa4,0x27,0x79,0xe5,0xdc,0xb9,0xce,0xca,0x85,0xe4,0x76,0xcb,0xe8,0x5d,0xbd,0xc5,0xd7,0xae,0x1c,0xcf,0x1e,0xba,0x1c,0x23,0xcd,0xf8,0x8c,0x26,0xa5,0xf7,0x29,0x56,0x1f,0x9e,0x0f,0x65,0x6e,0xab,0xd4,0x52,0x6d,0x79,0x7b,0xba,0x6c,0x27,0xb2,0x74,0x6a,0x60,0x27,0x2d,0x9d,0x5d,0x71,0xf4,0x64,0xb2,0x3b,0x8f,0x4f,0xa9,0x15,0x46,0xaa,0x3d,0x0c,0x2b,0xf1,0x9b,0x6c,0x69,0x8d,0xcb,0xbd,0x33,0x8b,0x35,0xda,0xf2,0x2c,0x93,0xc2,0x07,0x23,0x6e,0xb6,0xce,0xd5,0xe7,0xb9,0x3a,0x3b,0x13,0x8f,0xf4,0xac,0xb4,0xeb,0x94,0xd8,0x6d,0x29,0x45,0x29,0xf9,0xe6,0x5c,0xa8,0xd7,0xce,0x4a,0xad,0xac,0x1c,0xb7,0x3b,0xac,0x80,0x4d,0x4b,0x3d,0x7c,0xca,0x6e,0x2b,0x6a,0xae,0x9f,0xad,0x8b,0x7d,0x3e,0xbf,0xa1,0xcf,0xab,0xcd,0x7a,0x96,0xc1,0x67,0xbd,0xfa,0xa6,0x50,0xd0,0x25,0x2e,0x87,0x93,0xfd,0x8c,0x92,0x5b,0x5f,0xa5,0xc6,0x9a,0xdc,0xd3,0x8b,0x7c,0x57,0xd8,0xcd,0x76,0xfd,0xe9,0x62,0x9b,0xbb,0x8e,0x37,0x1c,0x51,0x6c,0x95,0xc7,0xbd,0xba,0xde,0x22,0x8a,0xab,0x34,0xdd,0x19,0xcf,0x17,0xd7,0x5e,0x31,0x57,0xc8,0x36,0x0a,0x72,0xae,0x64,0x94,0x2a,0xc3,0x99,0x48,0xaa,0x58,0x3d,0x95,0x5d,0x96,0x01,0x77,0x43,0x46,0x4c,0x76,0x88,0x05,0xd7,0xba,0xe6,0x94,0xc1,0xb2,0x97,0x9d,0x30,0xfb,0x4a,0x37,0xbb,0xcf,0x93,0xc5,0xd6,0xac,0xa2,0x0b,0xaa,0xc8,0x96,0xb7,0x0a,0xc3,0xe5,0x0f,0x0d,0x95,0xe0,0x96,0x4b,0x85,0xe3,0x5a,0x12,0xb1,0xdb,0x8d,0xf2,0x2a,0x55,0x97,0x37,0xc5,0x6a,0xeb,0xaa,0x35,0x48,0x72,0x3d,0xab,0x89,0xfd,0x54,0xbd,0xa0,0xec,0x4a,0x46,0xe1,0x02,0xba,0xcf,0xf3,0xcb,0xb9,0xc8,0x10,0xbd,0xfe,0x96,0xde,0xcc,0xa4,0x02,0x29,0xa8,0x4c,0x49,0x25,0xfb,0x8a,0x30,0x3e,0x2d,0x99,0x5d,0xf9,0xb2,0xcc,0xe7,0x06,0x0b,0x35,0xb5,0x1f,0x89,0x7b,0xac,0xc9,0x66,0x0e,0x25,0x7a,0xcc,0xaf,0x17,0x7b,0x60,0xb9,0x3b,
-0x8b,0x72,0x95,0x3c,0x70,0xe3,0xcd,0x1c,0x13,0x9b,0xb3,0x66,0xba,0xbb,0xa0,0xb7,0xd3,0xb2,0xb8,0x1d,0x90,0xd5,0x7c,0x6d,0xab,0xf6,0x32,0xd5,0x12,0xb7,0xdd,0x64,0x96,0x4b,0x60,0xae,0xd4,0xe3,0x65,0xb5,0x98,0x36,0x2b,0xa3,0x5a,0x76,0x3b,0xad,0x6d,0x79,0xbe,0xdb,0x91,0x77,0x06,0xd7,0x17,0x6b,0xf5,0xe9,0x44,0x6d,0x4c,0x8b,0xc7,0x73,0xb1,0x9c,0xe7,0x31,0x66,0xd5,0x18,0x52,0xb5,0x52,0x8e,0x1d,0x37,0xcf,0x43,0x6e,0xa2,0xb4,0x84,0xc3,0x65,0x32,0x3c,0xd0,0x13,0x5c,0x93,0xcf,0x95,0xba,0x74,0xc2,0x6b,0x4a,0x95,0xd8,0x24,0xab,0x55,0x9a,0xd7,0xfb,0xcd,0x8d,0x36,0x27,0x8e,0xb5,0x54,0x55,0x29,0x68,0xb3,0x35,0x87,0x6d,0x87,0x9d,0x74,0xf3,0xd0,0x2f,0x5f,0x37,0x0d,0x69,0x7c,0x9c,0xe6,0x26,0xb3,0x93,0x3c,0xc7,0xba,0x82,0x3e,0x19,0xae,0x96,0xa3,0x34,0x95,0xdc,0x0b,0x7c,0x8f,0xd7,0x58,0xec,0xb8,0x4d,0xd6,0x88,0xf4,0xbe,0xb1,0x1b,0x4c,0x09,0x6c,0x4a,0x2f,0xbb,0x46,0x5b,0x49,0x89,0x93,0x74,0xb5,0xb2,0x17,0x7a,0xc9,0x0d,0x7d,0x9a,0x2d,0x45,0x92,0x6d,0xe5,0xbb,0x55,0x21,0x5f,0xe9,0x2c,0x4e,0xcb,0x91,0x36,0xac,0x51,0xe2,0xac,0x21,0x55,0x8b,0xeb,0xb4,0xd8,0x26,0x9a,0xc6,0x8a,0x3f,0x30,0xf5,0xd6,0xae,0xd5,0x9f,0xee,0x08,0xb5,0x5a,0xdd,0xd6,0x2b,0xd9,0x7c,0x4f,0xa3,0x26,0xb3,0xd1,0x26,0xdf,0xc3,0xc9,0xfd,0x51,0xdd,0x76,0x85,0x73,0xef,0xb0,0xc5,0xb3,0x7d,0x8d,0x3e,0x9e,0xab,0x69,0x60,0x6f,0x34,0x65,0xb0,0x3e,0x17,0x8a,0xb3,0x4a,0xb5,0x51,0xae,0xed,0x73,0x7a,0xe1,0x8a,0x95,0x4f,0xf8,0x75,0x57,0x5d,0x52,0x44,0xa5,0x0b,0xec,0xcb,0xe8,0x34,0xc8,0x9c,0xb8,0x65,0x9a,0xcd,0xd0,0xec,0xb8,0x03,0xb4,0x4a,0x19,0x1f,0x3b,0x15,0x9a,0x4e,0x91,0xf3,0x34,0x55,0xad,0x0f,0x7a,0xe9,0xe3,0x59,0xd0,0x38,0xf1,0xa4,0x76,0xc9,0x3d,0x39,0x3b,0xb4,0xb6,0xa9,0x74,0x56,0xc7,0xc4,0xda,0x78,0x33,0xba,0x50,0xda,0xa6,0x3d,0x2b,0x27,0x19,0x56,0x69,0xd5,0x34,0x6a,0xcb,0x64,0x4a,0xe3,0xe4,0x06,0xef,0x5d,0xe5,0x7a,0x43,0x2a,0x35,0xf0,0x65,0x7a,0xcd,0xf4,0xeb,0xd2,0xac,0xd7,0xa4,0x9b,0xed,0xb5,0xda,0xa2,0xe6,0xbd,0x4d,0xb7,0xc8,0x6c,0xa8,0x63,0xa5,0x5c,0xde,0x8b,0x12,0xa6,0x1c,0x4b,0x0d,0x75,0x56,0x67,0x93,0x6d,0x31,0xbf,0xbb,0xce,0x92,0x03,0xaa,0x64,0xe0,0x2d,0x7a,0x83,0x6d,0x0a,0xed,0xfe,0x4c,0x5e,0x19,0xfb,0xd3,0x91,0xe9,0x1d,0x0f,0x8b,0xd5,0xac,0x45,0x97,0xca,0x7b,0x99,0xea,0xe9,0xfd,0xc5,0x3a,0xbf,0x9a,0x4d,0xf6,0xc9,0xe3,0xa8,0x72,0x9c,0x1c,0x8f,0x35,0xe1,0x52,0x00,0x06,0x42,0xec,0xc9,0x07,0xb2,0xb3,0x5c,0x63,0x3c,0x49,0xac,0xe8,0x7d,0x9b,0x15,0x72,0x25,0x3d,0x5b,0x28,0x4a,0x97,0xfe,0xf6,0x38,0x65,0x5b,0x83,0x83,0x52,0x9a,0xf3,0xc3,0x8d,0x40,0x0b,0x67,0xf5,0x92,0xbb,0x32,0x7c,0x1a,0xcf,0x53,0x8d,0xda,0xf4,0xc8,0xa5,0x18,0xd0,0xc0,0x88,0x4a,0x7d,0x48,0xd4,0xb7,0xdd,0x22,0x57,0x3e,0x24,0x9b,0x23,0x7c,0x5d,0x6b,0x54,0x73,0x86,0x86,0xab,0xc2,0xb9,0x9c,0xbc,0x60,0xa3,0x62,0x7d,0x3e,0x9f,0xd1,0x15,0x61,0x42,0xe6,0x54,0x7d,0x7e,0xe8,0xb5,0x33,0x57,0x96,0xc2,0x98,0x63,0x7a,0x5d,0x1a,0x57,0xe8,0xa5,0xd0,0xed,0x2e,0xd6,0xa9,0xf4,0xb4,0x93,0x4d,0x4a,0x4a,0x6d,0xa8,0x0d,0xa5,0xc5,0x89,0xcb,0x53,0xbc,0x98,0x5c,0xb3,0xdd,0x7d,0xb1,0xc2,0x77,0x68,0x4e,0x2a,0x10,0xfb,0xd4,0xe9,0x34,0x2d,0xa9,0x43,0xbe,0xdf,0xe7,0x96,0x9d,0xe2,0x81,0x2e,0xcd,0x2e,0xa3,0x93,0xd0,0xef,0xef,0x2f,0x52,0x3b,0x73,0xd2,0x64,0x5e,0xb8,0x64,0xd4,0xa4,0xcc,0xd3,0xdd,0x61,0xad,0xd7,0x16,0x29,0x95,0xd5,0xb1,0x73,0x6e,0x37,0x58,0xf4,0x4a,0xc7,0x4e,0x26,0xcb,0x2d,0x56,0xd5,0x54,0x9e,0x9d,0xd0,0xb5,0x63,0x7e,0x52,0x17,0x47,0xcd,0xf3,0x41,0x1a,0x35,0xe8,0xc2,0x5e,0xab,0xd1,0xb5,0x53,0x2e,0xc3,0x50,0x87,0xd9,0x20,0xd3,0x67,0x97,0xdc,0x8e,0xdb,0x1a,0x83,0xb5,0xc8,0xd4,0xd8,0xd1,0xbe,0x69,0x1c,0x76,0xa3,0xfd,0x26,0xdd,0xa9,0x95,0x97,0x40,0xa7,0x86,0x93,0x6e,0xb1,0x94,0xde,0x6f,0xe8,0x36,0xce,0x50,0x3a,0x4b,0xb6,0x94,0x2c,0x5b,0xca,0xed,0xd5,0x8e,0xd2,0xeb,0x97,0x93,0xf3,0x0b,0xdf,0x98,0xed,0x8f,0xc5,0x49,0xf3,0x3c,0xc9,0x16,0x95,0x51,0xee,0x58,0x4c,0x9f,0xa7,0x72,0x96,0x1b,0xeb,0x35,0x65,0x2c,0xf7,0xfb,0xed,0xb6,0x5c,0x4a,0x73,0x47,0x86,0xda,0xb7,0xa6,0xcd,0xad,0x94,0xe9,0x51,0x65,0xee,0xd8,0xdf,0x1f,0x7a,0x79,0xf6,0xb8,0x9e,0x14,0x0e,0xab,0x45,0xae,0x75,0x9d,0x65,0xe9,0x64,0xea,0x44,0xb6,0x47,0xc6,0xbe,0xbf,0xde,0x6b,0x59,0x35,0x85,0x4d,0x8e,0x94,0x28,0xed,0xea,0x5c,0x83,0xcf,0xf4,0xa4,0xeb,0x8a,0xeb,0xd6,0x55,0x3a,0xa5,0x14,0xd5,0xe9,0x64,0x7d,0x55,0xf8,0xec,0x76,0xb8,0x2e,0xd2,0x9b,0xa9,0xc8,0x14,0x28,0x91,0x6e,0x0f,0x77,0x74,0xa7,0x2f,0x2b,0xba,0x80,0x1f,0xf7,0xdc,0xf5,0xb4,0x1e,0xf5,0x53,0xbd,0xd2,0x58,0x60,0x7b,0x74,0x59,0x68,0x90,0xdd,0xcc,0x7c,0xd3,0xd0,0xaf,0xf4,0xa8,0x5b,0x3d,0x19,0xec,0x50,0x2d,0x97,0xa6,0x25,0x81,0x1a,0x65,0xb2,0xc7,0x61,0x3d,0x59,0xa6,0x99,0x13,0x2b,0x52,0xe7,0x16,0xd6,0x59,0x14,0x2b,0x3a,0x43,0x75,0x8f,0x73,0x52,0x4e,0x61,0x45,0x4d,0xce,0x60,0x86,0x28,0x26,0x99,0x5a,0x6a,0x75,0x68,0xad,0x93,0xe9,0xcc,0x4a,0x2a,0x55,0xd5,0x71,0x6b,0xd8,0xe6,0x4b,0xc3,0x02,0xb5,0xaf,0x97,0x06,0x07,0x7c,0x90,0x4c,0xb7,0xb8,0xf4,0x7a,0x6c,0x68,0x74,0xbe,0x8d,0x4d,0x7b,0x46,0xbd,0x4d,0x1d,0x24,0x7c,0xa9,0x16,0xf6,0xd4,0xe4,0x7a,0x61,0xa7,0xda,0x95,0x58,0x33,0xed,0xc1,0x2a,0xbd,0x05,0x4a,0x94,0x11,0xe5,0xbc,0x84,0x95,0x2e,0x6c,0xb7,0x86,0xcd,0xc5,0xb2,0x40,0x33,0x74,0x66,0x2c,0x34,0x3b,0x4b,0xa5,0x4c,0x8c,0x4a,
-0xc2,0x7e,0x38,0x6d,0x4b,0xdb,0x5c,0xcb,0x50,0x89,0x32,0x5b,0x20,0xc6,0x4d,0xae,0xd9,0x6f,0x34,0x49,0x49,0x6a,0xae,0xc8,0x7e,0x11,0x53,0x85,0xd1,0x65,0x75,0x2c,0x5d,0xe5,0xf4,0x6a,0xa6,0xd4,0xd9,0xa6,0xd4,0xd0,0x4b,0x93,0xa1,0x40,0xa5,0x29,0x41,0x9c,0xee,0xa6,0x07,0xf1,0xdc,0x6f,0x6d,0xf7,0xb2,0x41,0xf6,0xb3,0x58,0xaa,0x9c,0xc5,0x67,0x03,0x4a,0x98,0x94,0x4f,0x74,0x9f,0xad,0xae,0xc8,0x7d,0x9a,0x38,0xe0,0xe3,0xf9,0xb0,0xa8,0x66,0xc6,0xdd,0x8d,0x5a,0x2f,0x0a,0x13,0x71,0xb4,0x51,0xe5,0x7e,0xab,0x79,0x48,0xa5,0xb8,0x1e,0x4f,0x48,0x43,0xbc,0x24,0x94,0x8b,0x6d,0x23,0x75,0x38,0x66,0x70,0xa1,0xb7,0xe1,0xaf,0x87,0x5c,0xfb,0xa2,0x9f,0x29,0x8e,0xac,0xcc,0xf6,0x54,0x2a,0x85,0x35,0x47,0xc7,0xc9,0x2c,0xdf,0x3b,0xcc,0xc6,0x95,0x39,0x08,0xa2,0x67,0xa3,0x32,0xb5,0x1f,0x14,0x30,0x4a,0xe4,0x0f,0x06,0x27,0xd5,0x06,0x8c,0x54,0x15,0xd6,0x05,0x69,0x3a,0x25,0x37,0xd3,0xd4,0x58,0xbb,0x54,0xc6,0xd2,0x95,0x5d,0xd7,0x4f,0xe2,0x95,0x17,0xfb,0xcc,0x78,0xce,0x74,0x8a,0xed,0x4c,0x6e,0x26,0x29,0x65,0x6e,0x51,0x53,0x69,0xa2,0x45,0x2d,0x9a,0xed,0x0b,0x70,0x32,0x9b,0xc6,0x75,0x55,0x13,0xa8,0xcd,0xf1,0xb4,0x6c,0x30,0xcd,0xc6,0x71,0x38,0xcc,0xb4,0x15,0xe1,0xdc,0x2c,0x25,0x09,0x41,0x6e,0xb7,0x2e,0x97,0x35,0xad,0x52,0xc3,0x73,0x7a,0xd7,0x6e,0x5c,0x04,0x72,0x26,0x1f,0xaf,0xc5,0xf9,0xba,0x56,0x3e,0x55,0xd9,0x71,0x6f,0xbd,0x5d,0x9e,0x4f,0x9d,0x5a,0x5b,0x2c,0x54,0x75,0x66,0xb4,0x9e,0xcc,0x4b,0x62,0xa7,0x26,0x1a,0xdd,0x72,0x2a,0x73,0xca,0xae,0x4b,0xeb,0xe4,0x38,0x07,0x94,0x94,0xa4,0x07,0xd9,0xf3,0xb4,0xd2,0x24,0x32,0xec,0x25,0x65,0x90,0xab,0x76,0xa3,0xb8,0xd3,0xe4,0xde,0xa6,0xd3,0x5f,0x57,0x96,0x93,0x55,0x29,0xd9,0x1f,0x2f,0x6b,0x45,0x05,0x57,0x86,0x4d,0x5a,0x5b,0xb7,0x93,0x85,0xa1,0x5a,0x15,0xc9,0x46,0x63,0xbc,0x93,0x99,0x7e,0x93,0x2b,0x37,0x39,0x6a,0xa3,0xe0,0x93,0xff,0xb7,0xba,0x27,0x6d,0x4b,0x1d,0x59,0xfa,0xaf,0xc4,0x3c,0xef,0xf5,0x92,0x01,0x81,0x88,0x0b,0x2e,0x78,0x1e,0x04,0xc5,0x05,0x41,0x05,0x45,0x74,0xbc,0x3c,0x81,0x34,0x10,0xcd,0x66,0x16,0x10,0xcf,0xf8,0xdf,0xdf,0xaa,0xee,0x6c,0x40,0x40,0x8f,0x73,0x66,0xce,0xcc,0x07,0x85,0xa4,0xbb,0xab,0xab,0xaa,0xab,0x6b,0xeb,0x4a,0x38,0xb3,0xea,0xc5,0x7b,0xab,0x9e,0x2f,0x67,0x32,0x45,0xd3,0xaa,0x6f,0x1c,0xd6,0x6f,0x35,0xa5,0xa1,0x3c,0x1b,0x1b,0x3b,0x8a,0x2a,0x3b,0x67,0xeb,0x1b,0xd6,0x6d,0xd7,0x6d,0x34,0x9d,0xbb,0x46,0xce,0x3d,0x2d,0xdf,0x5e,0x8f,0xd6,0x4f,0x25,0xe7,0x72,0xac,0x35,0xc5,0x13,0x1b,0x4c,0x94,0xb3,0x09,0x86,0xea,0x4d,0xcb,0x8e,0x5a,0x95,0x6a,0xd5,0x4c,0x1e,0xaa,0xf9,0xaa,0x5c,0xce,0x3e,0xb5,0x8a,0x65,0x37,0xf7,0x6c,0x5c,0x55,0xeb,0x83,0x61,0x63,0xdc,0x3b,0x56,0xb2,0xdb,0x67,0x67,0x66,0xcf,0x5a,0x27,0xd7,0x6f,0x2d,0xf7,0xb8,0x3d,0x69,0xb7,0x47,0x2d,0x57,0x14,0x4f,0x55,0xa3,0x76,0xdc,0x18,0x65,0x8b,0x47,0x2d,0x25,0xd9,0xbd,0x7a,0x69,0x59,0xd9,0xe7,0x93,0x9a,0xea,0x26,0xdb,0x87,0xf6,0xb1,0x78,0x72,0x5f,0x1e,0x66,0x8c,0xe2,0xa4,0x24,0x5b,0xdd,0x76,0x55,0xcd,0x4b,0x77,0xbd,0x33,0xad,0x5a,0x32,0xfb,0x75,0xf5,0x7e,0xa3,0x6f,0x5d,0x95,0xd6,0x8b,0x0d,0xab,0xa8,0x0f,0x6e,0xeb,0x76,0xae,0x6b,0xd6,0x94,0xeb,0x49,0xb7,0xd6,0xb0,0x32,0x66,0xf5,0x72,0x68,0xb5,0x5a,0x37,0x67,0x2f,0x57,0x45,0xd7,0xd6,0xf2,0x4d,0x0b,0xdc,0xf2,0xae,0xaa,0xd4,0xfa,0x37,0x93,0xea,0xb1,0x7d,0x24,0xed,0x5c,0x8f,0xec,0xde,0xfa,0xd1,0xd3,0xdd,0xe9,0xce,0x0e,0x79,0x2e,0x65,0xf2,0xcf,0x97,0xe6,0xc9,0xa8,0xb9,0x59,0xdf,0x7a,0x6a,0xd5,0xcb,0xf9,0xd1,0xba,0xa9,0x6f,0x1c,0x0d,0x87,0x10,0x24,0xdd,0xb4,0x6b,0x2d,0xb1,0x78,0x7a,0x9d,0xb7,0xcf,0xb5,0xbe,0xdb,0x56,0x2b,0xc3,0xfb,0xd3,0xcb,0x2d,0x5d,0x91,0x4b,0xb7,0xa3,0x97,0xda,0xab,0xb1,0xd1,0x1c,0xe4,0x60,0xf3,0xb5,0xe4,0xc9,0xc4,0x3d,0xbe,0x1d,0x69,0xc5,0xd3,0x96,0x76,0x93,0xef,0xf7,0x8b,0x4a,0xf9,0x65,0xbb,0xe7,0x5c,0xc8,0x87,0x9b,0xaf,0xad,0xcc,0xdb,0xcd,0x95,0x5b,0x3d,0xec,0x57,0x4e,0x76,0x4e,0x5f,0xba,0x99,0x72,0xaf,0x2b,0x5e,0x8a,0x27,0x03,0xad,0x9e,0xc9,0x8c,0xdd,0x71,0xd6,0xbe,0x7d,0x3d,0x7f,0x3b,0x57,0x5e,0x6f,0x9b,0x95,0x57,0xfb,0x72,0xf0,0x7a,0x72,0x77,0xec,0x5c,0x1e,0x77,0xef,0x8f,0x6e,0xef,0x2b,0x77,0x83,0x1d,0x69,0xeb,0xf0,0xea,0x52,0xaa,0xdf,0xb7,0x2a,0x0d,0xa9,0xa6,0x54,0x7a,0xd5,0xa7,0x9b,0x57,0xb7,0xdc,0x27,0x52,0x63,0x5b,0xb6,0x95,0xd6,0x65,0xa3,0x5b,0xb9,0x3e,0x27,0x37,0x6d,0xad,0x7c,0xd1,0x3d,0x57,0x9b,0xf5,0x4d,0xf5,0x65,0x93,0x4c,0x54,0xcb,0xd8,0x36,0xb7,0xcf,0xb2,0x67,0xaf,0x6d,0xb7,0xf9,0x96,0xbf,0xed,0x6b,0x64,0xac,0x6e,0x6a,0x8e,0x2a,0x4e,0xea,0xb2,0x69,0x35,0xef,0x6b,0xfa,0xbd,0x5d,0x2b,0xd6,0xc5,0x64,0xab,0xfc,0xba,0x73,0x91,0x37,0xde,0xda,0xfd,0x41,0xb7,0x9d,0x6c,0x96,0xaf,0xb2,0x87,0x83,0x6a,0x65,0xf8,0xf2,0xd4,0x6e,0xdf,0x57,0xca,0xd5,0xeb,0xac,0x66,0xd4,0xf2,0x3b,0x2d,0xa7,0x71,0x74,0x2f,0xe7,0x1b,0x93,0x5e,0x46,0xb6,0x1a,0x49,0x57,0x3a,0xb9,0xee,0xbd,0x6e,0xbf,0x35,0xad,0x6b,0x4d,0x1b,0xbe,0x36,0xa5,0x7c,0x7e,0xfc,0x72,0x9e,0xcb,0x89,0x72,0x26,0x97,0xbc,0x6b,0x0e,0xb6,0x76,0x9a,0xad,0xfa,0x6b,0x65,0xbc,0x73,0x73,0x3e,0x7e,0x75,0xdb,0xd5,0x9d,0x6d,0x88,0x3d,0x4f,0x73,0xb5,0xec,0xf5,0x15,0x29,0x6d,0xbc,0xd5,0x8a,0xee,0xc9,0xc5,0xce,0x79,0x7e,0x3b,0xd7,0x6c,0x99,0x95,0x24,0xe9,0xca,0x2f,0xf9,0x73,0xc7,0xb8,0xd0,0xdd,0xd3,0x73,0xb1,0x35,0x19,0x36,0xee,0xd6,0x9f,0x9f,
-0x2c,0xb9,0x61,0x96,0xc8,0xfd,0xfa,0xeb,0x8d,0x68,0x1d,0x5f,0xe5,0x6a,0xdb,0xe4,0x74,0xbb,0xba,0x31,0x11,0x93,0x6f,0xa2,0x6b,0x8f,0xe4,0xed,0xd3,0x8d,0xad,0x9d,0x3b,0xf1,0xc5,0xe8,0x1e,0x8f,0xc6,0x37,0xeb,0xdd,0xc3,0xd3,0xf6,0xc5,0xf1,0x70,0x7c,0xf4,0xda,0x54,0xf2,0xdb,0xfa,0xf0,0x82,0xdc,0xbe,0xbd,0xe5,0xaf,0x2a,0xad,0x91,0x79,0x73,0xe7,0x9a,0x67,0x83,0xe6,0x56,0xf3,0xce,0x1d,0x95,0xe5,0x97,0xeb,0x97,0xad,0x5e,0xdb,0xd1,0xdd,0x4d,0xbb,0x66,0xd5,0xeb,0xf5,0xec,0x69,0xb5,0xa7,0x1c,0x9d,0xb7,0xef,0x44,0x33,0x97,0xa9,0x3f,0xe9,0x3d,0x31,0xf7,0x56,0xb9,0x6b,0xd9,0x49,0x71,0x2b,0xd7,0x1e,0xb5,0xe5,0xad,0xb3,0x61,0x71,0x73,0xa7,0x99,0xbd,0xdb,0xd8,0x3c,0x6e,0x9f,0x95,0x1b,0xaf,0xb5,0x97,0x6e,0xb1,0x06,0x34,0x3c,0x9d,0x9f,0x3f,0x8f,0xb3,0x83,0x0d,0x73,0xe0,0x1e,0x17,0xab,0x59,0x5b,0xed,0x96,0xed,0xb3,0x61,0xb3,0x7b,0xdc,0x6b,0x49,0x3b,0xcf,0x59,0xb9,0x77,0xf2,0x72,0xbf,0x95,0xdb,0x1e,0xca,0x39,0xbd,0xf6,0x76,0xb6,0xb5,0x53,0xaf,0x3a,0x4f,0x9b,0xd5,0x1b,0xfd,0x3e,0x9f,0x69,0x65,0x46,0xdb,0xa5,0x7a,0x79,0xdc,0xd5,0x25,0x08,0xa1,0x2e,0xda,0x99,0x4c,0xa3,0x74,0x75,0x3b,0x2a,0x35,0x9e,0x33,0x5b,0x6f,0xb9,0xee,0x5b,0xbb,0xb6,0x9e,0xcf,0x35,0x93,0x66,0xd5,0xda,0xb2,0x2e,0x34,0xcb,0xdd,0x3e,0x6f,0xe6,0x8b,0xad,0x33,0x6d,0xf4,0x94,0x6d,0x5d,0x6d,0xaa,0xf5,0x5b,0xe7,0xfc,0x34,0x5f,0x6e,0x5b,0x4f,0x15,0xe7,0x3e,0xd9,0xcd,0xee,0xb4,0x93,0x63,0x71,0xc7,0xd5,0xee,0x4e,0xee,0x72,0xaf,0x49,0xf1,0x65,0xdb,0xba,0xaf,0x26,0xa5,0xb7,0x9b,0x11,0xd9,0x7a,0x22,0xd9,0x66,0xfd,0xf9,0xb5,0x77,0x7f,0xff,0x9a,0x84,0xa8,0xa7,0x5a,0xed,0xe6,0xab,0xd6,0x76,0xd2,0xca,0x4d,0x1a,0xcd,0x9e,0x59,0xde,0xca,0xec,0x64,0x8a,0xf7,0xba,0x38,0x3c,0x35,0xca,0xcf,0xdb,0xca,0x1b,0xab,0xf4,0x56,0x8f,0x9b,0xcf,0x0d,0xf7,0x4a,0x2b,0x95,0x78,0x4e,0x52,0x9d,0x02,0x5f,0x54,0xaa,0x98,0xeb,0x81,0xd8,0x3a,0x23,0xcd,0xc5,0xe6,0x18,0x87,0x43,0xcb,0x70,0xdd,0xbf,0xc9,0x5e,0x83,0x04,0x91,0xf9,0x3a,0x7f,0xe0,0x8d,0xdc,0xcf,0x0c,0xd7,0x61,0x30,0x8c,0xf4,0xff,0xcf,0x00,0x61,0xc7,0x8f,0xbc,0xdf,0x8a,0x2f,0xe3,0xe0,0x14,0x99,0xb5,0xb1,0x57,0x75,0xf0,0xd1,0xee,0xde,0x2d,0xd6,0x11,0x06,0xd1,0x0f,0x6e,0xc9,0x95,0xff,0x81,0xd3,0xfa,0x70,0xb1,0x78,0x74,0x0a,0x2a,0x4d,0x68,0x71,0x41,0xd3,0x22,0x4a,0xcd,0x68,0x06,0xc3,0x32,0xd4,0x68,0x62,0x82,0xbd,0xa2,0x88,0x0b,0x8f,0x36,0xc2,0xc4,0x04,0x9d,0x97,0xb5,0xaf,0x59,0x84,0x96,0x84,0xfa,0x04,0x5c,0x1f,0x35,0x9a,0xc5,0xeb,0xe6,0x14,0xe6,0x3e,0x44,0x2c,0xa2,0xc5,0xa4,0x46,0xf4,0x9a,0xd5,0xdd,0x22,0xb7,0x94,0x90,0x40,0x58,0x99,0x8c,0xb9,0x80,0xbd,0x3f,0x84,0xb9,0xf7,0x96,0x13,0x85,0x96,0x1f,0x61,0xde,0x4f,0x9e,0x21,0x02,0xb0,0x27,0x51,0xdc,0x8f,0x7e,0x00,0xf3,0xb0,0xb2,0x78,0x19,0xfa,0xde,0x7f,0x40,0x7d,0xe6,0x8e,0x97,0x6c,0x9a,0xcb,0x18,0x51,0xbc,0xe6,0x57,0x2d,0x9a,0x63,0x5a,0x24,0x71,0x12,0x1d,0xeb,0x48,0x5d,0x56,0xa6,0xcb,0xc7,0xe5,0x98,0xa0,0x35,0x92,0x61,0xf2,0x44,0x5a,0x02,0x7a,0x23,0x83,0x89,0xe3,0x28,0xfa,0xc0,0xfe,0xc4,0xf8,0x86,0xd7,0x75,0x16,0x04,0xad,0xb0,0xfd,0xc4,0xf8,0x22,0xf6,0x63,0x1c,0x9b,0xe3,0x96,0x9f,0x8d,0x43,0x98,0x58,0xb6,0x6b,0x7b,0x25,0x99,0xfc,0x7c,0xd3,0x0c,0xbd,0x43,0x09,0xe6,0xc1,0x32,0x60,0xc6,0x19,0x82,0xe9,0x3a,0xf3,0xa0,0xc4,0x24,0x85,0x9b,0x18,0xae,0x05,0xcb,0x4b,0xdf,0x6d,0xe6,0xef,0x6a,0xae,0xa1,0x61,0x5d,0xb3,0xc7,0x0e,0xaf,0x8d,0x73,0x6d,0x7c,0x99,0x9c,0x33,0x24,0x9c,0x27,0x65,0x36,0xd7,0x25,0xaa,0x31,0xa6,0xcb,0xcb,0xaa,0x87,0x7d,0x45,0x81,0x17,0x30,0x8b,0x43,0x5f,0xce,0xb2,0xef,0x58,0xf0,0x37,0x3c,0x68,0xd0,0x72,0xc2,0xfd,0x0c,0x7c,0xdd,0x77,0xe4,0x83,0x7d,0x55,0x82,0xe1,0xfe,0x10,0xbf,0xd6,0x35,0xdc,0x5f,0x20,0x60,0x98,0x1b,0xe5,0x68,0x6e,0x94,0xa7,0x95,0x87,0x5d,0xe3,0x95,0x87,0x6d,0xac,0xc1,0x35,0x90,0xe8,0x10,0x26,0x1d,0x6c,0x68,0x87,0xdd,0x01,0x76,0x51,0xb8,0xf0,0x89,0x73,0x64,0xe8,0xdc,0x6c,0xfe,0x43,0xaa,0x06,0x74,0x62,0xdb,0x21,0x0e,0x6c,0x0a,0x1f,0x07,0x9a,0x79,0x9d,0xda,0xe3,0x6c,0x72,0x9a,0x99,0xe5,0x39,0x4d,0xd1,0x0b,0x7c,0x16,0x3e,0xa5,0xd7,0x02,0xbf,0xbe,0xb9,0xc9,0x73,0xb6,0x43,0xcc,0x02,0x2f,0x7a,0x78,0xd0,0xe1,0x9d,0x6e,0x30,0x0d,0x20,0xc3,0x52,0xb2,0xf8,0xec,0x44,0x5c,0x7b,0xc8,0xaf,0x01,0xce,0xaa,0xfa,0xba,0x98,0x8d,0x8a,0x21,0xa1,0x44,0x13,0xed,0x4d,0xa2,0x99,0xc4,0x92,0x1c,0xd7,0x22,0x7f,0x86,0x12,0x71,0x73,0xc3,0xa3,0x65,0x33,0x9b,0x8d,0xa7,0x85,0xe6,0x97,0x3b,0x20,0xab,0x66,0x3c,0x2d,0x91,0xf6,0x1f,0xa6,0x25,0x44,0x7d,0xae,0xe9,0x9a,0xc8,0x1f,0x12,0xc6,0x94,0xd9,0x97,0x56,0xc8,0x8a,0x27,0xc6,0x9a,0xa5,0xc1,0x9b,0x62,0x19,0x11,0x15,0x7c,0x9f,0xcf,0x87,0xb8,0x7a,0xe7,0x46,0x5f,0x42,0x76,0x10,0x8f,0xec,0x60,0x16,0x59,0x7f,0x8e,0x65,0xd8,0x1e,0xaa,0xee,0xc7,0x12,0x83,0xa7,0xaa,0x5f,0x13,0xfc,0x05,0xf2,0x3e,0x8b,0x29,0x9d,0x60,0x19,0x9a,0xad,0x21,0xa8,0xc7,0xa5,0x78,0x7e,0x09,0xbf,0x31,0x82,0xed,0x8c,0x24,0x60,0x42,0x3c,0xa6,0xd1,0x0e,0x3f,0x2c,0xce,0x15,0x49,0xd3,0x24,0xae,0x64,0x58,0x16,0xd3,0xc6,0x3f,0x49,0xcf,0x0d,0x10,0xec,0x94,0x9e,0x63,0x77,0xe2,0xf4,0x5c,0xc6,0xd3,0xb7,0x19,0xaa,0x7f,0xa3,0x46,0x75,0xde,0x42,0xf8,0x46,0xed,0x60,0x1f,0x8b,0x8d,0x18,0xfc,0xc0,0xd0,0x19,0xba,0xed,0x76,0x35,0xc5,0x41,0x8f,0x00,0xb4,0x8c,0xbe,0x22,0xce,0x5a,0x5f,0xd5,0xd5,0x74,0x1b,0xa9,0xd0,0x8c,
-0xae,0x42,0x75,0xfd,0x5c,0x33,0x35,0x6f,0x63,0x63,0xcd,0x19,0x2a,0x96,0x4c,0xfb,0x1a,0xfd,0x3e,0xcc,0x81,0xde,0xe3,0xfe,0x50,0x9c,0x73,0x2a,0x37,0xa6,0x98,0x52,0x21,0x60,0xdc,0x25,0x15,0xfc,0x4b,0x71,0x0a,0x76,0x5f,0x21,0xaa,0x8c,0x3d,0x87,0x86,0xa5,0xbc,0xa1,0x17,0xa0,0xf2,0xf3,0x1d,0xd6,0x18,0xcf,0xa1,0x1b,0x7b,0x34,0x8c,0x9f,0x59,0x05,0x7a,0xc1,0x1f,0x5c,0xa2,0xb7,0xc5,0xdd,0x98,0xdc,0x85,0x21,0x93,0x90,0xa1,0xb3,0x8e,0x16,0x03,0x89,0xbc,0x8d,0x99,0x8a,0x4e,0x42,0x9d,0x9f,0x79,0x0f,0x85,0x79,0x62,0x91,0x9b,0x36,0x51,0x61,0x25,0xa8,0xc9,0xc6,0x2f,0xde,0x1a,0x53,0xa7,0xcf,0x35,0x3b,0x1a,0x60,0xc1,0x96,0x7a,0xea,0x0e,0xc8,0xaa,0x49,0x57,0x8f,0x4a,0x26,0x0a,0xfa,0x41,0x51,0x1d,0x4b,0x13,0x9b,0xab,0xf7,0xfb,0x20,0x91,0x26,0x5b,0xe3,0xe9,0x4e,0x62,0xd8,0x49,0x5f,0xd4,0x07,0xdd,0x78,0xb4,0xe1,0xf8,0x1c,0x41,0xd8,0x27,0xc3,0x70,0x9b,0xf1,0x41,0xe6,0xfe,0x77,0xad,0x4f,0xac,0x62,0x8d,0x80,0x04,0x58,0xcf,0x7f,0xed,0x2a,0x9e,0x18,0xb6,0x83,0x8c,0xfc,0xe2,0x02,0x2e,0x5a,0xb6,0x29,0xb5,0x43,0x2f,0x7c,0xad,0x83,0xce,0x14,0x55,0x3a,0x2a,0xd1,0x07,0xce,0x90,0xea,0x19,0x50,0x3d,0xc1,0xd5,0x7a,0x1e,0x14,0x90,0xf2,0x46,0xbc,0xaf,0xa6,0x2a,0xf5,0xc8,0xd0,0x50,0x41,0xc5,0x14,0x78,0x1f,0x59,0xb6,0xce,0x43,0xff,0x6a,0x31,0x9f,0xff,0x2a,0xae,0xb5,0x94,0x63,0x85,0x6b,0x34,0x4e,0xcb,0x7f,0x37,0xdb,0x42,0x46,0xe5,0xd6,0x7d,0x3e,0xe1,0xb7,0x29,0x36,0x05,0xd8,0x31,0x3e,0x8d,0x95,0xbe,0xd2,0xb1,0x6d,0x45,0xfe,0x55,0x8c,0xba,0x84,0x3b,0x20,0xc9,0xf2,0xcf,0x64,0x16,0x87,0x8e,0x39,0x8d,0x9d,0x58,0x7c,0xea,0x5f,0x22,0x46,0x3d,0x95,0x48,0x56,0x5f,0x79,0x5d,0xca,0x50,0xd3,0x43,0x6a,0x4a,0x16,0xf3,0x53,0x2c,0xde,0xca,0xf9,0x2c,0xc6,0x6f,0xf3,0x2c,0xbe,0x6c,0x9c,0x73,0x09,0x9f,0x38,0x21,0xc2,0x6c,0xd3,0x7e,0xe6,0x63,0xc2,0x3e,0xc4,0x8d,0x62,0xcb,0xfb,0xe5,0x02,0xde,0x43,0x36,0x6b,0x64,0x04,0xd1,0x85,0xbd,0x2b,0xb9,0x8e,0x31,0x17,0x1b,0x92,0x09,0xc8,0x3b,0x1e,0xda,0xaf,0x51,0xfc,0xa3,0x53,0x4c,0x85,0x8a,0x7f,0x46,0xd5,0x5c,0x5c,0x35,0x9b,0x7f,0xad,0x9e,0x69,0x10,0x6b,0x44,0xac,0x7f,0x85,0x96,0x41,0x66,0x70,0x0c,0x5f,0x54,0x2f,0x1c,0x04,0x0d,0xa7,0x97,0x5c,0x51,0x96,0x2d,0xea,0x86,0xd2,0x98,0xfa,0xc5,0x71,0xc0,0x0d,0xc0,0x2e,0xbf,0x60,0x53,0x5d,0x1a,0x10,0x5f,0xd6,0x5c,0xad,0xfb,0xb7,0x30,0x94,0x7e,0xa0,0x2d,0x85,0xe0,0xdb,0xd5,0x88,0xa5,0xf4,0xe6,0x98,0x1c,0xfa,0x8f,0x5b,0x9b,0x9b,0xb9,0xcd,0x25,0x8c,0xdf,0xf4,0xd9,0xbe,0xb9,0x98,0xe9,0x1c,0xa5,0x2f,0x41,0xd2,0x83,0x34,0x27,0xe6,0xf3,0x39,0x21,0xc2,0x73,0x7c,0xe6,0xfd,0x17,0x70,0xfc,0x06,0xd6,0x9a,0xfb,0x15,0x66,0x32,0xa2,0x8c,0x36,0x02,0x65,0xb4,0x31,0xc3,0x3b,0xc4,0x8e,0x4a,0xaa,0x6b,0x13,0x19,0x9d,0x72,0xcc,0x31,0xe8,0xe8,0xb5,0x62,0xca,0xc1,0xa0,0x59,0x87,0x08,0x7f,0x23,0xec,0x84,0x01,0xbf,0x44,0x80,0xff,0xe1,0x06,0x21,0x8e,0xeb,0x62,0x76,0x86,0xeb,0x3e,0x11,0x3f,0xce,0xf5,0x60,0xa6,0xbf,0xce,0x46,0xcc,0xcc,0xf3,0x19,0x43,0xf1,0x57,0x2d,0x36,0xe5,0x41,0x59,0xb1,0x7b,0xf8,0x88,0xc6,0xe4,0x27,0x6f,0xa0,0x9f,0x9c,0x06,0x1b,0x4a,0x1d,0xd9,0xc7,0x34,0x1a,0x25,0x7e,0x8d,0x65,0xe1,0x8a,0xcf,0xc0,0xfd,0x22,0x27,0x03,0x26,0x72,0x97,0x16,0x01,0x71,0xfe,0x47,0x3a,0x9f,0x0c,0x35,0xba,0x1f,0x70,0x07,0x9c,0x18,0xa0,0x97,0x8a,0xe0,0x7d,0xda,0xf8,0xae,0x92,0x50,0x0e,0x60,0x87,0x98,0x68,0x49,0x62,0x59,0xd4,0x31,0x29,0x90,0x5f,0xa0,0x99,0x1a,0x28,0x12,0x5c,0x13,0x71,0xfb,0x75,0xdc,0xfd,0xd8,0x3b,0xa1,0x08,0x52,0x1e,0x9b,0x6e,0x57,0x55,0xec,0xa1,0x9f,0x5c,0xa6,0x22,0xcd,0x19,0x7d,0xb8,0x50,0x6c,0x2e,0x26,0x23,0x1d,0xf5,0x5f,0xb0,0x6f,0x87,0xad,0xc3,0xdf,0xcf,0xe9,0x92,0xa1,0x69,0xf8,0x2a,0xef,0x7f,0x11,0xaf,0x2d,0xd2,0x23,0xca,0x08,0x59,0xdd,0x63,0xc8,0xdb,0x9e,0x98,0x7f,0xc8,0x6a,0xaf,0xff,0x2f,0x63,0x36,0x8a,0xb5,0x6b,0xff,0x9b,0x78,0xad,0x1b,0x8e,0xd2,0x9f,0x44,0xc5,0x1a,0xf0,0xff,0x9c,0x5c,0xab,0x63,0xe7,0x43,0x46,0x7f,0x2a,0x2a,0x2a,0x83,0xc9,0x55,0x0d,0x13,0xbd,0xec,0xbf,0x32,0x34,0xc2,0x73,0x4e,0xae,0x78,0x79,0xfa,0xcf,0x36,0x8d,0x78,0x38,0xdb,0x91,0x4c,0xe5,0x27,0x99,0x45,0x1f,0x5c,0xe7,0x99,0xfc,0x09,0x8b,0x08,0x5c,0xe3,0xce,0xc9,0x4f,0x75,0x2a,0xfe,0xb4,0x1f,0xf9,0x23,0xc6,0xd2,0xc3,0x9f,0x4a,0xbc,0x44,0x8f,0x20,0x7c,0x89,0xf7,0x85,0x82,0x71,0x2b,0x60,0xd4,0xcf,0x72,0x18,0xc3,0xf7,0x4f,0x4d,0xfb,0x8d,0xe1,0x8a,0x7c,0x32,0xb5,0xf0,0xc5,0x4d,0xc1,0xff,0x2c,0x29,0xf7,0x0e,0xe8,0xbd,0xfb,0x31,0x85,0x06,0x54,0x84,0xa5,0x11,0x01,0x25,0x08,0xff,0xf7,0x33,0xac,0xcb,0x47,0x09,0x5a,0xef,0x3f,0xa6,0xf7,0x97,0x1e,0x05,0xb0,0xc3,0xe9,0xe9,0x07,0x3b,0x62,0x4e,0x8c,0x63,0x54,0x4d,0x2e,0xcc,0xfe,0x7b,0x67,0xc4,0x6c,0x69,0xe9,0x6a,0xd8,0xb8,0x12,0x66,0xc7,0xcf,0x6e,0xfa,0xc5,0x1a,0x5e,0x3f,0xaa,0x8d,0xc2,0xca,0x92,0xe0,0x37,0xb6,0x00,0xea,0x66,0x00,0xf5,0x96,0x58,0x36,0xa2,0x3a,0x0f,0x75,0xc4,0x5a,0x22,0x80,0xc3,0x32,0x94,0x4f,0x9c,0x44,0xd7,0x68,0x18,0xec,0x9f,0xcf,0x4c,0x41,0x8f,0x66,0x64,0x3d,0xd0,0xb3,0x27,0x3d,0xd5,0xa3,0x32,0x57,0xb6,0x14,0x9a,0x0b,0x8a,0x85,0xa1,0x12,0xb9,0x23,0xd3,0x0e,0x4b,0xa0,0x1c,0x2b,0x96,0x36,0x96,0x2c,0xc2,0x1d,0xba,0x8a,0x2a,0x2f,0x80,0xd4,0xc5,0xb6,0x8e,0xec,0x1d,0x6c,0x53,0x48,0xab,0x7a,0xd7,0x36,0xf7,0xb8,0xb8,0x7e,0x8e,0xb2,0x14,0xef,0xa3,0xc6,0x25,0x9e,0x4f,0x11,0xce,0xe3,0xeb,
-0x82,0x39,0x7b,0xd0,0x65,0x09,0x94,0x25,0xc7,0xb6,0x34,0xa3,0x18,0xe6,0x99,0x16,0xc0,0x97,0xc9,0x48,0xe9,0x91,0x8e,0x62,0x2e,0x99,0x24,0x4c,0xe9,0x7f,0x6e,0x91,0xd2,0xaa,0xd1,0xc3,0xc3,0xa2,0x59,0x38,0x17,0xc5,0xd2,0x07,0xd8,0x68,0x52,0xef,0x6b,0xc4,0x5e,0x5a,0x06,0x2a,0x3b,0x63,0x91,0x10,0xf4,0x4c,0xb7,0xd3,0xb7,0xc8,0x8b,0x4b,0xf4,0xde,0x24,0x98,0x82,0xbb,0x38,0x79,0x8b,0x41,0x93,0x68,0x06,0xc6,0x95,0xf1,0x18,0xd2,0xc6,0x10,0x42,0x77,0xe2,0x10,0x3b,0x46,0x9e,0x2c,0x02,0xc1,0xfa,0x32,0x40,0x80,0x0d,0xe9,0x0c,0x89,0x64,0x2e,0x86,0xb5,0xf8,0x04,0x31,0xfc,0x26,0x7b,0x95,0x56,0x86,0x16,0x1c,0x92,0x6a,0x86,0x3c,0xab,0x28,0xe9,0xad,0xc8,0x73,0x7c,0x71,0xda,0x92,0xf5,0x09,0xeb,0x58,0x22,0x4d,0x68,0xc7,0xb1,0x4a,0xa5,0xfd,0xe9,0xea,0x14,0xf0,0xa9,0x7a,0xae,0x85,0xcf,0x1b,0xaa,0x13,0xae,0x4b,0xd0,0x08,0xb9,0x26,0xee,0x1c,0x39,0x9d,0x4e,0xd3,0x12,0x15,0xff,0x79,0x3e,0x7f,0x8e,0xe0,0x3a,0xaa,0x6b,0x83,0x33,0x36,0x96,0x0c,0x14,0xb1,0x32,0x82,0x52,0x4b,0xb9,0xe6,0x0f,0x59,0xe4,0x32,0x50,0xb7,0xe0,0xef,0xe0,0xcb,0xa5,0x8a,0x2f,0x9d,0xe0,0xc6,0x92,0xe2,0x70,0xe3,0x21,0x68,0xcb,0x1f,0xa8,0xe3,0x01,0x4e,0x79,0x65,0x6a,0xf8,0x23,0x9c,0x1e,0x73,0xe6,0xe9,0x61,0xaf,0x6b,0x0c,0x2c,0x18,0xbd,0x9a,0x37,0x61,0x31,0x45,0x58,0x1e,0xe2,0x5c,0x7c,0xdd,0xd1,0x0c,0x8a,0x53,0x68,0x49,0x1c,0x30,0xf8,0x09,0x0f,0x46,0xbb,0x13,0xac,0x9f,0x62,0x85,0x51,0x43,0xc7,0x31,0xed,0xdd,0x4c,0x66,0x3c,0x1e,0xa7,0x6d,0xa9,0x37,0x84,0x35,0x55,0x07,0x44,0x1f,0x1a,0xfd,0x34,0x04,0x25,0x68,0x14,0xe1,0x1e,0xd7,0xf4,0x6f,0xd2,0xe2,0xab,0xd5,0x9e,0x61,0x4e,0xf6,0xb8,0xf5,0xac,0xb8,0x8d,0xaf,0x6e,0xcb,0xae,0x8b,0x4c,0x04,0x0e,0xe6,0xa0,0x0e,0x14,0x67,0xe8,0x76,0x11,0x12,0x60,0xe2,0xc3,0xc8,0x04,0x85,0x91,0x0d,0x60,0x6b,0x0f,0x2b,0x9e,0xf0,0x80,0x58,0x62,0x58,0x8e,0x24,0x45,0xa5,0x46,0x06,0x6c,0x53,0x85,0x0e,0xa7,0xbf,0xe8,0xa4,0x82,0x5a,0xd3,0x31,0x91,0x36,0x35,0x07,0x4c,0x01,0xfe,0xb7,0x6e,0x53,0x38,0x69,0xc3,0x1a,0x64,0xbc,0x7e,0x76,0x46,0x53,0x9c,0x35,0xef,0x22,0x6d,0x0e,0x41,0xc0,0x2e,0x4e,0x9b,0x38,0x49,0xcc,0x8a,0x30,0xf6,0x03,0xf3,0x7a,0x96,0x62,0x3a,0x07,0xc0,0x62,0xdb,0xe1,0xce,0x3b,0x0d,0xdf,0xcd,0x4d,0x9d,0x77,0x0e,0xaf,0x41,0x3c,0xc2,0xda,0x22,0xb8,0x53,0x6a,0xd2,0xb3,0x78,0xbf,0x42,0x07,0xef,0x78,0x37,0xf0,0x3b,0x74,0xa7,0x9f,0x95,0x02,0x3f,0xa0,0xe3,0x61,0x38,0x7e,0xb6,0x0a,0x7c,0xb4,0x10,0x02,0x7b,0x5c,0xf8,0x75,0x08,0x70,0x71,0x52,0x46,0xff,0x20,0x92,0x0b,0x42,0x50,0xc5,0xd0,0x1b,0xe6,0x53,0x8d,0x4e,0xbd,0x56,0xe0,0xeb,0x35,0xfa,0xed,0xf8,0x18,0xbe,0x1e,0x1f,0xf3,0xa9,0x56,0xf1,0xb4,0x59,0x10,0xc9,0xc6,0x5e,0xdf,0xd5,0x99,0x07,0xc2,0xea,0xc1,0x12,0x24,0xe5,0x14,0x56,0xb2,0xc2,0x77,0x0c,0x8b,0xd2,0xb0,0x81,0xe0,0x1a,0xbf,0xc9,0x6e,0xc1,0x61,0xdf,0x14,0x5d,0x71,0x12,0xc2,0x7b,0x38,0x8e,0x56,0x6b,0x24,0xc8,0xdc,0x90,0x8e,0xd7,0x53,0x25,0xb0,0x29,0x48,0xd7,0xc6,0xf7,0x22,0x26,0xfc,0x61,0x09,0xaf,0xfb,0x80,0x38,0x34,0x43,0x52,0x88,0x34,0xb0,0x2a,0x07,0x1a,0x98,0xa5,0x29,0x3f,0xdf,0x19,0x40,0x7b,0xae,0xaf,0x3f,0x29,0xed,0xe5,0xcf,0x4b,0x54,0xff,0xc5,0x78,0x85,0xb0,0x71,0xb6,0xe9,0x9b,0x7f,0xcd,0x1e,0x8a,0xae,0x81,0x40,0xa5,0xe9,0x86,0xa9,0x2a,0xb6,0x93,0x96,0x64,0x39,0xc1,0x7b,0x3d,0x79,0x61,0x77,0x69,0x5f,0x0b,0x94,0xfc,0x88,0x44,0xba,0x7b,0xd8,0xb2,0xda,0xd9,0x39,0xe2,0x22,0xf8,0xae,0xcc,0xa2,0xe7,0x13,0x98,0x08,0x1b,0x84,0x3d,0x64,0x1f,0x29,0x7c,0x07,0xa8,0x11,0x72,0xf6,0x94,0x7e,0xc2,0x93,0xb5,0x42,0xa1,0xe0,0x31,0x7e,0x75,0x35,0x11,0xed,0xf3,0x0d,0x57,0x7e,0x97,0x2e,0xba,0x90,0xf2,0xd7,0xa6,0x50,0x40,0x99,0x11,0xbe,0xcb,0x46,0xcf,0xd5,0x80,0x18,0x5c,0x80,0x23,0x95,0xe0,0xd7,0xc3,0xc9,0x29,0x50,0x3d,0x9f,0x5d,0x14,0xd2,0x34,0x0c,0x48,0x7b,0x2f,0xa5,0x89,0xce,0xc0,0xe3,0xfb,0x8d,0xf8,0x5d,0x1e,0xdf,0x53,0xc3,0xbf,0x03,0x4e,0xd1,0x69,0xae,0x8b,0x4b,0xa6,0x99,0x8a,0xd6,0x3e,0x3d,0x03,0x79,0xf0,0x26,0x78,0xf4,0xa5,0x51,0x76,0x57,0x57,0x3d,0xe1,0x02,0xf6,0xe9,0x72,0xe2,0xac,0x51,0xaf,0xc1,0x58,0x0b,0x94,0x29,0x84,0xfb,0x20,0x21,0xfe,0x7a,0xa0,0x34,0xce,0x2d,0x04,0x51,0x0b,0x0b,0x51,0xf4,0xc2,0x54,0x3e,0xe9,0xcd,0xe9,0x31,0x91,0xad,0xdd,0x8c,0x38,0x05,0xe2,0x05,0x92,0x73,0x84,0x51,0x12,0x8a,0x06,0xd6,0xcc,0x80,0x5c,0x80,0x4e,0x79,0xe6,0xe7,0x64,0x22,0xdd,0x55,0x00,0x5b,0xbc,0x2b,0xa4,0xbe,0x63,0x5e,0x1d,0x1c,0xd4,0xdd,0x95,0xec,0xbb,0xf0,0xfe,0x2e,0xa4,0xc1,0x7b,0x52,0x13,0x6c,0x43,0xa6,0x41,0x07,0x3b,0x06,0x06,0x82,0x42,0x2a,0x66,0xf3,0xdc,0x52,0x03,0xb9,0x60,0xf3,0x00,0x3e,0x54,0x6b,0x84,0xfb,0x67,0xa6,0x3b,0x09,0xd8,0xc0,0x3a,0x06,0x5b,0x17,0xba,0xe2,0x9b,0x03,0x12,0x3e,0xf3,0xfc,0x1b,0x73,0x0c,0xec,0xd0,0xbb,0x89,0x29,0x28,0x6b,0xfe,0x95,0xa6,0xe8,0x42,0x26,0x68,0xc3,0xf7,0xd0,0x46,0x5b,0x7e,0x03,0x6b,0x9e,0xe4,0xff,0xc3,0x07,0xbc,0x63,0x42,0x00,0x33,0x81,0x33,0x67,0x12,0xcb,0x99,0x24,0x78,0xf6,0x02,0x03,0xaf,0x0b,0x9d,0xcb,0xdf,0x10,0x31,0x7b,0x32,0x5c,0x40,0xfb,0x70,0xd2,0x94,0x06,0x18,0x57,0x24,0x78,0x56,0x22,0xc6,0x0b,0x0f,0xd9,0xc7,0xbd,0x91,0xa1,0xc8,0x5c,0x76,0xa5,0x50,0x20,0xb0,0x57,0x08,0x88,0x04,0xac,0xd0,0x49,0xf3,0xa2,0x5a,0x98,0xc2,0x3f,0x42,0xb4,0x2e,0x47,0x29,0xf6,0xb6,0x22,0x95,0x00,0xdc,0x58,0xb5,0xf7,0xbd,0xa8,0x44,0x46,0x61,0xa4,
-0x3e,0x27,0x94,0x9d,0x1f,0x97,0x4a,0x56,0x1c,0x37,0x2b,0x95,0x8b,0xd8,0xa7,0x1a,0x63,0x3e,0xc5,0x67,0xff,0xc3,0x0b,0xb3,0x2b,0xbb,0x44,0x64,0x35,0xc3,0xb5,0xa9,0x56,0xe3,0xa7,0x07,0x2d,0x94,0xd9,0x25,0xb0,0x1c,0xc3,0xed,0x0d,0x7f,0x12,0x2c,0xd9,0x92,0x06,0x3f,0x01,0x4c,0x74,0x47,0x7e,0x0c,0xe7,0x01,0x34,0x19,0x5a,0x5d,0xb4,0xc9,0x8f,0x20,0x32,0x3d,0xd5,0x95,0x89,0xed,0x6b,0x3a,0xe1,0xdb,0x92,0x79,0x86,0xb4,0x1e,0x32,0x85,0x22,0x70,0x5d,0x39,0x5c,0x38,0xc5,0xee,0xc7,0x20,0x42,0x79,0x5c,0xa2,0x37,0x3c,0xb5,0xc1,0x5e,0x58,0x11,0xaa,0x0d,0xba,0x61,0x6c,0x87,0xa9,0x93,0x82,0x4e,0xc6,0xbe,0xa9,0x07,0x87,0x45,0x48,0x75,0x2d,0x36,0x80,0x35,0x30,0x5b,0x8e,0xde,0x8b,0x90,0xea,0x39,0x71,0x2d,0xa5,0xa6,0x90,0x8a,0x1d,0x02,0x23,0x06,0x71,0xf7,0x2b,0x30,0x47,0xec,0x14,0x42,0x6a,0x1c,0x77,0xbf,0x05,0x70,0xb4,0x38,0x64,0x2b,0x17,0x42,0x6a,0x28,0xc7,0xb5,0x9c,0x94,0x53,0x2b,0x22,0xa0,0x25,0xc5,0x35,0x5e,0x17,0x69,0xe3,0xb0,0x51,0x58,0x11,0x43,0x6f,0xc7,0x5b,0x93,0x45,0x9b,0x1a,0xe8,0x7c,0x44,0x9b,0xcb,0xbe,0x3d,0x78,0x04,0xd3,0x6d,0xee,0x7f,0xf7,0x95,0x2f,0xec,0x24,0xaf,0xd7,0x20,0xd2,0x6b,0xb0,0xb0,0x57,0x37,0xd2,0xab,0x3b,0xdf,0xeb,0x23,0xbd,0x11,0x50,0x00,0x63,0xb0,0x99,0xea,0x70,0x6b,0xe2,0xeb,0x7d,0x3a,0x02,0x74,0xa2,0x4d,0xa0,0xe1,0xbd,0x27,0x51,0x97,0xce,0xb7,0x0a,0x2b,0xe2,0x7b,0x38,0xde,0x64,0x11,0x73,0x19,0xc2,0x51,0xec,0xd1,0x37,0xac,0x04,0xb2,0xc2,0xe1,0x14,0x9d,0x83,0x6b,0x30,0xe6,0x2b,0x24,0x0d,0x41,0x43,0x7d,0xac,0x07,0x0a,0xc5,0x11,0x04,0x6f,0x1e,0xaa,0x49,0xd1,0xef,0x35,0x40,0xe7,0xa8,0xc6,0x20,0xc1,0x3f,0xb4,0x8e,0x0e,0x1b,0xf5,0xd2,0xf9,0x51,0xf3,0x91,0xbb,0xd1,0xd9,0xdb,0xcb,0x0d,0x7f,0x16,0x4e,0x83,0x7f,0x12,0x48,0xb2,0x40,0x3d,0x17,0x99,0x7a,0x2d,0x11,0xf7,0x80,0xa6,0x9b,0x0a,0xe0,0x01,0xa4,0xfd,0x2c,0xd5,0x9e,0x8f,0x90,0x42,0x11,0x7a,0x70,0x1e,0xd9,0x52,0xd9,0xa1,0x6a,0x84,0x60,0xde,0x9a,0x34,0x68,0x79,0xa4,0x61,0x15,0x41,0xf4,0x79,0x0c,0xa3,0x1f,0xbc,0x00,0xfb,0xbf,0x7c,0x52,0x49,0xf2,0xff,0x7d,0x84,0x29,0x1f,0x1e,0xd3,0x00,0xed,0x48,0xc2,0x97,0x30,0xe3,0x16,0xb1,0x43,0x4b,0x6a,0x0b,0xdf,0x11,0xf6,0x2c,0xa1,0x8a,0x00,0x06,0xc2,0x8e,0x18,0x08,0xec,0xf4,0xa0,0x3c,0x0a,0xb8,0xcf,0xa8,0xef,0x15,0x4b,0x41,0xb2,0xc0,0x43,0x7c,0xc3,0x27,0x19,0x48,0x2f,0x2d,0xf2,0x09,0x4a,0x66,0x95,0xfc,0xd4,0x13,0x25,0xc2,0xe7,0x09,0x05,0xcc,0x7e,0x2a,0xad,0xa9,0x45,0xfd,0x75,0x57,0x55,0xc1,0x8c,0x2e,0x22,0x80,0x82,0x5c,0xdc,0xe8,0x3b,0x1b,0xde,0x3c,0xa9,0xd8,0xc3,0x72,0xe0,0xaf,0xb2,0xba,0x1a,0x8f,0x80,0xf0,0xdd,0x57,0x04,0xa1,0xcf,0xec,0x43,0xdb,0xfb,0x80,0xb7,0x31,0x0e,0xee,0x9e,0x37,0xf6,0x8f,0x3f,0x12,0xf6,0x8c,0x2b,0xca,0x1c,0x4f,0x81,0xad,0xf9,0xcc,0xb9,0xc5,0x72,0x0c,0x7d,0x6d,0xf4,0xe3,0x18,0x4e,0xfb,0xc6,0x9f,0x40,0xee,0xfd,0xdd,0xa1,0x1e,0x77,0x63,0x75,0xd5,0xd7,0xf3,0xd3,0xb3,0xc2,0x52,0xf9,0x71,0x00,0xed,0x78,0x78,0xbd,0xba,0xea,0x2b,0xfe,0xc0,0x2d,0xa4,0x3d,0xfd,0x1e,0xa5,0xe6,0xea,0xaa,0x6f,0x00,0x66,0x7b,0x78,0x41,0x2b,0x6e,0x00,0x58,0xe6,0x58,0x30,0x68,0x34,0x1f,0x03,0x83,0x30,0xd7,0x56,0x79,0x0c,0x8c,0xc2,0x5c,0xdb,0xe1,0xa3,0xe0,0x23,0xd1,0x02,0xdf,0x7e,0x19,0x92,0x95,0x8b,0xd5,0x55,0xdf,0x56,0x4c,0x13,0x2c,0x44,0x14,0xdd,0xd8,0x2e,0xb1,0x32,0x9a,0x40,0xd9,0x8f,0xc1,0x84,0x1a,0x63,0x9a,0xa5,0xa4,0xbf,0xdc,0xec,0xef,0x54,0x00,0x1b,0xdc,0xc3,0xba,0xb0,0x3d,0x4f,0x19,0x87,0x21,0x46,0x4f,0x35,0x6c,0xd4,0xd2,0x09,0xef,0x06,0x35,0x35,0x2d,0xd2,0x6d,0xc0,0x77,0x82,0xbf,0xc6,0x82,0x39,0x0c,0xd8,0xff,0x49,0x08,0x59,0x92,0x4e,0x92,0xcf,0x8c,0x6d,0x5e,0x10,0xd2,0x86,0x8e,0x49,0x87,0x29,0xbf,0x7b,0xa1,0xee,0xf4,0x90,0x25,0x32,0xaa,0x4f,0x00,0x95,0x76,0xf0,0x47,0xa5,0x9d,0xb4,0x6b,0xa9,0xe0,0x35,0xfa,0x88,0x18,0x3a,0x45,0xe5,0x87,0x40,0xb2,0xb7,0x47,0xc1,0x28,0x08,0x52,0x53,0xd1,0xce,0x64,0xe6,0x12,0x62,0x5a,0xc9,0x36,0xf4,0xa9,0xe9,0x88,0x65,0x19,0xd6,0xe7,0xa6,0x3b,0xc2,0xae,0xbb,0x88,0xfb,0x14,0x04,0xcf,0x04,0x4c,0xc1,0xa0,0x16,0xa7,0x10,0x98,0xb2,0x34,0xaa,0x34,0x61,0x0f,0xc4,0x2a,0x6a,0x9d,0x9c,0xe8,0x6a,0x92,0xc8,0x6a,0xc2,0xa6,0xf4,0x96,0x92,0xba,0x4d,0x2c,0x39,0xe4,0x2f,0x32,0xae,0x4c,0xe4,0x76,0x82,0xcf,0xb0,0xe3,0x2b,0xdc,0x51,0x31,0x9e,0x16,0x2e,0x10,0x9f,0x5a,0x4c,0xdf,0xd1,0xed,0x51,0xad,0xd9,0xa8,0xdf,0x5c,0x97,0x8e,0x3e,0x5a,0x23,0x74,0x37,0xe2,0xa6,0xa0,0x2c,0x9c,0x9e,0x23,0x18,0x09,0x1c,0x97,0x27,0x54,0x7e,0x61,0xaf,0x46,0xd0,0x4e,0xd7,0x2f,0x8f,0x6a,0xb0,0x15,0x3f,0xc4,0x25,0xba,0xb8,0x8b,0x51,0xf0,0xcd,0xf0,0x62,0x42,0x83,0x1e,0xde,0x62,0x2c,0x86,0x65,0x38,0xd2,0x34,0x1c,0x58,0x0e,0x36,0x28,0x4d,0xd3,0x99,0x76,0x4b,0x71,0x86,0x60,0xcb,0xd6,0x60,0x07,0x78,0x0b,0xbd,0x50,0xe5,0x19,0x26,0x88,0xa4,0x52,0xa0,0x8e,0xcb,0xa9,0xee,0x04,0x70,0x4c,0x55,0x81,0x5d,0x05,0x10,0x1e,0xc4,0x47,0x6a,0xde,0x1c,0xcf,0x76,0x28,0x29,0x88,0x1e,0x99,0x02,0x5e,0x19,0x36,0xc0,0x1e,0x80,0x7b,0x97,0xf5,0x42,0xc3,0x60,0x96,0x1e,0x70,0xd5,0x21,0xde,0x44,0x80,0x09,0x5d,0xfa,0xd0,0xce,0xf1,0x25,0x43,0x33,0x61,0x08,0x2c,0xa3,0xf7,0xb8,0x16,0xfe,0xcc,0xfc,0x64,0x85,0x8b,0xa6,0x73,0xf1,0x20,0x95,0x26,0x73,0x63,0x92,0xb8,0xb8,0xfa,0x5d,0xe2,0xa7,0x6f,0x89,0x9c,0x06,0x47,0x3d,0x1a,0x90,0xe2,0xcb,0xfa,0x75,0xb9,0x84,0xbf,0x26,0x83,0x7b,
-0xcc,0x22,0xaa,0x21,0xc9,0x09,0xe0,0xe7,0xfb,0x3b,0xcf,0x1e,0x0a,0x05,0x0a,0x18,0xa9,0xab,0xab,0x8b,0x79,0xa3,0x81,0x0b,0x30,0x93,0x9b,0x52,0xec,0x35,0xf6,0x82,0x61,0x6f,0xb1,0x23,0x1b,0xc4,0x9b,0x05,0x85,0x6b,0x09,0x50,0x6b,0x39,0x50,0x88,0x59,0x9c,0xa6,0xa2,0x11,0x08,0x9e,0xa3,0x29,0xbb,0x40,0x3b,0x7a,0x93,0xc0,0xe4,0x98,0x48,0x14,0xa2,0xb3,0x53,0xc2,0xd8,0xe6,0x5c,0x11,0x81,0x3e,0x6f,0x87,0x82,0x90,0xf5,0x15,0x4b,0x4b,0xf0,0x45,0x8b,0x66,0xc7,0x81,0xe5,0xde,0x97,0x31,0x96,0x71,0xe1,0x7b,0x0e,0xd9,0xd0,0x85,0xdc,0xfe,0xc6,0xfb,0xde,0x27,0x38,0xf2,0xcb,0xdc,0xe4,0xef,0x5e,0x71,0xcc,0x2e,0xef,0x3f,0xff,0xfd,0x2e,0x84,0xdc,0xcf,0x4e,0x63,0x4b,0x96,0xe1,0xda,0x06,0xf4,0xf0,0x50,0x90,0xfd,0x26,0x0f,0xc3,0x91,0x2c,0xc6,0xd0,0x2f,0xd2,0xec,0x4b,0xe8,0xa8,0x4d,0x38,0x99,0xf4,0x25,0x57,0x75,0xec,0x95,0xdf,0x75,0x6e,0x19,0xd9,0xe4,0x8b,0xb4,0x91,0xc5,0x94,0xb1,0x4c,0x93,0x5f,0x51,0x1a,0x58,0xbe,0x45,0xf2,0xc0,0x72,0x69,0x20,0x87,0x00,0x33,0x4d,0x4f,0xee,0x71,0xab,0x44,0xca,0x0f,0xa8,0xa0,0xe2,0xf5,0xb7,0xb0,0xac,0x75,0x97,0x35,0x85,0x93,0x82,0x14,0x81,0x91,0x56,0x64,0x2a,0x23,0x17,0x4c,0x91,0x60,0x42,0x99,0xcd,0xae,0x2c,0xdd,0x98,0x4a,0x34,0x1b,0x93,0x52,0x66,0x65,0x73,0x48,0x54,0x93,0x4f,0xf1,0xe1,0x63,0xa0,0xa8,0x93,0x16,0x6c,0x35,0x05,0xdb,0xe6,0x65,0xdb,0x1f,0x18,0xe2,0x8b,0xa7,0xf8,0x61,0x04,0x88,0x19,0x56,0xf8,0xa7,0x80,0x22,0x49,0xd9,0x85,0xcc,0xff,0x12,0x89,0x07,0x69,0xed,0xad,0xb8,0x76,0xff,0xf8,0x87,0xff,0xc5,0xfb,0xcc,0xae,0xed,0xfc,0xbe,0xf6,0xf8,0x5b,0x78,0xf5,0x28,0xfc,0x9e,0x16,0x7e,0x4b,0x3c,0xc0,0x15,0xdc,0x83,0xfe,0xde,0x17,0xef,0xd3,0xef,0x1f,0x5c,0x3d,0x0a,0xff,0x97,0x51,0x52,0x7a,0xc8,0x10,0x2c,0x0b,0xb0,0x1f,0xb2,0x8f,0x31,0xae,0x3e,0x2b,0x05,0x11,0x82,0x28,0xc2,0x29,0x64,0xf7,0x9c,0x7d,0x3d,0xcd,0x8a,0x41,0xf6,0x9c,0x64,0x92,0x51,0x20,0x15,0x74,0xf4,0x44,0x15,0xd9,0xd7,0x9a,0x69,0xd8,0xe1,0xa6,0x61,0x26,0x84,0x3d,0xda,0x30,0x9f,0xb1,0x8e,0xf0,0x84,0x6a,0x4e,0x95,0x41,0x08,0xb9,0x9a,0x32,0x0a,0x6a,0x0c,0x46,0x66,0x3a,0x3a,0x72,0x36,0xe0,0x30,0xa6,0x6c,0x82,0xea,0xcd,0xe6,0x2b,0x41,0x88,0x29,0xc2,0xf3,0x62,0x30,0x75,0xd2,0x1f,0x7f,0xd8,0x69,0x07,0xb6,0x69,0x82,0xce,0xcd,0xf2,0x6f,0xdf,0x22,0x4f,0x18,0xb1,0x3e,0x61,0xe3,0xea,0x2a,0xe6,0xef,0xc2,0x6b,0x8f,0x0f,0x60,0x06,0x22,0x10,0x0e,0x72,0xa2,0x0f,0x04,0x1f,0x6b,0x01,0xe1,0x05,0x05,0x1b,0x85,0x31,0x37,0xfe,0x20,0x0b,0xae,0xec,0xfc,0xdd,0xad,0x5c,0x74,0x6e,0xef,0xee,0x7e,0x5e,0xf8,0x96,0x88,0x95,0x75,0xec,0x9a,0xe2,0x8b,0x5c,0xf0,0x90,0x92,0x39,0xb4,0xd0,0x92,0x60,0x45,0x4e,0xf8,0x5c,0x0f,0xa7,0xb9,0xb6,0x83,0x86,0xa3,0x4b,0x9c,0x31,0x21,0x3a,0x97,0xa7,0x07,0x56,0x5b,0x39,0xae,0x37,0x94,0x2c,0xd0,0x1d,0xc4,0xb2,0xd3,0xd4,0x1e,0x82,0x66,0xdf,0x0d,0x2a,0x68,0xbe,0x4e,0x45,0x6e,0xfd,0x2b,0x54,0xe8,0x9c,0x5f,0x4c,0x14,0x8f,0x6f,0x6e,0x3d,0x16,0x5f,0xf2,0x20,0x3d,0x46,0xca,0xbf,0x0a,0xde,0x62,0x51,0xdd,0xc1,0x04,0xd1,0xfb,0x1d,0xa4,0x10,0xa3,0xdd,0x4f,0x70,0x13,0x9f,0x3e,0x0b,0x10,0x31,0x51,0xf9,0x81,0xfa,0x04,0xcf,0x7f,0xc8,0x49,0x78,0x36,0xac,0x68,0xae,0x86,0xd5,0x7c,0x39,0x31,0x16,0xa9,0x65,0x13,0x34,0xb1,0x00,0xd0,0x97,0x49,0x3c,0x51,0x54,0xf4,0x11,0x76,0x0d,0x46,0xbf,0xb3,0xed,0xf5,0x99,0xcd,0xea,0x3d,0x51,0x3a,0xbb,0x5b,0xa5,0xa9,0xdd,0x0a,0x1c,0x5a,0xb0,0x53,0x1f,0x0b,0x52,0xc0,0x94,0x77,0x05,0xcf,0x73,0xd2,0x76,0x61,0x79,0x2e,0x99,0xfe,0x36,0x54,0xa0,0xd1,0x30,0x9d,0xdc,0x94,0xba,0xf6,0x87,0x0a,0x9f,0xbd,0xc4,0x83,0xed,0x7b,0x07,0x54,0xfb,0x3c,0x29,0x78,0x84,0x8c,0x7f,0x52,0x84,0x1a,0x02,0xd4,0x90,0x7d,0xc7,0xa7,0x86,0x00,0x35,0xce,0x03,0x79,0xa4,0xd1,0x88,0x02,0xd1,0x90,0x17,0x98,0x5e,0x02,0x73,0xf7,0x98,0xca,0x9f,0x81,0x3c,0x05,0x16,0xb4,0xac,0x12,0xe1,0x42,0x87,0x7a,0x79,0x60,0x08,0x22,0x6a,0x1d,0xcc,0x51,0xd1,0x01,0x5a,0xbb,0x2e,0x04,0x76,0xf4,0x45,0xb3,0x6b,0x5e,0x59,0x01,0x9f,0xb2,0x85,0x79,0x33,0x11,0x71,0x61,0x28,0x02,0xfa,0x9f,0xc9,0xb1,0x30,0xaf,0x7a,0x8a,0x7c,0x11,0xc8,0xd7,0xa3,0xe4,0xeb,0x48,0x7e,0x5c,0x54,0x1e,0xae,0x49,0x84,0x29,0xc1,0xb2,0x50,0x7b,0x3b,0x7d,0x74,0xb1,0x88,0x4e,0x61,0x6f,0x21,0x09,0xf8,0x32,0x13,0x8c,0xb2,0xe2,0x75,0x7b,0xe0,0xcb,0x2d,0x65,0x01,0x03,0x10,0x47,0x81,0x27,0x1b,0x5e,0xa2,0x7b,0x66,0x95,0xe8,0xdd,0x25,0xfe,0xe3,0x47,0x73,0x3a,0x73,0x73,0xd2,0x1f,0xce,0xf3,0x32,0xdd,0x9f,0x94,0x00,0x67,0xce,0xe1,0xa9,0x49,0xa3,0x8f,0x45,0x3f,0x78,0xf3,0x10,0xfa,0x38,0x21,0x0d,0x5e,0xfd,0x84,0x3d,0x45,0xc8,0xb7,0xb8,0xa3,0xde,0x48,0xfb,0x6e,0x9c,0xa7,0x11,0xb8,0xe6,0x91,0x64,0x2d,0x3e,0x3f,0xef,0x10,0xd0,0xa8,0xa0,0x50,0x13,0x4b,0x0e,0x46,0xc3,0x33,0x51,0x16,0xe8,0x24,0x1e,0x44,0xb2,0xfd,0x98,0x14,0x49,0x2e,0xb9,0x01,0x7f,0x79,0xf8,0x13,0x89,0x28,0x0a,0x80,0x0c,0x2d,0xfc,0x4c,0x64,0x1e,0xb2,0x62,0xfe,0x31,0x33,0x48,0x91,0xc2,0x41,0x82,0xfc,0xaf,0x67,0x4d,0x4c,0xc7,0x40,0xb0,0xd7,0xa0,0xa4,0x0d,0x8d,0x66,0x4d,0xec,0x04,0x46,0xc3,0x37,0x8a,0xee,0xe4,0x8b,0x96,0x25,0x4d,0x12,0xa2,0x80,0xe7,0x61,0xab,0xe2,0xe6,0xc1,0x01,0xc9,0x6c,0x08,0x69,0xc7,0x68,0x50,0x8d,0x92,0x10,0xb7,0x40,0x9d,0x04,0xc8,0xcd,0x07,0x7d,0xe5,0xfa,0x45,0x89,0xed,0x99,0x2a,0xf8,0x9c,0x10,0x6c,0x46,0x0f,0x25,0x17,0x12,0x35,0xf3,0x3a,0x26,0x61,0xf1,0xa1,
-0x8c,0xd7,0x65,0xe6,0x0c,0x66,0x59,0xaa,0x8c,0x7c,0x04,0x8f,0x7c,0x1a,0x5a,0xe4,0x95,0x57,0x4b,0x40,0x06,0x92,0xf6,0x59,0xb0,0xb4,0x58,0x74,0x09,0x40,0x6c,0x9f,0x86,0x35,0x1b,0xc8,0xfe,0xb0,0xee,0x52,0x82,0x5f,0xad,0x8d,0xf1,0xd0,0xc8,0x4c,0x0a,0x62,0xc1,0xa1,0x1d,0x5b,0xab,0xd4,0x74,0x24,0x31,0x43,0x73,0xdc,0xe0,0x29,0x36,0xc5,0x8f,0x7b,0xf7,0x0d,0xcf,0x97,0x28,0x0c,0xc8,0x8b,0xd4,0x1c,0x0b,0x7b,0x71,0xd2,0x1a,0xa5,0x63,0x7a,0x0b,0xce,0x1e,0x16,0x2e,0xa6,0x63,0xe9,0xb8,0xd0,0xde,0xa6,0x22,0x69,0xc6,0x54,0x24,0x49,0x05,0xa4,0xee,0x67,0xbc,0x3a,0xa1,0xfd,0x8c,0x57,0xcf,0x37,0x74,0x34,0xf5,0xe0,0xff,0x01,0xef,0x2c,0xda,0xd8,0x60,0xfc,0x01,0x00
-};
\ No newline at end of file
@@ -13,62 +13,101 @@
  * Copyright (c) 2016 - 2021 Sacha Telgenhof
  */
 
+/**
+ * @brief Publish the MQTT discovery message for Home Assistant
+ *
+ * @param qos the QoS level
+ * @param retain whether the message is to be retained by the broker
+ *
+ * @return false if the message could not be sent (yet), otherwise true
+ */
+bool publishDiscovery(uint8_t qos, bool retain) {
+  static const int BUFFER_SIZE =
+      JSON_OBJECT_SIZE(11) + JSON_ARRAY_SIZE(EFFECT_NAMED) +
+      JSON_ARRAY_SIZE(4) +
+      128; // '128' is an arbritrary number. Increase if required by the
+           // payload
+  StaticJsonBuffer<BUFFER_SIZE> mqttJsonBuffer;
+  JsonObject &md_root = mqttJsonBuffer.createObject();
+
+  md_root["name"] = cfg.hostname;
+#ifdef MQTT_HOMEASSISTANT_DISCOVERY_PRE_0_84
+  md_root["platform"] = "mqtt_json";
+#else
+  md_root["platform"] = "mqtt";
+  md_root["schema"] = "json";
+#endif
+  md_root["state_topic"] = cfg.mqtt_state_topic;
+  md_root["command_topic"] = cfg.mqtt_command_topic;
+#if MQTT_HOMEASSISTANT_COLOR_MODES
+  // Hue/saturation and CIE xy colours are converted by the light (see
+  // ColorSpace.hpp)
+  md_root[KEY_COLOR_MODE] = true;
+  JsonArray &color_modes = md_root.createNestedArray("supported_color_modes");
+  color_modes.add(KEY_COLORTEMP);
+  color_modes.add("hs");
+  color_modes.add("rgbw");
+  color_modes.add("xy");
+#else
+  md_root["rgb"] = true;
+  md_root[KEY_COLORTEMP] = true;
+  md_root[KEY_WHITE] = true;
+#endif
+  md_root[KEY_BRIGHTNESS] = true;
+  md_root[KEY_EFFECT] = true;
+  md_root["availability_topic"] = cfg.mqtt_lwt_topic;
+
+  JsonArray &effect_list = md_root.createNestedArray("effect_list");
+  for (uint8_t i = 0; i < EFFECT_NAMED; i++) {
+    effect_list.add(SequencerClass::getEffectName(i));
+  }
+
+  // Build the payload
+  char md_buffer[md_root.measureLength() + 1];
+  md_root.printTo(md_buffer, sizeof(md_buffer));
+
+  // The topic for HA MQTT discovery (see buildTopics())
+  if (!mqttPublish(topics.discovery, md_buffer, qos, retain)) {
+    return false;
+  }
+
+  cfg.mqtt_ha_is_discovered = true;
+  saveConfig();
+
+  return true;
+}
+
 /**
  * @brief Handle the various MQTT Events (Connect, Disconnect, etc.)
  *
  * @param type the MQTT event type (e.g. 'connect', 'message', etc.)
  * @param topic the MQTT topic to which the message has been published
  * @param payload the contents/message that has been published
+ * @param length the length of the message
  */
-void deviceMQTTCallback(uint8_t type, const char *topic, const char *payload) {
+void deviceMQTTCallback(uint8_t type, const char *topic, const char *payload,
+                        size_t length) {
 
   // Handling the event of connecting to the MQTT broker
   if (type == MQTT_EVENT_CONNECT) {
     mqttSubscribe(cfg.mqtt_command_topic);
-    mqttPublish(cfg.mqtt_lwt_topic, MQTT_STATUS_ONLINE);
+    if (os_strlen(cfg.mqtt_group_topic) > 0) {
+      mqttSubscribe(cfg.mqtt_group_topic);
+    }
 
-    // MQTT discovery for Home Assistant
+    // MQTT discovery for Home Assistant (the availability and state are
+    // replayed by the publish queue)
     if (cfg.mqtt_ha_use_discovery && !cfg.mqtt_ha_is_discovered) {
-      static const int BUFFER_SIZE =
-          JSON_OBJECT_SIZE(9) + 128; // '128' is an arbritrary number. Increase
-                                     // if required by the payload
-      StaticJsonBuffer<BUFFER_SIZE> mqttJsonBuffer;
-      JsonObject &md_root = mqttJsonBuffer.createObject();
-
-      md_root["name"] = cfg.hostname;
-#ifdef MQTT_HOMEASSISTANT_DISCOVERY_PRE_0_84
-      md_root["platform"] = "mqtt_json";
-#else
-      md_root["platform"] = "mqtt";
-      md_root["schema"] = "json";
-#endif
-      md_root["state_topic"] = cfg.mqtt_state_topic;
-      md_root["command_topic"] = cfg.mqtt_command_topic;
-      md_root["rgb"] = true;
-      md_root[KEY_COLORTEMP] = true;
-      md_root[KEY_BRIGHTNESS] = true;
-      md_root[KEY_WHITE] = true;
-      md_root["availability_topic"] = cfg.mqtt_lwt_topic;
-
-      // Build the payload
-      char md_buffer[md_root.measureLength() + 1];
-      md_root.printTo(md_buffer, sizeof(md_buffer));
-
-      // Construct the topic name for HA MQTT discovery
-      char *dc_topic = new char[128];
-      sprintf_P(dc_topic, PSTR("%s/light/%s/config"), cfg.mqtt_ha_disc_prefix,
-                cfg.hostname);
-
-      mqttPublish(dc_topic, md_buffer);
-
-      cfg.mqtt_ha_is_discovered = true;
-      EEPROM_write(cfg);
+      mqttQueue(MQTT_TOPIC_DISCOVERY);
     }
   }
 
   // Handling the event of disconnecting from the MQTT broker
   if (type == MQTT_EVENT_DISCONNECT) {
     mqttUnsubscribe(cfg.mqtt_command_topic);
+    if (os_strlen(cfg.mqtt_group_topic) > 0) {
+      mqttUnsubscribe(cfg.mqtt_group_topic);
+    }
   }
 
   // Handling the event a message is received from the MQTT broker
@@ -77,25 +116,15 @@ void deviceMQTTCallback(uint8_t type, const char *topic, const char *payload) {
     // Listen to this lights' MQTT command topic
     if (os_strcmp(topic, cfg.mqtt_command_topic) == 0) {
 
-      // Convert payload into char variable
-      uint8_t length = os_strlen(payload);
-      char message[length + 1];
-      os_memcpy(message, payload, length);
-      message[length] = 0;
-
-      if (!processJson(message)) {
-        return;
-      }
-
-      // Store light parameters for persistence
-      cfg.is_on = AiLight->getState();
-      cfg.brightness = AiLight->getBrightness();
-      cfg.color_temp = AiLight->getColorTemperature();
-      cfg.color = {AiLight->getColor().red, AiLight->getColor().green,
-                   AiLight->getColor().blue, AiLight->getColor().white};
-
-      EEPROM_write(cfg);
-      sendState(); // Notify subscribers about the new state
+      // Processed by loopLight()
+      processJson(payload, length, RECORD_SOURCE_MQTT);
+    }
+
+    // Listen to the group command topic (if any)
+    if (os_strlen(cfg.mqtt_group_topic) > 0 &&
+        os_strcmp(topic, cfg.mqtt_group_topic) == 0) {
+
+      processGroupJson(payload, length); // Processed by loopGroup()
     }
   }
 }
@@ -104,197 +133,113 @@ void deviceMQTTCallback(uint8_t type, const char *topic, const char *payload) {
  * @brief Publish the current state of the AiLight
  */
 void sendState() {
-  StaticJsonBuffer<BUFFER_SIZE> jsonBuffer;
-  JsonObject &root = jsonBuffer.createObject();
+  uint32_t start = ESP.getCycleCount();
+  getStatePayload(); // Rendered once, shared by all subscribers
+
+  // Notify all MQTT subscribers (rate limited, see loopMQTT())
+  mqttQueue(MQTT_TOPIC_STATE);
 
-  createStateJSON(root);
+  // Notify all WebSocket clients (throttled, see loopWebSocket())
+  wsPushPending = true;
 
-  char buffer[root.measureLength() + 1];
-  root.printTo(buffer, sizeof(buffer));
+  // Notify all Server-Sent Events clients (throttled, see loopEvents())
+  eventsPushPending = true;
 
-  mqttPublish(cfg.mqtt_state_topic, buffer); // Notify all MQTT subscribers
-  ws.textAll(buffer);                        // Notify all WebSocket clients
+  recordStage(METRICS_STAGE_PUBLISH, start);
 }
 
 /**
- * @brief Process the received JSON payload
+ * @brief Decode a received JSON payload into a light command
+ *
+ * @param payload the JSON payload (does not need to be NUL terminated)
+ * @param length the length of the JSON payload
+ * @param command the structure to hold the decoded command
+ * @param source the source of the payload (RECORD_SOURCE_*)
+ *
+ * @return true if the payload is a valid light command, otherwise false
  */
-bool processJson(char *message) {
-  StaticJsonBuffer<BUFFER_SIZE> jsonBuffer;
-  JsonObject &root = jsonBuffer.parseObject(message);
-
-  if (!root.success()) {
-    DEBUGLOG("[LIGHT] Unable to parse message\n");
-    return false;
-  }
-
-  // Flash
-  if (root.containsKey(KEY_FLASH)) {
-
-    // Save current settings to be restored later
-    currentColor = AiLight->getColor();
-    currentBrightness = AiLight->getBrightness();
-    currentState = AiLight->getState();
-
-    flashLength = (uint16_t)root[KEY_FLASH] * 1000U;
-
-    flashBrightness = (root.containsKey(KEY_BRIGHTNESS)) ? root[KEY_BRIGHTNESS]
-                                                         : currentBrightness;
-
-    if (root.containsKey(KEY_COLOR)) {
-      flashColor = {root[KEY_COLOR][KEY_COLOR_R], root[KEY_COLOR][KEY_COLOR_G],
-                    root[KEY_COLOR][KEY_COLOR_B]};
-    } else {
-      flashColor = {currentColor.red, currentColor.green, currentColor.blue};
-    }
-
-    flashColor.red = map(flashColor.red, 0, 255, 0, flashBrightness);
-    flashColor.green = map(flashColor.green, 0, 255, 0, flashBrightness);
-    flashColor.blue = map(flashColor.blue, 0, 255, 0, flashBrightness);
-
-    flash = true;
-    startFlash = true;
-  } else {
-    flash = false;
-  }
-
-  if (root.containsKey(KEY_TRANSITION)) {
-    transitionTime = root[KEY_TRANSITION]; // Time in seconds
-    startTransTime = millis();
-  } else {
-    transitionTime = 0;
+bool decodeCommand(const char *payload, size_t length,
+                   light_command_t &command, uint8_t source) {
+  uint32_t start = ESP.getCycleCount();
+  command_result_t result = LightCommands.decode(payload, length, command);
+  recordStage(METRICS_STAGE_PARSE, start);
+
+  // Record the payloads of light commands (invalid ones included), but not
+  // the settings of the Web UI (holding passwords)
+  bool settings = (result == COMMAND_OK) && (command.fields & COMMAND_OTHER) &&
+                  (source == RECORD_SOURCE_WEBSOCKET ||
+                   (command.fields & ~COMMAND_OTHER) == 0);
+  if (!settings) {
+    Recorder.record(millis(), source, payload, length);
   }
 
-  if (root.containsKey(KEY_BRIGHTNESS)) {
-
-    // In transition/fade
-    if (transitionTime > 0) {
-      transBrightness = root[KEY_BRIGHTNESS];
+  return result == COMMAND_OK;
+}
 
-      // If light is off, start fading from Zero
-      if (!AiLight->getState()) {
-        AiLight->setBrightness(0);
-      }
+/**
+ * @brief Decode the received JSON payload and queue it for processing
+ *
+ * @param payload the JSON payload (does not need to be NUL terminated)
+ * @param length the length of the JSON payload
+ * @param source the source of the payload (RECORD_SOURCE_*)
+ *
+ * @return true if the payload has been queued, otherwise false
+ */
+bool processJson(const char *payload, size_t length, uint8_t source) {
+  light_command_t command;
 
-      stepBrightness = calculateStep(AiLight->getBrightness(), transBrightness);
-      stepCount = 0;
-    } else {
-      AiLight->setBrightness(root[KEY_BRIGHTNESS]);
-    }
+  if (!decodeCommand(payload, length, command, source)) {
+    DEBUGLOG("[LIGHT] Unable to parse message\n");
+    return false;
   }
 
-  if (root.containsKey(KEY_COLOR)) {
-
-    // In transition/fade
-    if (transitionTime > 0) {
-      transColor.red = root[KEY_COLOR][KEY_COLOR_R];
-      transColor.green = root[KEY_COLOR][KEY_COLOR_G];
-      transColor.blue = root[KEY_COLOR][KEY_COLOR_B];
-
-      // If light is off, start fading from Zero
-      if (!AiLight->getState()) {
-        AiLight->setColor(0, 0, 0);
-      }
-
-      stepR = calculateStep(AiLight->getColor().red, transColor.red);
-      stepG = calculateStep(AiLight->getColor().green, transColor.green);
-      stepB = calculateStep(AiLight->getColor().blue, transColor.blue);
-
-      stepCount = 0;
-    } else {
-      AiLight->setColor(root[KEY_COLOR][KEY_COLOR_R],
-                        root[KEY_COLOR][KEY_COLOR_G],
-                        root[KEY_COLOR][KEY_COLOR_B]);
-    }
-  }
+  return queueCommand(command);
+}
 
-#ifdef MQTT_OPENHAB_SUPPORT
-  if (root.containsKey(KEY_COLOR_ARRAY)) {
-
-    // In transition/fade
-    if (transitionTime > 0) {
-      transColor.red = root[KEY_COLOR_ARRAY][0];
-      transColor.green = root[KEY_COLOR_ARRAY][1];
-      transColor.blue = root[KEY_COLOR_ARRAY][2];
-
-      // If light is off, start fading from Zero
-      if (!AiLight->getState()) {
-        AiLight->setColor(0, 0, 0);
-      }
-
-      stepR = calculateStep(AiLight->getColor().red, transColor.red);
-      stepG = calculateStep(AiLight->getColor().green, transColor.green);
-      stepB = calculateStep(AiLight->getColor().blue, transColor.blue);
-
-      stepCount = 0;
-    } else {
-      AiLight->setColor(root[KEY_COLOR_ARRAY][0],
-                        root[KEY_COLOR_ARRAY][1],
-                        root[KEY_COLOR_ARRAY][2]);
+/**
+ * @brief Queue a (decoded) light command for processing by the main loop
+ *
+ * @param command the light command to queue
+ *
+ * @return true if the command has been queued, false if the queue is full
+ */
+bool queueCommand(const light_command_t &command) {
+  // An uploaded effect program is handed over separately
+  if (command.fields & COMMAND_PROGRAM) {
+    size_t length;
+    const uint8_t *program = LightCommands.getProgram(length);
+
+    if (!Sequencer.post(program, length)) {
+      DEBUGLOG("[LIGHT] Effect program pending, command dropped\n");
+      return false;
     }
   }
-#endif
-
-  if (root.containsKey(KEY_WHITE)) {
-    // In transition/fade
-    if (transitionTime > 0) {
-      transColor.white = root[KEY_WHITE];
-
-      // If light is off, start fading from Zero
-      if (!AiLight->getState()) {
-        AiLight->setWhite(0);
-      }
-
-      stepW = calculateStep(AiLight->getColor().white, transColor.white);
 
-      stepCount = 0;
-    } else {
-      AiLight->setWhite(root[KEY_WHITE]);
+  if (!CommandQueue.push(command, micros())) {
+    if (command.fields & COMMAND_PROGRAM) {
+      Sequencer.discard();
     }
-  }
-
-  if (root.containsKey(KEY_COLORTEMP)) {
-    // In transition/fade
-    if (transitionTime > 0) {
-      transColor = AiLight->colorTemperature2RGB(root[KEY_COLORTEMP]);
-
-      // If light is off, start fading from Zero
-      if (!AiLight->getState()) {
-        AiLight->setColor(0, 0, 0);
-      }
-
-      stepR = calculateStep(AiLight->getColor().red, transColor.red);
-      stepG = calculateStep(AiLight->getColor().green, transColor.green);
-      stepB = calculateStep(AiLight->getColor().blue, transColor.blue);
 
-      stepCount = 0;
-    } else {
-      AiLight->setColorTemperature(root[KEY_COLORTEMP]);
-    }
+    DEBUGLOG("[LIGHT] Command queue full, command dropped\n");
+    return false;
   }
 
-  if (root.containsKey(KEY_STATE)) {
-    state = (os_strcmp(root[KEY_STATE], MQTT_PAYLOAD_ON) == 0) ? true : false;
-
-    if (transitionTime > 0 && !state) {
-      transColor.red = 0;
-      transColor.green = 0;
-      transColor.blue = 0;
+  return true;
+}
 
-      stepR = calculateStep(AiLight->getColor().red, transColor.red);
-      stepG = calculateStep(AiLight->getColor().green, transColor.green);
-      stepB = calculateStep(AiLight->getColor().blue, transColor.blue);
-    } else {
-      AiLight->setState(state);
-    }
-  }
+/**
+ * @brief Process a (decoded) light command
+ *
+ * @param command the light command to process
+ */
+void processCommand(const light_command_t &command) {
+  uint32_t start = ESP.getCycleCount();
 
-  if (root.containsKey(KEY_GAMMA_CORRECTION)) {
-    bool use_gamma_correction = root[KEY_GAMMA_CORRECTION];
-    AiLight->useGammaCorrection(use_gamma_correction);
+  if (!LightController.process(command, millis())) {
+    DEBUGLOG("[LIGHT] Unable to start effect\n");
   }
 
-  return true;
+  recordStage(METRICS_STAGE_APPLY, start);
 }
 
 /**
@@ -312,7 +257,7 @@ void createAboutJSON(JsonObject &object) {
   object["memory"] = ESP.getFlashChipSize();
   object["free_heap"] = ESP.getFreeHeap();
   object["cpu_frequency"] = ESP.getCpuFreqMHz();
-  object["led_driver"] = led_driver_table[cfg.chip_type];
+  object["led_driver"] = led_driver_table[cfg.fixture.chain[0].model];
   object["device_ip"] = (WiFi.getMode() == WIFI_AP) ? WiFi.softAPIP().toString()
                                                     : WiFi.localIP().toString();
   object["mac"] = WiFi.macAddress();
@@ -320,57 +265,41 @@ void createAboutJSON(JsonObject &object) {
   object["core"] = getESPCoreVersion();
 }
 
-/**
- * @brief Populate the given JsonObject with the current state of this light
- *
- * @param object the JsonObject that will hold the current state of this light
- */
-void createStateJSON(JsonObject &object) {
-  object[KEY_STATE] = AiLight->getState() ? MQTT_PAYLOAD_ON : MQTT_PAYLOAD_OFF;
-  object[KEY_BRIGHTNESS] = AiLight->getBrightness();
-  object[KEY_WHITE] = AiLight->getColor().white;
-  object[KEY_COLORTEMP] = AiLight->getColorTemperature();
-
-  JsonObject &color = object.createNestedObject(KEY_COLOR);
-  color[KEY_COLOR_R] = AiLight->getColor().red;
-  color[KEY_COLOR_G] = AiLight->getColor().green;
-  color[KEY_COLOR_B] = AiLight->getColor().blue;
-
-#ifdef MQTT_OPENHAB_SUPPORT
-  JsonArray &color_array = object.createNestedArray(KEY_COLOR_ARRAY);
-  color_array.add(AiLight->getColor().red);
-  color_array.add(AiLight->getColor().green);
-  color_array.add(AiLight->getColor().blue);
-#endif
-
-  object[KEY_GAMMA_CORRECTION] = AiLight->hasGammaCorrection();
-}
-
 /**
  * @brief Bootstrap function for the RGBW light
  */
 void setupLight() {
 
   // Restore last used settings (Note: set colour temperature first as it
-  // changed the RGB channels!)
-  AiLight->setColorTemperature(cfg.color_temp);
-  AiLight->setColor(cfg.color.red, cfg.color.green, cfg.color.blue);
-  AiLight->setWhite(cfg.color.white);
-  AiLight->setBrightness(cfg.brightness);
-  AiLight->useGammaCorrection(cfg.gamma);
+  // changed the RGB channels!). All settings are sent as a single frame, right
+  // away rather than by the first main loop iteration (after the WiFi, MQTT
+  // and web server setup).
+  light_state_t restore = loadLightState();
+
+  AiLight->begin();
+  AiLight->setColorTemperature(restore.color_temp);
+  AiLight->setColor(restore.red, restore.green, restore.blue);
+  AiLight->setWhite(restore.white);
+  AiLight->setBrightness(restore.brightness);
+  AiLight->useGammaCorrection(restore.gamma);
 
   switch (cfg.powerup_mode) {
   case POWERUP_ON:
     AiLight->setState(true);
     break;
   case POWERUP_SAME:
-    AiLight->setState(cfg.is_on);
+    AiLight->setState(restore.is_on);
     break;
   case POWERUP_OFF:
   default:
     AiLight->setState(false);
     break;
   }
+  AiLight->commit();
+  AiLight->transmit();
+  recordBootPhase(BOOT_PHASE_LIGHT);
+
+  Sequencer.seed(RANDOM_REG32);
 
   mqttRegister(deviceMQTTCallback);
 }
@@ -380,136 +309,35 @@ void setupLight() {
  */
 void loopLight() {
 
-  // Flashing
-  if (flash) {
-    if (startFlash) {
-      startFlash = false;
-      flashStartTime = millis();
-      AiLight->setState(false);
-    }
+  // Queued commands (merged, so a burst of commands is a single change)
+  light_command_t command;
+  if (CommandQueue.pop(command, micros(), LIGHT_COMMAND_BUDGET)) {
+    metrics.stages[METRICS_STAGE_QUEUE].record(CommandQueue.getLatency());
 
-    // Run the flash sequence for the defined period.
-    if ((millis() - flashStartTime) <= (flashLength - 100U)) {
-      if ((millis() - flashStartTime) % 1000 <= 500) {
-        AiLight->setColor(flashColor.red, flashColor.green, flashColor.blue);
-        AiLight->setBrightness(flashBrightness);
-        AiLight->setState(true);
-      } else {
-        AiLight->setState(false);
-      }
-    } else {
-      // Return to the state before the flash
-      flash = false;
-
-      AiLight->setState(currentState);
-      AiLight->setColor(currentColor.red, currentColor.green,
-                        currentColor.blue);
-      AiLight->setBrightness(currentBrightness);
-
-      sendState(); // Notify subscribers again about current state
-    }
-  }
+    processCommand(command);
 
-  // Transitioning/Fading
-  if (transitionTime > 0) {
-    AiLight->setState(true);
+    storeLightState(); // Store light parameters for persistence
+    sendState();       // Notify subscribers about the new state
 
-    uint32_t currentTransTime = millis();
-
-    // Cross fade the RGBW channels every millisecond
-    if (currentTransTime - startTransTime > transitionTime) {
-      if (stepCount <= 1000) {
-        startTransTime = currentTransTime;
-
-        // Transition/fade RGB LEDS (if level is different from current)
-        if (stepR != 0 || stepG != 0 || stepB != 0) {
-          AiLight->setColor(calculateLevel(stepR, AiLight->getColor().red,
-                                           stepCount, transColor.red),
-                            calculateLevel(stepG, AiLight->getColor().green,
-                                           stepCount, transColor.green),
-                            calculateLevel(stepB, AiLight->getColor().blue,
-                                           stepCount, transColor.blue));
-        }
-
-        // Transition/fade white LEDS (if level is different from current)
-        if (stepW != 0) {
-          AiLight->setWhite(calculateLevel(stepW, AiLight->getColor().white,
-                                           stepCount, transColor.white));
-        }
-
-        // Transition/fade brightness (if level is different from current)
-        if (stepBrightness != 0) {
-          AiLight->setBrightness(calculateLevel(stepBrightness,
-                                                AiLight->getBrightness(),
-                                                stepCount, transBrightness));
-        }
-
-        stepCount++;
-      } else {
-        transitionTime = 0;
-        stepCount = 0;
-        AiLight->setState(state);
-
-        sendState(); // Notify subscribers again about current state
-
-        // Update settings
-        cfg.is_on = AiLight->getState();
-        cfg.brightness = AiLight->getBrightness();
-        cfg.color = {AiLight->getColor().red, AiLight->getColor().green,
-                     AiLight->getColor().blue, AiLight->getColor().white};
-        EEPROM_write(cfg);
-      }
-    }
+    DEBUGLOG("[LIGHT] Processed command (latency: %u us)\n",
+             CommandQueue.getLatency());
   }
-}
 
-/**
- * @brief Determines the step needed to change to the target value
- *
- * @param currentLevel the current level
- * @param targetLevel the target level
- *
- * @return the step value needed to change to the target value
- */
-int16_t calculateStep(uint8_t currentLevel, uint8_t targetLevel) {
-  int16_t step = targetLevel - currentLevel;
-  if (step) {
-    step = 1000 / step;
-  }
+  // Effects (including flash) and transitions/fades
+  if (LightController.update(millis()) & CONTROLLER_SETTLED) {
+    sendState(); // Notify subscribers again about current state
 
-  return step;
+    storeLightState(); // Store light parameters for persistence
+  }
 }
 
 /**
- * @brief Calculates the next level of a channel (RGBW/Brightness)
- *
- * @param step the step needed for changing to the target value
- * @param val the current value in the transitioning loop
- * @param i the current index in the transitioning loop
- * @param targetLevel the target level
- *
- * @return the next level of a channel (RGBW/Brightness)
+ * @brief Send the pending frame to the LED driver (at most at the refresh rate)
  */
-uint8_t calculateLevel(int step, int val, uint16_t i, uint8_t targetLevel) {
-  if ((step) && i % step == 0) {
-    if (step > 0) {
-      val++;
-
-      // Prevent overshooting the target level
-      if (val > targetLevel) {
-        val = targetLevel;
-      }
-    } else if (step < 0) {
-      val--;
-
-      // Prevent undershooting the target level
-      if (val < targetLevel) {
-        val = targetLevel;
-      }
-    }
-  }
-
-  val = constrain(val, 0, MY92XX_LEVEL_MAX); // Force boundaries
+void loopOutput() {
+  uint32_t start = ESP.getCycleCount();
 
-  return val;
+  if (AiLight->output(micros())) {
+    recordStage(METRICS_STAGE_DRIVER, start);
+  }
 }
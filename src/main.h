@@ -36,6 +36,10 @@
 #define MQTT_HOMEASSISTANT_DISCOVERY_PRE_0_84 false
 #endif
 
+#ifndef MQTT_HOMEASSISTANT_COLOR_MODES
+#define MQTT_HOMEASSISTANT_COLOR_MODES true
+#endif
+
 #ifndef KEY_COLOR_ARRAY
 #define KEY_COLOR_ARRAY "color_array"
 #endif
@@ -52,8 +56,129 @@
 #define WIFI_RECONNECT_TIMEOUT 10
 #endif
 
+#ifndef WIFI_CONNECT_TIMEOUT
+#define WIFI_CONNECT_TIMEOUT 10000
+#endif
+
+#ifndef WIFI_CACHE_TIMEOUT
+#define WIFI_CACHE_TIMEOUT 3000
+#endif
+
+#ifndef WIFI_CACHE_IP
+#define WIFI_CACHE_IP false
+#endif
+
+#ifndef LIGHT_TRANSITION_EASING
+#define LIGHT_TRANSITION_EASING EASING_LINEAR
+#endif
+
+#ifndef LIGHT_STATE_SAVE_DELAY
+#define LIGHT_STATE_SAVE_DELAY 5000
+#endif
+
+#ifndef LIGHT_STATE_SECTORS
+#define LIGHT_STATE_SECTORS 2
+#endif
+
+#ifndef LIGHT_COMMAND_BUDGET
+#define LIGHT_COMMAND_BUDGET 8
+#endif
+
+#ifndef LIGHT_REFRESH_RATE
+#define LIGHT_REFRESH_RATE 100
+#endif
+
+#ifndef REALTIME_ENABLED
+#define REALTIME_ENABLED false
+#endif
+
+#ifndef REALTIME_PORT
+#define REALTIME_PORT DDP_PORT
+#endif
+
+#ifndef REALTIME_OFFSET
+#define REALTIME_OFFSET 0
+#endif
+
+#ifndef REALTIME_CHANNELS
+#define REALTIME_CHANNELS REALTIME_CHANNELS_RGB
+#endif
+
+#ifndef REALTIME_TIMEOUT
+#define REALTIME_TIMEOUT 2500
+#endif
+
+#ifndef RECORDER_SIZE
+#define RECORDER_SIZE 0
+#endif
+
+#ifndef METRICS_TELEMETRY_INTERVAL
+#define METRICS_TELEMETRY_INTERVAL 0
+#endif
+
+#ifndef GROUP_MULTICAST_ADDRESS
+#define GROUP_MULTICAST_ADDRESS 239, 255, 65, 76
+#endif
+
+#ifndef GROUP_PORT
+#define GROUP_PORT 4049
+#endif
+
+#ifndef GROUP_START_DELAY
+#define GROUP_START_DELAY 150
+#endif
+
+#ifndef MQTT_PUBLISH_INTERVAL
+#define MQTT_PUBLISH_INTERVAL 250
+#endif
+
+#ifndef MQTT_MESSAGE_SIZE
+#define MQTT_MESSAGE_SIZE 1536
+#endif
+
+#ifndef WS_PUSH_RATE
+#define WS_PUSH_RATE 20
+#endif
+
+#ifndef WS_CLIENTS_MAX
+#define WS_CLIENTS_MAX 4
+#endif
+
+#ifndef EVENTS_PUSH_RATE
+#define EVENTS_PUSH_RATE 4
+#endif
+
+#ifndef EVENTS_TELEMETRY_INTERVAL
+#define EVENTS_TELEMETRY_INTERVAL 10
+#endif
+
+#ifndef API_BATCH_SIZE
+#define API_BATCH_SIZE 2048
+#endif
+
+#ifndef API_BATCH_COMMANDS
+#define API_BATCH_COMMANDS 16
+#endif
+
+#ifndef WS_MESSAGE_SIZE
+#define WS_MESSAGE_SIZE 1536
+#endif
+
 #include "AiLight.hpp"
 #include "ArduinoOTA.h"
+#include "Command.hpp"
+#include "CommandQueue.hpp"
+#include "ConfigStore.hpp"
+#include "Controller.hpp"
+#include "GroupSync.hpp"
+#include "Histogram.hpp"
+#include "PublishQueue.hpp"
+#include "Realtime.hpp"
+#include "Recorder.hpp"
+#include "SPIFlashStorage.hpp"
+#include "Sequencer.hpp"
+#include "StateStore.hpp"
+#include "Transition.hpp"
 #include <ArduinoJson.h>
 #include <AsyncMqttClient.h>
 #include <EEPROM.h>
@@ -68,34 +193,82 @@
 
 extern "C" {
 #include "spi_flash.h"
+#include "umm_malloc/umm_malloc.h"
 }
 
-#include "html.gz.h"
+extern "C" uint32_t _SPIFFS_end;
+
+// A Web UI asset (see assets.h)
+struct web_asset_t {
+  const char *route;   // Route the asset is served at
+  const char *mime;    // MIME type
+  const char *etag;    // Hash of the content (quoted, as sent in the ETag)
+  const uint8_t *data; // Content (in PROGMEM)
+  size_t length;       // Length of the content
+  bool gzip;           // Content is compressed (gzip)
+  bool immutable;      // Route holds the hash (so the content never changes)
+};
+
+#include "assets.h"
+#include "configuration.h"
+#include "statepush.h"
 
 #define EEPROM_START_ADDRESS 0
-#define INIT_HASH 0x5F
-#ifndef MQTT_OPENHAB_ENABLED
-static const int BUFFER_SIZE = JSON_OBJECT_SIZE(10);
-#else
-static const int BUFFER_SIZE = JSON_OBJECT_SIZE(13);
-#endif
+#define TELEMETRY_PAYLOAD_SIZE 256
+#define REALTIME_PACKET_BUDGET 8
+#define GROUP_PACKET_BUDGET 4
+
+// Stages of processing a light command (as measured by the metrics)
+#define METRICS_STAGE_PARSE 0   // Decoding the command
+#define METRICS_STAGE_QUEUE 1   // Waiting in the command queue
+#define METRICS_STAGE_APPLY 2   // Processing the command
+#define METRICS_STAGE_DRIVER 3  // Updating the LED driver
+#define METRICS_STAGE_PUBLISH 4 // Publishing the new state
+#define METRICS_STAGES 5
+
+// Boot phases (as recorded by the metrics)
+#define BOOT_PHASE_SETUP 0 // setup() entered
+#define BOOT_PHASE_LIGHT 1 // Power-up state sent to the LED driver
+#define BOOT_PHASE_READY 2 // setup() done, main loop running
+#define BOOT_PHASE_WIFI 3  // Connected to the WiFi network (IP assigned)
+#define BOOT_PHASE_MQTT 4  // Connected to the MQTT broker
+#define BOOT_PHASES 5
+
+// States of the WiFi connection (see loopWiFi())
+#define WIFI_STATE_IDLE 0       // Not connecting (or in AP mode)
+#define WIFI_STATE_CONNECTING 1 // Waiting for the connection
+#define WIFI_STATE_CONNECTED 2  // Connected to the WiFi network
+
+// Groups of settings, as applied at runtime (see applySettings())
+#define SETTING_HOSTNAME 0x0001    // Hostname (mDNS/OTA and MQTT client ID)
+#define SETTING_MQTT_BROKER 0x0002 // MQTT broker and credentials
+#define SETTING_MQTT_WILL 0x0004   // Availability (LWT) topic and options
+#define SETTING_MQTT_COMMAND 0x0008 // Command and group topics
+#define SETTING_MQTT_STATE 0x0010   // State topic and options
+#define SETTING_DISCOVERY 0x0020    // Home Assistant MQTT discovery
+#define SETTING_WIFI 0x0040         // WiFi network
+#define SETTING_API 0x0080          // REST API enabled or not
+#define SETTING_FIXTURE 0x0100      // LED driver chains and channel mapping
+#define SETTINGS 9
+#define SETTINGS_ALL 0x01FF
+
+// The settings that can't be applied without a restart (the LED drivers are
+// set up at boot, and the mDNS responder of the ESP8266 core 2.3.0 can't be
+// stopped, so starting it again under a new hostname leaks its connection),
+// and the time the restart is delayed to send the report
+#define SETTINGS_RESTART (SETTING_HOSTNAME | SETTING_FIXTURE)
+#define SETTINGS_RESTART_DELAY 500
+
+// Interval between walks of the heap (in milliseconds) and the size of a heap
+// block (of umm_malloc)
+#define METRICS_HEAP_INTERVAL 1000
+#define METRICS_HEAP_BLOCK_SIZE 8
 
 // Key names as used internally and in the WebUI
 #define KEY_SETTINGS "s"
+#define KEY_SETTINGS_REPORT "r"
 #define KEY_DEVICE "d"
 
-#define KEY_STATE "state"
-#define KEY_BRIGHTNESS "brightness"
-#define KEY_WHITE "white_value"
-#define KEY_COLORTEMP "color_temp"
-#define KEY_FLASH "flash"
-#define KEY_COLOR "color"
-#define KEY_COLOR_R "r"
-#define KEY_COLOR_G "g"
-#define KEY_COLOR_B "b"
-#define KEY_GAMMA_CORRECTION "gamma"
-#define KEY_TRANSITION "transition"
-
 #define KEY_HOSTNAME "hostname"
 #define KEY_WIFI_SSID "wifi_ssid"
 #define KEY_WIFI_PSK "wifi_psk"
@@ -106,27 +279,46 @@ static const int BUFFER_SIZE = JSON_OBJECT_SIZE(13);
 #define KEY_MQTT_STATE_TOPIC "mqtt_state_topic"
 #define KEY_MQTT_COMMAND_TOPIC "mqtt_command_topic"
 #define KEY_MQTT_LWT_TOPIC "mqtt_lwt_topic"
+#define KEY_MQTT_GROUP_TOPIC "mqtt_group_topic"
+#define KEY_MQTT_STATE_PUBLISH "mqtt_state_publish"
+#define KEY_MQTT_LWT_PUBLISH "mqtt_lwt_publish"
 #define KEY_MQTT_HA_USE_DISCOVERY "switch_ha_discovery"
 #define KEY_MQTT_HA_IS_DISCOVERED "mqtt_ha_is_discovered"
 #define KEY_MQTT_HA_DISCOVERY_PREFIX "mqtt_ha_discovery_prefix"
 #define KEY_REST_API_ENABLED "switch_rest_api"
 #define KEY_REST_API_KEY "api_key"
 #define KEY_POWERUP_MODE "powerup_mode"
+#define KEY_FIXTURE "fixture"
 
 // MQTT Event type definitions
 #define MQTT_EVENT_CONNECT 0
 #define MQTT_EVENT_DISCONNECT 1
 #define MQTT_EVENT_MESSAGE 2
 
+// Topics published via the MQTT publish queue (in order of precedence)
+#define MQTT_TOPIC_AVAILABILITY 0
+#define MQTT_TOPIC_STATE 1
+#define MQTT_TOPIC_DISCOVERY 2
+#define MQTT_TOPIC_METRICS 3
+
+// Default publish options (QoS level and retain flag)
+#define MQTT_PUBLISH_OPTIONS                                                   \
+  (MQTT_QOS_LEVEL | (MQTT_RETAIN ? PUBLISH_RETAIN : 0))
+
 // HTTP
 #define HTTP_WEB_INDEX "index.html"
 #define HTTP_API_ROOT "api"
 #define HTTP_HEADER_APIKEY "API-Key"
+#define HTTP_PARAM_APIKEY "api_key"
 #define HTTP_HEADER_SERVER "Server"
 #define HTTP_HEADER_CONTENTTYPE "Content-Type"
 #define HTTP_HEADER_ALLOW "Allow"
+#define HTTP_HEADER_ETAG "ETag"
+#define HTTP_HEADER_IF_NONE_MATCH "If-None-Match"
 #define HTTP_MIMETYPE_HTML "text/html"
 #define HTTP_MIMETYPE_JSON "application/json"
+#define HTTP_MIMETYPE_PROMETHEUS "text/plain; version=0.0.4"
+#define HTTP_MIMETYPE_BINARY "application/octet-stream"
 #define HTTP_HEADER_XSS_PROTECTION "X-XSS-Protection"
 #define HTTP_HEADER_XSS_PROTECTION_VALUE "1; mode=block"
 #define HTTP_HEADER_CONTENT_TYPE_OPTIONS "X-Content-Type-Options"
@@ -135,8 +327,13 @@ static const int BUFFER_SIZE = JSON_OBJECT_SIZE(13);
 #define HTTP_HEADER_FRAME_OPTIONS_VALUE "deny"
 #define HTTP_HEADER_CONTENT_ENCODING "Content-Encoding"
 #define HTTP_HEADER_CONTENT_ENCODING_VALUE "gzip"
+#define HTTP_HEADER_CACHE_CONTROL "Cache-Control"
+#define HTTP_HEADER_CACHE_CONTROL_IMMUTABLE "public, max-age=31536000, immutable"
+#define HTTP_HEADER_CACHE_CONTROL_REVALIDATE "no-cache"
 #define HTTP_HEADER_ALLOW_GET "GET"
 #define HTTP_HEADER_ALLOW_GET_PATCH "GET, PATCH"
+#define HTTP_HEADER_ALLOW_GET_DELETE "GET, DELETE"
+#define HTTP_HEADER_ALLOW_POST "POST"
 
 const char *SERVER_SIGNATURE = APP_NAME "/" APP_VERSION;
 
@@ -144,73 +341,145 @@ const char *HTTP_ROUTE_INDEX = "/" HTTP_WEB_INDEX;
 const char *HTTP_APIROUTE_ROOT = "/" HTTP_API_ROOT;
 const char *HTTP_APIROUTE_ABOUT = "/" HTTP_API_ROOT "/about";
 const char *HTTP_APIROUTE_LIGHT = "/" HTTP_API_ROOT "/light";
+const char *HTTP_APIROUTE_METRICS = "/" HTTP_API_ROOT "/metrics";
+const char *HTTP_APIROUTE_RECORDING = "/" HTTP_API_ROOT "/recording";
+const char *HTTP_APIROUTE_BATCH = "/" HTTP_API_ROOT "/batch";
+const char *HTTP_ROUTE_EVENTS = "/events";
 
 AsyncWebSocket ws("/ws");
-AsyncEventSource events("/events");
+AsyncEventSource events(HTTP_ROUTE_EVENTS);
 AsyncWebServer *server;
 AsyncMqttClient mqtt;
-std::vector<void (*)(uint8_t, const char *, const char *)> _mqtt_callbacks;
+std::vector<void (*)(uint8_t, const char *, const char *, size_t)>
+    _mqtt_callbacks;
 Ticker wifiReconnectTimer;
 Ticker mqttReconnectTimer;
-
-// Configuration structure that gets stored to the EEPROM
-struct config_t {
-  uint8_t ic;                 // Initialization check
-  bool is_on;                 // Operational state (true == on)
-  uint8_t brightness;         // Brightness level
-  uint8_t color_temp;         // Colour temperature
-  Color color;                // RGBW channel levels
-  uint16_t mqtt_port;         // MQTT Broker port
-  char hostname[128];         // Hostname/Identifier
-  char wifi_ssid[32];         // WiFi SSID
-  char wifi_psk[63];          // WiFi Passphrase Key
-  char mqtt_server[128];      // Server/hostname of the MQTT Broker
-  char mqtt_user[64];         // Username used for connecting to the MQTT Broker
-  char mqtt_password[64];     // Password used for connecting to the MQTT Broker
-  char mqtt_state_topic[128]; // MQTT Topic for publishing the state
-  char mqtt_command_topic[128]; // MQTT Topic for receiving commands
-  char mqtt_lwt_topic[128];     // MQTT Topic for publishing Last Will and
-  // Testament
-  bool gamma;                 // Gamma Correction enabled or not
-  bool mqtt_ha_use_discovery; // Home Assistant MQTT discovery enabled or not
-  bool mqtt_ha_is_discovered; // Has this device already been discovered or
-  // not
-  char mqtt_ha_disc_prefix[32]; // MQTT Discovery prefix for Home Assistant
-  bool api;                     // REST API enabled or not
-  char api_key[32];             // API Key
-  uint8_t powerup_mode;         // Power Up Mode
-  my92xx_model_t chip_type;     // Device Type
-  uint8_t chip_count;
-} cfg;
+Ticker restartTimer;
+
+// Configuration (see configuration.h)
+config_t cfg;
+
+// Identifiers and topics derived from the configuration, built into fixed
+// storage (see buildTopics()) so they are never allocated at runtime
+struct topics_t {
+  char device_id[sizeof(HOSTNAME) + 7];           // '<HOSTNAME>-<chip id>'
+  char metrics[sizeof(cfg.mqtt_state_topic) + 8]; // '<state topic>/metrics'
+
+  // '<discovery prefix>/light/<hostname>/config'
+  char discovery[sizeof(cfg.mqtt_ha_disc_prefix) + sizeof(cfg.hostname) + 14];
+} topics;
+
+// The default topics are derived from the device identifier
+static_assert(sizeof(topics.device_id) + 7 <= sizeof(cfg.mqtt_lwt_topic),
+              "HOSTNAME is too long");
+
+// The hostname and topics in use before the settings change (to leave the
+// topics incrementally)
+struct settings_snapshot_t {
+  char hostname[sizeof(cfg.hostname)];
+  char command[sizeof(cfg.mqtt_command_topic)];
+  char group[sizeof(cfg.mqtt_group_topic)];
+  char discovery[sizeof(topics.discovery)];
+};
 
 AiLightClass *AiLight;
 
+// Persistence of the light state (separate from the configuration)
+SPIFlashStorage stateFlash;
+StateStoreClass StateStore;
+
+// Cached state payload (shared by MQTT, the WebSocket and the REST API)
+state_payload_t statePayload;
+
 const char *led_driver_table[2] = {"MY9291", "MY9231"};
 
-// Globals for flash
-bool flash = false;
-bool startFlash = false;
-uint16_t flashLength = 0;
-uint32_t flashStartTime = 0;
-Color flashColor;
-uint8_t flashBrightness = 0;
-
-// Globals for current state
-Color currentColor;
-uint8_t currentBrightness;
-bool currentState;
-
-// Globals for transition/fade
-bool state = false;
-uint16_t transitionTime = 0;
-uint32_t startTransTime = 0;
-int stepR, stepG, stepB, stepW, stepBrightness = 0;
-uint16_t stepCount = 0;
-Color transColor;
-uint8_t transBrightness = 0;
+// Effects (including flash) and transitions/fades
+SequencerClass Sequencer;
+TransitionClass Transition;
+
+// Decoder for light commands (MQTT, REST API and WebSocket)
+#ifdef MQTT_OPENHAB_SUPPORT
+CommandDecoderClass LightCommands(MQTT_PAYLOAD_ON, KEY_COLOR_ARRAY);
+#else
+CommandDecoderClass LightCommands(MQTT_PAYLOAD_ON, NULL);
+#endif
+
+// Light commands waiting to be processed by the main loop
+CommandQueueClass CommandQueue;
+
+// Realtime streaming
+RealtimeClass Realtime;
+WiFiUDP realtimeUDP;
+
+// Applies the light commands, and restores the light after a flash, effect or
+// stream
+LightControllerClass LightController(Sequencer, Transition, Realtime,
+                                     LIGHT_TRANSITION_EASING);
+
+// Log of the light commands received (see RECORDER_SIZE)
+#if RECORDER_SIZE > 0
+uint8_t recorderBuffer[RECORDER_SIZE];
+RecorderClass Recorder(recorderBuffer, sizeof(recorderBuffer));
+#else
+RecorderClass Recorder(NULL, 0);
+#endif
+
+// WebSocket clients and the state each has last been pushed
+ws_client_t wsClients[WS_CLIENTS_MAX];
+bool wsPushPending = false; // Set on a state change, until pushed to all
+uint32_t wsPushLast = 0;    // Time of the last push
+char wsMessage[WS_MESSAGE_SIZE]; // Message being received (NUL terminated)
+
+// Server-Sent Events (state changes and telemetry)
+bool eventsPushPending = false; // Set on a state change, until pushed
+uint32_t eventsPushLast = 0;    // Time of the last push
+uint32_t eventsTelemetry = 0;   // Time of the last telemetry event
+
+// WiFi connection
+uint8_t wifiState = WIFI_STATE_IDLE;
+uint32_t wifiStarted = 0; // Time the connection has been started
+bool wifiCached = false;  // Whether connecting with the cached parameters
+
+// Group synchronisation
+GroupSyncClass GroupSync;
+WiFiUDP groupUDP;
+bool groupJoined = false;
+
+// Group command received by the MQTT callback, held until its start
+struct group_command_t {
+  bool received;           // Set by the MQTT callback, taken by the main loop
+  uint32_t hash;           // Hash of the payload
+  light_command_t command; // The received command
+  light_command_t held;    // The command held until its start
+} groupCommand;
+
+// Metrics (durations in microseconds)
+struct metrics_t {
+  HistogramClass loop;                   // Main loop iterations
+  HistogramClass stages[METRICS_STAGES]; // Stages of processing a command
+  HistogramClass eeprom;                 // EEPROM commits
+  uint32_t heap_min;                     // Lowest amount of free heap
+  uint32_t heap_block_min; // Lowest size of the largest free heap block
+  uint32_t heap_sampled;   // Time the heap has last been walked
+  uint32_t wifi_reconnects;              // Number of WiFi reconnects
+  uint32_t mqtt_reconnects;              // Number of MQTT reconnects
+  uint32_t ws_skipped; // Number of WebSocket pushes skipped (slow clients)
+  uint32_t telemetry; // Time the telemetry has last been published
+  uint32_t boot[BOOT_PHASES]; // Time each boot phase has been reached
+  uint32_t wifi_cached;       // Number of connects with cached parameters
+} metrics;
 
 // Globals for MQTT
 bool _mqtt_connecting = false;
+bool _mqtt_connected_before = false; // Whether connected since boot
+PublishQueueClass MQTTQueue; // Messages waiting to be published
+char mqttMessage[MQTT_MESSAGE_SIZE]; // Message being assembled (NUL terminated)
+size_t mqttMessageReceived = 0;      // Bytes of it received so far
+
+// Globals for the REST API bodies arriving in parts (received one at a time,
+// the buffer only being allocated while the REST API is enabled)
+char *apiBody = NULL;                         // Body being received
+AsyncWebServerRequest *apiBodyRequest = NULL; // Request receiving it
 
 #ifdef DEBUG
 #define SerialPrint(format, ...)                                               \
@@ -260,39 +529,3 @@ void StreamPrint_progmem(Print &out, PGM_P format, ...) {
   out.print(ptr);
 }
 #endif
-
-/**
- * @brief Template to allow any type of data to be written to the EEPROM
- *
- * Although this template allows any type of data, it will primarily be used to
- * save the config_t struct.
- *
- * @param  value the data to be written to the EEPROM
- *
- * @return void
- */
-template <class T> void EEPROM_write(const T &value) {
-  uint16_t ee = EEPROM_START_ADDRESS;
-  const byte *p = (const byte *)(const void *)&value;
-  for (uint16_t i = 0; i < sizeof(value); i++)
-    EEPROM.write(ee++, *p++);
-
-  EEPROM.commit();
-}
-
-/**
- * @brief Template to allow any type of data to be read from the EEPROM
- *
- * Although this template allows any type of data, it will primarily be used to
- * read the EEPROM contents into the config_t struct.
- *
- * @param  value the data to be loaded into from the EEPROM
- *
- * @return void
- */
-template <class T> void EEPROM_read(T &value) {
-  uint16_t ee = EEPROM_START_ADDRESS;
-  byte *p = (byte *)(void *)&value;
-  for (uint16_t i = 0; i < sizeof(value); i++)
-    *p++ = EEPROM.read(ee++);
-}
@@ -18,15 +18,26 @@
  * @return the unique identifier of this Smart RGBW Light
  */
 const char *getDeviceID() {
-  char *identifier = new char[30];
-  os_strcpy(identifier, HOSTNAME);
-  strcat_P(identifier, PSTR("-"));
+  // Built once
+  if (topics.device_id[0] == '\0') {
+    snprintf_P(topics.device_id, sizeof(topics.device_id), PSTR("%s-%06X"),
+               HOSTNAME, ESP.getChipId());
+  }
 
-  char cidBuf[7];
-  sprintf(cidBuf, "%06X", ESP.getChipId());
-  os_strcat(identifier, cidBuf);
+  return topics.device_id;
+}
 
-  return identifier;
+/**
+ * @brief Builds the topics derived from the configuration
+ *
+ * To be called again once the configuration has changed.
+ */
+void buildTopics() {
+  snprintf_P(topics.discovery, sizeof(topics.discovery),
+             PSTR("%s/light/%s/config"), cfg.mqtt_ha_disc_prefix,
+             cfg.hostname);
+  snprintf_P(topics.metrics, sizeof(topics.metrics), PSTR("%s/metrics"),
+             cfg.mqtt_state_topic);
 }
 
 /**
@@ -44,22 +55,15 @@ String getESPCoreVersion() {
 }
 
 /**
- * @brief Loads the factory defaults for this Smart Light
+ * @brief Sets the configuration to the factory defaults (without storing it)
  *
  * If you like to change 'your' factory defaults, please change the appropriate
  * settings in your config.h file.
  *
  * @return void
  */
-void loadFactoryDefaults() {
-  // Clear EEPROM space
-  for (uint16_t i = 0; i < SPI_FLASH_SEC_SIZE; i++) {
-    EEPROM.write(i, 0xFF);
-  }
-  EEPROM.commit();
-
+void setConfigDefaults() {
   // Device defaults
-  cfg.ic = INIT_HASH;
   cfg.is_on = LIGHT_STATE;
   cfg.brightness = LIGHT_BRIGHTNESS;
   cfg.color_temp = LIGHT_COLOR_TEMPERATURE;
@@ -67,6 +71,12 @@ void loadFactoryDefaults() {
                LIGHT_COLOR_WHITE};
   cfg.chip_type = MY92XX_TYPE;
   cfg.chip_count = MY92XX_COUNT;
+  cfg.fixture = FixtureClass::defaults(MY92XX_TYPE, MY92XX_COUNT);
+#ifdef MY92XX_FIXTURE
+  if (!FixtureClass::parse(MY92XX_FIXTURE, cfg.fixture)) {
+    cfg.fixture = FixtureClass::defaults(MY92XX_TYPE, MY92XX_COUNT);
+  }
+#endif
 
   // Configuration defaults
   os_strcpy(cfg.hostname, getDeviceID());
@@ -77,13 +87,16 @@ void loadFactoryDefaults() {
   os_strcpy(cfg.mqtt_state_topic, getDeviceID());
 
   // MQTT Topics
-  char *cmd_topic = new char[128];
-  sprintf_P(cmd_topic, PSTR("%s/set"), getDeviceID());
-  os_strcpy(cfg.mqtt_command_topic, cmd_topic);
+  snprintf_P(cfg.mqtt_command_topic, sizeof(cfg.mqtt_command_topic),
+             PSTR("%s/set"), getDeviceID());
+  snprintf_P(cfg.mqtt_lwt_topic, sizeof(cfg.mqtt_lwt_topic), PSTR("%s/status"),
+             getDeviceID());
 
-  char *lwt_topic = new char[128];
-  sprintf_P(lwt_topic, PSTR("%s/status"), getDeviceID());
-  os_strcpy(cfg.mqtt_lwt_topic, lwt_topic);
+  cfg.mqtt_group_topic[0] = '\0';
+  cfg.mqtt_state_publish = MQTT_PUBLISH_OPTIONS;
+  cfg.mqtt_lwt_publish = MQTT_PUBLISH_OPTIONS;
+
+  cfg.wifi_cache.magic = 0; // Nothing cached yet
 
   cfg.mqtt_ha_use_discovery = MQTT_HOMEASSISTANT_DISCOVERY_ENABLED;
   cfg.mqtt_ha_is_discovered = false;
@@ -97,19 +110,39 @@ void loadFactoryDefaults() {
   os_strcpy(cfg.api_key, ADMIN_PASSWORD);
 
   cfg.powerup_mode = POWERUP_MODE;
+}
 
-  EEPROM_write(cfg);
+/**
+ * @brief Loads the factory defaults for this Smart Light
+ *
+ * @return void
+ */
+void loadFactoryDefaults() {
+  // Clear EEPROM space
+  for (uint16_t i = 0; i < SPI_FLASH_SEC_SIZE; i++) {
+    EEPROM.write(i, 0xFF);
+  }
+
+  setConfigDefaults();
+  saveConfig();
+  StateStore.clear();
 }
 
 /**
  * @brief Bootstrap/Initialization
  */
 void setup() {
-  EEPROM.begin(SPI_FLASH_SEC_SIZE);
-  EEPROM_read(cfg);
-  if (cfg.ic != INIT_HASH) {
-    loadFactoryDefaults();
-  }
+  recordBootPhase(BOOT_PHASE_SETUP);
+
+  setupStore();
+  loadConfig();
+
+  // Restore the light first: everything else (the debug output, connecting to
+  // the WiFi network, etc.) takes a while
+  AiLight = new AiLightClass(cfg.fixture);
+  AiLight->setRefreshRate(LIGHT_REFRESH_RATE);
+  LightController.begin(AiLight);
+  setupLight();
 
 // Serial Port Initialization
 #ifdef DEBUG
@@ -121,23 +154,40 @@ void setup() {
   DEBUGLOG("Firmware Build   : %s - %s\n", __DATE__, __TIME__);
   DEBUGLOG("ESP Core Version : %s\n", getESPCoreVersion().c_str());
   DEBUGLOG("Device Name      : %s\n", cfg.hostname);
-  DEBUGLOG("LED Driver       : %s\n", led_driver_table[cfg.chip_type]);
+  char fixture[FIXTURE_DESCRIPTION_SIZE];
+  FixtureClass::format(cfg.fixture, fixture, sizeof(fixture));
+  DEBUGLOG("LED Driver       : %s\n", fixture);
+  DEBUGLOG("Light Restored   : %u us\n", metrics.boot[BOOT_PHASE_LIGHT]);
   DEBUGLOG("\n");
 #endif
-  AiLight = new AiLightClass(cfg.chip_type, cfg.chip_count);
-  setupLight();
+  buildTopics();
+
   setupMQTT();
-  setupWiFi();
+  setupWiFi(); // Connected by loopWiFi()
   setupOTA();
   setupWeb();
+  setupRealtime();
 
   sendState(); // Notify subscribers about current state
+
+  recordBootPhase(BOOT_PHASE_READY);
 }
 
 /**
  * @brief Main loop
  */
 void loop() {
+  uint32_t start = ESP.getCycleCount();
+
+  loopWiFi();
   loopOTA();
+  loopGroup();
   loopLight();
+  loopRealtime();
+  loopOutput();
+  loopWebSocket();
+  loopEvents();
+  loopMQTT();
+  loopStore();
+  loopMetrics(start);
 }
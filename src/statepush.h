@@ -0,0 +1,244 @@
+/**
+ * AiLight Firmware - State Push
+ *
+ * The state payload shared by MQTT, the WebSocket and the REST API, and the
+ * pushes of its changes to the WebSocket clients (see loopWebSocket()). Each
+ * client is only sent the attributes that changed since it has last been sent
+ * the state, and a client that can't keep up is skipped until it has caught
+ * up. Kept apart from main.h so the native benchmarks can check the pushes on
+ * the host.
+ *
+ * This file is part of the AiLight Firmware.
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ *
+ * Created by Sacha Telgenhof <me at sachatelgenhof dot com>
+ * (https://www.sachatelgenhof.com)
+ * Copyright (c) 2016 - 2021 Sacha Telgenhof
+ */
+
+#ifndef AiLight_statepush_h
+#define AiLight_statepush_h
+
+#include "Sequencer.hpp"
+#include "StateStore.hpp"
+#include <Arduino.h>
+#include <stdarg.h>
+
+#ifndef MQTT_PAYLOAD_ON
+#define MQTT_PAYLOAD_ON "ON"
+#endif
+
+#ifndef MQTT_PAYLOAD_OFF
+#define MQTT_PAYLOAD_OFF "OFF"
+#endif
+
+#define STATE_PAYLOAD_SIZE 256
+
+// Key names of the light state (as used internally and in the WebUI)
+#define KEY_STATE "state"
+#define KEY_BRIGHTNESS "brightness"
+#define KEY_WHITE "white_value"
+#define KEY_COLORTEMP "color_temp"
+#define KEY_FLASH "flash"
+#define KEY_COLOR "color"
+#define KEY_COLOR_R "r"
+#define KEY_COLOR_G "g"
+#define KEY_COLOR_B "b"
+#define KEY_COLOR_W "w"
+#define KEY_COLOR_MODE "color_mode"
+#define KEY_GAMMA_CORRECTION "gamma"
+#define KEY_EFFECT "effect"
+#define KEY_TRANSITION "transition"
+
+// Results of handing a state message to a WebSocket client
+#define WS_PUSH_SENT 0   // Sent
+#define WS_PUSH_BEHIND 1 // Not sent, as the client can't keep up
+#define WS_PUSH_GONE 2   // Not sent, as the client has disconnected
+
+// Cached state payload (shared by MQTT, the WebSocket and the REST API)
+struct state_payload_t {
+  light_state_t state;           // The state the payload was rendered from
+  uint8_t effect;                // The effect the payload was rendered with
+  uint32_t boot;                 // Random identifier of this boot
+  uint32_t version;              // Incremented each time the state changes
+  size_t length;                 // Length of the payload (0 if not rendered)
+  char etag[20];                 // The version as an HTTP ETag
+  char json[STATE_PAYLOAD_SIZE]; // The payload (NUL terminated)
+};
+
+// A WebSocket client and the state it has last been pushed
+struct ws_client_t {
+  uint32_t id;         // WebSocket client identifier (0 if the slot is free)
+  light_state_t state; // The state the client has last been sent
+  uint8_t effect;      // The effect the client has last been sent
+};
+
+/**
+ * @brief Returns the name of an effect as published in the state payload
+ *
+ * @param effect the effect
+ *
+ * @return the name of the effect
+ */
+inline const char *getPayloadEffectName(uint8_t effect) {
+  // A flash is no effect that can be selected
+  const char *name = SequencerClass::getEffectName(effect);
+  if (name == NULL) {
+    name = SequencerClass::getEffectName(EFFECT_NONE);
+  }
+
+  return name;
+}
+
+/**
+ * @brief Appends a formatted field to a WebSocket state message
+ *
+ * @param buffer the buffer holding the message
+ * @param size the size of the buffer
+ * @param length the length of the message (updated)
+ * @param format the format of the field (in PROGMEM)
+ *
+ * @return void
+ */
+inline void wsAppend(char *buffer, size_t size, size_t &length, PGM_P format,
+                     ...) {
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf_P(buffer + length, size - length, format, args);
+  va_end(args);
+
+  if (written > 0) {
+    length += written;
+  }
+
+  // Truncated
+  if (length >= size) {
+    length = size - 1;
+  }
+}
+
+/**
+ * @brief Builds the message with the attributes of the state a WebSocket
+ * client hasn't been sent yet
+ *
+ * @param payload the current state payload
+ * @param client the client (with the state it has last been sent)
+ * @param buffer the buffer to hold the message
+ * @param size the size of the buffer
+ *
+ * @return the length of the message (0 if the client is up to date)
+ */
+inline size_t wsStateDelta(const state_payload_t &payload,
+                           const ws_client_t &client, char *buffer,
+                           size_t size) {
+  const light_state_t &from = client.state;
+  const light_state_t &to = payload.state;
+  size_t length = 0;
+
+  if (from.is_on != to.is_on) {
+    wsAppend(buffer, size, length, PSTR(",\"" KEY_STATE "\":\"%s\""),
+             to.is_on ? MQTT_PAYLOAD_ON : MQTT_PAYLOAD_OFF);
+  }
+
+  if (from.brightness != to.brightness) {
+    wsAppend(buffer, size, length, PSTR(",\"" KEY_BRIGHTNESS "\":%u"),
+             to.brightness);
+  }
+
+  if (from.white != to.white) {
+    wsAppend(buffer, size, length, PSTR(",\"" KEY_WHITE "\":%u"), to.white);
+  }
+
+  if (from.color_temp != to.color_temp) {
+    wsAppend(buffer, size, length, PSTR(",\"" KEY_COLORTEMP "\":%u"),
+             to.color_temp);
+  }
+
+  // The colour is always sent as a whole
+  if (from.red != to.red || from.green != to.green || from.blue != to.blue) {
+    wsAppend(buffer, size, length,
+             PSTR(",\"" KEY_COLOR "\":{\"" KEY_COLOR_R "\":%u,\"" KEY_COLOR_G
+                  "\":%u,\"" KEY_COLOR_B "\":%u}"),
+             to.red, to.green, to.blue);
+  }
+
+  if (from.gamma != to.gamma) {
+    wsAppend(buffer, size, length, PSTR(",\"" KEY_GAMMA_CORRECTION "\":%s"),
+             to.gamma ? "true" : "false");
+  }
+
+  if (client.effect != payload.effect) {
+    wsAppend(buffer, size, length, PSTR(",\"" KEY_EFFECT "\":\"%s\""),
+             getPayloadEffectName(payload.effect));
+  }
+
+  if (length == 0) {
+    return 0;
+  }
+
+  // Doesn't fit, so the whole state is sent instead
+  if (length + 1 >= size) {
+    length = (payload.length < size) ? payload.length : size - 1;
+    memcpy(buffer, payload.json, length);
+    buffer[length] = '\0';
+
+    return length;
+  }
+
+  // Replace the leading separator by the opening brace
+  buffer[0] = '{';
+  buffer[length++] = '}';
+  buffer[length] = '\0';
+
+  return length;
+}
+
+/**
+ * @brief Pushes the changes of the light state to the WebSocket clients
+ *
+ * Clients that can't keep up keep the state they have last been sent, so
+ * they are sent the accumulated changes once they have caught up. Clients
+ * that have disconnected are removed.
+ *
+ * @param payload the current state payload
+ * @param clients the WebSocket clients
+ * @param count the number of (slots of) WebSocket clients
+ * @param send the function handing a message to a client, given its id, the
+ * message and its length, returning the result (WS_PUSH_*)
+ *
+ * @return true if a client hasn't been sent the state (so it is to be pushed
+ * again), otherwise false
+ */
+template <class Send>
+bool wsPushState(const state_payload_t &payload, ws_client_t *clients,
+                 uint8_t count, Send send) {
+  char buffer[STATE_PAYLOAD_SIZE];
+  bool behind = false;
+
+  for (uint8_t i = 0; i < count; i++) {
+    ws_client_t &slot = clients[i];
+    if (slot.id == 0) {
+      continue;
+    }
+
+    size_t length = wsStateDelta(payload, slot, buffer, sizeof(buffer));
+    if (length == 0) {
+      continue;
+    }
+
+    uint8_t result = send(slot.id, buffer, length);
+    if (result == WS_PUSH_GONE) {
+      slot.id = 0;
+    } else if (result == WS_PUSH_BEHIND) {
+      behind = true;
+    } else {
+      slot.state = payload.state;
+      slot.effect = payload.effect;
+    }
+  }
+
+  return behind;
+}
+
+#endif